@@ -136,11 +136,12 @@ function gatherShader(item: Item, prog: string): string[] {
     res.push(...gatherSlang(item, prog, 'wgsl', '.wgsl', false));
     res.push('#elif defined(SOKOL_VULKAN)');
     res.push(...gatherSlang(item, prog, 'spirv_vk', '', true));
-    res.push('#elif defined(SOKOL_DUMMY_BACKEND)');
+    // the software backend has no shaders, it uses the same empty sources as the dummy backend
+    res.push('#elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE)');
     res.push(`static const char* ${item.prefix}_${prog}_vs_source_dummy = "";`);
     res.push(`static const char* ${item.prefix}_${prog}_fs_source_dummy = "";`);
     res.push('#else');
-    res.push('#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"');
+    res.push('#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN, SOKOL_SOFTWARE or SOKOL_DUMMY_BACKEND!"');
     res.push('#endif');
     return res;
 }
@@ -360,6 +360,22 @@
             Display has been cast to a void pointer in order to be tunneled
             through code which doesn't include X11/Xlib.h.
 
+        uint32_t sapp_x11_get_num_roundtrips(void)
+            On Linux, get the number of synchronous X server round trips
+            (requests which wait for a reply) that sokol_app.h has issued
+            so far, including startup, otherwise zero. This is a best-effort
+            debugging aid which counts the Xlib calls in sokol_app.h that may
+            wait for a reply, so it is an upper bound (for instance Xlib
+            answers repeated atom lookups from a client-side cache). Requests
+            issued inside other libraries are not counted, for instance by
+            Xcursor when loading cursor images, or by the GL driver in
+            glXSwapBuffers() or eglSwapBuffers(). The window size is tracked
+            via ConfigureNotify events, and the event loop doesn't issue any
+            synchronous requests, so the counter should not increase in a
+            steady-state frame. Only resizing via sapp_toggle_fullscreen(),
+            mouse locking, clipboard access and drag'n'drop query the X
+            server.
+
         const void* sapp_wgpu_get_device(void)
         const void* sapp_wgpu_get_render_view(void)
         const void* sapp_wgpu_get_resolve_view(void)
@@ -1831,6 +1847,7 @@ typedef struct sapp_allocator {
     _SAPP_LOGITEM_XMACRO(VULKAN_CREATE_INSTANCE_FAILED, "vulkan: vkCreateInstance failed") \
     _SAPP_LOGITEM_XMACRO(VULKAN_ENUMERATE_PHYSICAL_DEVICES_FAILED, "vulkan: vkEnumeratePhysicalDevices failed") \
     _SAPP_LOGITEM_XMACRO(VULKAN_NO_PHYSICAL_DEVICES_FOUND, "vulkan: vkEnumeratePhysicalDevices return no devices") \
+    _SAPP_LOGITEM_XMACRO(VULKAN_TIMELINE_SEMAPHORE_NOT_SUPPORTED, "vulkan: physical device skipped because it doesn't support the Vulkan 1.2 timelineSemaphore feature") \
     _SAPP_LOGITEM_XMACRO(VULKAN_NO_SUITABLE_PHYSICAL_DEVICE_FOUND, "vulkan: no suitable physical device found") \
     _SAPP_LOGITEM_XMACRO(VULKAN_CREATE_DEVICE_FAILED_EXTENSION_NOT_PRESENT, "vulkan: vkCreateDevice failed (extension not present)") \
     _SAPP_LOGITEM_XMACRO(VULKAN_CREATE_DEVICE_FAILED_FEATURE_NOT_PRESENT, "vulkan: vkCreateDevice failed (feature not present)") \
@@ -1913,6 +1930,12 @@ typedef struct sapp_vulkan_environment {
     const void* device;
     const void* queue;
     uint32_t queue_family_index;
+    const void* compute_queue;              // optional dedicated compute queue (may be null)
+    uint32_t compute_queue_family_index;
+    bool timeline_semaphore;                // true if the Vulkan 1.2 timelineSemaphore feature is enabled (always true for sokol_app.h devices)
+    bool host_query_reset;                  // true if the Vulkan 1.2 hostQueryReset feature is enabled
+    bool pipeline_statistics_query;         // true if the pipelineStatisticsQuery feature is enabled
+    bool descriptor_indexing;               // true if the Vulkan 1.2 descriptorBindingPartiallyBound and runtimeDescriptorArray features are enabled
 } sapp_vulkan_environment;
 
 typedef struct sapp_environment {
@@ -2287,6 +2310,8 @@ SOKOL_APP_API_DECL bool sapp_gl_is_gles(void);
 SOKOL_APP_API_DECL const void* sapp_x11_get_window(void);
 /* X11: get Display */
 SOKOL_APP_API_DECL const void* sapp_x11_get_display(void);
+/* X11: get number of synchronous X server round trips issued by sokol_app.h (debugging aid) */
+SOKOL_APP_API_DECL uint32_t sapp_x11_get_num_roundtrips(void);
 
 /* Android: get native activity handle */
 SOKOL_APP_API_DECL const void* sapp_android_get_native_activity(void);
@@ -2784,8 +2809,15 @@ typedef struct {
     VkSurfaceFormatKHR surface_format;
     VkPhysicalDevice physical_device;
     uint32_t queue_family_index;
+    uint32_t compute_queue_family_index;
+    bool has_compute_queue;
+    bool timeline_semaphore;
+    bool host_query_reset;
+    bool pipeline_statistics_query;
+    bool descriptor_indexing;
     VkDevice device;
     VkQueue queue;
+    VkQueue compute_queue;
     VkSwapchainKHR swapchain;
     bool swapchain_valid;
     bool swapchain_acquired;
@@ -3182,9 +3214,15 @@ typedef struct {
     int window_state;
     float dpi;
     unsigned char error_code;
+    bool size_changed;          // set by ConfigureNotify, window size is applied at the start of the next frame
+    int window_width;           // last window size reported by ConfigureNotify
+    int window_height;
+    uint32_t num_roundtrips;    // Xlib calls which may wait for a reply (see sapp_x11_get_num_roundtrips())
     Atom UTF8_STRING;
     Atom CLIPBOARD;
     Atom TARGETS;
+    Atom SAPP_SELECTION;
+    Atom INCR;
     Atom WM_PROTOCOLS;
     Atom WM_DELETE_WINDOW;
     Atom WM_STATE;
@@ -4534,6 +4572,17 @@ _SOKOL_PRIVATE void _sapp_vk_pick_physical_device(void) {
         if (!_sapp_vk_check_device_extensions(pdev, ext_names, ext_count)) {
             continue;
         }
+        // sokol-gfx frame-sync requires timeline semaphores (core in Vulkan 1.2 but still an optional feature)
+        _SAPP_STRUCT(VkPhysicalDeviceVulkan12Features, supports_vk12);
+        supports_vk12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        _SAPP_STRUCT(VkPhysicalDeviceFeatures2, supports);
+        supports.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supports.pNext = &supports_vk12;
+        vkGetPhysicalDeviceFeatures2(pdev, &supports);
+        if (!supports_vk12.timelineSemaphore) {
+            _SAPP_WARN(VULKAN_TIMELINE_SEMAPHORE_NOT_SUPPORTED);
+            continue;
+        }
         // FIXME: handle theoretical case where graphics and present aren't supported by the same queue family index
         _SAPP_VK_MAX_COUNT_AND_ARRAY(8, VkQueueFamilyProperties, queue_family_props_count, queue_family_props);
         vkGetPhysicalDeviceQueueFamilyProperties(pdev, &queue_family_props_count, queue_family_props);
@@ -4550,6 +4599,16 @@ _SOKOL_PRIVATE void _sapp_vk_pick_physical_device(void) {
         if (!has_required_queues) {
             continue;
         }
+        // optional: a dedicated compute queue family for async compute passes in sokol_gfx.h
+        _sapp.vk.has_compute_queue = false;
+        for (uint32_t qfp_idx = 0; qfp_idx < queue_family_props_count; qfp_idx++) {
+            const VkQueueFlags queue_flags = queue_family_props[qfp_idx].queueFlags;
+            if ((queue_flags & VK_QUEUE_COMPUTE_BIT) && (0 == (queue_flags & VK_QUEUE_GRAPHICS_BIT))) {
+                _sapp.vk.compute_queue_family_index = qfp_idx;
+                _sapp.vk.has_compute_queue = true;
+                break;
+            }
+        }
 
         VkBool32 presentation_supported = false;
         res = vkGetPhysicalDeviceSurfaceSupportKHR(pdev, _sapp.vk.queue_family_index, _sapp.vk.surface, &presentation_supported);
@@ -4574,17 +4633,28 @@ _SOKOL_PRIVATE void _sapp_vk_create_device(void) {
     SOKOL_ASSERT(0 == _sapp.vk.device);
 
     const float queue_priority = 0.0f;
-    _SAPP_STRUCT(VkDeviceQueueCreateInfo, queue_create_info);
-    queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
-    queue_create_info.queueFamilyIndex = _sapp.vk.queue_family_index;
-    queue_create_info.queueCount = 1;
-    queue_create_info.pQueuePriorities = &queue_priority;
+    _SAPP_STRUCT(VkDeviceQueueCreateInfo, queue_create_infos[2]);
+    uint32_t num_queue_create_infos = 1;
+    queue_create_infos[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_create_infos[0].queueFamilyIndex = _sapp.vk.queue_family_index;
+    queue_create_infos[0].queueCount = 1;
+    queue_create_infos[0].pQueuePriorities = &queue_priority;
+    if (_sapp.vk.has_compute_queue) {
+        queue_create_infos[1].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_create_infos[1].queueFamilyIndex = _sapp.vk.compute_queue_family_index;
+        queue_create_infos[1].queueCount = 1;
+        queue_create_infos[1].pQueuePriorities = &queue_priority;
+        num_queue_create_infos = 2;
+    }
 
     _SAPP_VK_ZERO_COUNT_AND_ARRAY(32, const char*, ext_count, ext_names);
     ext_count = _sapp_vk_required_device_extensions(ext_names, 32);
 
+    _SAPP_STRUCT(VkPhysicalDeviceVulkan12Features, supports_vk12);
+    supports_vk12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
     _SAPP_STRUCT(VkPhysicalDeviceFeatures2, supports);
     supports.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    supports.pNext = &supports_vk12;
     vkGetPhysicalDeviceFeatures2(_sapp.vk.physical_device, &supports);
 
     _SAPP_STRUCT(VkPhysicalDeviceDescriptorBufferFeaturesEXT, descriptor_buffer_features);
@@ -4600,6 +4670,21 @@ _SOKOL_PRIVATE void _sapp_vk_create_device(void) {
     vk12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
     vk12_features.pNext = &xds_features;
     vk12_features.bufferDeviceAddress = VK_TRUE;
+    // checked in _sapp_vk_pick_physical_device()
+    SOKOL_ASSERT(supports_vk12.timelineSemaphore);
+    vk12_features.timelineSemaphore = VK_TRUE;
+    _sapp.vk.timeline_semaphore = true;
+    // optional features for the sokol-gfx bindless descriptor heap
+    if (supports_vk12.descriptorBindingPartiallyBound && supports_vk12.runtimeDescriptorArray) {
+        vk12_features.descriptorBindingPartiallyBound = VK_TRUE;
+        vk12_features.runtimeDescriptorArray = VK_TRUE;
+        vk12_features.shaderSampledImageArrayNonUniformIndexing = supports_vk12.shaderSampledImageArrayNonUniformIndexing;
+        vk12_features.shaderStorageBufferArrayNonUniformIndexing = supports_vk12.shaderStorageBufferArrayNonUniformIndexing;
+        _sapp.vk.descriptor_indexing = true;
+    }
+    // optional feature for sokol-gfx GPU counters
+    vk12_features.hostQueryReset = supports_vk12.hostQueryReset;
+    _sapp.vk.host_query_reset = VK_TRUE == supports_vk12.hostQueryReset;
 
     _SAPP_STRUCT(VkPhysicalDeviceVulkan13Features, vk13_features);
     vk13_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
@@ -4612,6 +4697,9 @@ _SOKOL_PRIVATE void _sapp_vk_create_device(void) {
     required.pNext = &vk13_features;
     required.features.samplerAnisotropy = VK_TRUE;
     required.features.dualSrcBlend = VK_TRUE;
+    // optional feature for sokol-gfx pipeline statistics counters
+    required.features.pipelineStatisticsQuery = supports.features.pipelineStatisticsQuery;
+    _sapp.vk.pipeline_statistics_query = VK_TRUE == supports.features.pipelineStatisticsQuery;
     if (supports.features.textureCompressionBC) {
         required.features.textureCompressionBC = VK_TRUE;
     }
@@ -4624,8 +4712,8 @@ _SOKOL_PRIVATE void _sapp_vk_create_device(void) {
     _SAPP_STRUCT(VkDeviceCreateInfo, dev_create_info);
     dev_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     dev_create_info.pNext = &required;
-    dev_create_info.queueCreateInfoCount = 1;
-    dev_create_info.pQueueCreateInfos = &queue_create_info;
+    dev_create_info.queueCreateInfoCount = num_queue_create_infos;
+    dev_create_info.pQueueCreateInfos = queue_create_infos;
     dev_create_info.enabledExtensionCount = ext_count;
     dev_create_info.ppEnabledExtensionNames = ext_names;
 
@@ -4651,6 +4739,11 @@ _SOKOL_PRIVATE void _sapp_vk_create_device(void) {
     SOKOL_ASSERT(0 == _sapp.vk.queue);
     vkGetDeviceQueue(_sapp.vk.device, _sapp.vk.queue_family_index, 0, &_sapp.vk.queue);
     SOKOL_ASSERT(_sapp.vk.queue);
+    if (_sapp.vk.has_compute_queue) {
+        SOKOL_ASSERT(0 == _sapp.vk.compute_queue);
+        vkGetDeviceQueue(_sapp.vk.device, _sapp.vk.compute_queue_family_index, 0, &_sapp.vk.compute_queue);
+        SOKOL_ASSERT(_sapp.vk.compute_queue);
+    }
 }
 
 _SOKOL_PRIVATE void _sapp_vk_destroy_device(void) {
@@ -4658,6 +4751,7 @@ _SOKOL_PRIVATE void _sapp_vk_destroy_device(void) {
     vkDestroyDevice(_sapp.vk.device, 0);
     _sapp.vk.device = 0;
     _sapp.vk.queue = 0;
+    _sapp.vk.compute_queue = 0;
 }
 
 _SOKOL_PRIVATE void _sapp_vk_create_surface(void) {
@@ -12152,38 +12246,49 @@ _SOKOL_PRIVATE void _sapp_x11_grab_error_handler(void) {
 
 _SOKOL_PRIVATE void _sapp_x11_release_error_handler(void) {
     XSync(_sapp.x11.display, False);
+    _sapp.x11.num_roundtrips++;
     XSetErrorHandler(NULL);
 }
 
+// XInternAtom() waits for a reply unless the atom is already in Xlib's atom cache
+_SOKOL_PRIVATE Atom _sapp_x11_intern_atom(const char* name) {
+    _sapp.x11.num_roundtrips++;
+    return XInternAtom(_sapp.x11.display, name, False);
+}
+
 _SOKOL_PRIVATE void _sapp_x11_init_extensions(void) {
-    _sapp.x11.UTF8_STRING             = XInternAtom(_sapp.x11.display, "UTF8_STRING", False);
-    _sapp.x11.WM_PROTOCOLS            = XInternAtom(_sapp.x11.display, "WM_PROTOCOLS", False);
-    _sapp.x11.WM_DELETE_WINDOW        = XInternAtom(_sapp.x11.display, "WM_DELETE_WINDOW", False);
-    _sapp.x11.WM_STATE                = XInternAtom(_sapp.x11.display, "WM_STATE", False);
-    _sapp.x11.NET_WM_NAME             = XInternAtom(_sapp.x11.display, "_NET_WM_NAME", False);
-    _sapp.x11.NET_WM_ICON_NAME        = XInternAtom(_sapp.x11.display, "_NET_WM_ICON_NAME", False);
-    _sapp.x11.NET_WM_ICON             = XInternAtom(_sapp.x11.display, "_NET_WM_ICON", False);
-    _sapp.x11.NET_WM_STATE            = XInternAtom(_sapp.x11.display, "_NET_WM_STATE", False);
-    _sapp.x11.NET_WM_STATE_FULLSCREEN = XInternAtom(_sapp.x11.display, "_NET_WM_STATE_FULLSCREEN", False);
-    _sapp.x11.CLIPBOARD = XInternAtom(_sapp.x11.display, "CLIPBOARD", False);
-    _sapp.x11.TARGETS   = XInternAtom(_sapp.x11.display, "TARGETS", False);
+    _sapp.x11.UTF8_STRING             = _sapp_x11_intern_atom("UTF8_STRING");
+    _sapp.x11.WM_PROTOCOLS            = _sapp_x11_intern_atom("WM_PROTOCOLS");
+    _sapp.x11.WM_DELETE_WINDOW        = _sapp_x11_intern_atom("WM_DELETE_WINDOW");
+    _sapp.x11.WM_STATE                = _sapp_x11_intern_atom("WM_STATE");
+    _sapp.x11.NET_WM_NAME             = _sapp_x11_intern_atom("_NET_WM_NAME");
+    _sapp.x11.NET_WM_ICON_NAME        = _sapp_x11_intern_atom("_NET_WM_ICON_NAME");
+    _sapp.x11.NET_WM_ICON             = _sapp_x11_intern_atom("_NET_WM_ICON");
+    _sapp.x11.NET_WM_STATE            = _sapp_x11_intern_atom("_NET_WM_STATE");
+    _sapp.x11.NET_WM_STATE_FULLSCREEN = _sapp_x11_intern_atom("_NET_WM_STATE_FULLSCREEN");
+    _sapp.x11.CLIPBOARD = _sapp_x11_intern_atom("CLIPBOARD");
+    _sapp.x11.TARGETS   = _sapp_x11_intern_atom("TARGETS");
+    _sapp.x11.SAPP_SELECTION = _sapp_x11_intern_atom("SAPP_SELECTION");
+    _sapp.x11.INCR      = _sapp_x11_intern_atom("INCR");
     if (_sapp.drop.enabled) {
-        _sapp.x11.xdnd.XdndAware        = XInternAtom(_sapp.x11.display, "XdndAware", False);
-        _sapp.x11.xdnd.XdndEnter        = XInternAtom(_sapp.x11.display, "XdndEnter", False);
-        _sapp.x11.xdnd.XdndPosition     = XInternAtom(_sapp.x11.display, "XdndPosition", False);
-        _sapp.x11.xdnd.XdndStatus       = XInternAtom(_sapp.x11.display, "XdndStatus", False);
-        _sapp.x11.xdnd.XdndActionCopy   = XInternAtom(_sapp.x11.display, "XdndActionCopy", False);
-        _sapp.x11.xdnd.XdndDrop         = XInternAtom(_sapp.x11.display, "XdndDrop", False);
-        _sapp.x11.xdnd.XdndFinished     = XInternAtom(_sapp.x11.display, "XdndFinished", False);
-        _sapp.x11.xdnd.XdndSelection    = XInternAtom(_sapp.x11.display, "XdndSelection", False);
-        _sapp.x11.xdnd.XdndTypeList     = XInternAtom(_sapp.x11.display, "XdndTypeList", False);
-        _sapp.x11.xdnd.text_uri_list    = XInternAtom(_sapp.x11.display, "text/uri-list", False);
+        _sapp.x11.xdnd.XdndAware        = _sapp_x11_intern_atom("XdndAware");
+        _sapp.x11.xdnd.XdndEnter        = _sapp_x11_intern_atom("XdndEnter");
+        _sapp.x11.xdnd.XdndPosition     = _sapp_x11_intern_atom("XdndPosition");
+        _sapp.x11.xdnd.XdndStatus       = _sapp_x11_intern_atom("XdndStatus");
+        _sapp.x11.xdnd.XdndActionCopy   = _sapp_x11_intern_atom("XdndActionCopy");
+        _sapp.x11.xdnd.XdndDrop         = _sapp_x11_intern_atom("XdndDrop");
+        _sapp.x11.xdnd.XdndFinished     = _sapp_x11_intern_atom("XdndFinished");
+        _sapp.x11.xdnd.XdndSelection    = _sapp_x11_intern_atom("XdndSelection");
+        _sapp.x11.xdnd.XdndTypeList     = _sapp_x11_intern_atom("XdndTypeList");
+        _sapp.x11.xdnd.text_uri_list    = _sapp_x11_intern_atom("text/uri-list");
     }
 
     /* check Xi extension for raw mouse input */
+    _sapp.x11.num_roundtrips++;
     if (XQueryExtension(_sapp.x11.display, "XInputExtension", &_sapp.x11.xi.major_opcode, &_sapp.x11.xi.event_base, &_sapp.x11.xi.error_base)) {
         _sapp.x11.xi.major = 2;
         _sapp.x11.xi.minor = 0;
+        _sapp.x11.num_roundtrips++;
         if (XIQueryVersion(_sapp.x11.display, &_sapp.x11.xi.major, &_sapp.x11.xi.minor) == Success) {
             _sapp.x11.xi.available = true;
         }
@@ -12367,6 +12472,7 @@ _SOKOL_PRIVATE void _sapp_x11_init_keytable(void) {
     XkbDescPtr desc = XkbGetMap(_sapp.x11.display, 0, XkbUseCoreKbd);
     SOKOL_ASSERT(desc);
     XkbGetNames(_sapp.x11.display, XkbKeyNamesMask | XkbKeyAliasesMask, desc);
+    _sapp.x11.num_roundtrips += 2;
 
     const int scancode_min = desc->min_key_code;
     const int scancode_max = desc->max_key_code;
@@ -12528,6 +12634,7 @@ _SOKOL_PRIVATE void _sapp_x11_init_keytable(void) {
 
     int width = 0;
     KeySym* keysyms = XGetKeyboardMapping(_sapp.x11.display, scancode_min, scancode_max - scancode_min + 1, &width);
+    _sapp.x11.num_roundtrips++;
     for (int scancode = scancode_min; scancode <= scancode_max; scancode++) {
         // translate untranslated key codes using the traditional X11 KeySym lookups
         if (_sapp.keycodes[scancode] == SAPP_KEYCODE_INVALID) {
@@ -12918,9 +13025,12 @@ _SOKOL_PRIVATE void _sapp_x11_update_dimensions(int x11_window_width, int x11_wi
     #endif
 }
 
+// NOTE: this is a synchronous round trip to the X server, only call it when
+// the window size can't be obtained from a ConfigureNotify event
 _SOKOL_PRIVATE void _sapp_x11_update_dimensions_from_window_size(void) {
     XWindowAttributes attribs;
     XGetWindowAttributes(_sapp.x11.display, _sapp.x11.window, &attribs);
+    _sapp.x11.num_roundtrips++;
     _sapp_x11_update_dimensions(attribs.width, attribs.height);
 }
 
@@ -13083,6 +13193,7 @@ _SOKOL_PRIVATE void _sapp_x11_lock_mouse(bool lock) {
             _sapp.x11.window,           // confine_to
             _sapp.x11.hidden_cursor,    // cursor
             CurrentTime);               // time
+        _sapp.x11.num_roundtrips++;
     } else {
         if (_sapp.x11.xi.available) {
             XIEventMask em;
@@ -13105,6 +13216,7 @@ _SOKOL_PRIVATE void _sapp_x11_set_clipboard_string(const char* str) {
         _SAPP_ERROR(CLIPBOARD_STRING_TOO_BIG);
     }
     XSetSelectionOwner(_sapp.x11.display, _sapp.x11.CLIPBOARD, _sapp.x11.window, CurrentTime);
+    _sapp.x11.num_roundtrips++;
     if (XGetSelectionOwner(_sapp.x11.display, _sapp.x11.CLIPBOARD) != _sapp.x11.window) {
         _SAPP_ERROR(LINUX_X11_FAILED_TO_BECOME_OWNER_OF_CLIPBOARD);
     }
@@ -13112,8 +13224,9 @@ _SOKOL_PRIVATE void _sapp_x11_set_clipboard_string(const char* str) {
 
 _SOKOL_PRIVATE const char* _sapp_x11_get_clipboard_string(void) {
     SOKOL_ASSERT(_sapp.clipboard.enabled && _sapp.clipboard.buffer);
-    Atom none = XInternAtom(_sapp.x11.display, "SAPP_SELECTION", False);
-    Atom incremental = XInternAtom(_sapp.x11.display, "INCR", False);
+    Atom none = _sapp.x11.SAPP_SELECTION;
+    Atom incremental = _sapp.x11.INCR;
+    _sapp.x11.num_roundtrips++;
     if (XGetSelectionOwner(_sapp.x11.display, _sapp.x11.CLIPBOARD) == _sapp.x11.window) {
         // Instead of doing a large number of X round-trips just to put this
         // string into a window property and then read it back, just return it
@@ -13148,6 +13261,7 @@ _SOKOL_PRIVATE const char* _sapp_x11_get_clipboard_string(void) {
                         &itemCount,
                         &bytesAfter,
                         (unsigned char**) &data);
+    _sapp.x11.num_roundtrips++;
     if (ret != Success || data == NULL) {
         if (data != NULL) {
             XFree(data);
@@ -13296,6 +13410,7 @@ _SOKOL_PRIVATE void _sapp_x11_destroy_window(void) {
 _SOKOL_PRIVATE bool _sapp_x11_window_visible(void) {
     XWindowAttributes wa;
     XGetWindowAttributes(_sapp.x11.display, _sapp.x11.window, &wa);
+    _sapp.x11.num_roundtrips++;
     return wa.map_state == IsViewable;
 }
 
@@ -13330,6 +13445,7 @@ _SOKOL_PRIVATE unsigned long _sapp_x11_get_window_property(Window window, Atom p
                        &itemCount,
                        &bytesAfter,
                        value);
+    _sapp.x11.num_roundtrips++;
     return itemCount;
 }
 
@@ -13913,6 +14029,17 @@ _SOKOL_PRIVATE void _sapp_x11_on_selectionrequest(XEvent* event) {
     XSendEvent(_sapp.x11.display, req->requestor, False, 0, (XEvent*) &reply);
 }
 
+_SOKOL_PRIVATE void _sapp_x11_on_configurenotify(XEvent* event) {
+    // track the window size from events instead of calling XGetWindowAttributes()
+    // each frame, only the last size in a batch of events is applied in _sapp_linux_frame()
+    const XConfigureEvent* ev = &event->xconfigure;
+    if (ev->window == _sapp.x11.window) {
+        _sapp.x11.window_width = ev->width;
+        _sapp.x11.window_height = ev->height;
+        _sapp.x11.size_changed = true;
+    }
+}
+
 _SOKOL_PRIVATE void _sapp_x11_process_event(XEvent* event) {
     switch (event->type) {
         case GenericEvent:
@@ -13954,6 +14081,9 @@ _SOKOL_PRIVATE void _sapp_x11_process_event(XEvent* event) {
         case SelectionRequest:
             _sapp_x11_on_selectionrequest(event);
             break;
+        case ConfigureNotify:
+            _sapp_x11_on_configurenotify(event);
+            break;
         case DestroyNotify:
             // not a bug
             break;
@@ -14119,7 +14249,10 @@ _SOKOL_PRIVATE void _sapp_egl_destroy(void) {
 #endif // _SAPP_EGL
 
 _SOKOL_PRIVATE void _sapp_linux_frame(void) {
-    _sapp_x11_update_dimensions_from_window_size();
+    if (_sapp.x11.size_changed) {
+        _sapp.x11.size_changed = false;
+        _sapp_x11_update_dimensions(_sapp.x11.window_width, _sapp.x11.window_height);
+    }
     #if defined(SOKOL_WGPU)
         _sapp_wgpu_frame();
     #elif defined(SOKOL_VULKAN)
@@ -14192,13 +14325,17 @@ _SOKOL_PRIVATE void _sapp_linux_run(const sapp_desc* desc) {
     XFlush(_sapp.x11.display);
     while (!_sapp.quit_ordered) {
         _sapp_timing_update(&_sapp.timing, 0.0);
-        int count = XPending(_sapp.x11.display);
+        // NOTE: XPending() would flush the output buffer first, but that already
+        // happens once per frame below, QueuedAfterReading only does a
+        // non-blocking read of events which have arrived in the meantime
+        int count = XEventsQueued(_sapp.x11.display, QueuedAfterReading);
         while (count--) {
             XEvent event;
             XNextEvent(_sapp.x11.display, &event);
             _sapp_x11_process_event(&event);
         }
         _sapp_linux_frame();
+        // a single flush per frame for all requests issued by event handling and the frame callback
         XFlush(_sapp.x11.display);
         // handle quit-requested, either from window or from sapp_request_quit()
         if (_sapp.quit_requested && !_sapp.quit_ordered) {
@@ -14757,6 +14894,12 @@ SOKOL_API_IMPL sapp_environment sapp_get_environment(void) {
         res.vulkan.device = (const void*) _sapp.vk.device;
         res.vulkan.queue = (const void*) _sapp.vk.queue;
         res.vulkan.queue_family_index = _sapp.vk.queue_family_index;
+        res.vulkan.compute_queue = (const void*) _sapp.vk.compute_queue;
+        res.vulkan.compute_queue_family_index = _sapp.vk.compute_queue_family_index;
+        res.vulkan.timeline_semaphore = _sapp.vk.timeline_semaphore;
+        res.vulkan.host_query_reset = _sapp.vk.host_query_reset;
+        res.vulkan.pipeline_statistics_query = _sapp.vk.pipeline_statistics_query;
+        res.vulkan.descriptor_indexing = _sapp.vk.descriptor_indexing;
     #endif
     return res;
 }
@@ -14916,6 +15059,14 @@ SOKOL_API_IMPL const void* sapp_x11_get_display(void) {
     #endif
 }
 
+SOKOL_API_IMPL uint32_t sapp_x11_get_num_roundtrips(void) {
+    #if defined(_SAPP_LINUX)
+        return _sapp.x11.num_roundtrips;
+    #else
+        return 0;
+    #endif
+}
+
 SOKOL_API_IMPL const void* sapp_android_get_native_activity(void) {
     // NOTE: _sapp.valid is not asserted here because sapp_android_get_native_activity()
     // needs to be callable from within sokol_main() (see: https://github.com/floooh/sokol/issues/708)
@@ -23,6 +23,7 @@
         #define SOKOL_METAL
         #define SOKOL_WGPU
         #define SOKOL_VULKAN
+        #define SOKOL_SOFTWARE
         #define SOKOL_DUMMY_BACKEND
 
     I.e. for the desktop GL it should look like this:
@@ -37,6 +38,11 @@
     stub functions. This is useful for writing tests that need to run on the
     command line.
 
+    The software backend (SOKOL_SOFTWARE) doesn't need a GPU or 3D-API at all,
+    instead it rasterizes on the CPU into memory owned by sokol-gfx or the
+    caller. Shaders are provided as C function pointers. See the section
+    SOFTWARE BACKEND below for details.
+
     Optionally provide the following defines with your own implementations:
 
     SOKOL_ASSERT(c)             - your own assert macro (default: assert(c))
@@ -45,6 +51,8 @@
     SOKOL_API_DECL              - same as SOKOL_GFX_API_DECL
     SOKOL_API_IMPL              - public function implementation prefix (default: -)
     SOKOL_TRACE_HOOKS           - enable trace hook callbacks (search below for TRACE HOOKS)
+    SOKOL_MULTI_CONTEXT         - enable multiple sokol-gfx contexts (search below for MULTIPLE CONTEXTS)
+    SOKOL_LOADER_THREADS        - allow resource creation on loader threads (search below for LOADER THREADS)
     SOKOL_EXTERNAL_GL_LOADER    - indicates that you're using your own GL loader, in this case
                                   sokol_gfx.h will not include any platform GL headers and disable
                                   the integrated Win32 GL loader
@@ -71,6 +79,7 @@
     - on Linux with EGL: GL or GLESv2
     - on Linux with GLX: GL
     - on Linux with Vulkan: vulkan
+    - on Linux with the software backend: pthread, m
     - on Android: GLESv3, log, android
     - on Windows:
         - with Vulkan: link with vulkan-1 (this is explicit in case you want to
@@ -207,6 +216,11 @@
         Read the section 'UNIFORM DATA LAYOUT' to learn about the expected memory layout
         of the uniform data passed into sg_apply_uniforms().
 
+        ...or bind a range of a buffer object which already contains the
+        uniform data (see UNIFORM BUFFERS):
+
+            sg_apply_uniform_buffer(int ub_slot, sg_buffer buf, int offset)
+
     --- kick off a draw call with:
 
             sg_draw(int base_element, int num_elements, int num_instances)
@@ -238,6 +252,17 @@
             - on GLES3.x, base_vertex is only supported since GLES3.2
               (e.g. not supported on WebGL2)
 
+        To issue many draw calls with the same pipeline and bindings, call:
+
+            sg_draw_batch(const sg_draw_args* args, int count)
+
+        ...with an array of sg_draw_args structs (which have the same items
+        as the sg_draw_ex() arguments). This has the same result as calling
+        sg_draw_ex() for each item, but the sokol-gfx overhead (validation,
+        stats and trace hooks) only happens once per call. On desktop GL,
+        runs of non-instanced draws are issued with a single
+        glMultiDrawElementsBaseVertex() or glMultiDrawArrays() call.
+
     --- ...or kick of a dispatch call to invoke a compute shader workload:
 
             sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z)
@@ -245,6 +270,17 @@
         The dispatch args define the number of 'compute workgroups' processed
         by the currently applied compute shader.
 
+        ...or with the workgroup counts taken from a storage buffer which
+        has been written on the GPU (see COMPUTE SHADERS):
+
+            sg_dispatch_indirect(sg_buffer buf, int offset)
+
+    --- to count the samples which pass the depth test in a render pass
+        (see GPU COUNTERS):
+
+            sg_begin_counter(sg_counter ctr)
+            sg_end_counter(sg_counter ctr)
+
     --- finish the current pass with:
 
             sg_end_pass()
@@ -265,6 +301,7 @@
             sg_destroy_shader(sg_shader shd)
             sg_destroy_pipeline(sg_pipeline pip)
             sg_destroy_view(sg_view view)
+            sg_destroy_counter(sg_counter ctr)
 
     --- to set a new viewport rectangle, call:
 
@@ -386,6 +423,7 @@
             sg_shader_desc sq_query_shader_desc(sg_shader shd)
             sg_pipeline_desc sg_query_pipeline_desc(sg_pipeline pip)
             sg_view_desc sg_query_view_desc(sg_view view)
+            sg_counter_desc sg_query_counter_desc(sg_counter ctr)
 
         ...but NOTE that the returned desc structs may be incomplete, only
         creation attributes that are kept around internally after resource
@@ -406,6 +444,7 @@
             sg_shader_desc sg_query_shader_defaults(const sg_shader_desc* desc)
             sg_pipeline_desc sg_query_pipeline_defaults(const sg_pipeline_desc* desc)
             sg_view_desc sg_query_view_defaults(const sg_view_desc* desc)
+            sg_counter_desc sg_query_counter_defaults(const sg_counter_desc* desc)
 
         These functions take a pointer to a desc structure which may contain
         zero-initialized items for default values. These zero-init values
@@ -420,6 +459,7 @@
             sg_shader_info sg_query_shader_info(sg_shader shd)
             sg_pipeline_info sg_query_pipeline_info(sg_pipeline pip)
             sg_view_info sg_query_view_info(sg_view view)
+            sg_counter_info sg_query_counter_info(sg_counter ctr)
 
         ...please note that the returned info-structs are tied quite closely
         to sokol_gfx.h internals, and may change more often than other
@@ -434,10 +474,16 @@
     --- you can query stats and control stats collection via:
 
             sg_query_stats()
+            sg_query_stats_history()
             sg_enable_stats()
             sg_disable_stats()
             sg_stats_enabled()
 
+        sg_stats.prev_frame_passes contains per-pass counters and the CPU time
+        spent between sg_begin_pass() and sg_end_pass() for the first
+        SG_MAX_PASS_STATS passes of the previous frame, identified by
+        pass index and sg_pass.label.
+
     --- you can ask at runtime what backend sokol_gfx.h has been compiled for:
 
             sg_backend sg_query_backend(void)
@@ -887,6 +933,22 @@
 
         sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z)
 
+    When the number of workgroups is computed by an earlier compute pass
+    (for instance in a GPU-driven 'cull => compact => dispatch' pipeline),
+    call sg_dispatch_indirect() instead to read the workgroup counts from
+    a buffer without a round trip to the CPU:
+
+        sg_dispatch_indirect(sg_buffer buf, int offset)
+
+    The buffer must have been created with .usage.storage_buffer = true,
+    and at the byte offset (which must be a multiple of 4) it must contain
+    three uint32_t values with the number of workgroups in x, y and z
+    (same layout as VkDispatchIndirectCommand). Any barriers between the
+    compute pass which writes the buffer and the indirect dispatch are
+    inserted by sokol-gfx. Indirect dispatch is supported when
+    sg_features.dispatch_indirect is true (currently GL 4.3+ / GLES3.1,
+    Vulkan and the software backend).
+
     Also see the following compute-shader samples:
 
         - https://floooh.github.io/sokol-webgpu/instancing-compute-sapp.html
@@ -1327,6 +1389,74 @@
     to use the sokol-shdc shader cross-compiler tool!
 
 
+    UNIFORM BUFFERS
+    ===============
+    sg_apply_uniforms() copies the uniform data into a per-frame uniform buffer
+    managed by sokol-gfx. When the uniform data of many draw calls is already
+    known upfront (for instance per-object transforms which are written once
+    per frame, or material parameters which never change), the copy can
+    be avoided by keeping all uniform blocks in a buffer object created with
+    .usage.uniform_buffer = true, and binding a range of that buffer instead:
+
+        sg_apply_uniform_buffer(int ub_slot, sg_buffer buf, int offset)
+
+    The range starts at the byte offset and has the size of the uniform
+    block at ub_slot declared in sg_shader_desc.uniform_blocks[]. The uniform
+    data must be in the same layout as the data passed into sg_apply_uniforms(),
+    and the offset must be a multiple of sg_limits.uniform_buffer_offset_alignment
+    (for instance 256 bytes on most Vulkan desktop GPUs and on macOS), so uniform
+    blocks in the buffer must be padded to that alignment. Changing the offset
+    between draw calls is all that's needed to switch to another uniform block:
+
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&bnd);
+        for (int i = 0; i < num_objects; i++) {
+            sg_apply_uniform_buffer(UB_vs_params, ubuf, i * stride);
+            sg_draw(0, num_elements, 1);
+        }
+
+    sg_apply_uniforms() and sg_apply_uniform_buffer() can be mixed freely, the
+    last call for a ub_slot determines where the uniform data comes from.
+    A uniform buffer binding is only valid until the next sg_apply_pipeline(),
+    and as with vertex buffers, the buffer content must not be updated between
+    the first and last draw call which uses it in a frame.
+
+    On the GL backends, sg_apply_uniforms() writes uniforms with glUniform*()
+    calls into individual GLSL uniforms, which cannot be fed from a buffer.
+    Uniform blocks which are bound with sg_apply_uniform_buffer() must be
+    declared as real GLSL uniform blocks in std140 layout, and instead of the
+    glsl_uniforms[] member declarations, the GLSL block name must be provided
+    in sg_shader_uniform_block.glsl_block_name:
+
+        // GLSL
+        layout(std140) uniform vs_params_block {
+            mat4 mvp;
+        };
+
+        // C
+        .uniform_blocks[0] = {
+            .stage = SG_SHADERSTAGE_VERTEX,
+            .size = 64,
+            .layout = SG_UNIFORMLAYOUT_STD140,
+            .glsl_block_name = "vs_params_block",
+        },
+
+    sokol-gfx binds the block to the GL uniform buffer binding point ub_slot
+    (via glUniformBlockBinding()), and sg_apply_uniform_buffer() becomes a
+    glBindBufferRange(GL_UNIFORM_BUFFER, ub_slot, ...) call. Such uniform
+    blocks can only be bound with sg_apply_uniform_buffer(), and uniform
+    blocks with glsl_uniforms[] declarations only with sg_apply_uniforms().
+    The glsl_block_name is ignored by all other backends.
+
+    Restrictions:
+
+    - sg_features.uniform_buffer_bindings is currently true on Metal, Vulkan,
+      GL and the software backend (the D3D11 and WebGPU backends are not
+      implemented yet)
+    - on Vulkan, push-constant uniform blocks (sg_shader_uniform_block.spirv_push_constant)
+      cannot be bound from a buffer
+
+
     ON STORAGE BUFFERS
     ==================
     The two main purpose of storage buffers are:
@@ -1561,6 +1691,341 @@
     imgui/sokol_gfx_imgui.h header which implements a realtime
     debugging UI for sokol_gfx.h on top of Dear ImGui.
 
+    MULTIPLE CONTEXTS
+    =================
+    By default, all sokol-gfx state lives in a single global, so only one
+    sokol-gfx 'device' can exist per process. When the implementation is
+    compiled with SOKOL_MULTI_CONTEXT, additional independent contexts can be
+    created, for instance to run several headless render workers in the same
+    process, each on its own thread with its own GL context, VkDevice etc.
+
+    Each thread has a 'current context' which all sokol-gfx functions operate
+    on. Initially this is the default context, which is setup and shut down
+    with the regular sg_setup() and sg_shutdown() functions, so code which
+    doesn't know about contexts keeps working unchanged.
+
+    --- create a new context with the same sg_desc struct you'd pass to
+        sg_setup(). The current context of the calling thread doesn't change:
+
+            sg_context ctx = sg_make_context(&(sg_desc){ ... });
+
+        sg_make_context() returns an invalid handle (with id SG_INVALID_ID)
+        when all SG_MAX_CONTEXTS context slots are in use, or when the
+        backend setup for the new context fails (for instance because a
+        required Vulkan feature isn't supported), the reason is logged.
+
+    --- make the context current on the calling thread, all following
+        sokol-gfx calls on this thread will operate on that context:
+
+            sg_set_context(ctx);
+
+    --- query the calling thread's current context, or the default context:
+
+            sg_context cur_ctx = sg_get_context();
+            sg_context def_ctx = sg_default_context();
+
+    --- finally destroy the context, this is the same as calling sg_shutdown()
+        on the context. If the context is current on the calling thread, the
+        calling thread switches back to the default context:
+
+            sg_destroy_context(ctx);
+
+    A context (and resources created in a context) must not be used by
+    two threads at the same time, and it's the responsibility of the caller
+    to make the right 3D-API context current (e.g. the EGL context) before
+    calling sokol-gfx functions in a context.
+
+    Without SOKOL_MULTI_CONTEXT, the current context is a plain global
+    variable instead of a thread-local pointer, and sg_make_context()
+    always fails with a warning.
+
+    LOADER THREADS
+    ==============
+    Normally all sokol-gfx functions must be called from the same thread.
+    When the implementation is compiled with SOKOL_LOADER_THREADS, the
+    resource allocation and initialization functions may also be called
+    from other threads ('loader threads'), so that asset loading code
+    doesn't need to send each resource creation back to the render thread:
+
+        sg_alloc_buffer(), sg_alloc_image(), sg_alloc_sampler(),
+        sg_alloc_shader(), sg_alloc_pipeline(), sg_alloc_view()
+        sg_init_buffer(), sg_init_image(), sg_init_sampler(),
+        sg_init_shader(), sg_init_pipeline(), sg_init_view()
+        sg_make_buffer(), sg_make_image(), sg_make_sampler(),
+        sg_make_shader(), sg_make_pipeline(), sg_make_view()
+
+    The render thread is the thread which called sg_setup(), all other
+    sokol-gfx functions must still be called on the render thread. When
+    using multiple contexts, each context has its own render thread: for
+    a context created with sg_make_context() this is the first thread
+    which makes the context current with sg_set_context(), and it remains
+    the context's render thread until the context is destroyed. Any other
+    thread which makes the context current is a loader thread for that
+    context, so make the context current on its render thread before
+    starting loader threads for it.
+
+    Resources which are initialized on a loader thread remain in the ALLOC
+    state for the render thread until they are 'published' at the end of
+    the next sg_commit() call, only then does sg_query_*_state() return
+    SG_RESOURCESTATE_VALID (or SG_RESOURCESTATE_FAILED), and only then may
+    the resource be used for rendering. Until then, a resource which was
+    initialized on a loader thread may only be referenced by other resources
+    initialized on the same loader thread (for instance a texture view on
+    a new image, or a pipeline with a new shader). Such pending resources
+    must not be destroyed before they have been published.
+
+    Resource pool slots are allocated and freed under a spinlock, which is
+    the only extra cost on the render thread (apart from a thread check
+    in the frame-stats and trace-hook code paths).
+
+    Backend specifics:
+
+    - GL: the loader thread must have its own GL context which shares objects
+      with the render thread's GL context (creating and making current
+      that context is the responsibility of the application). GL state
+      caching is bypassed on loader threads, and each resource creation
+      is followed by a fence which the render thread waits for on the GPU
+      (via glWaitSync) when the resource is published. Since framebuffer
+      objects are not shared between GL contexts, resolve-attachment views
+      can't be created on loader threads.
+    - D3D11: resource creation on ID3D11Device is free-threaded.
+    - Metal: not supported (Metal objects are kept in an NSMutableArray which
+      the render thread reads without locking), resource creation on loader
+      threads fails
+    - Vulkan: initial content uploads use the shared staging ring and
+      queue, so they are serialized with sokol-gfx's own queue submissions
+      through a mutex. The mutex is released while an upload waits for
+      the GPU to free a staging ring segment. The uploads are submitted
+      when a staging ring segment is full or in the next sg_commit() on
+      the render thread. Presentation happens outside sokol-gfx and must not
+      overlap with loader threads uploading resource data on the same queue.
+    - WebGPU: not supported, resource creation on loader threads fails.
+    - Dummy and software backends: no restrictions.
+
+    Also note that the log and allocator callbacks (sg_desc.logger and
+    sg_desc.allocator) are called from loader threads and must be thread-safe,
+    and that loader threads don't record frame stats and don't call trace hooks.
+
+
+    PARALLEL SHADER COMPILATION
+    ===========================
+    Compiling shaders and pipelines can take a long time on some 3D backends
+    (especially on GL and Vulkan), which causes stutter when new shaders or
+    pipelines are created during the frame loop. When sg_desc.parallel_shader_compile
+    is true, and the backend supports it (check sg_features.parallel_shader_compile),
+    sg_make_shader() and sg_make_pipeline() return immediately and the
+    compilation happens in the background:
+
+    - the new shader or pipeline stays in the SG_RESOURCESTATE_ALLOC state
+      until the compilation has finished, sg_commit() checks for finished
+      compilations and switches the resource state to SG_RESOURCESTATE_VALID
+      or SG_RESOURCESTATE_FAILED
+    - a pipeline may be created with a shader that's still compiling, the
+      pipeline will start compiling after the shader has finished
+    - a pipeline that's still compiling may be applied with sg_apply_pipeline(),
+      but all following sg_apply_bindings(), sg_apply_uniforms(), draw- and
+      dispatch-calls are silently skipped until the next sg_apply_pipeline(),
+      the skipped draws and dispatches are counted in sg_frame_stats.num_skipped_draws
+    - a shader or pipeline may be destroyed while it's still compiling
+    - resources initialized on loader threads (see LOADER THREADS) are
+      always compiled synchronously
+
+    Backend specifics:
+
+    - GL: uses the GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile
+      extension, with the driver's default number of compiler threads, the
+      extension is typically supported by desktop GL drivers and Chrome's WebGL2
+      implementation. Pipelines are cheap to create in GL, but a pipeline on
+      a compiling shader stays in the ALLOC state until the shader has finished
+    - Vulkan: pipelines are created on a background thread (shader modules
+      are always created synchronously since this is cheap). Pipeline creation
+      errors are logged on that thread, so the logger callback must be thread-safe.
+      Destroying a shader waits until all pending pipelines have been created.
+    - D3D11, Metal, WebGPU and the software backend: not supported,
+      shaders and pipelines are always created synchronously
+    - Dummy backend: compilation is simulated and finishes in the next
+      sg_commit() (useful for testing)
+
+    ASYNC COMPUTE
+    =============
+    A compute pass can be flagged with sg_pass.async_compute to move its work
+    off the graphics queue, so that a long dispatch (for instance a particle
+    simulation or a culling pass) doesn't serialize with rendering:
+
+        sg_begin_pass(&(sg_pass){ .compute = true, .async_compute = true });
+        ...
+        sg_end_pass();
+
+    When sg_features.async_compute is false, async_compute is ignored and the
+    pass is an ordinary compute pass. Currently only the Vulkan backend supports
+    async compute: sg_environment.vulkan.compute_queue and .compute_queue_family_index
+    must describe a queue on a compute-capable queue family (sokol_app.h does
+    this when a dedicated compute queue family exists).
+
+    All async compute passes of a frame are recorded into one command buffer
+    which is submitted to the compute queue in sg_commit(). The graphics command
+    buffer is split at the pass boundaries following an async compute pass,
+    and only graphics command buffers which use a resource that's also used
+    by an async compute pass wait (via a timeline semaphore) for the compute
+    queue, graphics passes which don't touch those resources may overlap with
+    the compute work. The async compute work itself starts after all graphics
+    work of the previous frame and all buffer and image updates of the current
+    frame.
+
+    Restrictions:
+
+    - an async compute pass must not use resources which are written by
+      graphics or ordinary compute passes earlier in the same frame (there's
+      no dependency from those passes to the async compute work)
+    - when the compute queue is on a different queue family than the graphics
+      queue, all buffers and images are created with VK_SHARING_MODE_CONCURRENT,
+      which may be slightly slower on some GPUs
+
+    BINDLESS RESOURCES
+    ==================
+    Each sg_apply_bindings() call normally writes the descriptors of all
+    bound views and samplers into a per-frame descriptor buffer. On Vulkan
+    an opt-in bindless mode avoids this per-draw descriptor traffic: with
+    sg_desc.vulkan.bindless = true, sokol-gfx creates a global descriptor heap
+    which holds every live texture view, storage buffer view and sampler at
+    a stable index. The index is assigned when the view or sampler is created
+    and can be queried with:
+
+        int sg_query_view_bindless_index(sg_view view)
+        int sg_query_sampler_bindless_index(sg_sampler smp)
+
+    An index of 0 means that the object isn't accessible through the heap
+    (bindless mode isn't active, the view is an attachment or storage image
+    view, or the heap was exhausted), valid indices start at 1.
+
+    Shaders which access the heap must set sg_shader_desc.spirv_bindless
+    and declare the heap as unsized arrays at descriptor set 2:
+
+        layout(set=2, binding=0) uniform texture2D textures[];
+        layout(set=2, binding=0) uniform textureCube cube_textures[];
+        layout(set=2, binding=1) readonly buffer sbuf { ... } sbufs[];
+        layout(set=2, binding=2) uniform sampler samplers[];
+
+    ...and pass the indices in a push-constant uniform block (see
+    sg_shader_uniform_block.spirv_push_constant), so that switching a material
+    is a single sg_apply_uniforms() with a few integers. Bindless shaders
+    may still declare regular views and samplers in set 1, for instance for
+    storage images or writable storage buffers in compute shaders.
+
+    The heap is bound once per command buffer and to set 2 once per
+    sg_apply_pipeline() with a bindless shader, sg_apply_bindings() is only
+    needed for vertex and index buffers and regular view and sampler bindings.
+
+    When a view or sampler is destroyed, its heap index is only reused after
+    the GPU has finished all frames which may reference it. The heap has room
+    for twice the view and sampler pool sizes.
+
+    Restrictions:
+
+    - sg_features.bindless is only true on Vulkan, and only if the device
+      has been created with the Vulkan 1.2 descriptorBindingPartiallyBound and
+      runtimeDescriptorArray features enabled (signalled to sokol-gfx through
+      sg_environment.vulkan.descriptor_indexing, sokol_app.h enables the
+      features when supported and sets the flag), and allows at least two
+      bound descriptor buffers
+    - with SOKOL_LOADER_THREADS, views and samplers may be created on loader
+      threads, heap indices are allocated and written under the same lock
+      which serializes staging uploads
+    - resources accessed through the heap are not hazard-tracked, they must
+      be in their 'resting state': images rendered to in a render pass or
+      written in a compute pass, and storage buffers written in a compute
+      pass are ready for reading through the heap in later passes, but
+      must not be accessed through the heap in the pass which writes them
+    - storage image views are not added to the heap
+
+    GPU COUNTERS
+    ============
+    GPU counters are wrappers around backend query objects. An occlusion
+    counter counts the number of samples which pass the depth- and
+    stencil-test between sg_begin_counter() and sg_end_counter(), a
+    pipeline statistics counter counts shader invocations and primitives.
+    Counter objects are resources like buffers or images (with the
+    usual alloc/init/uninit/dealloc/fail functions and sg_query_counter_*()
+    getters) and are created and destroyed with:
+
+        sg_counter ctr = sg_make_counter(&(sg_counter_desc){
+            .type = SG_COUNTERTYPE_OCCLUSION,   // the default
+            .label = "occluder-bbox",
+        });
+        ...
+        sg_destroy_counter(ctr);
+
+    Inside a render pass, wrap the draw calls which should be counted:
+
+        sg_begin_pass(...);
+        ...
+        sg_begin_counter(ctr);
+        sg_draw(...);
+        sg_end_counter(ctr);
+        ...
+        sg_end_pass();
+
+    Only one counter per counter type can be active at a time, it must be
+    ended in the same pass, and each counter object can be used at most
+    once per frame (use one counter object per tested object and frame).
+
+    Counter results are never waited for, instead the most recent available
+    result is returned by:
+
+        sg_counter_value val = sg_query_counter_value(ctr);
+
+    The result becomes available one or more frames after the counter was
+    recorded (typically after SG_NUM_INFLIGHT_FRAMES frames). Until then
+    sg_counter_value.available is false, or the previous result is returned
+    (check sg_counter_value.frame_index for the frame the result was
+    recorded in). The sample count is in sg_counter_value.samples_passed.
+
+    Pipeline statistics counters are created with:
+
+        sg_counter ctr = sg_make_counter(&(sg_counter_desc){
+            .type = SG_COUNTERTYPE_PIPELINE_STATISTICS,
+        });
+
+    ...and can be used in render- and compute-passes, for instance to wrap
+    an entire pass. The counters are returned in sg_counter_value.pipeline_stats
+    (vertex-, fragment- and compute-shader invocations, and the number of
+    primitives going into and coming out of the clipping stage). When
+    a pipeline statistics counter is ended in a pass, its most recent
+    available result is also copied into the per-pass stats
+    (sg_stats.cur_frame_passes.passes[].pipeline_stats), so that with one
+    counter object per labelled pass the GPU counters can be inspected
+    next to the CPU-side counters in sg_query_stats(). Since the result
+    usually comes from an earlier frame, it is only copied if the counter
+    has been recorded in the same pass in that frame, and the frame index
+    of the result is in sg_pass_stats.pipeline_stats_frame_index.
+
+    Backend specifics:
+
+    - check sg_features.occlusion_counter whether occlusion counters are
+      supported, currently this is only true on GL, Vulkan, the software
+      backend and the dummy backend
+    - on GL, queries use GL_ANY_SAMPLES_PASSED, which means that
+      samples_passed is only 0 or 1 (e.g. 'anything visible or not')
+    - on GL, counters can't be created on loader threads because GL query
+      objects are not shared between GL contexts
+    - on Vulkan, the Vulkan 1.2 hostQueryReset feature must be enabled
+      on the device (sokol_app.h enables it when supported, with a custom
+      device set sg_environment.vulkan.host_query_reset to true)
+    - the dummy backend returns a sample count of 0
+    - check sg_features.pipeline_statistics_counter whether pipeline statistics
+      counters are supported, this is true on desktop GL 4.6 or with the
+      GL_ARB_pipeline_statistics_query extension, on Vulkan if the
+      pipelineStatisticsQuery device feature is enabled (sokol_app.h
+      enables it when supported, with a custom device set
+      sg_environment.vulkan.pipeline_statistics_query to true), and on
+      the software and dummy backends (the dummy
+      backend reports all counters as 0)
+    - on GL, the counters are read back as 32-bit values
+    - on Vulkan, pipeline statistics counters in async compute passes
+      are ignored
+    - on the software backend, compute_invocations counts compute function
+      calls (one per workgroup), and fragment_invocations doesn't include
+      fragments which failed the early depth test
 
     MEMORY ALLOCATION OVERRIDE
     ==========================
@@ -1744,6 +2209,7 @@
         sg_shader sg_alloc_shader(void)
         sg_pipeline sg_alloc_pipeline(void)
         sg_view sg_alloc_view(void)
+        sg_counter sg_alloc_counter(void)
 
     This will return a handle with the underlying resource object in the
     ALLOC state:
@@ -1769,6 +2235,7 @@
         void sg_init_shader(sg_shader shd, const sg_shader_desc* desc)
         void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc* desc)
         void sg_init_view(sg_view view, const sg_view_desc* desc)
+        void sg_init_counter(sg_counter ctr, const sg_counter_desc* desc)
 
     The init functions expect a resource in ALLOC state, and after the function
     returns, the resource will be either in VALID or FAILED state. Calling
@@ -1785,6 +2252,7 @@
         void sg_uninit_shader(sg_shader shd)
         void sg_uninit_pipeline(sg_pipeline pip)
         void sg_uninit_view(sg_view view)
+        void sg_uninit_counter(sg_counter ctr)
 
     Calling the 'uninit functions' with a resource that is not in the VALID or
     FAILED state is a no-op.
@@ -1797,6 +2265,7 @@
         void sg_dealloc_shader(sg_shader shd)
         void sg_dealloc_pipeline(sg_pipeline pip)
         void sg_dealloc_view(sg_view view)
+        void sg_dealloc_counter(sg_counter ctr)
 
     Calling the 'dealloc functions' on a resource that's not in ALLOC state is
     a no-op, but will generate a warning log message.
@@ -1810,6 +2279,7 @@
         void sg_destroy_shader(sg_shader shd)
         void sg_destroy_pipeline(sg_pipeline pip)
         void sg_destroy_view(sg_view view)
+        void sg_destroy_counter(sg_counter ctr)
 
     The 'destroy functions' can be called on resources in any state and generally
     do the right thing (for instance if the resource is in ALLOC state, the destroy
@@ -1824,6 +2294,7 @@
         sg_fail_shader(sg_shader shd)
         sg_fail_pipeline(sg_pipeline pip)
         sg_fail_view(sg_view view)
+        sg_fail_counter(sg_counter ctr)
 
     This is recommended if anything went wrong outside of sokol-gfx during asynchronous
     resource setup (for instance a file loading operation failed). In this case,
@@ -1933,6 +2404,97 @@
       enabled (since this would exclude all iOS devices)
 
 
+    SOFTWARE BACKEND
+    ================
+    The software backend (selected with SOKOL_SOFTWARE) is a CPU rasterizer
+    for environments without a GPU (for instance server-side thumbnail
+    rendering). Rendering happens into plain memory: offscreen render targets
+    are owned by sokol-gfx and can be copied into user memory with
+    sg_sw_read_image(), swapchain passes render directly into memory provided
+    by the caller in sg_swapchain.software.
+
+    How it works:
+
+    - in render passes, vertices are fetched and shaded on the calling thread
+      inside sg_draw(), the resulting primitives are clipped, set up and
+      binned into 64x64 pixel tiles
+    - the binned tiles are rasterized in sg_end_pass(), distributed over
+      a pool of worker threads (the number of worker threads can be
+      configured with sg_desc.software.num_threads, by default one thread
+      per CPU core is used), each tile is processed by exactly one thread
+      in submission order
+    - edge functions, depth and varyings are evaluated for 4 pixels at once
+      with SSE2 or NEON (with a scalar fallback for other CPUs)
+    - in compute passes, sg_dispatch() executes the compute function once per
+      workgroup, and also distributes the workgroups over the worker threads
+
+    Since the backend finishes all work in sg_end_pass(), pixel data is
+    available immediately after sg_end_pass() returns.
+
+    Shaders are regular C functions which are provided in the nested struct
+    sg_shader_desc.software (other shader code in sg_shader_desc is ignored):
+
+        static void vs(const sg_sw_shader_context* ctx, sg_sw_vertex* vtx) {
+            const vs_params_t* params = (const vs_params_t*) ctx->uniforms[0];
+            const float* pos = vtx->attrs[0];     // vertex attribute 0 as float4
+            mul_mat4_vec4(params->mvp, pos, vtx->pos);  // clip space position
+            vtx->varyings[0] = vtx->attrs[1][0];  // pass color to fragment function
+            vtx->varyings[1] = vtx->attrs[1][1];
+            vtx->varyings[2] = vtx->attrs[1][2];
+            vtx->varyings[3] = vtx->attrs[1][3];
+        }
+
+        static bool fs(const sg_sw_shader_context* ctx, sg_sw_fragment* frag) {
+            (void)ctx;
+            for (int i = 0; i < 4; i++) {
+                frag->colors[0][i] = frag->varyings[i];
+            }
+            return true;    // return false to discard the fragment
+        }
+
+        sg_shader shd = sg_make_shader(&(sg_shader_desc){
+            .software = {
+                .vertex_func = vs,
+                .fragment_func = fs,
+                .num_varyings = 4,
+            },
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_VERTEX, .size = sizeof(vs_params_t) },
+        });
+
+    Shader functions are called from multiple threads and must be thread-safe.
+    The fragment function may be zero for depth-only rendering.
+
+    Vertex attributes are converted to 4 floats (with missing components
+    filled with 0, 0, 0, 1), normalized formats are converted to the range
+    0..1 or -1..+1, integer formats are converted to float values. Clip space
+    follows the D3D, Metal and WebGPU conventions (z in the range 0..w,
+    framebuffer origin in the top-left corner), varyings are interpolated
+    perspective-correct.
+
+    Textures, samplers and storage images are accessed through helper functions
+    which take the view- and sampler-bindslots from sg_bindings:
+
+        sg_sw_sample(ctx, view_slot, sampler_slot, uvw, lod, out_rgba)
+        sg_sw_sample_compare(ctx, view_slot, sampler_slot, uvw, lod, ref)
+        sg_sw_image_load(ctx, view_slot, x, y, z, out_rgba)
+        sg_sw_image_store(ctx, view_slot, x, y, z, rgba)
+
+    Since fragments are shaded one at a time there are no screen space
+    derivatives, the mipmap level-of-detail must be provided explicitly.
+
+    Storage buffers are available as plain pointers in
+    sg_sw_shader_context.storage_buffers[view_slot].
+
+    Current restrictions of the software backend:
+
+    - MSAA render targets are accepted but rendered with a single sample,
+      resolving is a plain copy
+    - stencil state and alpha-to-coverage are ignored
+    - the pixel formats RG11B10F, RGB9E5 and all compressed formats
+      cannot be sampled or rendered to
+    - lines and points are always one pixel wide
+
+
     LICENSE
     =======
     zlib/libpng license
@@ -1989,6 +2551,7 @@ extern "C" {
     sg_shader:      vertex- and fragment-shaders and shader interface information
     sg_pipeline:    associated shader and vertex-layouts, and render states
     sg_view:        a resource view object used for bindings and render-pass attachments
+    sg_counter:     a GPU counter object (e.g. occlusion queries, see GPU COUNTERS)
 
     Instead of pointers, resource creation functions return a 32-bit
     handle which uniquely identifies the resource object.
@@ -2008,6 +2571,15 @@ typedef struct sg_sampler       { uint32_t id; } sg_sampler;
 typedef struct sg_shader        { uint32_t id; } sg_shader;
 typedef struct sg_pipeline      { uint32_t id; } sg_pipeline;
 typedef struct sg_view          { uint32_t id; } sg_view;
+typedef struct sg_counter         { uint32_t id; } sg_counter;
+
+/*
+    sg_context
+
+    A handle for an independent sokol-gfx context, see the section
+    MULTIPLE CONTEXTS for details.
+*/
+typedef struct sg_context       { uint32_t id; } sg_context;
 
 /*
     sg_range is a pointer-size-pair struct used to pass memory blobs into
@@ -2051,6 +2623,10 @@ enum {
     SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE = 16,
     SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE = 8,   // assuming sg_features.compute = true
     SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE = 4,    // assuming sg_features.compute = true
+    SG_SW_MAX_VARYINGS = 32,    // max number of float varyings in software backend shaders
+    SG_MAX_PASS_STATS = 32,     // max number of passes per frame recorded in sg_stats.prev_frame_passes
+    SG_MAX_CONTEXTS = 16,       // max number of contexts (including the default context)
+    SG_PASS_STATS_LABEL_SIZE = 32,
 };
 
 /*
@@ -2076,6 +2652,7 @@ typedef enum sg_backend {
     SG_BACKEND_WGPU,
     SG_BACKEND_VULKAN,
     SG_BACKEND_DUMMY,
+    SG_BACKEND_SOFTWARE,
 } sg_backend;
 
 /*
@@ -2236,6 +2813,14 @@ typedef struct sg_features {
     bool dual_source_blending;          // dual-source-blending supported
     bool vertexformat_int10_n2;         // SG_VERTEXFORMAT_INT10_N2 is supported
     bool gl_texture_views;              // supports 'proper' texture views (GL 4.3+)
+    bool gl_multi_bind;                 // supports GL 4.4 multi-bind functions (glBindTextures() etc.)
+    bool parallel_shader_compile;       // shaders and pipelines can be compiled in the background (see sg_desc.parallel_shader_compile)
+    bool async_compute;                 // compute passes with sg_pass.async_compute run on a separate queue (see ASYNC COMPUTE)
+    bool dispatch_indirect;             // sg_dispatch_indirect() is supported
+    bool bindless;                      // views and samplers can be accessed through a global descriptor heap (see BINDLESS RESOURCES)
+    bool occlusion_counter;             // sg_counter objects of type SG_COUNTERTYPE_OCCLUSION are supported (see GPU COUNTERS)
+    bool pipeline_statistics_counter;   // sg_counter objects of type SG_COUNTERTYPE_PIPELINE_STATISTICS are supported (see GPU COUNTERS)
+    bool uniform_buffer_bindings;       // sg_apply_uniform_buffer() is supported (see UNIFORM BUFFERS)
 } sg_features;
 
 /*
@@ -2254,6 +2839,7 @@ typedef struct sg_limits {
     int max_storage_image_bindings_per_stage;   // max number of storage image bindings per shader stage, clamped to SG_MAX_VIEW_BINDSLOTS
     int gl_max_vertex_uniform_components;       // GL_MAX_VERTEX_UNIFORM_COMPONENTS (only on GL backends)
     int gl_max_combined_texture_image_units;    // GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS (only on GL backends)
+    int uniform_buffer_offset_alignment;        // required alignment of the sg_apply_uniform_buffer() offset
     int d3d11_max_unordered_access_views;       // 8 on feature level 11.0, otherwise 32 (clamped to SG_MAX_VIEW_BINDSLOTS)
     int vk_min_uniform_buffer_offset_alignment;
 } sg_limits;
@@ -2915,6 +3501,12 @@ typedef struct sg_pass_action {
         - on all GL backends, a GL framebuffer object must be provided. This
           can be zero for the default framebuffer.
 
+    Software:
+        - a pointer to the pixel memory which is rendered into, with an
+          optional row pitch in bytes, the pixel format must be one of the
+          renderable color formats (usually RGBA8 or BGRA8), the depth
+          buffer is managed by sokol-gfx
+
     D3D11:
         - an ID3D11RenderTargetView for the rendering surface, without
           MSAA rendering this surface will also be displayed
@@ -2987,6 +3579,11 @@ typedef struct sg_gl_swapchain {
     uint32_t framebuffer;               // GL framebuffer object
 } sg_gl_swapchain;
 
+typedef struct sg_software_swapchain {
+    void* color_pixels;                 // pixel memory in sg_swapchain.color_format
+    int color_row_pitch;                // optional, default: width * bytes-per-pixel
+} sg_software_swapchain;
+
 typedef struct sg_swapchain {
     bool invalid;
     int width;
@@ -2999,6 +3596,7 @@ typedef struct sg_swapchain {
     sg_wgpu_swapchain wgpu;
     sg_vulkan_swapchain vulkan;
     sg_gl_swapchain gl;
+    sg_software_swapchain software;
 } sg_swapchain;
 
 /*
@@ -3071,6 +3669,7 @@ typedef struct sg_attachments {
 typedef struct sg_pass {
     uint32_t _start_canary;
     bool compute;
+    bool async_compute;     // compute passes only: run on a separate compute queue if sg_features.async_compute is true
     sg_pass_action action;
     sg_attachments attachments;
     sg_swapchain swapchain;
@@ -3174,6 +3773,20 @@ typedef struct sg_bindings {
     uint32_t _end_canary;
 } sg_bindings;
 
+/*
+    sg_draw_args
+
+    The arguments for one draw call in sg_draw_batch(), the items
+    have the same meaning as the arguments of sg_draw_ex().
+*/
+typedef struct sg_draw_args {
+    int base_element;
+    int num_elements;
+    int num_instances;
+    int base_vertex;
+    int base_instance;
+} sg_draw_args;
+
 /*
     sg_buffer_usage
 
@@ -3186,6 +3799,9 @@ typedef struct sg_bindings {
     .storage_buffer (default: false)
         the buffer will be bound as storage buffer via storage-buffer-view
         in sg_bindings.views[]
+    .uniform_buffer (default: false)
+        ranges of the buffer will be bound as uniform block via
+        sg_apply_uniform_buffer() (see UNIFORM BUFFERS)
     .immutable (default: true)
         the buffer content will never be updated from the CPU side (but
         may be written to by a compute shader)
@@ -3198,6 +3814,7 @@ typedef struct sg_buffer_usage {
     bool vertex_buffer;
     bool index_buffer;
     bool storage_buffer;
+    bool uniform_buffer;
     bool immutable;
     bool dynamic_update;
     bool stream_update;
@@ -3301,6 +3918,23 @@ typedef struct sg_buffer_desc {
         the image content is updated infrequently by the CPU via sg_update_image()
     .stream_update (default: false)
         the image content is updated each frame by the CPU via sg_update_image()
+    .transient_attachment (default: false)
+        a hint that the image content only needs to live for the duration
+        of a render pass (typically depth-stencil- and MSAA-color-buffers
+        which are never read after the pass). Transient images must be
+        immutable color- or depth-stencil-attachments, they cannot be
+        resolve attachments (since the resolved content must survive the
+        pass), and cannot be used as parent resource of texture- or
+        storage-image-views, and the content of a
+        transient attachment is undefined at the start of a render pass
+        unless it is cleared via SG_LOADACTION_CLEAR. On tiled GPUs this
+        allows the image to exist only in on-chip tile memory:
+            - Vulkan: VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT with lazily
+              allocated memory, and the store-op is forced to DONT_CARE
+            - Metal: MTLStorageModeMemoryless (where available)
+            - GL/GLES: the attachment is invalidated via glInvalidateFramebuffer()
+              at the end of a render pass (if supported)
+            - other backends ignore the hint
 
     Note that creating a texture view from the image to be used for
     texture-sampling in vertex-, fragment- or compute-shaders
@@ -3314,6 +3948,7 @@ typedef struct sg_image_usage {
     bool immutable;
     bool dynamic_update;
     bool stream_update;
+    bool transient_attachment;
 } sg_image_usage;
 
 /*
@@ -3531,6 +4166,14 @@ typedef struct sg_sampler_desc {
             - HLSL: the constant buffer register `register(b0..7)`
             - MSL: the buffer attribute `[[buffer(0..7)]]`
             - WGSL: the binding in `@group(0) @binding(0..15)`
+            - SPIRV: the binding in `layout(set=0, binding=0..15)`
+        - Vulkan only: an optional flag that the uniform block is declared
+          as `layout(push_constant)` block, in that case sg_apply_uniforms()
+          for that uniform block is recorded with vkCmdPushConstants()
+          instead of writing the data into the uniform buffer and binding
+          a uniform descriptor. At most one uniform block per shader can
+          be a push-constant block, and its size must be <= 128 bytes.
+          Other backends ignore the flag.
         - GLSL only: a description of the uniform block interior
             - the memory layout standard (SG_UNIFORMLAYOUT_*)
             - for each member in the uniform block:
@@ -3669,8 +4312,10 @@ typedef struct sg_shader_uniform_block {
     uint8_t msl_buffer_n;       // MSL [[buffer(n)]]
     uint8_t wgsl_group0_binding_n;  // WGSL @group(0) @binding(n)
     uint8_t spirv_set0_binding_n;   // Vulkan GLSL layout(set=0, binding=n)
+    bool spirv_push_constant;       // Vulkan GLSL layout(push_constant) instead of set=0 binding
     sg_uniform_layout layout;
     sg_glsl_shader_uniform glsl_uniforms[SG_MAX_UNIFORMBLOCK_MEMBERS];
+    const char* glsl_block_name;    // [optional] GLSL uniform block name, see UNIFORM BUFFERS
 } sg_shader_uniform_block;
 
 typedef struct sg_shader_texture_view {
@@ -3733,6 +4378,71 @@ typedef struct sg_mtl_shader_threads_per_threadgroup {
     int x, y, z;
 } sg_mtl_shader_threads_per_threadgroup;
 
+/*
+    Software backend shader interface (see the SOFTWARE BACKEND section
+    at the top of this file).
+
+    sg_sw_shader_context is passed into all software shader functions:
+
+        .uniforms[]         - pointers to the uniform data of the last
+                              sg_apply_uniforms() call (by ub_slot)
+        .storage_buffers[]  - pointers to storage buffer data (by view slot,
+                              with the view offset already applied)
+        .storage_buffer_sizes[] - size of storage buffer data in bytes
+        .user_data          - the sg_shader_desc.software.user_data pointer
+
+    sg_sw_vertex is the in/out struct of the vertex function, the vertex function
+    must write the clip space position to .pos and the varyings which are
+    passed into the fragment function to .varyings.
+
+    sg_sw_fragment is the in/out struct of the fragment function, .frag_coord
+    contains the pixel center window coordinates in xy, the depth value in z and
+    1/w in w, the fragment function writes the output colors into .colors[]
+    (by color attachment index) and returns false to discard the fragment.
+
+    sg_sw_workgroup is passed into the compute function, which is called once
+    per workgroup.
+*/
+typedef struct sg_sw_shader_context {
+    const void* uniforms[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    void* storage_buffers[SG_MAX_VIEW_BINDSLOTS];
+    int storage_buffer_sizes[SG_MAX_VIEW_BINDSLOTS];
+    void* user_data;
+    const void* _bindings;  // private, used by sg_sw_sample() and friends
+} sg_sw_shader_context;
+
+typedef struct sg_sw_vertex {
+    int vertex_index;
+    int instance_index;
+    float attrs[SG_MAX_VERTEX_ATTRIBUTES][4];   // in: vertex attributes
+    float pos[4];                               // out: clip space position
+    float varyings[SG_SW_MAX_VARYINGS];         // out: varyings
+} sg_sw_vertex;
+
+typedef struct sg_sw_fragment {
+    float frag_coord[4];                        // in: pixel center x, y, depth, 1/w
+    bool front_facing;                          // in: true if primitive is front facing
+    float varyings[SG_SW_MAX_VARYINGS];         // in: interpolated varyings
+    float colors[SG_MAX_COLOR_ATTACHMENTS][4];  // out: colors by color attachment index
+} sg_sw_fragment;
+
+typedef struct sg_sw_workgroup {
+    int id[3];              // workgroup id in x, y, z
+    int num[3];             // number of workgroups in x, y, z
+} sg_sw_workgroup;
+
+typedef void (*sg_sw_vertex_func)(const sg_sw_shader_context* ctx, sg_sw_vertex* vtx);
+typedef bool (*sg_sw_fragment_func)(const sg_sw_shader_context* ctx, sg_sw_fragment* frag);
+typedef void (*sg_sw_compute_func)(const sg_sw_shader_context* ctx, const sg_sw_workgroup* wg);
+
+typedef struct sg_software_shader {
+    sg_sw_vertex_func vertex_func;
+    sg_sw_fragment_func fragment_func;      // optional for depth-only rendering
+    sg_sw_compute_func compute_func;
+    int num_varyings;                       // number of floats in sg_sw_vertex.varyings written by the vertex function
+    void* user_data;                        // passed into shader functions as sg_sw_shader_context.user_data
+} sg_software_shader;
+
 typedef struct sg_shader_desc {
     uint32_t _start_canary;
     sg_shader_function vertex_func;
@@ -3744,6 +4454,8 @@ typedef struct sg_shader_desc {
     sg_shader_sampler samplers[SG_MAX_SAMPLER_BINDSLOTS];
     sg_shader_texture_sampler_pair texture_sampler_pairs[SG_MAX_TEXTURE_SAMPLER_PAIRS];
     sg_mtl_shader_threads_per_threadgroup mtl_threads_per_threadgroup;
+    bool spirv_bindless;    // Vulkan: the shader accesses the bindless descriptor heap at set=2 (see BINDLESS RESOURCES)
+    sg_software_shader software;
     const char* label;
     uint32_t _end_canary;
 } sg_shader_desc;
@@ -3996,6 +4708,94 @@ typedef struct sg_view_desc {
     uint32_t _end_canary;
 } sg_view_desc;
 
+/*
+    sg_counter_type
+
+    The type of a GPU counter object, passed in sg_counter_desc.type:
+
+    SG_COUNTERTYPE_OCCLUSION:   counts the samples which passed the depth- and
+                                stencil-test between sg_begin_counter() and
+                                sg_end_counter() (see GPU COUNTERS)
+    SG_COUNTERTYPE_PIPELINE_STATISTICS:
+                                counts shader invocations and primitives
+                                between sg_begin_counter() and sg_end_counter(),
+                                for instance to find expensive passes or
+                                overdraw (see GPU COUNTERS)
+
+    The default counter type is SG_COUNTERTYPE_OCCLUSION.
+*/
+typedef enum sg_counter_type {
+    _SG_COUNTERTYPE_DEFAULT,
+    SG_COUNTERTYPE_OCCLUSION,
+    SG_COUNTERTYPE_PIPELINE_STATISTICS,
+    _SG_COUNTERTYPE_NUM,
+    _SG_COUNTERTYPE_FORCE_U32 = 0x7FFFFFFF
+} sg_counter_type;
+
+/*
+    sg_counter_desc
+
+    Creation parameters for sg_counter objects, passed into sg_make_counter():
+
+    .type       the counter type (default: SG_COUNTERTYPE_OCCLUSION)
+    .label      optional debug label
+*/
+typedef struct sg_counter_desc {
+    uint32_t _start_canary;
+    sg_counter_type type;
+    const char* label;
+    uint32_t _end_canary;
+} sg_counter_desc;
+
+/*
+    sg_pipeline_stats
+
+    The counters of a SG_COUNTERTYPE_PIPELINE_STATISTICS counter object, part
+    of sg_counter_value and sg_pass_stats:
+
+    .vertex_invocations         number of vertex shader invocations
+    .fragment_invocations       number of fragment shader invocations
+    .compute_invocations        number of compute shader invocations (on the
+                                software backend: compute function invocations,
+                                which is one per workgroup)
+    .clipping_input_primitives  number of primitives which entered the clipping stage
+    .clipping_output_primitives number of primitives which left the clipping stage
+
+    Note that the exact numbers are implementation-specific (for instance
+    vertex shader invocations are affected by the post-transform vertex cache),
+    the counters are meant for relative comparisons.
+*/
+typedef struct sg_pipeline_stats {
+    uint64_t vertex_invocations;
+    uint64_t fragment_invocations;
+    uint64_t compute_invocations;
+    uint64_t clipping_input_primitives;
+    uint64_t clipping_output_primitives;
+} sg_pipeline_stats;
+
+/*
+    sg_counter_value
+
+    The result of a GPU counter object, returned by sg_query_counter_value():
+
+    .available          true if a result is available, this is usually the case
+                        one or more frames after the counter has been recorded,
+                        if false, the other items are zero-initialized
+    .frame_index        the frame counter (see sg_frame_stats.frame_index) of the frame
+                        in which the result was recorded
+    .samples_passed     SG_COUNTERTYPE_OCCLUSION: the number of samples which passed
+                        the depth- and stencil-test, note that some backends only
+                        report zero or non-zero (e.g. GL_ANY_SAMPLES_PASSED)
+    .pipeline_stats     SG_COUNTERTYPE_PIPELINE_STATISTICS: the shader invocation
+                        and primitive counters
+*/
+typedef struct sg_counter_value {
+    bool available;
+    uint32_t frame_index;
+    uint64_t samples_passed;
+    sg_pipeline_stats pipeline_stats;
+} sg_counter_value;
+
 /*
     sg_trace_hooks
 
@@ -4032,9 +4832,12 @@ typedef struct sg_trace_hooks {
     void (*apply_pipeline)(sg_pipeline pip, void* user_data);
     void (*apply_bindings)(const sg_bindings* bindings, void* user_data);
     void (*apply_uniforms)(int ub_index, const sg_range* data, void* user_data);
+    void (*apply_uniform_buffer)(int ub_index, sg_buffer buf, int offset, void* user_data);
     void (*draw)(int base_element, int num_elements, int num_instances, void* user_data);
     void (*draw_ex)(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance, void* user_data);
+    void (*draw_batch)(const sg_draw_args* args, int count, void* user_data);
     void (*dispatch)(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data);
+    void (*dispatch_indirect)(sg_buffer buf, int offset, void* user_data);
     void (*end_pass)(void* user_data);
     void (*commit)(void* user_data);
     void (*alloc_buffer)(sg_buffer result, void* user_data);
@@ -4069,6 +4872,15 @@ typedef struct sg_trace_hooks {
     void (*fail_view)(sg_view view_id, void* user_data);
     void (*push_debug_group)(const char* name, void* user_data);
     void (*pop_debug_group)(void* user_data);
+    void (*make_counter)(const sg_counter_desc* desc, sg_counter result, void* user_data);
+    void (*destroy_counter)(sg_counter ctr, void* user_data);
+    void (*begin_counter)(sg_counter ctr, void* user_data);
+    void (*end_counter)(sg_counter ctr, void* user_data);
+    void (*alloc_counter)(sg_counter result, void* user_data);
+    void (*dealloc_counter)(sg_counter ctr_id, void* user_data);
+    void (*init_counter)(sg_counter ctr_id, const sg_counter_desc* desc, void* user_data);
+    void (*uninit_counter)(sg_counter ctr_id, void* user_data);
+    void (*fail_counter)(sg_counter ctr_id, void* user_data);
 } sg_trace_hooks;
 
 /*
@@ -4078,6 +4890,7 @@ typedef struct sg_trace_hooks {
     sg_shader_info
     sg_pipeline_info
     sg_view_info
+    sg_counter_info
 
     These structs contain various internal resource attributes which
     might be useful for debug-inspection. Please don't rely on the
@@ -4093,6 +4906,7 @@ typedef struct sg_trace_hooks {
     sg_query_shader_info()
     sg_query_pipeline_info()
     sg_query_view_info()
+    sg_query_counter_info()
 */
 typedef struct sg_slot_info {
     sg_resource_state state;    // the current state of this resource slot
@@ -4133,11 +4947,19 @@ typedef struct sg_view_info {
     sg_slot_info slot;              // resource pool slot info
 } sg_view_info;
 
+typedef struct sg_counter_info {
+    sg_slot_info slot;              // resource pool slot info
+} sg_counter_info;
+
 /*
     sg_stats
 
     Allows to track generic and backend-specific rendering stats,
     obtained via sg_query_stats().
+
+    NOTE: sg_frame_stats and all its nested structs must only contain
+    uint32_t items, since sg_query_stats_history() treats the struct
+    as an array of counters.
 */
 typedef struct sg_frame_stats_gl {
     uint32_t num_bind_buffer;
@@ -4153,6 +4975,19 @@ typedef struct sg_frame_stats_gl {
     uint32_t num_disable_vertex_attrib_array;
     uint32_t num_uniform;
     uint32_t num_memory_barriers;
+    uint32_t num_bind_vertex_array;
+    uint32_t num_vao_cache_hits;
+    uint32_t num_vao_cache_misses;
+    uint32_t num_vao_cache_evictions;
+    uint32_t num_vao_cache_invalidates;
+    uint32_t num_bind_textures;
+    uint32_t num_bind_samplers;
+    uint32_t num_bind_buffers_range;
+    uint32_t num_fence_waits;
+    uint32_t fence_wait_time_us;
+    uint32_t num_multi_draw;
+    uint32_t num_pbo_uploads;
+    uint32_t upload_time_us;
 } sg_frame_stats_gl;
 
 typedef struct sg_frame_stats_d3d11_pass {
@@ -4299,8 +5134,27 @@ typedef struct sg_frame_stats_vk {
     uint32_t num_cmd_copy_buffer_to_image;
     uint32_t num_cmd_set_descriptor_buffer_offsets;
     uint32_t size_descriptor_buffer_writes;
+    uint32_t num_cmd_push_constants;
+    uint32_t size_push_constants;
+    uint32_t num_staging_copy_submits;      // submitted copy-staging ring segments
+    uint32_t num_staging_copy_waits;        // CPU waits for an in-flight ring segment
+    uint32_t size_staging_copy;             // bytes uploaded through the copy-staging ring
+    uint32_t staging_copy_time_us;          // CPU time spent in copy-staging uploads
+    uint32_t staging_copy_mbytes_per_sec;   // size_staging_copy / staging_copy_time_us
+    uint32_t num_async_compute_passes;      // compute passes recorded for the async compute queue
+    uint32_t num_cmd_buffer_segments;       // graphics command buffers submitted in the frame
+    uint32_t num_async_compute_waits;       // graphics command buffers waiting for async compute
 } sg_frame_stats_vk;
 
+typedef struct sg_frame_stats_sw {
+    uint32_t num_vertices;      // number of vertex function invocations
+    uint32_t num_primitives;    // number of primitives which survived clipping and culling
+    uint32_t num_binned;        // number of primitives added to tile bins
+    uint32_t num_fragments;     // number of fragment function invocations
+    uint32_t num_flushes;       // number of times the tile bins were rasterized
+    uint32_t num_workgroups;    // number of compute function invocations
+} sg_frame_stats_sw;
+
 typedef struct sg_frame_resource_stats {
     uint32_t allocated;     // number of allocated objects in current frame
     uint32_t deallocated;   // number of deallocated object in current frame
@@ -4324,10 +5178,12 @@ typedef struct sg_total_stats {
     sg_total_resource_stats views;
     sg_total_resource_stats shaders;
     sg_total_resource_stats pipelines;
+    sg_total_resource_stats counters;
 } sg_total_stats;
 
 typedef struct sg_frame_stats {
     uint32_t frame_index;   // current frame counter, starts at 0
+    uint32_t frame_time_us; // CPU time between the previous and this frame's sg_commit() in microseconds
 
     uint32_t num_passes;
     uint32_t num_apply_viewport;
@@ -4335,9 +5191,14 @@ typedef struct sg_frame_stats {
     uint32_t num_apply_pipeline;
     uint32_t num_apply_bindings;
     uint32_t num_apply_uniforms;
+    uint32_t num_apply_uniform_buffer;
     uint32_t num_draw;
     uint32_t num_draw_ex;
+    uint32_t num_draw_batch;        // number of sg_draw_batch() calls
+    uint32_t num_draw_batch_items;  // number of draws issued through sg_draw_batch()
     uint32_t num_dispatch;
+    uint32_t num_dispatch_indirect;
+    uint32_t num_skipped_draws;     // draws and dispatches skipped because the pipeline was still compiling
     uint32_t num_update_buffer;
     uint32_t num_append_buffer;
     uint32_t num_update_image;
@@ -4353,20 +5214,86 @@ typedef struct sg_frame_stats {
     sg_frame_resource_stats views;
     sg_frame_resource_stats shaders;
     sg_frame_resource_stats pipelines;
+    sg_frame_resource_stats counters;
 
     sg_frame_stats_gl gl;
     sg_frame_stats_d3d11 d3d11;
     sg_frame_stats_metal metal;
     sg_frame_stats_wgpu wgpu;
     sg_frame_stats_vk vk;
+    sg_frame_stats_sw sw;
 } sg_frame_stats;
 
+/*
+    sg_pass_stats
+
+    Per-pass counters, recorded between sg_begin_pass() and sg_end_pass()
+    for the first SG_MAX_PASS_STATS passes of a frame. The label is a
+    (truncated) copy of sg_pass.label.
+
+    The pipeline_stats item contains the most recent available result of
+    a SG_COUNTERTYPE_PIPELINE_STATISTICS counter which has been ended in the
+    pass. Since GPU counter results arrive with latency, these values
+    have usually been recorded in an earlier frame, the frame index is in
+    pipeline_stats_frame_index. The result is only attached if the counter
+    object has been recorded in the same pass in that frame (passes are
+    matched by label, or by pass index if the pass has no label), otherwise
+    pipeline_stats and pipeline_stats_frame_index are zero.
+*/
+typedef struct sg_pass_stats {
+    char label[SG_PASS_STATS_LABEL_SIZE];
+    uint32_t pass_index;    // index of the pass in the frame
+    uint32_t cpu_time_us;   // CPU time between sg_begin_pass() and sg_end_pass() in microseconds
+    uint32_t num_apply_viewport;
+    uint32_t num_apply_scissor_rect;
+    uint32_t num_apply_pipeline;
+    uint32_t num_apply_bindings;
+    uint32_t num_apply_uniforms;
+    uint32_t num_apply_uniform_buffer;
+    uint32_t num_draw;
+    uint32_t num_draw_ex;
+    uint32_t num_draw_batch;
+    uint32_t num_draw_batch_items;
+    uint32_t num_dispatch;
+    uint32_t num_dispatch_indirect;
+    uint32_t size_apply_uniforms;
+    sg_pipeline_stats pipeline_stats;
+    uint32_t pipeline_stats_frame_index;    // frame index in which pipeline_stats was recorded
+} sg_pass_stats;
+
+typedef struct sg_frame_pass_stats {
+    int num_passes;     // number of valid items in passes[]
+    sg_pass_stats passes[SG_MAX_PASS_STATS];
+} sg_frame_pass_stats;
+
 typedef struct sg_stats {
     sg_frame_stats prev_frame;
     sg_frame_stats cur_frame;
     sg_total_stats total;
+    sg_frame_pass_stats prev_frame_passes;
+    sg_frame_pass_stats cur_frame_passes;
 } sg_stats;
 
+/*
+    sg_stats_history
+
+    Per-counter statistics over the last sg_desc.stats_history_size
+    frames, obtained via sg_query_stats_history(). Each item is an
+    sg_frame_stats struct where every counter holds the minimum, maximum,
+    average or percentile of that counter over the recorded frames.
+    The percentiles use the nearest-rank method. The frame_index item
+    is an identifier and not a counter, it is always zero in the history.
+*/
+typedef struct sg_stats_history {
+    int num_frames;         // number of recorded frames (0 if the history is disabled)
+    sg_frame_stats min;
+    sg_frame_stats max;
+    sg_frame_stats avg;
+    sg_frame_stats p50;
+    sg_frame_stats p95;
+    sg_frame_stats p99;
+} sg_stats_history;
+
 /*
     sg_log_item
 
@@ -4393,6 +5320,8 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_UNSUPPORTED, "framebuffer completeness check failed with GL_FRAMEBUFFER_UNSUPPORTED (gl)") \
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_INCOMPLETE_MULTISAMPLE, "framebuffer completeness check failed with GL_FRAMEBUFFER_INCOMPLETE_MULTISAMPLE (gl)") \
     _SG_LOGITEM_XMACRO(GL_FRAMEBUFFER_STATUS_UNKNOWN, "framebuffer completeness check failed (unknown reason) (gl)") \
+    _SG_LOGITEM_XMACRO(GL_MAP_PERSISTENT_BUFFER_FAILED, "failed to persistently map stream buffer (gl)") \
+    _SG_LOGITEM_XMACRO(GL_VAOCACHE_SIZE_GREATER_ZERO, "sg_desc.gl.vao_cache_size must be > 0 (gl)") \
     _SG_LOGITEM_XMACRO(D3D11_FEATURE_LEVEL_0_DETECTED, "D3D11 Feature Level 0 device detected, this restricts the number of UAV slots to 8! (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_FAILED, "CreateBuffer() failed (d3d11)") \
     _SG_LOGITEM_XMACRO(D3D11_CREATE_BUFFER_SRV_FAILED, "CreateShaderResourceView() failed for storage buffer (d3d11)") \
@@ -4472,7 +5401,10 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VULKAN_STAGING_CREATE_BUFFER_FAILED, "vulkan: vkCreateBuffer() failed for staging buffer") \
     _SG_LOGITEM_XMACRO(VULKAN_STAGING_ALLOCATE_MEMORY_FAILED, "vulkan: allocating device memory for staging buffer failed") \
     _SG_LOGITEM_XMACRO(VULKAN_STAGING_BIND_BUFFER_MEMORY_FAILED, "vulkan: vkBindBufferMemory() failed for staging buffer") \
+    _SG_LOGITEM_XMACRO(VULKAN_STAGING_MAP_MEMORY_FAILED, "vulkan: vkMapMemory() failed for staging buffer") \
     _SG_LOGITEM_XMACRO(VULKAN_STAGING_STREAM_BUFFER_OVERFLOW, "vulkan: per-frame stream staging buffer has overflown (sg_desc.vulkan.stream_staging_buffer_size)") \
+    _SG_LOGITEM_XMACRO(VULKAN_TIMELINE_SEMAPHORE_NOT_SUPPORTED, "vulkan: the Vulkan 1.2 timelineSemaphore feature isn't enabled on the device (sg_environment.vulkan.timeline_semaphore)") \
+    _SG_LOGITEM_XMACRO(VULKAN_CREATE_TIMELINE_SEMAPHORE_FAILED, "vulkan: vkCreateSemaphore() failed for timeline semaphore") \
     _SG_LOGITEM_XMACRO(VULKAN_CREATE_SHARED_BUFFER_FAILED, "vulkan: vkCreateBuffer() failed for cpu/gpu-shared buffer") \
     _SG_LOGITEM_XMACRO(VULKAN_ALLOCATE_SHARED_BUFFER_MEMORY_FAILED, "vulkan: allocating device memory for cpu/gpu-shared buffer failed") \
     _SG_LOGITEM_XMACRO(VULKAN_BIND_SHARED_BUFFER_MEMORY_FAILED, "vulkan: vkBindBufferMemory() failed for cpu/gpu-shared buffer") \
@@ -4495,43 +5427,66 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VULKAN_CREATE_IMAGE_VIEW_FAILED, "vulkan: vkCreateImageView() failed!") \
     _SG_LOGITEM_XMACRO(VULKAN_VIEW_MAX_DESCRIPTOR_SIZE, "vulkan: required view descriptor size is greater than _SG_VK_MAX_DESCRIPTOR_DATA_SIZE") \
     _SG_LOGITEM_XMACRO(VULKAN_CREATE_SAMPLER_FAILED, "vulkan: vkCreateSampler() failed!") \
+    _SG_LOGITEM_XMACRO(VULKAN_CREATE_QUERY_POOL_FAILED, "vulkan: vkCreateQueryPool() failed!") \
     _SG_LOGITEM_XMACRO(VULKAN_SAMPLER_MAX_DESCRIPTOR_SIZE, "vulkan: required sampler descriptor size is greater than _SG_VK_MAX_DESCRIPTOR_DATA_SIZE") \
-    _SG_LOGITEM_XMACRO(VULKAN_WAIT_FOR_FENCE_FAILED, "vulkan: vkWaitForFence() failed!") \
+    _SG_LOGITEM_XMACRO(VULKAN_WAIT_SEMAPHORES_FAILED, "vulkan: vkWaitSemaphores() failed!") \
     _SG_LOGITEM_XMACRO(VULKAN_UNIFORM_BUFFER_OVERFLOW, "vulkan: uniform buffer has overflown (increase sg_desc.uniform_buffer_size)") \
+    _SG_LOGITEM_XMACRO(VULKAN_UNIFORM_BUFFER_ACCESS, "vulkan: sg_apply_uniform_buffer(): buffer is not readable as uniform buffer in this render pass (draw call skipped)") \
     _SG_LOGITEM_XMACRO(VULKAN_DESCRIPTOR_BUFFER_OVERFLOW, "vulkan: desccriptor buffer has overflown (increase sg_desc.vulkan.descriptor_buffer_size)") \
+    _SG_LOGITEM_XMACRO(VULKAN_CREATE_COMPILER_THREAD_FAILED, "vulkan: failed to create pipeline compiler thread (pipelines will be created synchronously)") \
+    _SG_LOGITEM_XMACRO(VULKAN_BINDLESS_NOT_SUPPORTED, "vulkan: sg_desc.vulkan.bindless requires the descriptorBindingPartiallyBound and runtimeDescriptorArray device features (sg_environment.vulkan.descriptor_indexing) and two descriptor buffer bindings (bindless heap disabled)") \
+    _SG_LOGITEM_XMACRO(VULKAN_CREATE_BINDLESS_HEAP_FAILED, "vulkan: failed to create the bindless descriptor heap (bindless heap disabled)") \
+    _SG_LOGITEM_XMACRO(VULKAN_BINDLESS_HEAP_EXHAUSTED, "vulkan: bindless descriptor heap exhausted, view or sampler will not be accessible through the heap (too many objects created per frame)") \
+    _SG_LOGITEM_XMACRO(SOFTWARE_CREATE_THREAD_FAILED, "software: failed to create rasterizer thread (continuing with fewer threads)") \
+    _SG_LOGITEM_XMACRO(SOFTWARE_UNSUPPORTED_PIXELFORMAT, "software: pixel format not supported by the software backend") \
+    _SG_LOGITEM_XMACRO(SOFTWARE_READ_IMAGE_INVALID, "sg_sw_read_image(): invalid image handle, mip level or slice") \
+    _SG_LOGITEM_XMACRO(SOFTWARE_DISPATCH_INDIRECT_NUMGROUPS, "software: sg_dispatch_indirect() workgroup counts must be < 65536 (dispatch skipped)") \
+    _SG_LOGITEM_XMACRO(SOFTWARE_READ_IMAGE_BUFFER_TOO_SMALL, "sg_sw_read_image(): destination buffer too small") \
     _SG_LOGITEM_XMACRO(IDENTICAL_COMMIT_LISTENER, "attempting to add identical commit listener") \
     _SG_LOGITEM_XMACRO(COMMIT_LISTENER_ARRAY_FULL, "commit listener array full") \
     _SG_LOGITEM_XMACRO(TRACE_HOOKS_NOT_ENABLED, "sg_install_trace_hooks() called, but SOKOL_TRACE_HOOKS is not defined") \
+    _SG_LOGITEM_XMACRO(TIME_NOT_MONOTONIC, "CLOCK_MONOTONIC is not available, frame and upload timings use a non-monotonic fallback clock") \
+    _SG_LOGITEM_XMACRO(MULTI_CONTEXT_NOT_ENABLED, "sg_make_context() called, but SOKOL_MULTI_CONTEXT is not defined") \
+    _SG_LOGITEM_XMACRO(CONTEXT_POOL_EXHAUSTED, "sg_make_context(): all context slots are in use (SG_MAX_CONTEXTS)") \
+    _SG_LOGITEM_XMACRO(LOADER_THREADS_NOT_SUPPORTED, "resource creation on loader threads is not supported by this backend") \
+    _SG_LOGITEM_XMACRO(GL_LOADER_THREAD_RESOLVE_VIEW, "resolve attachment views can't be created on loader threads (GL framebuffers are not shared between GL contexts)") \
+    _SG_LOGITEM_XMACRO(GL_LOADER_THREAD_COUNTER, "counters can't be created on loader threads (GL query objects are not shared between GL contexts)") \
     _SG_LOGITEM_XMACRO(DEALLOC_BUFFER_INVALID_STATE, "sg_dealloc_buffer(): buffer must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(DEALLOC_IMAGE_INVALID_STATE, "sg_dealloc_image(): image must be in alloc state") \
     _SG_LOGITEM_XMACRO(DEALLOC_SAMPLER_INVALID_STATE, "sg_dealloc_sampler(): sampler must be in alloc state") \
     _SG_LOGITEM_XMACRO(DEALLOC_SHADER_INVALID_STATE, "sg_dealloc_shader(): shader must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(DEALLOC_PIPELINE_INVALID_STATE, "sg_dealloc_pipeline(): pipeline must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(DEALLOC_VIEW_INVALID_STATE, "sg_dealloc_view(): view must be in ALLOC state") \
+    _SG_LOGITEM_XMACRO(DEALLOC_COUNTER_INVALID_STATE, "sg_dealloc_counter(): counter must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(INIT_BUFFER_INVALID_STATE, "sg_init_buffer(): buffer must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(INIT_IMAGE_INVALID_STATE, "sg_init_image(): image must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(INIT_SAMPLER_INVALID_STATE, "sg_init_sampler(): sampler must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(INIT_SHADER_INVALID_STATE, "sg_init_shader(): shader must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(INIT_PIPELINE_INVALID_STATE, "sg_init_pipeline(): pipeline must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(INIT_VIEW_INVALID_STATE, "sg_init_view(): view must be in ALLOC state") \
+    _SG_LOGITEM_XMACRO(INIT_COUNTER_INVALID_STATE, "sg_init_counter(): counter must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(UNINIT_BUFFER_INVALID_STATE, "sg_uninit_buffer(): buffer must be in VALID, FAILED or ALLOC state") \
     _SG_LOGITEM_XMACRO(UNINIT_IMAGE_INVALID_STATE, "sg_uninit_image(): image must be in VALID, FAILED or ALLOC state") \
     _SG_LOGITEM_XMACRO(UNINIT_SAMPLER_INVALID_STATE, "sg_uninit_sampler(): sampler must be in VALID, FAILED or ALLOC state") \
     _SG_LOGITEM_XMACRO(UNINIT_SHADER_INVALID_STATE, "sg_uninit_shader(): shader must be in VALID, FAILED or ALLOC state") \
     _SG_LOGITEM_XMACRO(UNINIT_PIPELINE_INVALID_STATE, "sg_uninit_pipeline(): pipeline must be in VALID, FAILED or ALLOC state") \
     _SG_LOGITEM_XMACRO(UNINIT_VIEW_INVALID_STATE, "sg_uninit_view(): view must be in VALID, FAILED or ALLOC state") \
+    _SG_LOGITEM_XMACRO(UNINIT_COUNTER_INVALID_STATE, "sg_uninit_counter(): counter must be in VALID, FAILED or ALLOC state") \
     _SG_LOGITEM_XMACRO(FAIL_BUFFER_INVALID_STATE, "sg_fail_buffer(): buffer must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(FAIL_IMAGE_INVALID_STATE, "sg_fail_image(): image must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(FAIL_SAMPLER_INVALID_STATE, "sg_fail_sampler(): sampler must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(FAIL_SHADER_INVALID_STATE, "sg_fail_shader(): shader must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(FAIL_PIPELINE_INVALID_STATE, "sg_fail_pipeline(): pipeline must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(FAIL_VIEW_INVALID_STATE, "sg_fail_view(): view must be in ALLOC state") \
+    _SG_LOGITEM_XMACRO(FAIL_COUNTER_INVALID_STATE, "sg_fail_counter(): counter must be in ALLOC state") \
     _SG_LOGITEM_XMACRO(BUFFER_POOL_EXHAUSTED, "buffer pool exhausted") \
     _SG_LOGITEM_XMACRO(IMAGE_POOL_EXHAUSTED, "image pool exhausted") \
     _SG_LOGITEM_XMACRO(SAMPLER_POOL_EXHAUSTED, "sampler pool exhausted") \
     _SG_LOGITEM_XMACRO(SHADER_POOL_EXHAUSTED, "shader pool exhausted") \
     _SG_LOGITEM_XMACRO(PIPELINE_POOL_EXHAUSTED, "pipeline pool exhausted") \
     _SG_LOGITEM_XMACRO(VIEW_POOL_EXHAUSTED, "view pool exhausted") \
+    _SG_LOGITEM_XMACRO(COUNTER_POOL_EXHAUSTED, "counter pool exhausted") \
+    _SG_LOGITEM_XMACRO(END_PASS_COUNTER_STILL_ACTIVE, "sg_end_pass: counter still active, implicitly ended (call sg_end_counter() before sg_end_pass())") \
     _SG_LOGITEM_XMACRO(BEGINPASS_TOO_MANY_COLOR_ATTACHMENTS, "sg_begin_pass: too many color attachments (sg_limits.max_color_attachments)") \
     _SG_LOGITEM_XMACRO(BEGINPASS_TOO_MANY_RESOLVE_ATTACHMENTS, "sg_begin_pass: too many resolve attachments (sg_limits.max_color_attachments)") \
     _SG_LOGITEM_XMACRO(BEGINPASS_ATTACHMENTS_ALIVE, "sg_begin_pass: an attachment was provided that no longer exists") \
@@ -4558,6 +5513,7 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_EXPECT_DATA, "sg_buffer_desc: initial content data must be provided for immutable buffers without storage buffer usage") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED, "storage buffers not supported by the backend 3D API (requires OpenGL >= 4.3)") \
     _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4, "size of storage buffers must be a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BUFFERDESC_UNIFORMBUFFER_SUPPORTED, "uniform buffers not supported by the backend (sg_features.uniform_buffer_bindings)") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_NODATA, "sg_image_data: no data (.ptr and/or .size is zero)") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDATA_DATA_SIZE, "sg_image_data: data size doesn't match expected surface size") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_CANARY, "sg_image_desc not initialized") \
@@ -4582,6 +5538,9 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_ATTACHMENT_MSAA_3D_IMAGE, "3D images cannot have a sample_count > 1") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_ATTACHMENT_MSAA_CUBE_IMAGE, "cube images cannot have sample_count > 1") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_ATTACHMENT_MSAA_ARRAY_IMAGE, "array images cannot have sample_count > 1") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_TRANSIENT_EXPECT_ATTACHMENT, "sg_image_desc.usage.transient_attachment: image must be a color or depth-stencil attachment") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_TRANSIENT_RESOLVEATTACHMENT, "sg_image_desc.usage.transient_attachment: image cannot also be a resolve attachment (the resolved content must survive the pass)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_TRANSIENT_STORAGEIMAGE, "sg_image_desc.usage.transient_attachment: image cannot also be a storage image") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGEIMAGE_PIXELFORMAT, "invalid pixel format for storage image") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_STORAGEIMAGE_EXPECT_NO_MSAA, "storage images cannot be multisampled") \
     _SG_LOGITEM_XMACRO(VALIDATE_IMAGEDESC_INJECTED_NO_DATA, "images with injected textures cannot be initialized with data") \
@@ -4598,19 +5557,25 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_COMPUTE_SOURCE_OR_BYTECODE, "compute shader source or byte code expected") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_INVALID_SHADER_COMBO, "cannot combine compute shaders with vertex or fragment shaders") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_NO_BYTECODE_SIZE, "shader byte code length (in bytes) required") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_SOFTWARE_NUM_VARYINGS, "sg_shader_desc.software.num_varyings must be >= 0 and <= SG_SW_MAX_VARYINGS (software)") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_METAL_THREADS_PER_THREADGROUP_INITIALIZED, "sg_shader_desc.mtl_threads_per_threadgroup must be initialized for compute shaders (metal)") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_METAL_THREADS_PER_THREADGROUP_MULTIPLE_32, "sg_shader_desc.mtl_threads_per_threadgroup (x * y * z) must be a multiple of 32 (metal)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_BINDLESS_NOT_SUPPORTED, "sg_shader_desc.spirv_bindless requires sg_features.bindless (Vulkan with sg_desc.vulkan.bindless)") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_NO_CONT_MEMBERS, "sg_shader_desc.uniform_blocks[].glsl_uniforms[]: items must occupy continuous slots") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_SIZE_IS_ZERO, "sg_shader_desc.uniform_blocks[].size cannot be zero") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_METAL_BUFFER_SLOT_COLLISION, "sg_shader_desc.uniform_blocks[].msl_buffer_n must be unique across uniform blocks and storage buffers in same shader stage") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_HLSL_REGISTER_B_COLLISION, "sg_shader_desc.uniform_blocks[].hlsl_register_b_n must be unique across uniform blocks in same shader stage") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_WGSL_GROUP0_BINDING_COLLISION, "sg_shader_desc.uniform_blocks[].wgsl_group0_binding_n must be unique across all uniform blocks") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_SPIRV_SET0_BINDING_COLLISION, "sg_shader_desc.unifrom_blocks[].spirv_set0_binding_n must be unique across all uniform blocks") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_PUSH_CONSTANT_UNIQUE, "sg_shader_desc.uniform_blocks[].spirv_push_constant: only one uniform block per shader can be a push-constant block") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_PUSH_CONSTANT_SIZE, "sg_shader_desc.uniform_blocks[].spirv_push_constant: push-constant block size must be <= 128 bytes and a multiple of 4") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_NO_MEMBERS, "sg_shader_desc.uniform_blocks[].glsl_uniforms[]: GL backend requires uniform block member declarations") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_UNIFORM_GLSL_NAME, "sg_shader_desc.uniform_blocks[].glsl_uniforms[].glsl_name missing") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_SIZE_MISMATCH, "sg_shader_desc.uniform_blocks[].glsl_uniforms[]: size of uniform block members doesn't match uniform block size") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_ARRAY_COUNT, "sg_shader_desc.uniform_blocks[].glsl_uniforms[].array_count must be >= 1") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_STD140_ARRAY_TYPE, "sg_shader_desc.uniform_blocks[].glsl_uniforms[].type: uniform arrays only allowed for FLOAT4, INT4, MAT4 in std140 layout") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_GLSL_BLOCK_MEMBERS, "sg_shader_desc.uniform_blocks[]: .glsl_block_name and .glsl_uniforms[] are mutually exclusive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_UNIFORMBLOCK_GLSL_BLOCK_STD140, "sg_shader_desc.uniform_blocks[]: GLSL uniform blocks (.glsl_block_name) require SG_UNIFORMLAYOUT_STD140") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_VIEW_STORAGEBUFFER_METAL_BUFFER_SLOT_COLLISION, "sg_shader_desc.views[].storage_buffer.storagemsl_buffer_n must be unique across uniform blocks and storage buffer in same shader stage") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_VIEW_STORAGEBUFFER_HLSL_REGISTER_T_COLLISION, "sg_shader_desc.views[].storage_buffer.hlsl_register_t_n must be unique across read-only storage buffers and images in same shader stage") \
     _SG_LOGITEM_XMACRO(VALIDATE_SHADERDESC_VIEW_STORAGEBUFFER_HLSL_REGISTER_U_COLLISION, "sg_shader_desc.views[].storage_buffer.hlsl_register_u_n must be unique across read/write storage buffers and storage images in same shader stage") \
@@ -4674,6 +5639,7 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_IMAGE_ARRAY_SLICE, "sg_view_desc: image/attachment view slice is out of range for 2D array image (must be >=0 and <image.num_slices") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_IMAGE_3D_SLICE, "sg_view_desc: image/attachment view slice is out of range for 3D image (must be 0)") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_TEXTURE_EXPECT_NO_MSAA, "sg_view_desc: MSAA texture bindings not allowed on this backend (sg_features.msaa_texture_bindings)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_TEXTURE_TRANSIENT, "sg_view_desc.texture: image was created with sg_image_desc.usage.transient_attachment and cannot be sampled") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_TEXTURE_MIPLEVELS, "sg_view_desc: texture view mip levels are out of range (must be >=0 and <image.num_miplevels)") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_TEXTURE_2D_SLICES, "sg_view_desc: texture view slices are out of range for 2D image (must be 0)") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_TEXTURE_CUBEMAP_SLICES, "sg_view_desc: texture view slices are out of range for cubemap image (must be 0)") \
@@ -4683,8 +5649,12 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_COLORATTACHMENT_PIXELFORMAT, "sg_view_desc.color_attachment: pixel format of image must be renderable (sg_pixelformat_info.render)") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_DEPTHSTENCILATTACHMENT_PIXELFORMAT, "sg_view_desc.depth_stencil_attachment: pixel format of image must be a depth or depth-stencil format (sg_pixelformat_info.depth)") \
     _SG_LOGITEM_XMACRO(VALIDATE_VIEWDESC_RESOLVEATTACHMENT_SAMPLECOUNT, "sg_view_desc.resolve_attachment: image cannot be multisampled") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COUNTERDESC_CANARY, "sg_counter_desc not initialized") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COUNTERDESC_OCCLUSION_NOT_SUPPORTED, "sg_counter_desc.type: occlusion counters not supported by backend (sg_features.occlusion_counter)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_COUNTERDESC_PIPELINE_STATISTICS_NOT_SUPPORTED, "sg_counter_desc.type: pipeline statistics counters not supported by backend (sg_features.pipeline_statistics_counter)") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_CANARY, "sg_begin_pass: pass struct not initialized") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_COMPUTEPASS_EXPECT_NO_ATTACHMENTS, "sg_begin_pass: compute passes cannot have attachments") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_ASYNC_COMPUTE_EXPECT_COMPUTE, "sg_begin_pass: pass.async_compute requires pass.compute") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_SWAPCHAIN_EXPECT_WIDTH, "sg_begin_pass: expected pass.swapchain.width > 0") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_SWAPCHAIN_EXPECT_WIDTH_NOTSET, "sg_begin_pass: expected pass.swapchain.width == 0") \
     _SG_LOGITEM_XMACRO(VALIDATE_BEGINPASS_SWAPCHAIN_EXPECT_HEIGHT, "sg_begin_pass: expected pass.swapchain.height > 0") \
@@ -4827,6 +5797,22 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_AU_PIPELINE_SHADER_VALID, "sg_apply_uniforms: shader associated with currently applied pipeline is not in valid state") \
     _SG_LOGITEM_XMACRO(VALIDATE_AU_NO_UNIFORMBLOCK_AT_SLOT, "sg_apply_uniforms: no uniform block declaration at this shader stage UB slot") \
     _SG_LOGITEM_XMACRO(VALIDATE_AU_SIZE, "sg_apply_uniforms: data size doesn't match declared uniform block size") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AU_GLSL_BLOCK, "sg_apply_uniforms: GL uniform blocks declared with .glsl_block_name must be bound with sg_apply_uniform_buffer()") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_NOT_SUPPORTED, "sg_apply_uniform_buffer: not supported by backend (sg_features.uniform_buffer_bindings)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_PASS_EXPECTED, "sg_apply_uniform_buffer: must be called in a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_NO_PIPELINE, "sg_apply_uniform_buffer: must be called after sg_apply_pipeline()") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_PIPELINE_ALIVE, "sg_apply_uniform_buffer: currently applied pipeline object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_PIPELINE_VALID, "sg_apply_uniform_buffer: currently applied pipeline object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_PIPELINE_SHADER_ALIVE, "sg_apply_uniform_buffer: shader associated with currently applied pipeline is no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_PIPELINE_SHADER_VALID, "sg_apply_uniform_buffer: shader associated with currently applied pipeline is not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_NO_UNIFORMBLOCK_AT_SLOT, "sg_apply_uniform_buffer: no uniform block declaration at this shader stage UB slot") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_PUSH_CONSTANT, "sg_apply_uniform_buffer: push-constant uniform blocks cannot be bound from a buffer (use sg_apply_uniforms())") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_GLSL_BLOCK_NAME, "sg_apply_uniform_buffer: GL requires the uniform block to be declared with sg_shader_desc.uniform_blocks[].glsl_block_name") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_BUFFER_EXISTS, "sg_apply_uniform_buffer: buffer no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_BUFFER_VALID, "sg_apply_uniform_buffer: buffer not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_EXPECT_UNIFORMBUFFER, "sg_apply_uniform_buffer: buffer must be created with .usage.uniform_buffer = true") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_OFFSET_ALIGNMENT, "sg_apply_uniform_buffer: offset must be >= 0 and a multiple of sg_limits.uniform_buffer_offset_alignment") \
+    _SG_LOGITEM_XMACRO(VALIDATE_AUB_BUFFER_SIZE, "sg_apply_uniform_buffer: buffer too small for uniform block at offset") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_RENDERPASS_EXPECTED, "sg_draw: must be called in a render pass") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BASEELEMENT_GE_ZERO, "sg_draw: base_element cannot be < 0") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_NUMELEMENTS_GE_ZERO, "sg_draw: num_elements cannot be < 0") \
@@ -4840,12 +5826,37 @@ typedef struct sg_stats {
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_EX_BASEINSTANCE_VS_INSTANCED, "sg_draw_ex(): base_instance must be == 0 for non-instanced rendering") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_EX_BASEVERTEX_NOT_SUPPORTED, "sg_draw_ex(): base_vertex != 0 not supported on this backend (sg_features.draw_base_vertex)") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_EX_BASEINSTANCE_NOT_SUPPORTED, "sg_draw_ex(): base_instance > 0 not supported on this backend (sg_features.draw_base_instance)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_RENDERPASS_EXPECTED, "sg_draw_batch: must be called in a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_COUNT_GE_ZERO, "sg_draw_batch: count cannot be < 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_BASEELEMENT_GE_ZERO, "sg_draw_batch: base_element cannot be < 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_NUMELEMENTS_GE_ZERO, "sg_draw_batch: num_elements cannot be < 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_NUMINSTANCES_GE_ZERO, "sg_draw_batch: num_instances cannot be < 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_BASEINSTANCE_GE_ZERO, "sg_draw_batch: base_instance cannot be < 0") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_BASEVERTEX_VS_INDEXED, "sg_draw_batch(): base_vertex must be == 0 for non-indexed rendering") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_BASEINSTANCE_VS_INSTANCED, "sg_draw_batch(): base_instance must be == 0 for non-instanced rendering") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_BASEVERTEX_NOT_SUPPORTED, "sg_draw_batch(): base_vertex != 0 not supported on this backend (sg_features.draw_base_vertex)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DRAW_BATCH_BASEINSTANCE_NOT_SUPPORTED, "sg_draw_batch(): base_instance > 0 not supported on this backend (sg_features.draw_base_instance)") \
     _SG_LOGITEM_XMACRO(VALIDATE_DRAW_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING, "sg_draw: call to sg_apply_bindings() and/or sg_apply_uniforms() missing after sg_apply_pipeline()") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_COMPUTEPASS_EXPECTED, "sg_dispatch: must be called in a compute pass") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NUMGROUPSX, "sg_dispatch: num_groups_x must be >=0 and <65536") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NUMGROUPSY, "sg_dispatch: num_groups_y must be >=0 and <65536") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_NUMGROUPSZ, "sg_dispatch: num_groups_z must be >=0 and <65536") \
     _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING, "sg_dispatch: call to sg_apply_bindings() and/or sg_apply_uniforms() missing after sg_apply_pipeline()") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_NOT_SUPPORTED, "sg_dispatch_indirect: not supported by backend (sg_features.dispatch_indirect)") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_COMPUTEPASS_EXPECTED, "sg_dispatch_indirect: must be called in a compute pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_BUFFER_EXISTS, "sg_dispatch_indirect: buffer no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_EXPECT_STORAGEBUFFER, "sg_dispatch_indirect: buffer must be created with .usage.storage_buffer = true") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_OFFSET_ALIGNMENT, "sg_dispatch_indirect: offset must be >= 0 and a multiple of 4") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_BUFFER_SIZE, "sg_dispatch_indirect: buffer too small for 3 uint32_t workgroup counts at offset") \
+    _SG_LOGITEM_XMACRO(VALIDATE_DISPATCH_INDIRECT_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING, "sg_dispatch_indirect: call to sg_apply_bindings() and/or sg_apply_uniforms() missing after sg_apply_pipeline()") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCOUNTER_EXISTS, "sg_begin_counter: counter object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCOUNTER_VALID, "sg_begin_counter: counter object not in valid state") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCOUNTER_RENDERPASS_EXPECTED, "sg_begin_counter: occlusion counters must be used in a render pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCOUNTER_PASS_EXPECTED, "sg_begin_counter: must be called in a pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCOUNTER_ALREADY_ACTIVE, "sg_begin_counter: another counter of the same type is already active in this pass") \
+    _SG_LOGITEM_XMACRO(VALIDATE_BEGINCOUNTER_ONCE_PER_FRAME, "sg_begin_counter: a counter object can only be used once per frame") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDCOUNTER_EXISTS, "sg_end_counter: counter object no longer alive") \
+    _SG_LOGITEM_XMACRO(VALIDATE_ENDCOUNTER_NOT_ACTIVE, "sg_end_counter: counter object is not active (missing sg_begin_counter() in this pass)") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_USAGE, "sg_update_buffer: cannot update immutable buffer") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_SIZE, "sg_update_buffer: update size is bigger than buffer size") \
     _SG_LOGITEM_XMACRO(VALIDATE_UPDATEBUF_ONCE, "sg_update_buffer: only one update allowed per buffer and frame") \
@@ -4877,9 +5888,16 @@ typedef enum sg_log_item {
     .shader_pool_size                   32
     .pipeline_pool_size                 64
     .view_pool_size                     256
+    .counter_pool_size                    32
     .uniform_buffer_size                4 MB (4*1024*1024)
     .max_commit_listeners               1024
+    .stats_history_size                 0 (no stats history)
     .disable_validation                 false
+    .parallel_shader_compile            false
+    .gl.disable_vao_cache               false
+    .gl.vao_cache_size                  256
+    .gl.disable_multi_bind              false
+    .gl.disable_persistent_stream_buffers   false
     .metal.force_managed_storage_mode   false
     .metal.use_command_buffer_with_retained_references  false
     .wgpu.disable_bindgroups_cache      false
@@ -4887,6 +5905,7 @@ typedef enum sg_log_item {
     .vulkan.copy_staging_buffer_size    4 MB
     .vulkan.stream_staging_buffer_size  16 MB
     .vulkan.descriptor_buffer_size      16 MB
+    .vulkan.bindless                    false
 
     .allocator.alloc_fn     0 (in this case, malloc() will be called)
     .allocator.free_fn      0 (in this case, free() will be called)
@@ -4920,6 +5939,47 @@ typedef enum sg_log_item {
         .environment.metal.device
             a pointer to the MTLDevice object
 
+    GL specific:
+        .gl.disable_vao_cache
+            When this is true, the GL backend will use a single global
+            vertex-array-object and re-specify vertex attributes as needed
+            in sg_apply_bindings() instead of caching one vertex-array-object
+            per pipeline and vertex buffer combination.
+        .gl.vao_cache_size
+            The max number of vertex-array-objects in the cache (the default
+            is 256). When the cache is full, the least recently used
+            vertex-array-object is deleted. Check the .gl.num_vao_cache_evictions
+            value returned by sg_query_stats() to find out whether the cache
+            size needs to be increased.
+        .gl.disable_multi_bind
+            On GL 4.4 (or with the GL_ARB_multi_bind extension), sg_apply_bindings()
+            applies all changed texture-, sampler- and storage-buffer bindings
+            with one call each to glBindTextures(), glBindSamplers() and
+            glBindBuffersRange() (see sg_features.gl_multi_bind). Set this to true
+            to bind one slot at a time instead, for instance to compare the
+            .gl.num_bind_* counters returned by sg_query_stats().
+        .gl.disable_persistent_stream_buffers
+            On GL 4.4 (or with the GL_ARB_buffer_storage extension), buffers
+            with .usage.stream_update are created with glBufferStorage() and
+            stay persistently mapped, sg_update_buffer() and sg_append_buffer()
+            then copy directly into the mapped memory instead of calling
+            glBufferSubData(). Before a buffer is overwritten, sokol-gfx waits
+            on a fence for the frame which last wrote the buffer, the time spent
+            waiting is reported in .gl.num_fence_waits and .gl.fence_wait_time_us
+            returned by sg_query_stats(). Set this to true to use glBufferSubData()
+            instead.
+
+            The same applies to images with .usage.stream_update: each
+            texture slot gets a persistently mapped pixel unpack buffer,
+            sg_update_image() copies the new content into that buffer and
+            glTexSubImage*() then sources the data from the buffer, so that the
+            actual texture upload happens asynchronously on the GPU instead of
+            blocking the render thread. The number of such uploads is reported
+            in .gl.num_pbo_uploads, and the time spent in sg_update_image()
+            (with or without pixel unpack buffers, including fence waits) in
+            .gl.upload_time_us. With .gl.disable_persistent_stream_buffers,
+            image data is passed to glTexSubImage*() directly.
+
     D3D11 specific:
         .environment.d3d11.device
             a pointer to the ID3D11Device object, this must have been created
@@ -4951,12 +6011,26 @@ typedef enum sg_log_item {
             a WGPUDevice handle
 
     Vulkan specific:
+        NOTE: the Vulkan device must have been created with the Vulkan 1.2
+        timelineSemaphore feature enabled, frames and staging uploads are
+        tracked with a timeline semaphore on the graphics queue. Confirm
+        this by setting .environment.vulkan.timeline_semaphore to true.
+        Otherwise sg_setup() fails with the log item
+        VULKAN_TIMELINE_SEMAPHORE_NOT_SUPPORTED, and sg_isvalid() returns
+        false (sokol_app.h skips physical devices without the feature and
+        enables it on the device it creates).
         .vulkan.copy_staging_buffer_size
             Size of the staging buffer in bytes for uploading the initial
             content of buffers and images, and for updating
-            .usage.dynamic_update resources. The default is 4 MB,
-            bigger resource updates are split into multiple chunks
-            of the staging buffer size
+            .usage.dynamic_update resources. The default is 4 MB.
+            The staging buffer is persistently mapped and split into
+            a ring of 4 segments. Copies are recorded into the current
+            segment, and a segment is submitted when it is full or in
+            sg_commit() before the frame's command buffers. The CPU only
+            waits when the ring wraps around to a segment which is still
+            in flight (see sg_frame_stats_vk.num_staging_copy_waits).
+            Bigger resource updates are split into chunks of the segment size
+            (a quarter of the staging buffer size).
         .vulkan.stream_staging_buffer_size
             Size of the staging buffer in bytes for updating .usage.stream_update
             resources. The default is 16 MB. The size must be big enough
@@ -4972,6 +6046,23 @@ typedef enum sg_log_item {
             frame (assume a worst-case of 256 bytes per binding). Note
             that the actually allocated size will be twice as much
             because the descriptor-buffer is double-buffered.
+        .environment.vulkan.host_query_reset
+            Set this to true if the Vulkan 1.2 hostQueryReset feature has been
+            enabled on the device, this is required for GPU counters
+            (see GPU COUNTERS).
+        .environment.vulkan.pipeline_statistics_query
+            Set this to true if the pipelineStatisticsQuery device feature has
+            been enabled, this is required for SG_COUNTERTYPE_PIPELINE_STATISTICS
+            counters (see GPU COUNTERS).
+        .environment.vulkan.descriptor_indexing
+            Set this to true if the Vulkan 1.2 descriptorBindingPartiallyBound
+            and runtimeDescriptorArray features have been enabled on the device,
+            this is required for the bindless descriptor heap (see BINDLESS
+            RESOURCES).
+        .vulkan.bindless
+            If true, create a global descriptor heap which holds all texture
+            views, storage buffer views and samplers at a stable index,
+            see BINDLESS RESOURCES for details. The default is false.
 
     When using sokol_gfx.h and sokol_app.h together, consider using the
     helper function sglue_environment() in the sokol_glue.h header to
@@ -5004,6 +6095,12 @@ typedef struct sg_vulkan_environment {
     const void* device;
     const void* queue;
     uint32_t queue_family_index;
+    const void* compute_queue;              // optional: a queue for async compute passes
+    uint32_t compute_queue_family_index;
+    bool timeline_semaphore;                // must be true: the Vulkan 1.2 timelineSemaphore feature is enabled on the device
+    bool host_query_reset;                  // true if the Vulkan 1.2 hostQueryReset feature is enabled on the device
+    bool pipeline_statistics_query;         // true if the pipelineStatisticsQuery feature is enabled on the device
+    bool descriptor_indexing;               // true if the Vulkan 1.2 descriptorBindingPartiallyBound and runtimeDescriptorArray features are enabled on the device
 } sg_vulkan_environment;
 
 typedef struct sg_environment {
@@ -5065,6 +6162,13 @@ typedef struct sg_logger {
     void* user_data;
 } sg_logger;
 
+typedef struct sg_gl_desc {
+    bool disable_vao_cache;     // set to true to disable the GL backend vertex-array-object cache
+    int vao_cache_size;         // max number of cached vertex-array-objects (default: 256)
+    bool disable_multi_bind;    // set to true to not use the GL 4.4 multi-bind functions even if supported
+    bool disable_persistent_stream_buffers; // set to true to not use persistently mapped stream buffers even if supported
+} sg_gl_desc;
+
 typedef struct sg_d3d11_desc {
     bool shader_debugging;  // if true, HLSL shaders are compiled with D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION
 } sg_d3d11_desc;
@@ -5083,8 +6187,13 @@ typedef struct sg_vulkan_desc {
     int copy_staging_buffer_size;    // size of staging buffer for immutable and dynamic resources (default: 4 MB)
     int stream_staging_buffer_size;  // size of per-frame staging buffer for updating streaming resources (default: 16 MB)
     int descriptor_buffer_size;      // size of per-frame descriptor buffer for updating resource bindings (default: 16 MB)
+    bool bindless;                   // create the global bindless descriptor heap (see BINDLESS RESOURCES)
 } sg_vulkan_desc;
 
+typedef struct sg_software_desc {
+    int num_threads;    // number of rasterizer threads including the calling thread (default: number of CPU cores)
+} sg_software_desc;
+
 typedef struct sg_desc {
     uint32_t _start_canary;
     int buffer_pool_size;
@@ -5093,14 +6202,19 @@ typedef struct sg_desc {
     int shader_pool_size;
     int pipeline_pool_size;
     int view_pool_size;
+    int counter_pool_size;
     int uniform_buffer_size;        // max size of all sg_apply_uniform() calls per frame, with worst-case 256 byte alignment
     int max_commit_listeners;       // max number of commit listener hook functions
+    int stats_history_size;         // number of frames in the stats history for sg_query_stats_history() (default: 0, disabled)
     bool disable_validation;        // disable validation layer even in debug mode, useful for tests
     bool enforce_portable_limits;   // if true, enforce portable resource binding limits (SG_MAX_PORTABLE_*)
+    bool parallel_shader_compile;   // if true, compile shaders and pipelines in the background where supported (see PARALLEL SHADER COMPILATION)
+    sg_gl_desc gl;                  // GL-specific setup parameters
     sg_d3d11_desc d3d11;            // d3d11-specific setup parameters
     sg_metal_desc metal;            // metal-specific setup parameters
     sg_wgpu_desc wgpu;              // webgpu-specific setup parameters
     sg_vulkan_desc vulkan;          // vulkan-specific setup parameters
+    sg_software_desc software;      // software-backend-specific setup parameters
     sg_allocator allocator;         // optional memory allocation hooks
     sg_logger logger;               // optional log function override
     sg_environment environment;     // required externally provided runtime objects and defaults
@@ -5111,6 +6225,11 @@ typedef struct sg_desc {
 SOKOL_GFX_API_DECL void sg_setup(const sg_desc* desc);
 SOKOL_GFX_API_DECL void sg_shutdown(void);
 SOKOL_GFX_API_DECL bool sg_isvalid(void);
+SOKOL_GFX_API_DECL sg_context sg_make_context(const sg_desc* desc);
+SOKOL_GFX_API_DECL void sg_destroy_context(sg_context ctx);
+SOKOL_GFX_API_DECL void sg_set_context(sg_context ctx);
+SOKOL_GFX_API_DECL sg_context sg_get_context(void);
+SOKOL_GFX_API_DECL sg_context sg_default_context(void);
 SOKOL_GFX_API_DECL void sg_reset_state_cache(void);
 SOKOL_GFX_API_DECL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace_hooks);
 SOKOL_GFX_API_DECL void sg_push_debug_group(const char* name);
@@ -5125,12 +6244,14 @@ SOKOL_GFX_API_DECL sg_sampler sg_make_sampler(const sg_sampler_desc* desc);
 SOKOL_GFX_API_DECL sg_shader sg_make_shader(const sg_shader_desc* desc);
 SOKOL_GFX_API_DECL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc);
 SOKOL_GFX_API_DECL sg_view sg_make_view(const sg_view_desc* desc);
+SOKOL_GFX_API_DECL sg_counter sg_make_counter(const sg_counter_desc* desc);
 SOKOL_GFX_API_DECL void sg_destroy_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_destroy_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_destroy_sampler(sg_sampler smp);
 SOKOL_GFX_API_DECL void sg_destroy_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_destroy_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_destroy_view(sg_view view);
+SOKOL_GFX_API_DECL void sg_destroy_counter(sg_counter ctr);
 SOKOL_GFX_API_DECL void sg_update_buffer(sg_buffer buf, const sg_range* data);
 SOKOL_GFX_API_DECL void sg_update_image(sg_image img, const sg_image_data* data);
 SOKOL_GFX_API_DECL int sg_append_buffer(sg_buffer buf, const sg_range* data);
@@ -5146,9 +6267,14 @@ SOKOL_GFX_API_DECL void sg_apply_scissor_rectf(float x, float y, float width, fl
 SOKOL_GFX_API_DECL void sg_apply_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_apply_bindings(const sg_bindings* bindings);
 SOKOL_GFX_API_DECL void sg_apply_uniforms(int ub_slot, const sg_range* data);
+SOKOL_GFX_API_DECL void sg_apply_uniform_buffer(int ub_slot, sg_buffer buf, int offset);
 SOKOL_GFX_API_DECL void sg_draw(int base_element, int num_elements, int num_instances);
 SOKOL_GFX_API_DECL void sg_draw_ex(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance);
+SOKOL_GFX_API_DECL void sg_draw_batch(const sg_draw_args* args, int count);
 SOKOL_GFX_API_DECL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z);
+SOKOL_GFX_API_DECL void sg_dispatch_indirect(sg_buffer buf, int offset);
+SOKOL_GFX_API_DECL void sg_begin_counter(sg_counter ctr);
+SOKOL_GFX_API_DECL void sg_end_counter(sg_counter ctr);
 SOKOL_GFX_API_DECL void sg_end_pass(void);
 SOKOL_GFX_API_DECL void sg_commit(void);
 
@@ -5167,6 +6293,7 @@ SOKOL_GFX_API_DECL sg_resource_state sg_query_sampler_state(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_resource_state sg_query_shader_state(sg_shader shd);
 SOKOL_GFX_API_DECL sg_resource_state sg_query_pipeline_state(sg_pipeline pip);
 SOKOL_GFX_API_DECL sg_resource_state sg_query_view_state(sg_view view);
+SOKOL_GFX_API_DECL sg_resource_state sg_query_counter_state(sg_counter ctr);
 // get runtime information about a resource
 SOKOL_GFX_API_DECL sg_buffer_info sg_query_buffer_info(sg_buffer buf);
 SOKOL_GFX_API_DECL sg_image_info sg_query_image_info(sg_image img);
@@ -5174,6 +6301,7 @@ SOKOL_GFX_API_DECL sg_sampler_info sg_query_sampler_info(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_shader_info sg_query_shader_info(sg_shader shd);
 SOKOL_GFX_API_DECL sg_pipeline_info sg_query_pipeline_info(sg_pipeline pip);
 SOKOL_GFX_API_DECL sg_view_info sg_query_view_info(sg_view view);
+SOKOL_GFX_API_DECL sg_counter_info sg_query_counter_info(sg_counter ctr);
 // get desc structs matching a specific resource (NOTE that not all creation attributes may be provided)
 SOKOL_GFX_API_DECL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf);
 SOKOL_GFX_API_DECL sg_image_desc sg_query_image_desc(sg_image img);
@@ -5181,6 +6309,7 @@ SOKOL_GFX_API_DECL sg_sampler_desc sg_query_sampler_desc(sg_sampler smp);
 SOKOL_GFX_API_DECL sg_shader_desc sg_query_shader_desc(sg_shader shd);
 SOKOL_GFX_API_DECL sg_pipeline_desc sg_query_pipeline_desc(sg_pipeline pip);
 SOKOL_GFX_API_DECL sg_view_desc sg_query_view_desc(sg_view view);
+SOKOL_GFX_API_DECL sg_counter_desc sg_query_counter_desc(sg_counter ctr);
 // get resource creation desc struct with their default values replaced
 SOKOL_GFX_API_DECL sg_buffer_desc sg_query_buffer_defaults(const sg_buffer_desc* desc);
 SOKOL_GFX_API_DECL sg_image_desc sg_query_image_defaults(const sg_image_desc* desc);
@@ -5188,6 +6317,7 @@ SOKOL_GFX_API_DECL sg_sampler_desc sg_query_sampler_defaults(const sg_sampler_de
 SOKOL_GFX_API_DECL sg_shader_desc sg_query_shader_defaults(const sg_shader_desc* desc);
 SOKOL_GFX_API_DECL sg_pipeline_desc sg_query_pipeline_defaults(const sg_pipeline_desc* desc);
 SOKOL_GFX_API_DECL sg_view_desc sg_query_view_defaults(const sg_view_desc* desc);
+SOKOL_GFX_API_DECL sg_counter_desc sg_query_counter_defaults(const sg_counter_desc* desc);
 // assorted query functions
 SOKOL_GFX_API_DECL size_t sg_query_buffer_size(sg_buffer buf);
 SOKOL_GFX_API_DECL sg_buffer_usage sg_query_buffer_usage(sg_buffer buf);
@@ -5202,6 +6332,9 @@ SOKOL_GFX_API_DECL int sg_query_image_sample_count(sg_image img);
 SOKOL_GFX_API_DECL sg_view_type sg_query_view_type(sg_view view);
 SOKOL_GFX_API_DECL sg_image sg_query_view_image(sg_view view);
 SOKOL_GFX_API_DECL sg_buffer sg_query_view_buffer(sg_view view);
+SOKOL_GFX_API_DECL int sg_query_view_bindless_index(sg_view view);
+SOKOL_GFX_API_DECL int sg_query_sampler_bindless_index(sg_sampler smp);
+SOKOL_GFX_API_DECL sg_counter_value sg_query_counter_value(sg_counter ctr);
 
 // separate resource allocation and initialization (for async setup)
 SOKOL_GFX_API_DECL sg_buffer sg_alloc_buffer(void);
@@ -5210,36 +6343,42 @@ SOKOL_GFX_API_DECL sg_sampler sg_alloc_sampler(void);
 SOKOL_GFX_API_DECL sg_shader sg_alloc_shader(void);
 SOKOL_GFX_API_DECL sg_pipeline sg_alloc_pipeline(void);
 SOKOL_GFX_API_DECL sg_view sg_alloc_view(void);
+SOKOL_GFX_API_DECL sg_counter sg_alloc_counter(void);
 SOKOL_GFX_API_DECL void sg_dealloc_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_dealloc_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_dealloc_sampler(sg_sampler smp);
 SOKOL_GFX_API_DECL void sg_dealloc_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_dealloc_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_dealloc_view(sg_view view);
+SOKOL_GFX_API_DECL void sg_dealloc_counter(sg_counter ctr);
 SOKOL_GFX_API_DECL void sg_init_buffer(sg_buffer buf, const sg_buffer_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_image(sg_image img, const sg_image_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_sampler(sg_sampler smg, const sg_sampler_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_shader(sg_shader shd, const sg_shader_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc* desc);
 SOKOL_GFX_API_DECL void sg_init_view(sg_view view, const sg_view_desc* desc);
+SOKOL_GFX_API_DECL void sg_init_counter(sg_counter ctr, const sg_counter_desc* desc);
 SOKOL_GFX_API_DECL void sg_uninit_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_uninit_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_uninit_sampler(sg_sampler smp);
 SOKOL_GFX_API_DECL void sg_uninit_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_uninit_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_uninit_view(sg_view view);
+SOKOL_GFX_API_DECL void sg_uninit_counter(sg_counter ctr);
 SOKOL_GFX_API_DECL void sg_fail_buffer(sg_buffer buf);
 SOKOL_GFX_API_DECL void sg_fail_image(sg_image img);
 SOKOL_GFX_API_DECL void sg_fail_sampler(sg_sampler smp);
 SOKOL_GFX_API_DECL void sg_fail_shader(sg_shader shd);
 SOKOL_GFX_API_DECL void sg_fail_pipeline(sg_pipeline pip);
 SOKOL_GFX_API_DECL void sg_fail_view(sg_view view);
+SOKOL_GFX_API_DECL void sg_fail_counter(sg_counter ctr);
 
 // frame and total stats
 SOKOL_GFX_API_DECL void sg_enable_stats(void);
 SOKOL_GFX_API_DECL void sg_disable_stats(void);
 SOKOL_GFX_API_DECL bool sg_stats_enabled(void);
 SOKOL_GFX_API_DECL sg_stats sg_query_stats(void);
+SOKOL_GFX_API_DECL sg_stats_history sg_query_stats_history(void);
 
 /* Backend-specific structs and functions, these may come in handy for mixing
    sokol-gfx rendering with 'native backend' rendering functions.
@@ -5429,6 +6568,17 @@ SOKOL_GFX_API_DECL sg_gl_shader_info sg_gl_query_shader_info(sg_shader shd);
 // GL: get internal view resource objects
 SOKOL_GFX_API_DECL sg_gl_view_info sg_gl_query_view_info(sg_view view);
 
+// Software: sample a texture view with a sampler (uvw: texture coords, w is array layer or 3D coord)
+SOKOL_GFX_API_DECL void sg_sw_sample(const sg_sw_shader_context* ctx, int view_slot, int sampler_slot, const float uvw[3], float lod, float out_rgba[4]);
+// Software: sample a depth texture view with a comparison sampler, returns value in range 0..1
+SOKOL_GFX_API_DECL float sg_sw_sample_compare(const sg_sw_shader_context* ctx, int view_slot, int sampler_slot, const float uvw[3], float lod, float ref);
+// Software: load a pixel from a texture or storage image view (z is the array layer or 3D slice)
+SOKOL_GFX_API_DECL void sg_sw_image_load(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z, float out_rgba[4]);
+// Software: store a pixel into a storage image view (z is the array layer or 3D slice)
+SOKOL_GFX_API_DECL void sg_sw_image_store(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z, const float rgba[4]);
+// Software: copy the pixels of an image surface into user memory (tightly packed rows, depth formats as 32-bit floats)
+SOKOL_GFX_API_DECL bool sg_sw_read_image(sg_image img, int mip_level, int slice, const sg_range* data);
+
 #ifdef __cplusplus
 } // extern "C"
 
@@ -5441,6 +6591,7 @@ inline sg_sampler sg_make_sampler(const sg_sampler_desc& desc) { return sg_make_
 inline sg_shader sg_make_shader(const sg_shader_desc& desc) { return sg_make_shader(&desc); }
 inline sg_pipeline sg_make_pipeline(const sg_pipeline_desc& desc) { return sg_make_pipeline(&desc); }
 inline sg_view sg_make_view(const sg_view_desc& desc) { return sg_make_view(&desc); }
+inline sg_counter sg_make_counter(const sg_counter_desc& desc) { return sg_make_counter(&desc); }
 inline void sg_update_image(sg_image img, const sg_image_data& data) { return sg_update_image(img, &data); }
 
 inline void sg_begin_pass(const sg_pass& pass) { return sg_begin_pass(&pass); }
@@ -5453,6 +6604,7 @@ inline sg_sampler_desc sg_query_sampler_defaults(const sg_sampler_desc& desc) {
 inline sg_shader_desc sg_query_shader_defaults(const sg_shader_desc& desc) { return sg_query_shader_defaults(&desc); }
 inline sg_pipeline_desc sg_query_pipeline_defaults(const sg_pipeline_desc& desc) { return sg_query_pipeline_defaults(&desc); }
 inline sg_view_desc sg_query_view_defaults(const sg_view_desc& desc) { return sg_query_view_defaults(&desc); }
+inline sg_counter_desc sg_query_counter_defaults(const sg_counter_desc& desc) { return sg_query_counter_defaults(&desc); }
 
 inline void sg_init_buffer(sg_buffer buf, const sg_buffer_desc& desc) { return sg_init_buffer(buf, &desc); }
 inline void sg_init_image(sg_image img, const sg_image_desc& desc) { return sg_init_image(img, &desc); }
@@ -5460,6 +6612,7 @@ inline void sg_init_sampler(sg_sampler smp, const sg_sampler_desc& desc) { retur
 inline void sg_init_shader(sg_shader shd, const sg_shader_desc& desc) { return sg_init_shader(shd, &desc); }
 inline void sg_init_pipeline(sg_pipeline pip, const sg_pipeline_desc& desc) { return sg_init_pipeline(pip, &desc); }
 inline void sg_init_view(sg_view view, const sg_view_desc& desc) { return sg_init_view(view, &desc); }
+inline void sg_init_counter(sg_counter ctr, const sg_counter_desc& desc) { return sg_init_counter(ctr, &desc); }
 
 inline void sg_update_buffer(sg_buffer buf_id, const sg_range& data) { return sg_update_buffer(buf_id, &data); }
 inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_append_buffer(buf_id, &data); }
@@ -5476,8 +6629,8 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
 #ifdef SOKOL_GFX_IMPL
 #define SOKOL_GFX_IMPL_INCLUDED (1)
 
-#if !(defined(SOKOL_GLCORE)||defined(SOKOL_GLES3)||defined(SOKOL_D3D11)||defined(SOKOL_METAL)||defined(SOKOL_WGPU)||defined(SOKOL_VULKAN)||defined(SOKOL_DUMMY_BACKEND))
-#error "Please select a backend with SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND"
+#if !(defined(SOKOL_GLCORE)||defined(SOKOL_GLES3)||defined(SOKOL_D3D11)||defined(SOKOL_METAL)||defined(SOKOL_WGPU)||defined(SOKOL_VULKAN)||defined(SOKOL_SOFTWARE)||defined(SOKOL_DUMMY_BACKEND))
+#error "Please select a backend with SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN, SOKOL_SOFTWARE or SOKOL_DUMMY_BACKEND"
 #endif
 #if defined(SOKOL_MALLOC) || defined(SOKOL_CALLOC) || defined(SOKOL_FREE)
 #error "SOKOL_MALLOC/CALLOC/FREE macros are no longer supported, please use sg_desc.allocator to override memory allocation functions"
@@ -5515,7 +6668,11 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #define _SOKOL_UNUSED(x) (void)(x)
 #endif
 
-#if defined(SOKOL_TRACE_HOOKS)
+#if defined(SOKOL_TRACE_HOOKS) && defined(SOKOL_LOADER_THREADS)
+// trace hooks are only called on the render thread
+#define _SG_TRACE_ARGS(fn, ...) if (_sg.hooks.fn && !_sg_on_loader_thread()) { _sg.hooks.fn(__VA_ARGS__, _sg.hooks.user_data); }
+#define _SG_TRACE_NOARGS(fn) if (_sg.hooks.fn && !_sg_on_loader_thread()) { _sg.hooks.fn(_sg.hooks.user_data); }
+#elif defined(SOKOL_TRACE_HOOKS)
 #define _SG_TRACE_ARGS(fn, ...) if (_sg.hooks.fn) { _sg.hooks.fn(__VA_ARGS__, _sg.hooks.user_data); }
 #define _SG_TRACE_NOARGS(fn) if (_sg.hooks.fn) { _sg.hooks.fn(_sg.hooks.user_data); }
 #else
@@ -5607,6 +6764,43 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #endif
 #elif defined(SOKOL_VULKAN)
     #include <vulkan/vulkan.h>
+    // needed for the background pipeline compiler thread
+    #if defined(_WIN32)
+        #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+        #endif
+        #ifndef NOMINMAX
+        #define NOMINMAX
+        #endif
+        #include <windows.h>
+        #define _SG_VK_WIN32_THREADS (1)
+    #else
+        #include <pthread.h>
+        #define _SG_VK_PTHREADS (1)
+    #endif
+#elif defined(SOKOL_SOFTWARE)
+    #include <math.h>   // powf, floorf, ...
+    #if defined(_WIN32)
+        #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+        #endif
+        #ifndef NOMINMAX
+        #define NOMINMAX
+        #endif
+        #include <windows.h>
+        #define _SG_SW_WIN32_THREADS (1)
+    #elif !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+        #include <pthread.h>
+        #include <unistd.h> // sysconf
+        #define _SG_SW_PTHREADS (1)
+    #endif
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>
+        #define _SG_SW_SSE2 (1)
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #include <arm_neon.h>
+        #define _SG_SW_NEON (1)
+    #endif
 #elif defined(SOKOL_GLCORE) || defined(SOKOL_GLES3)
     #define _SOKOL_ANY_GL (1)
 
@@ -5666,9 +6860,14 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     // broad GL feature availability defines (DON'T merge this into the above ifdef-block!)
     #if defined(_WIN32)
         #define _SOKOL_GL_HAS_COLORMASKI (1)
+        #if defined(GL_VERSION_4_4) || defined(_SOKOL_USE_WIN32_GL_LOADER)
+            #define _SOKOL_GL_HAS_MULTIBIND (1)
+            #define _SOKOL_GL_HAS_BUFFERSTORAGE (1)
+        #endif
         #if defined(GL_VERSION_4_3) || defined(_SOKOL_USE_WIN32_GL_LOADER)
             #define _SOKOL_GL_HAS_COMPUTE (1)
             #define _SOKOL_GL_HAS_TEXVIEWS (1)
+            #define _SOKOL_GL_HAS_INVALIDATEFRAMEBUFFER (1)
         #endif
         #if defined(GL_VERSION_4_2) || defined(_SOKOL_USE_WIN32_GL_LOADER)
             #define _SOKOL_GL_HAS_TEXSTORAGE (1)
@@ -5679,6 +6878,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #endif
         #if defined(GL_VERSION_3_2) || defined(_SOKOL_USE_WIN32_GL_LOADER)
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
+            #define _SOKOL_GL_HAS_MULTIDRAW (1)
         #endif
     #elif defined(__APPLE__)
         #if defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE
@@ -5693,6 +6893,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
             #define _SOKOL_GL_HAS_COLORMASKI (1)
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
             #define _SOKOL_GL_HAS_DUALSOURCEBLENDING (1)
+            #define _SOKOL_GL_HAS_MULTIDRAW (1)
         #endif
     #elif defined(__EMSCRIPTEN__)
         #define _SOKOL_GL_HAS_TEXSTORAGE (1)
@@ -5705,9 +6906,14 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #elif defined(__linux__) || defined(__unix__)
         #define _SOKOL_GL_HAS_COLORMASKI (1)
         #if defined(SOKOL_GLCORE)
+            #if defined(GL_VERSION_4_4)
+                #define _SOKOL_GL_HAS_MULTIBIND (1)
+                #define _SOKOL_GL_HAS_BUFFERSTORAGE (1)
+            #endif
             #if defined(GL_VERSION_4_3)
                 #define _SOKOL_GL_HAS_COMPUTE (1)
                 #define _SOKOL_GL_HAS_TEXVIEWS (1)
+                #define _SOKOL_GL_HAS_INVALIDATEFRAMEBUFFER (1)
             #endif
             #if defined(GL_VERSION_4_2)
                 #define _SOKOL_GL_HAS_TEXSTORAGE (1)
@@ -5718,6 +6924,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
             #endif
             #if defined(GL_VERSION_3_2)
                 #define _SOKOL_GL_HAS_BASEVERTEX (1)
+                #define _SOKOL_GL_HAS_MULTIDRAW (1)
             #endif
         #else
             #define _SOKOL_GL_HAS_COMPUTE (1)
@@ -5725,6 +6932,9 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
             #define _SOKOL_GL_HAS_BASEVERTEX (1)
         #endif
     #endif
+    #if defined(SOKOL_GLES3)
+        #define _SOKOL_GL_HAS_INVALIDATEFRAMEBUFFER (1)
+    #endif
 
     // optional GL loader definitions (only on Win32)
     #if defined(_SOKOL_USE_WIN32_GL_LOADER)
@@ -5760,6 +6970,7 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         typedef int64_t  GLint64;
         typedef float  GLfloat;
         typedef int  GLint;
+        typedef struct __GLsync* GLsync;
         #define GL_INT_2_10_10_10_REV 0x8D9F
         #define GL_R32F 0x822E
         #define GL_PROGRAM_POINT_SIZE 0x8642
@@ -5994,11 +7205,22 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
         #define GL_MAX_IMAGE_UNITS 0x8F38
         #define GL_FLOAT_32_UNSIGNED_INT_24_8_REV 0x8DAD
         #define GL_DEPTH32F_STENCIL8 0x8CAD
+        #define GL_MAP_WRITE_BIT 0x0002
+        #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+        #define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+        #define GL_ALREADY_SIGNALED 0x911A
+        #define GL_TIMEOUT_EXPIRED 0x911B
+        #define GL_CONDITION_SATISFIED 0x911C
+        #define GL_WAIT_FAILED 0x911D
+        #define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
     #endif
 
     #ifndef GL_UNSIGNED_INT_2_10_10_10_REV
     #define GL_UNSIGNED_INT_2_10_10_10_REV 0x8368
     #endif
+    #ifndef GL_COMPLETION_STATUS_KHR
+    #define GL_COMPLETION_STATUS_KHR 0x91B1
+    #endif
     #ifndef GL_UNSIGNED_INT_24_8
     #define GL_UNSIGNED_INT_24_8 0x84FA
     #endif
@@ -6109,6 +7331,48 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #ifndef GL_SHADER_STORAGE_BUFFER
     #define GL_SHADER_STORAGE_BUFFER 0x90D2
     #endif
+    #ifndef GL_DISPATCH_INDIRECT_BUFFER
+    #define GL_DISPATCH_INDIRECT_BUFFER 0x90EE
+    #endif
+    #ifndef GL_UNIFORM_BUFFER
+    #define GL_UNIFORM_BUFFER 0x8A11
+    #endif
+    #ifndef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    #define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0x8A34
+    #endif
+    #ifndef GL_INVALID_INDEX
+    #define GL_INVALID_INDEX 0xFFFFFFFFu
+    #endif
+    #ifndef GL_COMMAND_BARRIER_BIT
+    #define GL_COMMAND_BARRIER_BIT 0x00000040
+    #endif
+    #ifndef GL_ANY_SAMPLES_PASSED
+    #define GL_ANY_SAMPLES_PASSED 0x8C2F
+    #endif
+    #ifndef GL_VERTEX_SHADER_INVOCATIONS
+    #define GL_VERTEX_SHADER_INVOCATIONS 0x82F0
+    #endif
+    #ifndef GL_FRAGMENT_SHADER_INVOCATIONS
+    #define GL_FRAGMENT_SHADER_INVOCATIONS 0x82F4
+    #endif
+    #ifndef GL_COMPUTE_SHADER_INVOCATIONS
+    #define GL_COMPUTE_SHADER_INVOCATIONS 0x82F5
+    #endif
+    #ifndef GL_CLIPPING_INPUT_PRIMITIVES
+    #define GL_CLIPPING_INPUT_PRIMITIVES 0x82F6
+    #endif
+    #ifndef GL_CLIPPING_OUTPUT_PRIMITIVES
+    #define GL_CLIPPING_OUTPUT_PRIMITIVES 0x82F7
+    #endif
+    #ifndef GL_MAP_PERSISTENT_BIT
+    #define GL_MAP_PERSISTENT_BIT 0x0040
+    #endif
+    #ifndef GL_MAP_COHERENT_BIT
+    #define GL_MAP_COHERENT_BIT 0x0080
+    #endif
+    #ifndef GL_PIXEL_UNPACK_BUFFER
+    #define GL_PIXEL_UNPACK_BUFFER 0x88EC
+    #endif
 #endif
 
 #if defined(SOKOL_GLES3)
@@ -6120,6 +7384,37 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
     #endif
 #endif
 
+// platform specific includes for _sg_time_now_ns(), same platform split as sokol_time.h
+// (the D3D11, Win32 GL, Vulkan and WebGPU backends may already have included these)
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #define _SG_TIME_WIN32 (1)
+#elif defined(__APPLE__) && defined(__MACH__)
+    #include <mach/mach_time.h>
+    #define _SG_TIME_MACH (1)
+#elif defined(__EMSCRIPTEN__)
+    #include <emscripten/emscripten.h>
+    #define _SG_TIME_EMSCRIPTEN (1)
+#else
+    #include <time.h>
+    // CLOCK_MONOTONIC is missing in strict ISO C mode or on some embedded platforms,
+    // _sg_time_now_ns() then falls back to the non-monotonic C11 timespec_get()
+    // or to the ISO C clock(), and sg_setup() logs a warning
+    #if defined(CLOCK_MONOTONIC)
+        #define _SG_TIME_POSIX (1)
+    #elif defined(TIME_UTC)
+        #define _SG_TIME_TIMESPEC_GET (1)
+    #else
+        #define _SG_TIME_CLOCK (1)
+    #endif
+#endif
+
 // ███████ ████████ ██████  ██    ██  ██████ ████████ ███████
 // ██         ██    ██   ██ ██    ██ ██         ██    ██
 // ███████    ██    ██████  ██    ██ ██         ██    ███████
@@ -6131,11 +7426,21 @@ inline int sg_append_buffer(sg_buffer buf_id, const sg_range& data) { return sg_
 typedef struct { int x, y, w, h; } _sg_recti_t;
 typedef struct { int width, height; } _sg_dimi_t;
 
+#if defined(SOKOL_LOADER_THREADS)
+typedef struct {
+    long locked;
+} _sg_spinlock_t;
+#endif
+
 // resource pool slots
 typedef struct {
     uint32_t id;
     uint32_t uninit_count;
     sg_resource_state state;
+    #if defined(SOKOL_LOADER_THREADS)
+    sg_resource_state pending_state;    // result of initialization on a loader thread, waiting for publication
+    #endif
+    bool compiling;     // shader or pipeline is compiling in the background, state is ALLOC until sg_commit() finds it finished
 } _sg_slot_t;
 
 // resource pool housekeeping struct
@@ -6144,6 +7449,9 @@ typedef struct {
     int queue_top;
     uint32_t* gen_ctrs;
     int* free_queue;
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_spinlock_t lock;    // protects free_queue and queue_top
+    #endif
 } _sg_pool_t;
 
 // resource hazard tracking struct
@@ -6212,9 +7520,11 @@ enum {
     _SG_DEFAULT_SHADER_POOL_SIZE = 32,
     _SG_DEFAULT_PIPELINE_POOL_SIZE = 64,
     _SG_DEFAULT_VIEW_POOL_SIZE = 256,
+    _SG_DEFAULT_COUNTER_POOL_SIZE = 32,
     _SG_DEFAULT_UB_SIZE = 4 * 1024 * 1024,
     _SG_DEFAULT_MAX_COMMIT_LISTENERS = 1024,
     _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE = 1024,
+    _SG_DEFAULT_GL_VAO_CACHE_SIZE = 256,
     _SG_DEFAULT_VK_COPY_STAGING_SIZE = (4 * 1024 * 1024),
     _SG_DEFAULT_VK_STREAM_STAGING_SIZE = (16 * 1024 * 1024),
     _SG_DEFAULT_VK_DESCRIPTOR_BUFFER_SIZE = (16 * 1024 * 1024),
@@ -6222,6 +7532,7 @@ enum {
     _SG_MAX_STORAGEIMAGE_BINDINGS_PER_STAGE = SG_MAX_VIEW_BINDSLOTS,
     _SG_MAX_TEXTURE_BINDINGS_PER_STAGE = SG_MAX_VIEW_BINDSLOTS,
     _SG_MAX_UNIFORMBLOCK_BINDINGS_PER_STAGE = 8,
+    _SG_MAX_PUSH_CONSTANT_SIZE = 128,   // guaranteed minimum of VkPhysicalDeviceLimits.maxPushConstantsSize
 };
 
 // fixed-size string
@@ -6348,6 +7659,21 @@ typedef struct {
     _sg_image_view_common_t img;
 } _sg_view_common_t;
 
+// number of frames for which a counter remembers the pass it was recorded in,
+// results with a higher latency aren't attached to the per-pass stats
+#define _SG_COUNTER_NUM_PASS_KEYS (8)
+
+typedef struct {
+    sg_counter_type type;
+    bool recorded;                  // true after the first sg_begin_counter()
+    uint32_t begin_frame_index;     // frame index of the last sg_begin_counter()
+    sg_counter_value result;          // the most recent available result
+    struct {
+        uint32_t frame_index[_SG_COUNTER_NUM_PASS_KEYS];
+        uint32_t key[_SG_COUNTER_NUM_PASS_KEYS];
+    } pass;                         // the pass the counter was ended in, per frame_index % _SG_COUNTER_NUM_PASS_KEYS
+} _sg_counter_common_t;
+
 #if defined(SOKOL_DUMMY_BACKEND)
 typedef struct _sg_buffer_s {
     _sg_slot_t slot;
@@ -6385,92 +7711,396 @@ typedef struct _sg_view_s {
 } _sg_dummy_view_t;
 typedef _sg_dummy_view_t _sg_view_t;
 
-#elif defined(_SOKOL_ANY_GL)
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+} _sg_dummy_counter_t;
+typedef _sg_dummy_counter_t _sg_counter_t;
 
-typedef enum {
-    _SG_GL_GPUDIRTY_VERTEXBUFFER = (1<<0),
-    _SG_GL_GPUDIRTY_INDEXBUFFER = (1<<1),
-    _SG_GL_GPUDIRTY_STORAGEBUFFER = (1<<2),
-    _SG_GL_GPUDIRTY_TEXTURE = (1<<3),
-    _SG_GL_GPUDIRTY_STORAGEIMAGE = (1<<4),
-    _SG_GL_GPUDIRTY_ATTACHMENT = (1<<5),
-    _SG_GL_GPUDIRTY_BUFFER_ALL = _SG_GL_GPUDIRTY_VERTEXBUFFER | _SG_GL_GPUDIRTY_INDEXBUFFER | _SG_GL_GPUDIRTY_STORAGEBUFFER,
-    _SG_GL_GPUDIRTY_IMAGE_ALL = _SG_GL_GPUDIRTY_TEXTURE | _SG_GL_GPUDIRTY_STORAGEIMAGE | _SG_GL_GPUDIRTY_ATTACHMENT,
-} _sg_gl_gpudirty_t;
+#elif defined(SOKOL_SOFTWARE)
 
 typedef struct _sg_buffer_s {
     _sg_slot_t slot;
     _sg_buffer_common_t cmn;
     struct {
-        GLuint buf[SG_NUM_INFLIGHT_FRAMES];
-        uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_t flags
-        bool injected;  // if true, external buffers were injected with sg_buffer_desc.gl_buffers
-    } gl;
-} _sg_gl_buffer_t;
-typedef _sg_gl_buffer_t _sg_buffer_t;
+        uint8_t* data;
+    } sw;
+} _sg_sw_buffer_t;
+typedef _sg_sw_buffer_t _sg_buffer_t;
 
 typedef struct _sg_image_s {
     _sg_slot_t slot;
     _sg_image_common_t cmn;
     struct {
-        GLenum target;
-        GLuint tex[SG_NUM_INFLIGHT_FRAMES];
-        uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_flags
-        bool injected;  // if true, external textures were injected with sg_image_desc.gl_textures
-    } gl;
-} _sg_gl_image_t;
-typedef _sg_gl_image_t _sg_image_t;
+        uint8_t* pixels;                    // all mip levels and slices in one allocation
+        int bytes_per_pixel;
+        size_t mip_offsets[SG_MAX_MIPMAPS]; // byte offset of each mip level into pixels
+    } sw;
+} _sg_sw_image_t;
+typedef _sg_sw_image_t _sg_image_t;
 
 typedef struct _sg_sampler_s {
     _sg_slot_t slot;
     _sg_sampler_common_t cmn;
-    struct {
-        GLuint smp;
-        bool injected;  // true if external sampler was injects in sg_sampler_desc.gl_sampler
-    } gl;
-} _sg_gl_sampler_t;
-typedef _sg_gl_sampler_t _sg_sampler_t;
-
-typedef struct {
-    GLint gl_loc;
-    sg_uniform_type type;
-    uint16_t count;
-    uint16_t offset;
-} _sg_gl_uniform_t;
-
-typedef struct {
-    int num_uniforms;
-    _sg_gl_uniform_t uniforms[SG_MAX_UNIFORMBLOCK_MEMBERS];
-} _sg_gl_uniform_block_t;
-
-typedef struct {
-    _sg_str_t name;
-} _sg_gl_shader_attr_t;
+} _sg_sw_sampler_t;
+typedef _sg_sw_sampler_t _sg_sampler_t;
 
 typedef struct _sg_shader_s {
     _sg_slot_t slot;
     _sg_shader_common_t cmn;
     struct {
-        GLuint prog;
-        _sg_gl_shader_attr_t attrs[SG_MAX_VERTEX_ATTRIBUTES];
-        _sg_gl_uniform_block_t uniform_blocks[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
-        uint8_t sbuf_binding[SG_MAX_VIEW_BINDSLOTS];
-        uint8_t simg_binding[SG_MAX_VIEW_BINDSLOTS];
-        int8_t tex_slot[SG_MAX_TEXTURE_SAMPLER_PAIRS]; // GL texture unit index
-    } gl;
-} _sg_gl_shader_t;
-typedef _sg_gl_shader_t _sg_shader_t;
-
-typedef struct {
-    int8_t vb_index;        // -1 if attr is not enabled
-    int8_t divisor;         // -1 if not initialized
-    uint8_t stride;
-    uint8_t size;
-    uint8_t normalized;
-    int offset;
-    GLenum type;
-    sg_shader_attr_base_type base_type;
-} _sg_gl_attr_t;
+        sg_software_shader funcs;
+    } sw;
+} _sg_sw_shader_t;
+typedef _sg_sw_shader_t _sg_shader_t;
+
+typedef struct _sg_pipeline_s {
+    _sg_slot_t slot;
+    _sg_pipeline_common_t cmn;
+} _sg_sw_pipeline_t;
+typedef _sg_sw_pipeline_t _sg_pipeline_t;
+
+typedef struct _sg_view_s {
+    _sg_slot_t slot;
+    _sg_view_common_t cmn;
+} _sg_sw_view_t;
+typedef _sg_sw_view_t _sg_view_t;
+
+// size of a rasterizer tile in pixels (must be a multiple of 4)
+#define _SG_SW_TILE_SIZE (64)
+// max number of rasterizer threads
+#define _SG_SW_MAX_THREADS (64)
+// size of the chunks in the per-flush memory arena
+#define _SG_SW_ARENA_CHUNK_SIZE (1<<20)
+// bin more than this number of bytes and the tiles will be rasterized before continuing
+#define _SG_SW_ARENA_FLUSH_THRESHOLD (64<<20)
+// number of entries in the post-transform vertex cache
+#define _SG_SW_VCACHE_SIZE (64)
+
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+    struct {
+        // per-rasterizer-thread counters: samples passed (occlusion) or fragment invocations (pipeline statistics)
+        uint64_t counts[_SG_SW_MAX_THREADS];
+        sg_pipeline_stats stats;    // pipeline statistics counted on the main thread
+    } sw;
+} _sg_sw_counter_t;
+typedef _sg_sw_counter_t _sg_counter_t;
+
+// a render target surface (color or depth)
+typedef struct {
+    uint8_t* pixels;
+    int row_pitch;
+    int bytes_per_pixel;
+    sg_pixel_format fmt;
+    bool normalized;        // true if blend inputs must be clamped to [range_min, 1]
+    float range_min;
+} _sg_sw_surface_t;
+
+// an image view snapshot used by texture sampling and storage images
+typedef struct {
+    _sg_image_t* img;
+    int mip_level;
+    int mip_level_count;
+    int slice;
+    int slice_count;
+} _sg_sw_image_binding_t;
+
+typedef struct {
+    _sg_sw_image_binding_t images[SG_MAX_VIEW_BINDSLOTS];
+    _sg_sampler_common_t samplers[SG_MAX_SAMPLER_BINDSLOTS];
+} _sg_sw_bindings_t;
+
+// snapshot of the render state needed for rasterization, captured at draw time
+typedef struct {
+    sg_sw_fragment_func fragment_func;
+    sg_sw_shader_context ctx;
+    _sg_sw_bindings_t bnd;
+    int num_varyings;
+    bool depth_test;
+    bool depth_write;
+    sg_compare_func depth_compare;
+    float depth_bias;
+    float depth_bias_slope_scale;
+    float depth_bias_clamp;
+    int num_colors;
+    sg_color_target_state colors[SG_MAX_COLOR_ATTACHMENTS];
+    float blend_color[4];
+    _sg_recti_t clip;   // intersection of viewport, scissor rect and render target
+    _sg_counter_t* occlusion_counter;   // active occlusion counter, or null
+    _sg_counter_t* stats_counter;       // active pipeline statistics counter, or null
+} _sg_sw_drawstate_t;
+
+// a clip space vertex
+typedef struct {
+    float pos[4];
+    float varyings[SG_SW_MAX_VARYINGS];
+} _sg_sw_vertex_t;
+
+// per-draw geometry processing state, lives in the backend state to avoid
+// a heap allocation per draw call
+typedef struct {
+    const _sg_pipeline_t* pip;
+    const _sg_shader_t* shd;
+    _sg_sw_drawstate_t* ds;
+    int num_varyings;
+    int base_instance;
+    // viewport transform
+    float vp_cx, vp_cy, vp_hw, vp_hh;
+    // guard band clip planes in NDC units
+    float gb_left, gb_right, gb_top, gb_bottom;
+    // post-transform vertex cache for indexed draws
+    int cache_tags[_SG_SW_VCACHE_SIZE];
+    _sg_sw_vertex_t cache[_SG_SW_VCACHE_SIZE];
+} _sg_sw_drawctx_t;
+
+typedef enum {
+    _SG_SW_PRIM_TRIANGLE,
+    _SG_SW_PRIM_LINE,
+    _SG_SW_PRIM_POINT,
+} _sg_sw_prim_type_t;
+
+// a setup primitive in a tile bin, the varyings follow the struct in memory
+typedef struct {
+    const _sg_sw_drawstate_t* ds;
+    _sg_sw_prim_type_t type;
+    bool front_facing;
+    _sg_recti_t bbox;           // in pixels, already clipped against ds->clip
+    // triangles: edge functions in 28.4 fixed point, E(x,y) = a*x + b*y + c
+    int32_t edge_a[3];
+    int32_t edge_b[3];
+    int64_t edge_c[3];
+    // triangles: plane equations for z, 1/w, b1/w1, b2/w2 as (value at origin, d/dx, d/dy),
+    // lines: start and end screen position, z and 1/w
+    float planes[4][3];
+    // varyings (with num_varyings floats each):
+    //   triangles: v0, v1-v0, v2-v0
+    //   lines: v0, v1-v0
+    //   points: v0
+} _sg_sw_prim_t;
+
+typedef struct {
+    const _sg_sw_prim_t** items;
+    int num;
+    int cap;
+} _sg_sw_bin_t;
+
+typedef struct _sg_sw_arena_chunk_s {
+    struct _sg_sw_arena_chunk_s* next;
+    size_t size;
+    size_t pos;
+} _sg_sw_arena_chunk_t;
+
+typedef struct {
+    _sg_sw_arena_chunk_t* first;
+    _sg_sw_arena_chunk_t* cur;
+    size_t used;
+} _sg_sw_arena_t;
+
+typedef void (*_sg_sw_job_func_t)(int item_index, int thread_index);
+
+typedef struct {
+    void* state;    // the sokol-gfx context the worker thread belongs to (_sg_state_t*)
+    int index;
+} _sg_sw_thread_args_t;
+
+typedef struct {
+    int num_threads;        // including the calling thread
+    #if defined(_SG_SW_PTHREADS)
+    pthread_t threads[_SG_SW_MAX_THREADS];
+    _sg_sw_thread_args_t thread_args[_SG_SW_MAX_THREADS];
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    #elif defined(_SG_SW_WIN32_THREADS)
+    HANDLE threads[_SG_SW_MAX_THREADS];
+    _sg_sw_thread_args_t thread_args[_SG_SW_MAX_THREADS];
+    SRWLOCK mutex;
+    CONDITION_VARIABLE work_cond;
+    CONDITION_VARIABLE done_cond;
+    #endif
+    bool quit;
+    uint32_t generation;
+    int num_finished;
+    _sg_sw_job_func_t func;
+    int num_items;
+    int next_item;
+} _sg_sw_threadpool_t;
+
+typedef struct {
+    uint32_t num_fragments;
+} _sg_sw_thread_stats_t;
+
+typedef struct {
+    _sg_sw_threadpool_t pool;
+    _sg_sw_thread_stats_t thread_stats[_SG_SW_MAX_THREADS];
+    float srgb_to_linear[256];
+    // current pass
+    struct {
+        bool valid;
+        int width;
+        int height;
+        int num_colors;
+        _sg_sw_surface_t colors[SG_MAX_COLOR_ATTACHMENTS];
+        _sg_sw_surface_t resolves[SG_MAX_COLOR_ATTACHMENTS];
+        _sg_sw_surface_t depth;
+        int tiles_x;
+        int tiles_y;
+        bool clear_pending;     // pass clear action not yet applied to tiles
+        sg_pass_action action;
+    } pass;
+    // internal depth buffer for swapchain passes
+    struct {
+        float* buf;
+        size_t size;
+    } swapchain_depth;
+    // current render state
+    struct {
+        _sg_pipeline_t* pip;
+        _sg_recti_t viewport;
+        _sg_recti_t scissor;
+        const uint8_t* vbs[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+        const uint8_t* ib;
+        _sg_sw_bindings_t bnd;
+        void* storage_buffers[SG_MAX_VIEW_BINDSLOTS];
+        int storage_buffer_sizes[SG_MAX_VIEW_BINDSLOTS];
+        struct {
+            uint8_t* ptr;
+            size_t size;
+            size_t capacity;
+            const uint8_t* buf_ptr; // non-null when bound with sg_apply_uniform_buffer()
+        } uniforms[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+        _sg_counter_t* occlusion_counter;   // active occlusion counter, or null
+        _sg_counter_t* stats_counter;       // active pipeline statistics counter, or null
+        _sg_sw_drawstate_t* ds;     // null if render state has changed since last draw
+    } cur;
+    _sg_sw_drawctx_t drawctx;   // reset at the start of each draw call
+    // tile bins and per-flush memory
+    _sg_sw_bin_t* bins;
+    int num_bins;
+    bool bins_dirty;
+    _sg_sw_arena_t arena;
+    // compute dispatch state
+    struct {
+        sg_sw_compute_func func;
+        const sg_sw_shader_context* ctx;
+        int num_groups[3];
+        int num_groups_total;
+        int groups_per_item;
+    } dispatch;
+} _sg_sw_backend_t;
+
+#elif defined(_SOKOL_ANY_GL)
+
+typedef enum {
+    _SG_GL_GPUDIRTY_VERTEXBUFFER = (1<<0),
+    _SG_GL_GPUDIRTY_INDEXBUFFER = (1<<1),
+    _SG_GL_GPUDIRTY_STORAGEBUFFER = (1<<2),
+    _SG_GL_GPUDIRTY_TEXTURE = (1<<3),
+    _SG_GL_GPUDIRTY_STORAGEIMAGE = (1<<4),
+    _SG_GL_GPUDIRTY_ATTACHMENT = (1<<5),
+    _SG_GL_GPUDIRTY_INDIRECT = (1<<6),
+    _SG_GL_GPUDIRTY_BUFFER_ALL = _SG_GL_GPUDIRTY_VERTEXBUFFER | _SG_GL_GPUDIRTY_INDEXBUFFER | _SG_GL_GPUDIRTY_STORAGEBUFFER | _SG_GL_GPUDIRTY_INDIRECT,
+    _SG_GL_GPUDIRTY_IMAGE_ALL = _SG_GL_GPUDIRTY_TEXTURE | _SG_GL_GPUDIRTY_STORAGEIMAGE | _SG_GL_GPUDIRTY_ATTACHMENT,
+} _sg_gl_gpudirty_t;
+
+typedef struct _sg_buffer_s {
+    _sg_slot_t slot;
+    _sg_buffer_common_t cmn;
+    struct {
+        GLuint buf[SG_NUM_INFLIGHT_FRAMES];
+        uint8_t* mapped[SG_NUM_INFLIGHT_FRAMES];    // only for persistently mapped stream buffers
+        uint32_t write_frame[SG_NUM_INFLIGHT_FRAMES]; // frame index + 1 of last write into mapped buffer (0 if never written)
+        uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_t flags
+        bool injected;  // if true, external buffers were injected with sg_buffer_desc.gl_buffers
+        bool persistent;    // if true, this is a persistently mapped stream buffer
+    } gl;
+} _sg_gl_buffer_t;
+typedef _sg_gl_buffer_t _sg_buffer_t;
+
+typedef struct _sg_image_s {
+    _sg_slot_t slot;
+    _sg_image_common_t cmn;
+    struct {
+        GLenum target;
+        GLuint tex[SG_NUM_INFLIGHT_FRAMES];
+        GLuint pbo[SG_NUM_INFLIGHT_FRAMES];         // only for stream images with persistently mapped upload buffers
+        uint8_t* pbo_mapped[SG_NUM_INFLIGHT_FRAMES];
+        uint32_t pbo_write_frame[SG_NUM_INFLIGHT_FRAMES]; // frame index + 1 of last write into pixel unpack buffer (0 if never written)
+        int pbo_size;
+        uint8_t gpu_dirty_flags; // combination of _sg_gl_gpudirty_flags
+        bool injected;  // if true, external textures were injected with sg_image_desc.gl_textures
+    } gl;
+} _sg_gl_image_t;
+typedef _sg_gl_image_t _sg_image_t;
+
+typedef struct _sg_sampler_s {
+    _sg_slot_t slot;
+    _sg_sampler_common_t cmn;
+    struct {
+        GLuint smp;
+        bool injected;  // true if external sampler was injects in sg_sampler_desc.gl_sampler
+    } gl;
+} _sg_gl_sampler_t;
+typedef _sg_gl_sampler_t _sg_sampler_t;
+
+typedef struct {
+    GLint gl_loc;
+    sg_uniform_type type;
+    uint16_t count;
+    uint16_t offset;
+} _sg_gl_uniform_t;
+
+typedef struct {
+    int num_uniforms;
+    _sg_gl_uniform_t uniforms[SG_MAX_UNIFORMBLOCK_MEMBERS];
+    bool glsl_block;    // a GLSL uniform block bound to binding point ub_slot (sg_shader_uniform_block.glsl_block_name)
+} _sg_gl_uniform_block_t;
+
+typedef struct {
+    _sg_str_t name;
+} _sg_gl_shader_attr_t;
+
+// GLSL names for looking up uniform- and sampler-locations after the shader program has been linked
+typedef struct {
+    const char* uniforms[SG_MAX_UNIFORMBLOCK_BINDSLOTS][SG_MAX_UNIFORMBLOCK_MEMBERS];
+    const char* ub_blocks[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    const char* tex_smps[SG_MAX_TEXTURE_SAMPLER_PAIRS];
+} _sg_gl_shader_names_t;
+
+// state of a shader program which is compiled and linked in the background
+typedef struct {
+    GLuint gl_shd[2];           // the compiled shader objects, needed for the compile log
+    _sg_gl_shader_names_t names;
+    char* strings;              // copy of the GLSL names, referenced by 'names'
+} _sg_gl_deferred_shader_t;
+
+typedef struct _sg_shader_s {
+    _sg_slot_t slot;
+    _sg_shader_common_t cmn;
+    struct {
+        GLuint prog;
+        _sg_gl_deferred_shader_t* deferred;     // only while compiling in the background
+        _sg_gl_shader_attr_t attrs[SG_MAX_VERTEX_ATTRIBUTES];
+        _sg_gl_uniform_block_t uniform_blocks[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+        uint8_t sbuf_binding[SG_MAX_VIEW_BINDSLOTS];
+        uint8_t simg_binding[SG_MAX_VIEW_BINDSLOTS];
+        int8_t tex_slot[SG_MAX_TEXTURE_SAMPLER_PAIRS]; // GL texture unit index
+    } gl;
+} _sg_gl_shader_t;
+typedef _sg_gl_shader_t _sg_shader_t;
+
+typedef struct {
+    int8_t vb_index;        // -1 if attr is not enabled
+    int8_t divisor;         // -1 if not initialized
+    uint8_t stride;
+    uint8_t size;
+    uint8_t normalized;
+    int offset;
+    GLenum type;
+    sg_shader_attr_base_type base_type;
+} _sg_gl_attr_t;
 
 typedef struct _sg_pipeline_s {
     _sg_slot_t slot;
@@ -6486,6 +8116,7 @@ typedef struct _sg_pipeline_s {
         sg_face_winding face_winding;
         int sample_count;
         bool alpha_to_coverage_enabled;
+        sg_pipeline_desc* deferred_desc;    // only while waiting for the shader to finish compiling
     } gl;
 } _sg_gl_pipeline_t;
 typedef _sg_gl_pipeline_t _sg_pipeline_t;
@@ -6501,6 +8132,24 @@ typedef struct _sg_view_s {
 } _sg_gl_view_t;
 typedef _sg_gl_view_t _sg_view_t;
 
+// number of GL query objects per sg_counter, results are read back with this latency
+#define _SG_GL_NUM_QUERY_SLOTS (4)
+// GL query objects per slot, pipeline statistics need one per counter
+#define _SG_GL_NUM_QUERY_COUNTERS (5)
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+    struct {
+        int num_counters;
+        GLenum targets[_SG_GL_NUM_QUERY_COUNTERS];
+        int cur_slot;
+        GLuint ids[_SG_GL_NUM_QUERY_SLOTS][_SG_GL_NUM_QUERY_COUNTERS];
+        bool pending[_SG_GL_NUM_QUERY_SLOTS];       // result not read back yet
+        uint32_t frame_index[_SG_GL_NUM_QUERY_SLOTS];
+    } gl;
+} _sg_gl_counter_t;
+typedef _sg_gl_counter_t _sg_counter_t;
+
 typedef struct {
     _sg_gl_attr_t gl_attr;
     GLuint gl_vbuf;
@@ -6530,11 +8179,18 @@ typedef struct {
     GLuint vertex_buffer;
     GLuint index_buffer;
     GLuint storage_buffer;  // general bind point
+    GLuint uniform_buffer;  // general bind point
+    GLuint dispatch_indirect_buffer;
     GLuint storage_buffers[_SG_GL_MAX_SBUF_BINDINGS];
     int storage_buffer_offsets[_SG_GL_MAX_SBUF_BINDINGS];
+    int storage_buffer_sizes[_SG_GL_MAX_SBUF_BINDINGS];
+    GLuint uniform_buffers[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    int uniform_buffer_offsets[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
+    int uniform_buffer_sizes[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
     GLuint stored_vertex_buffer;
     GLuint stored_index_buffer;
     GLuint stored_storage_buffer;
+    GLuint stored_uniform_buffer;
     GLuint prog;
     _sg_gl_cache_texture_sampler_bind_slot texture_samplers[_SG_GL_MAX_TEX_SMP_BINDINGS];
     _sg_gl_cache_texture_sampler_bind_slot stored_texture_sampler;
@@ -6545,11 +8201,51 @@ typedef struct {
     _sg_sref_t cur_pip;
 } _sg_gl_cache_t;
 
+// vertex-array-object cache, keyed by pipeline and vertex buffer bindings
+typedef struct {
+    uint32_t pip_id;
+    GLuint vbufs[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+    int vb_offsets[SG_MAX_VERTEXBUFFER_BINDSLOTS];
+} _sg_gl_vao_cache_key_t;
+
+typedef struct {
+    _sg_gl_vao_cache_key_t key;
+    uint64_t hash;
+    GLuint vao;             // 0 if cache item is unused
+    GLuint index_buffer;    // GL_ELEMENT_ARRAY_BUFFER binding is part of the VAO state
+    uint64_t last_used;     // for LRU eviction
+    int next;               // next item in hash bucket, or -1
+} _sg_gl_vao_cache_item_t;
+
+// one fence per frame for persistently mapped stream buffers
+#define _SG_GL_NUM_FRAME_FENCES (4)
+typedef struct {
+    GLsync syncs[_SG_GL_NUM_FRAME_FENCES];
+    uint32_t frame_index[_SG_GL_NUM_FRAME_FENCES];
+    uint32_t num_completed_frames;  // all frames with a lower frame index have finished on the GPU
+    long num_buffers;               // number of alive persistently mapped buffers (including image upload buffers), atomic with loader threads
+} _sg_gl_frame_fences_t;
+
+typedef struct {
+    int num_items;
+    _sg_gl_vao_cache_item_t* items;
+    int num_buckets;        // power of 2
+    int* buckets;           // first item index in bucket, or -1
+    int cur_item;           // currently bound cache item, or -1 if the global VAO is bound
+    GLuint global_index_buffer;
+    uint64_t tick;
+} _sg_gl_vao_cache_t;
+
 typedef struct {
     bool valid;
-    GLuint vao;     // global mutated vertex-array-object
+    GLuint vao;     // global mutated vertex-array-object (used when the VAO cache is disabled)
     GLuint fb;      // global mutated framebuffer
     _sg_gl_cache_t cache;
+    _sg_gl_vao_cache_t vao_cache;
+    bool multi_bind;        // sg_features.gl_multi_bind && !sg_desc.gl.disable_multi_bind
+    bool persistent_stream_buffers;
+    bool invalidate_framebuffer;    // glInvalidateFramebuffer() is available (GLES3, GL 4.3 or ARB_invalidate_subdata)
+    _sg_gl_frame_fences_t fences;
     bool ext_anisotropic;
     GLint max_anisotropy;
     sg_store_action color_store_actions[SG_MAX_COLOR_ATTACHMENTS];
@@ -6654,6 +8350,12 @@ typedef struct _sg_view_s {
 } _sg_d3d11_view_t;
 typedef _sg_d3d11_view_t _sg_view_t;
 
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+} _sg_d3d11_counter_t;
+typedef _sg_d3d11_counter_t _sg_counter_t;
+
 typedef struct {
     bool valid;
     ID3D11Device* dev;
@@ -6780,6 +8482,12 @@ typedef struct _sg_view_s {
 } _sg_mtl_view_t;
 typedef _sg_mtl_view_t _sg_view_t;
 
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+} _sg_mtl_counter_t;
+typedef _sg_mtl_counter_t _sg_counter_t;
+
 // resource binding state cache
 //
 //  NOTE: reserved buffer bindslot ranges:
@@ -6829,10 +8537,16 @@ typedef struct {
 typedef struct {
     bool valid;
     bool use_shared_storage_mode;
+    bool memoryless_attachments;    // MTLStorageModeMemoryless is supported (Apple GPUs only)
     uint32_t cur_frame_rotate_index;
     int ub_size;
     int cur_ub_offset;
     uint8_t* cur_ub_base_ptr;
+    // per-stage bitmasks of uniform buffer slots which have been bound to a user buffer
+    // with sg_apply_uniform_buffer(), the global uniform buffer must be rebound there
+    uint32_t cur_vs_ext_ubs;
+    uint32_t cur_fs_ext_ubs;
+    uint32_t cur_cs_ext_ubs;
     _sg_mtl_cache_t cache;
     _sg_mtl_idpool_t idpool;
     dispatch_semaphore_t sem;
@@ -6930,6 +8644,12 @@ typedef struct _sg_view_s {
 } _sg_wgpu_view_t;
 typedef _sg_wgpu_view_t _sg_view_t;
 
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+} _sg_wgpu_counter_t;
+typedef _sg_wgpu_counter_t _sg_counter_t;
+
 // a pool of per-frame uniform buffers
 typedef struct {
     uint32_t num_bytes;
@@ -7015,6 +8735,8 @@ typedef struct {
 #define _SG_VK_NUM_DESCRIPTORSETS (2) // 0: uniforms, 1: images, samplers, storage buffers, storage images
 #define _SG_VK_UB_DESCRIPTORSET_INDEX (0)
 #define _SG_VK_VIEW_SMP_DESCRIPTORSET_INDEX (1)
+#define _SG_VK_BINDLESS_DESCRIPTORSET_INDEX (2)    // only in pipeline layouts of bindless shaders
+#define _SG_VK_NUM_BINDLESS_HEAP_BINDINGS (3)   // 0: textures, 1: storage buffers, 2: samplers
 #define _SG_VK_MAX_UB_DESCRIPTORSET_ENTRIES (SG_MAX_UNIFORMBLOCK_BINDSLOTS)
 #define _SG_VK_MAX_UB_DESCRIPTORSET_SLOTS (2 * SG_MAX_UNIFORMBLOCK_BINDSLOTS)
 #define _SG_VK_MAX_VIEW_SMP_DESCRIPTORSET_ENTRIES (SG_MAX_VIEW_BINDSLOTS + SG_MAX_SAMPLER_BINDSLOTS)
@@ -7025,6 +8747,7 @@ typedef enum {
     _SG_VK_MEMTYPE_STORAGE_BUFFER,
     _SG_VK_MEMTYPE_GENERIC_BUFFER,
     _SG_VK_MEMTYPE_IMAGE,
+    _SG_VK_MEMTYPE_TRANSIENT_IMAGE,
     _SG_VK_MEMTYPE_STAGING_COPY,
     _SG_VK_MEMTYPE_STAGING_STREAM,
     _SG_VK_MEMTYPE_UNIFORMS,
@@ -7036,14 +8759,26 @@ typedef void (*_sg_vk_delete_queue_destructor_t)(void* obj);
 typedef struct {
     _sg_vk_delete_queue_destructor_t destructor;
     void* obj;
+    uint64_t frame_value;       // graphics timeline value after which the object is no longer used, 0 until stamped
+    uint64_t compute_value;     // compute timeline value after which the object is no longer used
 } _sg_vk_delete_queue_item_t;
 
+// a FIFO ring of objects waiting for the GPU, the newest num_pending items
+// are stamped with timeline values when the current frame is submitted
 typedef struct {
-    uint32_t index;
+    uint32_t head;
+    uint32_t count;
+    uint32_t num_pending;
     uint32_t num;
     _sg_vk_delete_queue_item_t* items;
 } _sg_vk_delete_queue_t;
 
+// a timeline semaphore, each submission signals the next value
+typedef struct {
+    VkSemaphore sem;
+    uint64_t value;     // last submitted value
+} _sg_vk_timeline_t;
+
 typedef enum {
     _SG_VK_ACCESS_NONE = (0), // initial state for new resources
     _SG_VK_ACCESS_STAGING = (1<<0),
@@ -7059,6 +8794,8 @@ typedef enum {
     _SG_VK_ACCESS_STENCIL_ATTACHMENT = (1<<10),
     _SG_VK_ACCESS_DISCARD = (1<<11),    // in combination with attachments
     _SG_VK_ACCESS_PRESENT = (1<<12),
+    _SG_VK_ACCESS_INDIRECT = (1<<13),   // sg_dispatch_indirect() argument buffer
+    _SG_VK_ACCESS_UNIFORMBUFFER = (1<<14),  // sg_apply_uniform_buffer() source buffer
 } _sg_vk_access_bits_t;
 typedef int _sg_vk_access_t;
 
@@ -7068,8 +8805,9 @@ typedef struct _sg_buffer_s {
     struct {
         VkBuffer buf;
         VkDeviceMemory mem;
-        VkDeviceAddress dev_addr;   // only valid for storage buffers
+        VkDeviceAddress dev_addr;   // only valid for storage and uniform buffers
         _sg_vk_access_t cur_access;
+        uint64_t async_compute_value;   // compute timeline value of the last async compute pass using the buffer
     } vk;
 } _sg_vk_buffer_t;
 typedef _sg_vk_buffer_t _sg_buffer_t;
@@ -7081,6 +8819,7 @@ typedef struct _sg_image_s {
         VkImage img;
         VkDeviceMemory mem;
         _sg_vk_access_t cur_access;
+        uint64_t async_compute_value;   // compute timeline value of the last async compute pass using the image
     } vk;
 } _sg_vk_image_t;
 typedef _sg_vk_image_t _sg_image_t;
@@ -7090,6 +8829,7 @@ typedef struct _sg_sampler_s {
     _sg_sampler_common_t cmn;
     struct {
         VkSampler smp;
+        int bindless_index;     // index into the bindless descriptor heap, or 0
         size_t descriptor_size;
         uint8_t descriptor_data[_SG_VK_MAX_DESCRIPTOR_DATA_SIZE];
     } vk;
@@ -7113,7 +8853,10 @@ typedef struct _sg_shader_s {
         VkDescriptorSetLayout view_smp_dsl;
         VkDeviceSize view_smp_dset_size;
         VkPipelineLayout pip_layout;
+        VkShaderStageFlags push_constant_stages;    // 0 if the shader has no push-constant block
+        bool bindless;          // pipeline layout has the bindless descriptor heap at set 2
         // indexed by sokol-gfx bind-slot
+        bool ub_push_constant[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
         uint8_t ub_set0_bnd_n[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
         uint8_t view_set1_bnd_n[SG_MAX_VIEW_BINDSLOTS];
         uint8_t smp_set1_bnd_n[SG_MAX_SAMPLER_BINDSLOTS];
@@ -7130,6 +8873,7 @@ typedef struct _sg_pipeline_s {
     _sg_pipeline_common_t cmn;
     struct {
         VkPipeline pip;
+        struct _sg_vk_compile_job_s* job;   // only while compiling in the background
     } vk;
 } _sg_vk_pipeline_t;
 typedef _sg_vk_pipeline_t _sg_pipeline_t;
@@ -7139,12 +8883,25 @@ typedef struct _sg_view_s {
     _sg_view_common_t cmn;
     struct {
         VkImageView img_view;
+        int bindless_index;     // index into the bindless descriptor heap, or 0
         size_t descriptor_size;
         uint8_t descriptor_data[_SG_VK_MAX_DESCRIPTOR_DATA_SIZE];
     } vk;
 } _sg_vk_view_t;
 typedef _sg_vk_view_t _sg_view_t;
 
+typedef struct _sg_counter_s {
+    _sg_slot_t slot;
+    _sg_counter_common_t cmn;
+    struct {
+        VkQueryPool pool;                           // one query per in-flight frame
+        int cur_slot;
+        bool pending[SG_NUM_INFLIGHT_FRAMES];       // result not read back yet
+        uint32_t frame_index[SG_NUM_INFLIGHT_FRAMES];
+    } vk;
+} _sg_vk_counter_t;
+typedef _sg_vk_counter_t _sg_counter_t;
+
 // a double-buffer cpu-write / gpu-read buffer
 #define _SG_VK_SHARED_BUFFER_OVERFLOW_RESULT (0xFFFFFFFF)
 typedef struct {
@@ -7163,6 +8920,92 @@ typedef struct {
     } slots[SG_NUM_INFLIGHT_FRAMES];
 } _sg_vk_shared_buffer_t;
 
+// the copy-staging buffer is split into a ring of segments, each segment
+// is filled and recorded by the CPU while older segments are in flight
+#define _SG_VK_NUM_STAGING_SEGMENTS (4)
+typedef struct {
+    VkCommandBuffer cmd_buf;
+    uint32_t offset;        // start of segment in staging buffer
+    uint32_t pos;           // current fill position relative to segment start
+    uint64_t timeline_value;    // != 0 while the segment is in flight
+    bool recording;         // true between first copy and submit
+} _sg_vk_staging_segment_t;
+
+// the graphics command buffer of a frame is split into segments after async
+// compute passes, so that only the segments which consume async compute
+// results need to wait for the compute queue
+#define _SG_VK_MAX_CMDBUF_SEGMENTS (8)
+typedef struct {
+    VkCommandBuffer cmd_buf;
+    uint64_t wait_compute_value;    // != 0 if the segment waits for the compute timeline
+} _sg_vk_cmdbuf_segment_t;
+
+// optional async compute queue
+typedef struct {
+    bool valid;                 // true if a compute queue was provided in sg_environment.vulkan
+    bool recording;             // true while recording an async compute pass
+    bool concurrent;            // true if resources need VK_SHARING_MODE_CONCURRENT
+    VkQueue queue;
+    uint32_t queue_family_index;
+    uint32_t queue_family_indices[2];   // graphics and compute queue family for concurrent sharing
+    VkCommandPool cmd_pool;
+    VkCommandBuffer cmd_buf;            // current frame's compute command buffer, or 0
+    VkCommandBuffer gfx_cmd_buf;        // the graphics command buffer while recording an async compute pass
+    _sg_vk_timeline_t timeline;         // signalled by the compute queue
+    uint64_t compute_value;             // compute timeline value of the current frame's async compute work
+    uint64_t waited_compute_value;      // highest compute timeline value waited for by the graphics queue
+} _sg_vk_async_compute_t;
+
+// optional global descriptor heap for bindless resource access, a persistently
+// mapped descriptor buffer with one descriptor array per binding, indices
+// of destroyed views and samplers are released via the delete queue
+typedef struct {
+    bool valid;
+    VkDescriptorSetLayout dsl;
+    VkBuffer buf;
+    VkDeviceMemory mem;
+    VkDeviceAddress dev_addr;
+    uint8_t* mem_ptr;
+    VkDeviceSize binding_offsets[_SG_VK_NUM_BINDLESS_HEAP_BINDINGS];
+    _sg_pool_t view_indices;
+    _sg_pool_t smp_indices;
+} _sg_vk_bindless_heap_t;
+
+typedef enum {
+    _SG_VK_COMPILEJOB_QUEUED,
+    _SG_VK_COMPILEJOB_RUNNING,
+    _SG_VK_COMPILEJOB_DONE,
+} _sg_vk_compile_job_state_t;
+
+// a pipeline which is created on the compiler thread
+typedef struct _sg_vk_compile_job_s {
+    struct _sg_vk_compile_job_s* next;
+    _sg_pipeline_t* pip;
+    sg_pipeline_desc desc;      // desc.label points to a copy after the job struct
+    _sg_vk_compile_job_state_t state;
+    sg_resource_state result;
+} _sg_vk_compile_job_t;
+
+// background thread for vkCreateGraphicsPipelines() and vkCreateComputePipelines()
+typedef struct {
+    bool valid;
+    #if defined(_SG_VK_PTHREADS)
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+    #elif defined(_SG_VK_WIN32_THREADS)
+    HANDLE thread;
+    SRWLOCK mutex;
+    CONDITION_VARIABLE work_cond;
+    CONDITION_VARIABLE done_cond;
+    #endif
+    bool quit;
+    int num_busy;               // number of queued and running jobs
+    _sg_vk_compile_job_t* head; // queued jobs in FIFO order
+    _sg_vk_compile_job_t* tail;
+} _sg_vk_compiler_t;
+
 typedef struct {
     bool valid;
     VkInstance instance;
@@ -7185,26 +9028,40 @@ typedef struct {
     } ext;
 
     uint32_t frame_slot;
+    _sg_vk_timeline_t timeline;     // signalled by each submission to the graphics queue
+    _sg_vk_delete_queue_t delete_queue;
     struct {
         VkCommandPool cmd_pool;
         VkCommandBuffer cmd_buf;
         VkCommandBuffer stream_cmd_buf;
+        uint32_t num_segments;
+        uint32_t swapchain_segment;     // segment index of the first swapchain pass
+        bool swapchain_segment_valid;
+        uint32_t segment_num_passes;    // number of passes in the current segment
+        _sg_vk_cmdbuf_segment_t segments[_SG_VK_MAX_CMDBUF_SEGMENTS];
         struct {
-            VkFence fence;
-            VkCommandBuffer command_buffer;
+            uint64_t timeline_value;    // graphics timeline value signalled by the frame submitted in this slot
+            uint32_t frame_index;       // sg frame index of the frame submitted in this slot
+            uint64_t compute_value;     // compute timeline value submitted in this frame slot, or 0
+            VkCommandBuffer command_buffers[_SG_VK_MAX_CMDBUF_SEGMENTS];
             VkCommandBuffer stream_command_buffer;
-            _sg_vk_delete_queue_t delete_queue;
+            VkCommandBuffer compute_command_buffer;
         } slot[SG_NUM_INFLIGHT_FRAMES];
     } frame;
+    _sg_vk_async_compute_t compute;
     // staging system
     struct {
-        // staging system for immutable and dynamic resources, generally causes a stall
+        // staging ring for immutable and dynamic resources, submitted in batches
         struct {
             VkCommandPool cmd_pool;
-            VkCommandBuffer cmd_buf;
             uint32_t size;
+            uint32_t segment_size;
             VkBuffer buf;
             VkDeviceMemory mem;
+            uint8_t* mem_ptr;       // persistently mapped
+            uint32_t cur_segment;
+            uint64_t frame_time_ns; // CPU time spent in staging copies this frame
+            _sg_vk_staging_segment_t segments[_SG_VK_NUM_STAGING_SEGMENTS];
         } copy;
         // staging buffer for per-frame streaming updates
         _sg_vk_shared_buffer_t stream;
@@ -7220,6 +9077,7 @@ typedef struct {
     } uniforms;
     // resource binding system (using descriptor buffers)
     _sg_vk_shared_buffer_t bind;
+    _sg_vk_bindless_heap_t bindless;
     // hazard tracking system for buffers and images
     struct {
         _sg_track_t buffers;
@@ -7229,6 +9087,16 @@ typedef struct {
     VkPhysicalDeviceProperties2 dev_props;
     VkPhysicalDeviceDescriptorBufferPropertiesEXT descriptor_buffer_props;
     VkPhysicalDeviceFeatures2 dev_features;
+    _sg_vk_compiler_t compiler;
+    #if defined(SOKOL_LOADER_THREADS)
+    // serializes staging uploads and queue submits with loader threads, this is a
+    // mutex instead of a spinlock because it may be contended for a whole upload
+    #if defined(_SG_VK_PTHREADS)
+    pthread_mutex_t queue_mutex;
+    #elif defined(_SG_VK_WIN32_THREADS)
+    SRWLOCK queue_mutex;
+    #endif
+    #endif
 } _sg_vk_backend_t;
 
 #endif // SOKOL_VULKAN
@@ -7243,12 +9111,14 @@ typedef struct _sg_pools_s {
     _sg_pool_t shader_pool;
     _sg_pool_t pipeline_pool;
     _sg_pool_t view_pool;
+    _sg_pool_t counter_pool;
     _sg_buffer_t* buffers;
     _sg_image_t* images;
     _sg_sampler_t* samplers;
     _sg_shader_t* shaders;
     _sg_pipeline_t* pipelines;
     _sg_view_t* views;
+    _sg_counter_t* counters;
 } _sg_pools_t;
 
 typedef struct {
@@ -7257,6 +9127,54 @@ typedef struct {
     sg_commit_listener* items;
 } _sg_commit_listeners_t;
 
+// ring buffer of per-frame stats for sg_query_stats_history()
+typedef struct {
+    int size;           // max number of recorded frames (sg_desc.stats_history_size)
+    int num_frames;     // number of valid frames in the ring buffer
+    int pos;            // next write position
+    sg_frame_stats* frames;
+    uint32_t* scratch;  // size items, used for sorting in sg_query_stats_history()
+    uint64_t last_commit_time_ns;
+} _sg_stats_history_t;
+
+// per-pass stats are recorded as difference of the frame stats between begin- and end-pass
+typedef struct {
+    bool active;
+    uint64_t begin_time_ns;
+    sg_pass_stats begin;
+} _sg_pass_stats_tracker_t;
+
+#if defined(SOKOL_LOADER_THREADS)
+// a resource initialized on a loader thread, waiting for publication in sg_commit()
+typedef struct {
+    _sg_slot_t* slot;
+    uint32_t id;
+    #if defined(_SOKOL_ANY_GL)
+    GLsync gl_sync;     // signalled when the loader thread's GL commands have completed
+    #endif
+} _sg_pending_resource_t;
+
+typedef struct {
+    const void* render_thread;      // address of _sg_thread_marker on the render thread, see _sg_loader_claim_render_thread()
+    _sg_spinlock_t lock;            // protects the pending resource queue
+    int num_pending;
+    int max_pending;                // the sum of all pool sizes, each slot can only be pending once
+    _sg_pending_resource_t* pending;
+} _sg_loader_t;
+#endif
+
+// a shader or pipeline which is compiling in the background, polled in sg_commit()
+typedef struct {
+    uint32_t id;
+    bool is_pipeline;
+} _sg_compile_item_t;
+
+typedef struct {
+    int num_pending;
+    int max_pending;    // shader pool size + pipeline pool size
+    _sg_compile_item_t* pending;
+} _sg_compile_queue_t;
+
 // resolved pass attachments struct
 typedef struct {
     bool empty;
@@ -7296,6 +9214,7 @@ typedef struct {
         bool valid;
         bool in_pass;
         bool is_compute;
+        uint32_t counter_ids[_SG_COUNTERTYPE_NUM];  // the currently active counter per type (between sg_begin_counter() and sg_end_counter())
         _sg_dimi_t dim;
         sg_attachments atts;
         sg_pass_action action;
@@ -7307,6 +9226,7 @@ typedef struct {
         } swapchain;
     } cur_pass;
     _sg_pipeline_ref_t cur_pip;
+    bool cur_pip_compiling;     // applied pipeline is still compiling, skip draws until next sg_apply_pipeline()
     bool next_draw_valid;
     bool use_indexed_draw;
     bool use_instanced_draw;
@@ -7322,8 +9242,12 @@ typedef struct {
     _sg_pixelformat_info_t formats[_SG_PIXELFORMAT_NUM];
     bool stats_enabled;
     sg_stats stats;
+    _sg_stats_history_t stats_history;
+    _sg_pass_stats_tracker_t pass_stats;
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_backend_t gl;
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_backend_t sw;
     #elif defined(SOKOL_METAL)
     _sg_mtl_backend_t mtl;
     #elif defined(SOKOL_D3D11)
@@ -7336,9 +9260,49 @@ typedef struct {
     #if defined(SOKOL_TRACE_HOOKS)
     sg_trace_hooks hooks;
     #endif
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_loader_t loader;
+    #endif
+    _sg_compile_queue_t compile;
     _sg_commit_listeners_t commit_listeners;
 } _sg_state_t;
+
+#if defined(SOKOL_MULTI_CONTEXT) || defined(SOKOL_LOADER_THREADS)
+    #if defined(_MSC_VER)
+        #define _SG_THREAD_LOCAL __declspec(thread)
+        #include <intrin.h>
+    #else
+        #define _SG_THREAD_LOCAL __thread
+    #endif
+#endif
+
+#if defined(SOKOL_LOADER_THREADS)
+    // the address of this variable identifies the calling thread
+    static _SG_THREAD_LOCAL int _sg_thread_marker;
+    #if defined(SOKOL_DEBUG)
+    // validation may run on loader threads, so the validation error is tracked per thread
+    static _SG_THREAD_LOCAL sg_log_item _sg_thread_validate_error;
+    #define _SG_VALIDATE_ERROR _sg_thread_validate_error
+    #endif
+#elif defined(SOKOL_DEBUG)
+    #define _SG_VALIDATE_ERROR _sg.validate_error
+#endif
+
+#define _SG_DEFAULT_CONTEXT_ID (1<<_SG_SLOT_SHIFT)
+#if defined(SOKOL_MULTI_CONTEXT)
+    // all sokol-gfx code goes through the calling thread's current context
+    static _sg_state_t _sg_default_state;
+    static _SG_THREAD_LOCAL _sg_state_t* _sg_cur_state = &_sg_default_state;
+    #define _sg (*_sg_cur_state)
+    // context slots, slot 0 is the default context
+    typedef struct {
+        _sg_state_t* state;     // null if the slot is free, claimed with an atomic compare-exchange
+        uint32_t id;            // the last id handed out for this slot
+    } _sg_context_slot_t;
+    static _sg_context_slot_t _sg_contexts[SG_MAX_CONTEXTS] = { { &_sg_default_state, _SG_DEFAULT_CONTEXT_ID } };
+#else
 static _sg_state_t _sg;
+#endif
 
 // ██       ██████   ██████   ██████  ██ ███    ██  ██████
 // ██      ██    ██ ██       ██       ██ ████   ██ ██
@@ -7360,7 +9324,7 @@ static const char* _sg_log_messages[] = {
 #define _SG_WARN(code) _sg_log(SG_LOGITEM_ ##code, 2, 0, __LINE__)
 #define _SG_INFO(code) _sg_log(SG_LOGITEM_ ##code, 3, 0, __LINE__)
 #define _SG_LOGMSG(code,msg) _sg_log(SG_LOGITEM_ ##code, 3, msg, __LINE__)
-#define _SG_VALIDATE(cond,code) if (!(cond)){ _sg.validate_error = SG_LOGITEM_ ##code; _sg_log(SG_LOGITEM_ ##code, 1, 0, __LINE__); }
+#define _SG_VALIDATE(cond,code) if (!(cond)){ _SG_VALIDATE_ERROR = SG_LOGITEM_ ##code; _sg_log(SG_LOGITEM_ ##code, 1, 0, __LINE__); }
 
 static void _sg_log(sg_log_item log_item, uint32_t log_level, const char* msg, uint32_t line_nr) {
     if (_sg.desc.logger.func) {
@@ -7477,6 +9441,33 @@ _SOKOL_PRIVATE void _sg_strcpy(_sg_str_t* dst, const char* src) {
 // ██       ██████   ██████  ███████
 //
 // >>pool
+#if defined(SOKOL_LOADER_THREADS)
+_SOKOL_PRIVATE void _sg_spinlock_lock(_sg_spinlock_t* lock) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        while (0 != _InterlockedExchange(&lock->locked, 1)) {
+            while (0 != *(volatile long*)&lock->locked) { }
+        }
+    #else
+        while (0 != __atomic_exchange_n(&lock->locked, 1, __ATOMIC_ACQUIRE)) {
+            while (0 != __atomic_load_n(&lock->locked, __ATOMIC_RELAXED)) { }
+        }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_spinlock_unlock(_sg_spinlock_t* lock) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        _InterlockedExchange(&lock->locked, 0);
+    #else
+        __atomic_store_n(&lock->locked, 0, __ATOMIC_RELEASE);
+    #endif
+}
+
+// true if the calling thread isn't the thread which called sg_setup()
+_SOKOL_PRIVATE bool _sg_on_loader_thread(void) {
+    return _sg.loader.render_thread != (const void*)&_sg_thread_marker;
+}
+#endif
+
 _SOKOL_PRIVATE void _sg_pool_init(_sg_pool_t* pool, int num) {
     SOKOL_ASSERT(pool && (num >= 1));
     // slot 0 is reserved for the 'invalid id', so bump the pool size by 1
@@ -7508,20 +9499,28 @@ _SOKOL_PRIVATE void _sg_pool_discard(_sg_pool_t* pool) {
 _SOKOL_PRIVATE int _sg_pool_alloc_index(_sg_pool_t* pool) {
     SOKOL_ASSERT(pool);
     SOKOL_ASSERT(pool->free_queue);
+    int slot_index = _SG_INVALID_SLOT_INDEX;
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_spinlock_lock(&pool->lock);
+    #endif
     if (pool->queue_top > 0) {
-        int slot_index = pool->free_queue[--pool->queue_top];
+        slot_index = pool->free_queue[--pool->queue_top];
         SOKOL_ASSERT((slot_index > 0) && (slot_index < pool->size));
-        return slot_index;
-    } else {
-        // pool exhausted
-        return _SG_INVALID_SLOT_INDEX;
     }
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_spinlock_unlock(&pool->lock);
+    #endif
+    // NOTE: returns _SG_INVALID_SLOT_INDEX if the pool is exhausted
+    return slot_index;
 }
 
 _SOKOL_PRIVATE void _sg_pool_free_index(_sg_pool_t* pool, int slot_index) {
     SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < pool->size));
     SOKOL_ASSERT(pool);
     SOKOL_ASSERT(pool->free_queue);
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_spinlock_lock(&pool->lock);
+    #endif
     SOKOL_ASSERT(pool->queue_top < pool->size);
     #ifdef SOKOL_DEBUG
     // debug check against double-free
@@ -7531,6 +9530,38 @@ _SOKOL_PRIVATE void _sg_pool_free_index(_sg_pool_t* pool, int slot_index) {
     #endif
     pool->free_queue[pool->queue_top++] = slot_index;
     SOKOL_ASSERT(pool->queue_top <= (pool->size-1));
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_spinlock_unlock(&pool->lock);
+    #endif
+}
+
+// the resource state as seen by resource initialization, on loader threads this includes
+// resources initialized on the same thread which haven't been published yet
+_SOKOL_PRIVATE sg_resource_state _sg_slot_init_state(const _sg_slot_t* slot) {
+    SOKOL_ASSERT(slot);
+    #if defined(SOKOL_LOADER_THREADS)
+    if ((slot->state == SG_RESOURCESTATE_ALLOC) && (slot->pending_state != SG_RESOURCESTATE_INITIAL) && _sg_on_loader_thread()) {
+        return slot->pending_state;
+    }
+    #endif
+    return slot->state;
+}
+
+// true if shaders and pipelines should be compiled in the background,
+// resources initialized on loader threads are always compiled synchronously
+_SOKOL_PRIVATE bool _sg_compile_async(void) {
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        return false;
+    }
+    #endif
+    return _sg.desc.parallel_shader_compile && _sg.features.parallel_shader_compile;
+}
+
+// a shader or pipeline which is compiling in the background counts as initialized
+_SOKOL_PRIVATE bool _sg_slot_inited(const _sg_slot_t* slot) {
+    const sg_resource_state state = _sg_slot_init_state(slot);
+    return slot->compiling || (state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED);
 }
 
 _SOKOL_PRIVATE void _sg_slot_reset(_sg_slot_t* slot) {
@@ -7572,6 +9603,7 @@ _SOKOL_PRIVATE void _sg_reset_shader_to_alloc_state(_sg_shader_t* shd) {
     shd->slot = slot;
     shd->slot.uninit_count += 1;
     shd->slot.state = SG_RESOURCESTATE_ALLOC;
+    shd->slot.compiling = false;
 }
 
 _SOKOL_PRIVATE void _sg_reset_pipeline_to_alloc_state(_sg_pipeline_t* pip) {
@@ -7581,6 +9613,7 @@ _SOKOL_PRIVATE void _sg_reset_pipeline_to_alloc_state(_sg_pipeline_t* pip) {
     pip->slot = slot;
     pip->slot.uninit_count += 1;
     pip->slot.state = SG_RESOURCESTATE_ALLOC;
+    pip->slot.compiling = false;
 }
 
 _SOKOL_PRIVATE void _sg_reset_view_to_alloc_state(_sg_view_t* view) {
@@ -7592,6 +9625,15 @@ _SOKOL_PRIVATE void _sg_reset_view_to_alloc_state(_sg_view_t* view) {
     view->slot.state = SG_RESOURCESTATE_ALLOC;
 }
 
+_SOKOL_PRIVATE void _sg_reset_counter_to_alloc_state(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    _sg_slot_t slot = ctr->slot;
+    _sg_clear(ctr, sizeof(*ctr));
+    ctr->slot = slot;
+    ctr->slot.uninit_count += 1;
+    ctr->slot.state = SG_RESOURCESTATE_ALLOC;
+}
+
 _SOKOL_PRIVATE void _sg_setup_pools(_sg_pools_t* p, const sg_desc* desc) {
     SOKOL_ASSERT(p);
     SOKOL_ASSERT(desc);
@@ -7625,16 +9667,23 @@ _SOKOL_PRIVATE void _sg_setup_pools(_sg_pools_t* p, const sg_desc* desc) {
     _sg_pool_init(&p->view_pool, desc->view_pool_size);
     size_t view_pool_byte_size = sizeof(_sg_view_t) * (size_t)p->view_pool.size;
     p->views = (_sg_view_t*) _sg_malloc_clear(view_pool_byte_size);
+
+    SOKOL_ASSERT((desc->counter_pool_size > 0) && (desc->counter_pool_size < _SG_MAX_POOL_SIZE));
+    _sg_pool_init(&p->counter_pool, desc->counter_pool_size);
+    size_t counter_pool_byte_size = sizeof(_sg_counter_t) * (size_t)p->counter_pool.size;
+    p->counters = (_sg_counter_t*) _sg_malloc_clear(counter_pool_byte_size);
 }
 
 _SOKOL_PRIVATE void _sg_discard_pools(_sg_pools_t* p) {
     SOKOL_ASSERT(p);
+    _sg_free(p->counters);   p->counters = 0;
     _sg_free(p->views);     p->views = 0;
     _sg_free(p->pipelines); p->pipelines = 0;
     _sg_free(p->shaders);   p->shaders = 0;
     _sg_free(p->samplers);  p->samplers = 0;
     _sg_free(p->images);    p->images = 0;
     _sg_free(p->buffers);   p->buffers = 0;
+    _sg_pool_discard(&p->counter_pool);
     _sg_pool_discard(&p->view_pool);
     _sg_pool_discard(&p->pipeline_pool);
     _sg_pool_discard(&p->shader_pool);
@@ -7715,6 +9764,13 @@ _SOKOL_PRIVATE _sg_view_t* _sg_view_at(uint32_t view_id) {
     return &_sg.pools.views[slot_index];
 }
 
+_SOKOL_PRIVATE _sg_counter_t* _sg_counter_at(uint32_t ctr_id) {
+    SOKOL_ASSERT(SG_INVALID_ID != ctr_id);
+    int slot_index = _sg_slot_index(ctr_id);
+    SOKOL_ASSERT((slot_index > _SG_INVALID_SLOT_INDEX) && (slot_index < _sg.pools.counter_pool.size));
+    return &_sg.pools.counters[slot_index];
+}
+
 // returns pointer to resource with matching id check, may return 0
 _SOKOL_PRIVATE _sg_buffer_t* _sg_lookup_buffer(uint32_t buf_id) {
     if (SG_INVALID_ID != buf_id) {
@@ -7776,6 +9832,16 @@ _SOKOL_PRIVATE _sg_view_t* _sg_lookup_view(uint32_t view_id) {
     return 0;
 }
 
+_SOKOL_PRIVATE _sg_counter_t* _sg_lookup_counter(uint32_t ctr_id) {
+    if (SG_INVALID_ID != ctr_id) {
+        _sg_counter_t* ctr = _sg_counter_at(ctr_id);
+        if (ctr->slot.id == ctr_id) {
+            return ctr;
+        }
+    }
+    return 0;
+}
+
 // ████████ ██████   █████   ██████ ██   ██
 //    ██    ██   ██ ██   ██ ██      ██  ██
 //    ██    ██████  ███████ ██      █████
@@ -7996,6 +10062,16 @@ _SG_IMPL_RES_PTR_OR_NULL(_sg_shader_ref_ptr_or_null, _sg_shader_ref_t, _sg_shade
 _SG_IMPL_RES_PTR_OR_NULL(_sg_pipeline_ref_ptr_or_null, _sg_pipeline_ref_t, _sg_pipeline_t)
 _SG_IMPL_RES_PTR_OR_NULL(_sg_view_ref_ptr_or_null, _sg_view_ref_t, _sg_view_t)
 
+// the state of a pipeline's shader as seen by a pipeline which waits for its shader to finish
+// compiling in the background: ALLOC while still compiling, FAILED if the shader is gone
+_SOKOL_PRIVATE sg_resource_state _sg_pipeline_shader_state(const _sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    if (!_sg_shader_ref_alive(&pip->cmn.shader)) {
+        return SG_RESOURCESTATE_FAILED;
+    }
+    return _sg_shader_ref_ptr(&pip->cmn.shader)->slot.state;
+}
+
 // ██   ██ ███████ ██      ██████  ███████ ██████  ███████
 // ██   ██ ██      ██      ██   ██ ██      ██   ██ ██
 // ███████ █████   ██      ██████  █████   ██████  ███████
@@ -8012,9 +10088,16 @@ _SG_IMPL_RES_PTR_OR_NULL(_sg_view_ref_ptr_or_null, _sg_view_ref_t, _sg_view_t)
 #define _sg_clamp(v,v0,v1) (((v)<(v0))?(v0):(((v)>(v1))?(v1):(v)))
 #define _sg_fequal(val,cmp,delta) ((((val)-(cmp))> -(delta))&&(((val)-(cmp))<(delta)))
 #define _sg_ispow2(val) ((val&(val-1))==0)
+#if defined(SOKOL_LOADER_THREADS)
+// frame stats are only recorded on the render thread
+#define _sg_stats_add(key,val) {if(_sg.stats_enabled && !_sg_on_loader_thread()){ _sg.stats.cur_frame.key+=val;}}
+#define _sg_stats_inc(key) {if(_sg.stats_enabled && !_sg_on_loader_thread()){ _sg.stats.cur_frame.key++;}}
+#define _sg_resource_stats_inc(key) {if(_sg.stats_enabled && !_sg_on_loader_thread()){ _sg.stats.cur_frame.key++; _sg.stats.total.key++;}}
+#else
 #define _sg_stats_add(key,val) {if(_sg.stats_enabled){ _sg.stats.cur_frame.key+=val;}}
 #define _sg_stats_inc(key) {if(_sg.stats_enabled){ _sg.stats.cur_frame.key++;}}
 #define _sg_resource_stats_inc(key) {if(_sg.stats_enabled){ _sg.stats.cur_frame.key++; _sg.stats.total.key++;}}
+#endif
 
 _SOKOL_PRIVATE void _sg_update_alive_free_resource_stats(sg_total_resource_stats* stats, const _sg_pool_t* pool) {
     SOKOL_ASSERT(stats && pool);
@@ -8022,10 +10105,228 @@ _SOKOL_PRIVATE void _sg_update_alive_free_resource_stats(sg_total_resource_stats
     stats->free = (uint32_t) pool->queue_top;
 }
 
+// a monotonic clock in nanoseconds, only used for statistics
+_SOKOL_PRIVATE uint64_t _sg_time_now_ns(void) {
+    #if defined(_SG_TIME_WIN32)
+        LARGE_INTEGER freq, now;
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&now);
+        return (uint64_t)(((double)now.QuadPart * 1000000000.0) / (double)freq.QuadPart);
+    #elif defined(_SG_TIME_MACH)
+        mach_timebase_info_data_t timebase;
+        mach_timebase_info(&timebase);
+        return (mach_absolute_time() * timebase.numer) / timebase.denom;
+    #elif defined(_SG_TIME_EMSCRIPTEN)
+        return (uint64_t)(emscripten_get_now() * 1000000.0);
+    #elif defined(_SG_TIME_POSIX)
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec;
+    #elif defined(_SG_TIME_TIMESPEC_GET)
+        struct timespec ts;
+        timespec_get(&ts, TIME_UTC);
+        return ((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec;
+    #else
+        return (uint64_t)(((double)clock() * 1000000000.0) / (double)CLOCKS_PER_SEC);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_setup_stats_history(const sg_desc* desc) {
+    SOKOL_ASSERT(desc->stats_history_size >= 0);
+    _sg_stats_history_t* hist = &_sg.stats_history;
+    SOKOL_ASSERT(0 == hist->frames);
+    hist->size = desc->stats_history_size;
+    if (hist->size > 0) {
+        hist->frames = (sg_frame_stats*)_sg_malloc_clear((size_t)hist->size * sizeof(sg_frame_stats));
+        hist->scratch = (uint32_t*)_sg_malloc_clear((size_t)hist->size * sizeof(uint32_t));
+    }
+}
+
+_SOKOL_PRIVATE void _sg_discard_stats_history(void) {
+    _sg_stats_history_t* hist = &_sg.stats_history;
+    if (hist->frames) {
+        _sg_free(hist->frames);
+    }
+    if (hist->scratch) {
+        _sg_free(hist->scratch);
+    }
+    _sg_clear(hist, sizeof(_sg_stats_history_t));
+}
+
 _SOKOL_PRIVATE void _sg_update_stats(void) {
+    _sg_stats_history_t* hist = &_sg.stats_history;
+    const uint64_t now = _sg_time_now_ns();
+    if (hist->last_commit_time_ns != 0) {
+        _sg.stats.cur_frame.frame_time_us = (uint32_t)((now - hist->last_commit_time_ns) / 1000);
+    }
+    hist->last_commit_time_ns = now;
     _sg.stats.cur_frame.frame_index = _sg.frame_index;
+    if (_sg.stats_enabled && (hist->size > 0)) {
+        hist->frames[hist->pos] = _sg.stats.cur_frame;
+        hist->pos = (hist->pos + 1) % hist->size;
+        if (hist->num_frames < hist->size) {
+            hist->num_frames++;
+        }
+    }
     _sg.stats.prev_frame = _sg.stats.cur_frame;
     _sg_clear(&_sg.stats.cur_frame, sizeof(_sg.stats.cur_frame));
+    _sg.stats.prev_frame_passes = _sg.stats.cur_frame_passes;
+    _sg.stats.cur_frame_passes.num_passes = 0;
+}
+
+_SOKOL_PRIVATE void _sg_pass_stats_snapshot(sg_pass_stats* dst) {
+    const sg_frame_stats* src = &_sg.stats.cur_frame;
+    dst->num_apply_viewport = src->num_apply_viewport;
+    dst->num_apply_scissor_rect = src->num_apply_scissor_rect;
+    dst->num_apply_pipeline = src->num_apply_pipeline;
+    dst->num_apply_bindings = src->num_apply_bindings;
+    dst->num_apply_uniforms = src->num_apply_uniforms;
+    dst->num_apply_uniform_buffer = src->num_apply_uniform_buffer;
+    dst->num_draw = src->num_draw;
+    dst->num_draw_ex = src->num_draw_ex;
+    dst->num_draw_batch = src->num_draw_batch;
+    dst->num_draw_batch_items = src->num_draw_batch_items;
+    dst->num_dispatch = src->num_dispatch;
+    dst->num_dispatch_indirect = src->num_dispatch_indirect;
+    dst->size_apply_uniforms = src->size_apply_uniforms;
+}
+
+// called from sg_begin_pass()
+_SOKOL_PRIVATE void _sg_begin_pass_stats(const sg_pass* pass) {
+    _sg_pass_stats_tracker_t* tracker = &_sg.pass_stats;
+    tracker->active = _sg.stats_enabled && (_sg.stats.cur_frame_passes.num_passes < SG_MAX_PASS_STATS);
+    if (!tracker->active) {
+        return;
+    }
+    _sg_clear(&tracker->begin, sizeof(tracker->begin));
+    if (pass->label) {
+        #if defined(_MSC_VER)
+        strncpy_s(tracker->begin.label, SG_PASS_STATS_LABEL_SIZE, pass->label, (SG_PASS_STATS_LABEL_SIZE-1));
+        #else
+        strncpy(tracker->begin.label, pass->label, SG_PASS_STATS_LABEL_SIZE);
+        #endif
+        tracker->begin.label[SG_PASS_STATS_LABEL_SIZE-1] = 0;
+    }
+    tracker->begin.pass_index = _sg.stats.cur_frame.num_passes;
+    _sg_pass_stats_snapshot(&tracker->begin);
+    tracker->begin_time_ns = _sg_time_now_ns();
+}
+
+// identifies the current pass across frames, by label or by pass index for unlabelled passes
+_SOKOL_PRIVATE uint32_t _sg_pass_stats_key(void) {
+    const sg_pass_stats* begin = &_sg.pass_stats.begin;
+    uint32_t hash = 2166136261u;
+    if (begin->label[0]) {
+        for (const char* c = begin->label; *c; c++) {
+            hash = (hash ^ (uint8_t)*c) * 16777619u;
+        }
+    } else {
+        hash = (hash ^ begin->pass_index) * 16777619u;
+    }
+    return hash;
+}
+
+// called from sg_end_counter() for pipeline statistics counters, results arrive
+// with latency (usually from an earlier frame), so the most recent result is only
+// attached if it has been recorded in the same pass as the current one
+_SOKOL_PRIVATE void _sg_pass_stats_pipeline_stats(_sg_counter_t* ctr) {
+    _sg_pass_stats_tracker_t* tracker = &_sg.pass_stats;
+    if (!tracker->active) {
+        return;
+    }
+    const uint32_t key = _sg_pass_stats_key();
+    const uint32_t cur = _sg.frame_index % _SG_COUNTER_NUM_PASS_KEYS;
+    ctr->cmn.pass.frame_index[cur] = _sg.frame_index;
+    ctr->cmn.pass.key[cur] = key;
+    const sg_counter_value* val = &ctr->cmn.result;
+    if (val->available) {
+        const uint32_t i = val->frame_index % _SG_COUNTER_NUM_PASS_KEYS;
+        if ((ctr->cmn.pass.frame_index[i] == val->frame_index) && (ctr->cmn.pass.key[i] == key)) {
+            tracker->begin.pipeline_stats = val->pipeline_stats;
+            tracker->begin.pipeline_stats_frame_index = val->frame_index;
+        }
+    }
+}
+
+// called from sg_end_pass()
+_SOKOL_PRIVATE void _sg_end_pass_stats(void) {
+    _sg_pass_stats_tracker_t* tracker = &_sg.pass_stats;
+    if (!tracker->active) {
+        return;
+    }
+    tracker->active = false;
+    if (!_sg.stats_enabled) {
+        return;
+    }
+    sg_frame_pass_stats* frame_passes = &_sg.stats.cur_frame_passes;
+    SOKOL_ASSERT(frame_passes->num_passes < SG_MAX_PASS_STATS);
+    sg_pass_stats* dst = &frame_passes->passes[frame_passes->num_passes++];
+    _sg_pass_stats_snapshot(dst);
+    const sg_pass_stats* begin = &tracker->begin;
+    memcpy(dst->label, begin->label, sizeof(dst->label));
+    dst->pass_index = begin->pass_index;
+    dst->pipeline_stats = begin->pipeline_stats;
+    dst->pipeline_stats_frame_index = begin->pipeline_stats_frame_index;
+    dst->cpu_time_us = (uint32_t)((_sg_time_now_ns() - tracker->begin_time_ns) / 1000);
+    dst->num_apply_viewport -= begin->num_apply_viewport;
+    dst->num_apply_scissor_rect -= begin->num_apply_scissor_rect;
+    dst->num_apply_pipeline -= begin->num_apply_pipeline;
+    dst->num_apply_bindings -= begin->num_apply_bindings;
+    dst->num_apply_uniforms -= begin->num_apply_uniforms;
+    dst->num_apply_uniform_buffer -= begin->num_apply_uniform_buffer;
+    dst->num_draw -= begin->num_draw;
+    dst->num_draw_ex -= begin->num_draw_ex;
+    dst->num_draw_batch -= begin->num_draw_batch;
+    dst->num_draw_batch_items -= begin->num_draw_batch_items;
+    dst->num_dispatch -= begin->num_dispatch;
+    dst->num_dispatch_indirect -= begin->num_dispatch_indirect;
+    dst->size_apply_uniforms -= begin->size_apply_uniforms;
+}
+
+_SOKOL_PRIVATE int _sg_stats_history_cmp(const void* a, const void* b) {
+    const uint32_t va = *(const uint32_t*)a;
+    const uint32_t vb = *(const uint32_t*)b;
+    return (va < vb) ? -1 : ((va > vb) ? 1 : 0);
+}
+
+// nearest-rank percentile of a sorted array
+_SOKOL_PRIVATE uint32_t _sg_stats_history_percentile(const uint32_t* sorted, int num, int percent) {
+    SOKOL_ASSERT(sorted && (num > 0) && (percent > 0) && (percent <= 100));
+    const int rank = (num * percent + 99) / 100;
+    return sorted[(rank > 0) ? (rank - 1) : 0];
+}
+
+_SOKOL_PRIVATE sg_stats_history _sg_query_stats_history(void) {
+    _SG_STRUCT(sg_stats_history, res);
+    const _sg_stats_history_t* hist = &_sg.stats_history;
+    const int num = hist->num_frames;
+    res.num_frames = num;
+    if (0 == num) {
+        return res;
+    }
+    SOKOL_ASSERT((sizeof(sg_frame_stats) % sizeof(uint32_t)) == 0);
+    const size_t num_counters = sizeof(sg_frame_stats) / sizeof(uint32_t);
+    const size_t frame_index_ci = offsetof(sg_frame_stats, frame_index) / sizeof(uint32_t);
+    uint32_t* values = hist->scratch;
+    for (size_t ci = 0; ci < num_counters; ci++) {
+        if (ci == frame_index_ci) {
+            continue;
+        }
+        uint64_t sum = 0;
+        for (int fi = 0; fi < num; fi++) {
+            const uint32_t val = ((const uint32_t*)&hist->frames[fi])[ci];
+            values[fi] = val;
+            sum += val;
+        }
+        qsort(values, (size_t)num, sizeof(uint32_t), _sg_stats_history_cmp);
+        ((uint32_t*)&res.min)[ci] = values[0];
+        ((uint32_t*)&res.max)[ci] = values[num - 1];
+        ((uint32_t*)&res.avg)[ci] = (uint32_t)((sum + (uint64_t)num / 2) / (uint64_t)num);
+        ((uint32_t*)&res.p50)[ci] = _sg_stats_history_percentile(values, num, 50);
+        ((uint32_t*)&res.p95)[ci] = _sg_stats_history_percentile(values, num, 95);
+        ((uint32_t*)&res.p99)[ci] = _sg_stats_history_percentile(values, num, 99);
+    }
+    return res;
 }
 
 _SOKOL_PRIVATE uint32_t _sg_align_u32(uint32_t val, uint32_t align) {
@@ -8182,7 +10483,7 @@ _SOKOL_PRIVATE void _sg_sampler_common_init(_sg_sampler_common_t* cmn, const sg_
 }
 
 _SOKOL_PRIVATE void _sg_shader_common_init(_sg_shader_common_t* cmn, const sg_shader_desc* desc) {
-    cmn->is_compute = desc->compute_func.source || desc->compute_func.bytecode.ptr;
+    cmn->is_compute = desc->compute_func.source || desc->compute_func.bytecode.ptr || desc->software.compute_func;
     for (size_t i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
         cmn->attrs[i].base_type = desc->attrs[i].base_type;
     }
@@ -8289,13 +10590,13 @@ _SOKOL_PRIVATE void _sg_pipeline_common_init(_sg_pipeline_common_t* cmn, const s
 }
 
 _SOKOL_PRIVATE void _sg_buffer_view_common_init(_sg_buffer_view_common_t* cmn, const sg_buffer_view_desc* desc, _sg_buffer_t* buf) {
-    SOKOL_ASSERT(SG_RESOURCESTATE_VALID == buf->slot.state);
+    SOKOL_ASSERT(SG_RESOURCESTATE_VALID == _sg_slot_init_state(&buf->slot));
     cmn->ref = _sg_buffer_ref(buf);
     cmn->offset = desc->offset;
 }
 
 _SOKOL_PRIVATE void _sg_texture_view_common_init(_sg_image_view_common_t* cmn, const sg_texture_view_desc* desc, _sg_image_t* img) {
-    SOKOL_ASSERT(SG_RESOURCESTATE_VALID == img->slot.state);
+    SOKOL_ASSERT(SG_RESOURCESTATE_VALID == _sg_slot_init_state(&img->slot));
     cmn->ref = _sg_image_ref(img);
     cmn->mip_level = desc->mip_levels.base;
     cmn->mip_level_count = _sg_def(desc->mip_levels.count, img->cmn.num_mipmaps - cmn->mip_level);
@@ -8319,7 +10620,7 @@ _SOKOL_PRIVATE void _sg_texture_view_common_init(_sg_image_view_common_t* cmn, c
 }
 
 _SOKOL_PRIVATE void _sg_image_view_common_init(_sg_image_view_common_t* cmn, const sg_image_view_desc* desc, _sg_image_t* img) {
-    SOKOL_ASSERT(SG_RESOURCESTATE_VALID == img->slot.state);
+    SOKOL_ASSERT(SG_RESOURCESTATE_VALID == _sg_slot_init_state(&img->slot));
     cmn->ref = _sg_image_ref(img);
     cmn->mip_level = desc->mip_level;
     cmn->mip_level_count = 1;
@@ -8357,6 +10658,17 @@ _SOKOL_PRIVATE void _sg_view_common_init(_sg_view_common_t* cmn, const sg_view_d
     }
 }
 
+_SOKOL_PRIVATE void _sg_counter_common_init(_sg_counter_common_t* cmn, const sg_counter_desc* desc) {
+    cmn->type = desc->type;
+    cmn->recorded = false;
+    cmn->begin_frame_index = 0;
+    _sg_clear(&cmn->result, sizeof(cmn->result));
+    for (int i = 0; i < _SG_COUNTER_NUM_PASS_KEYS; i++) {
+        cmn->pass.frame_index[i] = 0xFFFFFFFF;
+        cmn->pass.key[i] = 0;
+    }
+}
+
 _SOKOL_PRIVATE int _sg_vertexformat_bytesize(sg_vertex_format fmt) {
     switch (fmt) {
         case SG_VERTEXFORMAT_FLOAT:     return 4;
@@ -8916,6 +11228,12 @@ _SOKOL_PRIVATE void _sg_dummy_setup_backend(const sg_desc* desc) {
     _sg.limits.max_texture_bindings_per_stage = SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE;
     _sg.limits.max_storage_buffer_bindings_per_stage = SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE;
     _sg.limits.max_storage_image_bindings_per_stage = SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE;
+    // background compilation is simulated, finishes in the next sg_commit()
+    _sg.features.parallel_shader_compile = true;
+    _sg.features.occlusion_counter = true;
+    _sg.features.pipeline_statistics_counter = true;
+    _sg.features.uniform_buffer_bindings = true;
+    _sg.limits.uniform_buffer_offset_alignment = 256;
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_backend(void) {
@@ -8966,6 +11284,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_shader(_sg_shader_t* shd, cons
     SOKOL_ASSERT(shd && desc);
     _SOKOL_UNUSED(shd);
     _SOKOL_UNUSED(desc);
+    return _sg_compile_async() ? SG_RESOURCESTATE_ALLOC : SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_dummy_poll_shader(_sg_shader_t* shd) {
+    SOKOL_ASSERT(shd);
+    _SOKOL_UNUSED(shd);
     return SG_RESOURCESTATE_VALID;
 }
 
@@ -8978,7 +11302,13 @@ _SOKOL_PRIVATE sg_resource_state _sg_dummy_create_pipeline(_sg_pipeline_t* pip,
     SOKOL_ASSERT(pip && desc);
     _SOKOL_UNUSED(pip);
     _SOKOL_UNUSED(desc);
-    return SG_RESOURCESTATE_VALID;
+    return _sg_compile_async() ? SG_RESOURCESTATE_ALLOC : SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_dummy_poll_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    // a pipeline finishes after its shader
+    return _sg_pipeline_shader_state(pip);
 }
 
 _SOKOL_PRIVATE void _sg_dummy_discard_pipeline(_sg_pipeline_t* pip) {
@@ -8998,6 +11328,18 @@ _SOKOL_PRIVATE void _sg_dummy_discard_view(_sg_view_t* view) {
     _SOKOL_UNUSED(view);
 }
 
+_SOKOL_PRIVATE sg_resource_state _sg_dummy_create_counter(_sg_counter_t* ctr, const sg_counter_desc* desc) {
+    SOKOL_ASSERT(ctr && desc);
+    _SOKOL_UNUSED(ctr);
+    _SOKOL_UNUSED(desc);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_dummy_discard_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    _SOKOL_UNUSED(ctr);
+}
+
 _SOKOL_PRIVATE void _sg_dummy_begin_pass(const sg_pass* pass, const _sg_attachments_ptrs_t* atts) {
     SOKOL_ASSERT(pass && atts);
     _SOKOL_UNUSED(pass);
@@ -9046,6 +11388,13 @@ _SOKOL_PRIVATE void _sg_dummy_apply_uniforms(int ub_slot, const sg_range* data)
     _SOKOL_UNUSED(data);
 }
 
+_SOKOL_PRIVATE void _sg_dummy_apply_uniform_buffer(int ub_slot, const _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf);
+    _SOKOL_UNUSED(ub_slot);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+}
+
 _SOKOL_PRIVATE void _sg_dummy_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
     _SOKOL_UNUSED(base_element);
     _SOKOL_UNUSED(num_elements);
@@ -9060,6 +11409,32 @@ _SOKOL_PRIVATE void _sg_dummy_dispatch(int num_groups_x, int num_groups_y, int n
     _SOKOL_UNUSED(num_groups_z);
 }
 
+_SOKOL_PRIVATE void _sg_dummy_dispatch_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+}
+
+// results become available after the sg_commit() of the recording frame, with zero samples
+_SOKOL_PRIVATE void _sg_dummy_counter_result(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    if (ctr->cmn.recorded && (ctr->cmn.begin_frame_index != _sg.frame_index)) {
+        ctr->cmn.result.available = true;
+        ctr->cmn.result.frame_index = ctr->cmn.begin_frame_index;
+        ctr->cmn.result.samples_passed = 0;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_dummy_begin_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    _sg_dummy_counter_result(ctr);
+}
+
+_SOKOL_PRIVATE void _sg_dummy_end_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    _SOKOL_UNUSED(ctr);
+}
+
 _SOKOL_PRIVATE void _sg_dummy_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     _SOKOL_UNUSED(data);
@@ -9087,187 +11462,2993 @@ _SOKOL_PRIVATE void _sg_dummy_update_image(_sg_image_t* img, const sg_image_data
     }
 }
 
-//  ██████  ██████  ███████ ███    ██  ██████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
-// ██    ██ ██   ██ ██      ████   ██ ██       ██          ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
-// ██    ██ ██████  █████   ██ ██  ██ ██   ███ ██          ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
-// ██    ██ ██      ██      ██  ██ ██ ██    ██ ██          ██   ██ ██   ██ ██      ██  ██  ██      ██  ██ ██ ██   ██
-//  ██████  ██      ███████ ██   ████  ██████  ███████     ██████  ██   ██  ██████ ██   ██ ███████ ██   ████ ██████
+// ███████  ██████  ███████ ████████ ██     ██  █████  ██████  ███████     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
+// ██      ██    ██ ██         ██    ██     ██ ██   ██ ██   ██ ██          ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
+// ███████ ██    ██ █████      ██    ██  █  ██ ███████ ██████  █████       ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
+//      ██ ██    ██ ██         ██    ██ ███ ██ ██   ██ ██   ██ ██          ██   ██ ██   ██ ██      ██  ██  ██      ██  ██ ██ ██   ██
+// ███████  ██████  ██         ██     ███ ███  ██   ██ ██   ██ ███████     ██████  ██   ██  ██████ ██   ██ ███████ ██   ████ ██████
 //
-// >>opengl backend
-#elif defined(_SOKOL_ANY_GL)
-
-// optional GL loader for win32
-#if defined(_SOKOL_USE_WIN32_GL_LOADER)
-
-#ifndef SG_GL_FUNCS_EXT
-#define SG_GL_FUNCS_EXT
+// >>software backend
+#elif defined(SOKOL_SOFTWARE)
+
+// guard band around the render target in pixels, must be small enough
+// that 28.4 fixed point edge functions never overflow within a tile
+#define _SG_SW_GUARD_BAND (16000.0f)
+
+//-- SIMD helpers (4 lanes) ----------------------------------------------------
+#if defined(_SG_SW_SSE2)
+typedef __m128i _sg_sw_i4_t;
+typedef __m128 _sg_sw_f4_t;
+static inline _sg_sw_i4_t _sg_sw_i4_splat(int32_t v) { return _mm_set1_epi32(v); }
+static inline _sg_sw_i4_t _sg_sw_i4_ramp(int32_t step) { return _mm_setr_epi32(0, step, 2 * step, 3 * step); }
+static inline _sg_sw_i4_t _sg_sw_i4_add(_sg_sw_i4_t a, _sg_sw_i4_t b) { return _mm_add_epi32(a, b); }
+static inline _sg_sw_i4_t _sg_sw_i4_or(_sg_sw_i4_t a, _sg_sw_i4_t b) { return _mm_or_si128(a, b); }
+static inline int _sg_sw_i4_signmask(_sg_sw_i4_t a) { return _mm_movemask_ps(_mm_castsi128_ps(a)); }
+static inline _sg_sw_f4_t _sg_sw_f4_splat(float v) { return _mm_set1_ps(v); }
+static inline _sg_sw_f4_t _sg_sw_f4_ramp(float step) { return _mm_setr_ps(0.0f, step, 2.0f * step, 3.0f * step); }
+static inline _sg_sw_f4_t _sg_sw_f4_add(_sg_sw_f4_t a, _sg_sw_f4_t b) { return _mm_add_ps(a, b); }
+static inline _sg_sw_f4_t _sg_sw_f4_clamp01(_sg_sw_f4_t a) { return _mm_min_ps(_mm_max_ps(a, _mm_setzero_ps()), _mm_set1_ps(1.0f)); }
+static inline _sg_sw_f4_t _sg_sw_f4_load(const float* ptr) { return _mm_loadu_ps(ptr); }
+static inline void _sg_sw_f4_store(float* ptr, _sg_sw_f4_t a) { _mm_storeu_ps(ptr, a); }
+static inline int _sg_sw_f4_compare(sg_compare_func func, _sg_sw_f4_t a, _sg_sw_f4_t b) {
+    switch (func) {
+        case SG_COMPAREFUNC_NEVER:          return 0;
+        case SG_COMPAREFUNC_LESS:           return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+        case SG_COMPAREFUNC_EQUAL:          return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+        case SG_COMPAREFUNC_LESS_EQUAL:     return _mm_movemask_ps(_mm_cmple_ps(a, b));
+        case SG_COMPAREFUNC_GREATER:        return _mm_movemask_ps(_mm_cmpgt_ps(a, b));
+        case SG_COMPAREFUNC_NOT_EQUAL:      return _mm_movemask_ps(_mm_cmpneq_ps(a, b));
+        case SG_COMPAREFUNC_GREATER_EQUAL:  return _mm_movemask_ps(_mm_cmpge_ps(a, b));
+        default:                            return 0xF;
+    }
+}
+#elif defined(_SG_SW_NEON)
+typedef int32x4_t _sg_sw_i4_t;
+typedef float32x4_t _sg_sw_f4_t;
+static inline int _sg_sw_u4_bitmask(uint32x4_t m) {
+    const uint32x4_t bits = vshrq_n_u32(m, 31);
+    return (int)(vgetq_lane_u32(bits, 0) | (vgetq_lane_u32(bits, 1) << 1) | (vgetq_lane_u32(bits, 2) << 2) | (vgetq_lane_u32(bits, 3) << 3));
+}
+static inline _sg_sw_i4_t _sg_sw_i4_splat(int32_t v) { return vdupq_n_s32(v); }
+static inline _sg_sw_i4_t _sg_sw_i4_ramp(int32_t step) { const int32_t v[4] = { 0, step, 2 * step, 3 * step }; return vld1q_s32(v); }
+static inline _sg_sw_i4_t _sg_sw_i4_add(_sg_sw_i4_t a, _sg_sw_i4_t b) { return vaddq_s32(a, b); }
+static inline _sg_sw_i4_t _sg_sw_i4_or(_sg_sw_i4_t a, _sg_sw_i4_t b) { return vorrq_s32(a, b); }
+static inline int _sg_sw_i4_signmask(_sg_sw_i4_t a) { return _sg_sw_u4_bitmask(vreinterpretq_u32_s32(a)); }
+static inline _sg_sw_f4_t _sg_sw_f4_splat(float v) { return vdupq_n_f32(v); }
+static inline _sg_sw_f4_t _sg_sw_f4_ramp(float step) { const float v[4] = { 0.0f, step, 2.0f * step, 3.0f * step }; return vld1q_f32(v); }
+static inline _sg_sw_f4_t _sg_sw_f4_add(_sg_sw_f4_t a, _sg_sw_f4_t b) { return vaddq_f32(a, b); }
+static inline _sg_sw_f4_t _sg_sw_f4_clamp01(_sg_sw_f4_t a) { return vminq_f32(vmaxq_f32(a, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f)); }
+static inline _sg_sw_f4_t _sg_sw_f4_load(const float* ptr) { return vld1q_f32(ptr); }
+static inline void _sg_sw_f4_store(float* ptr, _sg_sw_f4_t a) { vst1q_f32(ptr, a); }
+static inline int _sg_sw_f4_compare(sg_compare_func func, _sg_sw_f4_t a, _sg_sw_f4_t b) {
+    switch (func) {
+        case SG_COMPAREFUNC_NEVER:          return 0;
+        case SG_COMPAREFUNC_LESS:           return _sg_sw_u4_bitmask(vcltq_f32(a, b));
+        case SG_COMPAREFUNC_EQUAL:          return _sg_sw_u4_bitmask(vceqq_f32(a, b));
+        case SG_COMPAREFUNC_LESS_EQUAL:     return _sg_sw_u4_bitmask(vcleq_f32(a, b));
+        case SG_COMPAREFUNC_GREATER:        return _sg_sw_u4_bitmask(vcgtq_f32(a, b));
+        case SG_COMPAREFUNC_NOT_EQUAL:      return _sg_sw_u4_bitmask(vmvnq_u32(vceqq_f32(a, b)));
+        case SG_COMPAREFUNC_GREATER_EQUAL:  return _sg_sw_u4_bitmask(vcgeq_f32(a, b));
+        default:                            return 0xF;
+    }
+}
+#else
+// scalar fallback
+typedef struct { int32_t v[4]; } _sg_sw_i4_t;
+typedef struct { float v[4]; } _sg_sw_f4_t;
+static inline _sg_sw_i4_t _sg_sw_i4_splat(int32_t v) { _sg_sw_i4_t r = { { v, v, v, v } }; return r; }
+static inline _sg_sw_i4_t _sg_sw_i4_ramp(int32_t step) { _sg_sw_i4_t r = { { 0, step, 2 * step, 3 * step } }; return r; }
+static inline _sg_sw_i4_t _sg_sw_i4_add(_sg_sw_i4_t a, _sg_sw_i4_t b) { for (int i = 0; i < 4; i++) { a.v[i] += b.v[i]; } return a; }
+static inline _sg_sw_i4_t _sg_sw_i4_or(_sg_sw_i4_t a, _sg_sw_i4_t b) { for (int i = 0; i < 4; i++) { a.v[i] |= b.v[i]; } return a; }
+static inline int _sg_sw_i4_signmask(_sg_sw_i4_t a) { return (a.v[0] < 0 ? 1 : 0) | (a.v[1] < 0 ? 2 : 0) | (a.v[2] < 0 ? 4 : 0) | (a.v[3] < 0 ? 8 : 0); }
+static inline _sg_sw_f4_t _sg_sw_f4_splat(float v) { _sg_sw_f4_t r = { { v, v, v, v } }; return r; }
+static inline _sg_sw_f4_t _sg_sw_f4_ramp(float step) { _sg_sw_f4_t r = { { 0.0f, step, 2.0f * step, 3.0f * step } }; return r; }
+static inline _sg_sw_f4_t _sg_sw_f4_add(_sg_sw_f4_t a, _sg_sw_f4_t b) { for (int i = 0; i < 4; i++) { a.v[i] += b.v[i]; } return a; }
+static inline _sg_sw_f4_t _sg_sw_f4_clamp01(_sg_sw_f4_t a) { for (int i = 0; i < 4; i++) { a.v[i] = (a.v[i] < 0.0f) ? 0.0f : ((a.v[i] > 1.0f) ? 1.0f : a.v[i]); } return a; }
+static inline _sg_sw_f4_t _sg_sw_f4_load(const float* ptr) { _sg_sw_f4_t r; memcpy(r.v, ptr, sizeof(r.v)); return r; }
+static inline void _sg_sw_f4_store(float* ptr, _sg_sw_f4_t a) { memcpy(ptr, a.v, sizeof(a.v)); }
+static inline int _sg_sw_f4_compare(sg_compare_func func, _sg_sw_f4_t a, _sg_sw_f4_t b) {
+    int mask = 0;
+    for (int i = 0; i < 4; i++) {
+        bool res;
+        switch (func) {
+            case SG_COMPAREFUNC_NEVER:          res = false; break;
+            case SG_COMPAREFUNC_LESS:           res = a.v[i] < b.v[i]; break;
+            case SG_COMPAREFUNC_EQUAL:          res = a.v[i] == b.v[i]; break;
+            case SG_COMPAREFUNC_LESS_EQUAL:     res = a.v[i] <= b.v[i]; break;
+            case SG_COMPAREFUNC_GREATER:        res = a.v[i] > b.v[i]; break;
+            case SG_COMPAREFUNC_NOT_EQUAL:      res = a.v[i] != b.v[i]; break;
+            case SG_COMPAREFUNC_GREATER_EQUAL:  res = a.v[i] >= b.v[i]; break;
+            default:                            res = true; break;
+        }
+        if (res) {
+            mask |= (1 << i);
+        }
+    }
+    return mask;
+}
 #endif
 
-// X Macro list of GL function names and signatures
-#define _SG_GL_FUNCS \
-    SG_GL_FUNCS_EXT \
-    _SG_XMACRO(glBindVertexArray,                 void, (GLuint array)) \
-    _SG_XMACRO(glFramebufferTextureLayer,         void, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)) \
-    _SG_XMACRO(glGenFramebuffers,                 void, (GLsizei n, GLuint * framebuffers)) \
-    _SG_XMACRO(glBindFramebuffer,                 void, (GLenum target, GLuint framebuffer)) \
-    _SG_XMACRO(glBindRenderbuffer,                void, (GLenum target, GLuint renderbuffer)) \
-    _SG_XMACRO(glGetStringi,                      const GLubyte *, (GLenum name, GLuint index)) \
-    _SG_XMACRO(glClearBufferfi,                   void, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)) \
-    _SG_XMACRO(glClearBufferfv,                   void, (GLenum buffer, GLint drawbuffer, const GLfloat * value)) \
-    _SG_XMACRO(glClearBufferuiv,                  void, (GLenum buffer, GLint drawbuffer, const GLuint * value)) \
-    _SG_XMACRO(glClearBufferiv,                   void, (GLenum buffer, GLint drawbuffer, const GLint * value)) \
-    _SG_XMACRO(glDeleteRenderbuffers,             void, (GLsizei n, const GLuint * renderbuffers)) \
-    _SG_XMACRO(glUniform1fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
-    _SG_XMACRO(glUniform2fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
-    _SG_XMACRO(glUniform3fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
-    _SG_XMACRO(glUniform4fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
-    _SG_XMACRO(glUniform1iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
-    _SG_XMACRO(glUniform2iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
-    _SG_XMACRO(glUniform3iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
-    _SG_XMACRO(glUniform4iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
-    _SG_XMACRO(glUniformMatrix4fv,                void, (GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)) \
-    _SG_XMACRO(glUseProgram,                      void, (GLuint program)) \
-    _SG_XMACRO(glShaderSource,                    void, (GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length)) \
-    _SG_XMACRO(glLinkProgram,                     void, (GLuint program)) \
-    _SG_XMACRO(glGetUniformLocation,              GLint, (GLuint program, const GLchar * name)) \
-    _SG_XMACRO(glGetShaderiv,                     void, (GLuint shader, GLenum pname, GLint * params)) \
-    _SG_XMACRO(glGetProgramInfoLog,               void, (GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)) \
-    _SG_XMACRO(glGetAttribLocation,               GLint, (GLuint program, const GLchar * name)) \
-    _SG_XMACRO(glDisableVertexAttribArray,        void, (GLuint index)) \
-    _SG_XMACRO(glDeleteShader,                    void, (GLuint shader)) \
-    _SG_XMACRO(glDeleteProgram,                   void, (GLuint program)) \
-    _SG_XMACRO(glCompileShader,                   void, (GLuint shader)) \
-    _SG_XMACRO(glStencilFuncSeparate,             void, (GLenum face, GLenum func, GLint ref, GLuint mask)) \
-    _SG_XMACRO(glStencilOpSeparate,               void, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)) \
-    _SG_XMACRO(glRenderbufferStorageMultisample,  void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)) \
-    _SG_XMACRO(glDrawBuffers,                     void, (GLsizei n, const GLenum * bufs)) \
-    _SG_XMACRO(glVertexAttribDivisor,             void, (GLuint index, GLuint divisor)) \
-    _SG_XMACRO(glBufferSubData,                   void, (GLenum target, GLintptr offset, GLsizeiptr size, const void * data)) \
-    _SG_XMACRO(glGenBuffers,                      void, (GLsizei n, GLuint * buffers)) \
-    _SG_XMACRO(glCheckFramebufferStatus,          GLenum, (GLenum target)) \
-    _SG_XMACRO(glFramebufferRenderbuffer,         void, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)) \
-    _SG_XMACRO(glCompressedTexImage2D,            void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)) \
-    _SG_XMACRO(glCompressedTexImage3D,            void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)) \
-    _SG_XMACRO(glActiveTexture,                   void, (GLenum texture)) \
-    _SG_XMACRO(glTexSubImage3D,                   void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)) \
-    _SG_XMACRO(glRenderbufferStorage,             void, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)) \
-    _SG_XMACRO(glGenTextures,                     void, (GLsizei n, GLuint * textures)) \
-    _SG_XMACRO(glPolygonOffset,                   void, (GLfloat factor, GLfloat units)) \
-    _SG_XMACRO(glDrawElements,                    void, (GLenum mode, GLsizei count, GLenum type, const void * indices)) \
-    _SG_XMACRO(glDeleteFramebuffers,              void, (GLsizei n, const GLuint * framebuffers)) \
-    _SG_XMACRO(glBlendEquationSeparate,           void, (GLenum modeRGB, GLenum modeAlpha)) \
-    _SG_XMACRO(glDeleteTextures,                  void, (GLsizei n, const GLuint * textures)) \
-    _SG_XMACRO(glGetProgramiv,                    void, (GLuint program, GLenum pname, GLint * params)) \
-    _SG_XMACRO(glBindTexture,                     void, (GLenum target, GLuint texture)) \
-    _SG_XMACRO(glTexImage3D,                      void, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)) \
-    _SG_XMACRO(glCreateShader,                    GLuint, (GLenum type)) \
-    _SG_XMACRO(glTexSubImage2D,                   void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)) \
-    _SG_XMACRO(glFramebufferTexture2D,            void, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)) \
-    _SG_XMACRO(glCreateProgram,                   GLuint, (void)) \
-    _SG_XMACRO(glViewport,                        void, (GLint x, GLint y, GLsizei width, GLsizei height)) \
-    _SG_XMACRO(glDeleteBuffers,                   void, (GLsizei n, const GLuint * buffers)) \
-    _SG_XMACRO(glDrawArrays,                      void, (GLenum mode, GLint first, GLsizei count)) \
-    _SG_XMACRO(glDrawElementsInstanced,           void, (GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount)) \
-    _SG_XMACRO(glVertexAttribPointer,             void, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)) \
-    _SG_XMACRO(glVertexAttribIPointer,            void, (GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)) \
-    _SG_XMACRO(glUniform1i,                       void, (GLint location, GLint v0)) \
-    _SG_XMACRO(glDisable,                         void, (GLenum cap)) \
-    _SG_XMACRO(glColorMask,                       void, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)) \
-    _SG_XMACRO(glColorMaski,                      void, (GLuint buf, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)) \
-    _SG_XMACRO(glBindBuffer,                      void, (GLenum target, GLuint buffer)) \
-    _SG_XMACRO(glDeleteVertexArrays,              void, (GLsizei n, const GLuint * arrays)) \
-    _SG_XMACRO(glDepthMask,                       void, (GLboolean flag)) \
-    _SG_XMACRO(glDrawArraysInstanced,             void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)) \
-    _SG_XMACRO(glScissor,                         void, (GLint x, GLint y, GLsizei width, GLsizei height)) \
-    _SG_XMACRO(glGenRenderbuffers,                void, (GLsizei n, GLuint * renderbuffers)) \
-    _SG_XMACRO(glBufferData,                      void, (GLenum target, GLsizeiptr size, const void * data, GLenum usage)) \
-    _SG_XMACRO(glBlendFuncSeparate,               void, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)) \
-    _SG_XMACRO(glTexParameteri,                   void, (GLenum target, GLenum pname, GLint param)) \
-    _SG_XMACRO(glGetIntegerv,                     void, (GLenum pname, GLint * data)) \
-    _SG_XMACRO(glEnable,                          void, (GLenum cap)) \
-    _SG_XMACRO(glBlitFramebuffer,                 void, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)) \
-    _SG_XMACRO(glStencilMask,                     void, (GLuint mask)) \
-    _SG_XMACRO(glAttachShader,                    void, (GLuint program, GLuint shader)) \
-    _SG_XMACRO(glGetError,                        GLenum, (void)) \
-    _SG_XMACRO(glBlendColor,                      void, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)) \
-    _SG_XMACRO(glTexParameterf,                   void, (GLenum target, GLenum pname, GLfloat param)) \
-    _SG_XMACRO(glTexParameterfv,                  void, (GLenum target, GLenum pname, const GLfloat* params)) \
-    _SG_XMACRO(glGetShaderInfoLog,                void, (GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)) \
-    _SG_XMACRO(glDepthFunc,                       void, (GLenum func)) \
-    _SG_XMACRO(glStencilOp ,                      void, (GLenum fail, GLenum zfail, GLenum zpass)) \
-    _SG_XMACRO(glStencilFunc,                     void, (GLenum func, GLint ref, GLuint mask)) \
-    _SG_XMACRO(glEnableVertexAttribArray,         void, (GLuint index)) \
-    _SG_XMACRO(glBlendFunc,                       void, (GLenum sfactor, GLenum dfactor)) \
-    _SG_XMACRO(glReadBuffer,                      void, (GLenum src)) \
-    _SG_XMACRO(glTexImage2D,                      void, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)) \
-    _SG_XMACRO(glGenVertexArrays,                 void, (GLsizei n, GLuint * arrays)) \
-    _SG_XMACRO(glFrontFace,                       void, (GLenum mode)) \
-    _SG_XMACRO(glCullFace,                        void, (GLenum mode)) \
-    _SG_XMACRO(glPixelStorei,                     void, (GLenum pname, GLint param)) \
-    _SG_XMACRO(glBindSampler,                     void, (GLuint unit, GLuint sampler)) \
-    _SG_XMACRO(glGenSamplers,                     void, (GLsizei n, GLuint* samplers)) \
-    _SG_XMACRO(glSamplerParameteri,               void, (GLuint sampler, GLenum pname, GLint param)) \
-    _SG_XMACRO(glSamplerParameterf,               void, (GLuint sampler, GLenum pname, GLfloat param)) \
-    _SG_XMACRO(glSamplerParameterfv,              void, (GLuint sampler, GLenum pname, const GLfloat* params)) \
-    _SG_XMACRO(glDeleteSamplers,                  void, (GLsizei n, const GLuint* samplers)) \
-    _SG_XMACRO(glBindBufferBase,                  void, (GLenum target, GLuint index, GLuint buffer)) \
-    _SG_XMACRO(glBindBufferRange,                 void, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)) \
-    _SG_XMACRO(glTexImage2DMultisample,           void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)) \
-    _SG_XMACRO(glTexImage3DMultisample,           void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)) \
-    _SG_XMACRO(glDispatchCompute,                 void, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)) \
-    _SG_XMACRO(glMemoryBarrier,                   void, (GLbitfield barriers)) \
-    _SG_XMACRO(glBindImageTexture,                void, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)) \
-    _SG_XMACRO(glTexStorage2DMultisample,         void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)) \
-    _SG_XMACRO(glTexStorage2D,                    void, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)) \
-    _SG_XMACRO(glTexStorage3DMultisample,         void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)) \
-    _SG_XMACRO(glTexStorage3D,                    void, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)) \
-    _SG_XMACRO(glCompressedTexSubImage2D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)) \
-    _SG_XMACRO(glCompressedTexSubImage3D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)) \
-    _SG_XMACRO(glTextureView,                     void, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)) \
-    _SG_XMACRO(glDrawElementsBaseVertex,          void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)) \
-    _SG_XMACRO(glDrawElementsInstancedBaseVertex, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex)) \
-    _SG_XMACRO(glDrawElementsInstancedBaseVertexBaseInstance, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)) \
-    _SG_XMACRO(glDrawArraysInstancedBaseInstance, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance))
+_SOKOL_PRIVATE bool _sg_sw_compare(sg_compare_func func, float a, float b) {
+    switch (func) {
+        case SG_COMPAREFUNC_NEVER:          return false;
+        case SG_COMPAREFUNC_LESS:           return a < b;
+        case SG_COMPAREFUNC_EQUAL:          return a == b;
+        case SG_COMPAREFUNC_LESS_EQUAL:     return a <= b;
+        case SG_COMPAREFUNC_GREATER:        return a > b;
+        case SG_COMPAREFUNC_NOT_EQUAL:      return a != b;
+        case SG_COMPAREFUNC_GREATER_EQUAL:  return a >= b;
+        default:                            return true;
+    }
+}
 
-// generate GL function pointer typedefs
-#define _SG_XMACRO(name, ret, args) typedef ret (GL_APIENTRY* PFN_ ## name) args;
-_SG_GL_FUNCS
-#undef _SG_XMACRO
+_SOKOL_PRIVATE float _sg_sw_clampf(float v, float lo, float hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
 
-// generate GL function pointers
-#define _SG_XMACRO(name, ret, args) static PFN_ ## name name;
-_SG_GL_FUNCS
-#undef _SG_XMACRO
+_SOKOL_PRIVATE int _sg_sw_clampi(int v, int lo, int hi) {
+    return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
 
-// helper function to lookup GL functions in GL DLL
-typedef PROC (WINAPI * _sg_wglGetProcAddress)(LPCSTR);
-_SOKOL_PRIVATE void* _sg_gl_getprocaddr(const char* name, _sg_wglGetProcAddress wgl_getprocaddress) {
-    void* proc_addr = (void*) wgl_getprocaddress(name);
-    if (0 == proc_addr) {
-        proc_addr = (void*) GetProcAddress(_sg.gl.opengl32_dll, name);
-    }
-    SOKOL_ASSERT(proc_addr);
-    return proc_addr;
+_SOKOL_PRIVATE int _sg_sw_floori(float v) {
+    return (int)floorf(v);
 }
 
-// populate GL function pointers
-_SOKOL_PRIVATE  void _sg_gl_load_opengl(void) {
-    SOKOL_ASSERT(0 == _sg.gl.opengl32_dll);
-    _sg.gl.opengl32_dll = LoadLibraryA("opengl32.dll");
-    SOKOL_ASSERT(_sg.gl.opengl32_dll);
-    _sg_wglGetProcAddress wgl_getprocaddress = (_sg_wglGetProcAddress) GetProcAddress(_sg.gl.opengl32_dll, "wglGetProcAddress");
-    SOKOL_ASSERT(wgl_getprocaddress);
-    #define _SG_XMACRO(name, ret, args) name = (PFN_ ## name) _sg_gl_getprocaddr(#name, wgl_getprocaddress);
-    _SG_GL_FUNCS
-    #undef _SG_XMACRO
+_SOKOL_PRIVATE _sg_recti_t _sg_sw_intersect_rect(_sg_recti_t a, _sg_recti_t b) {
+    const int x0 = (a.x > b.x) ? a.x : b.x;
+    const int y0 = (a.y > b.y) ? a.y : b.y;
+    const int x1 = ((a.x + a.w) < (b.x + b.w)) ? (a.x + a.w) : (b.x + b.w);
+    const int y1 = ((a.y + a.h) < (b.y + b.h)) ? (a.y + a.h) : (b.y + b.h);
+    _SG_STRUCT(_sg_recti_t, res);
+    res.x = x0;
+    res.y = y0;
+    res.w = (x1 > x0) ? (x1 - x0) : 0;
+    res.h = (y1 > y0) ? (y1 - y0) : 0;
+    return res;
 }
 
-_SOKOL_PRIVATE void _sg_gl_unload_opengl(void) {
-    SOKOL_ASSERT(_sg.gl.opengl32_dll);
-    FreeLibrary(_sg.gl.opengl32_dll);
-    _sg.gl.opengl32_dll = 0;
+//-- thread pool ---------------------------------------------------------------
+_SOKOL_PRIVATE void _sg_sw_lock(void) {
+    #if defined(_SG_SW_PTHREADS)
+    pthread_mutex_lock(&_sg.sw.pool.mutex);
+    #elif defined(_SG_SW_WIN32_THREADS)
+    AcquireSRWLockExclusive(&_sg.sw.pool.mutex);
+    #endif
 }
-#endif // _SOKOL_USE_WIN32_GL_LOADER
+
+_SOKOL_PRIVATE void _sg_sw_unlock(void) {
+    #if defined(_SG_SW_PTHREADS)
+    pthread_mutex_unlock(&_sg.sw.pool.mutex);
+    #elif defined(_SG_SW_WIN32_THREADS)
+    ReleaseSRWLockExclusive(&_sg.sw.pool.mutex);
+    #endif
+}
+
+// grab the next work item, or return false if all items have been taken
+_SOKOL_PRIVATE bool _sg_sw_next_item(int* out_item) {
+    _sg_sw_lock();
+    const int item = _sg.sw.pool.next_item;
+    const bool valid = item < _sg.sw.pool.num_items;
+    if (valid) {
+        _sg.sw.pool.next_item++;
+    }
+    _sg_sw_unlock();
+    *out_item = item;
+    return valid;
+}
+
+_SOKOL_PRIVATE void _sg_sw_run_items(int thread_index) {
+    int item;
+    while (_sg_sw_next_item(&item)) {
+        _sg.sw.pool.func(item, thread_index);
+    }
+}
+
+#if defined(_SG_SW_PTHREADS) || defined(_SG_SW_WIN32_THREADS)
+_SOKOL_PRIVATE void _sg_sw_worker_loop(int thread_index) {
+    uint32_t generation = 0;
+    for (;;) {
+        _sg_sw_lock();
+        while (!_sg.sw.pool.quit && (_sg.sw.pool.generation == generation)) {
+            #if defined(_SG_SW_PTHREADS)
+            pthread_cond_wait(&_sg.sw.pool.work_cond, &_sg.sw.pool.mutex);
+            #else
+            SleepConditionVariableSRW(&_sg.sw.pool.work_cond, &_sg.sw.pool.mutex, INFINITE, 0);
+            #endif
+        }
+        if (_sg.sw.pool.quit) {
+            _sg_sw_unlock();
+            break;
+        }
+        generation = _sg.sw.pool.generation;
+        _sg_sw_unlock();
+        _sg_sw_run_items(thread_index);
+        _sg_sw_lock();
+        _sg.sw.pool.num_finished++;
+        if (_sg.sw.pool.num_finished == (_sg.sw.pool.num_threads - 1)) {
+            #if defined(_SG_SW_PTHREADS)
+            pthread_cond_signal(&_sg.sw.pool.done_cond);
+            #else
+            WakeConditionVariable(&_sg.sw.pool.done_cond);
+            #endif
+        }
+        _sg_sw_unlock();
+    }
+}
+#endif
+
+#if defined(_SG_SW_PTHREADS) || defined(_SG_SW_WIN32_THREADS)
+_SOKOL_PRIVATE void _sg_sw_thread_main(const _sg_sw_thread_args_t* args) {
+    #if defined(SOKOL_MULTI_CONTEXT)
+    // worker threads must operate on the context which created them
+    _sg_cur_state = (_sg_state_t*)args->state;
+    #endif
+    _sg_sw_worker_loop(args->index);
+}
+#endif
+
+#if defined(_SG_SW_PTHREADS)
+_SOKOL_PRIVATE void* _sg_sw_thread_func(void* arg) {
+    _sg_sw_thread_main((const _sg_sw_thread_args_t*)arg);
+    return 0;
+}
+#elif defined(_SG_SW_WIN32_THREADS)
+_SOKOL_PRIVATE DWORD WINAPI _sg_sw_thread_func(LPVOID arg) {
+    _sg_sw_thread_main((const _sg_sw_thread_args_t*)arg);
+    return 0;
+}
+#endif
+
+_SOKOL_PRIVATE int _sg_sw_num_cpu_cores(void) {
+    #if defined(_SG_SW_PTHREADS)
+    const long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int)n : 1;
+    #elif defined(_SG_SW_WIN32_THREADS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+    #else
+    return 1;
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_sw_threadpool_init(int num_threads) {
+    _sg_sw_threadpool_t* pool = &_sg.sw.pool;
+    if (num_threads == 0) {
+        num_threads = _sg_sw_num_cpu_cores();
+    }
+    num_threads = _sg_sw_clampi(num_threads, 1, _SG_SW_MAX_THREADS);
+    pool->num_threads = 1;
+    #if defined(_SG_SW_PTHREADS)
+    pthread_mutex_init(&pool->mutex, 0);
+    pthread_cond_init(&pool->work_cond, 0);
+    pthread_cond_init(&pool->done_cond, 0);
+    #elif defined(_SG_SW_WIN32_THREADS)
+    InitializeSRWLock(&pool->mutex);
+    InitializeConditionVariable(&pool->work_cond);
+    InitializeConditionVariable(&pool->done_cond);
+    #endif
+    #if defined(_SG_SW_PTHREADS) || defined(_SG_SW_WIN32_THREADS)
+    for (int i = 1; i < num_threads; i++) {
+        pool->thread_args[i].state = (void*)&_sg;
+        pool->thread_args[i].index = i;
+        #if defined(_SG_SW_PTHREADS)
+        const bool ok = 0 == pthread_create(&pool->threads[i], 0, _sg_sw_thread_func, &pool->thread_args[i]);
+        #else
+        pool->threads[i] = CreateThread(0, 0, _sg_sw_thread_func, &pool->thread_args[i], 0, 0);
+        const bool ok = 0 != pool->threads[i];
+        #endif
+        if (!ok) {
+            _SG_WARN(SOFTWARE_CREATE_THREAD_FAILED);
+            break;
+        }
+        pool->num_threads++;
+    }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_sw_threadpool_discard(void) {
+    _sg_sw_threadpool_t* pool = &_sg.sw.pool;
+    #if defined(_SG_SW_PTHREADS) || defined(_SG_SW_WIN32_THREADS)
+    _sg_sw_lock();
+    pool->quit = true;
+    #if defined(_SG_SW_PTHREADS)
+    pthread_cond_broadcast(&pool->work_cond);
+    #else
+    WakeAllConditionVariable(&pool->work_cond);
+    #endif
+    _sg_sw_unlock();
+    for (int i = 1; i < pool->num_threads; i++) {
+        #if defined(_SG_SW_PTHREADS)
+        pthread_join(pool->threads[i], 0);
+        #else
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+        #endif
+    }
+    #endif
+    #if defined(_SG_SW_PTHREADS)
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->mutex);
+    #endif
+    pool->num_threads = 0;
+}
+
+// run a job function over a number of items on all threads (including the calling thread),
+// returns when all items have been processed
+_SOKOL_PRIVATE void _sg_sw_run_job(_sg_sw_job_func_t func, int num_items) {
+    _sg_sw_threadpool_t* pool = &_sg.sw.pool;
+    if (num_items <= 0) {
+        return;
+    }
+    if ((pool->num_threads <= 1) || (num_items == 1)) {
+        for (int i = 0; i < num_items; i++) {
+            func(i, 0);
+        }
+        return;
+    }
+    _sg_sw_lock();
+    pool->func = func;
+    pool->num_items = num_items;
+    pool->next_item = 0;
+    pool->num_finished = 0;
+    pool->generation++;
+    #if defined(_SG_SW_PTHREADS)
+    pthread_cond_broadcast(&pool->work_cond);
+    #elif defined(_SG_SW_WIN32_THREADS)
+    WakeAllConditionVariable(&pool->work_cond);
+    #endif
+    _sg_sw_unlock();
+    _sg_sw_run_items(0);
+    #if defined(_SG_SW_PTHREADS) || defined(_SG_SW_WIN32_THREADS)
+    _sg_sw_lock();
+    while (pool->num_finished < (pool->num_threads - 1)) {
+        #if defined(_SG_SW_PTHREADS)
+        pthread_cond_wait(&pool->done_cond, &pool->mutex);
+        #else
+        SleepConditionVariableSRW(&pool->done_cond, &pool->mutex, INFINITE, 0);
+        #endif
+    }
+    _sg_sw_unlock();
+    #endif
+}
+
+//-- per-flush memory arena ----------------------------------------------------
+_SOKOL_PRIVATE uint8_t* _sg_sw_arena_chunk_data(_sg_sw_arena_chunk_t* chunk) {
+    return ((uint8_t*)chunk) + _sg_roundup((int)sizeof(_sg_sw_arena_chunk_t), 16);
+}
+
+_SOKOL_PRIVATE void* _sg_sw_arena_alloc(size_t size) {
+    _sg_sw_arena_t* arena = &_sg.sw.arena;
+    size = (size + 15) & ~((size_t)15);
+    while (!arena->cur || ((arena->cur->pos + size) > arena->cur->size)) {
+        _sg_sw_arena_chunk_t* next = arena->cur ? arena->cur->next : arena->first;
+        if (next && (size <= next->size)) {
+            next->pos = 0;
+        } else {
+            // allocate a new chunk and insert it after the current chunk
+            const size_t chunk_size = (size > _SG_SW_ARENA_CHUNK_SIZE) ? size : _SG_SW_ARENA_CHUNK_SIZE;
+            next = (_sg_sw_arena_chunk_t*)_sg_malloc((size_t)_sg_roundup((int)sizeof(_sg_sw_arena_chunk_t), 16) + chunk_size);
+            next->size = chunk_size;
+            next->pos = 0;
+            if (arena->cur) {
+                next->next = arena->cur->next;
+                arena->cur->next = next;
+            } else {
+                next->next = arena->first;
+                arena->first = next;
+            }
+        }
+        arena->cur = next;
+    }
+    void* ptr = _sg_sw_arena_chunk_data(arena->cur) + arena->cur->pos;
+    arena->cur->pos += size;
+    arena->used += size;
+    return ptr;
+}
+
+_SOKOL_PRIVATE void _sg_sw_arena_reset(void) {
+    _sg_sw_arena_t* arena = &_sg.sw.arena;
+    arena->cur = arena->first;
+    if (arena->cur) {
+        arena->cur->pos = 0;
+    }
+    arena->used = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_arena_discard(void) {
+    _sg_sw_arena_chunk_t* chunk = _sg.sw.arena.first;
+    while (chunk) {
+        _sg_sw_arena_chunk_t* next = chunk->next;
+        _sg_free(chunk);
+        chunk = next;
+    }
+    _sg_clear(&_sg.sw.arena, sizeof(_sg.sw.arena));
+}
+
+//-- pixel and vertex format conversion ----------------------------------------
+_SOKOL_PRIVATE float _sg_sw_half_to_float(uint16_t h) {
+    const uint32_t sign = ((uint32_t)h & 0x8000) << 16;
+    const uint32_t exp = ((uint32_t)h >> 10) & 0x1F;
+    const uint32_t mant = (uint32_t)h & 0x3FF;
+    union { uint32_t u; float f; } v;
+    if (exp == 0) {
+        // zero or denormal
+        v.f = (float)mant * (1.0f / 16777216.0f);
+        v.u |= sign;
+    } else if (exp == 31) {
+        v.u = sign | 0x7F800000 | (mant << 13);
+    } else {
+        v.u = sign | ((exp + 112) << 23) | (mant << 13);
+    }
+    return v.f;
+}
+
+_SOKOL_PRIVATE uint16_t _sg_sw_float_to_half(float f) {
+    union { uint32_t u; float f; } v;
+    v.f = f;
+    const uint32_t sign = (v.u >> 16) & 0x8000;
+    const uint32_t fexp = (v.u >> 23) & 0xFF;
+    uint32_t mant = v.u & 0x7FFFFF;
+    if (fexp == 0xFF) {
+        // inf or nan
+        return (uint16_t)(sign | 0x7C00 | (mant ? 0x200 : 0));
+    }
+    const int exp = (int)fexp - 127 + 15;
+    if (exp >= 31) {
+        return (uint16_t)(sign | 0x7C00);
+    }
+    if (exp <= 0) {
+        if (exp < -10) {
+            return (uint16_t)sign;
+        }
+        mant |= 0x800000;
+        const uint32_t shift = (uint32_t)(14 - exp);
+        uint32_t h = mant >> shift;
+        if ((mant >> (shift - 1)) & 1) {
+            h++;
+        }
+        return (uint16_t)(sign | h);
+    }
+    uint32_t h = sign | ((uint32_t)exp << 10) | (mant >> 13);
+    if (mant & 0x1000) {
+        h++;
+    }
+    return (uint16_t)h;
+}
+
+_SOKOL_PRIVATE float _sg_sw_linear_to_srgb(float c) {
+    c = _sg_sw_clampf(c, 0.0f, 1.0f);
+    if (c <= 0.0031308f) {
+        return c * 12.92f;
+    } else {
+        return 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+    }
+}
+
+typedef enum {
+    _SG_SW_CHANNEL_UNORM8,
+    _SG_SW_CHANNEL_SNORM8,
+    _SG_SW_CHANNEL_UINT8,
+    _SG_SW_CHANNEL_SINT8,
+    _SG_SW_CHANNEL_UNORM16,
+    _SG_SW_CHANNEL_SNORM16,
+    _SG_SW_CHANNEL_UINT16,
+    _SG_SW_CHANNEL_SINT16,
+    _SG_SW_CHANNEL_HALF,
+    _SG_SW_CHANNEL_UINT32,
+    _SG_SW_CHANNEL_SINT32,
+    _SG_SW_CHANNEL_FLOAT,
+} _sg_sw_channel_t;
+
+// returns the number of channels and the channel type of 'regular' pixel formats, or 0 for special formats
+_SOKOL_PRIVATE int _sg_sw_channel_layout(sg_pixel_format fmt, _sg_sw_channel_t* out_type) {
+    switch (fmt) {
+        case SG_PIXELFORMAT_R8:         *out_type = _SG_SW_CHANNEL_UNORM8; return 1;
+        case SG_PIXELFORMAT_R8SN:       *out_type = _SG_SW_CHANNEL_SNORM8; return 1;
+        case SG_PIXELFORMAT_R8UI:       *out_type = _SG_SW_CHANNEL_UINT8; return 1;
+        case SG_PIXELFORMAT_R8SI:       *out_type = _SG_SW_CHANNEL_SINT8; return 1;
+        case SG_PIXELFORMAT_R16:        *out_type = _SG_SW_CHANNEL_UNORM16; return 1;
+        case SG_PIXELFORMAT_R16SN:      *out_type = _SG_SW_CHANNEL_SNORM16; return 1;
+        case SG_PIXELFORMAT_R16UI:      *out_type = _SG_SW_CHANNEL_UINT16; return 1;
+        case SG_PIXELFORMAT_R16SI:      *out_type = _SG_SW_CHANNEL_SINT16; return 1;
+        case SG_PIXELFORMAT_R16F:       *out_type = _SG_SW_CHANNEL_HALF; return 1;
+        case SG_PIXELFORMAT_RG8:        *out_type = _SG_SW_CHANNEL_UNORM8; return 2;
+        case SG_PIXELFORMAT_RG8SN:      *out_type = _SG_SW_CHANNEL_SNORM8; return 2;
+        case SG_PIXELFORMAT_RG8UI:      *out_type = _SG_SW_CHANNEL_UINT8; return 2;
+        case SG_PIXELFORMAT_RG8SI:      *out_type = _SG_SW_CHANNEL_SINT8; return 2;
+        case SG_PIXELFORMAT_R32UI:      *out_type = _SG_SW_CHANNEL_UINT32; return 1;
+        case SG_PIXELFORMAT_R32SI:      *out_type = _SG_SW_CHANNEL_SINT32; return 1;
+        case SG_PIXELFORMAT_R32F:       *out_type = _SG_SW_CHANNEL_FLOAT; return 1;
+        case SG_PIXELFORMAT_RG16:       *out_type = _SG_SW_CHANNEL_UNORM16; return 2;
+        case SG_PIXELFORMAT_RG16SN:     *out_type = _SG_SW_CHANNEL_SNORM16; return 2;
+        case SG_PIXELFORMAT_RG16UI:     *out_type = _SG_SW_CHANNEL_UINT16; return 2;
+        case SG_PIXELFORMAT_RG16SI:     *out_type = _SG_SW_CHANNEL_SINT16; return 2;
+        case SG_PIXELFORMAT_RG16F:      *out_type = _SG_SW_CHANNEL_HALF; return 2;
+        case SG_PIXELFORMAT_RGBA8:      *out_type = _SG_SW_CHANNEL_UNORM8; return 4;
+        case SG_PIXELFORMAT_RGBA8SN:    *out_type = _SG_SW_CHANNEL_SNORM8; return 4;
+        case SG_PIXELFORMAT_RGBA8UI:    *out_type = _SG_SW_CHANNEL_UINT8; return 4;
+        case SG_PIXELFORMAT_RGBA8SI:    *out_type = _SG_SW_CHANNEL_SINT8; return 4;
+        case SG_PIXELFORMAT_RG32UI:     *out_type = _SG_SW_CHANNEL_UINT32; return 2;
+        case SG_PIXELFORMAT_RG32SI:     *out_type = _SG_SW_CHANNEL_SINT32; return 2;
+        case SG_PIXELFORMAT_RG32F:      *out_type = _SG_SW_CHANNEL_FLOAT; return 2;
+        case SG_PIXELFORMAT_RGBA16:     *out_type = _SG_SW_CHANNEL_UNORM16; return 4;
+        case SG_PIXELFORMAT_RGBA16SN:   *out_type = _SG_SW_CHANNEL_SNORM16; return 4;
+        case SG_PIXELFORMAT_RGBA16UI:   *out_type = _SG_SW_CHANNEL_UINT16; return 4;
+        case SG_PIXELFORMAT_RGBA16SI:   *out_type = _SG_SW_CHANNEL_SINT16; return 4;
+        case SG_PIXELFORMAT_RGBA16F:    *out_type = _SG_SW_CHANNEL_HALF; return 4;
+        case SG_PIXELFORMAT_RGBA32UI:   *out_type = _SG_SW_CHANNEL_UINT32; return 4;
+        case SG_PIXELFORMAT_RGBA32SI:   *out_type = _SG_SW_CHANNEL_SINT32; return 4;
+        case SG_PIXELFORMAT_RGBA32F:    *out_type = _SG_SW_CHANNEL_FLOAT; return 4;
+        case SG_PIXELFORMAT_DEPTH:
+        case SG_PIXELFORMAT_DEPTH_STENCIL:
+            // depth formats are stored as 32-bit floats
+            *out_type = _SG_SW_CHANNEL_FLOAT; return 1;
+        default:
+            *out_type = _SG_SW_CHANNEL_UNORM8; return 0;
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_sw_is_integer_format(sg_pixel_format fmt) {
+    _sg_sw_channel_t type;
+    if (0 == _sg_sw_channel_layout(fmt, &type)) {
+        return false;
+    }
+    switch (type) {
+        case _SG_SW_CHANNEL_UINT8:
+        case _SG_SW_CHANNEL_SINT8:
+        case _SG_SW_CHANNEL_UINT16:
+        case _SG_SW_CHANNEL_SINT16:
+        case _SG_SW_CHANNEL_UINT32:
+        case _SG_SW_CHANNEL_SINT32:
+            return true;
+        default:
+            return false;
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_sw_is_supported_format(sg_pixel_format fmt) {
+    _sg_sw_channel_t type;
+    switch (fmt) {
+        case SG_PIXELFORMAT_SRGB8A8:
+        case SG_PIXELFORMAT_BGRA8:
+        case SG_PIXELFORMAT_SBGR8A8:
+        case SG_PIXELFORMAT_RGB10A2:
+            return true;
+        default:
+            return 0 != _sg_sw_channel_layout(fmt, &type);
+    }
+}
+
+// decode a pixel into float RGBA (missing channels are 0, missing alpha is 1)
+_SOKOL_PRIVATE void _sg_sw_decode_pixel(sg_pixel_format fmt, const uint8_t* ptr, float* out) {
+    out[0] = out[1] = out[2] = 0.0f;
+    out[3] = 1.0f;
+    switch (fmt) {
+        case SG_PIXELFORMAT_RGBA8:
+            out[0] = (float)ptr[0] * (1.0f / 255.0f);
+            out[1] = (float)ptr[1] * (1.0f / 255.0f);
+            out[2] = (float)ptr[2] * (1.0f / 255.0f);
+            out[3] = (float)ptr[3] * (1.0f / 255.0f);
+            return;
+        case SG_PIXELFORMAT_SRGB8A8:
+            out[0] = _sg.sw.srgb_to_linear[ptr[0]];
+            out[1] = _sg.sw.srgb_to_linear[ptr[1]];
+            out[2] = _sg.sw.srgb_to_linear[ptr[2]];
+            out[3] = (float)ptr[3] * (1.0f / 255.0f);
+            return;
+        case SG_PIXELFORMAT_BGRA8:
+            out[0] = (float)ptr[2] * (1.0f / 255.0f);
+            out[1] = (float)ptr[1] * (1.0f / 255.0f);
+            out[2] = (float)ptr[0] * (1.0f / 255.0f);
+            out[3] = (float)ptr[3] * (1.0f / 255.0f);
+            return;
+        case SG_PIXELFORMAT_SBGR8A8:
+            out[0] = _sg.sw.srgb_to_linear[ptr[2]];
+            out[1] = _sg.sw.srgb_to_linear[ptr[1]];
+            out[2] = _sg.sw.srgb_to_linear[ptr[0]];
+            out[3] = (float)ptr[3] * (1.0f / 255.0f);
+            return;
+        case SG_PIXELFORMAT_RGB10A2: {
+                uint32_t v;
+                memcpy(&v, ptr, sizeof(v));
+                out[0] = (float)(v & 0x3FF) * (1.0f / 1023.0f);
+                out[1] = (float)((v >> 10) & 0x3FF) * (1.0f / 1023.0f);
+                out[2] = (float)((v >> 20) & 0x3FF) * (1.0f / 1023.0f);
+                out[3] = (float)((v >> 30) & 0x3) * (1.0f / 3.0f);
+            }
+            return;
+        default:
+            break;
+    }
+    _sg_sw_channel_t type;
+    const int num = _sg_sw_channel_layout(fmt, &type);
+    for (int i = 0; i < num; i++) {
+        switch (type) {
+            case _SG_SW_CHANNEL_UNORM8:
+                out[i] = (float)ptr[i] * (1.0f / 255.0f);
+                break;
+            case _SG_SW_CHANNEL_SNORM8: {
+                    const float f = (float)((const int8_t*)ptr)[i] * (1.0f / 127.0f);
+                    out[i] = (f < -1.0f) ? -1.0f : f;
+                }
+                break;
+            case _SG_SW_CHANNEL_UINT8:
+                out[i] = (float)ptr[i];
+                break;
+            case _SG_SW_CHANNEL_SINT8:
+                out[i] = (float)((const int8_t*)ptr)[i];
+                break;
+            case _SG_SW_CHANNEL_UNORM16:
+            case _SG_SW_CHANNEL_SNORM16:
+            case _SG_SW_CHANNEL_UINT16:
+            case _SG_SW_CHANNEL_SINT16:
+            case _SG_SW_CHANNEL_HALF: {
+                    uint16_t v;
+                    memcpy(&v, ptr + i * 2, sizeof(v));
+                    if (type == _SG_SW_CHANNEL_UNORM16) {
+                        out[i] = (float)v * (1.0f / 65535.0f);
+                    } else if (type == _SG_SW_CHANNEL_SNORM16) {
+                        const float f = (float)(int16_t)v * (1.0f / 32767.0f);
+                        out[i] = (f < -1.0f) ? -1.0f : f;
+                    } else if (type == _SG_SW_CHANNEL_UINT16) {
+                        out[i] = (float)v;
+                    } else if (type == _SG_SW_CHANNEL_SINT16) {
+                        out[i] = (float)(int16_t)v;
+                    } else {
+                        out[i] = _sg_sw_half_to_float(v);
+                    }
+                }
+                break;
+            case _SG_SW_CHANNEL_UINT32: {
+                    uint32_t v;
+                    memcpy(&v, ptr + i * 4, sizeof(v));
+                    out[i] = (float)v;
+                }
+                break;
+            case _SG_SW_CHANNEL_SINT32: {
+                    int32_t v;
+                    memcpy(&v, ptr + i * 4, sizeof(v));
+                    out[i] = (float)v;
+                }
+                break;
+            case _SG_SW_CHANNEL_FLOAT:
+                memcpy(&out[i], ptr + i * 4, sizeof(float));
+                break;
+        }
+    }
+}
+
+_SOKOL_PRIVATE uint8_t _sg_sw_unorm8(float v) {
+    return (uint8_t)(_sg_sw_clampf(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+// encode a float RGBA value into a pixel
+_SOKOL_PRIVATE void _sg_sw_encode_pixel(sg_pixel_format fmt, const float* in, uint8_t* ptr) {
+    switch (fmt) {
+        case SG_PIXELFORMAT_RGBA8:
+            ptr[0] = _sg_sw_unorm8(in[0]);
+            ptr[1] = _sg_sw_unorm8(in[1]);
+            ptr[2] = _sg_sw_unorm8(in[2]);
+            ptr[3] = _sg_sw_unorm8(in[3]);
+            return;
+        case SG_PIXELFORMAT_SRGB8A8:
+            ptr[0] = _sg_sw_unorm8(_sg_sw_linear_to_srgb(in[0]));
+            ptr[1] = _sg_sw_unorm8(_sg_sw_linear_to_srgb(in[1]));
+            ptr[2] = _sg_sw_unorm8(_sg_sw_linear_to_srgb(in[2]));
+            ptr[3] = _sg_sw_unorm8(in[3]);
+            return;
+        case SG_PIXELFORMAT_BGRA8:
+            ptr[0] = _sg_sw_unorm8(in[2]);
+            ptr[1] = _sg_sw_unorm8(in[1]);
+            ptr[2] = _sg_sw_unorm8(in[0]);
+            ptr[3] = _sg_sw_unorm8(in[3]);
+            return;
+        case SG_PIXELFORMAT_SBGR8A8:
+            ptr[0] = _sg_sw_unorm8(_sg_sw_linear_to_srgb(in[2]));
+            ptr[1] = _sg_sw_unorm8(_sg_sw_linear_to_srgb(in[1]));
+            ptr[2] = _sg_sw_unorm8(_sg_sw_linear_to_srgb(in[0]));
+            ptr[3] = _sg_sw_unorm8(in[3]);
+            return;
+        case SG_PIXELFORMAT_RGB10A2: {
+                const uint32_t r = (uint32_t)(_sg_sw_clampf(in[0], 0.0f, 1.0f) * 1023.0f + 0.5f);
+                const uint32_t g = (uint32_t)(_sg_sw_clampf(in[1], 0.0f, 1.0f) * 1023.0f + 0.5f);
+                const uint32_t b = (uint32_t)(_sg_sw_clampf(in[2], 0.0f, 1.0f) * 1023.0f + 0.5f);
+                const uint32_t a = (uint32_t)(_sg_sw_clampf(in[3], 0.0f, 1.0f) * 3.0f + 0.5f);
+                const uint32_t v = r | (g << 10) | (b << 20) | (a << 30);
+                memcpy(ptr, &v, sizeof(v));
+            }
+            return;
+        default:
+            break;
+    }
+    _sg_sw_channel_t type;
+    const int num = _sg_sw_channel_layout(fmt, &type);
+    for (int i = 0; i < num; i++) {
+        const float f = in[i];
+        switch (type) {
+            case _SG_SW_CHANNEL_UNORM8:
+                ptr[i] = _sg_sw_unorm8(f);
+                break;
+            case _SG_SW_CHANNEL_SNORM8:
+                ((int8_t*)ptr)[i] = (int8_t)floorf(_sg_sw_clampf(f, -1.0f, 1.0f) * 127.0f + 0.5f);
+                break;
+            case _SG_SW_CHANNEL_UINT8:
+                ptr[i] = (uint8_t)_sg_sw_clampf(f, 0.0f, 255.0f);
+                break;
+            case _SG_SW_CHANNEL_SINT8:
+                ((int8_t*)ptr)[i] = (int8_t)_sg_sw_clampf(f, -128.0f, 127.0f);
+                break;
+            case _SG_SW_CHANNEL_UNORM16:
+            case _SG_SW_CHANNEL_SNORM16:
+            case _SG_SW_CHANNEL_UINT16:
+            case _SG_SW_CHANNEL_SINT16:
+            case _SG_SW_CHANNEL_HALF: {
+                    uint16_t v;
+                    if (type == _SG_SW_CHANNEL_UNORM16) {
+                        v = (uint16_t)(_sg_sw_clampf(f, 0.0f, 1.0f) * 65535.0f + 0.5f);
+                    } else if (type == _SG_SW_CHANNEL_SNORM16) {
+                        v = (uint16_t)(int16_t)floorf(_sg_sw_clampf(f, -1.0f, 1.0f) * 32767.0f + 0.5f);
+                    } else if (type == _SG_SW_CHANNEL_UINT16) {
+                        v = (uint16_t)_sg_sw_clampf(f, 0.0f, 65535.0f);
+                    } else if (type == _SG_SW_CHANNEL_SINT16) {
+                        v = (uint16_t)(int16_t)_sg_sw_clampf(f, -32768.0f, 32767.0f);
+                    } else {
+                        v = _sg_sw_float_to_half(f);
+                    }
+                    memcpy(ptr + i * 2, &v, sizeof(v));
+                }
+                break;
+            case _SG_SW_CHANNEL_UINT32: {
+                    const uint32_t v = (f <= 0.0f) ? 0 : ((f >= 4294967295.0f) ? 0xFFFFFFFF : (uint32_t)f);
+                    memcpy(ptr + i * 4, &v, sizeof(v));
+                }
+                break;
+            case _SG_SW_CHANNEL_SINT32: {
+                    const int32_t v = (f <= -2147483648.0f) ? INT32_MIN : ((f >= 2147483647.0f) ? INT32_MAX : (int32_t)f);
+                    memcpy(ptr + i * 4, &v, sizeof(v));
+                }
+                break;
+            case _SG_SW_CHANNEL_FLOAT:
+                memcpy(ptr + i * 4, &f, sizeof(float));
+                break;
+        }
+    }
+}
+
+// clamp range of a color attachment format before blending, returns false for unclamped formats
+_SOKOL_PRIVATE bool _sg_sw_normalized_range(sg_pixel_format fmt, float* out_min) {
+    _sg_sw_channel_t type;
+    switch (fmt) {
+        case SG_PIXELFORMAT_SRGB8A8:
+        case SG_PIXELFORMAT_BGRA8:
+        case SG_PIXELFORMAT_SBGR8A8:
+        case SG_PIXELFORMAT_RGB10A2:
+            *out_min = 0.0f;
+            return true;
+        default:
+            break;
+    }
+    if (_sg_sw_channel_layout(fmt, &type) > 0) {
+        if ((type == _SG_SW_CHANNEL_UNORM8) || (type == _SG_SW_CHANNEL_UNORM16)) {
+            *out_min = 0.0f;
+            return true;
+        } else if ((type == _SG_SW_CHANNEL_SNORM8) || (type == _SG_SW_CHANNEL_SNORM16)) {
+            *out_min = -1.0f;
+            return true;
+        }
+    }
+    return false;
+}
+
+_SOKOL_PRIVATE void _sg_sw_fetch_attr(sg_vertex_format fmt, const uint8_t* ptr, float* out) {
+    out[0] = out[1] = out[2] = 0.0f;
+    out[3] = 1.0f;
+    switch (fmt) {
+        case SG_VERTEXFORMAT_FLOAT:  memcpy(out, ptr, 4); break;
+        case SG_VERTEXFORMAT_FLOAT2: memcpy(out, ptr, 8); break;
+        case SG_VERTEXFORMAT_FLOAT3: memcpy(out, ptr, 12); break;
+        case SG_VERTEXFORMAT_FLOAT4: memcpy(out, ptr, 16); break;
+        case SG_VERTEXFORMAT_INT:
+        case SG_VERTEXFORMAT_INT2:
+        case SG_VERTEXFORMAT_INT3:
+        case SG_VERTEXFORMAT_INT4: {
+                int32_t v[4];
+                const int num = 1 + (int)(fmt - SG_VERTEXFORMAT_INT);
+                memcpy(v, ptr, (size_t)num * 4);
+                for (int i = 0; i < num; i++) {
+                    out[i] = (float)v[i];
+                }
+            }
+            break;
+        case SG_VERTEXFORMAT_UINT:
+        case SG_VERTEXFORMAT_UINT2:
+        case SG_VERTEXFORMAT_UINT3:
+        case SG_VERTEXFORMAT_UINT4: {
+                uint32_t v[4];
+                const int num = 1 + (int)(fmt - SG_VERTEXFORMAT_UINT);
+                memcpy(v, ptr, (size_t)num * 4);
+                for (int i = 0; i < num; i++) {
+                    out[i] = (float)v[i];
+                }
+            }
+            break;
+        case SG_VERTEXFORMAT_BYTE4:
+        case SG_VERTEXFORMAT_BYTE4N:
+            for (int i = 0; i < 4; i++) {
+                const float f = (float)((const int8_t*)ptr)[i];
+                out[i] = (fmt == SG_VERTEXFORMAT_BYTE4) ? f : _sg_sw_clampf(f * (1.0f / 127.0f), -1.0f, 1.0f);
+            }
+            break;
+        case SG_VERTEXFORMAT_UBYTE4:
+        case SG_VERTEXFORMAT_UBYTE4N:
+            for (int i = 0; i < 4; i++) {
+                const float f = (float)ptr[i];
+                out[i] = (fmt == SG_VERTEXFORMAT_UBYTE4) ? f : f * (1.0f / 255.0f);
+            }
+            break;
+        case SG_VERTEXFORMAT_SHORT2:
+        case SG_VERTEXFORMAT_SHORT2N:
+        case SG_VERTEXFORMAT_SHORT4:
+        case SG_VERTEXFORMAT_SHORT4N: {
+                int16_t v[4];
+                const int num = ((fmt == SG_VERTEXFORMAT_SHORT2) || (fmt == SG_VERTEXFORMAT_SHORT2N)) ? 2 : 4;
+                const bool norm = (fmt == SG_VERTEXFORMAT_SHORT2N) || (fmt == SG_VERTEXFORMAT_SHORT4N);
+                memcpy(v, ptr, (size_t)num * 2);
+                for (int i = 0; i < num; i++) {
+                    out[i] = norm ? _sg_sw_clampf((float)v[i] * (1.0f / 32767.0f), -1.0f, 1.0f) : (float)v[i];
+                }
+            }
+            break;
+        case SG_VERTEXFORMAT_USHORT2:
+        case SG_VERTEXFORMAT_USHORT2N:
+        case SG_VERTEXFORMAT_USHORT4:
+        case SG_VERTEXFORMAT_USHORT4N: {
+                uint16_t v[4];
+                const int num = ((fmt == SG_VERTEXFORMAT_USHORT2) || (fmt == SG_VERTEXFORMAT_USHORT2N)) ? 2 : 4;
+                const bool norm = (fmt == SG_VERTEXFORMAT_USHORT2N) || (fmt == SG_VERTEXFORMAT_USHORT4N);
+                memcpy(v, ptr, (size_t)num * 2);
+                for (int i = 0; i < num; i++) {
+                    out[i] = norm ? (float)v[i] * (1.0f / 65535.0f) : (float)v[i];
+                }
+            }
+            break;
+        case SG_VERTEXFORMAT_INT10_N2: {
+                uint32_t v;
+                memcpy(&v, ptr, sizeof(v));
+                for (int i = 0; i < 3; i++) {
+                    // sign-extend 10-bit component
+                    const int32_t c = ((int32_t)(v << (22 - i * 10))) >> 22;
+                    out[i] = _sg_sw_clampf((float)c * (1.0f / 511.0f), -1.0f, 1.0f);
+                }
+                out[3] = _sg_sw_clampf((float)(((int32_t)v) >> 30), -1.0f, 1.0f);
+            }
+            break;
+        case SG_VERTEXFORMAT_UINT10_N2: {
+                uint32_t v;
+                memcpy(&v, ptr, sizeof(v));
+                out[0] = (float)(v & 0x3FF) * (1.0f / 1023.0f);
+                out[1] = (float)((v >> 10) & 0x3FF) * (1.0f / 1023.0f);
+                out[2] = (float)((v >> 20) & 0x3FF) * (1.0f / 1023.0f);
+                out[3] = (float)((v >> 30) & 0x3) * (1.0f / 3.0f);
+            }
+            break;
+        case SG_VERTEXFORMAT_HALF2:
+        case SG_VERTEXFORMAT_HALF4: {
+                uint16_t v[4];
+                const int num = (fmt == SG_VERTEXFORMAT_HALF2) ? 2 : 4;
+                memcpy(v, ptr, (size_t)num * 2);
+                for (int i = 0; i < num; i++) {
+                    out[i] = _sg_sw_half_to_float(v[i]);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+//-- backend setup -------------------------------------------------------------
+_SOKOL_PRIVATE void _sg_sw_init_caps(void) {
+    _sg.backend = SG_BACKEND_SOFTWARE;
+
+    _sg.features.origin_top_left = true;
+    _sg.features.image_clamp_to_border = true;
+    _sg.features.mrt_independent_blend_state = true;
+    _sg.features.mrt_independent_write_mask = true;
+    _sg.features.compute = true;
+    _sg.features.dispatch_indirect = true;
+    _sg.features.occlusion_counter = true;
+    _sg.features.pipeline_statistics_counter = true;
+    _sg.features.uniform_buffer_bindings = true;
+    _sg.features.msaa_texture_bindings = false;
+    _sg.features.draw_base_vertex = true;
+    _sg.features.draw_base_instance = true;
+    _sg.features.dual_source_blending = false;
+    _sg.features.vertexformat_int10_n2 = true;
+
+    _sg.limits.max_image_size_2d = 8 * 1024;
+    _sg.limits.max_image_size_cube = 4 * 1024;
+    _sg.limits.max_image_size_3d = 1024;
+    _sg.limits.max_image_size_array = 8 * 1024;
+    _sg.limits.max_image_array_layers = 1024;
+    _sg.limits.max_vertex_attrs = SG_MAX_VERTEX_ATTRIBUTES;
+    _sg.limits.max_color_attachments = SG_MAX_PORTABLE_COLOR_ATTACHMENTS;
+    _sg.limits.max_texture_bindings_per_stage = SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE;
+    _sg.limits.max_storage_buffer_bindings_per_stage = SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE;
+    _sg.limits.max_storage_image_bindings_per_stage = SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE;
+    _sg.limits.uniform_buffer_offset_alignment = 16;
+
+    for (int fmt = SG_PIXELFORMAT_R8; fmt < SG_PIXELFORMAT_BC1_RGBA; fmt++) {
+        if (_sg_sw_is_supported_format((sg_pixel_format)fmt)) {
+            if ((fmt == SG_PIXELFORMAT_DEPTH) || (fmt == SG_PIXELFORMAT_DEPTH_STENCIL)) {
+                _sg_pixelformat_srmd(&_sg.formats[fmt]);
+            } else if (_sg_sw_is_integer_format((sg_pixel_format)fmt)) {
+                _sg_pixelformat_srm(&_sg.formats[fmt]);
+                _sg_pixelformat_compute_all(&_sg.formats[fmt]);
+            } else {
+                _sg_pixelformat_all(&_sg.formats[fmt]);
+                _sg_pixelformat_compute_all(&_sg.formats[fmt]);
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_setup_backend(const sg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    _sg_sw_init_caps();
+    for (int i = 0; i < 256; i++) {
+        const float c = (float)i / 255.0f;
+        _sg.sw.srgb_to_linear[i] = (c <= 0.04045f) ? (c / 12.92f) : powf((c + 0.055f) / 1.055f, 2.4f);
+    }
+    _sg_sw_threadpool_init(desc->software.num_threads);
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_backend(void) {
+    _sg_sw_threadpool_discard();
+    for (int i = 0; i < _sg.sw.num_bins; i++) {
+        if (_sg.sw.bins[i].items) {
+            _sg_free((void*)_sg.sw.bins[i].items);
+        }
+    }
+    if (_sg.sw.bins) {
+        _sg_free(_sg.sw.bins);
+    }
+    _sg_sw_arena_discard();
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        if (_sg.sw.cur.uniforms[i].ptr) {
+            _sg_free(_sg.sw.cur.uniforms[i].ptr);
+        }
+    }
+    if (_sg.sw.swapchain_depth.buf) {
+        _sg_free(_sg.sw.swapchain_depth.buf);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_reset_state_cache(void) {
+    _sg.sw.cur.ds = 0;
+}
+
+// forward decl
+_SOKOL_PRIVATE void _sg_sw_flush(void);
+
+// rasterize all binned primitives before CPU-side resource memory is modified
+_SOKOL_PRIVATE void _sg_sw_flush_pending(void) {
+    if (_sg.sw.bins_dirty) {
+        _sg_sw_flush();
+    }
+}
+
+//-- resources -----------------------------------------------------------------
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
+    SOKOL_ASSERT(buf && desc);
+    buf->sw.data = (uint8_t*)_sg_malloc_clear((size_t)buf->cmn.size);
+    if (desc->data.ptr) {
+        SOKOL_ASSERT(desc->data.size <= (size_t)buf->cmn.size);
+        memcpy(buf->sw.data, desc->data.ptr, desc->data.size);
+    }
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_buffer(_sg_buffer_t* buf) {
+    SOKOL_ASSERT(buf);
+    _sg_sw_flush_pending();
+    if (buf->sw.data) {
+        _sg_free(buf->sw.data);
+        buf->sw.data = 0;
+    }
+}
+
+// returns the number of slices in a mip level (3D images shrink in depth)
+_SOKOL_PRIVATE int _sg_sw_mip_slices(const _sg_image_t* img, int mip_level) {
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        return _sg_miplevel_dim(img->cmn.num_slices, mip_level);
+    } else {
+        return img->cmn.num_slices;
+    }
+}
+
+_SOKOL_PRIVATE size_t _sg_sw_mip_slice_size(const _sg_image_t* img, int mip_level) {
+    const int w = _sg_miplevel_dim(img->cmn.width, mip_level);
+    const int h = _sg_miplevel_dim(img->cmn.height, mip_level);
+    return (size_t)w * (size_t)h * (size_t)img->sw.bytes_per_pixel;
+}
+
+_SOKOL_PRIVATE size_t _sg_sw_mip_size(const _sg_image_t* img, int mip_level) {
+    return _sg_sw_mip_slice_size(img, mip_level) * (size_t)_sg_sw_mip_slices(img, mip_level);
+}
+
+_SOKOL_PRIVATE void _sg_sw_copy_image_data(_sg_image_t* img, const sg_image_data* data) {
+    for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        const sg_range* src = &data->mip_levels[mip_index];
+        if (src->ptr) {
+            const size_t mip_size = _sg_sw_mip_size(img, mip_index);
+            const size_t num_bytes = (src->size < mip_size) ? src->size : mip_size;
+            memcpy(img->sw.pixels + img->sw.mip_offsets[mip_index], src->ptr, num_bytes);
+        }
+    }
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_image(_sg_image_t* img, const sg_image_desc* desc) {
+    SOKOL_ASSERT(img && desc);
+    if (!_sg_sw_is_supported_format(img->cmn.pixel_format)) {
+        _SG_ERROR(SOFTWARE_UNSUPPORTED_PIXELFORMAT);
+        return SG_RESOURCESTATE_FAILED;
+    }
+    // MSAA images are rendered with a single sample
+    img->sw.bytes_per_pixel = _sg_pixelformat_bytesize(img->cmn.pixel_format);
+    size_t total_size = 0;
+    for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+        img->sw.mip_offsets[mip_index] = total_size;
+        total_size += _sg_sw_mip_size(img, mip_index);
+    }
+    img->sw.pixels = (uint8_t*)_sg_malloc_clear(total_size);
+    _sg_sw_copy_image_data(img, &desc->data);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_image(_sg_image_t* img) {
+    SOKOL_ASSERT(img);
+    _sg_sw_flush_pending();
+    if (img->sw.pixels) {
+        _sg_free(img->sw.pixels);
+        img->sw.pixels = 0;
+    }
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_sampler(_sg_sampler_t* smp, const sg_sampler_desc* desc) {
+    SOKOL_ASSERT(smp && desc);
+    _SOKOL_UNUSED(smp);
+    _SOKOL_UNUSED(desc);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_sampler(_sg_sampler_t* smp) {
+    SOKOL_ASSERT(smp);
+    _SOKOL_UNUSED(smp);
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
+    SOKOL_ASSERT(shd && desc);
+    shd->sw.funcs = desc->software;
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_shader(_sg_shader_t* shd) {
+    SOKOL_ASSERT(shd);
+    _SOKOL_UNUSED(shd);
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(pip && desc);
+    _SOKOL_UNUSED(pip);
+    _SOKOL_UNUSED(desc);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    if (pip == _sg.sw.cur.pip) {
+        _sg.sw.cur.pip = 0;
+    }
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_view(_sg_view_t* view, const sg_view_desc* desc) {
+    SOKOL_ASSERT(view && desc);
+    _SOKOL_UNUSED(view);
+    _SOKOL_UNUSED(desc);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_view(_sg_view_t* view) {
+    SOKOL_ASSERT(view);
+    _SOKOL_UNUSED(view);
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_sw_create_counter(_sg_counter_t* ctr, const sg_counter_desc* desc) {
+    SOKOL_ASSERT(ctr && desc);
+    _SOKOL_UNUSED(ctr);
+    _SOKOL_UNUSED(desc);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_sw_discard_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    // binned primitives may still reference the query
+    _sg_sw_flush_pending();
+    if ((ctr == _sg.sw.cur.occlusion_counter) || (ctr == _sg.sw.cur.stats_counter)) {
+        if (ctr == _sg.sw.cur.occlusion_counter) {
+            _sg.sw.cur.occlusion_counter = 0;
+        } else {
+            _sg.sw.cur.stats_counter = 0;
+        }
+        _sg.sw.cur.ds = 0;
+    }
+}
+
+//-- texture sampling and storage image access (called from shader functions) --
+_SOKOL_PRIVATE const uint8_t* _sg_sw_texel_ptr(const _sg_sw_image_binding_t* b, int mip_level, int x, int y, int slice) {
+    const _sg_image_t* img = b->img;
+    const int w = _sg_miplevel_dim(img->cmn.width, mip_level);
+    const int h = _sg_miplevel_dim(img->cmn.height, mip_level);
+    const size_t offset = img->sw.mip_offsets[mip_level] + ((((size_t)slice * (size_t)h) + (size_t)y) * (size_t)w + (size_t)x) * (size_t)img->sw.bytes_per_pixel;
+    return img->sw.pixels + offset;
+}
+
+// apply wrap mode to a texel coordinate, returns -1 for border texels
+_SOKOL_PRIVATE int _sg_sw_wrap(sg_wrap wrap, int i, int size) {
+    switch (wrap) {
+        case SG_WRAP_CLAMP_TO_EDGE:
+            return _sg_sw_clampi(i, 0, size - 1);
+        case SG_WRAP_CLAMP_TO_BORDER:
+            return ((i < 0) || (i >= size)) ? -1 : i;
+        case SG_WRAP_MIRRORED_REPEAT: {
+                int m = i % (2 * size);
+                if (m < 0) {
+                    m += 2 * size;
+                }
+                return (m < size) ? m : (2 * size - 1 - m);
+            }
+        default: {
+                if (0 == (size & (size - 1))) {
+                    return i & (size - 1);
+                }
+                int m = i % size;
+                return (m < 0) ? (m + size) : m;
+            }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_border_color(sg_border_color border_color, float* out) {
+    switch (border_color) {
+        case SG_BORDERCOLOR_OPAQUE_BLACK:
+            out[0] = out[1] = out[2] = 0.0f; out[3] = 1.0f;
+            break;
+        case SG_BORDERCOLOR_OPAQUE_WHITE:
+            out[0] = out[1] = out[2] = out[3] = 1.0f;
+            break;
+        default:
+            out[0] = out[1] = out[2] = out[3] = 0.0f;
+            break;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_load_texel(const _sg_sw_image_binding_t* b, const _sg_sampler_common_t* smp, int mip_level, int x, int y, int slice, float* out) {
+    const _sg_image_t* img = b->img;
+    x = _sg_sw_wrap(smp->wrap_u, x, _sg_miplevel_dim(img->cmn.width, mip_level));
+    y = _sg_sw_wrap(smp->wrap_v, y, _sg_miplevel_dim(img->cmn.height, mip_level));
+    if ((x < 0) || (y < 0)) {
+        _sg_sw_border_color(smp->border_color, out);
+    } else {
+        _sg_sw_decode_pixel(img->cmn.pixel_format, _sg_sw_texel_ptr(b, mip_level, x, y, slice), out);
+    }
+}
+
+// sample a single 2D slice of a mip level with nearest or linear filtering
+_SOKOL_PRIVATE void _sg_sw_sample_slice(const _sg_sw_image_binding_t* b, const _sg_sampler_common_t* smp, int mip_level, int slice, float u, float v, sg_filter filter, float* out) {
+    const _sg_image_t* img = b->img;
+    const float w = (float)_sg_miplevel_dim(img->cmn.width, mip_level);
+    const float h = (float)_sg_miplevel_dim(img->cmn.height, mip_level);
+    if (filter == SG_FILTER_LINEAR) {
+        const float fx = u * w - 0.5f;
+        const float fy = v * h - 0.5f;
+        const int x0 = _sg_sw_floori(fx);
+        const int y0 = _sg_sw_floori(fy);
+        const float ax = fx - (float)x0;
+        const float ay = fy - (float)y0;
+        float t00[4], t10[4], t01[4], t11[4];
+        _sg_sw_load_texel(b, smp, mip_level, x0, y0, slice, t00);
+        _sg_sw_load_texel(b, smp, mip_level, x0 + 1, y0, slice, t10);
+        _sg_sw_load_texel(b, smp, mip_level, x0, y0 + 1, slice, t01);
+        _sg_sw_load_texel(b, smp, mip_level, x0 + 1, y0 + 1, slice, t11);
+        for (int i = 0; i < 4; i++) {
+            const float top = t00[i] + (t10[i] - t00[i]) * ax;
+            const float bottom = t01[i] + (t11[i] - t01[i]) * ax;
+            out[i] = top + (bottom - top) * ay;
+        }
+    } else {
+        _sg_sw_load_texel(b, smp, mip_level, _sg_sw_floori(u * w), _sg_sw_floori(v * h), slice, out);
+    }
+}
+
+// sample a single mip level, resolves cube faces, array layers and 3D slices
+_SOKOL_PRIVATE void _sg_sw_sample_mip(const _sg_sw_image_binding_t* b, const _sg_sampler_common_t* smp, int mip_level, const float* uvw, sg_filter filter, float* out) {
+    const _sg_image_t* img = b->img;
+    switch (img->cmn.type) {
+        case SG_IMAGETYPE_CUBE: {
+                // select cube face by major axis
+                const float ax = fabsf(uvw[0]), ay = fabsf(uvw[1]), az = fabsf(uvw[2]);
+                int face;
+                float sc, tc, ma;
+                if ((ax >= ay) && (ax >= az)) {
+                    face = (uvw[0] >= 0.0f) ? 0 : 1;
+                    sc = (uvw[0] >= 0.0f) ? -uvw[2] : uvw[2];
+                    tc = -uvw[1];
+                    ma = ax;
+                } else if (ay >= az) {
+                    face = (uvw[1] >= 0.0f) ? 2 : 3;
+                    sc = uvw[0];
+                    tc = (uvw[1] >= 0.0f) ? uvw[2] : -uvw[2];
+                    ma = ay;
+                } else {
+                    face = (uvw[2] >= 0.0f) ? 4 : 5;
+                    sc = (uvw[2] >= 0.0f) ? uvw[0] : -uvw[0];
+                    tc = -uvw[1];
+                    ma = az;
+                }
+                if (ma == 0.0f) {
+                    ma = 1.0f;
+                }
+                _SG_STRUCT(_sg_sampler_common_t, cube_smp);
+                cube_smp = *smp;
+                cube_smp.wrap_u = SG_WRAP_CLAMP_TO_EDGE;
+                cube_smp.wrap_v = SG_WRAP_CLAMP_TO_EDGE;
+                const float u = (sc / ma + 1.0f) * 0.5f;
+                const float v = (tc / ma + 1.0f) * 0.5f;
+                _sg_sw_sample_slice(b, &cube_smp, mip_level, b->slice + face, u, v, filter, out);
+            }
+            break;
+        case SG_IMAGETYPE_ARRAY: {
+                const int layer = _sg_sw_clampi(_sg_sw_floori(uvw[2] + 0.5f), 0, b->slice_count - 1);
+                _sg_sw_sample_slice(b, smp, mip_level, b->slice + layer, uvw[0], uvw[1], filter, out);
+            }
+            break;
+        case SG_IMAGETYPE_3D: {
+                const int depth = _sg_sw_mip_slices(img, mip_level);
+                if (filter == SG_FILTER_LINEAR) {
+                    const float fz = uvw[2] * (float)depth - 0.5f;
+                    const int z0 = _sg_sw_floori(fz);
+                    const float az = fz - (float)z0;
+                    const int s0 = _sg_sw_wrap(smp->wrap_w, z0, depth);
+                    const int s1 = _sg_sw_wrap(smp->wrap_w, z0 + 1, depth);
+                    float c0[4], c1[4];
+                    if (s0 < 0) {
+                        _sg_sw_border_color(smp->border_color, c0);
+                    } else {
+                        _sg_sw_sample_slice(b, smp, mip_level, s0, uvw[0], uvw[1], filter, c0);
+                    }
+                    if (s1 < 0) {
+                        _sg_sw_border_color(smp->border_color, c1);
+                    } else {
+                        _sg_sw_sample_slice(b, smp, mip_level, s1, uvw[0], uvw[1], filter, c1);
+                    }
+                    for (int i = 0; i < 4; i++) {
+                        out[i] = c0[i] + (c1[i] - c0[i]) * az;
+                    }
+                } else {
+                    const int s = _sg_sw_wrap(smp->wrap_w, _sg_sw_floori(uvw[2] * (float)depth), depth);
+                    if (s < 0) {
+                        _sg_sw_border_color(smp->border_color, out);
+                    } else {
+                        _sg_sw_sample_slice(b, smp, mip_level, s, uvw[0], uvw[1], filter, out);
+                    }
+                }
+            }
+            break;
+        default:
+            _sg_sw_sample_slice(b, smp, mip_level, b->slice, uvw[0], uvw[1], filter, out);
+            break;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_sample(const sg_sw_shader_context* ctx, int view_slot, int sampler_slot, const float* uvw, float lod, float* out) {
+    const _sg_sw_bindings_t* bnd = (const _sg_sw_bindings_t*)ctx->_bindings;
+    const _sg_sw_image_binding_t* b = &bnd->images[view_slot];
+    const _sg_sampler_common_t* smp = &bnd->samplers[sampler_slot];
+    if (0 == b->img) {
+        out[0] = out[1] = out[2] = out[3] = 0.0f;
+        return;
+    }
+    const bool is_int = _sg_sw_is_integer_format(b->img->cmn.pixel_format);
+    const float max_lod = (float)(b->mip_level_count - 1);
+    lod = _sg_sw_clampf(lod, smp->min_lod, smp->max_lod);
+    lod = _sg_sw_clampf(lod, 0.0f, max_lod);
+    if (lod <= 0.0f) {
+        const sg_filter filter = is_int ? SG_FILTER_NEAREST : smp->mag_filter;
+        _sg_sw_sample_mip(b, smp, b->mip_level, uvw, filter, out);
+        return;
+    }
+    const sg_filter filter = is_int ? SG_FILTER_NEAREST : smp->min_filter;
+    if ((smp->mipmap_filter == SG_FILTER_LINEAR) && !is_int) {
+        const int m0 = _sg_sw_floori(lod);
+        const int m1 = (m0 + 1) > (int)max_lod ? m0 : (m0 + 1);
+        const float a = lod - (float)m0;
+        float c0[4], c1[4];
+        _sg_sw_sample_mip(b, smp, b->mip_level + m0, uvw, filter, c0);
+        _sg_sw_sample_mip(b, smp, b->mip_level + m1, uvw, filter, c1);
+        for (int i = 0; i < 4; i++) {
+            out[i] = c0[i] + (c1[i] - c0[i]) * a;
+        }
+    } else {
+        _sg_sw_sample_mip(b, smp, b->mip_level + _sg_sw_floori(lod + 0.5f), uvw, filter, out);
+    }
+}
+
+// depth-compare sampling, returns the filtered fraction of passing texels
+_SOKOL_PRIVATE float _sg_sw_sample_compare(const sg_sw_shader_context* ctx, int view_slot, int sampler_slot, const float* uvw, float lod, float ref) {
+    const _sg_sw_bindings_t* bnd = (const _sg_sw_bindings_t*)ctx->_bindings;
+    const _sg_sw_image_binding_t* b = &bnd->images[view_slot];
+    const _sg_sampler_common_t* smp = &bnd->samplers[sampler_slot];
+    if (0 == b->img) {
+        return 0.0f;
+    }
+    lod = _sg_sw_clampf(lod, smp->min_lod, smp->max_lod);
+    lod = _sg_sw_clampf(lod, 0.0f, (float)(b->mip_level_count - 1));
+    const int mip_level = b->mip_level + _sg_sw_floori(lod + 0.5f);
+    const sg_filter filter = (lod <= 0.0f) ? smp->mag_filter : smp->min_filter;
+    const _sg_image_t* img = b->img;
+    const float w = (float)_sg_miplevel_dim(img->cmn.width, mip_level);
+    const float h = (float)_sg_miplevel_dim(img->cmn.height, mip_level);
+    const int slice = (img->cmn.type == SG_IMAGETYPE_ARRAY) ? (b->slice + _sg_sw_clampi(_sg_sw_floori(uvw[2] + 0.5f), 0, b->slice_count - 1)) : b->slice;
+    float t[4];
+    if (filter == SG_FILTER_LINEAR) {
+        const float fx = uvw[0] * w - 0.5f;
+        const float fy = uvw[1] * h - 0.5f;
+        const int x0 = _sg_sw_floori(fx);
+        const int y0 = _sg_sw_floori(fy);
+        const float ax = fx - (float)x0;
+        const float ay = fy - (float)y0;
+        float r[4];
+        for (int i = 0; i < 4; i++) {
+            _sg_sw_load_texel(b, smp, mip_level, x0 + (i & 1), y0 + (i >> 1), slice, t);
+            r[i] = _sg_sw_compare(smp->compare, ref, t[0]) ? 1.0f : 0.0f;
+        }
+        const float top = r[0] + (r[1] - r[0]) * ax;
+        const float bottom = r[2] + (r[3] - r[2]) * ax;
+        return top + (bottom - top) * ay;
+    } else {
+        _sg_sw_load_texel(b, smp, mip_level, _sg_sw_floori(uvw[0] * w), _sg_sw_floori(uvw[1] * h), slice, t);
+        return _sg_sw_compare(smp->compare, ref, t[0]) ? 1.0f : 0.0f;
+    }
+}
+
+// resolve storage image coordinates to a pixel pointer, or null if out of bounds
+_SOKOL_PRIVATE uint8_t* _sg_sw_storage_texel_ptr(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z) {
+    const _sg_sw_bindings_t* bnd = (const _sg_sw_bindings_t*)ctx->_bindings;
+    const _sg_sw_image_binding_t* b = &bnd->images[view_slot];
+    const _sg_image_t* img = b->img;
+    if (0 == img) {
+        return 0;
+    }
+    const int w = _sg_miplevel_dim(img->cmn.width, b->mip_level);
+    const int h = _sg_miplevel_dim(img->cmn.height, b->mip_level);
+    int slice;
+    if (img->cmn.type == SG_IMAGETYPE_3D) {
+        if ((z < 0) || (z >= _sg_sw_mip_slices(img, b->mip_level))) {
+            return 0;
+        }
+        slice = z;
+    } else {
+        if ((z < 0) || (z >= b->slice_count)) {
+            return 0;
+        }
+        slice = b->slice + z;
+    }
+    if ((x < 0) || (x >= w) || (y < 0) || (y >= h)) {
+        return 0;
+    }
+    return (uint8_t*)_sg_sw_texel_ptr(b, b->mip_level, x, y, slice);
+}
+
+_SOKOL_PRIVATE void _sg_sw_image_load(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z, float* out) {
+    const uint8_t* ptr = _sg_sw_storage_texel_ptr(ctx, view_slot, x, y, z);
+    if (ptr) {
+        const _sg_sw_bindings_t* bnd = (const _sg_sw_bindings_t*)ctx->_bindings;
+        _sg_sw_decode_pixel(bnd->images[view_slot].img->cmn.pixel_format, ptr, out);
+    } else {
+        out[0] = out[1] = out[2] = out[3] = 0.0f;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_image_store(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z, const float* rgba) {
+    uint8_t* ptr = _sg_sw_storage_texel_ptr(ctx, view_slot, x, y, z);
+    if (ptr) {
+        const _sg_sw_bindings_t* bnd = (const _sg_sw_bindings_t*)ctx->_bindings;
+        _sg_sw_encode_pixel(bnd->images[view_slot].img->cmn.pixel_format, rgba, ptr);
+    }
+}
+
+//-- render passes and tile rasterization ---------------------------------------
+_SOKOL_PRIVATE _sg_sw_surface_t _sg_sw_view_surface(const _sg_view_t* view) {
+    _SG_STRUCT(_sg_sw_surface_t, surf);
+    if (view) {
+        const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
+        const int mip_level = view->cmn.img.mip_level;
+        const int width = _sg_miplevel_dim(img->cmn.width, mip_level);
+        surf.bytes_per_pixel = img->sw.bytes_per_pixel;
+        surf.row_pitch = width * surf.bytes_per_pixel;
+        surf.pixels = img->sw.pixels + img->sw.mip_offsets[mip_level] + (size_t)view->cmn.img.slice * _sg_sw_mip_slice_size(img, mip_level);
+        surf.fmt = img->cmn.pixel_format;
+    }
+    return surf;
+}
+
+_SOKOL_PRIVATE void _sg_sw_clear_tile(int x0, int y0, int x1, int y1) {
+    const sg_pass_action* action = &_sg.sw.pass.action;
+    for (int i = 0; i < _sg.sw.pass.num_colors; i++) {
+        const _sg_sw_surface_t* surf = &_sg.sw.pass.colors[i];
+        if (surf->pixels && (action->colors[i].load_action == SG_LOADACTION_CLEAR)) {
+            const sg_color c = action->colors[i].clear_value;
+            const float rgba[4] = { c.r, c.g, c.b, c.a };
+            uint8_t pixel[16];
+            _sg_sw_encode_pixel(surf->fmt, rgba, pixel);
+            for (int y = y0; y < y1; y++) {
+                uint8_t* dst = surf->pixels + (size_t)y * (size_t)surf->row_pitch + (size_t)x0 * (size_t)surf->bytes_per_pixel;
+                for (int x = x0; x < x1; x++, dst += surf->bytes_per_pixel) {
+                    memcpy(dst, pixel, (size_t)surf->bytes_per_pixel);
+                }
+            }
+        }
+    }
+    const _sg_sw_surface_t* depth = &_sg.sw.pass.depth;
+    if (depth->pixels && (action->depth.load_action == SG_LOADACTION_CLEAR)) {
+        const float clear_value = action->depth.clear_value;
+        for (int y = y0; y < y1; y++) {
+            float* dst = (float*)(depth->pixels + (size_t)y * (size_t)depth->row_pitch) + x0;
+            for (int x = x0; x < x1; x++) {
+                *dst++ = clear_value;
+            }
+        }
+    }
+}
+
+// compute a blend factor for channels [first, last)
+_SOKOL_PRIVATE void _sg_sw_blend_factor(sg_blend_factor factor, const float* src, const float* dst, const float* blend_color, int first, int last, float* out) {
+    for (int i = first; i < last; i++) {
+        switch (factor) {
+            case SG_BLENDFACTOR_ZERO:                   out[i] = 0.0f; break;
+            case SG_BLENDFACTOR_ONE:                    out[i] = 1.0f; break;
+            case SG_BLENDFACTOR_SRC_COLOR:              out[i] = src[i]; break;
+            case SG_BLENDFACTOR_ONE_MINUS_SRC_COLOR:    out[i] = 1.0f - src[i]; break;
+            case SG_BLENDFACTOR_SRC_ALPHA:              out[i] = src[3]; break;
+            case SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA:    out[i] = 1.0f - src[3]; break;
+            case SG_BLENDFACTOR_DST_COLOR:              out[i] = dst[i]; break;
+            case SG_BLENDFACTOR_ONE_MINUS_DST_COLOR:    out[i] = 1.0f - dst[i]; break;
+            case SG_BLENDFACTOR_DST_ALPHA:              out[i] = dst[3]; break;
+            case SG_BLENDFACTOR_ONE_MINUS_DST_ALPHA:    out[i] = 1.0f - dst[3]; break;
+            case SG_BLENDFACTOR_SRC_ALPHA_SATURATED:    out[i] = (i == 3) ? 1.0f : ((src[3] < (1.0f - dst[3])) ? src[3] : (1.0f - dst[3])); break;
+            case SG_BLENDFACTOR_BLEND_COLOR:            out[i] = blend_color[i]; break;
+            case SG_BLENDFACTOR_ONE_MINUS_BLEND_COLOR:  out[i] = 1.0f - blend_color[i]; break;
+            case SG_BLENDFACTOR_BLEND_ALPHA:            out[i] = blend_color[3]; break;
+            case SG_BLENDFACTOR_ONE_MINUS_BLEND_ALPHA:  out[i] = 1.0f - blend_color[3]; break;
+            default:                                    out[i] = 0.0f; break;
+        }
+    }
+}
+
+_SOKOL_PRIVATE float _sg_sw_blend_op(sg_blend_op op, float s, float d) {
+    switch (op) {
+        case SG_BLENDOP_SUBTRACT:           return s - d;
+        case SG_BLENDOP_REVERSE_SUBTRACT:   return d - s;
+        case SG_BLENDOP_MIN:                return (s < d) ? s : d;
+        case SG_BLENDOP_MAX:                return (s > d) ? s : d;
+        default:                            return s + d;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_write_color(const _sg_sw_drawstate_t* ds, int index, int x, int y, const float* color) {
+    const _sg_sw_surface_t* surf = &_sg.sw.pass.colors[index];
+    const sg_color_target_state* cts = &ds->colors[index];
+    if (0 == surf->pixels) {
+        return;
+    }
+    uint8_t* ptr = surf->pixels + (size_t)y * (size_t)surf->row_pitch + (size_t)x * (size_t)surf->bytes_per_pixel;
+    const bool full_mask = cts->write_mask == SG_COLORMASK_RGBA;
+    if (!cts->blend.enabled && full_mask) {
+        _sg_sw_encode_pixel(surf->fmt, color, ptr);
+        return;
+    }
+    float src[4] = { color[0], color[1], color[2], color[3] };
+    float dst[4];
+    float res[4];
+    _sg_sw_decode_pixel(surf->fmt, ptr, dst);
+    if (cts->blend.enabled) {
+        if (surf->normalized) {
+            for (int i = 0; i < 4; i++) {
+                src[i] = _sg_sw_clampf(src[i], surf->range_min, 1.0f);
+            }
+        }
+        const sg_blend_state* bs = &cts->blend;
+        float sf[4], df[4];
+        _sg_sw_blend_factor(bs->src_factor_rgb, src, dst, ds->blend_color, 0, 3, sf);
+        _sg_sw_blend_factor(bs->dst_factor_rgb, src, dst, ds->blend_color, 0, 3, df);
+        _sg_sw_blend_factor(bs->src_factor_alpha, src, dst, ds->blend_color, 3, 4, sf);
+        _sg_sw_blend_factor(bs->dst_factor_alpha, src, dst, ds->blend_color, 3, 4, df);
+        for (int i = 0; i < 3; i++) {
+            res[i] = _sg_sw_blend_op(bs->op_rgb, src[i] * sf[i], dst[i] * df[i]);
+        }
+        res[3] = _sg_sw_blend_op(bs->op_alpha, src[3] * sf[3], dst[3] * df[3]);
+        // min/max ignore the blend factors
+        if ((bs->op_rgb == SG_BLENDOP_MIN) || (bs->op_rgb == SG_BLENDOP_MAX)) {
+            for (int i = 0; i < 3; i++) {
+                res[i] = _sg_sw_blend_op(bs->op_rgb, src[i], dst[i]);
+            }
+        }
+        if ((bs->op_alpha == SG_BLENDOP_MIN) || (bs->op_alpha == SG_BLENDOP_MAX)) {
+            res[3] = _sg_sw_blend_op(bs->op_alpha, src[3], dst[3]);
+        }
+    } else {
+        memcpy(res, src, sizeof(res));
+    }
+    if (!full_mask) {
+        for (int i = 0; i < 4; i++) {
+            if (0 == (cts->write_mask & (1 << i))) {
+                res[i] = dst[i];
+            }
+        }
+    }
+    _sg_sw_encode_pixel(surf->fmt, res, ptr);
+}
+
+_SOKOL_PRIVATE float* _sg_sw_depth_ptr(int x, int y) {
+    return (float*)(_sg.sw.pass.depth.pixels + (size_t)y * (size_t)_sg.sw.pass.depth.row_pitch) + x;
+}
+
+// invoke the fragment function and write the results, depth has already been tested
+_SOKOL_PRIVATE void _sg_sw_output_fragment(const _sg_sw_drawstate_t* ds, sg_sw_fragment* frag, int x, int y, int thread_index) {
+    if (ds->fragment_func) {
+        if (ds->stats_counter) {
+            ds->stats_counter->sw.counts[thread_index]++;
+        }
+        memset(frag->colors, 0, (size_t)ds->num_colors * sizeof(frag->colors[0]));
+        if (!ds->fragment_func(&ds->ctx, frag)) {
+            return;
+        }
+    }
+    _sg.sw.thread_stats[thread_index].num_fragments++;
+    if (ds->occlusion_counter) {
+        ds->occlusion_counter->sw.counts[thread_index]++;
+    }
+    if (ds->depth_write) {
+        *_sg_sw_depth_ptr(x, y) = frag->frag_coord[2];
+    }
+    if (ds->fragment_func) {
+        for (int i = 0; i < ds->num_colors; i++) {
+            if (ds->colors[i].write_mask != SG_COLORMASK_NONE) {
+                _sg_sw_write_color(ds, i, x, y, frag->colors[i]);
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE float _sg_sw_plane(const float* plane, float dx, float dy) {
+    return plane[0] + plane[1] * dx + plane[2] * dy;
+}
+
+_SOKOL_PRIVATE void _sg_sw_triangle_fragment(const _sg_sw_prim_t* prim, int x, int y, float z, int thread_index) {
+    const _sg_sw_drawstate_t* ds = prim->ds;
+    const float dx = (float)(x - prim->bbox.x);
+    const float dy = (float)(y - prim->bbox.y);
+    const float inv_w = _sg_sw_plane(prim->planes[1], dx, dy);
+    const float b1 = _sg_sw_plane(prim->planes[2], dx, dy) / inv_w;
+    const float b2 = _sg_sw_plane(prim->planes[3], dx, dy) / inv_w;
+    const int nv = ds->num_varyings;
+    const float* v0 = (const float*)(prim + 1);
+    const float* d1 = v0 + nv;
+    const float* d2 = d1 + nv;
+    sg_sw_fragment frag;
+    for (int i = 0; i < nv; i++) {
+        frag.varyings[i] = v0[i] + b1 * d1[i] + b2 * d2[i];
+    }
+    frag.frag_coord[0] = (float)x + 0.5f;
+    frag.frag_coord[1] = (float)y + 0.5f;
+    frag.frag_coord[2] = z;
+    frag.frag_coord[3] = inv_w;
+    frag.front_facing = prim->front_facing;
+    _sg_sw_output_fragment(ds, &frag, x, y, thread_index);
+}
+
+// rasterize a triangle within a rectangle (exclusive max), 4 pixels at a time
+_SOKOL_PRIVATE void _sg_sw_raster_triangle(const _sg_sw_prim_t* prim, int x0, int y0, int x1, int y1, int thread_index) {
+    const _sg_sw_drawstate_t* ds = prim->ds;
+    int num_tests = 0;
+    int32_t e_row[3];
+    int32_t step_x[3];
+    int32_t step_y[3];
+    _sg_sw_i4_t lane_offsets[3];
+    for (int i = 0; i < 3; i++) {
+        // edge function at pixel centers: E = 16*a*x + 16*b*y + (8*a + 8*b + c)
+        const int64_t a = (int64_t)prim->edge_a[i] * 16;
+        const int64_t b = (int64_t)prim->edge_b[i] * 16;
+        const int64_t e00 = a * x0 + b * y0 + (int64_t)prim->edge_a[i] * 8 + (int64_t)prim->edge_b[i] * 8 + prim->edge_c[i];
+        const int64_t e10 = e00 + a * (x1 - 1 - x0);
+        const int64_t e01 = e00 + b * (y1 - 1 - y0);
+        const int64_t e11 = e10 + (e01 - e00);
+        if ((e00 < 0) && (e10 < 0) && (e01 < 0) && (e11 < 0)) {
+            // rectangle completely outside of this edge
+            return;
+        }
+        if ((e00 >= 0) && (e10 >= 0) && (e01 >= 0) && (e11 >= 0)) {
+            // rectangle completely inside of this edge, no per-pixel test needed
+            continue;
+        }
+        e_row[num_tests] = (int32_t)e00;
+        step_x[num_tests] = (int32_t)a;
+        step_y[num_tests] = (int32_t)b;
+        lane_offsets[num_tests] = _sg_sw_i4_ramp((int32_t)a);
+        num_tests++;
+    }
+    const float* zp = prim->planes[0];
+    const _sg_sw_f4_t z_lanes = _sg_sw_f4_ramp(zp[1]);
+    for (int y = y0; y < y1; y++) {
+        int32_t e[3] = { e_row[0], e_row[1], e_row[2] };
+        const float z_row = zp[0] + zp[2] * (float)(y - prim->bbox.y);
+        for (int x = x0; x < x1; x += 4) {
+            const int num_lanes = x1 - x;
+            int mask = (num_lanes >= 4) ? 0xF : ((1 << num_lanes) - 1);
+            if (num_tests > 0) {
+                _sg_sw_i4_t acc = _sg_sw_i4_add(_sg_sw_i4_splat(e[0]), lane_offsets[0]);
+                e[0] += 4 * step_x[0];
+                for (int i = 1; i < num_tests; i++) {
+                    acc = _sg_sw_i4_or(acc, _sg_sw_i4_add(_sg_sw_i4_splat(e[i]), lane_offsets[i]));
+                    e[i] += 4 * step_x[i];
+                }
+                mask &= ~_sg_sw_i4_signmask(acc);
+            }
+            if (0 == mask) {
+                continue;
+            }
+            const _sg_sw_f4_t z = _sg_sw_f4_clamp01(_sg_sw_f4_add(_sg_sw_f4_splat(z_row + zp[1] * (float)(x - prim->bbox.x)), z_lanes));
+            if (ds->depth_test) {
+                const float* depth_ptr = _sg_sw_depth_ptr(x, y);
+                _sg_sw_f4_t d;
+                if (num_lanes >= 4) {
+                    d = _sg_sw_f4_load(depth_ptr);
+                } else {
+                    float tmp[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    for (int i = 0; i < num_lanes; i++) {
+                        tmp[i] = depth_ptr[i];
+                    }
+                    d = _sg_sw_f4_load(tmp);
+                }
+                mask &= _sg_sw_f4_compare(ds->depth_compare, z, d);
+                if (0 == mask) {
+                    continue;
+                }
+            }
+            float zs[4];
+            _sg_sw_f4_store(zs, z);
+            for (int i = 0; i < 4; i++) {
+                if (mask & (1 << i)) {
+                    _sg_sw_triangle_fragment(prim, x + i, y, zs[i], thread_index);
+                }
+            }
+        }
+        for (int i = 0; i < num_tests; i++) {
+            e_row[i] += step_y[i];
+        }
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_sw_depth_test(const _sg_sw_drawstate_t* ds, int x, int y, float z) {
+    if (ds->depth_test) {
+        return _sg_sw_compare(ds->depth_compare, z, *_sg_sw_depth_ptr(x, y));
+    }
+    return true;
+}
+
+// shade a line or point fragment, t is the perspective-correct position along the line
+_SOKOL_PRIVATE void _sg_sw_line_fragment(const _sg_sw_prim_t* prim, int x, int y, float z, float inv_w, float t, int thread_index) {
+    const _sg_sw_drawstate_t* ds = prim->ds;
+    z = _sg_sw_clampf(z, 0.0f, 1.0f);
+    if (!_sg_sw_depth_test(ds, x, y, z)) {
+        return;
+    }
+    const int nv = ds->num_varyings;
+    const float* v0 = (const float*)(prim + 1);
+    const float* d1 = v0 + nv;
+    sg_sw_fragment frag;
+    if (prim->type == _SG_SW_PRIM_LINE) {
+        for (int i = 0; i < nv; i++) {
+            frag.varyings[i] = v0[i] + t * d1[i];
+        }
+    } else {
+        for (int i = 0; i < nv; i++) {
+            frag.varyings[i] = v0[i];
+        }
+    }
+    frag.frag_coord[0] = (float)x + 0.5f;
+    frag.frag_coord[1] = (float)y + 0.5f;
+    frag.frag_coord[2] = z;
+    frag.frag_coord[3] = inv_w;
+    frag.front_facing = true;
+    _sg_sw_output_fragment(ds, &frag, x, y, thread_index);
+}
+
+// rasterize a line with a simple DDA over the pixel centers in [start, end) along the major axis
+_SOKOL_PRIVATE void _sg_sw_raster_line(const _sg_sw_prim_t* prim, int x0, int y0, int x1, int y1, int thread_index) {
+    const float* p0 = prim->planes[0];
+    const float* p1 = prim->planes[1];
+    const float inv_w0 = prim->planes[2][0];
+    const float inv_w1 = prim->planes[2][1];
+    const float dx = p1[0] - p0[0];
+    const float dy = p1[1] - p0[1];
+    const bool x_major = fabsf(dx) >= fabsf(dy);
+    const float len = x_major ? dx : dy;
+    if (len == 0.0f) {
+        return;
+    }
+    const float start = x_major ? p0[0] : p0[1];
+    const float end = x_major ? p1[0] : p1[1];
+    const float lo = (start < end) ? start : end;
+    const float hi = (start < end) ? end : start;
+    int i0 = (int)ceilf(lo - 0.5f);
+    int i1 = (int)ceilf(hi - 0.5f);
+    // clip the major axis range against the rectangle
+    if (x_major) {
+        i0 = (i0 < x0) ? x0 : i0;
+        i1 = (i1 > x1) ? x1 : i1;
+    } else {
+        i0 = (i0 < y0) ? y0 : i0;
+        i1 = (i1 > y1) ? y1 : i1;
+    }
+    for (int i = i0; i < i1; i++) {
+        const float t = (((float)i + 0.5f) - start) / len;
+        if ((t < 0.0f) || (t > 1.0f)) {
+            continue;
+        }
+        const float minor = x_major ? (p0[1] + t * dy) : (p0[0] + t * dx);
+        const int j = _sg_sw_floori(minor);
+        const int px = x_major ? i : j;
+        const int py = x_major ? j : i;
+        if ((px < x0) || (px >= x1) || (py < y0) || (py >= y1)) {
+            continue;
+        }
+        const float inv_w = inv_w0 + t * (inv_w1 - inv_w0);
+        const float tp = (inv_w > 0.0f) ? (t * inv_w1 / inv_w) : t;
+        const float z = p0[2] + t * (p1[2] - p0[2]);
+        _sg_sw_line_fragment(prim, px, py, z, inv_w, tp, thread_index);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_raster_point(const _sg_sw_prim_t* prim, int x0, int y0, int x1, int y1, int thread_index) {
+    const int px = prim->bbox.x;
+    const int py = prim->bbox.y;
+    if ((px >= x0) && (px < x1) && (py >= y0) && (py < y1)) {
+        _sg_sw_line_fragment(prim, px, py, prim->planes[0][2], prim->planes[1][0], 0.0f, thread_index);
+    }
+}
+
+// job function: process all binned primitives of one tile
+_SOKOL_PRIVATE void _sg_sw_raster_tile(int tile_index, int thread_index) {
+    const _sg_sw_bin_t* bin = &_sg.sw.bins[tile_index];
+    if (!_sg.sw.pass.clear_pending && (0 == bin->num)) {
+        return;
+    }
+    const int tx = tile_index % _sg.sw.pass.tiles_x;
+    const int ty = tile_index / _sg.sw.pass.tiles_x;
+    const int x0 = tx * _SG_SW_TILE_SIZE;
+    const int y0 = ty * _SG_SW_TILE_SIZE;
+    const int x1 = _sg_min(x0 + _SG_SW_TILE_SIZE, _sg.sw.pass.width);
+    const int y1 = _sg_min(y0 + _SG_SW_TILE_SIZE, _sg.sw.pass.height);
+    if (_sg.sw.pass.clear_pending) {
+        _sg_sw_clear_tile(x0, y0, x1, y1);
+    }
+    for (int i = 0; i < bin->num; i++) {
+        const _sg_sw_prim_t* prim = bin->items[i];
+        const _sg_recti_t tile_rect = { x0, y0, x1 - x0, y1 - y0 };
+        const _sg_recti_t r = _sg_sw_intersect_rect(tile_rect, prim->bbox);
+        if ((r.w == 0) || (r.h == 0)) {
+            continue;
+        }
+        switch (prim->type) {
+            case _SG_SW_PRIM_TRIANGLE:
+                _sg_sw_raster_triangle(prim, r.x, r.y, r.x + r.w, r.y + r.h, thread_index);
+                break;
+            case _SG_SW_PRIM_LINE:
+                _sg_sw_raster_line(prim, r.x, r.y, r.x + r.w, r.y + r.h, thread_index);
+                break;
+            default:
+                _sg_sw_raster_point(prim, r.x, r.y, r.x + r.w, r.y + r.h, thread_index);
+                break;
+        }
+    }
+}
+
+// rasterize all binned primitives and reset the bins and per-flush memory
+_SOKOL_PRIVATE void _sg_sw_flush(void) {
+    if (_sg.sw.pass.valid && (_sg.sw.bins_dirty || _sg.sw.pass.clear_pending)) {
+        const int num_tiles = _sg.sw.pass.tiles_x * _sg.sw.pass.tiles_y;
+        _sg_clear(_sg.sw.thread_stats, sizeof(_sg.sw.thread_stats));
+        _sg_sw_run_job(_sg_sw_raster_tile, num_tiles);
+        for (int i = 0; i < _sg.sw.pool.num_threads; i++) {
+            _sg_stats_add(sw.num_fragments, _sg.sw.thread_stats[i].num_fragments);
+        }
+        for (int i = 0; i < num_tiles; i++) {
+            _sg.sw.bins[i].num = 0;
+        }
+        _sg_stats_inc(sw.num_flushes);
+    }
+    _sg.sw.pass.clear_pending = false;
+    _sg.sw.bins_dirty = false;
+    _sg.sw.cur.ds = 0;
+    _sg_sw_arena_reset();
+}
+
+_SOKOL_PRIVATE void _sg_sw_begin_pass(const sg_pass* pass, const _sg_attachments_ptrs_t* atts) {
+    SOKOL_ASSERT(pass && atts);
+    _sg_clear(&_sg.sw.pass, sizeof(_sg.sw.pass));
+    _sg.sw.cur.ds = 0;
+    if (pass->compute) {
+        return;
+    }
+    const int width = _sg.cur_pass.dim.width;
+    const int height = _sg.cur_pass.dim.height;
+    if (atts->empty) {
+        const sg_swapchain* swapchain = &pass->swapchain;
+        if (swapchain->software.color_pixels) {
+            _sg_sw_surface_t* surf = &_sg.sw.pass.colors[0];
+            surf->fmt = swapchain->color_format;
+            surf->bytes_per_pixel = _sg_pixelformat_bytesize(surf->fmt);
+            surf->row_pitch = (swapchain->software.color_row_pitch > 0) ? swapchain->software.color_row_pitch : (width * surf->bytes_per_pixel);
+            surf->pixels = (uint8_t*)swapchain->software.color_pixels;
+        }
+        _sg.sw.pass.num_colors = 1;
+        if (swapchain->depth_format != SG_PIXELFORMAT_NONE) {
+            const size_t num_bytes = (size_t)width * (size_t)height * sizeof(float);
+            if (num_bytes > _sg.sw.swapchain_depth.size) {
+                if (_sg.sw.swapchain_depth.buf) {
+                    _sg_free(_sg.sw.swapchain_depth.buf);
+                }
+                _sg.sw.swapchain_depth.buf = (float*)_sg_malloc(num_bytes);
+                _sg.sw.swapchain_depth.size = num_bytes;
+            }
+            _sg_sw_surface_t* surf = &_sg.sw.pass.depth;
+            surf->fmt = SG_PIXELFORMAT_DEPTH;
+            surf->bytes_per_pixel = (int)sizeof(float);
+            surf->row_pitch = width * surf->bytes_per_pixel;
+            surf->pixels = (uint8_t*)_sg.sw.swapchain_depth.buf;
+        }
+    } else {
+        _sg.sw.pass.num_colors = atts->num_color_views;
+        for (int i = 0; i < atts->num_color_views; i++) {
+            _sg.sw.pass.colors[i] = _sg_sw_view_surface(atts->color_views[i]);
+            _sg.sw.pass.resolves[i] = _sg_sw_view_surface(atts->resolve_views[i]);
+        }
+        _sg.sw.pass.depth = _sg_sw_view_surface(atts->ds_view);
+    }
+    for (int i = 0; i < _sg.sw.pass.num_colors; i++) {
+        _sg_sw_surface_t* surf = &_sg.sw.pass.colors[i];
+        if (surf->pixels) {
+            surf->normalized = _sg_sw_normalized_range(surf->fmt, &surf->range_min);
+        }
+    }
+    _sg.sw.pass.width = width;
+    _sg.sw.pass.height = height;
+    _sg.sw.pass.tiles_x = (width + _SG_SW_TILE_SIZE - 1) / _SG_SW_TILE_SIZE;
+    _sg.sw.pass.tiles_y = (height + _SG_SW_TILE_SIZE - 1) / _SG_SW_TILE_SIZE;
+    const int num_tiles = _sg.sw.pass.tiles_x * _sg.sw.pass.tiles_y;
+    if (num_tiles > _sg.sw.num_bins) {
+        _sg_sw_bin_t* bins = (_sg_sw_bin_t*)_sg_malloc_clear((size_t)num_tiles * sizeof(_sg_sw_bin_t));
+        if (_sg.sw.bins) {
+            memcpy(bins, _sg.sw.bins, (size_t)_sg.sw.num_bins * sizeof(_sg_sw_bin_t));
+            _sg_free(_sg.sw.bins);
+        }
+        _sg.sw.bins = bins;
+        _sg.sw.num_bins = num_tiles;
+    }
+    _sg.sw.pass.action = pass->action;
+    for (int i = 0; i < _sg.sw.pass.num_colors; i++) {
+        if (pass->action.colors[i].load_action == SG_LOADACTION_CLEAR) {
+            _sg.sw.pass.clear_pending = true;
+        }
+    }
+    if (_sg.sw.pass.depth.pixels && (pass->action.depth.load_action == SG_LOADACTION_CLEAR)) {
+        _sg.sw.pass.clear_pending = true;
+    }
+    _SG_STRUCT(_sg_recti_t, full);
+    full.w = width;
+    full.h = height;
+    _sg.sw.cur.viewport = full;
+    _sg.sw.cur.scissor = full;
+    _sg.sw.pass.valid = true;
+}
+
+_SOKOL_PRIVATE void _sg_sw_end_pass(const _sg_attachments_ptrs_t* atts) {
+    SOKOL_ASSERT(atts);
+    _SOKOL_UNUSED(atts);
+    if (_sg.sw.pass.valid) {
+        _sg_sw_flush();
+        // MSAA resolve is a plain copy since rendering is single-sampled
+        for (int i = 0; i < _sg.sw.pass.num_colors; i++) {
+            const _sg_sw_surface_t* src = &_sg.sw.pass.colors[i];
+            const _sg_sw_surface_t* dst = &_sg.sw.pass.resolves[i];
+            if (src->pixels && dst->pixels) {
+                const size_t row_size = (size_t)_sg.sw.pass.width * (size_t)src->bytes_per_pixel;
+                for (int y = 0; y < _sg.sw.pass.height; y++) {
+                    memcpy(dst->pixels + (size_t)y * (size_t)dst->row_pitch, src->pixels + (size_t)y * (size_t)src->row_pitch, row_size);
+                }
+            }
+        }
+    }
+    _sg_clear(&_sg.sw.pass, sizeof(_sg.sw.pass));
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_commit(void) {
+    // empty
+}
+
+_SOKOL_PRIVATE void _sg_sw_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
+    _sg.sw.cur.viewport.x = x;
+    _sg.sw.cur.viewport.y = origin_top_left ? y : (_sg.cur_pass.dim.height - (y + h));
+    _sg.sw.cur.viewport.w = w;
+    _sg.sw.cur.viewport.h = h;
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_apply_scissor_rect(int x, int y, int w, int h, bool origin_top_left) {
+    _sg.sw.cur.scissor.x = x;
+    _sg.sw.cur.scissor.y = origin_top_left ? y : (_sg.cur_pass.dim.height - (y + h));
+    _sg.sw.cur.scissor.w = w;
+    _sg.sw.cur.scissor.h = h;
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_apply_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    _sg.sw.cur.pip = pip;
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE bool _sg_sw_apply_bindings(_sg_bindings_ptrs_t* bnd) {
+    SOKOL_ASSERT(bnd);
+    SOKOL_ASSERT(bnd->pip);
+    for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        _sg.sw.cur.vbs[i] = bnd->vbs[i] ? (bnd->vbs[i]->sw.data + bnd->vb_offsets[i]) : 0;
+    }
+    _sg.sw.cur.ib = bnd->ib ? (bnd->ib->sw.data + bnd->ib_offset) : 0;
+    _sg_clear(&_sg.sw.cur.bnd, sizeof(_sg.sw.cur.bnd));
+    for (int i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+        const _sg_view_t* view = bnd->views[i];
+        _sg.sw.cur.storage_buffers[i] = 0;
+        _sg.sw.cur.storage_buffer_sizes[i] = 0;
+        if (0 == view) {
+            continue;
+        }
+        if (view->cmn.type == SG_VIEWTYPE_STORAGEBUFFER) {
+            _sg_buffer_t* buf = _sg_buffer_ref_ptr(&view->cmn.buf.ref);
+            _sg.sw.cur.storage_buffers[i] = buf->sw.data + view->cmn.buf.offset;
+            _sg.sw.cur.storage_buffer_sizes[i] = buf->cmn.size - view->cmn.buf.offset;
+        } else {
+            _sg_sw_image_binding_t* b = &_sg.sw.cur.bnd.images[i];
+            b->img = _sg_image_ref_ptr(&view->cmn.img.ref);
+            b->mip_level = view->cmn.img.mip_level;
+            b->mip_level_count = view->cmn.img.mip_level_count;
+            b->slice = view->cmn.img.slice;
+            b->slice_count = view->cmn.img.slice_count;
+        }
+    }
+    for (int i = 0; i < SG_MAX_SAMPLER_BINDSLOTS; i++) {
+        if (bnd->smps[i]) {
+            _sg.sw.cur.bnd.samplers[i] = bnd->smps[i]->cmn;
+        }
+    }
+    _sg.sw.cur.ds = 0;
+    return true;
+}
+
+_SOKOL_PRIVATE void _sg_sw_apply_uniforms(int ub_slot, const sg_range* data) {
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(data && data->ptr);
+    if (data->size > _sg.sw.cur.uniforms[ub_slot].capacity) {
+        if (_sg.sw.cur.uniforms[ub_slot].ptr) {
+            _sg_free(_sg.sw.cur.uniforms[ub_slot].ptr);
+        }
+        _sg.sw.cur.uniforms[ub_slot].ptr = (uint8_t*)_sg_malloc(data->size);
+        _sg.sw.cur.uniforms[ub_slot].capacity = data->size;
+    }
+    memcpy(_sg.sw.cur.uniforms[ub_slot].ptr, data->ptr, data->size);
+    _sg.sw.cur.uniforms[ub_slot].size = data->size;
+    _sg.sw.cur.uniforms[ub_slot].buf_ptr = 0;
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_apply_uniform_buffer(int ub_slot, const _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(buf && buf->sw.data && (offset >= 0) && (offset < buf->cmn.size));
+    // no copy, shader functions read the uniform block directly from the buffer
+    // (like storage buffers, the buffer content must not change until the frame is done)
+    _sg.sw.cur.uniforms[ub_slot].buf_ptr = buf->sw.data + offset;
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_init_shader_context(sg_sw_shader_context* ctx, const _sg_shader_t* shd, const _sg_sw_bindings_t* bnd) {
+    _sg_clear(ctx, sizeof(sg_sw_shader_context));
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        if (_sg.sw.cur.uniforms[i].buf_ptr) {
+            ctx->uniforms[i] = _sg.sw.cur.uniforms[i].buf_ptr;
+        } else if (_sg.sw.cur.uniforms[i].size > 0) {
+            ctx->uniforms[i] = _sg.sw.cur.uniforms[i].ptr;
+        }
+    }
+    for (int i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+        ctx->storage_buffers[i] = _sg.sw.cur.storage_buffers[i];
+        ctx->storage_buffer_sizes[i] = _sg.sw.cur.storage_buffer_sizes[i];
+    }
+    ctx->user_data = shd->sw.funcs.user_data;
+    ctx->_bindings = bnd;
+}
+
+// get the current draw state snapshot, a new snapshot is recorded when render state has changed
+_SOKOL_PRIVATE _sg_sw_drawstate_t* _sg_sw_drawstate(void) {
+    if (_sg.sw.cur.ds) {
+        return _sg.sw.cur.ds;
+    }
+    const _sg_pipeline_t* pip = _sg.sw.cur.pip;
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    _sg_sw_drawstate_t* ds = (_sg_sw_drawstate_t*)_sg_sw_arena_alloc(sizeof(_sg_sw_drawstate_t));
+    _sg_clear(ds, sizeof(_sg_sw_drawstate_t));
+    ds->fragment_func = shd->sw.funcs.fragment_func;
+    ds->num_varyings = shd->sw.funcs.num_varyings;
+    ds->bnd = _sg.sw.cur.bnd;
+    _sg_sw_init_shader_context(&ds->ctx, shd, &ds->bnd);
+    // uniform data must survive until the primitives have been rasterized
+    // (uniform blocks in buffers are already stable)
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        const size_t size = _sg.sw.cur.uniforms[i].size;
+        if ((size > 0) && (0 == _sg.sw.cur.uniforms[i].buf_ptr)) {
+            void* copy = _sg_sw_arena_alloc(size);
+            memcpy(copy, _sg.sw.cur.uniforms[i].ptr, size);
+            ds->ctx.uniforms[i] = copy;
+        }
+    }
+    const bool has_depth = 0 != _sg.sw.pass.depth.pixels;
+    ds->depth_compare = pip->cmn.depth.compare;
+    ds->depth_write = has_depth && pip->cmn.depth.write_enabled;
+    ds->depth_test = has_depth && (ds->depth_compare != SG_COMPAREFUNC_ALWAYS);
+    ds->depth_bias = pip->cmn.depth.bias;
+    ds->depth_bias_slope_scale = pip->cmn.depth.bias_slope_scale;
+    ds->depth_bias_clamp = pip->cmn.depth.bias_clamp;
+    ds->num_colors = _sg_min(pip->cmn.color_count, _sg.sw.pass.num_colors);
+    for (int i = 0; i < ds->num_colors; i++) {
+        ds->colors[i] = pip->cmn.colors[i];
+    }
+    ds->blend_color[0] = pip->cmn.blend_color.r;
+    ds->blend_color[1] = pip->cmn.blend_color.g;
+    ds->blend_color[2] = pip->cmn.blend_color.b;
+    ds->blend_color[3] = pip->cmn.blend_color.a;
+    _SG_STRUCT(_sg_recti_t, target);
+    target.w = _sg.sw.pass.width;
+    target.h = _sg.sw.pass.height;
+    ds->clip = _sg_sw_intersect_rect(_sg_sw_intersect_rect(_sg.sw.cur.viewport, _sg.sw.cur.scissor), target);
+    ds->occlusion_counter = _sg.sw.cur.occlusion_counter;
+    ds->stats_counter = _sg.sw.cur.stats_counter;
+    _sg.sw.cur.ds = ds;
+    return ds;
+}
+
+//-- geometry processing: vertex shading, clipping, triangle setup and binning --
+
+_SOKOL_PRIVATE void _sg_sw_copy_vertex(const _sg_sw_drawctx_t* dc, _sg_sw_vertex_t* dst, const _sg_sw_vertex_t* src) {
+    memcpy(dst->pos, src->pos, sizeof(dst->pos));
+    memcpy(dst->varyings, src->varyings, (size_t)dc->num_varyings * sizeof(float));
+}
+
+_SOKOL_PRIVATE void _sg_sw_shade_vertex(const _sg_sw_drawctx_t* dc, int vertex_index, int instance_index, _sg_sw_vertex_t* out) {
+    const _sg_pipeline_common_t* cmn = &dc->pip->cmn;
+    sg_sw_vertex vtx;
+    _sg_clear(&vtx, sizeof(vtx));
+    vtx.vertex_index = vertex_index;
+    vtx.instance_index = instance_index;
+    for (int attr_index = 0; attr_index < SG_MAX_VERTEX_ATTRIBUTES; attr_index++) {
+        const sg_vertex_attr_state* attr = &cmn->layout.attrs[attr_index];
+        if (attr->format == SG_VERTEXFORMAT_INVALID) {
+            break;
+        }
+        const uint8_t* vb = _sg.sw.cur.vbs[attr->buffer_index];
+        if (0 == vb) {
+            continue;
+        }
+        const sg_vertex_buffer_layout_state* layout = &cmn->layout.buffers[attr->buffer_index];
+        int element;
+        if (layout->step_func == SG_VERTEXSTEP_PER_INSTANCE) {
+            element = dc->base_instance + instance_index / layout->step_rate;
+        } else {
+            element = vertex_index;
+        }
+        _sg_sw_fetch_attr(attr->format, vb + (size_t)element * (size_t)layout->stride + (size_t)attr->offset, vtx.attrs[attr_index]);
+    }
+    dc->shd->sw.funcs.vertex_func(&dc->ds->ctx, &vtx);
+    memcpy(out->pos, vtx.pos, sizeof(out->pos));
+    memcpy(out->varyings, vtx.varyings, (size_t)dc->num_varyings * sizeof(float));
+    _sg_stats_inc(sw.num_vertices);
+    if (_sg.sw.cur.stats_counter) {
+        _sg.sw.cur.stats_counter->sw.stats.vertex_invocations++;
+    }
+}
+
+// returns the shaded vertex in dst, indexed draws go through the vertex cache
+_SOKOL_PRIVATE void _sg_sw_get_vertex(_sg_sw_drawctx_t* dc, bool indexed, int vertex_index, int instance_index, _sg_sw_vertex_t* dst) {
+    if (indexed) {
+        const int slot = vertex_index & (_SG_SW_VCACHE_SIZE - 1);
+        if (dc->cache_tags[slot] != vertex_index) {
+            _sg_sw_shade_vertex(dc, vertex_index, instance_index, &dc->cache[slot]);
+            dc->cache_tags[slot] = vertex_index;
+        }
+        _sg_sw_copy_vertex(dc, dst, &dc->cache[slot]);
+    } else {
+        _sg_sw_shade_vertex(dc, vertex_index, instance_index, dst);
+    }
+}
+
+#define _SG_SW_NUM_CLIP_PLANES (7)
+
+// signed distance to a clip plane, inside is >= 0
+_SOKOL_PRIVATE float _sg_sw_clip_dist(const _sg_sw_drawctx_t* dc, int plane, const float* pos) {
+    switch (plane) {
+        case 0: return pos[2];                          // near: z >= 0
+        case 1: return pos[3] - pos[2];                 // far: z <= w
+        case 2: return pos[0] - dc->gb_left * pos[3];
+        case 3: return dc->gb_right * pos[3] - pos[0];
+        case 4: return dc->gb_top * pos[3] - pos[1];
+        case 5: return pos[1] - dc->gb_bottom * pos[3];
+        default: return pos[3] - 1.0e-6f;               // w > 0
+    }
+}
+
+_SOKOL_PRIVATE uint32_t _sg_sw_outcode(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* v) {
+    uint32_t code = 0;
+    for (int i = 0; i < _SG_SW_NUM_CLIP_PLANES; i++) {
+        if (_sg_sw_clip_dist(dc, i, v->pos) < 0.0f) {
+            code |= (1u << i);
+        }
+    }
+    return code;
+}
+
+_SOKOL_PRIVATE void _sg_sw_lerp_vertex(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* a, const _sg_sw_vertex_t* b, float t, _sg_sw_vertex_t* out) {
+    for (int i = 0; i < 4; i++) {
+        out->pos[i] = a->pos[i] + (b->pos[i] - a->pos[i]) * t;
+    }
+    for (int i = 0; i < dc->num_varyings; i++) {
+        out->varyings[i] = a->varyings[i] + (b->varyings[i] - a->varyings[i]) * t;
+    }
+}
+
+// transform a clip space vertex to window coordinates (x, y in pixels, z in 0..1, 1/w)
+_SOKOL_PRIVATE void _sg_sw_to_window(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* v, float* out) {
+    const float inv_w = 1.0f / v->pos[3];
+    out[0] = dc->vp_cx + dc->vp_hw * v->pos[0] * inv_w;
+    out[1] = dc->vp_cy - dc->vp_hh * v->pos[1] * inv_w;
+    out[2] = v->pos[2] * inv_w;
+    out[3] = inv_w;
+}
+
+_SOKOL_PRIVATE void _sg_sw_bin_prim(const _sg_sw_prim_t* prim) {
+    const int tx0 = prim->bbox.x / _SG_SW_TILE_SIZE;
+    const int ty0 = prim->bbox.y / _SG_SW_TILE_SIZE;
+    const int tx1 = (prim->bbox.x + prim->bbox.w - 1) / _SG_SW_TILE_SIZE;
+    const int ty1 = (prim->bbox.y + prim->bbox.h - 1) / _SG_SW_TILE_SIZE;
+    for (int ty = ty0; ty <= ty1; ty++) {
+        for (int tx = tx0; tx <= tx1; tx++) {
+            if (prim->type == _SG_SW_PRIM_TRIANGLE) {
+                // reject tiles which are completely outside of one triangle edge
+                const int x0 = _sg_max(tx * _SG_SW_TILE_SIZE, prim->bbox.x);
+                const int y0 = _sg_max(ty * _SG_SW_TILE_SIZE, prim->bbox.y);
+                const int x1 = _sg_min((tx + 1) * _SG_SW_TILE_SIZE, prim->bbox.x + prim->bbox.w) - 1;
+                const int y1 = _sg_min((ty + 1) * _SG_SW_TILE_SIZE, prim->bbox.y + prim->bbox.h) - 1;
+                bool outside = false;
+                for (int i = 0; (i < 3) && !outside; i++) {
+                    const int64_t a = prim->edge_a[i];
+                    const int64_t b = prim->edge_b[i];
+                    const int64_t c = prim->edge_c[i] + a * 8 + b * 8;
+                    const int64_t xa = a * 16 * x0, xb = a * 16 * x1;
+                    const int64_t ya = b * 16 * y0, yb = b * 16 * y1;
+                    outside = ((xa + ya + c) < 0) && ((xb + ya + c) < 0) && ((xa + yb + c) < 0) && ((xb + yb + c) < 0);
+                }
+                if (outside) {
+                    continue;
+                }
+            }
+            _sg_sw_bin_t* bin = &_sg.sw.bins[ty * _sg.sw.pass.tiles_x + tx];
+            if (bin->num == bin->cap) {
+                const int new_cap = (bin->cap == 0) ? 256 : (bin->cap * 2);
+                const _sg_sw_prim_t** items = (const _sg_sw_prim_t**)_sg_malloc((size_t)new_cap * sizeof(_sg_sw_prim_t*));
+                if (bin->items) {
+                    memcpy((void*)items, (const void*)bin->items, (size_t)bin->num * sizeof(_sg_sw_prim_t*));
+                    _sg_free((void*)bin->items);
+                }
+                bin->items = items;
+                bin->cap = new_cap;
+            }
+            bin->items[bin->num++] = prim;
+            _sg_stats_inc(sw.num_binned);
+        }
+    }
+    _sg.sw.bins_dirty = true;
+}
+
+_SOKOL_PRIVATE _sg_sw_prim_t* _sg_sw_alloc_prim(const _sg_sw_drawctx_t* dc, _sg_sw_prim_type_t type, int num_varying_sets) {
+    const size_t size = sizeof(_sg_sw_prim_t) + (size_t)(dc->num_varyings * num_varying_sets) * sizeof(float);
+    _sg_sw_prim_t* prim = (_sg_sw_prim_t*)_sg_sw_arena_alloc(size);
+    _sg_clear(prim, sizeof(_sg_sw_prim_t));
+    prim->ds = dc->ds;
+    prim->type = type;
+    return prim;
+}
+
+// compute a plane equation relative to the bounding box origin pixel center
+_SOKOL_PRIVATE void _sg_sw_setup_plane(float* plane, const double* x, const double* y, double a0, double a1, double a2, double det, int bx, int by) {
+    const double dadx = ((a1 - a0) * (y[2] - y[0]) - (a2 - a0) * (y[1] - y[0])) / det;
+    const double dady = ((a2 - a0) * (x[1] - x[0]) - (a1 - a0) * (x[2] - x[0])) / det;
+    plane[0] = (float)(a0 + dadx * (((double)bx + 0.5) - x[0]) + dady * (((double)by + 0.5) - y[0]));
+    plane[1] = (float)dadx;
+    plane[2] = (float)dady;
+}
+
+// setup and bin a triangle which is completely inside the guard band
+_SOKOL_PRIVATE void _sg_sw_setup_triangle(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* v0, const _sg_sw_vertex_t* v1, const _sg_sw_vertex_t* v2) {
+    const _sg_pipeline_common_t* cmn = &dc->pip->cmn;
+    const _sg_sw_vertex_t* v[3] = { v0, v1, v2 };
+    float win[3][4];
+    int32_t fx[3], fy[3];
+    for (int i = 0; i < 3; i++) {
+        _sg_sw_to_window(dc, v[i], win[i]);
+        // 28.4 fixed point
+        fx[i] = (int32_t)floorf(win[i][0] * 16.0f + 0.5f);
+        fy[i] = (int32_t)floorf(win[i][1] * 16.0f + 0.5f);
+    }
+    int64_t area = (int64_t)(fx[1] - fx[0]) * (fy[2] - fy[0]) - (int64_t)(fx[2] - fx[0]) * (fy[1] - fy[0]);
+    if (area == 0) {
+        return;
+    }
+    // in window space with y pointing down, a positive area means clockwise winding
+    const bool clockwise = area > 0;
+    const bool front_facing = (cmn->face_winding == SG_FACEWINDING_CW) ? clockwise : !clockwise;
+    if ((cmn->cull_mode == SG_CULLMODE_FRONT) && front_facing) {
+        return;
+    }
+    if ((cmn->cull_mode == SG_CULLMODE_BACK) && !front_facing) {
+        return;
+    }
+    int order[3] = { 0, 1, 2 };
+    if (area < 0) {
+        order[1] = 2;
+        order[2] = 1;
+        area = -area;
+    }
+    const int32_t x[3] = { fx[order[0]], fx[order[1]], fx[order[2]] };
+    const int32_t y[3] = { fy[order[0]], fy[order[1]], fy[order[2]] };
+    // bounding box in pixels, clipped against the viewport/scissor/target rectangle
+    const int32_t min_x = _sg_min(_sg_min(x[0], x[1]), x[2]);
+    const int32_t min_y = _sg_min(_sg_min(y[0], y[1]), y[2]);
+    const int32_t max_x = _sg_max(_sg_max(x[0], x[1]), x[2]);
+    const int32_t max_y = _sg_max(_sg_max(y[0], y[1]), y[2]);
+    _SG_STRUCT(_sg_recti_t, bbox);
+    bbox.x = min_x >> 4;
+    bbox.y = min_y >> 4;
+    bbox.w = (max_x >> 4) - bbox.x + 1;
+    bbox.h = (max_y >> 4) - bbox.y + 1;
+    bbox = _sg_sw_intersect_rect(bbox, dc->ds->clip);
+    if ((bbox.w == 0) || (bbox.h == 0)) {
+        return;
+    }
+    _sg_sw_prim_t* prim = _sg_sw_alloc_prim(dc, _SG_SW_PRIM_TRIANGLE, 3);
+    prim->front_facing = front_facing;
+    prim->bbox = bbox;
+    for (int i = 0; i < 3; i++) {
+        // edge i goes from vertex (i+1)%3 to vertex (i+2)%3
+        const int ia = (i + 1) % 3;
+        const int ib = (i + 2) % 3;
+        const int32_t a = y[ia] - y[ib];
+        const int32_t b = x[ib] - x[ia];
+        int64_t c = -((int64_t)a * x[ia] + (int64_t)b * y[ia]);
+        // top-left fill rule: pixels exactly on right or bottom edges are not covered
+        if (!((a > 0) || ((a == 0) && (b > 0)))) {
+            c -= 1;
+        }
+        prim->edge_a[i] = a;
+        prim->edge_b[i] = b;
+        prim->edge_c[i] = c;
+    }
+    // interpolation planes, evaluated relative to the bounding box origin
+    const double det = (double)area / 256.0;
+    double px[3], py[3];
+    for (int i = 0; i < 3; i++) {
+        px[i] = (double)x[i] / 16.0;
+        py[i] = (double)y[i] / 16.0;
+    }
+    const float* w0 = win[order[0]];
+    const float* w1 = win[order[1]];
+    const float* w2 = win[order[2]];
+    _sg_sw_setup_plane(prim->planes[0], px, py, w0[2], w1[2], w2[2], det, bbox.x, bbox.y);
+    _sg_sw_setup_plane(prim->planes[1], px, py, w0[3], w1[3], w2[3], det, bbox.x, bbox.y);
+    _sg_sw_setup_plane(prim->planes[2], px, py, 0.0, w1[3], 0.0, det, bbox.x, bbox.y);
+    _sg_sw_setup_plane(prim->planes[3], px, py, 0.0, 0.0, w2[3], det, bbox.x, bbox.y);
+    const _sg_sw_drawstate_t* ds = dc->ds;
+    if ((ds->depth_bias != 0.0f) || (ds->depth_bias_slope_scale != 0.0f)) {
+        const float max_slope = _sg_max(fabsf(prim->planes[0][1]), fabsf(prim->planes[0][2]));
+        float bias = ds->depth_bias * (1.0f / 16777216.0f) + ds->depth_bias_slope_scale * max_slope;
+        if (ds->depth_bias_clamp > 0.0f) {
+            bias = _sg_min(bias, ds->depth_bias_clamp);
+        } else if (ds->depth_bias_clamp < 0.0f) {
+            bias = _sg_max(bias, ds->depth_bias_clamp);
+        }
+        prim->planes[0][0] += bias;
+    }
+    // varyings: v0, v1-v0, v2-v0
+    const int nv = dc->num_varyings;
+    float* dst = (float*)(prim + 1);
+    const _sg_sw_vertex_t* s0 = v[order[0]];
+    const _sg_sw_vertex_t* s1 = v[order[1]];
+    const _sg_sw_vertex_t* s2 = v[order[2]];
+    for (int i = 0; i < nv; i++) {
+        dst[i] = s0->varyings[i];
+        dst[nv + i] = s1->varyings[i] - s0->varyings[i];
+        dst[2 * nv + i] = s2->varyings[i] - s0->varyings[i];
+    }
+    _sg_stats_inc(sw.num_primitives);
+    _sg_sw_bin_prim(prim);
+}
+
+_SOKOL_PRIVATE void _sg_sw_process_triangle(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* v0, const _sg_sw_vertex_t* v1, const _sg_sw_vertex_t* v2) {
+    const uint32_t oc0 = _sg_sw_outcode(dc, v0);
+    const uint32_t oc1 = _sg_sw_outcode(dc, v1);
+    const uint32_t oc2 = _sg_sw_outcode(dc, v2);
+    sg_pipeline_stats* stats = _sg.sw.cur.stats_counter ? &_sg.sw.cur.stats_counter->sw.stats : 0;
+    if (stats) {
+        stats->clipping_input_primitives++;
+    }
+    if (oc0 & oc1 & oc2) {
+        // trivial reject
+        return;
+    }
+    const uint32_t clip_mask = oc0 | oc1 | oc2;
+    if (0 == clip_mask) {
+        if (stats) {
+            stats->clipping_output_primitives++;
+        }
+        _sg_sw_setup_triangle(dc, v0, v1, v2);
+        return;
+    }
+    // Sutherland-Hodgman polygon clipping against the planes the triangle straddles
+    _sg_sw_vertex_t buf[2][3 + _SG_SW_NUM_CLIP_PLANES];
+    int num = 3;
+    _sg_sw_copy_vertex(dc, &buf[0][0], v0);
+    _sg_sw_copy_vertex(dc, &buf[0][1], v1);
+    _sg_sw_copy_vertex(dc, &buf[0][2], v2);
+    int src = 0;
+    for (int plane = 0; plane < _SG_SW_NUM_CLIP_PLANES; plane++) {
+        if (0 == (clip_mask & (1u << plane))) {
+            continue;
+        }
+        const int dst = src ^ 1;
+        int num_out = 0;
+        for (int i = 0; i < num; i++) {
+            const _sg_sw_vertex_t* a = &buf[src][i];
+            const _sg_sw_vertex_t* b = &buf[src][(i + 1) % num];
+            const float da = _sg_sw_clip_dist(dc, plane, a->pos);
+            const float db = _sg_sw_clip_dist(dc, plane, b->pos);
+            if (da >= 0.0f) {
+                _sg_sw_copy_vertex(dc, &buf[dst][num_out++], a);
+            }
+            if ((da >= 0.0f) != (db >= 0.0f)) {
+                _sg_sw_lerp_vertex(dc, a, b, da / (da - db), &buf[dst][num_out++]);
+            }
+        }
+        num = num_out;
+        src = dst;
+        if (num < 3) {
+            return;
+        }
+    }
+    if (stats) {
+        stats->clipping_output_primitives += (uint64_t)(num - 2);
+    }
+    for (int i = 1; i < (num - 1); i++) {
+        _sg_sw_setup_triangle(dc, &buf[src][0], &buf[src][i], &buf[src][i + 1]);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_process_line(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* v0, const _sg_sw_vertex_t* v1) {
+    const uint32_t oc0 = _sg_sw_outcode(dc, v0);
+    const uint32_t oc1 = _sg_sw_outcode(dc, v1);
+    sg_pipeline_stats* stats = _sg.sw.cur.stats_counter ? &_sg.sw.cur.stats_counter->sw.stats : 0;
+    if (stats) {
+        stats->clipping_input_primitives++;
+    }
+    if (oc0 & oc1) {
+        return;
+    }
+    // parametric clipping
+    float t0 = 0.0f;
+    float t1 = 1.0f;
+    const uint32_t clip_mask = oc0 | oc1;
+    for (int plane = 0; plane < _SG_SW_NUM_CLIP_PLANES; plane++) {
+        if (clip_mask & (1u << plane)) {
+            const float da = _sg_sw_clip_dist(dc, plane, v0->pos);
+            const float db = _sg_sw_clip_dist(dc, plane, v1->pos);
+            const float t = da / (da - db);
+            if (da < 0.0f) {
+                t0 = _sg_max(t0, t);
+            } else {
+                t1 = _sg_min(t1, t);
+            }
+        }
+    }
+    if (t0 >= t1) {
+        return;
+    }
+    if (stats) {
+        stats->clipping_output_primitives++;
+    }
+    _sg_sw_vertex_t a, b;
+    _sg_sw_lerp_vertex(dc, v0, v1, t0, &a);
+    _sg_sw_lerp_vertex(dc, v0, v1, t1, &b);
+    float wa[4], wb[4];
+    _sg_sw_to_window(dc, &a, wa);
+    _sg_sw_to_window(dc, &b, wb);
+    _SG_STRUCT(_sg_recti_t, bbox);
+    bbox.x = _sg_sw_floori(_sg_min(wa[0], wb[0])) - 1;
+    bbox.y = _sg_sw_floori(_sg_min(wa[1], wb[1])) - 1;
+    bbox.w = _sg_sw_floori(_sg_max(wa[0], wb[0])) + 2 - bbox.x;
+    bbox.h = _sg_sw_floori(_sg_max(wa[1], wb[1])) + 2 - bbox.y;
+    bbox = _sg_sw_intersect_rect(bbox, dc->ds->clip);
+    if ((bbox.w == 0) || (bbox.h == 0)) {
+        return;
+    }
+    _sg_sw_prim_t* prim = _sg_sw_alloc_prim(dc, _SG_SW_PRIM_LINE, 2);
+    prim->front_facing = true;
+    prim->bbox = bbox;
+    memcpy(prim->planes[0], wa, 3 * sizeof(float));
+    memcpy(prim->planes[1], wb, 3 * sizeof(float));
+    prim->planes[2][0] = wa[3];
+    prim->planes[2][1] = wb[3];
+    const int nv = dc->num_varyings;
+    float* dst = (float*)(prim + 1);
+    for (int i = 0; i < nv; i++) {
+        dst[i] = a.varyings[i];
+        dst[nv + i] = b.varyings[i] - a.varyings[i];
+    }
+    _sg_stats_inc(sw.num_primitives);
+    _sg_sw_bin_prim(prim);
+}
+
+_SOKOL_PRIVATE void _sg_sw_process_point(const _sg_sw_drawctx_t* dc, const _sg_sw_vertex_t* v0) {
+    sg_pipeline_stats* stats = _sg.sw.cur.stats_counter ? &_sg.sw.cur.stats_counter->sw.stats : 0;
+    if (stats) {
+        stats->clipping_input_primitives++;
+    }
+    if (0 != _sg_sw_outcode(dc, v0)) {
+        return;
+    }
+    if (stats) {
+        stats->clipping_output_primitives++;
+    }
+    float win[4];
+    _sg_sw_to_window(dc, v0, win);
+    _SG_STRUCT(_sg_recti_t, bbox);
+    bbox.x = _sg_sw_floori(win[0]);
+    bbox.y = _sg_sw_floori(win[1]);
+    bbox.w = 1;
+    bbox.h = 1;
+    bbox = _sg_sw_intersect_rect(bbox, dc->ds->clip);
+    if ((bbox.w == 0) || (bbox.h == 0)) {
+        return;
+    }
+    _sg_sw_prim_t* prim = _sg_sw_alloc_prim(dc, _SG_SW_PRIM_POINT, 1);
+    prim->front_facing = true;
+    prim->bbox = bbox;
+    memcpy(prim->planes[0], win, 3 * sizeof(float));
+    prim->planes[1][0] = win[3];
+    memcpy((float*)(prim + 1), v0->varyings, (size_t)dc->num_varyings * sizeof(float));
+    _sg_stats_inc(sw.num_primitives);
+    _sg_sw_bin_prim(prim);
+}
+
+// rasterize pending work when the per-flush memory grows too big
+_SOKOL_PRIVATE void _sg_sw_check_flush(_sg_sw_drawctx_t* dc) {
+    if (_sg.sw.arena.used > _SG_SW_ARENA_FLUSH_THRESHOLD) {
+        _sg_sw_flush();
+        dc->ds = _sg_sw_drawstate();
+    }
+}
+
+_SOKOL_PRIVATE uint32_t _sg_sw_fetch_index(sg_index_type index_type, int index) {
+    if (index_type == SG_INDEXTYPE_UINT16) {
+        uint16_t val;
+        memcpy(&val, _sg.sw.cur.ib + (size_t)index * 2, sizeof(val));
+        return val;
+    } else {
+        uint32_t val;
+        memcpy(&val, _sg.sw.cur.ib + (size_t)index * 4, sizeof(val));
+        return val;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
+    if (!_sg.sw.pass.valid || (0 == _sg.sw.cur.pip)) {
+        return;
+    }
+    const _sg_pipeline_t* pip = _sg.sw.cur.pip;
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    if (0 == shd->sw.funcs.vertex_func) {
+        return;
+    }
+    const sg_index_type index_type = pip->cmn.index_type;
+    const bool indexed = index_type != SG_INDEXTYPE_NONE;
+    if (indexed && (0 == _sg.sw.cur.ib)) {
+        return;
+    }
+    const _sg_recti_t vp = _sg.sw.cur.viewport;
+    if ((vp.w <= 0) || (vp.h <= 0)) {
+        return;
+    }
+    _sg_sw_drawctx_t* dc = &_sg.sw.drawctx;
+    dc->pip = pip;
+    dc->shd = shd;
+    dc->ds = _sg_sw_drawstate();
+    dc->num_varyings = shd->sw.funcs.num_varyings;
+    dc->base_instance = base_instance;
+    dc->vp_hw = (float)vp.w * 0.5f;
+    dc->vp_hh = (float)vp.h * 0.5f;
+    dc->vp_cx = (float)vp.x + dc->vp_hw;
+    dc->vp_cy = (float)vp.y + dc->vp_hh;
+    dc->gb_left = (-_SG_SW_GUARD_BAND - dc->vp_cx) / dc->vp_hw;
+    dc->gb_right = (_SG_SW_GUARD_BAND - dc->vp_cx) / dc->vp_hw;
+    dc->gb_top = (dc->vp_cy + _SG_SW_GUARD_BAND) / dc->vp_hh;
+    dc->gb_bottom = (dc->vp_cy - _SG_SW_GUARD_BAND) / dc->vp_hh;
+    const sg_primitive_type prim_type = pip->cmn.primitive_type;
+    const bool is_strip = (prim_type == SG_PRIMITIVETYPE_TRIANGLE_STRIP) || (prim_type == SG_PRIMITIVETYPE_LINE_STRIP);
+    const uint32_t restart_index = (index_type == SG_INDEXTYPE_UINT16) ? 0xFFFF : 0xFFFFFFFF;
+    _sg_sw_vertex_t v[3];
+    for (int instance_index = 0; instance_index < num_instances; instance_index++) {
+        for (int i = 0; i < _SG_SW_VCACHE_SIZE; i++) {
+            dc->cache_tags[i] = INT32_MIN;
+        }
+        int n = 0;  // number of vertices in current primitive or strip
+        for (int i = 0; i < num_elements; i++) {
+            int vertex_index;
+            if (indexed) {
+                const uint32_t index = _sg_sw_fetch_index(index_type, base_element + i);
+                if (is_strip && (index == restart_index)) {
+                    n = 0;
+                    continue;
+                }
+                vertex_index = (int)index + base_vertex;
+            } else {
+                vertex_index = base_element + i;
+            }
+            _sg_sw_check_flush(dc);
+            switch (prim_type) {
+                case SG_PRIMITIVETYPE_POINTS:
+                    _sg_sw_get_vertex(dc, indexed, vertex_index, instance_index, &v[0]);
+                    _sg_sw_process_point(dc, &v[0]);
+                    break;
+                case SG_PRIMITIVETYPE_LINES:
+                    _sg_sw_get_vertex(dc, indexed, vertex_index, instance_index, &v[n]);
+                    if (++n == 2) {
+                        _sg_sw_process_line(dc, &v[0], &v[1]);
+                        n = 0;
+                    }
+                    break;
+                case SG_PRIMITIVETYPE_LINE_STRIP:
+                    _sg_sw_get_vertex(dc, indexed, vertex_index, instance_index, &v[n > 0 ? 1 : 0]);
+                    if (n > 0) {
+                        _sg_sw_process_line(dc, &v[0], &v[1]);
+                        _sg_sw_copy_vertex(dc, &v[0], &v[1]);
+                    }
+                    n++;
+                    break;
+                case SG_PRIMITIVETYPE_TRIANGLE_STRIP:
+                    _sg_sw_get_vertex(dc, indexed, vertex_index, instance_index, &v[n >= 2 ? 2 : n]);
+                    if (n >= 2) {
+                        // every other triangle has flipped winding
+                        if ((n & 1) == 0) {
+                            _sg_sw_process_triangle(dc, &v[0], &v[1], &v[2]);
+                        } else {
+                            _sg_sw_process_triangle(dc, &v[1], &v[0], &v[2]);
+                        }
+                        _sg_sw_copy_vertex(dc, &v[0], &v[1]);
+                        _sg_sw_copy_vertex(dc, &v[1], &v[2]);
+                    }
+                    n++;
+                    break;
+                default:
+                    _sg_sw_get_vertex(dc, indexed, vertex_index, instance_index, &v[n]);
+                    if (++n == 3) {
+                        _sg_sw_process_triangle(dc, &v[0], &v[1], &v[2]);
+                        n = 0;
+                    }
+                    break;
+            }
+        }
+    }
+}
+
+//-- compute -------------------------------------------------------------------
+_SOKOL_PRIVATE void _sg_sw_dispatch_job(int item_index, int thread_index) {
+    _SOKOL_UNUSED(thread_index);
+    const int first = item_index * _sg.sw.dispatch.groups_per_item;
+    const int last = _sg_min(first + _sg.sw.dispatch.groups_per_item, _sg.sw.dispatch.num_groups_total);
+    const int nx = _sg.sw.dispatch.num_groups[0];
+    const int ny = _sg.sw.dispatch.num_groups[1];
+    sg_sw_workgroup wg;
+    wg.num[0] = nx;
+    wg.num[1] = ny;
+    wg.num[2] = _sg.sw.dispatch.num_groups[2];
+    for (int i = first; i < last; i++) {
+        wg.id[0] = i % nx;
+        wg.id[1] = (i / nx) % ny;
+        wg.id[2] = i / (nx * ny);
+        _sg.sw.dispatch.func(_sg.sw.dispatch.ctx, &wg);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
+    if (0 == _sg.sw.cur.pip) {
+        return;
+    }
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&_sg.sw.cur.pip->cmn.shader);
+    if (0 == shd->sw.funcs.compute_func) {
+        return;
+    }
+    const int num_groups_total = num_groups_x * num_groups_y * num_groups_z;
+    if (num_groups_total <= 0) {
+        return;
+    }
+    sg_sw_shader_context ctx;
+    _sg_sw_init_shader_context(&ctx, shd, &_sg.sw.cur.bnd);
+    _sg.sw.dispatch.func = shd->sw.funcs.compute_func;
+    _sg.sw.dispatch.ctx = &ctx;
+    _sg.sw.dispatch.num_groups[0] = num_groups_x;
+    _sg.sw.dispatch.num_groups[1] = num_groups_y;
+    _sg.sw.dispatch.num_groups[2] = num_groups_z;
+    _sg.sw.dispatch.num_groups_total = num_groups_total;
+    // split workgroups into enough items for load balancing
+    _sg.sw.dispatch.groups_per_item = _sg_max(1, num_groups_total / (_sg.sw.pool.num_threads * 8));
+    const int num_items = (num_groups_total + _sg.sw.dispatch.groups_per_item - 1) / _sg.sw.dispatch.groups_per_item;
+    _sg_sw_run_job(_sg_sw_dispatch_job, num_items);
+    _sg.sw.dispatch.ctx = 0;
+    _sg_stats_add(sw.num_workgroups, (uint32_t)num_groups_total);
+    if (_sg.sw.cur.stats_counter) {
+        _sg.sw.cur.stats_counter->sw.stats.compute_invocations += (uint64_t)num_groups_total;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_dispatch_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf && buf->sw.data);
+    SOKOL_ASSERT((offset >= 0) && (offset <= (buf->cmn.size - 3 * (int)sizeof(uint32_t))));
+    // all work of previous dispatches has finished at this point, so the
+    // workgroup counts can be read directly from the buffer memory
+    uint32_t num_groups[3];
+    memcpy(num_groups, buf->sw.data + offset, sizeof(num_groups));
+    if ((num_groups[0] == 0) || (num_groups[1] == 0) || (num_groups[2] == 0)) {
+        return;
+    }
+    if ((num_groups[0] >= (1<<16)) || (num_groups[1] >= (1<<16)) || (num_groups[2] >= (1<<16))) {
+        _SG_WARN(SOFTWARE_DISPATCH_INDIRECT_NUMGROUPS);
+        return;
+    }
+    _sg_sw_dispatch((int)num_groups[0], (int)num_groups[1], (int)num_groups[2]);
+}
+
+//-- GPU counters --------------------------------------------------------------
+_SOKOL_PRIVATE uint64_t _sg_sw_counter_thread_counts(const _sg_counter_t* ctr) {
+    uint64_t count = 0;
+    for (int i = 0; i < _sg.sw.pool.num_threads; i++) {
+        count += ctr->sw.counts[i];
+    }
+    return count;
+}
+
+// a recording from a previous frame is complete since sg_end_pass() rasterizes all binned primitives
+_SOKOL_PRIVATE void _sg_sw_counter_result(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    if (ctr->cmn.recorded && (ctr->cmn.begin_frame_index != _sg.frame_index)) {
+        ctr->cmn.result.available = true;
+        ctr->cmn.result.frame_index = ctr->cmn.begin_frame_index;
+        if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+            ctr->cmn.result.pipeline_stats = ctr->sw.stats;
+            ctr->cmn.result.pipeline_stats.fragment_invocations = _sg_sw_counter_thread_counts(ctr);
+        } else {
+            ctr->cmn.result.samples_passed = _sg_sw_counter_thread_counts(ctr);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_begin_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    // keep the previous result around before the counters are reset
+    _sg_sw_counter_result(ctr);
+    _sg_clear(ctr->sw.counts, sizeof(ctr->sw.counts));
+    _sg_clear(&ctr->sw.stats, sizeof(ctr->sw.stats));
+    if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+        _sg.sw.cur.stats_counter = ctr;
+    } else {
+        _sg.sw.cur.occlusion_counter = ctr;
+    }
+    _sg.sw.cur.ds = 0;
+}
+
+_SOKOL_PRIVATE void _sg_sw_end_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+        _sg.sw.cur.stats_counter = 0;
+    } else {
+        _sg.sw.cur.occlusion_counter = 0;
+    }
+    _sg.sw.cur.ds = 0;
+}
+
+//-- resource updates ----------------------------------------------------------
+_SOKOL_PRIVATE void _sg_sw_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _sg_sw_flush_pending();
+    memcpy(buf->sw.data, data->ptr, data->size);
+    if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+        buf->cmn.active_slot = 0;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_append_buffer(_sg_buffer_t* buf, const sg_range* data, bool new_frame) {
+    SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
+    _sg_sw_flush_pending();
+    memcpy(buf->sw.data + buf->cmn.append_pos, data->ptr, data->size);
+    if (new_frame) {
+        if (++buf->cmn.active_slot >= buf->cmn.num_slots) {
+            buf->cmn.active_slot = 0;
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_sw_update_image(_sg_image_t* img, const sg_image_data* data) {
+    SOKOL_ASSERT(img && data);
+    _sg_sw_flush_pending();
+    _sg_sw_copy_image_data(img, data);
+    if (++img->cmn.active_slot >= img->cmn.num_slots) {
+        img->cmn.active_slot = 0;
+    }
+}
+
+_SOKOL_PRIVATE bool _sg_sw_read_image(_sg_image_t* img, int mip_level, int slice, const sg_range* data) {
+    SOKOL_ASSERT(img && data && data->ptr);
+    _sg_sw_flush_pending();
+    const size_t num_bytes = _sg_sw_mip_slice_size(img, mip_level);
+    if (data->size < num_bytes) {
+        _SG_ERROR(SOFTWARE_READ_IMAGE_BUFFER_TOO_SMALL);
+        return false;
+    }
+    memcpy((void*)data->ptr, img->sw.pixels + img->sw.mip_offsets[mip_level] + (size_t)slice * num_bytes, num_bytes);
+    return true;
+}
+
+//  ██████  ██████  ███████ ███    ██  ██████  ██          ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
+// ██    ██ ██   ██ ██      ████   ██ ██       ██          ██   ██ ██   ██ ██      ██  ██  ██      ████   ██ ██   ██
+// ██    ██ ██████  █████   ██ ██  ██ ██   ███ ██          ██████  ███████ ██      █████   █████   ██ ██  ██ ██   ██
+// ██    ██ ██      ██      ██  ██ ██ ██    ██ ██          ██   ██ ██   ██ ██      ██  ██  ██      ██  ██ ██ ██   ██
+//  ██████  ██      ███████ ██   ████  ██████  ███████     ██████  ██   ██  ██████ ██   ██ ███████ ██   ████ ██████
+//
+// >>opengl backend
+#elif defined(_SOKOL_ANY_GL)
+
+// optional GL loader for win32
+#if defined(_SOKOL_USE_WIN32_GL_LOADER)
+
+#ifndef SG_GL_FUNCS_EXT
+#define SG_GL_FUNCS_EXT
+#endif
+
+// X Macro list of GL function names and signatures
+#define _SG_GL_FUNCS \
+    SG_GL_FUNCS_EXT \
+    _SG_XMACRO(glBindVertexArray,                 void, (GLuint array)) \
+    _SG_XMACRO(glFramebufferTextureLayer,         void, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)) \
+    _SG_XMACRO(glGenFramebuffers,                 void, (GLsizei n, GLuint * framebuffers)) \
+    _SG_XMACRO(glBindFramebuffer,                 void, (GLenum target, GLuint framebuffer)) \
+    _SG_XMACRO(glBindRenderbuffer,                void, (GLenum target, GLuint renderbuffer)) \
+    _SG_XMACRO(glGetStringi,                      const GLubyte *, (GLenum name, GLuint index)) \
+    _SG_XMACRO(glClearBufferfi,                   void, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)) \
+    _SG_XMACRO(glClearBufferfv,                   void, (GLenum buffer, GLint drawbuffer, const GLfloat * value)) \
+    _SG_XMACRO(glClearBufferuiv,                  void, (GLenum buffer, GLint drawbuffer, const GLuint * value)) \
+    _SG_XMACRO(glClearBufferiv,                   void, (GLenum buffer, GLint drawbuffer, const GLint * value)) \
+    _SG_XMACRO(glDeleteRenderbuffers,             void, (GLsizei n, const GLuint * renderbuffers)) \
+    _SG_XMACRO(glUniform1fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
+    _SG_XMACRO(glUniform2fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
+    _SG_XMACRO(glUniform3fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
+    _SG_XMACRO(glUniform4fv,                      void, (GLint location, GLsizei count, const GLfloat * value)) \
+    _SG_XMACRO(glUniform1iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
+    _SG_XMACRO(glUniform2iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
+    _SG_XMACRO(glUniform3iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
+    _SG_XMACRO(glUniform4iv,                      void, (GLint location, GLsizei count, const GLint * value)) \
+    _SG_XMACRO(glUniformMatrix4fv,                void, (GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)) \
+    _SG_XMACRO(glUseProgram,                      void, (GLuint program)) \
+    _SG_XMACRO(glShaderSource,                    void, (GLuint shader, GLsizei count, const GLchar *const* string, const GLint * length)) \
+    _SG_XMACRO(glLinkProgram,                     void, (GLuint program)) \
+    _SG_XMACRO(glGetUniformLocation,              GLint, (GLuint program, const GLchar * name)) \
+    _SG_XMACRO(glGetUniformBlockIndex,            GLuint, (GLuint program, const GLchar * uniformBlockName)) \
+    _SG_XMACRO(glUniformBlockBinding,             void, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)) \
+    _SG_XMACRO(glGetShaderiv,                     void, (GLuint shader, GLenum pname, GLint * params)) \
+    _SG_XMACRO(glGetProgramInfoLog,               void, (GLuint program, GLsizei bufSize, GLsizei * length, GLchar * infoLog)) \
+    _SG_XMACRO(glGetAttribLocation,               GLint, (GLuint program, const GLchar * name)) \
+    _SG_XMACRO(glDisableVertexAttribArray,        void, (GLuint index)) \
+    _SG_XMACRO(glDeleteShader,                    void, (GLuint shader)) \
+    _SG_XMACRO(glDeleteProgram,                   void, (GLuint program)) \
+    _SG_XMACRO(glCompileShader,                   void, (GLuint shader)) \
+    _SG_XMACRO(glStencilFuncSeparate,             void, (GLenum face, GLenum func, GLint ref, GLuint mask)) \
+    _SG_XMACRO(glStencilOpSeparate,               void, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)) \
+    _SG_XMACRO(glRenderbufferStorageMultisample,  void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)) \
+    _SG_XMACRO(glDrawBuffers,                     void, (GLsizei n, const GLenum * bufs)) \
+    _SG_XMACRO(glVertexAttribDivisor,             void, (GLuint index, GLuint divisor)) \
+    _SG_XMACRO(glBufferSubData,                   void, (GLenum target, GLintptr offset, GLsizeiptr size, const void * data)) \
+    _SG_XMACRO(glGenBuffers,                      void, (GLsizei n, GLuint * buffers)) \
+    _SG_XMACRO(glCheckFramebufferStatus,          GLenum, (GLenum target)) \
+    _SG_XMACRO(glFramebufferRenderbuffer,         void, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)) \
+    _SG_XMACRO(glCompressedTexImage2D,            void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void * data)) \
+    _SG_XMACRO(glCompressedTexImage3D,            void, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void * data)) \
+    _SG_XMACRO(glActiveTexture,                   void, (GLenum texture)) \
+    _SG_XMACRO(glTexSubImage3D,                   void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void * pixels)) \
+    _SG_XMACRO(glRenderbufferStorage,             void, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)) \
+    _SG_XMACRO(glGenTextures,                     void, (GLsizei n, GLuint * textures)) \
+    _SG_XMACRO(glPolygonOffset,                   void, (GLfloat factor, GLfloat units)) \
+    _SG_XMACRO(glDrawElements,                    void, (GLenum mode, GLsizei count, GLenum type, const void * indices)) \
+    _SG_XMACRO(glDeleteFramebuffers,              void, (GLsizei n, const GLuint * framebuffers)) \
+    _SG_XMACRO(glBlendEquationSeparate,           void, (GLenum modeRGB, GLenum modeAlpha)) \
+    _SG_XMACRO(glDeleteTextures,                  void, (GLsizei n, const GLuint * textures)) \
+    _SG_XMACRO(glGetProgramiv,                    void, (GLuint program, GLenum pname, GLint * params)) \
+    _SG_XMACRO(glBindTexture,                     void, (GLenum target, GLuint texture)) \
+    _SG_XMACRO(glTexImage3D,                      void, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void * pixels)) \
+    _SG_XMACRO(glCreateShader,                    GLuint, (GLenum type)) \
+    _SG_XMACRO(glTexSubImage2D,                   void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void * pixels)) \
+    _SG_XMACRO(glFramebufferTexture2D,            void, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)) \
+    _SG_XMACRO(glCreateProgram,                   GLuint, (void)) \
+    _SG_XMACRO(glViewport,                        void, (GLint x, GLint y, GLsizei width, GLsizei height)) \
+    _SG_XMACRO(glDeleteBuffers,                   void, (GLsizei n, const GLuint * buffers)) \
+    _SG_XMACRO(glDrawArrays,                      void, (GLenum mode, GLint first, GLsizei count)) \
+    _SG_XMACRO(glDrawElementsInstanced,           void, (GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount)) \
+    _SG_XMACRO(glVertexAttribPointer,             void, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer)) \
+    _SG_XMACRO(glVertexAttribIPointer,            void, (GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer)) \
+    _SG_XMACRO(glUniform1i,                       void, (GLint location, GLint v0)) \
+    _SG_XMACRO(glDisable,                         void, (GLenum cap)) \
+    _SG_XMACRO(glColorMask,                       void, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)) \
+    _SG_XMACRO(glColorMaski,                      void, (GLuint buf, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)) \
+    _SG_XMACRO(glBindBuffer,                      void, (GLenum target, GLuint buffer)) \
+    _SG_XMACRO(glDeleteVertexArrays,              void, (GLsizei n, const GLuint * arrays)) \
+    _SG_XMACRO(glDepthMask,                       void, (GLboolean flag)) \
+    _SG_XMACRO(glDrawArraysInstanced,             void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount)) \
+    _SG_XMACRO(glScissor,                         void, (GLint x, GLint y, GLsizei width, GLsizei height)) \
+    _SG_XMACRO(glGenRenderbuffers,                void, (GLsizei n, GLuint * renderbuffers)) \
+    _SG_XMACRO(glBufferData,                      void, (GLenum target, GLsizeiptr size, const void * data, GLenum usage)) \
+    _SG_XMACRO(glBlendFuncSeparate,               void, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)) \
+    _SG_XMACRO(glTexParameteri,                   void, (GLenum target, GLenum pname, GLint param)) \
+    _SG_XMACRO(glGetIntegerv,                     void, (GLenum pname, GLint * data)) \
+    _SG_XMACRO(glEnable,                          void, (GLenum cap)) \
+    _SG_XMACRO(glBlitFramebuffer,                 void, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)) \
+    _SG_XMACRO(glStencilMask,                     void, (GLuint mask)) \
+    _SG_XMACRO(glAttachShader,                    void, (GLuint program, GLuint shader)) \
+    _SG_XMACRO(glGetError,                        GLenum, (void)) \
+    _SG_XMACRO(glBlendColor,                      void, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)) \
+    _SG_XMACRO(glTexParameterf,                   void, (GLenum target, GLenum pname, GLfloat param)) \
+    _SG_XMACRO(glTexParameterfv,                  void, (GLenum target, GLenum pname, const GLfloat* params)) \
+    _SG_XMACRO(glGetShaderInfoLog,                void, (GLuint shader, GLsizei bufSize, GLsizei * length, GLchar * infoLog)) \
+    _SG_XMACRO(glDepthFunc,                       void, (GLenum func)) \
+    _SG_XMACRO(glStencilOp ,                      void, (GLenum fail, GLenum zfail, GLenum zpass)) \
+    _SG_XMACRO(glStencilFunc,                     void, (GLenum func, GLint ref, GLuint mask)) \
+    _SG_XMACRO(glEnableVertexAttribArray,         void, (GLuint index)) \
+    _SG_XMACRO(glBlendFunc,                       void, (GLenum sfactor, GLenum dfactor)) \
+    _SG_XMACRO(glReadBuffer,                      void, (GLenum src)) \
+    _SG_XMACRO(glTexImage2D,                      void, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void * pixels)) \
+    _SG_XMACRO(glGenVertexArrays,                 void, (GLsizei n, GLuint * arrays)) \
+    _SG_XMACRO(glFrontFace,                       void, (GLenum mode)) \
+    _SG_XMACRO(glCullFace,                        void, (GLenum mode)) \
+    _SG_XMACRO(glPixelStorei,                     void, (GLenum pname, GLint param)) \
+    _SG_XMACRO(glBindSampler,                     void, (GLuint unit, GLuint sampler)) \
+    _SG_XMACRO(glGenSamplers,                     void, (GLsizei n, GLuint* samplers)) \
+    _SG_XMACRO(glSamplerParameteri,               void, (GLuint sampler, GLenum pname, GLint param)) \
+    _SG_XMACRO(glSamplerParameterf,               void, (GLuint sampler, GLenum pname, GLfloat param)) \
+    _SG_XMACRO(glSamplerParameterfv,              void, (GLuint sampler, GLenum pname, const GLfloat* params)) \
+    _SG_XMACRO(glDeleteSamplers,                  void, (GLsizei n, const GLuint* samplers)) \
+    _SG_XMACRO(glBindBufferBase,                  void, (GLenum target, GLuint index, GLuint buffer)) \
+    _SG_XMACRO(glBindBufferRange,                 void, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)) \
+    _SG_XMACRO(glTexImage2DMultisample,           void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)) \
+    _SG_XMACRO(glTexImage3DMultisample,           void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)) \
+    _SG_XMACRO(glDispatchCompute,                 void, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)) \
+    _SG_XMACRO(glDispatchComputeIndirect,         void, (GLintptr indirect)) \
+    _SG_XMACRO(glMemoryBarrier,                   void, (GLbitfield barriers)) \
+    _SG_XMACRO(glBindImageTexture,                void, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)) \
+    _SG_XMACRO(glTexStorage2DMultisample,         void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)) \
+    _SG_XMACRO(glTexStorage2D,                    void, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)) \
+    _SG_XMACRO(glTexStorage3DMultisample,         void, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)) \
+    _SG_XMACRO(glTexStorage3D,                    void, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)) \
+    _SG_XMACRO(glCompressedTexSubImage2D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)) \
+    _SG_XMACRO(glCompressedTexSubImage3D,         void, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)) \
+    _SG_XMACRO(glTextureView,                     void, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)) \
+    _SG_XMACRO(glDrawElementsBaseVertex,          void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex)) \
+    _SG_XMACRO(glMultiDrawElementsBaseVertex,     void, (GLenum mode, const GLsizei* count, GLenum type, const void* const* indices, GLsizei drawcount, const GLint* basevertex)) \
+    _SG_XMACRO(glMultiDrawArrays,                 void, (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount)) \
+    _SG_XMACRO(glDrawElementsInstancedBaseVertex, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex)) \
+    _SG_XMACRO(glDrawElementsInstancedBaseVertexBaseInstance, void, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance)) \
+    _SG_XMACRO(glDrawArraysInstancedBaseInstance, void, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance)) \
+    _SG_XMACRO(glMapBufferRange,                  void*, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)) \
+    _SG_XMACRO(glFenceSync,                       GLsync, (GLenum condition, GLbitfield flags)) \
+    _SG_XMACRO(glClientWaitSync,                  GLenum, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glWaitSync,                        void, (GLsync sync, GLbitfield flags, GLuint64 timeout)) \
+    _SG_XMACRO(glDeleteSync,                      void, (GLsync sync)) \
+    _SG_XMACRO(glGenQueries,                      void, (GLsizei n, GLuint* ids)) \
+    _SG_XMACRO(glDeleteQueries,                   void, (GLsizei n, const GLuint* ids)) \
+    _SG_XMACRO(glBeginQuery,                      void, (GLenum target, GLuint id)) \
+    _SG_XMACRO(glEndQuery,                        void, (GLenum target)) \
+    _SG_XMACRO(glGetQueryObjectuiv,               void, (GLuint id, GLenum pname, GLuint* params))
+
+// X Macro list of optional GL functions (may be null, the caller must check the related sg_features flag)
+#define _SG_GL_OPTIONAL_FUNCS \
+    _SG_XMACRO(glBindTextures,                    void, (GLuint first, GLsizei count, const GLuint* textures)) \
+    _SG_XMACRO(glBindSamplers,                    void, (GLuint first, GLsizei count, const GLuint* samplers)) \
+    _SG_XMACRO(glBindBuffersRange,                void, (GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes)) \
+    _SG_XMACRO(glBufferStorage,                   void, (GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)) \
+    _SG_XMACRO(glInvalidateFramebuffer,           void, (GLenum target, GLsizei numAttachments, const GLenum* attachments))
+
+// generate GL function pointer typedefs
+#define _SG_XMACRO(name, ret, args) typedef ret (GL_APIENTRY* PFN_ ## name) args;
+_SG_GL_FUNCS
+_SG_GL_OPTIONAL_FUNCS
+#undef _SG_XMACRO
+
+// generate GL function pointers
+#define _SG_XMACRO(name, ret, args) static PFN_ ## name name;
+_SG_GL_FUNCS
+_SG_GL_OPTIONAL_FUNCS
+#undef _SG_XMACRO
+
+// helper function to lookup GL functions in GL DLL
+typedef PROC (WINAPI * _sg_wglGetProcAddress)(LPCSTR);
+_SOKOL_PRIVATE void* _sg_gl_getprocaddr_optional(const char* name, _sg_wglGetProcAddress wgl_getprocaddress) {
+    void* proc_addr = (void*) wgl_getprocaddress(name);
+    if (0 == proc_addr) {
+        proc_addr = (void*) GetProcAddress(_sg.gl.opengl32_dll, name);
+    }
+    return proc_addr;
+}
+
+_SOKOL_PRIVATE void* _sg_gl_getprocaddr(const char* name, _sg_wglGetProcAddress wgl_getprocaddress) {
+    void* proc_addr = _sg_gl_getprocaddr_optional(name, wgl_getprocaddress);
+    SOKOL_ASSERT(proc_addr);
+    return proc_addr;
+}
+
+// populate GL function pointers
+_SOKOL_PRIVATE  void _sg_gl_load_opengl(void) {
+    SOKOL_ASSERT(0 == _sg.gl.opengl32_dll);
+    _sg.gl.opengl32_dll = LoadLibraryA("opengl32.dll");
+    SOKOL_ASSERT(_sg.gl.opengl32_dll);
+    _sg_wglGetProcAddress wgl_getprocaddress = (_sg_wglGetProcAddress) GetProcAddress(_sg.gl.opengl32_dll, "wglGetProcAddress");
+    SOKOL_ASSERT(wgl_getprocaddress);
+    #define _SG_XMACRO(name, ret, args) name = (PFN_ ## name) _sg_gl_getprocaddr(#name, wgl_getprocaddress);
+    _SG_GL_FUNCS
+    #undef _SG_XMACRO
+    #define _SG_XMACRO(name, ret, args) name = (PFN_ ## name) _sg_gl_getprocaddr_optional(#name, wgl_getprocaddress);
+    _SG_GL_OPTIONAL_FUNCS
+    #undef _SG_XMACRO
+}
+
+_SOKOL_PRIVATE void _sg_gl_unload_opengl(void) {
+    SOKOL_ASSERT(_sg.gl.opengl32_dll);
+    FreeLibrary(_sg.gl.opengl32_dll);
+    _sg.gl.opengl32_dll = 0;
+}
+#endif // _SOKOL_USE_WIN32_GL_LOADER
 
 //-- type translation ----------------------------------------------------------
 _SOKOL_PRIVATE GLenum _sg_gl_buffer_target(const sg_buffer_usage* usg) {
@@ -9282,6 +14463,8 @@ _SOKOL_PRIVATE GLenum _sg_gl_buffer_target(const sg_buffer_usage* usg) {
         return GL_ELEMENT_ARRAY_BUFFER;
     } else if (usg->storage_buffer) {
         return GL_SHADER_STORAGE_BUFFER;
+    } else if (usg->uniform_buffer) {
+        return GL_UNIFORM_BUFFER;
     } else {
         SOKOL_UNREACHABLE; return 0;
     }
@@ -9999,6 +15182,10 @@ _SOKOL_PRIVATE void _sg_gl_init_limits(void) {
     _SG_GL_CHECK_ERROR();
     _sg.limits.gl_max_vertex_uniform_components = gl_int;
 
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &gl_int);
+    _SG_GL_CHECK_ERROR();
+    _sg.limits.uniform_buffer_offset_alignment = gl_int;
+
     if (_sg.gl.ext_anisotropic) {
         glGetIntegerv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &gl_int);
         _SG_GL_CHECK_ERROR();
@@ -10026,6 +15213,9 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
     _sg.features.mrt_independent_blend_state = false;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.compute = version >= 430;
+    _sg.features.dispatch_indirect = version >= 430;
+    _sg.features.occlusion_counter = true;
+    _sg.features.uniform_buffer_bindings = true;
     _sg.features.gl_texture_views = version >= 430;
     #if defined(__APPLE__)
     _sg.features.msaa_texture_bindings = false;
@@ -10043,6 +15233,10 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
     bool has_bptc = false;  // BC6H and BC7
     bool has_etc2 = false;
     bool has_astc = false;
+    bool has_multi_bind = version >= 440;
+    bool has_buffer_storage = version >= 440;
+    bool has_invalidate_framebuffer = version >= 430;
+    bool has_pipeline_statistics = version >= 460;
     GLint num_ext = 0;
     glGetIntegerv(GL_NUM_EXTENSIONS, &num_ext);
     for (int i = 0; i < num_ext; i++) {
@@ -10060,9 +15254,44 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_glcore(void) {
                 _sg.gl.ext_anisotropic = true;
             } else if (strstr(ext, "_texture_compression_astc_ldr")) {
                 has_astc = true;
+            } else if (strstr(ext, "_ARB_multi_bind")) {
+                has_multi_bind = true;
+            } else if (strstr(ext, "_ARB_buffer_storage")) {
+                has_buffer_storage = true;
+            } else if (strstr(ext, "_ARB_invalidate_subdata")) {
+                has_invalidate_framebuffer = true;
+            } else if (strstr(ext, "_parallel_shader_compile")) {
+                _sg.features.parallel_shader_compile = true;
+            } else if (strstr(ext, "_ARB_pipeline_statistics_query")) {
+                has_pipeline_statistics = true;
             }
         }
     }
+    _sg.features.pipeline_statistics_counter = has_pipeline_statistics;
+    #if defined(_SOKOL_GL_HAS_MULTIBIND)
+    _sg.features.gl_multi_bind = has_multi_bind;
+    #if defined(_SOKOL_USE_WIN32_GL_LOADER)
+    _sg.features.gl_multi_bind &= (0 != glBindTextures) && (0 != glBindSamplers) && (0 != glBindBuffersRange);
+    #endif
+    #else
+    _SOKOL_UNUSED(has_multi_bind);
+    #endif
+    #if defined(_SOKOL_GL_HAS_BUFFERSTORAGE)
+    _sg.gl.persistent_stream_buffers = has_buffer_storage;
+    #if defined(_SOKOL_USE_WIN32_GL_LOADER)
+    _sg.gl.persistent_stream_buffers &= (0 != glBufferStorage);
+    #endif
+    #else
+    _SOKOL_UNUSED(has_buffer_storage);
+    #endif
+    #if defined(_SOKOL_GL_HAS_INVALIDATEFRAMEBUFFER)
+    _sg.gl.invalidate_framebuffer = has_invalidate_framebuffer;
+    #if defined(_SOKOL_USE_WIN32_GL_LOADER)
+    _sg.gl.invalidate_framebuffer &= (0 != glInvalidateFramebuffer);
+    #endif
+    #else
+    _SOKOL_UNUSED(has_invalidate_framebuffer);
+    #endif
 
     // limits
     _sg_gl_init_limits();
@@ -10153,6 +15382,9 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
     _sg.features.mrt_independent_write_mask = false;
     #endif
     _sg.features.compute = version >= 310;
+    _sg.features.dispatch_indirect = version >= 310;
+    _sg.features.occlusion_counter = true;
+    _sg.features.uniform_buffer_bindings = true;
     _sg.features.msaa_texture_bindings = false;
     _sg.features.gl_texture_views = version >= 430;
     #if defined(__EMSCRIPTEN__)
@@ -10164,6 +15396,7 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
     _sg.features.draw_base_instance = false;
     _sg.features.dual_source_blending = false;
     _sg.features.vertexformat_int10_n2 = true;
+    _sg.gl.invalidate_framebuffer = true;
 
     bool has_s3tc = false;  // BC1..BC3
     bool has_rgtc = false;  // BC4 and BC5
@@ -10205,6 +15438,8 @@ _SOKOL_PRIVATE void _sg_gl_init_caps_gles3(void) {
                 has_float_blend = true;
             } else if (strstr(ext, "_texture_filter_anisotropic")) {
                 _sg.gl.ext_anisotropic = true;
+            } else if (strstr(ext, "_parallel_shader_compile")) {
+                _sg.features.parallel_shader_compile = true;
             }
         }
     }
@@ -10279,19 +15514,48 @@ _SOKOL_PRIVATE void _sg_gl_cache_clear_buffer_bindings(bool force) {
         _sg.gl.cache.storage_buffer = 0;
         _sg_stats_inc(gl.num_bind_buffer);
     }
+    if (force || (_sg.gl.cache.uniform_buffer != 0)) {
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        _sg.gl.cache.uniform_buffer = 0;
+        _sg_stats_inc(gl.num_bind_buffer);
+    }
+    if (force || (_sg.gl.cache.dispatch_indirect_buffer != 0)) {
+        if (_sg.features.dispatch_indirect) {
+            glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+        }
+        _sg.gl.cache.dispatch_indirect_buffer = 0;
+        _sg_stats_inc(gl.num_bind_buffer);
+    }
     for (int i = 0; i < _SG_GL_MAX_SBUF_BINDINGS; i++) {
         if (force || (_sg.gl.cache.storage_buffers[i] != 0)) {
             if (_sg.features.compute && (i < _sg.limits.max_storage_buffer_bindings_per_stage)) {
                 glBindBufferBase(GL_SHADER_STORAGE_BUFFER, (GLuint)i, 0);
             }
             _sg.gl.cache.storage_buffers[i] = 0;
+            _sg.gl.cache.storage_buffer_sizes[i] = 0;
+            _sg_stats_inc(gl.num_bind_buffer);
+        }
+    }
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        if (force || (_sg.gl.cache.uniform_buffers[i] != 0)) {
+            glBindBufferBase(GL_UNIFORM_BUFFER, (GLuint)i, 0);
+            _sg.gl.cache.uniform_buffers[i] = 0;
+            _sg.gl.cache.uniform_buffer_offsets[i] = 0;
+            _sg.gl.cache.uniform_buffer_sizes[i] = 0;
             _sg_stats_inc(gl.num_bind_buffer);
         }
     }
 }
 
 _SOKOL_PRIVATE void _sg_gl_cache_bind_buffer(GLenum target, GLuint buffer) {
-    SOKOL_ASSERT((GL_ARRAY_BUFFER == target) || (GL_ELEMENT_ARRAY_BUFFER == target) || (GL_SHADER_STORAGE_BUFFER == target));
+    SOKOL_ASSERT((GL_ARRAY_BUFFER == target) || (GL_ELEMENT_ARRAY_BUFFER == target) || (GL_SHADER_STORAGE_BUFFER == target) || (GL_UNIFORM_BUFFER == target) || (GL_DISPATCH_INDIRECT_BUFFER == target));
+    #if defined(SOKOL_LOADER_THREADS)
+    // the state cache belongs to the render thread's GL context
+    if (_sg_on_loader_thread()) {
+        glBindBuffer(target, buffer);
+        return;
+    }
+    #endif
     if (target == GL_ARRAY_BUFFER) {
         if (_sg.gl.cache.vertex_buffer != buffer) {
             _sg.gl.cache.vertex_buffer = buffer;
@@ -10312,6 +15576,18 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_buffer(GLenum target, GLuint buffer) {
             }
             _sg_stats_inc(gl.num_bind_buffer);
         }
+    } else if (target == GL_UNIFORM_BUFFER) {
+        if (_sg.gl.cache.uniform_buffer != buffer) {
+            _sg.gl.cache.uniform_buffer = buffer;
+            glBindBuffer(target, buffer);
+            _sg_stats_inc(gl.num_bind_buffer);
+        }
+    } else if (target == GL_DISPATCH_INDIRECT_BUFFER) {
+        if (_sg.gl.cache.dispatch_indirect_buffer != buffer) {
+            _sg.gl.cache.dispatch_indirect_buffer = buffer;
+            glBindBuffer(target, buffer);
+            _sg_stats_inc(gl.num_bind_buffer);
+        }
     } else {
         SOKOL_UNREACHABLE;
     }
@@ -10325,6 +15601,7 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_storage_buffer(uint8_t glsl_binding_n, GLu
     if  (buf_neql || off_neql) {
         _sg.gl.cache.storage_buffers[glsl_binding_n] = buffer;
         _sg.gl.cache.storage_buffer_offsets[glsl_binding_n] = offset;
+        _sg.gl.cache.storage_buffer_sizes[glsl_binding_n] = buf_size - offset;
         _sg.gl.cache.storage_buffer = buffer; // not a bug
         if (_sg.features.compute) {
             SOKOL_ASSERT(glsl_binding_n < _sg.limits.max_storage_buffer_bindings_per_stage);
@@ -10334,19 +15611,47 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_storage_buffer(uint8_t glsl_binding_n, GLu
     }
 }
 
+_SOKOL_PRIVATE void _sg_gl_cache_bind_uniform_buffer(int ub_slot, GLuint buffer, int offset, int size) {
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT((offset >= 0) && (size > 0));
+    const bool buf_neql = _sg.gl.cache.uniform_buffers[ub_slot] != buffer;
+    const bool off_neql = _sg.gl.cache.uniform_buffer_offsets[ub_slot] != offset;
+    const bool size_neql = _sg.gl.cache.uniform_buffer_sizes[ub_slot] != size;
+    if (buf_neql || off_neql || size_neql) {
+        _sg.gl.cache.uniform_buffers[ub_slot] = buffer;
+        _sg.gl.cache.uniform_buffer_offsets[ub_slot] = offset;
+        _sg.gl.cache.uniform_buffer_sizes[ub_slot] = size;
+        _sg.gl.cache.uniform_buffer = buffer; // not a bug
+        glBindBufferRange(GL_UNIFORM_BUFFER, (GLuint)ub_slot, buffer, offset, size);
+        _sg_stats_inc(gl.num_bind_buffer);
+    }
+}
+
 _SOKOL_PRIVATE void _sg_gl_cache_store_buffer_binding(GLenum target) {
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        return;
+    }
+    #endif
     if (target == GL_ARRAY_BUFFER) {
         _sg.gl.cache.stored_vertex_buffer = _sg.gl.cache.vertex_buffer;
     } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
         _sg.gl.cache.stored_index_buffer = _sg.gl.cache.index_buffer;
     } else if (target == GL_SHADER_STORAGE_BUFFER) {
         _sg.gl.cache.stored_storage_buffer = _sg.gl.cache.storage_buffer;
+    } else if (target == GL_UNIFORM_BUFFER) {
+        _sg.gl.cache.stored_uniform_buffer = _sg.gl.cache.uniform_buffer;
     } else {
         SOKOL_UNREACHABLE;
     }
 }
 
 _SOKOL_PRIVATE void _sg_gl_cache_restore_buffer_binding(GLenum target) {
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        return;
+    }
+    #endif
     if (target == GL_ARRAY_BUFFER) {
         if (_sg.gl.cache.stored_vertex_buffer != 0) {
             // we only care about restoring valid ids
@@ -10365,11 +15670,291 @@ _SOKOL_PRIVATE void _sg_gl_cache_restore_buffer_binding(GLenum target) {
             _sg_gl_cache_bind_buffer(target, _sg.gl.cache.stored_storage_buffer);
             _sg.gl.cache.stored_storage_buffer = 0;
         }
+    } else if (target == GL_UNIFORM_BUFFER) {
+        if (_sg.gl.cache.stored_uniform_buffer != 0) {
+            // we only care about restoring valid ids
+            _sg_gl_cache_bind_buffer(target, _sg.gl.cache.stored_uniform_buffer);
+            _sg.gl.cache.stored_uniform_buffer = 0;
+        }
     } else {
         SOKOL_UNREACHABLE;
     }
 }
 
+//-- frame fences for persistently mapped stream buffers -----------------------
+// persistently mapped buffers may be created on loader threads
+_SOKOL_PRIVATE void _sg_gl_fences_add_buffers(long num) {
+    #if defined(SOKOL_LOADER_THREADS)
+        #if defined(_MSC_VER) && !defined(__clang__)
+            _InterlockedExchangeAdd(&_sg.gl.fences.num_buffers, num);
+        #else
+            __atomic_add_fetch(&_sg.gl.fences.num_buffers, num, __ATOMIC_RELAXED);
+        #endif
+    #else
+        _sg.gl.fences.num_buffers += num;
+    #endif
+}
+
+_SOKOL_PRIVATE long _sg_gl_fences_num_buffers(void) {
+    #if defined(SOKOL_LOADER_THREADS)
+        #if defined(_MSC_VER) && !defined(__clang__)
+            return _InterlockedCompareExchange(&_sg.gl.fences.num_buffers, 0, 0);
+        #else
+            return __atomic_load_n(&_sg.gl.fences.num_buffers, __ATOMIC_RELAXED);
+        #endif
+    #else
+        return _sg.gl.fences.num_buffers;
+    #endif
+}
+
+// wait until the GPU has finished the frame with the given frame index
+_SOKOL_PRIVATE void _sg_gl_wait_frame(uint32_t frame_index) {
+    _sg_gl_frame_fences_t* fences = &_sg.gl.fences;
+    if (frame_index < fences->num_completed_frames) {
+        return;
+    }
+    const int fence_index = (int)(frame_index % _SG_GL_NUM_FRAME_FENCES);
+    GLsync sync = fences->syncs[fence_index];
+    if (sync && (fences->frame_index[fence_index] == frame_index)) {
+        GLenum res = glClientWaitSync(sync, 0, 0);
+        if ((res != GL_ALREADY_SIGNALED) && (res != GL_CONDITION_SATISFIED)) {
+            const uint64_t start_ns = _sg.stats_enabled ? _sg_time_now_ns() : 0;
+            do {
+                res = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+            } while (res == GL_TIMEOUT_EXPIRED);
+            SOKOL_ASSERT(res != GL_WAIT_FAILED);
+            _sg_stats_inc(gl.num_fence_waits);
+            if (start_ns != 0) {
+                _sg_stats_add(gl.fence_wait_time_us, (uint32_t)((_sg_time_now_ns() - start_ns) / 1000));
+            }
+        }
+    }
+    // GL commands complete in order, so all older fences are signalled too
+    for (int i = 0; i < _SG_GL_NUM_FRAME_FENCES; i++) {
+        if (fences->syncs[i] && (fences->frame_index[i] <= frame_index)) {
+            glDeleteSync(fences->syncs[i]);
+            fences->syncs[i] = 0;
+        }
+    }
+    fences->num_completed_frames = frame_index + 1;
+}
+
+// called from _sg_gl_commit()
+_SOKOL_PRIVATE void _sg_gl_insert_frame_fence(void) {
+    _sg_gl_frame_fences_t* fences = &_sg.gl.fences;
+    const int fence_index = (int)(_sg.frame_index % _SG_GL_NUM_FRAME_FENCES);
+    if (fences->syncs[fence_index]) {
+        // the oldest fence is about to be overwritten, this limits the CPU
+        // to running at most _SG_GL_NUM_FRAME_FENCES frames ahead of the GPU
+        _sg_gl_wait_frame(fences->frame_index[fence_index]);
+    }
+    SOKOL_ASSERT(0 == fences->syncs[fence_index]);
+    fences->syncs[fence_index] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    fences->frame_index[fence_index] = _sg.frame_index;
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_frame_fences(void) {
+    for (int i = 0; i < _SG_GL_NUM_FRAME_FENCES; i++) {
+        if (_sg.gl.fences.syncs[i]) {
+            glDeleteSync(_sg.gl.fences.syncs[i]);
+        }
+    }
+    _sg_clear(&_sg.gl.fences, sizeof(_sg.gl.fences));
+}
+
+// waits for the GPU if mapped memory was written in a previous frame
+// which is still in flight, and records the current frame as last writer
+_SOKOL_PRIVATE void _sg_gl_acquire_write_frame(uint32_t* write_frame) {
+    const uint32_t cur_write_frame = _sg.frame_index + 1;
+    const uint32_t last_write_frame = *write_frame;
+    if (last_write_frame != cur_write_frame) {
+        if (last_write_frame != 0) {
+            _sg_gl_wait_frame(last_write_frame - 1);
+        }
+        *write_frame = cur_write_frame;
+    }
+}
+
+// returns a pointer to the mapped memory of a stream buffer slot
+_SOKOL_PRIVATE uint8_t* _sg_gl_acquire_mapped_buffer(_sg_buffer_t* buf, int slot) {
+    SOKOL_ASSERT(buf->gl.persistent && buf->gl.mapped[slot]);
+    _sg_gl_acquire_write_frame(&buf->gl.write_frame[slot]);
+    return buf->gl.mapped[slot];
+}
+
+// returns a pointer to the mapped pixel unpack buffer of a stream image slot
+_SOKOL_PRIVATE uint8_t* _sg_gl_acquire_mapped_pbo(_sg_image_t* img, int slot) {
+    SOKOL_ASSERT(img->gl.pbo[slot] && img->gl.pbo_mapped[slot]);
+    _sg_gl_acquire_write_frame(&img->gl.pbo_write_frame[slot]);
+    return img->gl.pbo_mapped[slot];
+}
+
+//-- vertex-array-object cache -------------------------------------------------
+_SOKOL_PRIVATE void _sg_gl_vao_cache_init(const sg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    SOKOL_ASSERT(0 == vc->items);
+    vc->cur_item = -1;
+    if (desc->gl.disable_vao_cache) {
+        return;
+    }
+    if (desc->gl.vao_cache_size <= 0) {
+        _SG_PANIC(GL_VAOCACHE_SIZE_GREATER_ZERO);
+    }
+    vc->num_items = desc->gl.vao_cache_size;
+    vc->items = (_sg_gl_vao_cache_item_t*)_sg_malloc_clear((size_t)vc->num_items * sizeof(_sg_gl_vao_cache_item_t));
+    vc->num_buckets = 1;
+    while (vc->num_buckets < (2 * vc->num_items)) {
+        vc->num_buckets <<= 1;
+    }
+    vc->buckets = (int*)_sg_malloc((size_t)vc->num_buckets * sizeof(int));
+    for (int i = 0; i < vc->num_buckets; i++) {
+        vc->buckets[i] = -1;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_discard(void) {
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    if (vc->items) {
+        for (int i = 0; i < vc->num_items; i++) {
+            if (vc->items[i].vao) {
+                glDeleteVertexArrays(1, &vc->items[i].vao);
+            }
+        }
+        _sg_free(vc->items);
+    }
+    if (vc->buckets) {
+        _sg_free(vc->buckets);
+    }
+    _sg_clear(vc, sizeof(_sg_gl_vao_cache_t));
+}
+
+// FNV-1a over the cache key
+_SOKOL_PRIVATE uint64_t _sg_gl_vao_cache_hash(const _sg_gl_vao_cache_key_t* key) {
+    const uint8_t* ptr = (const uint8_t*)key;
+    uint64_t hash = 0xcbf29ce484222325;
+    for (size_t i = 0; i < sizeof(_sg_gl_vao_cache_key_t); i++) {
+        hash ^= ptr[i];
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+// bind a cached VAO (or the global VAO with item_index == -1), this also
+// swaps the cached GL_ELEMENT_ARRAY_BUFFER binding since that is VAO state
+_SOKOL_PRIVATE void _sg_gl_vao_cache_bind(int item_index) {
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    if (vc->cur_item == item_index) {
+        return;
+    }
+    if (vc->cur_item >= 0) {
+        vc->items[vc->cur_item].index_buffer = _sg.gl.cache.index_buffer;
+    } else {
+        vc->global_index_buffer = _sg.gl.cache.index_buffer;
+    }
+    GLuint vao;
+    if (item_index >= 0) {
+        vao = vc->items[item_index].vao;
+        _sg.gl.cache.index_buffer = vc->items[item_index].index_buffer;
+    } else {
+        vao = _sg.gl.vao;
+        _sg.gl.cache.index_buffer = vc->global_index_buffer;
+    }
+    glBindVertexArray(vao);
+    _sg_stats_inc(gl.num_bind_vertex_array);
+    vc->cur_item = item_index;
+}
+
+_SOKOL_PRIVATE void _sg_gl_vao_cache_remove(int item_index) {
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    SOKOL_ASSERT((item_index >= 0) && (item_index < vc->num_items));
+    _sg_gl_vao_cache_item_t* item = &vc->items[item_index];
+    SOKOL_ASSERT(item->vao);
+    if (vc->cur_item == item_index) {
+        _sg_gl_vao_cache_bind(-1);
+    }
+    // unlink from hash bucket
+    int* link = &vc->buckets[item->hash & (uint64_t)(vc->num_buckets - 1)];
+    while (*link != item_index) {
+        SOKOL_ASSERT(*link >= 0);
+        link = &vc->items[*link].next;
+    }
+    *link = item->next;
+    glDeleteVertexArrays(1, &item->vao);
+    _sg_clear(item, sizeof(_sg_gl_vao_cache_item_t));
+}
+
+_SOKOL_PRIVATE int _sg_gl_vao_cache_find(const _sg_gl_vao_cache_key_t* key, uint64_t hash) {
+    const _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    int item_index = vc->buckets[hash & (uint64_t)(vc->num_buckets - 1)];
+    while (item_index >= 0) {
+        const _sg_gl_vao_cache_item_t* item = &vc->items[item_index];
+        if ((item->hash == hash) && (0 == memcmp(&item->key, key, sizeof(_sg_gl_vao_cache_key_t)))) {
+            return item_index;
+        }
+        item_index = item->next;
+    }
+    return -1;
+}
+
+// returns a free cache item, evicts the least recently used item if the cache is full
+_SOKOL_PRIVATE int _sg_gl_vao_cache_alloc(void) {
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    int lru_index = 0;
+    for (int i = 0; i < vc->num_items; i++) {
+        if (0 == vc->items[i].vao) {
+            return i;
+        }
+        if (vc->items[i].last_used < vc->items[lru_index].last_used) {
+            lru_index = i;
+        }
+    }
+    _sg_gl_vao_cache_remove(lru_index);
+    _sg_stats_inc(gl.num_vao_cache_evictions);
+    return lru_index;
+}
+
+// called from _sg_gl_cache_invalidate_buffer()
+_SOKOL_PRIVATE void _sg_gl_vao_cache_invalidate_buffer(GLuint buf) {
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    if (buf == vc->global_index_buffer) {
+        vc->global_index_buffer = 0;
+    }
+    for (int item_index = 0; item_index < vc->num_items; item_index++) {
+        _sg_gl_vao_cache_item_t* item = &vc->items[item_index];
+        if (0 == item->vao) {
+            continue;
+        }
+        bool uses_buf = false;
+        for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+            if (buf == item->key.vbufs[i]) {
+                uses_buf = true;
+                break;
+            }
+        }
+        if (uses_buf) {
+            _sg_gl_vao_cache_remove(item_index);
+            _sg_stats_inc(gl.num_vao_cache_invalidates);
+        } else if (buf == item->index_buffer) {
+            // NOTE: a non-bound VAO keeps a reference to the deleted buffer until the
+            // next index buffer is bound into it, this is harmless since GL buffer
+            // names are only compared against the index buffer cache value
+            item->index_buffer = 0;
+        }
+    }
+}
+
+// called from _sg_gl_cache_invalidate_pipeline()
+_SOKOL_PRIVATE void _sg_gl_vao_cache_invalidate_pipeline(uint32_t pip_id) {
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    for (int item_index = 0; item_index < vc->num_items; item_index++) {
+        if (vc->items[item_index].vao && (vc->items[item_index].key.pip_id == pip_id)) {
+            _sg_gl_vao_cache_remove(item_index);
+            _sg_stats_inc(gl.num_vao_cache_invalidates);
+        }
+    }
+}
+
 // called from _sg_gl_discard_buffer()
 _SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
     if (buf == _sg.gl.cache.vertex_buffer) {
@@ -10387,6 +15972,24 @@ _SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
         glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
         _sg_stats_inc(gl.num_bind_buffer);
     }
+    if (buf == _sg.gl.cache.uniform_buffer) {
+        _sg.gl.cache.uniform_buffer = 0;
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        _sg_stats_inc(gl.num_bind_buffer);
+    }
+    if (buf == _sg.gl.cache.dispatch_indirect_buffer) {
+        _sg.gl.cache.dispatch_indirect_buffer = 0;
+        glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+        _sg_stats_inc(gl.num_bind_buffer);
+    }
+    for (int i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        if (buf == _sg.gl.cache.uniform_buffers[i]) {
+            _sg.gl.cache.uniform_buffers[i] = 0;
+            _sg.gl.cache.uniform_buffer = 0; // not a bug!
+            glBindBufferBase(GL_UNIFORM_BUFFER, (GLuint)i, 0);
+            _sg_stats_inc(gl.num_bind_buffer);
+        }
+    }
     for (int i = 0; i < _SG_GL_MAX_SBUF_BINDINGS; i++) {
         if (buf == _sg.gl.cache.storage_buffers[i]) {
             _sg.gl.cache.storage_buffers[i] = 0;
@@ -10406,11 +16009,15 @@ _SOKOL_PRIVATE void _sg_gl_cache_invalidate_buffer(GLuint buf) {
     if (buf == _sg.gl.cache.stored_storage_buffer) {
         _sg.gl.cache.stored_storage_buffer = 0;
     }
+    if (buf == _sg.gl.cache.stored_uniform_buffer) {
+        _sg.gl.cache.stored_uniform_buffer = 0;
+    }
     for (int i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
         if (buf == _sg.gl.cache.attrs[i].gl_vbuf) {
             _sg.gl.cache.attrs[i].gl_vbuf = 0;
         }
     }
+    _sg_gl_vao_cache_invalidate_buffer(buf);
 }
 
 _SOKOL_PRIVATE void _sg_gl_cache_active_texture(GLenum texture) {
@@ -10455,6 +16062,16 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_texture_sampler(int8_t gl_tex_slot, GLenum
     if (gl_tex_slot >= _sg.limits.gl_max_combined_texture_image_units) {
         return;
     }
+    #if defined(SOKOL_LOADER_THREADS)
+    // the state cache belongs to the render thread's GL context
+    if (_sg_on_loader_thread()) {
+        if (target != 0) {
+            glActiveTexture((GLenum)(GL_TEXTURE0 + gl_tex_slot));
+            glBindTexture(target, texture);
+        }
+        return;
+    }
+    #endif
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_texture_sampler_bind_slot* slot = &_sg.gl.cache.texture_samplers[gl_tex_slot];
     if ((slot->target != target) || (slot->texture != texture) || (slot->sampler != sampler)) {
@@ -10484,11 +16101,21 @@ _SOKOL_PRIVATE void _sg_gl_cache_bind_texture_sampler(int8_t gl_tex_slot, GLenum
 
 _SOKOL_PRIVATE void _sg_gl_cache_store_texture_sampler_binding(int8_t gl_tex_slot) {
     SOKOL_ASSERT((gl_tex_slot >= 0) && (gl_tex_slot < _SG_GL_MAX_TEX_SMP_BINDINGS));
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        return;
+    }
+    #endif
     _sg.gl.cache.stored_texture_sampler = _sg.gl.cache.texture_samplers[gl_tex_slot];
 }
 
 _SOKOL_PRIVATE void _sg_gl_cache_restore_texture_sampler_binding(int8_t gl_tex_slot) {
     SOKOL_ASSERT((gl_tex_slot >= 0) && (gl_tex_slot < _SG_GL_MAX_TEX_SMP_BINDINGS));
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        return;
+    }
+    #endif
     _sg_gl_cache_texture_sampler_bind_slot* slot = &_sg.gl.cache.stored_texture_sampler;
     if (slot->texture != 0) {
         // we only care about restoring valid ids
@@ -10539,12 +16166,15 @@ _SOKOL_PRIVATE void _sg_gl_cache_invalidate_pipeline(_sg_pipeline_t* pip) {
     if (_sg_sref_slot_eql(&_sg.gl.cache.cur_pip, &pip->slot)) {
         _sg.gl.cache.cur_pip = _sg_sref(0);
     }
+    _sg_gl_vao_cache_invalidate_pipeline(pip->slot.id);
 }
 
 _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
     _SG_GL_CHECK_ERROR();
     glBindVertexArray(_sg.gl.vao);
     _SG_GL_CHECK_ERROR();
+    _sg.gl.vao_cache.cur_item = -1;
+    _sg.gl.vao_cache.global_index_buffer = 0;
     _sg_clear(&_sg.gl.cache, sizeof(_sg.gl.cache));
     _sg_gl_cache_clear_buffer_bindings(true);
     _SG_GL_CHECK_ERROR();
@@ -10622,7 +16252,7 @@ _SOKOL_PRIVATE void _sg_gl_reset_state_cache(void) {
 }
 
 _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
-    _SOKOL_UNUSED(desc);
+    SOKOL_ASSERT(desc);
 
     // assumes that _sg.gl is already zero-initialized
     _sg.gl.valid = true;
@@ -10640,11 +16270,14 @@ _SOKOL_PRIVATE void _sg_gl_setup_backend(const sg_desc* desc) {
     #elif defined(SOKOL_GLES3)
         _sg_gl_init_caps_gles3();
     #endif
+    _sg.gl.multi_bind = _sg.features.gl_multi_bind && !desc->gl.disable_multi_bind;
+    _sg.gl.persistent_stream_buffers &= !desc->gl.disable_persistent_stream_buffers;
 
     // create and bind global vertex array object which will be mutated as needed
     glGenVertexArrays(1, &_sg.gl.vao);
     glBindVertexArray(_sg.gl.vao);
     _SG_GL_CHECK_ERROR();
+    _sg_gl_vao_cache_init(desc);
 
     // create global framebuffer object which will be mutated as needed
     glGenFramebuffers(1, &_sg.gl.fb);
@@ -10664,6 +16297,8 @@ _SOKOL_PRIVATE void _sg_gl_discard_backend(void) {
     if (_sg.gl.fb) {
         glDeleteFramebuffers(1, &_sg.gl.fb);
     }
+    _sg_gl_vao_cache_discard();
+    _sg_gl_discard_frame_fences();
     if (_sg.gl.vao) {
         glDeleteVertexArrays(1, &_sg.gl.vao);
     }
@@ -10680,6 +16315,11 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_buffer(_sg_buffer_t* buf, const s
     buf->gl.injected = (0 != desc->gl_buffers[0]);
     const GLenum gl_target = _sg_gl_buffer_target(&buf->cmn.usage);
     const GLenum gl_usage  = _sg_gl_buffer_usage(&buf->cmn.usage);
+    const bool persistent = _sg.gl.persistent_stream_buffers && buf->cmn.usage.stream_update && !buf->gl.injected;
+    if (persistent) {
+        buf->gl.persistent = true;
+        _sg_gl_fences_add_buffers(1);
+    }
     for (int slot = 0; slot < buf->cmn.num_slots; slot++) {
         GLuint gl_buf = 0;
         if (buf->gl.injected) {
@@ -10690,13 +16330,26 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_buffer(_sg_buffer_t* buf, const s
             SOKOL_ASSERT(gl_buf);
             _sg_gl_cache_store_buffer_binding(gl_target);
             _sg_gl_cache_bind_buffer(gl_target, gl_buf);
-            glBufferData(gl_target, buf->cmn.size, 0, gl_usage);
-            if (desc->data.ptr) {
-                glBufferSubData(gl_target, 0, buf->cmn.size, desc->data.ptr);
+            #if defined(_SOKOL_GL_HAS_BUFFERSTORAGE)
+            if (persistent) {
+                const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(gl_target, buf->cmn.size, 0, flags);
+                buf->gl.mapped[slot] = (uint8_t*) glMapBufferRange(gl_target, 0, buf->cmn.size, flags);
+            } else
+            #endif
+            {
+                glBufferData(gl_target, buf->cmn.size, 0, gl_usage);
+                if (desc->data.ptr) {
+                    glBufferSubData(gl_target, 0, buf->cmn.size, desc->data.ptr);
+                }
             }
             _sg_gl_cache_restore_buffer_binding(gl_target);
         }
         buf->gl.buf[slot] = gl_buf;
+        if (persistent && (0 == buf->gl.mapped[slot])) {
+            _SG_ERROR(GL_MAP_PERSISTENT_BUFFER_FAILED);
+            return SG_RESOURCESTATE_FAILED;
+        }
     }
     _SG_GL_CHECK_ERROR();
     return SG_RESOURCESTATE_VALID;
@@ -10705,6 +16358,11 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_buffer(_sg_buffer_t* buf, const s
 _SOKOL_PRIVATE void _sg_gl_discard_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf);
     _SG_GL_CHECK_ERROR();
+    if (buf->gl.persistent) {
+        // NOTE: deleting a GL buffer also unmaps it
+        SOKOL_ASSERT(_sg_gl_fences_num_buffers() > 0);
+        _sg_gl_fences_add_buffers(-1);
+    }
     for (int slot = 0; slot < buf->cmn.num_slots; slot++) {
         if (buf->gl.buf[slot]) {
             _sg_gl_cache_invalidate_buffer(buf->gl.buf[slot]);
@@ -10761,8 +16419,11 @@ _SOKOL_PRIVATE void _sg_gl_texstorage(const _sg_image_t* img) {
     _SG_GL_CHECK_ERROR();
 }
 
-_SOKOL_PRIVATE void _sg_gl_texsubimage(const _sg_image_t* img, GLenum tgt, int mip_index, int w, int h, int depth, const GLvoid* data_ptr, GLsizei data_size) {
-    SOKOL_ASSERT(data_ptr && (data_size > 0));
+// NOTE: when a pixel unpack buffer is bound (from_pbo), data_ptr is an offset into that buffer and may be zero
+_SOKOL_PRIVATE void _sg_gl_texsubimage(const _sg_image_t* img, GLenum tgt, int mip_index, int w, int h, int depth, const GLvoid* data_ptr, GLsizei data_size, bool from_pbo) {
+    _SOKOL_UNUSED(from_pbo);
+    SOKOL_ASSERT(from_pbo || data_ptr);
+    SOKOL_ASSERT(data_size > 0);
     SOKOL_ASSERT(img->cmn.sample_count == 1);
     const bool compressed = _sg_is_compressed_pixel_format(img->cmn.pixel_format);
     if ((SG_IMAGETYPE_2D == img->cmn.type) || (SG_IMAGETYPE_CUBE == img->cmn.type)) {
@@ -10791,7 +16452,7 @@ _SOKOL_PRIVATE void _sg_gl_teximage(const _sg_image_t* img, GLenum tgt, int mip_
         if (data_ptr == 0) {
             return;
         }
-        _sg_gl_texsubimage(img, tgt, mip_index, w, h, depth, data_ptr, data_size);
+        _sg_gl_texsubimage(img, tgt, mip_index, w, h, depth, data_ptr, data_size, false);
     #else
         const bool compressed = _sg_is_compressed_pixel_format(img->cmn.pixel_format);
         const GLenum ifmt = _sg_gl_teximage_internal_format(img->cmn.pixel_format);
@@ -10901,6 +16562,32 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
             }
             _sg_gl_cache_restore_texture_sampler_binding(0);
         }
+        #if defined(_SOKOL_GL_HAS_BUFFERSTORAGE)
+        // stream images get one persistently mapped pixel unpack buffer per texture slot
+        if (_sg.gl.persistent_stream_buffers && img->cmn.usage.stream_update && !msaa) {
+            int pbo_size = 0;
+            for (int mip_index = 0; mip_index < img->cmn.num_mipmaps; mip_index++) {
+                const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
+                const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
+                pbo_size += _sg_surface_pitch(img->cmn.pixel_format, mip_width, mip_height, 1) * img->cmn.num_slices;
+            }
+            img->gl.pbo_size = pbo_size;
+            _sg_gl_fences_add_buffers(1);
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            for (int slot = 0; slot < img->cmn.num_slots; slot++) {
+                glGenBuffers(1, &img->gl.pbo[slot]);
+                SOKOL_ASSERT(img->gl.pbo[slot]);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, img->gl.pbo[slot]);
+                glBufferStorage(GL_PIXEL_UNPACK_BUFFER, pbo_size, 0, flags);
+                img->gl.pbo_mapped[slot] = (uint8_t*) glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, pbo_size, flags);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                if (0 == img->gl.pbo_mapped[slot]) {
+                    _SG_ERROR(GL_MAP_PERSISTENT_BUFFER_FAILED);
+                    return SG_RESOURCESTATE_FAILED;
+                }
+            }
+        }
+        #endif
     }
     _SG_GL_CHECK_ERROR();
     return SG_RESOURCESTATE_VALID;
@@ -10909,6 +16596,16 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_image(_sg_image_t* img, const sg_
 _SOKOL_PRIVATE void _sg_gl_discard_image(_sg_image_t* img) {
     SOKOL_ASSERT(img);
     _SG_GL_CHECK_ERROR();
+    if (img->gl.pbo_size > 0) {
+        // NOTE: deleting a GL buffer also unmaps it
+        SOKOL_ASSERT(_sg_gl_fences_num_buffers() > 0);
+        _sg_gl_fences_add_buffers(-1);
+        for (int slot = 0; slot < img->cmn.num_slots; slot++) {
+            if (img->gl.pbo[slot]) {
+                glDeleteBuffers(1, &img->gl.pbo[slot]);
+            }
+        }
+    }
     for (int slot = 0; slot < img->cmn.num_slots; slot++) {
         if (img->gl.tex[slot]) {
             _sg_gl_cache_invalidate_texture_sampler(img->gl.tex[slot], 0);
@@ -10985,16 +16682,11 @@ _SOKOL_PRIVATE void _sg_gl_discard_sampler(_sg_sampler_t* smp) {
     _SG_GL_CHECK_ERROR();
 }
 
-_SOKOL_PRIVATE GLuint _sg_gl_compile_shader(sg_shader_stage stage, const char* src) {
-    SOKOL_ASSERT(src);
-    _SG_GL_CHECK_ERROR();
-    GLuint gl_shd = glCreateShader(_sg_gl_shader_stage(stage));
-    glShaderSource(gl_shd, 1, &src, 0);
-    glCompileShader(gl_shd);
+// check shader compile status and log errors, this blocks until compilation has finished
+_SOKOL_PRIVATE bool _sg_gl_shader_compile_status(GLuint gl_shd) {
     GLint compile_status = 0;
     glGetShaderiv(gl_shd, GL_COMPILE_STATUS, &compile_status);
     if (!compile_status) {
-        // compilation failed, log error and delete shader
         GLint log_len = 0;
         glGetShaderiv(gl_shd, GL_INFO_LOG_LENGTH, &log_len);
         if (log_len > 0) {
@@ -11004,6 +16696,38 @@ _SOKOL_PRIVATE GLuint _sg_gl_compile_shader(sg_shader_stage stage, const char* s
             _SG_LOGMSG(GL_SHADER_COMPILATION_FAILED, log_buf);
             _sg_free(log_buf);
         }
+    }
+    return 0 != compile_status;
+}
+
+// check program link status and log errors, this blocks until linking has finished
+_SOKOL_PRIVATE bool _sg_gl_program_link_status(GLuint gl_prog) {
+    GLint link_status = 0;
+    glGetProgramiv(gl_prog, GL_LINK_STATUS, &link_status);
+    if (!link_status) {
+        GLint log_len = 0;
+        glGetProgramiv(gl_prog, GL_INFO_LOG_LENGTH, &log_len);
+        if (log_len > 0) {
+            GLchar* log_buf = (GLchar*) _sg_malloc((size_t)log_len);
+            glGetProgramInfoLog(gl_prog, log_len, &log_len, log_buf);
+            _SG_ERROR(GL_SHADER_LINKING_FAILED);
+            _SG_LOGMSG(GL_SHADER_LINKING_FAILED, log_buf);
+            _sg_free(log_buf);
+        }
+    }
+    return 0 != link_status;
+}
+
+// NOTE: with check_status == false the compile status isn't queried, so that
+// the GL driver may compile the shader in the background
+_SOKOL_PRIVATE GLuint _sg_gl_compile_shader(sg_shader_stage stage, const char* src, bool check_status) {
+    SOKOL_ASSERT(src);
+    _SG_GL_CHECK_ERROR();
+    GLuint gl_shd = glCreateShader(_sg_gl_shader_stage(stage));
+    glShaderSource(gl_shd, 1, &src, 0);
+    glCompileShader(gl_shd);
+    if (check_status && !_sg_gl_shader_compile_status(gl_shd)) {
+        // compilation failed, delete shader
         glDeleteShader(gl_shd);
         gl_shd = 0;
     }
@@ -11036,6 +16760,139 @@ _SOKOL_PRIVATE bool _sg_gl_ensure_glsl_bindslot_ranges(const sg_shader_desc* des
     return true;
 }
 
+_SOKOL_PRIVATE _sg_gl_deferred_shader_t* _sg_gl_make_deferred_shader(const GLuint gl_shd[2], const _sg_gl_shader_names_t* names) {
+    SOKOL_ASSERT(gl_shd && names);
+    _sg_gl_deferred_shader_t* deferred = (_sg_gl_deferred_shader_t*)_sg_malloc_clear(sizeof(_sg_gl_deferred_shader_t));
+    deferred->gl_shd[0] = gl_shd[0];
+    deferred->gl_shd[1] = gl_shd[1];
+    // copy the GLSL names into a single allocation
+    size_t strings_size = 0;
+    for (size_t ub_index = 0; ub_index < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_index++) {
+        for (size_t u_index = 0; u_index < SG_MAX_UNIFORMBLOCK_MEMBERS; u_index++) {
+            if (names->uniforms[ub_index][u_index]) {
+                strings_size += strlen(names->uniforms[ub_index][u_index]) + 1;
+            }
+        }
+        if (names->ub_blocks[ub_index]) {
+            strings_size += strlen(names->ub_blocks[ub_index]) + 1;
+        }
+    }
+    for (size_t i = 0; i < SG_MAX_TEXTURE_SAMPLER_PAIRS; i++) {
+        if (names->tex_smps[i]) {
+            strings_size += strlen(names->tex_smps[i]) + 1;
+        }
+    }
+    if (strings_size > 0) {
+        deferred->strings = (char*)_sg_malloc(strings_size);
+        char* dst = deferred->strings;
+        for (size_t ub_index = 0; ub_index < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_index++) {
+            for (size_t u_index = 0; u_index < SG_MAX_UNIFORMBLOCK_MEMBERS; u_index++) {
+                const char* src = names->uniforms[ub_index][u_index];
+                if (src) {
+                    const size_t len = strlen(src) + 1;
+                    memcpy(dst, src, len);
+                    deferred->names.uniforms[ub_index][u_index] = dst;
+                    dst += len;
+                }
+            }
+            const char* src = names->ub_blocks[ub_index];
+            if (src) {
+                const size_t len = strlen(src) + 1;
+                memcpy(dst, src, len);
+                deferred->names.ub_blocks[ub_index] = dst;
+                dst += len;
+            }
+        }
+        for (size_t i = 0; i < SG_MAX_TEXTURE_SAMPLER_PAIRS; i++) {
+            const char* src = names->tex_smps[i];
+            if (src) {
+                const size_t len = strlen(src) + 1;
+                memcpy(dst, src, len);
+                deferred->names.tex_smps[i] = dst;
+                dst += len;
+            }
+        }
+        SOKOL_ASSERT(dst == (deferred->strings + strings_size));
+    }
+    return deferred;
+}
+
+_SOKOL_PRIVATE void _sg_gl_destroy_deferred_shader(_sg_shader_t* shd) {
+    SOKOL_ASSERT(shd && shd->gl.deferred);
+    _sg_gl_deferred_shader_t* deferred = shd->gl.deferred;
+    for (size_t i = 0; i < 2; i++) {
+        if (deferred->gl_shd[i]) {
+            glDeleteShader(deferred->gl_shd[i]);
+        }
+    }
+    if (deferred->strings) {
+        _sg_free(deferred->strings);
+    }
+    _sg_free(deferred);
+    shd->gl.deferred = 0;
+}
+
+// lookup uniform locations and assign texture units after the shader program has been linked
+_SOKOL_PRIVATE void _sg_gl_resolve_shader_locations(_sg_shader_t* shd, const _sg_gl_shader_names_t* names) {
+    SOKOL_ASSERT(shd && shd->gl.prog && names);
+    const GLuint gl_prog = shd->gl.prog;
+
+    // resolve uniforms
+    _SG_GL_CHECK_ERROR();
+    for (size_t ub_index = 0; ub_index < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_index++) {
+        _sg_gl_uniform_block_t* ub = &shd->gl.uniform_blocks[ub_index];
+        for (int u_index = 0; u_index < ub->num_uniforms; u_index++) {
+            _sg_gl_uniform_t* u = &ub->uniforms[u_index];
+            const char* glsl_name = names->uniforms[ub_index][u_index];
+            SOKOL_ASSERT(glsl_name);
+            u->gl_loc = glGetUniformLocation(gl_prog, glsl_name);
+            if (u->gl_loc == -1) {
+                _SG_WARN(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER);
+                _SG_LOGMSG(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER, glsl_name);
+            }
+        }
+        // GLSL uniform blocks are bound to the uniform buffer binding point ub_index
+        if (ub->glsl_block) {
+            const char* glsl_name = names->ub_blocks[ub_index];
+            SOKOL_ASSERT(glsl_name);
+            const GLuint gl_block_index = glGetUniformBlockIndex(gl_prog, glsl_name);
+            if (gl_block_index != GL_INVALID_INDEX) {
+                glUniformBlockBinding(gl_prog, gl_block_index, (GLuint)ub_index);
+            } else {
+                _SG_WARN(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER);
+                _SG_LOGMSG(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER, glsl_name);
+            }
+        }
+    }
+
+    // record image sampler location in shader program
+    _SG_GL_CHECK_ERROR();
+    GLuint cur_prog = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&cur_prog);
+    glUseProgram(gl_prog);
+    GLint gl_tex_slot = 0;
+    for (size_t tex_smp_index = 0; tex_smp_index < SG_MAX_TEXTURE_SAMPLER_PAIRS; tex_smp_index++) {
+        if (shd->cmn.texture_samplers[tex_smp_index].stage == SG_SHADERSTAGE_NONE) {
+            continue;
+        }
+        const char* glsl_name = names->tex_smps[tex_smp_index];
+        SOKOL_ASSERT(glsl_name);
+        GLint gl_loc = glGetUniformLocation(gl_prog, glsl_name);
+        if (gl_loc != -1) {
+            glUniform1i(gl_loc, gl_tex_slot);
+            shd->gl.tex_slot[tex_smp_index] = (int8_t)gl_tex_slot++;
+        } else {
+            shd->gl.tex_slot[tex_smp_index] = -1;
+            _SG_WARN(GL_IMAGE_SAMPLER_NAME_NOT_FOUND_IN_SHADER);
+            _SG_LOGMSG(GL_IMAGE_SAMPLER_NAME_NOT_FOUND_IN_SHADER, glsl_name);
+        }
+    }
+
+    // it's legal to call glUseProgram with 0
+    glUseProgram(cur_prog);
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
     SOKOL_ASSERT(shd && desc);
     SOKOL_ASSERT(!shd->gl.prog);
@@ -11052,58 +16909,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
         _sg_strcpy(&shd->gl.attrs[i].name, desc->attrs[i].glsl_name);
     }
 
-    const bool has_vs = desc->vertex_func.source;
-    const bool has_fs = desc->fragment_func.source;
-    const bool has_cs = desc->compute_func.source;
-    SOKOL_ASSERT((has_vs && has_fs) || has_cs);
-    GLuint gl_prog = glCreateProgram();
-    if (has_vs && has_fs) {
-        GLuint gl_vs = _sg_gl_compile_shader(SG_SHADERSTAGE_VERTEX, desc->vertex_func.source);
-        GLuint gl_fs = _sg_gl_compile_shader(SG_SHADERSTAGE_FRAGMENT, desc->fragment_func.source);
-        if (!(gl_vs && gl_fs)) {
-            glDeleteProgram(gl_prog);
-            if (gl_vs) { glDeleteShader(gl_vs); }
-            if (gl_fs) { glDeleteShader(gl_fs); }
-            return SG_RESOURCESTATE_FAILED;
-        }
-        glAttachShader(gl_prog, gl_vs);
-        glAttachShader(gl_prog, gl_fs);
-        glLinkProgram(gl_prog);
-        glDeleteShader(gl_vs);
-        glDeleteShader(gl_fs);
-        _SG_GL_CHECK_ERROR();
-    } else if (has_cs) {
-        GLuint gl_cs = _sg_gl_compile_shader(SG_SHADERSTAGE_COMPUTE, desc->compute_func.source);
-        if (!gl_cs) {
-            glDeleteProgram(gl_prog);
-            return SG_RESOURCESTATE_FAILED;
-        }
-        glAttachShader(gl_prog, gl_cs);
-        glLinkProgram(gl_prog);
-        glDeleteShader(gl_cs);
-        _SG_GL_CHECK_ERROR();
-    } else {
-        SOKOL_UNREACHABLE;
-    }
-    GLint link_status;
-    glGetProgramiv(gl_prog, GL_LINK_STATUS, &link_status);
-    if (!link_status) {
-        GLint log_len = 0;
-        glGetProgramiv(gl_prog, GL_INFO_LOG_LENGTH, &log_len);
-        if (log_len > 0) {
-            GLchar* log_buf = (GLchar*) _sg_malloc((size_t)log_len);
-            glGetProgramInfoLog(gl_prog, log_len, &log_len, log_buf);
-            _SG_ERROR(GL_SHADER_LINKING_FAILED);
-            _SG_LOGMSG(GL_SHADER_LINKING_FAILED, log_buf);
-            _sg_free(log_buf);
-        }
-        glDeleteProgram(gl_prog);
-        return SG_RESOURCESTATE_FAILED;
-    }
-    shd->gl.prog = gl_prog;
-
-    // resolve uniforms
-    _SG_GL_CHECK_ERROR();
+    // setup uniform block layouts
     for (size_t ub_index = 0; ub_index < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_index++) {
         const sg_shader_uniform_block* ub_desc = &desc->uniform_blocks[ub_index];
         if (ub_desc->stage == SG_SHADERSTAGE_NONE) {
@@ -11112,6 +16918,11 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
         SOKOL_ASSERT(ub_desc->size > 0);
         _sg_gl_uniform_block_t* ub = &shd->gl.uniform_blocks[ub_index];
         SOKOL_ASSERT(ub->num_uniforms == 0);
+        if (ub_desc->glsl_block_name) {
+            // a GLSL uniform block, the data layout is defined by the shader
+            ub->glsl_block = true;
+            continue;
+        }
         uint32_t cur_uniform_offset = 0;
         for (int u_index = 0; u_index < SG_MAX_UNIFORMBLOCK_MEMBERS; u_index++) {
             const sg_glsl_shader_uniform* u_desc = &ub_desc->glsl_uniforms[u_index];
@@ -11125,12 +16936,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
             u->type = u_desc->type;
             u->count = (uint16_t) u_desc->array_count;
             u->offset = (uint16_t) cur_uniform_offset;
-            SOKOL_ASSERT(u_desc->glsl_name);
-            u->gl_loc = glGetUniformLocation(gl_prog, u_desc->glsl_name);
-            if (u->gl_loc == -1) {
-                _SG_WARN(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER);
-                _SG_LOGMSG(GL_UNIFORMBLOCK_NAME_NOT_FOUND_IN_SHADER, u_desc->glsl_name);
-            }
+            u->gl_loc = -1;
             cur_uniform_offset += u_size;
             ub->num_uniforms++;
         }
@@ -11153,38 +16959,107 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_shader(_sg_shader_t* shd, const s
         }
     }
 
-    // record image sampler location in shader program
-    _SG_GL_CHECK_ERROR();
-    GLuint cur_prog = 0;
-    glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&cur_prog);
-    glUseProgram(gl_prog);
-    GLint gl_tex_slot = 0;
-    for (size_t tex_smp_index = 0; tex_smp_index < SG_MAX_TEXTURE_SAMPLER_PAIRS; tex_smp_index++) {
-        const sg_shader_texture_sampler_pair* tex_smp_desc = &desc->texture_sampler_pairs[tex_smp_index];
-        if (tex_smp_desc->stage == SG_SHADERSTAGE_NONE) {
-            continue;
+    // gather the GLSL names for the uniform and sampler location lookup after linking
+    _SG_STRUCT(_sg_gl_shader_names_t, names);
+    for (size_t ub_index = 0; ub_index < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_index++) {
+        for (int u_index = 0; u_index < shd->gl.uniform_blocks[ub_index].num_uniforms; u_index++) {
+            names.uniforms[ub_index][u_index] = desc->uniform_blocks[ub_index].glsl_uniforms[u_index].glsl_name;
         }
-        SOKOL_ASSERT(tex_smp_desc->glsl_name);
-        GLint gl_loc = glGetUniformLocation(gl_prog, tex_smp_desc->glsl_name);
-        if (gl_loc != -1) {
-            glUniform1i(gl_loc, gl_tex_slot);
-            shd->gl.tex_slot[tex_smp_index] = (int8_t)gl_tex_slot++;
-        } else {
-            shd->gl.tex_slot[tex_smp_index] = -1;
-            _SG_WARN(GL_IMAGE_SAMPLER_NAME_NOT_FOUND_IN_SHADER);
-            _SG_LOGMSG(GL_IMAGE_SAMPLER_NAME_NOT_FOUND_IN_SHADER, tex_smp_desc->glsl_name);
+        if (shd->gl.uniform_blocks[ub_index].glsl_block) {
+            names.ub_blocks[ub_index] = desc->uniform_blocks[ub_index].glsl_block_name;
+        }
+    }
+    for (size_t tex_smp_index = 0; tex_smp_index < SG_MAX_TEXTURE_SAMPLER_PAIRS; tex_smp_index++) {
+        if (desc->texture_sampler_pairs[tex_smp_index].stage != SG_SHADERSTAGE_NONE) {
+            names.tex_smps[tex_smp_index] = desc->texture_sampler_pairs[tex_smp_index].glsl_name;
         }
     }
 
-    // it's legal to call glUseProgram with 0
-    glUseProgram(cur_prog);
+    // with parallel shader compilation, the compile- and link-status is checked in _sg_gl_poll_shader()
+    const bool async = _sg_compile_async();
+    const bool has_vs = desc->vertex_func.source;
+    const bool has_fs = desc->fragment_func.source;
+    const bool has_cs = desc->compute_func.source;
+    SOKOL_ASSERT((has_vs && has_fs) || has_cs);
+    GLuint gl_shd[2] = { 0, 0 };
+    if (has_vs && has_fs) {
+        gl_shd[0] = _sg_gl_compile_shader(SG_SHADERSTAGE_VERTEX, desc->vertex_func.source, !async);
+        gl_shd[1] = _sg_gl_compile_shader(SG_SHADERSTAGE_FRAGMENT, desc->fragment_func.source, !async);
+        if (!(gl_shd[0] && gl_shd[1])) {
+            if (gl_shd[0]) { glDeleteShader(gl_shd[0]); }
+            if (gl_shd[1]) { glDeleteShader(gl_shd[1]); }
+            return SG_RESOURCESTATE_FAILED;
+        }
+    } else if (has_cs) {
+        gl_shd[0] = _sg_gl_compile_shader(SG_SHADERSTAGE_COMPUTE, desc->compute_func.source, !async);
+        if (!gl_shd[0]) {
+            return SG_RESOURCESTATE_FAILED;
+        }
+    } else {
+        SOKOL_UNREACHABLE;
+    }
+    GLuint gl_prog = glCreateProgram();
+    for (size_t i = 0; i < 2; i++) {
+        if (gl_shd[i]) {
+            glAttachShader(gl_prog, gl_shd[i]);
+        }
+    }
+    glLinkProgram(gl_prog);
     _SG_GL_CHECK_ERROR();
+    if (async) {
+        shd->gl.prog = gl_prog;
+        shd->gl.deferred = _sg_gl_make_deferred_shader(gl_shd, &names);
+        return SG_RESOURCESTATE_ALLOC;
+    }
+    for (size_t i = 0; i < 2; i++) {
+        if (gl_shd[i]) {
+            glDeleteShader(gl_shd[i]);
+        }
+    }
+    if (!_sg_gl_program_link_status(gl_prog)) {
+        glDeleteProgram(gl_prog);
+        return SG_RESOURCESTATE_FAILED;
+    }
+    shd->gl.prog = gl_prog;
+    _sg_gl_resolve_shader_locations(shd, &names);
     return SG_RESOURCESTATE_VALID;
 }
 
+// check if a shader program which is compiled in the background has finished
+_SOKOL_PRIVATE sg_resource_state _sg_gl_poll_shader(_sg_shader_t* shd) {
+    SOKOL_ASSERT(shd && shd->gl.prog && shd->gl.deferred);
+    _SG_GL_CHECK_ERROR();
+    GLint completed = 0;
+    glGetProgramiv(shd->gl.prog, GL_COMPLETION_STATUS_KHR, &completed);
+    if (!completed) {
+        return SG_RESOURCESTATE_ALLOC;
+    }
+    _sg_gl_deferred_shader_t* deferred = shd->gl.deferred;
+    bool compiled = true;
+    for (size_t i = 0; i < 2; i++) {
+        if (deferred->gl_shd[i]) {
+            compiled &= _sg_gl_shader_compile_status(deferred->gl_shd[i]);
+        }
+    }
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (compiled && _sg_gl_program_link_status(shd->gl.prog)) {
+        _sg_gl_resolve_shader_locations(shd, &deferred->names);
+        state = SG_RESOURCESTATE_VALID;
+    } else {
+        glDeleteProgram(shd->gl.prog);
+        shd->gl.prog = 0;
+    }
+    _sg_gl_destroy_deferred_shader(shd);
+    _SG_GL_CHECK_ERROR();
+    return state;
+}
+
 _SOKOL_PRIVATE void _sg_gl_discard_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd);
     _SG_GL_CHECK_ERROR();
+    if (shd->gl.deferred) {
+        _sg_gl_destroy_deferred_shader(shd);
+    }
     if (shd->gl.prog) {
         _sg_gl_cache_invalidate_program(shd->gl.prog);
         glDeleteProgram(shd->gl.prog);
@@ -11195,6 +17070,13 @@ _SOKOL_PRIVATE void _sg_gl_discard_shader(_sg_shader_t* shd) {
 _SOKOL_PRIVATE sg_resource_state _sg_gl_create_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(pip && desc);
     SOKOL_ASSERT(_sg.limits.max_vertex_attrs <= SG_MAX_VERTEX_ATTRIBUTES);
+    if (_sg_pipeline_shader_state(pip) == SG_RESOURCESTATE_ALLOC) {
+        // the shader is still compiling, pipeline creation continues in _sg_gl_poll_pipeline()
+        pip->gl.deferred_desc = (sg_pipeline_desc*)_sg_malloc(sizeof(sg_pipeline_desc));
+        *pip->gl.deferred_desc = *desc;
+        pip->gl.deferred_desc->label = 0;
+        return SG_RESOURCESTATE_ALLOC;
+    }
     if (pip->cmn.is_compute) {
         // shortcut for compute pipelines
         return SG_RESOURCESTATE_VALID;
@@ -11264,8 +17146,28 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_pipeline(_sg_pipeline_t* pip, con
     return SG_RESOURCESTATE_VALID;
 }
 
+// a pipeline waits for its shader to finish compiling in the background
+_SOKOL_PRIVATE sg_resource_state _sg_gl_poll_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip && pip->gl.deferred_desc);
+    sg_resource_state state = _sg_pipeline_shader_state(pip);
+    if (state == SG_RESOURCESTATE_ALLOC) {
+        return state;
+    }
+    if (state == SG_RESOURCESTATE_VALID) {
+        state = _sg_gl_create_pipeline(pip, pip->gl.deferred_desc);
+        SOKOL_ASSERT(state != SG_RESOURCESTATE_ALLOC);
+    }
+    _sg_free(pip->gl.deferred_desc);
+    pip->gl.deferred_desc = 0;
+    return state;
+}
+
 _SOKOL_PRIVATE void _sg_gl_discard_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip);
+    if (pip->gl.deferred_desc) {
+        _sg_free(pip->gl.deferred_desc);
+        pip->gl.deferred_desc = 0;
+    }
     _sg_gl_cache_invalidate_pipeline(pip);
 }
 
@@ -11357,6 +17259,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_gl_create_view(_sg_view_t* view, const sg_v
             glRenderbufferStorageMultisample(GL_RENDERBUFFER, img->cmn.sample_count, gl_internal_format, img->cmn.width, img->cmn.height);
         }
     } else if (view->cmn.type == SG_VIEWTYPE_RESOLVEATTACHMENT) {
+        #if defined(SOKOL_LOADER_THREADS)
+        if (_sg_on_loader_thread()) {
+            _SG_ERROR(GL_LOADER_THREAD_RESOLVE_VIEW);
+            return SG_RESOURCESTATE_FAILED;
+        }
+        #endif
         // store current framebuffer binding (restored at end of block)
         GLuint gl_orig_fb;
         glGetIntegerv(GL_FRAMEBUFFER_BINDING, (GLint*)&gl_orig_fb);
@@ -11399,14 +17307,64 @@ _SOKOL_PRIVATE void _sg_gl_discard_view(_sg_view_t* view) {
     _SG_GL_CHECK_ERROR();
 }
 
+_SOKOL_PRIVATE sg_resource_state _sg_gl_create_counter(_sg_counter_t* ctr, const sg_counter_desc* desc) {
+    SOKOL_ASSERT(ctr && desc);
+    _SOKOL_UNUSED(desc);
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        _SG_ERROR(GL_LOADER_THREAD_COUNTER);
+        return SG_RESOURCESTATE_FAILED;
+    }
+    #endif
+    _SG_GL_CHECK_ERROR();
+    if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+        // same order as the sg_pipeline_stats items
+        ctr->gl.num_counters = 5;
+        ctr->gl.targets[0] = GL_VERTEX_SHADER_INVOCATIONS;
+        ctr->gl.targets[1] = GL_FRAGMENT_SHADER_INVOCATIONS;
+        ctr->gl.targets[2] = GL_COMPUTE_SHADER_INVOCATIONS;
+        ctr->gl.targets[3] = GL_CLIPPING_INPUT_PRIMITIVES;
+        ctr->gl.targets[4] = GL_CLIPPING_OUTPUT_PRIMITIVES;
+    } else {
+        // GL_ANY_SAMPLES_PASSED is available on all GL versions supported by sokol-gfx
+        // while GL_SAMPLES_PASSED is missing in GLES3/WebGL2
+        ctr->gl.num_counters = 1;
+        ctr->gl.targets[0] = GL_ANY_SAMPLES_PASSED;
+    }
+    SOKOL_ASSERT(ctr->gl.num_counters <= _SG_GL_NUM_QUERY_COUNTERS);
+    for (int slot = 0; slot < _SG_GL_NUM_QUERY_SLOTS; slot++) {
+        glGenQueries(ctr->gl.num_counters, ctr->gl.ids[slot]);
+    }
+    _SG_GL_CHECK_ERROR();
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_gl_discard_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    _SG_GL_CHECK_ERROR();
+    for (int slot = 0; slot < _SG_GL_NUM_QUERY_SLOTS; slot++) {
+        glDeleteQueries(ctr->gl.num_counters, ctr->gl.ids[slot]);
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
 #if defined(_SOKOL_GL_HAS_COMPUTE)
-_SOKOL_PRIVATE void _sg_gl_handle_memory_barriers(const _sg_shader_t* shd, const _sg_bindings_ptrs_t* bnd, const _sg_attachments_ptrs_t* atts) {
-    SOKOL_ASSERT((shd && bnd && atts == 0) || (atts && shd == 0 && bnd == 0));
+_SOKOL_PRIVATE void _sg_gl_handle_memory_barriers(const _sg_shader_t* shd, const _sg_bindings_ptrs_t* bnd, const _sg_attachments_ptrs_t* atts, _sg_buffer_t* indirect_buf) {
+    SOKOL_ASSERT((shd && bnd && atts == 0 && indirect_buf == 0) || (atts && shd == 0 && bnd == 0 && indirect_buf == 0) || (indirect_buf && shd == 0 && bnd == 0 && atts == 0));
     if (!_sg.features.compute) {
         return;
     }
     GLbitfield gl_barrier_bits = 0;
 
+    // an indirect-dispatch argument buffer which has been written by
+    // a compute shader needs a command barrier
+    if (indirect_buf) {
+        if (indirect_buf->gl.gpu_dirty_flags & _SG_GL_GPUDIRTY_INDIRECT) {
+            gl_barrier_bits |= GL_COMMAND_BARRIER_BIT;
+            indirect_buf->gl.gpu_dirty_flags &= (uint8_t)~_SG_GL_GPUDIRTY_INDIRECT;
+        }
+    }
+
     // if vertex-, index- or storage-buffer bindings have been written
     // by a compute shader before, a barrier must be issued
     if (bnd) {
@@ -11571,7 +17529,7 @@ _SOKOL_PRIVATE void _sg_gl_begin_pass(const sg_pass* pass, const _sg_attachments
         glDrawBuffers(_sg.limits.max_color_attachments, gl_draw_bufs);
 
         #if defined(_SOKOL_GL_HAS_COMPUTE)
-            _sg_gl_handle_memory_barriers(0, 0, atts);
+            _sg_gl_handle_memory_barriers(0, 0, atts, 0);
             _SG_GL_CHECK_ERROR();
         #endif
 
@@ -11694,31 +17652,49 @@ _SOKOL_PRIVATE void _sg_gl_end_render_pass(const _sg_attachments_ptrs_t* atts) {
             }
         }
 
-        // invalidate framebuffers
+        // invalidate framebuffers (DONTCARE store actions on GLES3, and transient attachments)
         _SOKOL_UNUSED(fb_draw_bound);
-        #if defined(SOKOL_GLES3)
-        // need to restore framebuffer binding before invalidate if the MSAA resolve had changed the binding
-        if (fb_draw_bound) {
-            glBindFramebuffer(GL_FRAMEBUFFER, _sg.gl.fb);
-        }
-        GLenum invalidate_atts[SG_MAX_COLOR_ATTACHMENTS + 2] = { 0 };
-        int att_index = 0;
-        for (int i = 0; i < num_color_atts; i++) {
-            if (_sg.gl.color_store_actions[i] == SG_STOREACTION_DONTCARE) {
-                invalidate_atts[att_index++] = (GLenum)(GL_COLOR_ATTACHMENT0 + i);
+        #if defined(_SOKOL_GL_HAS_INVALIDATEFRAMEBUFFER)
+        if (_sg.gl.invalidate_framebuffer) {
+            GLenum invalidate_atts[SG_MAX_COLOR_ATTACHMENTS + 2] = { 0 };
+            int att_index = 0;
+            for (int i = 0; i < num_color_atts; i++) {
+                const _sg_image_t* img = _sg_image_ref_ptr(&atts->color_views[i]->cmn.img.ref);
+                bool discard = img->cmn.usage.transient_attachment;
+                #if defined(SOKOL_GLES3)
+                discard |= _sg.gl.color_store_actions[i] == SG_STOREACTION_DONTCARE;
+                #endif
+                if (discard) {
+                    invalidate_atts[att_index++] = (GLenum)(GL_COLOR_ATTACHMENT0 + i);
+                }
             }
-        }
-        if (!atts->ds_view) {
-            if (_sg.gl.depth_store_action == SG_STOREACTION_DONTCARE) {
-                invalidate_atts[att_index++] = GL_DEPTH_ATTACHMENT;
+            if (atts->ds_view) {
+                const _sg_image_t* img = _sg_image_ref_ptr(&atts->ds_view->cmn.img.ref);
+                if (img->cmn.usage.transient_attachment) {
+                    if (_sg_is_depth_stencil_format(img->cmn.pixel_format)) {
+                        invalidate_atts[att_index++] = GL_DEPTH_STENCIL_ATTACHMENT;
+                    } else {
+                        invalidate_atts[att_index++] = GL_DEPTH_ATTACHMENT;
+                    }
+                }
+            } else {
+                #if defined(SOKOL_GLES3)
+                if (_sg.gl.depth_store_action == SG_STOREACTION_DONTCARE) {
+                    invalidate_atts[att_index++] = GL_DEPTH_ATTACHMENT;
+                }
+                if (_sg.gl.stencil_store_action == SG_STOREACTION_DONTCARE) {
+                    invalidate_atts[att_index++] = GL_STENCIL_ATTACHMENT;
+                }
+                #endif
             }
-            if (_sg.gl.stencil_store_action == SG_STOREACTION_DONTCARE) {
-                invalidate_atts[att_index++] = GL_STENCIL_ATTACHMENT;
+            if (att_index > 0) {
+                // need to restore framebuffer binding before invalidate if the MSAA resolve had changed the binding
+                if (fb_draw_bound) {
+                    glBindFramebuffer(GL_FRAMEBUFFER, _sg.gl.fb);
+                }
+                glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, att_index, invalidate_atts);
             }
         }
-        if (att_index > 0) {
-            glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, att_index, invalidate_atts);
-        }
         #endif
     }
 }
@@ -11950,29 +17926,171 @@ _SOKOL_PRIVATE void _sg_gl_apply_render_pipeline_state(_sg_pipeline_t* pip) {
         } else {
             glDisable(GL_MULTISAMPLE);
         }
-        _sg_stats_inc(gl.num_render_state);
+        _sg_stats_inc(gl.num_render_state);
+    }
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_gl_apply_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip);
+    _SG_GL_CHECK_ERROR();
+    if (!_sg_sref_slot_eql(&_sg.gl.cache.cur_pip, &pip->slot)) {
+        _sg.gl.cache.cur_pip = _sg_sref(&pip->slot);
+
+        // bind shader program
+        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+        if (shd->gl.prog != _sg.gl.cache.prog) {
+            _sg.gl.cache.prog = shd->gl.prog;
+            glUseProgram(shd->gl.prog);
+            _sg_stats_inc(gl.num_use_program);
+        }
+
+        if (!pip->cmn.is_compute) {
+            _sg_gl_apply_render_pipeline_state(pip);
+        }
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
+#if defined(_SOKOL_GL_HAS_MULTIBIND)
+/*
+    Multi-bind versions of _sg_gl_cache_bind_texture_sampler() and
+    _sg_gl_cache_bind_storage_buffer(). The incoming arrays contain the
+    requested bindings for all slots (initialized from the state cache
+    for slots not used by the current shader), all changed slots are then
+    applied with a single call to glBindTextures()/glBindSamplers()
+    or glBindBuffersRange() covering the range of changed slots.
+
+    NOTE: glBindTextures() doesn't unbind a previous binding on a different
+    texture target of the same texture unit, this is harmless since GLSL
+    shaders can't sample from different targets on the same unit.
+*/
+_SOKOL_PRIVATE void _sg_gl_cache_bind_texture_samplers_multi(const _sg_gl_cache_texture_sampler_bind_slot* slots) {
+    SOKOL_ASSERT(_sg.gl.multi_bind);
+    int first = -1;
+    int last = -1;
+    for (int i = 0; (i < _SG_GL_MAX_TEX_SMP_BINDINGS) && (i < _sg.limits.gl_max_combined_texture_image_units); i++) {
+        const _sg_gl_cache_texture_sampler_bind_slot* cur = &_sg.gl.cache.texture_samplers[i];
+        if ((cur->target != slots[i].target) || (cur->texture != slots[i].texture) || (cur->sampler != slots[i].sampler)) {
+            if (first == -1) {
+                first = i;
+            }
+            last = i;
+        }
     }
-    #endif
+    if (first == -1) {
+        return;
+    }
+    GLuint textures[_SG_GL_MAX_TEX_SMP_BINDINGS];
+    GLuint samplers[_SG_GL_MAX_TEX_SMP_BINDINGS];
+    const int count = last - first + 1;
+    for (int i = 0; i < count; i++) {
+        const _sg_gl_cache_texture_sampler_bind_slot* slot = &slots[first + i];
+        textures[i] = slot->texture;
+        samplers[i] = slot->sampler;
+        _sg.gl.cache.texture_samplers[first + i] = *slot;
+    }
+    glBindTextures((GLuint)first, count, textures);
+    _SG_GL_CHECK_ERROR();
+    _sg_stats_inc(gl.num_bind_textures);
+    glBindSamplers((GLuint)first, count, samplers);
+    _SG_GL_CHECK_ERROR();
+    _sg_stats_inc(gl.num_bind_samplers);
 }
 
-_SOKOL_PRIVATE void _sg_gl_apply_pipeline(_sg_pipeline_t* pip) {
-    SOKOL_ASSERT(pip);
+_SOKOL_PRIVATE void _sg_gl_cache_bind_storage_buffers_multi(const GLuint* buffers, const int* offsets, const int* sizes) {
+    SOKOL_ASSERT(_sg.gl.multi_bind && _sg.features.compute);
+    int first = -1;
+    int last = -1;
+    for (int i = 0; (i < _SG_GL_MAX_SBUF_BINDINGS) && (i < _sg.limits.max_storage_buffer_bindings_per_stage); i++) {
+        if ((_sg.gl.cache.storage_buffers[i] != buffers[i]) || (_sg.gl.cache.storage_buffer_offsets[i] != offsets[i])) {
+            if (first == -1) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+    if (first == -1) {
+        return;
+    }
+    GLintptr gl_offsets[_SG_GL_MAX_SBUF_BINDINGS];
+    GLsizeiptr gl_sizes[_SG_GL_MAX_SBUF_BINDINGS];
+    const int count = last - first + 1;
+    for (int i = first; i <= last; i++) {
+        gl_offsets[i - first] = offsets[i];
+        gl_sizes[i - first] = sizes[i];
+        _sg.gl.cache.storage_buffers[i] = buffers[i];
+        _sg.gl.cache.storage_buffer_offsets[i] = offsets[i];
+        _sg.gl.cache.storage_buffer_sizes[i] = sizes[i];
+    }
+    // NOTE: unlike glBindBufferRange(), glBindBuffersRange() doesn't modify the generic binding point
+    glBindBuffersRange(GL_SHADER_STORAGE_BUFFER, (GLuint)first, count, &buffers[first], gl_offsets, gl_sizes);
     _SG_GL_CHECK_ERROR();
-    if (!_sg_sref_slot_eql(&_sg.gl.cache.cur_pip, &pip->slot)) {
-        _sg.gl.cache.cur_pip = _sg_sref(&pip->slot);
+    _sg_stats_inc(gl.num_bind_buffers_range);
+}
+#endif
 
-        // bind shader program
-        const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
-        if (shd->gl.prog != _sg.gl.cache.prog) {
-            _sg.gl.cache.prog = shd->gl.prog;
-            glUseProgram(shd->gl.prog);
-            _sg_stats_inc(gl.num_use_program);
-        }
+_SOKOL_PRIVATE void _sg_gl_vertex_attrib_pointer(GLuint attr_index, const _sg_gl_attr_t* attr, GLuint gl_vb, int vb_offset) {
+    _sg_gl_cache_bind_buffer(GL_ARRAY_BUFFER, gl_vb);
+    if (attr->base_type == SG_SHADERATTRBASETYPE_FLOAT) {
+        glVertexAttribPointer(attr_index, attr->size, attr->type, attr->normalized, attr->stride, (const GLvoid*)(GLintptr)vb_offset);
+    } else {
+        glVertexAttribIPointer(attr_index, attr->size, attr->type, attr->stride, (const GLvoid*)(GLintptr)vb_offset);
+    }
+    _sg_stats_inc(gl.num_vertex_attrib_pointer);
+    glVertexAttribDivisor(attr_index, (GLuint)attr->divisor);
+    _sg_stats_inc(gl.num_vertex_attrib_divisor);
+}
 
-        if (!pip->cmn.is_compute) {
-            _sg_gl_apply_render_pipeline_state(pip);
+// bind a VAO from the VAO cache, or create and populate a new VAO on cache miss
+_SOKOL_PRIVATE void _sg_gl_apply_cached_vertex_array(const _sg_bindings_ptrs_t* bnd) {
+    const _sg_pipeline_t* pip = bnd->pip;
+    _SG_STRUCT(_sg_gl_vao_cache_key_t, key);
+    key.pip_id = pip->slot.id;
+    for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        if (pip->cmn.vertex_buffer_layout_active[i]) {
+            const _sg_buffer_t* vb = bnd->vbs[i];
+            SOKOL_ASSERT(vb);
+            key.vbufs[i] = vb->gl.buf[vb->cmn.active_slot];
+            key.vb_offsets[i] = bnd->vb_offsets[i];
         }
     }
+    const uint64_t hash = _sg_gl_vao_cache_hash(&key);
+    _sg_gl_vao_cache_t* vc = &_sg.gl.vao_cache;
+    int item_index = _sg_gl_vao_cache_find(&key, hash);
+    if (item_index >= 0) {
+        _sg_stats_inc(gl.num_vao_cache_hits);
+        _sg_gl_vao_cache_bind(item_index);
+    } else {
+        _sg_stats_inc(gl.num_vao_cache_misses);
+        item_index = _sg_gl_vao_cache_alloc();
+        _sg_gl_vao_cache_item_t* item = &vc->items[item_index];
+        item->key = key;
+        item->hash = hash;
+        item->index_buffer = 0;
+        glGenVertexArrays(1, &item->vao);
+        SOKOL_ASSERT(item->vao);
+        int* bucket = &vc->buckets[hash & (uint64_t)(vc->num_buckets - 1)];
+        item->next = *bucket;
+        *bucket = item_index;
+        _sg_gl_vao_cache_bind(item_index);
+        for (GLuint attr_index = 0; attr_index < (GLuint)_sg.limits.max_vertex_attrs; attr_index++) {
+            const _sg_gl_attr_t* attr = &pip->gl.attrs[attr_index];
+            if (attr->vb_index >= 0) {
+                SOKOL_ASSERT(attr->vb_index < SG_MAX_VERTEXBUFFER_BINDSLOTS);
+                const int vb_offset = key.vb_offsets[attr->vb_index] + attr->offset;
+                _sg_gl_vertex_attrib_pointer(attr_index, attr, key.vbufs[attr->vb_index], vb_offset);
+                glEnableVertexAttribArray(attr_index);
+                _sg_stats_inc(gl.num_enable_vertex_attrib_array);
+            }
+        }
+    }
+    vc->items[item_index].last_used = ++vc->tick;
+
+    // index buffer (can be 0), this must happen after the VAO is bound
+    const GLuint gl_ib = bnd->ib ? bnd->ib->gl.buf[bnd->ib->cmn.active_slot] : 0;
+    _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, gl_ib);
+    _sg.gl.cache.cur_ib_offset = bnd->ib_offset;
     _SG_GL_CHECK_ERROR();
 }
 
@@ -11982,6 +18100,20 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
     _SG_GL_CHECK_ERROR();
     const _sg_shader_t* shd = _sg_shader_ref_ptr(&bnd->pip->cmn.shader);
 
+    // with multi-bind, the requested bindings are gathered first and then applied in one go
+    #if defined(_SOKOL_GL_HAS_MULTIBIND)
+    _sg_gl_cache_texture_sampler_bind_slot mb_tex_smps[_SG_GL_MAX_TEX_SMP_BINDINGS];
+    GLuint mb_sbufs[_SG_GL_MAX_SBUF_BINDINGS];
+    int mb_sbuf_offsets[_SG_GL_MAX_SBUF_BINDINGS];
+    int mb_sbuf_sizes[_SG_GL_MAX_SBUF_BINDINGS];
+    if (_sg.gl.multi_bind) {
+        memcpy(mb_tex_smps, _sg.gl.cache.texture_samplers, sizeof(mb_tex_smps));
+        memcpy(mb_sbufs, _sg.gl.cache.storage_buffers, sizeof(mb_sbufs));
+        memcpy(mb_sbuf_offsets, _sg.gl.cache.storage_buffer_offsets, sizeof(mb_sbuf_offsets));
+        memcpy(mb_sbuf_sizes, _sg.gl.cache.storage_buffer_sizes, sizeof(mb_sbuf_sizes));
+    }
+    #endif
+
     // bind combined texture-samplers
     _SG_GL_CHECK_ERROR();
     for (size_t tex_smp_index = 0; tex_smp_index < SG_MAX_TEXTURE_SAMPLER_PAIRS; tex_smp_index++) {
@@ -12006,9 +18138,22 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
             } else {
                 gl_tex = img->gl.tex[img->cmn.active_slot];
             }
+            #if defined(_SOKOL_GL_HAS_MULTIBIND)
+            if (_sg.gl.multi_bind) {
+                mb_tex_smps[gl_tex_slot].target = gl_tgt;
+                mb_tex_smps[gl_tex_slot].texture = gl_tex;
+                mb_tex_smps[gl_tex_slot].sampler = gl_smp;
+                continue;
+            }
+            #endif
             _sg_gl_cache_bind_texture_sampler(gl_tex_slot, gl_tgt, gl_tex, gl_smp);
         }
     }
+    #if defined(_SOKOL_GL_HAS_MULTIBIND)
+    if (_sg.gl.multi_bind) {
+        _sg_gl_cache_bind_texture_samplers_multi(mb_tex_smps);
+    }
+    #endif
     _SG_GL_CHECK_ERROR();
 
     // bind storage buffer and images
@@ -12021,6 +18166,16 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
             const _sg_buffer_t* sbuf = _sg_buffer_ref_ptr(&view->cmn.buf.ref);
             const uint8_t gl_binding = shd->gl.sbuf_binding[i];
             GLuint gl_sbuf = sbuf->gl.buf[sbuf->cmn.active_slot];
+            #if defined(_SOKOL_GL_HAS_MULTIBIND)
+            if (_sg.gl.multi_bind && _sg.features.compute) {
+                SOKOL_ASSERT(gl_binding < _SG_GL_MAX_SBUF_BINDINGS);
+                SOKOL_ASSERT(view->cmn.buf.offset < sbuf->cmn.size);
+                mb_sbufs[gl_binding] = gl_sbuf;
+                mb_sbuf_offsets[gl_binding] = view->cmn.buf.offset;
+                mb_sbuf_sizes[gl_binding] = sbuf->cmn.size - view->cmn.buf.offset;
+                continue;
+            }
+            #endif
             _sg_gl_cache_bind_storage_buffer(gl_binding, gl_sbuf, view->cmn.buf.offset, sbuf->cmn.size);
         } else if (view->cmn.type == SG_VIEWTYPE_STORAGEIMAGE) {
             #if defined(_SOKOL_GL_HAS_COMPUTE)
@@ -12043,9 +18198,16 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
             #endif
         }
     }
+    #if defined(_SOKOL_GL_HAS_MULTIBIND)
+    if (_sg.gl.multi_bind && _sg.features.compute) {
+        _sg_gl_cache_bind_storage_buffers_multi(mb_sbufs, mb_sbuf_offsets, mb_sbuf_sizes);
+    }
+    #endif
     _SG_GL_CHECK_ERROR();
 
-    if (!bnd->pip->cmn.is_compute) {
+    if (!bnd->pip->cmn.is_compute && _sg.gl.vao_cache.items) {
+        _sg_gl_apply_cached_vertex_array(bnd);
+    } else if (!bnd->pip->cmn.is_compute) {
         // index buffer (can be 0)
         const GLuint gl_ib = bnd->ib ? bnd->ib->gl.buf[bnd->ib->cmn.active_slot] : 0;
         _sg_gl_cache_bind_buffer(GL_ELEMENT_ARRAY_BUFFER, gl_ib);
@@ -12074,15 +18236,7 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
                     (vb_offset != cache_attr->gl_attr.offset) ||
                     (cache_attr->gl_attr.divisor != attr->divisor))
                 {
-                    _sg_gl_cache_bind_buffer(GL_ARRAY_BUFFER, gl_vb);
-                    if (attr->base_type == SG_SHADERATTRBASETYPE_FLOAT) {
-                        glVertexAttribPointer(attr_index, attr->size, attr->type, attr->normalized, attr->stride, (const GLvoid*)(GLintptr)vb_offset);
-                    } else {
-                        glVertexAttribIPointer(attr_index, attr->size, attr->type, attr->stride, (const GLvoid*)(GLintptr)vb_offset);
-                    }
-                    _sg_stats_inc(gl.num_vertex_attrib_pointer);
-                    glVertexAttribDivisor(attr_index, (GLuint)attr->divisor);
-                    _sg_stats_inc(gl.num_vertex_attrib_divisor);
+                    _sg_gl_vertex_attrib_pointer(attr_index, attr, gl_vb, vb_offset);
                     cache_attr_dirty = true;
                 }
                 if (cache_attr->gl_attr.vb_index == -1) {
@@ -12109,7 +18263,7 @@ _SOKOL_PRIVATE bool _sg_gl_apply_bindings(_sg_bindings_ptrs_t* bnd) {
 
     // take care of storage resource memory barriers (this needs to happen after the bindings are set)
     #if defined(_SOKOL_GL_HAS_COMPUTE)
-        _sg_gl_handle_memory_barriers(shd, bnd, 0);
+        _sg_gl_handle_memory_barriers(shd, bnd, 0, 0);
         _SG_GL_CHECK_ERROR();
     #endif
 
@@ -12169,6 +18323,20 @@ _SOKOL_PRIVATE void _sg_gl_apply_uniforms(int ub_slot, const sg_range* data) {
     }
 }
 
+_SOKOL_PRIVATE void _sg_gl_apply_uniform_buffer(int ub_slot, const _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(buf && (offset >= 0));
+    const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    SOKOL_ASSERT(shd->gl.uniform_blocks[ub_slot].glsl_block);
+    const int size = (int)shd->cmn.uniform_blocks[ub_slot].size;
+    SOKOL_ASSERT((offset + size) <= buf->cmn.size);
+    const GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
+    SOKOL_ASSERT(gl_buf);
+    _sg_gl_cache_bind_uniform_buffer(ub_slot, gl_buf, offset, size);
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE void _sg_gl_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
     const GLenum p_type = _sg.gl.cache.cur_primitive_type;
     const bool use_instanced_draw = (num_instances > 1) || _sg.use_instanced_draw;
@@ -12215,6 +18383,81 @@ _SOKOL_PRIVATE void _sg_gl_draw(int base_element, int num_elements, int num_inst
     }
 }
 
+#if defined(_SOKOL_GL_HAS_MULTIDRAW)
+// max number of draws collected into a single glMultiDraw*() call
+#define _SG_GL_MULTIDRAW_SIZE (64)
+
+// issue a run of non-instanced draws as a single glMultiDraw*() call
+_SOKOL_PRIVATE void _sg_gl_multi_draw(const sg_draw_args* args, int count) {
+    SOKOL_ASSERT(args && (count > 0) && (count <= _SG_GL_MULTIDRAW_SIZE));
+    const GLenum p_type = _sg.gl.cache.cur_primitive_type;
+    GLsizei counts[_SG_GL_MULTIDRAW_SIZE];
+    for (int i = 0; i < count; i++) {
+        counts[i] = args[i].num_elements;
+    }
+    if (_sg.use_indexed_draw) {
+        const GLenum i_type = _sg.gl.cache.cur_index_type;
+        const int i_size = (i_type == GL_UNSIGNED_SHORT) ? 2 : 4;
+        const int ib_offset = _sg.gl.cache.cur_ib_offset;
+        const GLvoid* indices[_SG_GL_MULTIDRAW_SIZE];
+        GLint base_vertices[_SG_GL_MULTIDRAW_SIZE];
+        for (int i = 0; i < count; i++) {
+            indices[i] = (const GLvoid*)(GLintptr)(args[i].base_element*i_size+ib_offset);
+            base_vertices[i] = args[i].base_vertex;
+        }
+        glMultiDrawElementsBaseVertex(p_type, counts, i_type, indices, count, base_vertices);
+    } else {
+        GLint firsts[_SG_GL_MULTIDRAW_SIZE];
+        for (int i = 0; i < count; i++) {
+            firsts[i] = args[i].base_element;
+        }
+        glMultiDrawArrays(p_type, firsts, counts, count);
+    }
+    _sg_stats_inc(gl.num_multi_draw);
+}
+#endif
+
+_SOKOL_PRIVATE void _sg_gl_draw_batch(const sg_draw_args* args, int count) {
+    SOKOL_ASSERT(args && (count > 0));
+    #if defined(_SOKOL_GL_HAS_MULTIDRAW)
+    if (!_sg.use_instanced_draw) {
+        // collect runs of non-instanced draws into glMultiDraw*() calls,
+        // instanced draws interrupt a run and are issued separately
+        sg_draw_args run[_SG_GL_MULTIDRAW_SIZE];
+        int num_run = 0;
+        for (int i = 0; i < count; i++) {
+            const sg_draw_args* a = &args[i];
+            if ((0 == a->num_elements) || (0 == a->num_instances)) {
+                continue;
+            }
+            if ((a->num_instances == 1) && (a->base_instance == 0)) {
+                run[num_run++] = *a;
+                if (num_run == _SG_GL_MULTIDRAW_SIZE) {
+                    _sg_gl_multi_draw(run, num_run);
+                    num_run = 0;
+                }
+            } else {
+                if (num_run > 0) {
+                    _sg_gl_multi_draw(run, num_run);
+                    num_run = 0;
+                }
+                _sg_gl_draw(a->base_element, a->num_elements, a->num_instances, a->base_vertex, a->base_instance);
+            }
+        }
+        if (num_run > 0) {
+            _sg_gl_multi_draw(run, num_run);
+        }
+        return;
+    }
+    #endif
+    for (int i = 0; i < count; i++) {
+        const sg_draw_args* a = &args[i];
+        if ((a->num_elements > 0) && (a->num_instances > 0)) {
+            _sg_gl_draw(a->base_element, a->num_elements, a->num_instances, a->base_vertex, a->base_instance);
+        }
+    }
+}
+
 _SOKOL_PRIVATE void _sg_gl_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     #if defined(_SOKOL_GL_HAS_COMPUTE)
         if (!_sg.features.compute) {
@@ -12226,10 +18469,105 @@ _SOKOL_PRIVATE void _sg_gl_dispatch(int num_groups_x, int num_groups_y, int num_
     #endif
 }
 
+_SOKOL_PRIVATE void _sg_gl_dispatch_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf);
+    #if defined(_SOKOL_GL_HAS_COMPUTE)
+        if (!_sg.features.dispatch_indirect) {
+            return;
+        }
+        _sg_gl_handle_memory_barriers(0, 0, 0, buf);
+        const GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
+        _sg_gl_cache_bind_buffer(GL_DISPATCH_INDIRECT_BUFFER, gl_buf);
+        glDispatchComputeIndirect((GLintptr)offset);
+        _SG_GL_CHECK_ERROR();
+    #else
+        (void)buf; (void)offset;
+    #endif
+}
+
+// read back the result of a query slot, GL_QUERY_RESULT blocks until the
+// result is available, so this must only be called when the result is
+// known to be available, or when the slot must be reused
+_SOKOL_PRIVATE void _sg_gl_counter_read_slot(_sg_counter_t* ctr, int slot) {
+    SOKOL_ASSERT(ctr && ctr->gl.pending[slot]);
+    uint64_t values[_SG_GL_NUM_QUERY_COUNTERS];
+    for (int c = 0; c < ctr->gl.num_counters; c++) {
+        GLuint val = 0;
+        glGetQueryObjectuiv(ctr->gl.ids[slot][c], GL_QUERY_RESULT, &val);
+        values[c] = val;
+    }
+    ctr->gl.pending[slot] = false;
+    ctr->cmn.result.available = true;
+    ctr->cmn.result.frame_index = ctr->gl.frame_index[slot];
+    if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+        sg_pipeline_stats* ps = &ctr->cmn.result.pipeline_stats;
+        ps->vertex_invocations = values[0];
+        ps->fragment_invocations = values[1];
+        ps->compute_invocations = values[2];
+        ps->clipping_input_primitives = values[3];
+        ps->clipping_output_primitives = values[4];
+    } else {
+        ctr->cmn.result.samples_passed = values[0];
+    }
+}
+
+_SOKOL_PRIVATE void _sg_gl_begin_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    const int slot = ctr->gl.cur_slot;
+    // the slot is the oldest in the ring, if its result hasn't been read yet
+    // (because sg_query_counter_value() wasn't called in the meantime), read it
+    // now instead of dropping it, since a counter is used at most once per frame
+    // this result is _SG_GL_NUM_QUERY_SLOTS frames old and won't stall in practice
+    if (ctr->gl.pending[slot]) {
+        _sg_gl_counter_read_slot(ctr, slot);
+    }
+    for (int i = 0; i < ctr->gl.num_counters; i++) {
+        glBeginQuery(ctr->gl.targets[i], ctr->gl.ids[slot][i]);
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
+_SOKOL_PRIVATE void _sg_gl_end_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    const int slot = ctr->gl.cur_slot;
+    for (int i = 0; i < ctr->gl.num_counters; i++) {
+        glEndQuery(ctr->gl.targets[i]);
+    }
+    _SG_GL_CHECK_ERROR();
+    ctr->gl.pending[slot] = true;
+    ctr->gl.frame_index[slot] = _sg.frame_index;
+    ctr->gl.cur_slot = (slot + 1) % _SG_GL_NUM_QUERY_SLOTS;
+}
+
+// poll the pending query objects from oldest to newest without stalling
+_SOKOL_PRIVATE void _sg_gl_counter_result(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    _SG_GL_CHECK_ERROR();
+    for (int i = 0; i < _SG_GL_NUM_QUERY_SLOTS; i++) {
+        const int slot = (ctr->gl.cur_slot + i) % _SG_GL_NUM_QUERY_SLOTS;
+        if (!ctr->gl.pending[slot]) {
+            continue;
+        }
+        GLuint available = 1;
+        for (int c = 0; (c < ctr->gl.num_counters) && available; c++) {
+            glGetQueryObjectuiv(ctr->gl.ids[slot][c], GL_QUERY_RESULT_AVAILABLE, &available);
+        }
+        if (!available) {
+            // later queries can't be available either
+            break;
+        }
+        _sg_gl_counter_read_slot(ctr, slot);
+    }
+    _SG_GL_CHECK_ERROR();
+}
+
 _SOKOL_PRIVATE void _sg_gl_commit(void) {
     // "soft" clear bindings (only those that are actually bound)
     _sg_gl_cache_clear_buffer_bindings(false);
     _sg_gl_cache_clear_texture_sampler_bindings(false);
+    if (_sg_gl_fences_num_buffers() > 0) {
+        _sg_gl_insert_frame_fence();
+    }
 }
 
 _SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
@@ -12242,6 +18580,11 @@ _SOKOL_PRIVATE void _sg_gl_update_buffer(_sg_buffer_t* buf, const sg_range* data
     SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
+    if (buf->gl.persistent) {
+        uint8_t* dst = _sg_gl_acquire_mapped_buffer(buf, buf->cmn.active_slot);
+        memcpy(dst, data->ptr, data->size);
+        return;
+    }
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_store_buffer_binding(gl_tgt);
     _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
@@ -12261,6 +18604,11 @@ _SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data
     SOKOL_ASSERT(buf->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
     GLuint gl_buf = buf->gl.buf[buf->cmn.active_slot];
     SOKOL_ASSERT(gl_buf);
+    if (buf->gl.persistent) {
+        uint8_t* dst = _sg_gl_acquire_mapped_buffer(buf, buf->cmn.active_slot);
+        memcpy(dst + buf->cmn.append_pos, data->ptr, data->size);
+        return;
+    }
     _SG_GL_CHECK_ERROR();
     _sg_gl_cache_store_buffer_binding(gl_tgt);
     _sg_gl_cache_bind_buffer(gl_tgt, gl_buf);
@@ -12271,18 +18619,41 @@ _SOKOL_PRIVATE void _sg_gl_append_buffer(_sg_buffer_t* buf, const sg_range* data
 
 _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* data) {
     SOKOL_ASSERT(img && data);
+    const uint64_t start_ns = _sg.stats_enabled ? _sg_time_now_ns() : 0;
     // only one update per image per frame allowed
     if (++img->cmn.active_slot >= img->cmn.num_slots) {
         img->cmn.active_slot = 0;
     }
-    SOKOL_ASSERT(img->cmn.active_slot < SG_NUM_INFLIGHT_FRAMES);
-    SOKOL_ASSERT(0 != img->gl.tex[img->cmn.active_slot]);
-    _sg_gl_cache_store_texture_sampler_binding(0);
-    _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[img->cmn.active_slot], 0);
+    const int slot = img->cmn.active_slot;
+    SOKOL_ASSERT(slot < SG_NUM_INFLIGHT_FRAMES);
+    SOKOL_ASSERT(0 != img->gl.tex[slot]);
     const int num_mips = img->cmn.num_mipmaps;
+    // if the image has persistently mapped pixel unpack buffers, copy the new
+    // content into the buffer of the active slot and let glTexSubImage*() source
+    // from the buffer, the texture upload then happens asynchronously on the GPU
+    uint8_t* pbo_ptr = 0;
+    if (img->gl.pbo[slot]) {
+        size_t total_size = 0;
+        for (int mip_index = 0; mip_index < num_mips; mip_index++) {
+            total_size += data->mip_levels[mip_index].size;
+        }
+        if (total_size <= (size_t)img->gl.pbo_size) {
+            pbo_ptr = _sg_gl_acquire_mapped_pbo(img, slot);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, img->gl.pbo[slot]);
+            _sg_stats_inc(gl.num_bind_buffer);
+        }
+    }
+    _sg_gl_cache_store_texture_sampler_binding(0);
+    _sg_gl_cache_bind_texture_sampler(0, img->gl.target, img->gl.tex[slot], 0);
+    size_t pbo_offset = 0;
     for (int mip_index = 0; mip_index < num_mips; mip_index++) {
         const GLvoid* data_ptr = data->mip_levels[mip_index].ptr;
         const GLsizei data_size = (GLsizei)data->mip_levels[mip_index].size;
+        if (pbo_ptr) {
+            memcpy(pbo_ptr + pbo_offset, data_ptr, (size_t)data_size);
+            data_ptr = (const GLvoid*)(uintptr_t)pbo_offset;
+            pbo_offset += (size_t)data_size;
+        }
         const int mip_width = _sg_miplevel_dim(img->cmn.width, mip_index);
         const int mip_height = _sg_miplevel_dim(img->cmn.height, mip_index);
         const int mip_depth = (SG_IMAGETYPE_3D == img->cmn.type) ? _sg_miplevel_dim(img->cmn.num_slices, mip_index) : img->cmn.num_slices;
@@ -12292,14 +18663,22 @@ _SOKOL_PRIVATE void _sg_gl_update_image(_sg_image_t* img, const sg_image_data* d
             const uint8_t* surf_ptr = (const uint8_t*) data_ptr;
             for (int i = 0; i < 6; i++) {
                 const GLenum gl_img_target = _sg_gl_cubeface_target(i);
-                _sg_gl_texsubimage(img, gl_img_target, mip_index, mip_width, mip_height, mip_depth, surf_ptr, surf_pitch);
+                _sg_gl_texsubimage(img, gl_img_target, mip_index, mip_width, mip_height, mip_depth, surf_ptr, surf_pitch, 0 != pbo_ptr);
                 surf_ptr += surf_pitch;
             }
         } else {
-            _sg_gl_texsubimage(img, img->gl.target, mip_index, mip_width, mip_height, mip_depth, data_ptr, data_size);
+            _sg_gl_texsubimage(img, img->gl.target, mip_index, mip_width, mip_height, mip_depth, data_ptr, data_size, 0 != pbo_ptr);
         }
     }
     _sg_gl_cache_restore_texture_sampler_binding(0);
+    if (pbo_ptr) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        _sg_stats_inc(gl.num_bind_buffer);
+        _sg_stats_inc(gl.num_pbo_uploads);
+    }
+    if (start_ns != 0) {
+        _sg_stats_add(gl.upload_time_us, (uint32_t)((_sg_time_now_ns() - start_ns) / 1000));
+    }
 }
 
 // ██████  ██████  ██████   ██  ██     ██████   █████   ██████ ██   ██ ███████ ███    ██ ██████
@@ -15162,6 +21541,7 @@ _SOKOL_PRIVATE void _sg_mtl_init_caps(void) {
     _sg.features.draw_base_instance = true;
     _sg.features.dual_source_blending = true;
     _sg.features.vertexformat_int10_n2 = true;
+    _sg.features.uniform_buffer_bindings = true;
 
     _sg.features.image_clamp_to_border = false;
     #if (MAC_OS_X_VERSION_MAX_ALLOWED >= 120000) || (__IPHONE_OS_VERSION_MAX_ALLOWED >= 140000)
@@ -15198,6 +21578,7 @@ _SOKOL_PRIVATE void _sg_mtl_init_caps(void) {
     _sg.limits.max_storage_buffer_bindings_per_stage = _sg_min(_SG_MTL_MAX_STAGE_BUFFER_BINDINGS - (SG_MAX_VERTEXBUFFER_BINDSLOTS + SG_MAX_UNIFORMBLOCK_BINDSLOTS), SG_MAX_VIEW_BINDSLOTS);
     _sg.limits.max_color_attachments = _sg_min(8, SG_MAX_COLOR_ATTACHMENTS);
     _sg.limits.max_vertex_attrs = SG_MAX_VERTEX_ATTRIBUTES;
+    _sg.limits.uniform_buffer_offset_alignment = _SG_MTL_UB_ALIGN;
 
     _sg_pixelformat_all(&_sg.formats[SG_PIXELFORMAT_R8]);
     _sg_pixelformat_all(&_sg.formats[SG_PIXELFORMAT_R8SN]);
@@ -15389,6 +21770,9 @@ _SOKOL_PRIVATE void _sg_mtl_setup_backend(const sg_desc* desc) {
             _sg.mtl.use_shared_storage_mode = true;
         #endif
     }
+    if (@available(macOS 11.0, iOS 13.0, *)) {
+        _sg.mtl.memoryless_attachments = [_sg.mtl.device supportsFamily:MTLGPUFamilyApple1];
+    }
     _sg_mtl_init_caps();
 }
 
@@ -15526,7 +21910,8 @@ _SOKOL_PRIVATE bool _sg_mtl_init_texdesc(MTLTextureDescriptor* mtl_desc, _sg_ima
 
     const sg_image_usage* usg = &img->cmn.usage;
     const bool any_attachment = usg->color_attachment || usg->resolve_attachment || usg->depth_stencil_attachment;
-    MTLTextureUsage mtl_tex_usage = MTLTextureUsageShaderRead;
+    // transient attachments are never sampled
+    MTLTextureUsage mtl_tex_usage = usg->transient_attachment ? 0 : MTLTextureUsageShaderRead;
     if (any_attachment) {
         mtl_tex_usage |= MTLTextureUsageRenderTarget;
     }
@@ -15536,7 +21921,14 @@ _SOKOL_PRIVATE bool _sg_mtl_init_texdesc(MTLTextureDescriptor* mtl_desc, _sg_ima
     mtl_desc.usage = mtl_tex_usage;
 
     MTLResourceOptions mtl_res_options = 0;
-    if (any_attachment || img->cmn.usage.storage_image) {
+    if (usg->transient_attachment && _sg.mtl.memoryless_attachments) {
+        // memoryless textures only live in tile memory (transient images are never resolve targets)
+        if (@available(macOS 11.0, iOS 10.0, *)) {
+            mtl_res_options |= MTLResourceStorageModeMemoryless;
+        } else {
+            mtl_res_options |= MTLResourceStorageModePrivate;
+        }
+    } else if (any_attachment || img->cmn.usage.storage_image) {
         mtl_res_options |= MTLResourceStorageModePrivate;
     } else {
         mtl_res_options |= _sg_mtl_resource_options_storage_mode_managed_or_shared();
@@ -16057,6 +22449,9 @@ _SOKOL_PRIVATE void _sg_mtl_bind_uniform_buffers(void) {
     // In the Metal backend, uniform buffer bindings happen once in sg_begin_pass() and
     // remain valid for the entire pass. Only binding offsets will be updated
     // in sg_apply_uniforms()
+    _sg.mtl.cur_vs_ext_ubs = 0;
+    _sg.mtl.cur_fs_ext_ubs = 0;
+    _sg.mtl.cur_cs_ext_ubs = 0;
     if (_sg.cur_pass.is_compute) {
         SOKOL_ASSERT(nil != _sg.mtl.compute_cmd_encoder);
         for (size_t slot = 0; slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS; slot++) {
@@ -16120,8 +22515,12 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
             SOKOL_ASSERT(color_img->slot.state == SG_RESOURCESTATE_VALID);
             SOKOL_ASSERT(color_img->cmn.active_slot == 0);
             SOKOL_ASSERT(color_img->mtl.tex[0] != _SG_MTL_INVALID_SLOT_INDEX);
-            pass_desc.colorAttachments[i].loadAction = _sg_mtl_load_action(action->colors[i].load_action);
-            pass_desc.colorAttachments[i].storeAction = _sg_mtl_store_action(action->colors[i].store_action, resolve_view != 0);
+            // NOTE: transient attachments are never loaded or stored (required for memoryless textures)
+            const bool color_transient = color_img->cmn.usage.transient_attachment;
+            pass_desc.colorAttachments[i].loadAction = (color_transient && (action->colors[i].load_action == SG_LOADACTION_LOAD))
+                ? MTLLoadActionDontCare
+                : _sg_mtl_load_action(action->colors[i].load_action);
+            pass_desc.colorAttachments[i].storeAction = _sg_mtl_store_action(color_transient ? SG_STOREACTION_DONTCARE : action->colors[i].store_action, resolve_view != 0);
             sg_color c = action->colors[i].clear_value;
             pass_desc.colorAttachments[i].clearColor = MTLClearColorMake(c.r, c.g, c.b, c.a);
             pass_desc.colorAttachments[i].texture = _sg_mtl_id(color_img->mtl.tex[0]);
@@ -16161,9 +22560,14 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
             SOKOL_ASSERT(ds_img->slot.state == SG_RESOURCESTATE_VALID);
             SOKOL_ASSERT(ds_img->cmn.active_slot == 0);
             SOKOL_ASSERT(ds_img->mtl.tex[0] != _SG_MTL_INVALID_SLOT_INDEX);
+            const bool ds_transient = ds_img->cmn.usage.transient_attachment;
+            const sg_load_action depth_load_action = (ds_transient && (action->depth.load_action == SG_LOADACTION_LOAD))
+                ? SG_LOADACTION_DONTCARE
+                : action->depth.load_action;
+            const sg_store_action depth_store_action = ds_transient ? SG_STOREACTION_DONTCARE : action->depth.store_action;
             pass_desc.depthAttachment.texture = _sg_mtl_id(ds_img->mtl.tex[0]);
-            pass_desc.depthAttachment.loadAction = _sg_mtl_load_action(action->depth.load_action);
-            pass_desc.depthAttachment.storeAction = _sg_mtl_store_action(action->depth.store_action, false);
+            pass_desc.depthAttachment.loadAction = _sg_mtl_load_action(depth_load_action);
+            pass_desc.depthAttachment.storeAction = _sg_mtl_store_action(depth_store_action, false);
             pass_desc.depthAttachment.clearDepth = action->depth.clear_value;
             switch (ds_img->cmn.type) {
                 case SG_IMAGETYPE_CUBE:
@@ -16177,8 +22581,11 @@ _SOKOL_PRIVATE void _sg_mtl_begin_render_pass(const sg_pass* pass, const _sg_att
             }
             if (_sg_is_depth_stencil_format(ds_img->cmn.pixel_format)) {
                 pass_desc.stencilAttachment.texture = _sg_mtl_id(ds_img->mtl.tex[0]);
-                pass_desc.stencilAttachment.loadAction = _sg_mtl_load_action(action->stencil.load_action);
-                pass_desc.stencilAttachment.storeAction = _sg_mtl_store_action(action->depth.store_action, false);
+                const sg_load_action stencil_load_action = (ds_transient && (action->stencil.load_action == SG_LOADACTION_LOAD))
+                    ? SG_LOADACTION_DONTCARE
+                    : action->stencil.load_action;
+                pass_desc.stencilAttachment.loadAction = _sg_mtl_load_action(stencil_load_action);
+                pass_desc.stencilAttachment.storeAction = _sg_mtl_store_action(depth_store_action, false);
                 pass_desc.stencilAttachment.clearStencil = action->stencil.clear_value;
                 switch (ds_img->cmn.type) {
                     case SG_IMAGETYPE_CUBE:
@@ -16656,26 +23063,79 @@ _SOKOL_PRIVATE void _sg_mtl_apply_uniforms(int ub_slot, const sg_range* data) {
     const NSUInteger mtl_slot = shd->mtl.ub_buffer_n[ub_slot];
 
     // copy to global uniform buffer, record offset into cmd encoder, and advance offset
+    // (if a user buffer has been bound to the slot, the global uniform buffer must be rebound)
     uint8_t* dst = &_sg.mtl.cur_ub_base_ptr[_sg.mtl.cur_ub_offset];
     memcpy(dst, data->ptr, data->size);
+    const NSUInteger ub_offset = (NSUInteger)_sg.mtl.cur_ub_offset;
+    id<MTLBuffer> ub = _sg.mtl.uniform_buffers[_sg.mtl.cur_frame_rotate_index];
+    const uint32_t ub_mask = 1u << mtl_slot;
     if (stage == SG_SHADERSTAGE_VERTEX) {
         SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
-        [_sg.mtl.render_cmd_encoder setVertexBufferOffset:(NSUInteger)_sg.mtl.cur_ub_offset atIndex:mtl_slot];
-        _sg_stats_inc(metal.uniforms.num_set_vertex_buffer_offset);
+        if (_sg.mtl.cur_vs_ext_ubs & ub_mask) {
+            _sg.mtl.cur_vs_ext_ubs &= ~ub_mask;
+            [_sg.mtl.render_cmd_encoder setVertexBuffer:ub offset:ub_offset atIndex:mtl_slot];
+            _sg_stats_inc(metal.bindings.num_set_vertex_buffer);
+        } else {
+            [_sg.mtl.render_cmd_encoder setVertexBufferOffset:ub_offset atIndex:mtl_slot];
+            _sg_stats_inc(metal.uniforms.num_set_vertex_buffer_offset);
+        }
     } else if (stage == SG_SHADERSTAGE_FRAGMENT) {
         SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
-        [_sg.mtl.render_cmd_encoder setFragmentBufferOffset:(NSUInteger)_sg.mtl.cur_ub_offset atIndex:mtl_slot];
-        _sg_stats_inc(metal.uniforms.num_set_fragment_buffer_offset);
+        if (_sg.mtl.cur_fs_ext_ubs & ub_mask) {
+            _sg.mtl.cur_fs_ext_ubs &= ~ub_mask;
+            [_sg.mtl.render_cmd_encoder setFragmentBuffer:ub offset:ub_offset atIndex:mtl_slot];
+            _sg_stats_inc(metal.bindings.num_set_fragment_buffer);
+        } else {
+            [_sg.mtl.render_cmd_encoder setFragmentBufferOffset:ub_offset atIndex:mtl_slot];
+            _sg_stats_inc(metal.uniforms.num_set_fragment_buffer_offset);
+        }
     } else if (stage == SG_SHADERSTAGE_COMPUTE) {
         SOKOL_ASSERT(nil != _sg.mtl.compute_cmd_encoder);
-        [_sg.mtl.compute_cmd_encoder setBufferOffset:(NSUInteger)_sg.mtl.cur_ub_offset atIndex:mtl_slot];
-        _sg_stats_inc(metal.uniforms.num_set_compute_buffer_offset);
+        if (_sg.mtl.cur_cs_ext_ubs & ub_mask) {
+            _sg.mtl.cur_cs_ext_ubs &= ~ub_mask;
+            [_sg.mtl.compute_cmd_encoder setBuffer:ub offset:ub_offset atIndex:mtl_slot];
+            _sg_stats_inc(metal.bindings.num_set_compute_buffer);
+        } else {
+            [_sg.mtl.compute_cmd_encoder setBufferOffset:ub_offset atIndex:mtl_slot];
+            _sg_stats_inc(metal.uniforms.num_set_compute_buffer_offset);
+        }
     } else {
         SOKOL_UNREACHABLE;
     }
     _sg.mtl.cur_ub_offset = _sg_roundup(_sg.mtl.cur_ub_offset + (int)data->size, _SG_MTL_UB_ALIGN);
 }
 
+_SOKOL_PRIVATE void _sg_mtl_apply_uniform_buffer(int ub_slot, const _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    SOKOL_ASSERT(buf && (offset >= 0));
+    const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    SOKOL_ASSERT(pip);
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    const sg_shader_stage stage = shd->cmn.uniform_blocks[ub_slot].stage;
+    const NSUInteger mtl_slot = shd->mtl.ub_buffer_n[ub_slot];
+    SOKOL_ASSERT(buf->mtl.buf[buf->cmn.active_slot] != _SG_MTL_INVALID_SLOT_INDEX);
+    id<MTLBuffer> mtl_buf = _sg_mtl_id(buf->mtl.buf[buf->cmn.active_slot]);
+    const uint32_t ub_mask = 1u << mtl_slot;
+    if (stage == SG_SHADERSTAGE_VERTEX) {
+        SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
+        [_sg.mtl.render_cmd_encoder setVertexBuffer:mtl_buf offset:(NSUInteger)offset atIndex:mtl_slot];
+        _sg.mtl.cur_vs_ext_ubs |= ub_mask;
+        _sg_stats_inc(metal.bindings.num_set_vertex_buffer);
+    } else if (stage == SG_SHADERSTAGE_FRAGMENT) {
+        SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
+        [_sg.mtl.render_cmd_encoder setFragmentBuffer:mtl_buf offset:(NSUInteger)offset atIndex:mtl_slot];
+        _sg.mtl.cur_fs_ext_ubs |= ub_mask;
+        _sg_stats_inc(metal.bindings.num_set_fragment_buffer);
+    } else if (stage == SG_SHADERSTAGE_COMPUTE) {
+        SOKOL_ASSERT(nil != _sg.mtl.compute_cmd_encoder);
+        [_sg.mtl.compute_cmd_encoder setBuffer:mtl_buf offset:(NSUInteger)offset atIndex:mtl_slot];
+        _sg.mtl.cur_cs_ext_ubs |= ub_mask;
+        _sg_stats_inc(metal.bindings.num_set_compute_buffer);
+    } else {
+        SOKOL_UNREACHABLE;
+    }
+}
+
 _SOKOL_PRIVATE void _sg_mtl_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
     SOKOL_ASSERT(nil != _sg.mtl.render_cmd_encoder);
     const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
@@ -18873,7 +25333,9 @@ _SOKOL_PRIVATE bool _sg_vk_is_read_access(_sg_vk_access_t access) {
         _SG_VK_ACCESS_INDEXBUFFER |
         _SG_VK_ACCESS_STORAGEBUFFER_RO |
         _SG_VK_ACCESS_TEXTURE |
-        _SG_VK_ACCESS_PRESENT;
+        _SG_VK_ACCESS_PRESENT |
+        _SG_VK_ACCESS_INDIRECT |
+        _SG_VK_ACCESS_UNIFORMBUFFER;
     return 0 == (access & ~read_bits);
 }
 
@@ -18898,7 +25360,10 @@ _SOKOL_PRIVATE VkPipelineStageFlags2 _sg_vk_stage_mask(_sg_vk_access_t access, b
     if (access & _SG_VK_ACCESS_INDEXBUFFER) {
         f |= VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT;
     }
-    if (access & (_SG_VK_ACCESS_STORAGEBUFFER_RO|_SG_VK_ACCESS_TEXTURE)) {
+    if (access & _SG_VK_ACCESS_INDIRECT) {
+        f |= VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT;
+    }
+    if (access & (_SG_VK_ACCESS_STORAGEBUFFER_RO|_SG_VK_ACCESS_TEXTURE|_SG_VK_ACCESS_UNIFORMBUFFER)) {
         f |= VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT |
              VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT |
              VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
@@ -18949,9 +25414,15 @@ _SOKOL_PRIVATE VkAccessFlags2 _sg_vk_access_mask(_sg_vk_access_t access, bool is
         if (access & _SG_VK_ACCESS_INDEXBUFFER) {
             f |= VK_ACCESS_2_INDEX_READ_BIT;
         }
+        if (access & _SG_VK_ACCESS_INDIRECT) {
+            f |= VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT;
+        }
         if (access & _SG_VK_ACCESS_STORAGEBUFFER_RO) {
             f |= VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
         }
+        if (access & _SG_VK_ACCESS_UNIFORMBUFFER) {
+            f |= VK_ACCESS_2_UNIFORM_READ_BIT;
+        }
         if (access & _SG_VK_ACCESS_TEXTURE) {
             f |= VK_ACCESS_2_SHADER_SAMPLED_READ_BIT;
         }
@@ -19085,6 +25556,40 @@ _SOKOL_PRIVATE void _sg_vk_swapchain_endpass_barrier(VkCommandBuffer cmd_buf, Vk
     _sg_stats_inc(vk.num_cmd_pipeline_barrier);
 }
 
+// resources which may be accessed by the graphics and compute queue family
+_SOKOL_PRIVATE void _sg_vk_init_buffer_sharing_mode(VkBufferCreateInfo* create_info) {
+    if (_sg.vk.compute.concurrent) {
+        create_info->sharingMode = VK_SHARING_MODE_CONCURRENT;
+        create_info->queueFamilyIndexCount = 2;
+        create_info->pQueueFamilyIndices = _sg.vk.compute.queue_family_indices;
+    } else {
+        create_info->sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_vk_init_image_sharing_mode(VkImageCreateInfo* create_info) {
+    if (_sg.vk.compute.concurrent) {
+        create_info->sharingMode = VK_SHARING_MODE_CONCURRENT;
+        create_info->queueFamilyIndexCount = 2;
+        create_info->pQueueFamilyIndices = _sg.vk.compute.queue_family_indices;
+    } else {
+        create_info->sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    }
+}
+
+// graphics pipeline stages don't exist on a compute-only queue, and the ordering
+// against the graphics queue is done with timeline semaphores, so barriers in
+// async compute passes only need a coarse dependency on the compute queue itself
+_SOKOL_PRIVATE void _sg_vk_async_compute_barrier_masks(VkPipelineStageFlags2* src_stage, VkAccessFlags2* src_access, VkPipelineStageFlags2* dst_stage, VkAccessFlags2* dst_access) {
+    SOKOL_ASSERT(src_stage && src_access && dst_stage && dst_access);
+    if (_sg.vk.compute.recording) {
+        *src_stage = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        *src_access = VK_ACCESS_2_MEMORY_WRITE_BIT;
+        *dst_stage = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        *dst_access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+    }
+}
+
 _SOKOL_PRIVATE void _sg_vk_image_barrier(VkCommandBuffer cmd_buf, _sg_image_t* img, _sg_vk_access_t new_access) {
     SOKOL_ASSERT(cmd_buf && img && img->vk.img);
     if (_sg_vk_is_read_access(img->vk.cur_access) && _sg_vk_is_read_access(new_access)) {
@@ -19098,6 +25603,7 @@ _SOKOL_PRIVATE void _sg_vk_image_barrier(VkCommandBuffer cmd_buf, _sg_image_t* i
     barrier.dstStageMask = _sg_vk_dst_stage_mask(new_access);
     barrier.dstAccessMask = _sg_vk_dst_access_mask(new_access);
     barrier.newLayout = _sg_vk_image_layout(new_access);
+    _sg_vk_async_compute_barrier_masks(&barrier.srcStageMask, &barrier.srcAccessMask, &barrier.dstStageMask, &barrier.dstAccessMask);
     barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     barrier.image = img->vk.img;
@@ -19131,6 +25637,7 @@ _SOKOL_PRIVATE void _sg_vk_buffer_barrier(VkCommandBuffer cmd_buf, _sg_buffer_t*
     barrier.srcAccessMask = _sg_vk_src_access_mask(buf->vk.cur_access);
     barrier.dstStageMask = _sg_vk_dst_stage_mask(new_access);
     barrier.dstAccessMask = _sg_vk_dst_access_mask(new_access);
+    _sg_vk_async_compute_barrier_masks(&barrier.srcStageMask, &barrier.srcAccessMask, &barrier.dstStageMask, &barrier.dstAccessMask);
     barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
     barrier.buffer = buf->vk.buf;
@@ -19266,11 +25773,20 @@ _SOKOL_PRIVATE void _sg_vk_barrier_on_apply_bindings(VkCommandBuffer cmd_buf, co
     }
 }
 
+// an indirect-dispatch argument buffer may have been written by a previous
+// compute pass (already transitioned at the end of that pass), or by a
+// previous dispatch in the current compute pass
+_SOKOL_PRIVATE void _sg_vk_barrier_on_dispatch_indirect(VkCommandBuffer cmd_buf, _sg_buffer_t* buf) {
+    SOKOL_ASSERT(cmd_buf && buf);
+    _sg_vk_buffer_barrier(cmd_buf, buf, _SG_VK_ACCESS_INDIRECT);
+    _sg_track_add(&_sg.vk.track.buffers, buf->slot.id);
+}
+
 _SOKOL_PRIVATE void _sg_vk_barrier_on_end_pass(VkCommandBuffer cmd_buf, const _sg_attachments_ptrs_t* atts, bool is_compute_pass) {
     SOKOL_ASSERT(cmd_buf);
     if (is_compute_pass) {
-        // transition all tracked buffers into vertex+index+sbuf-ro access
-        const _sg_vk_access_t new_buf_access = _SG_VK_ACCESS_VERTEXBUFFER|_SG_VK_ACCESS_INDEXBUFFER|_SG_VK_ACCESS_STORAGEBUFFER_RO;
+        // transition all tracked buffers into vertex+index+sbuf-ro+indirect+uniform access
+        const _sg_vk_access_t new_buf_access = _SG_VK_ACCESS_VERTEXBUFFER|_SG_VK_ACCESS_INDEXBUFFER|_SG_VK_ACCESS_STORAGEBUFFER_RO|_SG_VK_ACCESS_INDIRECT|_SG_VK_ACCESS_UNIFORMBUFFER;
         for (int i = 0; i < _sg.vk.track.buffers.cur_slot; i++) {
             const uint32_t buf_id = _sg.vk.track.buffers.slots[i];
             _sg_buffer_t* buf = _sg_lookup_buffer(buf_id);
@@ -19299,20 +25815,22 @@ _SOKOL_PRIVATE void _sg_vk_barrier_on_end_pass(VkCommandBuffer cmd_buf, const _s
                 : (VkImage)_sg.vk.swapchain.render_image;
             _sg_vk_swapchain_endpass_barrier(cmd_buf, present_image, _SG_VK_ACCESS_COLOR_ATTACHMENT, true);
         } else {
+            // NOTE: transient images can't be sampled and are never transitioned into texture access
             for (int i = 0; i < atts->num_color_views; i++) {
-                if (_sg.cur_pass.action.colors[i].store_action == SG_STOREACTION_STORE) {
-                    SOKOL_ASSERT(atts->color_views[i]);
-                    _sg_image_t* img = _sg_image_ref_ptr(&atts->color_views[i]->cmn.img.ref);
+                SOKOL_ASSERT(atts->color_views[i]);
+                _sg_image_t* img = _sg_image_ref_ptr(&atts->color_views[i]->cmn.img.ref);
+                if ((_sg.cur_pass.action.colors[i].store_action == SG_STOREACTION_STORE) && !img->cmn.usage.transient_attachment) {
                     _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_TEXTURE);
                 }
                 if (atts->resolve_views[i]) {
-                    _sg_image_t* img = _sg_image_ref_ptr(&atts->resolve_views[i]->cmn.img.ref);
-                    _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_TEXTURE);
+                    // NOTE: resolve images are never transient
+                    _sg_image_t* rsv_img = _sg_image_ref_ptr(&atts->resolve_views[i]->cmn.img.ref);
+                    _sg_vk_image_barrier(cmd_buf, rsv_img, _SG_VK_ACCESS_TEXTURE);
                 }
             }
             if (atts->ds_view) {
                 _sg_image_t* img = _sg_image_ref_ptr(&atts->ds_view->cmn.img.ref);
-                if (_sg.cur_pass.action.depth.store_action == SG_STOREACTION_STORE) {
+                if ((_sg.cur_pass.action.depth.store_action == SG_STOREACTION_STORE) && !img->cmn.usage.transient_attachment) {
                     _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_TEXTURE);
                 }
             }
@@ -19349,6 +25867,9 @@ _SOKOL_PRIVATE VkDeviceMemory _sg_vk_mem_alloc_device_memory(_sg_vk_memtype_t me
         case _SG_VK_MEMTYPE_IMAGE:
             mem_prop_flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             break;
+        case _SG_VK_MEMTYPE_TRANSIENT_IMAGE:
+            mem_prop_flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+            break;
         case _SG_VK_MEMTYPE_STAGING_COPY:
             mem_prop_flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
             break;
@@ -19369,6 +25890,10 @@ _SOKOL_PRIVATE VkDeviceMemory _sg_vk_mem_alloc_device_memory(_sg_vk_memtype_t me
     }
 
     int mem_type_index = _sg_vk_mem_find_memory_type_index(mem_reqs->memoryTypeBits, mem_prop_flags);
+    if ((-1 == mem_type_index) && (mem_type == _SG_VK_MEMTYPE_TRANSIENT_IMAGE)) {
+        // lazily allocated memory is usually only available on tiled GPUs
+        mem_type_index = _sg_vk_mem_find_memory_type_index(mem_reqs->memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
     if (-1 == mem_type_index) {
         _SG_ERROR(VULKAN_ALLOC_DEVICE_MEMORY_NO_SUITABLE_MEMORY_TYPE);
         return 0;
@@ -19407,7 +25932,7 @@ _SOKOL_PRIVATE bool _sg_vk_mem_alloc_buffer_device_memory(_sg_buffer_t* buf) {
     SOKOL_ASSERT(0 == buf->vk.mem);
     _SG_STRUCT(VkMemoryRequirements, mem_reqs);
     vkGetBufferMemoryRequirements(_sg.vk.dev, buf->vk.buf, &mem_reqs);
-    _sg_vk_memtype_t mem_type = buf->cmn.usage.storage_buffer
+    _sg_vk_memtype_t mem_type = (buf->cmn.usage.storage_buffer || buf->cmn.usage.uniform_buffer)
         ? _SG_VK_MEMTYPE_STORAGE_BUFFER
         : _SG_VK_MEMTYPE_GENERIC_BUFFER;
     buf->vk.mem = _sg_vk_mem_alloc_device_memory(mem_type, &mem_reqs);
@@ -19425,7 +25950,10 @@ _SOKOL_PRIVATE bool _sg_vk_mem_alloc_image_device_memory(_sg_image_t* img) {
     SOKOL_ASSERT(0 == img->vk.mem);
     _SG_STRUCT(VkMemoryRequirements, mem_reqs);
     vkGetImageMemoryRequirements(_sg.vk.dev, img->vk.img, &mem_reqs);
-    img->vk.mem = _sg_vk_mem_alloc_device_memory(_SG_VK_MEMTYPE_IMAGE, &mem_reqs);
+    _sg_vk_memtype_t mem_type = img->cmn.usage.transient_attachment
+        ? _SG_VK_MEMTYPE_TRANSIENT_IMAGE
+        : _SG_VK_MEMTYPE_IMAGE;
+    img->vk.mem = _sg_vk_mem_alloc_device_memory(mem_type, &mem_reqs);
     if (0 == img->vk.mem) {
         _SG_ERROR(VULKAN_ALLOC_IMAGE_DEVICE_MEMORY_FAILED);
         return false;
@@ -19433,8 +25961,86 @@ _SOKOL_PRIVATE bool _sg_vk_mem_alloc_image_device_memory(_sg_image_t* img) {
     return true;
 }
 
-_SOKOL_PRIVATE void _sg_vk_create_delete_queues(void) {
-    const uint32_t num_items = (uint32_t)
+//-- timeline semaphores --------------------------------------------------------
+_SOKOL_PRIVATE void _sg_vk_timeline_init(_sg_vk_timeline_t* tl, const char* label) {
+    SOKOL_ASSERT(_sg.vk.dev);
+    SOKOL_ASSERT(tl && (0 == tl->sem));
+    _SG_STRUCT(VkSemaphoreTypeCreateInfo, type_create_info);
+    type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    type_create_info.initialValue = 0;
+    _SG_STRUCT(VkSemaphoreCreateInfo, create_info);
+    create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    create_info.pNext = &type_create_info;
+    VkResult res = vkCreateSemaphore(_sg.vk.dev, &create_info, 0, &tl->sem);
+    if (res != VK_SUCCESS) {
+        _SG_PANIC(VULKAN_CREATE_TIMELINE_SEMAPHORE_FAILED);
+    }
+    SOKOL_ASSERT(tl->sem);
+    _sg_vk_set_object_label(VK_OBJECT_TYPE_SEMAPHORE, (uint64_t)tl->sem, label);
+    tl->value = 0;
+}
+
+// NOTE: must be called after vkDeviceWaitIdle()
+_SOKOL_PRIVATE void _sg_vk_timeline_discard(_sg_vk_timeline_t* tl) {
+    SOKOL_ASSERT(_sg.vk.dev);
+    SOKOL_ASSERT(tl && tl->sem);
+    vkDestroySemaphore(_sg.vk.dev, tl->sem, 0);
+    _sg_clear(tl, sizeof(_sg_vk_timeline_t));
+}
+
+// NOTE: this doesn't cache the completed value, vkGetSemaphoreCounterValue() and
+// vkWaitSemaphores() may be called from loader threads without a lock
+_SOKOL_PRIVATE uint64_t _sg_vk_timeline_completed_value(const _sg_vk_timeline_t* tl) {
+    SOKOL_ASSERT(tl && tl->sem);
+    uint64_t value = 0;
+    VkResult res = vkGetSemaphoreCounterValue(_sg.vk.dev, tl->sem, &value);
+    SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
+    return value;
+}
+
+_SOKOL_PRIVATE bool _sg_vk_timeline_reached(const _sg_vk_timeline_t* tl, uint64_t value) {
+    return (0 == value) || (_sg_vk_timeline_completed_value(tl) >= value);
+}
+
+// block until the GPU has signalled a timeline value, returns false on error
+_SOKOL_PRIVATE bool _sg_vk_timeline_wait(const _sg_vk_timeline_t* tl, uint64_t value) {
+    SOKOL_ASSERT(tl && tl->sem);
+    SOKOL_ASSERT(value <= tl->value);
+    if (0 == value) {
+        return true;
+    }
+    _SG_STRUCT(VkSemaphoreWaitInfo, wait_info);
+    wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    wait_info.semaphoreCount = 1;
+    wait_info.pSemaphores = &tl->sem;
+    wait_info.pValues = &value;
+    VkResult res;
+    do {
+        res = vkWaitSemaphores(_sg.vk.dev, &wait_info, UINT64_MAX);
+    } while (res == VK_TIMEOUT);
+    if (res != VK_SUCCESS) {
+        _SG_WARN(VULKAN_WAIT_SEMAPHORES_FAILED);
+        return false;
+    }
+    return true;
+}
+
+// check if the GPU has finished a submitted frame, frames which are older than
+// the inflight frame slots have been waited for in _sg_vk_acquire_frame_command_buffers()
+_SOKOL_PRIVATE bool _sg_vk_frame_completed(uint32_t frame_index) {
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        if (_sg.vk.frame.slot[i].frame_index == frame_index) {
+            return _sg_vk_timeline_reached(&_sg.vk.timeline, _sg.vk.frame.slot[i].timeline_value);
+        }
+    }
+    return frame_index != _sg.frame_index;
+}
+
+//-- delete queue ----------------------------------------------------------------
+_SOKOL_PRIVATE void _sg_vk_create_delete_queue(void) {
+    // room for destroying all resources once in each frame in flight
+    const uint32_t num_items = SG_NUM_INFLIGHT_FRAMES * (uint32_t)
         (2 * _sg.desc.buffer_pool_size +
         2 * _sg.desc.image_pool_size +
         1 * _sg.desc.sampler_pool_size +
@@ -19442,60 +26048,89 @@ _SOKOL_PRIVATE void _sg_vk_create_delete_queues(void) {
         2 * _sg.desc.pipeline_pool_size +
         1 * _sg.desc.view_pool_size +
         256);
-    for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
-        _sg_vk_delete_queue_t* queue = &_sg.vk.frame.slot[i].delete_queue;
-        SOKOL_ASSERT(0 == queue->items);
-        SOKOL_ASSERT(0 == queue->index);
-        queue->num = num_items;
-        const size_t pool_size = num_items * sizeof(_sg_vk_delete_queue_item_t);
-        queue->items = (_sg_vk_delete_queue_item_t*)_sg_malloc(pool_size);
+    _sg_vk_delete_queue_t* queue = &_sg.vk.delete_queue;
+    SOKOL_ASSERT(0 == queue->items);
+    SOKOL_ASSERT(0 == queue->count);
+    queue->num = num_items;
+    const size_t pool_size = num_items * sizeof(_sg_vk_delete_queue_item_t);
+    queue->items = (_sg_vk_delete_queue_item_t*)_sg_malloc(pool_size);
+}
+
+_SOKOL_PRIVATE void _sg_vk_delete_queue_pop(_sg_vk_delete_queue_t* queue) {
+    SOKOL_ASSERT(queue && queue->items && (queue->count > 0));
+    _sg_vk_delete_queue_item_t* item = &queue->items[queue->head];
+    SOKOL_ASSERT(item->destructor && item->obj);
+    item->destructor(item->obj);
+    _sg_clear(item, sizeof(_sg_vk_delete_queue_item_t));
+    queue->head = (queue->head + 1) % queue->num;
+    queue->count -= 1;
+}
+
+// NOTE: must be called after vkDeviceWaitIdle()
+_SOKOL_PRIVATE void _sg_vk_destroy_delete_queue(void) {
+    _sg_vk_delete_queue_t* queue = &_sg.vk.delete_queue;
+    SOKOL_ASSERT(queue->items);
+    _sg_stats_add(vk.num_delete_queue_collected, queue->count);
+    queue->num_pending = 0;
+    while (queue->count > 0) {
+        _sg_vk_delete_queue_pop(queue);
     }
+    _sg_free(queue->items);
+    _sg_clear(queue, sizeof(_sg_vk_delete_queue_t));
 }
 
-_SOKOL_PRIVATE void _sg_vk_delete_queue_collect_items(_sg_vk_delete_queue_t* queue) {
-    SOKOL_ASSERT(queue && queue->items);
-    for (uint32_t i = 0; i < queue->index; i++) {
-        _sg_vk_delete_queue_item_t* item = &queue->items[i];
-        SOKOL_ASSERT(item->destructor && item->obj);
-        item->destructor(item->obj);
-        item->destructor = 0;
-        item->obj = 0;
+// destroy all objects which are no longer in use by the GPU, the queue
+// is ordered by timeline values so this stops at the first object in use
+_SOKOL_PRIVATE void _sg_vk_delete_queue_collect(void) {
+    _sg_vk_delete_queue_t* queue = &_sg.vk.delete_queue;
+    SOKOL_ASSERT(queue->items);
+    if (queue->count == queue->num_pending) {
+        return;
     }
-    _sg_stats_add(vk.num_delete_queue_collected, queue->index);
-    queue->index = 0;
-}
-
-_SOKOL_PRIVATE void _sg_vk_destroy_delete_queues(void) {
-    for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
-        _sg_vk_delete_queue_t* queue = &_sg.vk.frame.slot[i].delete_queue;
-        SOKOL_ASSERT(queue->items);
-        _sg_vk_delete_queue_collect_items(queue);
-        _sg_free(queue->items);
-        SOKOL_ASSERT(queue->index == 0);
-        queue->items = 0;
-        queue->num = 0;
+    const uint64_t frame_value = _sg_vk_timeline_completed_value(&_sg.vk.timeline);
+    const uint64_t compute_value = _sg.vk.compute.valid ? _sg_vk_timeline_completed_value(&_sg.vk.compute.timeline) : 0;
+    uint32_t num_collected = 0;
+    while (queue->count > queue->num_pending) {
+        const _sg_vk_delete_queue_item_t* item = &queue->items[queue->head];
+        if ((item->frame_value > frame_value) || (item->compute_value > compute_value)) {
+            break;
+        }
+        _sg_vk_delete_queue_pop(queue);
+        num_collected++;
     }
+    _sg_stats_add(vk.num_delete_queue_collected, num_collected);
 }
 
-_SOKOL_PRIVATE _sg_vk_delete_queue_t* _sg_vk_cur_delete_queue(void) {
-    return &_sg.vk.frame.slot[_sg.vk.frame_slot].delete_queue;
-}
-
-_SOKOL_PRIVATE void _sg_vk_delete_queue_collect(void) {
-    _sg_vk_delete_queue_t* queue = _sg_vk_cur_delete_queue();
-    _sg_vk_delete_queue_collect_items(queue);
+// called after a frame has been submitted: objects which were destroyed since the
+// previous frame submission may have been used by any work submitted up to now
+_SOKOL_PRIVATE void _sg_vk_delete_queue_after_submit(uint64_t frame_value, uint64_t compute_value) {
+    _sg_vk_delete_queue_t* queue = &_sg.vk.delete_queue;
+    SOKOL_ASSERT(queue->num_pending <= queue->count);
+    for (uint32_t i = queue->count - queue->num_pending; i < queue->count; i++) {
+        _sg_vk_delete_queue_item_t* item = &queue->items[(queue->head + i) % queue->num];
+        item->frame_value = frame_value;
+        item->compute_value = compute_value;
+    }
+    queue->num_pending = 0;
 }
 
+// NOTE: it's valid to add objects between _sg_vk_submit_frame_command_buffers()
+// and the next _sg_vk_acquire_frame_command_buffers(), those objects are
+// stamped with the timeline values of the next frame
 _SOKOL_PRIVATE void _sg_vk_delete_queue_add(_sg_vk_delete_queue_destructor_t destructor, void* obj) {
     SOKOL_ASSERT(destructor && obj);
-    _sg_vk_delete_queue_t* queue = _sg_vk_cur_delete_queue();
+    _sg_vk_delete_queue_t* queue = &_sg.vk.delete_queue;
     SOKOL_ASSERT(queue->items);
-    if (queue->index >= queue->num) {
+    if (queue->count >= queue->num) {
         _SG_PANIC(VULKAN_DELETE_QUEUE_EXHAUSTED);
     }
-    queue->items[queue->index].destructor = destructor;
-    queue->items[queue->index].obj = obj;
-    queue->index += 1;
+    _sg_vk_delete_queue_item_t* item = &queue->items[(queue->head + queue->count) % queue->num];
+    item->destructor = destructor;
+    item->obj = obj;
+    item->frame_value = 0;
+    item->compute_value = 0;
+    queue->count += 1;
+    queue->num_pending += 1;
     _sg_stats_inc(vk.num_delete_queue_added);
 }
 
@@ -19540,7 +26175,7 @@ _SOKOL_PRIVATE void _sg_vk_shared_buffer_init(_sg_vk_shared_buffer_t* shbuf, uin
         buf_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         buf_create_info.size = shbuf->size;
         buf_create_info.usage = vk_usage;
-        buf_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        _sg_vk_init_buffer_sharing_mode(&buf_create_info);
         res = vkCreateBuffer(_sg.vk.dev, &buf_create_info, 0, &shbuf->slots[i].buf);
         if (res != VK_SUCCESS) {
             _SG_PANIC(VULKAN_CREATE_SHARED_BUFFER_FAILED);
@@ -19650,16 +26285,24 @@ _SOKOL_PRIVATE VkDeviceSize _sg_vk_shared_buffer_memcpy(_sg_vk_shared_buffer_t*
     return offset;
 }
 
-// staging system for blocking immutable and dynamic updates, can deal arbitrarily sized data
+// staging ring for immutable and dynamic updates, can deal with arbitrarily sized data
+//
+// The staging buffer is persistently mapped and split into _SG_VK_NUM_STAGING_SEGMENTS
+// segments. Copy commands are recorded into the current segment's command buffer,
+// the segment is submitted when it is full or in _sg_vk_submit_frame_command_buffers(),
+// and the CPU only needs to wait when it wraps around to a segment which is still in flight.
+// Each segment submission signals the next value on the graphics timeline semaphore.
+// Ordering against frame command buffers on the same queue is done with global memory barriers
+// at the start and end of each segment's command buffer.
 _SOKOL_PRIVATE void _sg_vk_staging_copy_init(void) {
     SOKOL_ASSERT(_sg.vk.dev);
     VkResult res;
 
     SOKOL_ASSERT(0 == _sg.vk.stage.copy.cmd_pool);
-    SOKOL_ASSERT(0 == _sg.vk.stage.copy.cmd_buf);
     SOKOL_ASSERT(0 == _sg.vk.stage.copy.size);
     SOKOL_ASSERT(0 == _sg.vk.stage.copy.buf);
     SOKOL_ASSERT(0 == _sg.vk.stage.copy.mem);
+    SOKOL_ASSERT(0 == _sg.vk.stage.copy.mem_ptr);
     SOKOL_ASSERT(_sg.desc.vulkan.copy_staging_buffer_size > 0);
 
     _SG_STRUCT(VkCommandPoolCreateInfo, pool_create_info);
@@ -19670,16 +26313,22 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_init(void) {
     SOKOL_ASSERT((res == VK_SUCCESS && _sg.vk.stage.copy.cmd_pool));
     _sg_vk_set_object_label(VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)_sg.vk.stage.copy.cmd_pool, "copy-staging cmd pool");
 
+    _sg.vk.stage.copy.segment_size = _sg_roundup_u32((uint32_t)_sg.desc.vulkan.copy_staging_buffer_size / _SG_VK_NUM_STAGING_SEGMENTS, 16);
+    _sg.vk.stage.copy.size = _sg.vk.stage.copy.segment_size * _SG_VK_NUM_STAGING_SEGMENTS;
     _SG_STRUCT(VkCommandBufferAllocateInfo, cmdbuf_alloc_info);
     cmdbuf_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
     cmdbuf_alloc_info.commandPool = _sg.vk.stage.copy.cmd_pool;
     cmdbuf_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     cmdbuf_alloc_info.commandBufferCount = 1;
-    res = vkAllocateCommandBuffers(_sg.vk.dev, &cmdbuf_alloc_info, &_sg.vk.stage.copy.cmd_buf);
-    SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.stage.copy.cmd_buf);
-    _sg_vk_set_object_label(VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)_sg.vk.stage.copy.cmd_buf, "copy-staging cmd buffer");
+    for (uint32_t i = 0; i < _SG_VK_NUM_STAGING_SEGMENTS; i++) {
+        _sg_vk_staging_segment_t* seg = &_sg.vk.stage.copy.segments[i];
+        SOKOL_ASSERT(0 == seg->cmd_buf);
+        res = vkAllocateCommandBuffers(_sg.vk.dev, &cmdbuf_alloc_info, &seg->cmd_buf);
+        SOKOL_ASSERT((res == VK_SUCCESS) && seg->cmd_buf);
+        _sg_vk_set_object_label(VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)seg->cmd_buf, "copy-staging cmd buffer");
+        seg->offset = i * _sg.vk.stage.copy.segment_size;
+    }
 
-    _sg.vk.stage.copy.size = (uint32_t) _sg.desc.vulkan.copy_staging_buffer_size;
     _SG_STRUCT(VkBufferCreateInfo, buf_create_info);
     buf_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     buf_create_info.size = _sg.vk.stage.copy.size;
@@ -19702,107 +26351,221 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_init(void) {
     if (res != VK_SUCCESS) {
         _SG_PANIC(VULKAN_STAGING_BIND_BUFFER_MEMORY_FAILED);
     }
+    void* mem_ptr = 0;
+    res = vkMapMemory(_sg.vk.dev, _sg.vk.stage.copy.mem, 0, VK_WHOLE_SIZE, 0, &mem_ptr);
+    if (res != VK_SUCCESS) {
+        _SG_PANIC(VULKAN_STAGING_MAP_MEMORY_FAILED);
+    }
+    SOKOL_ASSERT(mem_ptr);
+    _sg.vk.stage.copy.mem_ptr = (uint8_t*) mem_ptr;
 }
 
+// NOTE: must be called after vkDeviceWaitIdle()
 _SOKOL_PRIVATE void _sg_vk_staging_copy_discard(void) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(_sg.vk.stage.copy.cmd_pool);
-    SOKOL_ASSERT(_sg.vk.stage.copy.cmd_buf);
     SOKOL_ASSERT(_sg.vk.stage.copy.size);
     SOKOL_ASSERT(_sg.vk.stage.copy.buf);
     SOKOL_ASSERT(_sg.vk.stage.copy.mem);
+    SOKOL_ASSERT(_sg.vk.stage.copy.mem_ptr);
 
+    vkUnmapMemory(_sg.vk.dev, _sg.vk.stage.copy.mem);
+    _sg.vk.stage.copy.mem_ptr = 0;
     _sg_vk_mem_free_device_memory(_sg.vk.stage.copy.mem);
     _sg.vk.stage.copy.mem = 0;
     vkDestroyBuffer(_sg.vk.dev, _sg.vk.stage.copy.buf, 0);
     _sg.vk.stage.copy.buf = 0;
+    _sg_clear(_sg.vk.stage.copy.segments, sizeof(_sg.vk.stage.copy.segments));
+    // NOTE: command buffers owned by the pool will be automatically destroyed
     vkDestroyCommandPool(_sg.vk.dev, _sg.vk.stage.copy.cmd_pool, 0);
     _sg.vk.stage.copy.cmd_pool = 0;
-    _sg.vk.stage.copy.cmd_buf = 0;
     _sg.vk.stage.copy.size = 0;
+    _sg.vk.stage.copy.segment_size = 0;
+    _sg.vk.stage.copy.cur_segment = 0;
+}
+
+_SOKOL_PRIVATE void _sg_vk_staging_copy_memory_barrier(VkCommandBuffer cmd_buf, bool before_copy) {
+    _SG_STRUCT(VkMemoryBarrier2, barrier);
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+    if (before_copy) {
+        // protect against write-after-read and write-after-write hazards with previously submitted work
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        barrier.srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+        barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    } else {
+        // make the copied data visible to all work submitted later on the same queue
+        barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+        barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+    }
+    _SG_STRUCT(VkDependencyInfo, dep_info);
+    dep_info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dep_info.memoryBarrierCount = 1;
+    dep_info.pMemoryBarriers = &barrier;
+    vkCmdPipelineBarrier2(cmd_buf, &dep_info);
+    _sg_stats_inc(vk.num_cmd_pipeline_barrier);
 }
 
-_SOKOL_PRIVATE VkCommandBuffer _sg_vk_staging_copy_begin(void) {
-    VkCommandBuffer cmd_buf = _sg.vk.stage.copy.cmd_buf;
-    _SG_STRUCT(VkCommandBufferBeginInfo, cmdbuf_begin_info);
-    cmdbuf_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    cmdbuf_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-    VkResult res = vkBeginCommandBuffer(cmd_buf, &cmdbuf_begin_info);
+// the staging ring and queue are shared with loader threads
+_SOKOL_PRIVATE void _sg_vk_queue_lock(void) {
+    #if defined(SOKOL_LOADER_THREADS)
+        #if defined(_SG_VK_PTHREADS)
+        pthread_mutex_lock(&_sg.vk.queue_mutex);
+        #elif defined(_SG_VK_WIN32_THREADS)
+        AcquireSRWLockExclusive(&_sg.vk.queue_mutex);
+        #endif
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_vk_queue_unlock(void) {
+    #if defined(SOKOL_LOADER_THREADS)
+        #if defined(_SG_VK_PTHREADS)
+        pthread_mutex_unlock(&_sg.vk.queue_mutex);
+        #elif defined(_SG_VK_WIN32_THREADS)
+        ReleaseSRWLockExclusive(&_sg.vk.queue_mutex);
+        #endif
+    #endif
+}
+
+// block until a previously submitted segment has finished, the queue lock is
+// released during the wait so the caller must re-check the staging ring state
+_SOKOL_PRIVATE void _sg_vk_staging_copy_wait_segment(const _sg_vk_staging_segment_t* seg) {
+    SOKOL_ASSERT(seg && !seg->recording);
+    const uint64_t timeline_value = seg->timeline_value;
+    _sg_stats_inc(vk.num_staging_copy_waits);
+    _sg_vk_queue_unlock();
+    _sg_vk_timeline_wait(&_sg.vk.timeline, timeline_value);
+    _sg_vk_queue_lock();
+}
+
+// submit the current segment if it has recorded copies and advance to the next segment
+_SOKOL_PRIVATE void _sg_vk_staging_copy_flush(void) {
+    SOKOL_ASSERT(_sg.vk.queue);
+    _sg_vk_staging_segment_t* seg = &_sg.vk.stage.copy.segments[_sg.vk.stage.copy.cur_segment];
+    if (!seg->recording) {
+        return;
+    }
+    _sg_vk_staging_copy_memory_barrier(seg->cmd_buf, false);
+    VkResult res = vkEndCommandBuffer(seg->cmd_buf);
+    SOKOL_ASSERT(res == VK_SUCCESS);
+    _SG_STRUCT(VkCommandBufferSubmitInfo, cmdbuf_info);
+    cmdbuf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+    cmdbuf_info.commandBuffer = seg->cmd_buf;
+    _SG_STRUCT(VkSemaphoreSubmitInfo, signal_info);
+    signal_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    signal_info.semaphore = _sg.vk.timeline.sem;
+    signal_info.value = _sg.vk.timeline.value + 1;
+    signal_info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    _SG_STRUCT(VkSubmitInfo2, submit_info);
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+    submit_info.commandBufferInfoCount = 1;
+    submit_info.pCommandBufferInfos = &cmdbuf_info;
+    submit_info.signalSemaphoreInfoCount = 1;
+    submit_info.pSignalSemaphoreInfos = &signal_info;
+    res = vkQueueSubmit2(_sg.vk.queue, 1, &submit_info, VK_NULL_HANDLE);
     SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
-    return cmd_buf;
+    _sg_stats_inc(vk.num_staging_copy_submits);
+    seg->recording = false;
+    seg->timeline_value = ++_sg.vk.timeline.value;
+    _sg.vk.stage.copy.cur_segment = (_sg.vk.stage.copy.cur_segment + 1) % _SG_VK_NUM_STAGING_SEGMENTS;
+}
+
+// reserve num_bytes in the current segment, returns the segment's command buffer
+_SOKOL_PRIVATE VkCommandBuffer _sg_vk_staging_copy_alloc(uint32_t num_bytes, VkDeviceSize* out_offset) {
+    SOKOL_ASSERT((num_bytes > 0) && (num_bytes <= _sg.vk.stage.copy.segment_size));
+    SOKOL_ASSERT(out_offset);
+    _sg_vk_staging_segment_t* seg;
+    while (true) {
+        seg = &_sg.vk.stage.copy.segments[_sg.vk.stage.copy.cur_segment];
+        if (seg->recording) {
+            if ((seg->pos + num_bytes) <= _sg.vk.stage.copy.segment_size) {
+                break;
+            }
+            _sg_vk_staging_copy_flush();
+        } else if (!_sg_vk_timeline_reached(&_sg.vk.timeline, seg->timeline_value)) {
+            // a loader thread may start recording into the segment during the wait
+            _sg_vk_staging_copy_wait_segment(seg);
+        } else {
+            seg->timeline_value = 0;
+            VkResult res = vkResetCommandBuffer(seg->cmd_buf, 0);
+            SOKOL_ASSERT(res == VK_SUCCESS);
+            _SG_STRUCT(VkCommandBufferBeginInfo, cmdbuf_begin_info);
+            cmdbuf_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            cmdbuf_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            res = vkBeginCommandBuffer(seg->cmd_buf, &cmdbuf_begin_info);
+            SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
+            _sg_vk_staging_copy_memory_barrier(seg->cmd_buf, true);
+            seg->pos = 0;
+            seg->recording = true;
+            break;
+        }
+    }
+    *out_offset = seg->offset + seg->pos;
+    // NOTE: 16 bytes covers the texel block size of all pixel formats
+    seg->pos = _sg_roundup_u32(seg->pos + num_bytes, 16);
+    _sg_stats_add(vk.size_staging_copy, num_bytes);
+    return seg->cmd_buf;
 }
 
-_SOKOL_PRIVATE void _sg_vk_staging_copy_end(VkCommandBuffer cmd_buf, VkQueue queue) {
-    SOKOL_ASSERT(cmd_buf && queue);
-    VkResult res;
-    _SOKOL_UNUSED(res);
-    vkEndCommandBuffer(cmd_buf);
-    _SG_STRUCT(VkSubmitInfo, submit_info);
-    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_info.commandBufferCount = 1;
-    submit_info.pCommandBuffers = &cmd_buf;
-    res = vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
-    SOKOL_ASSERT(res == VK_SUCCESS);
-    res = vkQueueWaitIdle(queue);
-    SOKOL_ASSERT(res == VK_SUCCESS);
-    res = vkResetCommandBuffer(cmd_buf, 0);
-    SOKOL_ASSERT(res == VK_SUCCESS);
+// accumulated in nanoseconds since most copies take less than a microsecond
+_SOKOL_PRIVATE void _sg_vk_staging_copy_track_time(uint64_t start_ns) {
+    if (start_ns == 0) {
+        return;
+    }
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        return;
+    }
+    #endif
+    _sg.vk.stage.copy.frame_time_ns += _sg_time_now_ns() - start_ns;
 }
 
-_SOKOL_PRIVATE void _sg_vk_staging_map_memcpy_unmap(VkDeviceMemory mem, const void* ptr, uint32_t num_bytes) {
-    SOKOL_ASSERT(_sg.vk.dev);
-    SOKOL_ASSERT(mem);
-    SOKOL_ASSERT(ptr);
-    SOKOL_ASSERT(num_bytes > 0);
-    void* dst_ptr = 0;
-    VkResult res = vkMapMemory(_sg.vk.dev, mem, 0, VK_WHOLE_SIZE, 0, &dst_ptr);
-    SOKOL_ASSERT((res == VK_SUCCESS) && dst_ptr); _SOKOL_UNUSED(res);
-    memcpy(dst_ptr, ptr, num_bytes);
-    vkUnmapMemory(_sg.vk.dev, mem);
+_SOKOL_PRIVATE void _sg_vk_staging_copy_update_stats(void) {
+    if (_sg.stats_enabled) {
+        const uint32_t time_us = (uint32_t)(_sg.vk.stage.copy.frame_time_ns / 1000);
+        _sg.stats.cur_frame.vk.staging_copy_time_us = time_us;
+        if (time_us > 0) {
+            // bytes per microsecond == megabytes per second
+            _sg.stats.cur_frame.vk.staging_copy_mbytes_per_sec = _sg.stats.cur_frame.vk.size_staging_copy / time_us;
+        }
+    }
+    _sg.vk.stage.copy.frame_time_ns = 0;
 }
 
-_SOKOL_PRIVATE void _sg_vk_staging_copy_buffer_data(_sg_buffer_t* buf, const sg_range* src_data, size_t dst_offset, bool initial_wait) {
+_SOKOL_PRIVATE void _sg_vk_staging_copy_buffer_data(_sg_buffer_t* buf, const sg_range* src_data, size_t dst_offset) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(_sg.vk.queue);
-    SOKOL_ASSERT(_sg.vk.stage.copy.mem);
+    SOKOL_ASSERT(_sg.vk.stage.copy.mem_ptr);
     SOKOL_ASSERT(_sg.vk.stage.copy.buf);
     SOKOL_ASSERT(buf && buf->vk.buf);
     SOKOL_ASSERT(src_data && src_data->ptr && (src_data->size > 0));
     SOKOL_ASSERT((dst_offset + src_data->size) <= (size_t)buf->cmn.size);
+    const uint64_t start_ns = _sg.stats_enabled ? _sg_time_now_ns() : 0;
+    _sg_vk_queue_lock();
 
-    // an inital wait is only needed for updating existing resources but not when populating a new resource
-    if (initial_wait) {
-        VkResult res = vkQueueWaitIdle(_sg.vk.queue);
-        SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
-    }
-
-    VkDeviceMemory dst_mem = _sg.vk.stage.copy.mem;
     VkBuffer src_buf = _sg.vk.stage.copy.buf;
     VkBuffer dst_buf = buf->vk.buf;
     const uint8_t* src_ptr = (const uint8_t*)src_data->ptr;
-    uint32_t dst_size = _sg.vk.stage.copy.size;
+    const uint32_t max_size = _sg.vk.stage.copy.segment_size;
     uint32_t bytes_remaining = (uint32_t)src_data->size;
     _SG_STRUCT(VkBufferCopy, region);
     region.dstOffset = dst_offset;
     while (bytes_remaining > 0) {
-        uint64_t bytes_to_copy = bytes_remaining;
-        if (bytes_remaining > dst_size) {
-            bytes_to_copy = dst_size;
-            bytes_remaining -= dst_size;
-        } else {
-            bytes_to_copy = bytes_remaining;
-            bytes_remaining = 0;
-        }
+        const uint32_t bytes_to_copy = _sg_min(bytes_remaining, max_size);
+        bytes_remaining -= bytes_to_copy;
+        VkCommandBuffer cmd_buf = _sg_vk_staging_copy_alloc(bytes_to_copy, &region.srcOffset);
+        memcpy(_sg.vk.stage.copy.mem_ptr + region.srcOffset, src_ptr, bytes_to_copy);
         region.size = bytes_to_copy;
-        _sg_vk_staging_map_memcpy_unmap(dst_mem, src_ptr, (uint32_t)bytes_to_copy);
-        VkCommandBuffer cmd_buf = _sg_vk_staging_copy_begin();
         vkCmdCopyBuffer(cmd_buf, src_buf, dst_buf, 1, &region);
         _sg_stats_inc(vk.num_cmd_copy_buffer);
-        _sg_vk_staging_copy_end(cmd_buf, _sg.vk.queue);
         src_ptr += bytes_to_copy;
         region.dstOffset += bytes_to_copy;
     }
-    buf->vk.cur_access = _SG_VK_ACCESS_VERTEXBUFFER | _SG_VK_ACCESS_INDEXBUFFER | _SG_VK_ACCESS_STORAGEBUFFER_RO;
+    buf->vk.cur_access = _SG_VK_ACCESS_VERTEXBUFFER | _SG_VK_ACCESS_INDEXBUFFER | _SG_VK_ACCESS_STORAGEBUFFER_RO | _SG_VK_ACCESS_INDIRECT | _SG_VK_ACCESS_UNIFORMBUFFER;
+    _sg_vk_staging_copy_track_time(start_ns);
+    _sg_vk_queue_unlock();
 }
 
 _SOKOL_PRIVATE void _sg_vk_init_vk_image_staging_structs(const _sg_image_t* img, VkBuffer vk_buf, VkBufferImageCopy2* region, VkCopyBufferToImageInfo2* copy_info) {
@@ -19828,21 +26591,16 @@ _SOKOL_PRIVATE void _sg_vk_init_vk_image_staging_structs(const _sg_image_t* img,
     copy_info->pRegions = region;
 }
 
-_SOKOL_PRIVATE void _sg_vk_staging_copy_image_data(_sg_image_t* img, const sg_image_data* src_data, bool initial_wait) {
+_SOKOL_PRIVATE void _sg_vk_staging_copy_image_data(_sg_image_t* img, const sg_image_data* src_data) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(_sg.vk.queue);
-    SOKOL_ASSERT(_sg.vk.stage.copy.mem);
+    SOKOL_ASSERT(_sg.vk.stage.copy.mem_ptr);
     SOKOL_ASSERT(_sg.vk.stage.copy.buf);
     SOKOL_ASSERT(img && img->vk.img);
     const uint32_t block_dim = (uint32_t)_sg_block_dim(img->cmn.pixel_format);
+    const uint64_t start_ns = _sg.stats_enabled ? _sg_time_now_ns() : 0;
+    _sg_vk_queue_lock();
 
-    // an inital wait is only needed for updating existing resources but not when populating a new resource
-    if (initial_wait) {
-        VkResult res = vkQueueWaitIdle(_sg.vk.queue);
-        SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
-    }
-
-    VkDeviceMemory mem = _sg.vk.stage.copy.mem;
     _SG_STRUCT(VkBufferImageCopy2, region);
     _SG_STRUCT(VkCopyBufferToImageInfo2, copy_info);
     _sg_vk_init_vk_image_staging_structs(img, _sg.vk.stage.copy.buf, &region, &copy_info);
@@ -19856,7 +26614,8 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_image_data(_sg_image_t* img, const sg_im
         region.imageSubresource.mipLevel = (uint32_t)mip_index;
         region.imageExtent.width = (uint32_t)mip_width;
 
-        const uint32_t max_rows = _sg.vk.stage.copy.size / row_pitch;
+        const uint32_t max_rows = _sg.vk.stage.copy.segment_size / row_pitch;
+        SOKOL_ASSERT(max_rows > 0);
         for (int slice_index = 0; slice_index < mip_slices; slice_index++) {
             if (img->cmn.type == SG_IMAGETYPE_3D) {
                 region.imageOffset.z = slice_index;
@@ -19866,31 +26625,24 @@ _SOKOL_PRIVATE void _sg_vk_staging_copy_image_data(_sg_image_t* img, const sg_im
             uint32_t rows_remaining = num_rows;
             uint32_t cur_row = 0;
             while (rows_remaining > 0) {
-                uint32_t rows_to_copy = rows_remaining;
-                if (rows_remaining > max_rows) {
-                    rows_to_copy = max_rows;
-                    rows_remaining -= max_rows;
-                } else {
-                    rows_to_copy = rows_remaining;
-                    rows_remaining = 0;
-                }
+                const uint32_t rows_to_copy = _sg_min(rows_remaining, max_rows);
+                rows_remaining -= rows_to_copy;
                 const uint32_t bytes_to_copy = rows_to_copy * row_pitch;
-                SOKOL_ASSERT(bytes_to_copy <= _sg.vk.stage.copy.size);
-                _sg_vk_staging_map_memcpy_unmap(mem, src_ptr, bytes_to_copy);
+                VkCommandBuffer cmd_buf = _sg_vk_staging_copy_alloc(bytes_to_copy, &region.bufferOffset);
+                memcpy(_sg.vk.stage.copy.mem_ptr + region.bufferOffset, src_ptr, bytes_to_copy);
                 src_ptr += bytes_to_copy;
-                VkCommandBuffer cmd_buf = _sg_vk_staging_copy_begin();
                 _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_STAGING);
                 region.imageOffset.y = (int32_t)(cur_row * block_dim);
                 region.imageExtent.height = _sg_min((uint32_t)mip_height, rows_to_copy * block_dim);
                 vkCmdCopyBufferToImage2(cmd_buf, &copy_info);
                 _sg_stats_inc(vk.num_cmd_copy_buffer_to_image);
                 _sg_vk_image_barrier(cmd_buf, img, _SG_VK_ACCESS_TEXTURE);
-
-                _sg_vk_staging_copy_end(cmd_buf, _sg.vk.queue);
                 cur_row += rows_to_copy;
             }
         }
     }
+    _sg_vk_staging_copy_track_time(start_ns);
+    _sg_vk_queue_unlock();
 }
 
 // staging system for non-blocking streaming updates with a max per-frame data limit
@@ -19941,7 +26693,7 @@ _SOKOL_PRIVATE void _sg_vk_staging_stream_buffer_data(_sg_buffer_t* buf, const s
     // FIXME: not great to issue a barrier right here,
     // rethink buffer barrier strategy? => a single memory barrier
     // at the end of the stream command buffer should be sufficient?
-    _sg_vk_buffer_barrier(cmd_buf, buf, _SG_VK_ACCESS_VERTEXBUFFER|_SG_VK_ACCESS_INDEXBUFFER|_SG_VK_ACCESS_STORAGEBUFFER_RO);
+    _sg_vk_buffer_barrier(cmd_buf, buf, _SG_VK_ACCESS_VERTEXBUFFER|_SG_VK_ACCESS_INDEXBUFFER|_SG_VK_ACCESS_STORAGEBUFFER_RO|_SG_VK_ACCESS_INDIRECT|_SG_VK_ACCESS_UNIFORMBUFFER);
 }
 
 _SOKOL_PRIVATE void _sg_vk_staging_stream_image_data(_sg_image_t* img, const sg_image_data* src_data) {
@@ -20051,19 +26803,33 @@ _SOKOL_PRIVATE void _sg_vk_bind_discard(void) {
 }
 
 // called from _sg_vk_acquire_frame_command_buffer()
+// bind the current frame's descriptor buffer and the optional bindless
+// descriptor heap (at buffer index 1) to a new command buffer
+_SOKOL_PRIVATE void _sg_vk_bind_descriptor_buffers(VkCommandBuffer cmd_buf) {
+    SOKOL_ASSERT(cmd_buf);
+    SOKOL_ASSERT(_sg.vk.bind.cur_dev_addr);
+    _SG_STRUCT(VkDescriptorBufferBindingInfoEXT, bind_infos[2]);
+    uint32_t num_bind_infos = 1;
+    bind_infos[0].sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+    bind_infos[0].address = _sg.vk.bind.cur_dev_addr;
+    bind_infos[0].usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                          VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+    if (_sg.vk.bindless.valid) {
+        bind_infos[1].sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        bind_infos[1].address = _sg.vk.bindless.dev_addr;
+        bind_infos[1].usage = bind_infos[0].usage;
+        num_bind_infos = 2;
+    }
+    _sg.vk.ext.cmd_bind_descriptor_buffers(cmd_buf, num_bind_infos, bind_infos);
+}
+
 _SOKOL_PRIVATE void _sg_vk_bind_after_acquire(void) {
     _sg_vk_shared_buffer_after_acquire(&_sg.vk.bind);
 
     // bind the current frame's descriptor buffer
     SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
     SOKOL_ASSERT(_sg.vk.bind.cur_buf);
-    SOKOL_ASSERT(_sg.vk.bind.cur_dev_addr);
-    _SG_STRUCT(VkDescriptorBufferBindingInfoEXT, bind_info);
-    bind_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
-    bind_info.address = _sg.vk.bind.cur_dev_addr;
-    bind_info.usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
-                      VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
-    _sg.vk.ext.cmd_bind_descriptor_buffers(_sg.vk.frame.cmd_buf, 1, &bind_info);
+    _sg_vk_bind_descriptor_buffers(_sg.vk.frame.cmd_buf);
 }
 
 // called from _sg_vk_submit_frame_command_buffer()
@@ -20071,6 +26837,208 @@ _SOKOL_PRIVATE void _sg_vk_bind_before_submit(void) {
     _sg_vk_shared_buffer_before_submit(&_sg.vk.bind);
 }
 
+// bindless descriptor heap
+_SOKOL_PRIVATE bool _sg_vk_bindless_supported(const sg_desc* desc) {
+    // the device features must be *enabled* on the device, not just supported,
+    // only the application which created the device knows this
+    if (!desc->environment.vulkan.descriptor_indexing) {
+        return false;
+    }
+    // the heap is bound as a second descriptor buffer with resource and sampler descriptors
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT* props = &_sg.vk.descriptor_buffer_props;
+    return (props->maxDescriptorBufferBindings >= 2)
+        && (props->maxResourceDescriptorBufferBindings >= 2)
+        && (props->maxSamplerDescriptorBufferBindings >= 2);
+}
+
+_SOKOL_PRIVATE void _sg_vk_bindless_discard(void) {
+    _sg_vk_bindless_heap_t* heap = &_sg.vk.bindless;
+    if (heap->mem_ptr) {
+        vkUnmapMemory(_sg.vk.dev, heap->mem);
+        heap->mem_ptr = 0;
+    }
+    if (heap->mem) {
+        _sg_vk_mem_free_device_memory(heap->mem);
+        heap->mem = 0;
+    }
+    if (heap->buf) {
+        vkDestroyBuffer(_sg.vk.dev, heap->buf, 0);
+        heap->buf = 0;
+    }
+    if (heap->dsl) {
+        vkDestroyDescriptorSetLayout(_sg.vk.dev, heap->dsl, 0);
+        heap->dsl = 0;
+    }
+    if (heap->view_indices.free_queue) {
+        _sg_pool_discard(&heap->view_indices);
+    }
+    if (heap->smp_indices.free_queue) {
+        _sg_pool_discard(&heap->smp_indices);
+    }
+    heap->dev_addr = 0;
+    heap->valid = false;
+    _sg.features.bindless = false;
+}
+
+_SOKOL_PRIVATE void _sg_vk_bindless_init(const sg_desc* desc) {
+    SOKOL_ASSERT(_sg.vk.dev);
+    _sg_vk_bindless_heap_t* heap = &_sg.vk.bindless;
+    SOKOL_ASSERT(!heap->valid);
+    if (!desc->vulkan.bindless) {
+        return;
+    }
+    if (!_sg_vk_bindless_supported(desc)) {
+        _SG_WARN(VULKAN_BINDLESS_NOT_SUPPORTED);
+        return;
+    }
+    // heap indices are only released when the GPU is done with them, so leave
+    // room for objects which are destroyed and re-created within a few frames
+    const int num_views = 2 * _sg.desc.view_pool_size;
+    const int num_smps = 2 * _sg.desc.sampler_pool_size;
+
+    // NOTE: slot 0 of the index pools is never allocated
+    _SG_STRUCT(VkDescriptorSetLayoutBinding, dsl_entries[_SG_VK_NUM_BINDLESS_HEAP_BINDINGS]);
+    dsl_entries[0].binding = 0;
+    dsl_entries[0].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+    dsl_entries[0].descriptorCount = (uint32_t)num_views + 1;
+    dsl_entries[1].binding = 1;
+    dsl_entries[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    dsl_entries[1].descriptorCount = (uint32_t)num_views + 1;
+    dsl_entries[2].binding = 2;
+    dsl_entries[2].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+    dsl_entries[2].descriptorCount = (uint32_t)num_smps + 1;
+    VkDescriptorBindingFlags bnd_flags[_SG_VK_NUM_BINDLESS_HEAP_BINDINGS];
+    for (size_t i = 0; i < _SG_VK_NUM_BINDLESS_HEAP_BINDINGS; i++) {
+        dsl_entries[i].stageFlags = VK_SHADER_STAGE_ALL;
+        bnd_flags[i] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    }
+    _SG_STRUCT(VkDescriptorSetLayoutBindingFlagsCreateInfo, bnd_flags_create_info);
+    bnd_flags_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bnd_flags_create_info.bindingCount = _SG_VK_NUM_BINDLESS_HEAP_BINDINGS;
+    bnd_flags_create_info.pBindingFlags = bnd_flags;
+    _SG_STRUCT(VkDescriptorSetLayoutCreateInfo, dsl_create_info);
+    dsl_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    dsl_create_info.pNext = &bnd_flags_create_info;
+    dsl_create_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    dsl_create_info.bindingCount = _SG_VK_NUM_BINDLESS_HEAP_BINDINGS;
+    dsl_create_info.pBindings = dsl_entries;
+    VkResult res = vkCreateDescriptorSetLayout(_sg.vk.dev, &dsl_create_info, 0, &heap->dsl);
+    if (res != VK_SUCCESS) {
+        _SG_WARN(VULKAN_CREATE_BINDLESS_HEAP_FAILED);
+        _sg_vk_bindless_discard();
+        return;
+    }
+    _sg_vk_set_object_label(VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, (uint64_t)heap->dsl, "bindless-heap-layout");
+    VkDeviceSize heap_size = 0;
+    _sg.vk.ext.get_descriptor_set_layout_size(_sg.vk.dev, heap->dsl, &heap_size);
+    for (uint32_t i = 0; i < _SG_VK_NUM_BINDLESS_HEAP_BINDINGS; i++) {
+        _sg.vk.ext.get_descriptor_set_layout_binding_offset(_sg.vk.dev, heap->dsl, i, &heap->binding_offsets[i]);
+    }
+
+    // the heap descriptor buffer is persistently mapped and only written
+    // when views and samplers are created
+    _SG_STRUCT(VkBufferCreateInfo, buf_create_info);
+    buf_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_create_info.size = heap_size;
+    buf_create_info.usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                            VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    _sg_vk_init_buffer_sharing_mode(&buf_create_info);
+    res = vkCreateBuffer(_sg.vk.dev, &buf_create_info, 0, &heap->buf);
+    if (res != VK_SUCCESS) {
+        _SG_WARN(VULKAN_CREATE_BINDLESS_HEAP_FAILED);
+        _sg_vk_bindless_discard();
+        return;
+    }
+    _sg_vk_set_object_label(VK_OBJECT_TYPE_BUFFER, (uint64_t)heap->buf, "bindless-heap");
+    _SG_STRUCT(VkMemoryRequirements, mem_reqs);
+    vkGetBufferMemoryRequirements(_sg.vk.dev, heap->buf, &mem_reqs);
+    heap->mem = _sg_vk_mem_alloc_device_memory(_SG_VK_MEMTYPE_DESCRIPTORS, &mem_reqs);
+    if (0 == heap->mem) {
+        _SG_WARN(VULKAN_CREATE_BINDLESS_HEAP_FAILED);
+        _sg_vk_bindless_discard();
+        return;
+    }
+    res = vkBindBufferMemory(_sg.vk.dev, heap->buf, heap->mem, 0);
+    if (res != VK_SUCCESS) {
+        _SG_WARN(VULKAN_CREATE_BINDLESS_HEAP_FAILED);
+        _sg_vk_bindless_discard();
+        return;
+    }
+    _SG_STRUCT(VkBufferDeviceAddressInfo, addr_info);
+    addr_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+    addr_info.buffer = heap->buf;
+    heap->dev_addr = vkGetBufferDeviceAddress(_sg.vk.dev, &addr_info);
+    SOKOL_ASSERT(heap->dev_addr);
+    void* mem_ptr = 0;
+    res = vkMapMemory(_sg.vk.dev, heap->mem, 0, VK_WHOLE_SIZE, 0, &mem_ptr);
+    if (res != VK_SUCCESS) {
+        _SG_WARN(VULKAN_CREATE_BINDLESS_HEAP_FAILED);
+        _sg_vk_bindless_discard();
+        return;
+    }
+    SOKOL_ASSERT(mem_ptr);
+    heap->mem_ptr = (uint8_t*) mem_ptr;
+    _sg_clear(heap->mem_ptr, (size_t)heap_size);
+
+    _sg_pool_init(&heap->view_indices, num_views);
+    _sg_pool_init(&heap->smp_indices, num_smps);
+    heap->valid = true;
+    _sg.features.bindless = true;
+}
+
+// allocate a heap index and copy a pre-recorded descriptor into the heap,
+// returns 0 if the heap is exhausted, may be called from loader threads
+_SOKOL_PRIVATE int _sg_vk_bindless_add(_sg_pool_t* indices, uint32_t binding, const void* descriptor_data, size_t descriptor_size) {
+    SOKOL_ASSERT(_sg.vk.bindless.valid);
+    SOKOL_ASSERT(binding < _SG_VK_NUM_BINDLESS_HEAP_BINDINGS);
+    SOKOL_ASSERT(descriptor_data && (descriptor_size > 0));
+    // NOTE: the index pool has its own lock, and each heap index is owned by one thread
+    const int index = _sg_pool_alloc_index(indices);
+    if (_SG_INVALID_SLOT_INDEX != index) {
+        const VkDeviceSize offset = _sg.vk.bindless.binding_offsets[binding] + (VkDeviceSize)index * descriptor_size;
+        memcpy(_sg.vk.bindless.mem_ptr + offset, descriptor_data, descriptor_size);
+    }
+    if (_SG_INVALID_SLOT_INDEX == index) {
+        _SG_WARN(VULKAN_BINDLESS_HEAP_EXHAUSTED);
+        return 0;
+    }
+    return index;
+}
+
+// delete-queue destructors, called when the GPU no longer references a heap index
+_SOKOL_PRIVATE void _sg_vk_bindless_free_index(_sg_pool_t* indices, int index) {
+    SOKOL_ASSERT(_sg.vk.bindless.valid);
+    _sg_pool_free_index(indices, index);
+}
+
+_SOKOL_PRIVATE void _sg_vk_bindless_view_index_destructor(void* obj) {
+    SOKOL_ASSERT(obj);
+    _sg_vk_bindless_free_index(&_sg.vk.bindless.view_indices, (int)(uintptr_t)obj);
+}
+
+_SOKOL_PRIVATE void _sg_vk_bindless_sampler_index_destructor(void* obj) {
+    SOKOL_ASSERT(obj);
+    _sg_vk_bindless_free_index(&_sg.vk.bindless.smp_indices, (int)(uintptr_t)obj);
+}
+
+// called from _sg_vk_apply_pipeline() for bindless shaders
+_SOKOL_PRIVATE void _sg_vk_bindless_bind_heap(VkCommandBuffer cmd_buf, const _sg_shader_t* shd, VkPipelineBindPoint vk_bind_point) {
+    SOKOL_ASSERT(cmd_buf && shd && shd->vk.bindless);
+    SOKOL_ASSERT(_sg.vk.bindless.valid);
+    const uint32_t dbuf_index = 1;
+    const VkDeviceSize dbuf_offset = 0;
+    _sg.vk.ext.cmd_set_descriptor_buffer_offsets(
+        cmd_buf,
+        vk_bind_point,
+        shd->vk.pip_layout,
+        _SG_VK_BINDLESS_DESCRIPTORSET_INDEX, // firstSet
+        1,  // setCount
+        &dbuf_index,
+        &dbuf_offset);
+    _sg_stats_inc(vk.num_cmd_set_descriptor_buffer_offsets);
+}
+
 _SOKOL_PRIVATE bool _sg_vk_bind_view_smp_descriptor_set(VkCommandBuffer cmd_buf, const _sg_bindings_ptrs_t* bnd, VkPipelineBindPoint vk_bind_point) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(cmd_buf);
@@ -20213,6 +27181,11 @@ _SOKOL_PRIVATE void _sg_vk_pipeline_destructor(void* obj) {
     vkDestroyPipeline(_sg.vk.dev, (VkPipeline)obj, 0);
 }
 
+_SOKOL_PRIVATE void _sg_vk_query_pool_destructor(void* obj) {
+    SOKOL_ASSERT(_sg.vk.dev && obj);
+    vkDestroyQueryPool(_sg.vk.dev, (VkQueryPool)obj, 0);
+}
+
 _SOKOL_PRIVATE VkBufferUsageFlags _sg_vk_buffer_usage(const sg_buffer_usage* usg) {
     VkBufferUsageFlags res = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
     if (usg->vertex_buffer) {
@@ -20222,7 +27195,12 @@ _SOKOL_PRIVATE VkBufferUsageFlags _sg_vk_buffer_usage(const sg_buffer_usage* usg
         res |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
     }
     if (usg->storage_buffer) {
-        res |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        // NOTE: storage buffers can also provide sg_dispatch_indirect() arguments
+        res |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    }
+    if (usg->uniform_buffer) {
+        // NOTE: uniform buffer descriptors are created from the buffer device address
+        res |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
     }
     return res;
 }
@@ -20285,8 +27263,13 @@ _SOKOL_PRIVATE VkImageType _sg_vk_image_type(sg_image_type t) {
 }
 
 _SOKOL_PRIVATE VkImageUsageFlags _sg_vk_image_usage(const sg_image_usage* usg) {
-    VkImageUsageFlags res = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-    res |= VK_IMAGE_USAGE_SAMPLED_BIT;
+    VkImageUsageFlags res = 0;
+    if (usg->transient_attachment) {
+        // transient images may only have attachment usage bits
+        res |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+    } else {
+        res |= VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    }
     if (usg->storage_image) {
         res |= VK_IMAGE_USAGE_STORAGE_BIT;
     }
@@ -20608,13 +27591,25 @@ _SOKOL_PRIVATE void _sg_vk_load_ext_funcs(void) {
     }
 }
 
-_SOKOL_PRIVATE void _sg_vk_init_caps(void) {
+// query slots are reset from the CPU (Vulkan 1.2 hostQueryReset), this avoids reading
+// stale results before a GPU-side vkCmdResetQueryPool() has been executed,
+// NOTE: a feature being supported by the physical device doesn't mean that
+// it has been enabled on the logical device, so this must come from the environment
+_SOKOL_PRIVATE void _sg_vk_init_counter_caps(const sg_desc* desc) {
+    const bool host_query_reset = desc->environment.vulkan.host_query_reset;
+    _sg.features.occlusion_counter = host_query_reset;
+    _sg.features.pipeline_statistics_counter = host_query_reset && desc->environment.vulkan.pipeline_statistics_query;
+}
+
+_SOKOL_PRIVATE void _sg_vk_init_caps(const sg_desc* desc) {
     _sg.backend = SG_BACKEND_VULKAN;
     _sg.features.origin_top_left = true;
     _sg.features.image_clamp_to_border = false; // FIXME?
     _sg.features.mrt_independent_blend_state = true;
     _sg.features.mrt_independent_write_mask = true;
     _sg.features.compute = true;
+    _sg.features.dispatch_indirect = true;
+    _sg.features.uniform_buffer_bindings = true;
     _sg.features.msaa_texture_bindings = true;
     _sg.features.draw_base_vertex = true;
     _sg.features.draw_base_instance = true;
@@ -20628,6 +27623,7 @@ _SOKOL_PRIVATE void _sg_vk_init_caps(void) {
     vkGetPhysicalDeviceProperties2(_sg.vk.phys_dev, &_sg.vk.dev_props);
     _sg.vk.dev_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
     vkGetPhysicalDeviceFeatures2(_sg.vk.phys_dev, &_sg.vk.dev_features);
+    _sg_vk_init_counter_caps(desc);
 
     const VkPhysicalDeviceLimits* l = &_sg.vk.dev_props.properties.limits;
     _sg.limits.max_image_size_2d = (int)l->maxImageDimension2D;
@@ -20641,6 +27637,7 @@ _SOKOL_PRIVATE void _sg_vk_init_caps(void) {
     _sg.limits.max_storage_buffer_bindings_per_stage = _sg_min((int)l->maxPerStageDescriptorStorageBuffers, SG_MAX_VIEW_BINDSLOTS);
     _sg.limits.max_storage_image_bindings_per_stage = _sg_min((int)l->maxPerStageDescriptorStorageImages, SG_MAX_VIEW_BINDSLOTS);
     _sg.limits.vk_min_uniform_buffer_offset_alignment = (int)l->minUniformBufferOffsetAlignment;
+    _sg.limits.uniform_buffer_offset_alignment = _sg.limits.vk_min_uniform_buffer_offset_alignment;
 
     _SG_STRUCT(VkPhysicalDeviceImageFormatInfo2, fmt_info);
     fmt_info.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2;
@@ -20680,27 +27677,6 @@ _SOKOL_PRIVATE void _sg_vk_init_caps(void) {
     }
 }
 
-_SOKOL_PRIVATE void _sg_vk_create_fences(void) {
-    SOKOL_ASSERT(_sg.vk.dev);
-    _SG_STRUCT(VkFenceCreateInfo, create_info);
-    create_info.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    create_info.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-    for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
-        SOKOL_ASSERT(0 == _sg.vk.frame.slot[i].fence);
-        VkResult res = vkCreateFence(_sg.vk.dev, &create_info, 0, &_sg.vk.frame.slot[i].fence);
-        SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.frame.slot[i].fence); _SOKOL_UNUSED(res);
-    }
-}
-
-_SOKOL_PRIVATE void _sg_vk_destroy_fences(void) {
-    SOKOL_ASSERT(_sg.vk.dev);
-    for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
-        SOKOL_ASSERT(_sg.vk.frame.slot[i].fence);
-        vkDestroyFence(_sg.vk.dev, _sg.vk.frame.slot[i].fence, 0);
-        _sg.vk.frame.slot[i].fence = 0;
-    }
-}
-
 _SOKOL_PRIVATE void _sg_vk_create_frame_command_pool_and_buffers(void) {
     SOKOL_ASSERT(_sg.vk.dev);
     SOKOL_ASSERT(0 == _sg.vk.frame.cmd_pool);
@@ -20712,14 +27688,17 @@ _SOKOL_PRIVATE void _sg_vk_create_frame_command_pool_and_buffers(void) {
     VkResult res = vkCreateCommandPool(_sg.vk.dev, &pool_create_info, 0, &_sg.vk.frame.cmd_pool);
     SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.frame.cmd_pool); _SOKOL_UNUSED(res);
 
+    // NOTE: additional command buffer segments are only needed with async compute
+    const uint32_t num_segments = _sg.vk.compute.valid ? _SG_VK_MAX_CMDBUF_SEGMENTS : 1;
     for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
         _SG_STRUCT(VkCommandBufferAllocateInfo, cmdbuf_alloc_info);
         cmdbuf_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         cmdbuf_alloc_info.commandPool = _sg.vk.frame.cmd_pool;
         cmdbuf_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmdbuf_alloc_info.commandBufferCount = num_segments;
+        res = vkAllocateCommandBuffers(_sg.vk.dev, &cmdbuf_alloc_info, _sg.vk.frame.slot[i].command_buffers);
+        SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.frame.slot[i].command_buffers[0]);
         cmdbuf_alloc_info.commandBufferCount = 1;
-        res = vkAllocateCommandBuffers(_sg.vk.dev, &cmdbuf_alloc_info, &_sg.vk.frame.slot[i].command_buffer);
-        SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.frame.slot[i].command_buffer);
         res = vkAllocateCommandBuffers(_sg.vk.dev, &cmdbuf_alloc_info, &_sg.vk.frame.slot[i].stream_command_buffer);
         SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.frame.slot[i].stream_command_buffer);
     }
@@ -20734,50 +27713,210 @@ _SOKOL_PRIVATE void _sg_vk_destroy_frame_command_pool(void) {
     vkDestroyCommandPool(_sg.vk.dev, _sg.vk.frame.cmd_pool, 0);
     _sg.vk.frame.cmd_pool = 0;
     for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
-        SOKOL_ASSERT(_sg.vk.frame.slot[i].command_buffer);
-        _sg.vk.frame.slot[i].command_buffer = 0;
+        SOKOL_ASSERT(_sg.vk.frame.slot[i].command_buffers[0]);
+        _sg_clear(_sg.vk.frame.slot[i].command_buffers, sizeof(_sg.vk.frame.slot[i].command_buffers));
         _sg.vk.frame.slot[i].stream_command_buffer = 0;
     }
 }
 
+//-- async compute queue --------------------------------------------------------
+_SOKOL_PRIVATE void _sg_vk_async_compute_init(const sg_desc* desc) {
+    SOKOL_ASSERT(_sg.vk.dev);
+    _sg_vk_async_compute_t* ac = &_sg.vk.compute;
+    SOKOL_ASSERT(!ac->valid);
+    if (0 == desc->environment.vulkan.compute_queue) {
+        return;
+    }
+    ac->valid = true;
+    _sg.features.async_compute = true;
+    ac->queue = (VkQueue) desc->environment.vulkan.compute_queue;
+    ac->queue_family_index = desc->environment.vulkan.compute_queue_family_index;
+    ac->concurrent = ac->queue_family_index != _sg.vk.queue_family_index;
+    ac->queue_family_indices[0] = _sg.vk.queue_family_index;
+    ac->queue_family_indices[1] = ac->queue_family_index;
+
+    _SG_STRUCT(VkCommandPoolCreateInfo, pool_create_info);
+    pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_create_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_create_info.queueFamilyIndex = ac->queue_family_index;
+    VkResult res = vkCreateCommandPool(_sg.vk.dev, &pool_create_info, 0, &ac->cmd_pool);
+    SOKOL_ASSERT((res == VK_SUCCESS) && ac->cmd_pool); _SOKOL_UNUSED(res);
+    _sg_vk_set_object_label(VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)ac->cmd_pool, "async-compute cmd pool");
+    for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        _SG_STRUCT(VkCommandBufferAllocateInfo, cmdbuf_alloc_info);
+        cmdbuf_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        cmdbuf_alloc_info.commandPool = ac->cmd_pool;
+        cmdbuf_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        cmdbuf_alloc_info.commandBufferCount = 1;
+        res = vkAllocateCommandBuffers(_sg.vk.dev, &cmdbuf_alloc_info, &_sg.vk.frame.slot[i].compute_command_buffer);
+        SOKOL_ASSERT((res == VK_SUCCESS) && _sg.vk.frame.slot[i].compute_command_buffer);
+    }
+    _sg_vk_timeline_init(&ac->timeline, "async-compute timeline semaphore");
+}
+
+// NOTE: must be called after vkDeviceWaitIdle()
+_SOKOL_PRIVATE void _sg_vk_async_compute_discard(void) {
+    _sg_vk_async_compute_t* ac = &_sg.vk.compute;
+    if (!ac->valid) {
+        return;
+    }
+    _sg_vk_timeline_discard(&ac->timeline);
+    // NOTE: command buffers owned by the pool will be automatically destroyed
+    vkDestroyCommandPool(_sg.vk.dev, ac->cmd_pool, 0);
+    for (size_t i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        _sg.vk.frame.slot[i].compute_command_buffer = 0;
+    }
+    _sg_clear(ac, sizeof(_sg_vk_async_compute_t));
+}
+
+_SOKOL_PRIVATE void _sg_vk_begin_command_buffer(VkCommandBuffer cmd_buf) {
+    VkResult res = vkResetCommandBuffer(cmd_buf, 0);
+    SOKOL_ASSERT(res == VK_SUCCESS);
+    _SG_STRUCT(VkCommandBufferBeginInfo, cmdbuf_begin_info);
+    cmdbuf_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmdbuf_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    res = vkBeginCommandBuffer(cmd_buf, &cmdbuf_begin_info);
+    SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
+}
+
+// called from _sg_vk_begin_pass() for compute passes with sg_pass.async_compute
+_SOKOL_PRIVATE void _sg_vk_async_compute_begin_pass(void) {
+    _sg_vk_async_compute_t* ac = &_sg.vk.compute;
+    SOKOL_ASSERT(ac->valid && !ac->recording);
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    if (0 == ac->cmd_buf) {
+        // first async compute pass in this frame
+        ac->cmd_buf = _sg.vk.frame.slot[_sg.vk.frame_slot].compute_command_buffer;
+        _sg_vk_begin_command_buffer(ac->cmd_buf);
+        _sg_vk_bind_descriptor_buffers(ac->cmd_buf);
+        ac->compute_value = ac->timeline.value + 1;
+    }
+    ac->recording = true;
+    ac->gfx_cmd_buf = _sg.vk.frame.cmd_buf;
+    _sg.vk.frame.cmd_buf = ac->cmd_buf;
+    _sg_stats_inc(vk.num_async_compute_passes);
+}
+
+// called from _sg_vk_end_pass() after the end-of-pass barriers
+_SOKOL_PRIVATE void _sg_vk_async_compute_end_pass(void) {
+    _sg_vk_async_compute_t* ac = &_sg.vk.compute;
+    SOKOL_ASSERT(ac->recording && ac->gfx_cmd_buf);
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf == ac->cmd_buf);
+    _sg.vk.frame.cmd_buf = ac->gfx_cmd_buf;
+    ac->gfx_cmd_buf = 0;
+    ac->recording = false;
+}
+
+// mark the resources of an async compute pass, or check if a graphics pass
+// uses resources of an async compute pass and needs to wait for the compute queue
+_SOKOL_PRIVATE void _sg_vk_async_compute_track(uint64_t* async_compute_value) {
+    SOKOL_ASSERT(async_compute_value);
+    _sg_vk_async_compute_t* ac = &_sg.vk.compute;
+    if (ac->recording) {
+        *async_compute_value = ac->compute_value;
+    } else if (*async_compute_value > ac->waited_compute_value) {
+        SOKOL_ASSERT(_sg.vk.frame.num_segments > 0);
+        _sg.vk.frame.segments[_sg.vk.frame.num_segments - 1].wait_compute_value = *async_compute_value;
+        ac->waited_compute_value = *async_compute_value;
+    }
+}
+
+_SOKOL_PRIVATE void _sg_vk_async_compute_track_bindings(const _sg_bindings_ptrs_t* bnd) {
+    SOKOL_ASSERT(bnd);
+    if (!_sg.vk.compute.valid) {
+        return;
+    }
+    for (size_t i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
+        if (bnd->vbs[i]) {
+            _sg_vk_async_compute_track(&bnd->vbs[i]->vk.async_compute_value);
+        }
+    }
+    if (bnd->ib) {
+        _sg_vk_async_compute_track(&bnd->ib->vk.async_compute_value);
+    }
+    for (size_t i = 0; i < SG_MAX_VIEW_BINDSLOTS; i++) {
+        const _sg_view_t* view = bnd->views[i];
+        if (0 == view) {
+            continue;
+        } else if (view->cmn.type == SG_VIEWTYPE_STORAGEBUFFER) {
+            _sg_buffer_t* buf = _sg_buffer_ref_ptr(&view->cmn.buf.ref);
+            _sg_vk_async_compute_track(&buf->vk.async_compute_value);
+        } else {
+            _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
+            _sg_vk_async_compute_track(&img->vk.async_compute_value);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_vk_async_compute_track_attachments(const _sg_attachments_ptrs_t* atts) {
+    SOKOL_ASSERT(atts);
+    if (!_sg.vk.compute.valid) {
+        return;
+    }
+    for (int i = 0; i < atts->num_color_views; i++) {
+        _sg_vk_async_compute_track(&_sg_image_ref_ptr(&atts->color_views[i]->cmn.img.ref)->vk.async_compute_value);
+        if (atts->resolve_views[i]) {
+            _sg_vk_async_compute_track(&_sg_image_ref_ptr(&atts->resolve_views[i]->cmn.img.ref)->vk.async_compute_value);
+        }
+    }
+    if (atts->ds_view) {
+        _sg_vk_async_compute_track(&_sg_image_ref_ptr(&atts->ds_view->cmn.img.ref)->vk.async_compute_value);
+    }
+}
+
+// called at the start of graphics and ordinary compute passes: after an async compute pass,
+// start a new command buffer segment so that the following passes only wait for the
+// compute queue if they actually use resources of the async compute pass
+_SOKOL_PRIVATE void _sg_vk_maybe_split_frame_command_buffer(void) {
+    const _sg_vk_async_compute_t* ac = &_sg.vk.compute;
+    SOKOL_ASSERT(_sg.vk.frame.num_segments > 0);
+    const uint32_t cur_index = _sg.vk.frame.num_segments - 1;
+    const bool compute_pending = (0 != ac->cmd_buf) && (ac->waited_compute_value < ac->compute_value);
+    if (compute_pending
+        && (_sg.vk.frame.segment_num_passes > 0)
+        && (_sg.vk.frame.segments[cur_index].wait_compute_value == 0)
+        && (_sg.vk.frame.num_segments < _SG_VK_MAX_CMDBUF_SEGMENTS))
+    {
+        SOKOL_ASSERT(_sg.vk.frame.cmd_buf == _sg.vk.frame.segments[cur_index].cmd_buf);
+        VkResult res = vkEndCommandBuffer(_sg.vk.frame.cmd_buf);
+        SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
+        _sg_vk_cmdbuf_segment_t* seg = &_sg.vk.frame.segments[_sg.vk.frame.num_segments++];
+        seg->cmd_buf = _sg.vk.frame.slot[_sg.vk.frame_slot].command_buffers[cur_index + 1];
+        seg->wait_compute_value = 0;
+        _sg_vk_begin_command_buffer(seg->cmd_buf);
+        _sg_vk_bind_descriptor_buffers(seg->cmd_buf);
+        _sg.vk.frame.cmd_buf = seg->cmd_buf;
+        _sg.vk.frame.segment_num_passes = 0;
+    }
+    _sg.vk.frame.segment_num_passes += 1;
+}
+
 _SOKOL_PRIVATE void _sg_vk_acquire_frame_command_buffers(void) {
     SOKOL_ASSERT(_sg.vk.dev);
-    VkResult res;
     if (0 == _sg.vk.frame.cmd_buf) {
         SOKOL_ASSERT(0 == _sg.vk.frame.stream_cmd_buf);
         _sg.vk.frame_slot = (_sg.vk.frame_slot + 1) % SG_NUM_INFLIGHT_FRAMES;
-        // block until oldest inflight-frame has finished
-        do {
-            res = vkWaitForFences(_sg.vk.dev,
-                1,
-                &_sg.vk.frame.slot[_sg.vk.frame_slot].fence,
-                VK_TRUE,
-                UINT64_MAX);
-        } while (res == VK_TIMEOUT);
-        if (res != VK_SUCCESS) {
-            _SG_WARN(VULKAN_WAIT_FOR_FENCE_FAILED);
+        // block until the oldest inflight-frame has finished, the graphics timeline
+        // doesn't cover the async compute queue, so this needs to wait for both
+        if (!_sg_vk_timeline_wait(&_sg.vk.timeline, _sg.vk.frame.slot[_sg.vk.frame_slot].timeline_value)) {
             _sg.cur_pass.valid = false;
             return;
         }
-        res = vkResetFences(_sg.vk.dev, 1, &_sg.vk.frame.slot[_sg.vk.frame_slot].fence);
-        SOKOL_ASSERT(res == VK_SUCCESS); _SOKOL_UNUSED(res);
-
+        if (_sg.vk.frame.slot[_sg.vk.frame_slot].compute_value != 0) {
+            _sg_vk_timeline_wait(&_sg.vk.compute.timeline, _sg.vk.frame.slot[_sg.vk.frame_slot].compute_value);
+            _sg.vk.frame.slot[_sg.vk.frame_slot].compute_value = 0;
+        }
         _sg_vk_delete_queue_collect();
 
-        _sg.vk.frame.cmd_buf = _sg.vk.frame.slot[_sg.vk.frame_slot].command_buffer;
-        res = vkResetCommandBuffer(_sg.vk.frame.cmd_buf, 0);
-        SOKOL_ASSERT(res == VK_SUCCESS);
+        _sg.vk.frame.cmd_buf = _sg.vk.frame.slot[_sg.vk.frame_slot].command_buffers[0];
+        _sg.vk.frame.num_segments = 1;
+        _sg.vk.frame.segments[0].cmd_buf = _sg.vk.frame.cmd_buf;
+        _sg.vk.frame.segments[0].wait_compute_value = 0;
+        _sg.vk.frame.segment_num_passes = 0;
+        _sg.vk.frame.swapchain_segment_valid = false;
         _sg.vk.frame.stream_cmd_buf = _sg.vk.frame.slot[_sg.vk.frame_slot].stream_command_buffer;
-        res = vkResetCommandBuffer(_sg.vk.frame.stream_cmd_buf, 0);
-        SOKOL_ASSERT(res == VK_SUCCESS);
-
-        _SG_STRUCT(VkCommandBufferBeginInfo, cmdbuf_begin_info);
-        cmdbuf_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        cmdbuf_begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
-        res = vkBeginCommandBuffer(_sg.vk.frame.cmd_buf, &cmdbuf_begin_info);
-        SOKOL_ASSERT(res == VK_SUCCESS);
-        res = vkBeginCommandBuffer(_sg.vk.frame.stream_cmd_buf, &cmdbuf_begin_info);
-        SOKOL_ASSERT(res == VK_SUCCESS);
+        _sg_vk_begin_command_buffer(_sg.vk.frame.cmd_buf);
+        _sg_vk_begin_command_buffer(_sg.vk.frame.stream_cmd_buf);
 
         _sg_vk_uniform_after_acquire();
         _sg_vk_bind_after_acquire();
@@ -20789,6 +27928,9 @@ _SOKOL_PRIVATE void _sg_vk_acquire_frame_command_buffers(void) {
 _SOKOL_PRIVATE void _sg_vk_submit_frame_command_buffers(void) {
     SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
     SOKOL_ASSERT(_sg.vk.frame.stream_cmd_buf);
+    SOKOL_ASSERT(!_sg.vk.compute.recording);
+    SOKOL_ASSERT((_sg.vk.frame.num_segments > 0) && (_sg.vk.frame.num_segments <= _SG_VK_MAX_CMDBUF_SEGMENTS));
+    _sg_vk_async_compute_t* ac = &_sg.vk.compute;
     VkResult res;
     _SOKOL_UNUSED(res);
 
@@ -20800,49 +27942,353 @@ _SOKOL_PRIVATE void _sg_vk_submit_frame_command_buffers(void) {
     SOKOL_ASSERT(res == VK_SUCCESS);
     res = vkEndCommandBuffer(_sg.vk.frame.cmd_buf);
     SOKOL_ASSERT(res == VK_SUCCESS);
+    const bool has_compute = 0 != ac->cmd_buf;
+    if (has_compute) {
+        res = vkEndCommandBuffer(ac->cmd_buf);
+        SOKOL_ASSERT(res == VK_SUCCESS);
+    }
 
-    _SG_STRUCT(VkSubmitInfo, submit_infos[2]);
-    // streaming-update command buffer
-    submit_infos[0].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submit_infos[0].commandBufferCount = 1;
-    submit_infos[0].pCommandBuffers = &_sg.vk.frame.stream_cmd_buf;
-    // render command buffer
-    const VkPipelineStageFlags present_wait_dst_stage_mask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-    submit_infos[1].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    // one batch for the streaming-update command buffer, and one batch per render command buffer segment
+    _SG_STRUCT(VkSubmitInfo2, submit_infos[1 + _SG_VK_MAX_CMDBUF_SEGMENTS]);
+    _SG_STRUCT(VkCommandBufferSubmitInfo, cmdbuf_infos[1 + _SG_VK_MAX_CMDBUF_SEGMENTS]);
+    // at most two wait semaphores per batch (async compute and swapchain image),
+    // and two signal semaphores per batch (graphics timeline and render-finished)
+    _SG_STRUCT(VkSemaphoreSubmitInfo, wait_infos[2 * (1 + _SG_VK_MAX_CMDBUF_SEGMENTS)]);
+    _SG_STRUCT(VkSemaphoreSubmitInfo, signal_infos[2 * (1 + _SG_VK_MAX_CMDBUF_SEGMENTS)]);
+    const uint32_t num_batches = 1 + _sg.vk.frame.num_segments;
+    const uint32_t last_batch = num_batches - 1;
+    for (uint32_t i = 0; i < num_batches; i++) {
+        cmdbuf_infos[i].sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+        cmdbuf_infos[i].commandBuffer = (i == 0) ? _sg.vk.frame.stream_cmd_buf : _sg.vk.frame.segments[i - 1].cmd_buf;
+        submit_infos[i].sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+        submit_infos[i].commandBufferInfoCount = 1;
+        submit_infos[i].pCommandBufferInfos = &cmdbuf_infos[i];
+        submit_infos[i].pWaitSemaphoreInfos = &wait_infos[2 * i];
+        submit_infos[i].pSignalSemaphoreInfos = &signal_infos[2 * i];
+    }
+    // the last batch signals the frame's value on the graphics timeline, and the async
+    // compute work starts after the streaming updates of this frame (and thus after
+    // all previously submitted work on the graphics queue), the actual timeline values
+    // are assigned in submission order below
+    VkSemaphoreSubmitInfo* frame_signal_info = &signal_infos[2 * last_batch + submit_infos[last_batch].signalSemaphoreInfoCount++];
+    frame_signal_info->sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    frame_signal_info->semaphore = _sg.vk.timeline.sem;
+    frame_signal_info->stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    VkSemaphoreSubmitInfo* stream_signal_info = 0;
+    if (has_compute) {
+        SOKOL_ASSERT(last_batch > 0);
+        stream_signal_info = &signal_infos[submit_infos[0].signalSemaphoreInfoCount++];
+        stream_signal_info->sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        stream_signal_info->semaphore = _sg.vk.timeline.sem;
+        stream_signal_info->stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    }
+    // render command buffer segments wait for the compute queue if they use
+    // async compute resources, and all following segments must wait too
+    uint64_t wait_compute_value = 0;
+    for (uint32_t i = 0; i < _sg.vk.frame.num_segments; i++) {
+        const _sg_vk_cmdbuf_segment_t* seg = &_sg.vk.frame.segments[i];
+        VkSubmitInfo2* info = &submit_infos[i + 1];
+        wait_compute_value = _sg_max(wait_compute_value, seg->wait_compute_value);
+        if (wait_compute_value != 0) {
+            VkSemaphoreSubmitInfo* wait_info = &wait_infos[2 * (i + 1) + info->waitSemaphoreInfoCount++];
+            wait_info->sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+            wait_info->semaphore = ac->timeline.sem;
+            wait_info->value = wait_compute_value;
+            wait_info->stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            _sg_stats_inc(vk.num_async_compute_waits);
+        }
+    }
     // NOTE: the render_finished_sem and present_complete_sem are only
     // provided in swapchain passes, but rendering without a swapchain
     // pass should be a valid scenario (for instance for 'headless rendering')
     //
     // see: https://github.com/floooh/sokol/issues/1459
     if (_sg.vk.present_complete_sem && _sg.vk.render_finished_sem) {
-        submit_infos[1].waitSemaphoreCount = 1;
-        submit_infos[1].pWaitSemaphores = &_sg.vk.present_complete_sem;
-        submit_infos[1].pWaitDstStageMask = &present_wait_dst_stage_mask;
-        submit_infos[1].signalSemaphoreCount = 1;
-        submit_infos[1].pSignalSemaphores = &_sg.vk.render_finished_sem;
-    }
-    submit_infos[1].commandBufferCount = 1;
-    submit_infos[1].pCommandBuffers = &_sg.vk.frame.cmd_buf;
-    res = vkQueueSubmit(_sg.vk.queue, 2, submit_infos, _sg.vk.frame.slot[_sg.vk.frame_slot].fence);
+        const uint32_t present_batch = 1 + (_sg.vk.frame.swapchain_segment_valid ? _sg.vk.frame.swapchain_segment : 0);
+        VkSubmitInfo2* info = &submit_infos[present_batch];
+        VkSemaphoreSubmitInfo* wait_info = &wait_infos[2 * present_batch + info->waitSemaphoreInfoCount++];
+        wait_info->sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        wait_info->semaphore = _sg.vk.present_complete_sem;
+        wait_info->stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+        VkSemaphoreSubmitInfo* signal_info = &signal_infos[2 * last_batch + submit_infos[last_batch].signalSemaphoreInfoCount++];
+        signal_info->sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        signal_info->semaphore = _sg.vk.render_finished_sem;
+        signal_info->stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    }
+    _sg_vk_queue_lock();
+    // all pending uploads into new or dynamic resources go into one submission before the frame
+    _sg_vk_staging_copy_flush();
+    if (has_compute) {
+        stream_signal_info->value = ++_sg.vk.timeline.value;
+    }
+    frame_signal_info->value = ++_sg.vk.timeline.value;
+    if (has_compute) {
+        // NOTE: waiting on a timeline value which is signalled by a later submission is allowed
+        _SG_STRUCT(VkCommandBufferSubmitInfo, compute_cmdbuf_info);
+        compute_cmdbuf_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+        compute_cmdbuf_info.commandBuffer = ac->cmd_buf;
+        _SG_STRUCT(VkSemaphoreSubmitInfo, compute_wait_info);
+        compute_wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        compute_wait_info.semaphore = _sg.vk.timeline.sem;
+        compute_wait_info.value = stream_signal_info->value;
+        compute_wait_info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        _SG_STRUCT(VkSemaphoreSubmitInfo, compute_signal_info);
+        compute_signal_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        compute_signal_info.semaphore = ac->timeline.sem;
+        compute_signal_info.value = ac->compute_value;
+        compute_signal_info.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        _SG_STRUCT(VkSubmitInfo2, compute_submit_info);
+        compute_submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+        compute_submit_info.waitSemaphoreInfoCount = 1;
+        compute_submit_info.pWaitSemaphoreInfos = &compute_wait_info;
+        compute_submit_info.commandBufferInfoCount = 1;
+        compute_submit_info.pCommandBufferInfos = &compute_cmdbuf_info;
+        compute_submit_info.signalSemaphoreInfoCount = 1;
+        compute_submit_info.pSignalSemaphoreInfos = &compute_signal_info;
+        res = vkQueueSubmit2(ac->queue, 1, &compute_submit_info, VK_NULL_HANDLE);
+        SOKOL_ASSERT(res == VK_SUCCESS);
+        ac->timeline.value = ac->compute_value;
+        _sg.vk.frame.slot[_sg.vk.frame_slot].compute_value = ac->compute_value;
+    }
+    res = vkQueueSubmit2(_sg.vk.queue, num_batches, submit_infos, VK_NULL_HANDLE);
+    _sg.vk.frame.slot[_sg.vk.frame_slot].timeline_value = frame_signal_info->value;
+    _sg.vk.frame.slot[_sg.vk.frame_slot].frame_index = _sg.frame_index;
+    _sg_vk_queue_unlock();
     SOKOL_ASSERT(res == VK_SUCCESS);
+    _sg_stats_add(vk.num_cmd_buffer_segments, _sg.vk.frame.num_segments);
+    _sg_vk_delete_queue_after_submit(frame_signal_info->value, ac->valid ? ac->timeline.value : 0);
 
     _sg.vk.frame.cmd_buf = 0;
     _sg.vk.frame.stream_cmd_buf = 0;
+    _sg.vk.frame.num_segments = 0;
+    ac->cmd_buf = 0;
 
     // NOTE: it's valid to register resource objects for destruction in the
-    // delete queue past this point (between _sg_vk_submit_frame_command_buffer()
-    // and the next _sg_vk_acquire_frame_command_buffer()) since resources which are
-    // destroyed in this 'gap' can at most have been used by the command
-    // buffer that was just submitted
+    // delete queue past this point (between _sg_vk_submit_frame_command_buffers()
+    // and the next _sg_vk_acquire_frame_command_buffers()), those objects are
+    // retired together with the next frame
 }
 
-_SOKOL_PRIVATE void _sg_vk_setup_backend(const sg_desc* desc) {
+//-- background pipeline compiler ----------------------------------------------
+_SOKOL_PRIVATE sg_resource_state _sg_vk_compile_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc);
+
+_SOKOL_PRIVATE void _sg_vk_compiler_lock(void) {
+    #if defined(_SG_VK_PTHREADS)
+    pthread_mutex_lock(&_sg.vk.compiler.mutex);
+    #elif defined(_SG_VK_WIN32_THREADS)
+    AcquireSRWLockExclusive(&_sg.vk.compiler.mutex);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_vk_compiler_unlock(void) {
+    #if defined(_SG_VK_PTHREADS)
+    pthread_mutex_unlock(&_sg.vk.compiler.mutex);
+    #elif defined(_SG_VK_WIN32_THREADS)
+    ReleaseSRWLockExclusive(&_sg.vk.compiler.mutex);
+    #endif
+}
+
+// NOTE: must be called with the compiler lock held
+_SOKOL_PRIVATE void _sg_vk_compiler_wait(bool done) {
+    #if defined(_SG_VK_PTHREADS)
+    pthread_cond_wait(done ? &_sg.vk.compiler.done_cond : &_sg.vk.compiler.work_cond, &_sg.vk.compiler.mutex);
+    #elif defined(_SG_VK_WIN32_THREADS)
+    SleepConditionVariableSRW(done ? &_sg.vk.compiler.done_cond : &_sg.vk.compiler.work_cond, &_sg.vk.compiler.mutex, INFINITE, 0);
+    #endif
+}
+
+// NOTE: must be called with the compiler lock held
+_SOKOL_PRIVATE void _sg_vk_compiler_signal(bool done) {
+    #if defined(_SG_VK_PTHREADS)
+    pthread_cond_broadcast(done ? &_sg.vk.compiler.done_cond : &_sg.vk.compiler.work_cond);
+    #elif defined(_SG_VK_WIN32_THREADS)
+    WakeAllConditionVariable(done ? &_sg.vk.compiler.done_cond : &_sg.vk.compiler.work_cond);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_vk_compiler_main(void* state) {
+    #if defined(SOKOL_MULTI_CONTEXT)
+    // the compiler thread must operate on the context which created it
+    _sg_cur_state = (_sg_state_t*)state;
+    #else
+    _SOKOL_UNUSED(state);
+    #endif
+    _sg_vk_compiler_t* cmp = &_sg.vk.compiler;
+    for (;;) {
+        _sg_vk_compiler_lock();
+        while (!cmp->quit && !cmp->head) {
+            _sg_vk_compiler_wait(false);
+        }
+        if (cmp->quit) {
+            _sg_vk_compiler_unlock();
+            break;
+        }
+        _sg_vk_compile_job_t* job = cmp->head;
+        cmp->head = job->next;
+        if (!cmp->head) {
+            cmp->tail = 0;
+        }
+        job->state = _SG_VK_COMPILEJOB_RUNNING;
+        _sg_vk_compiler_unlock();
+
+        // NOTE: the pipeline's shader is kept alive by _sg_vk_discard_shader() until all jobs are done
+        const sg_resource_state result = _sg_vk_compile_pipeline(job->pip, &job->desc);
+
+        _sg_vk_compiler_lock();
+        job->result = result;
+        job->state = _SG_VK_COMPILEJOB_DONE;
+        cmp->num_busy -= 1;
+        _sg_vk_compiler_signal(true);
+        _sg_vk_compiler_unlock();
+    }
+}
+
+#if defined(_SG_VK_PTHREADS)
+_SOKOL_PRIVATE void* _sg_vk_compiler_thread_func(void* arg) {
+    _sg_vk_compiler_main(arg);
+    return 0;
+}
+#elif defined(_SG_VK_WIN32_THREADS)
+_SOKOL_PRIVATE DWORD WINAPI _sg_vk_compiler_thread_func(LPVOID arg) {
+    _sg_vk_compiler_main(arg);
+    return 0;
+}
+#endif
+
+_SOKOL_PRIVATE void _sg_vk_compiler_init(void) {
+    _sg_vk_compiler_t* cmp = &_sg.vk.compiler;
+    SOKOL_ASSERT(!cmp->valid);
+    #if defined(_SG_VK_PTHREADS)
+    pthread_mutex_init(&cmp->mutex, 0);
+    pthread_cond_init(&cmp->work_cond, 0);
+    pthread_cond_init(&cmp->done_cond, 0);
+    cmp->valid = 0 == pthread_create(&cmp->thread, 0, _sg_vk_compiler_thread_func, (void*)&_sg);
+    if (!cmp->valid) {
+        pthread_cond_destroy(&cmp->done_cond);
+        pthread_cond_destroy(&cmp->work_cond);
+        pthread_mutex_destroy(&cmp->mutex);
+    }
+    #elif defined(_SG_VK_WIN32_THREADS)
+    InitializeSRWLock(&cmp->mutex);
+    InitializeConditionVariable(&cmp->work_cond);
+    InitializeConditionVariable(&cmp->done_cond);
+    cmp->thread = CreateThread(0, 0, _sg_vk_compiler_thread_func, (LPVOID)&_sg, 0, 0);
+    cmp->valid = 0 != cmp->thread;
+    #endif
+    if (!cmp->valid) {
+        _SG_WARN(VULKAN_CREATE_COMPILER_THREAD_FAILED);
+    }
+    _sg.features.parallel_shader_compile = cmp->valid;
+}
+
+_SOKOL_PRIVATE void _sg_vk_compiler_discard(void) {
+    _sg_vk_compiler_t* cmp = &_sg.vk.compiler;
+    if (!cmp->valid) {
+        return;
+    }
+    // all pending pipelines have been discarded at this point
+    SOKOL_ASSERT((0 == cmp->num_busy) && (0 == cmp->head));
+    _sg_vk_compiler_lock();
+    cmp->quit = true;
+    _sg_vk_compiler_signal(false);
+    _sg_vk_compiler_unlock();
+    #if defined(_SG_VK_PTHREADS)
+    pthread_join(cmp->thread, 0);
+    pthread_cond_destroy(&cmp->done_cond);
+    pthread_cond_destroy(&cmp->work_cond);
+    pthread_mutex_destroy(&cmp->mutex);
+    #elif defined(_SG_VK_WIN32_THREADS)
+    WaitForSingleObject(cmp->thread, INFINITE);
+    CloseHandle(cmp->thread);
+    #endif
+    cmp->valid = false;
+}
+
+_SOKOL_PRIVATE void _sg_vk_compiler_enqueue(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(pip && desc && !pip->vk.job);
+    _sg_vk_compiler_t* cmp = &_sg.vk.compiler;
+    SOKOL_ASSERT(cmp->valid);
+    const size_t label_size = desc->label ? (strlen(desc->label) + 1) : 0;
+    _sg_vk_compile_job_t* job = (_sg_vk_compile_job_t*)_sg_malloc_clear(sizeof(_sg_vk_compile_job_t) + label_size);
+    job->pip = pip;
+    job->desc = *desc;
+    if (label_size > 0) {
+        char* label = (char*)(job + 1);
+        memcpy(label, desc->label, label_size);
+        job->desc.label = label;
+    }
+    job->state = _SG_VK_COMPILEJOB_QUEUED;
+    pip->vk.job = job;
+    _sg_vk_compiler_lock();
+    if (cmp->tail) {
+        cmp->tail->next = job;
+    } else {
+        cmp->head = job;
+    }
+    cmp->tail = job;
+    cmp->num_busy += 1;
+    _sg_vk_compiler_signal(false);
+    _sg_vk_compiler_unlock();
+}
+
+// remove a job which hasn't started yet, or wait for a running job to finish
+_SOKOL_PRIVATE void _sg_vk_compiler_cancel(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip && pip->vk.job);
+    _sg_vk_compiler_t* cmp = &_sg.vk.compiler;
+    _sg_vk_compile_job_t* job = pip->vk.job;
+    _sg_vk_compiler_lock();
+    if (job->state == _SG_VK_COMPILEJOB_QUEUED) {
+        _sg_vk_compile_job_t* prev = 0;
+        _sg_vk_compile_job_t* cur = cmp->head;
+        while (cur != job) {
+            prev = cur;
+            cur = cur->next;
+        }
+        SOKOL_ASSERT(cur);
+        if (prev) {
+            prev->next = job->next;
+        } else {
+            cmp->head = job->next;
+        }
+        if (cmp->tail == job) {
+            cmp->tail = prev;
+        }
+        cmp->num_busy -= 1;
+    } else {
+        while (job->state != _SG_VK_COMPILEJOB_DONE) {
+            _sg_vk_compiler_wait(true);
+        }
+    }
+    _sg_vk_compiler_unlock();
+    _sg_free(job);
+    pip->vk.job = 0;
+}
+
+// wait until all queued jobs have finished
+_SOKOL_PRIVATE void _sg_vk_compiler_wait_idle(void) {
+    _sg_vk_compiler_t* cmp = &_sg.vk.compiler;
+    if (!cmp->valid) {
+        return;
+    }
+    _sg_vk_compiler_lock();
+    while (cmp->num_busy > 0) {
+        _sg_vk_compiler_wait(true);
+    }
+    _sg_vk_compiler_unlock();
+}
+
+_SOKOL_PRIVATE bool _sg_vk_setup_backend(const sg_desc* desc) {
     SOKOL_ASSERT(desc);
     SOKOL_ASSERT(desc->environment.vulkan.instance);
     SOKOL_ASSERT(desc->environment.vulkan.physical_device);
     SOKOL_ASSERT(desc->environment.vulkan.device);
     SOKOL_ASSERT(desc->environment.vulkan.queue);
     SOKOL_ASSERT(desc->uniform_buffer_size > 0);
+    // frame-sync and staging retirement are built on a timeline semaphore, there's no fallback
+    if (!desc->environment.vulkan.timeline_semaphore) {
+        _SG_ERROR(VULKAN_TIMELINE_SEMAPHORE_NOT_SUPPORTED);
+        return false;
+    }
     _sg.vk.valid = true;
     _sg.vk.instance = (VkInstance) desc->environment.vulkan.instance;
     _sg.vk.phys_dev = (VkPhysicalDevice) desc->environment.vulkan.physical_device;
@@ -20853,27 +28299,44 @@ _SOKOL_PRIVATE void _sg_vk_setup_backend(const sg_desc* desc) {
     _sg_track_init(&_sg.vk.track.buffers, _sg.pools.buffer_pool.size);
     _sg_track_init(&_sg.vk.track.images, _sg.pools.image_pool.size);
     _sg_vk_load_ext_funcs();
-    _sg_vk_init_caps();
-    _sg_vk_create_fences();
+    _sg_vk_init_caps(desc);
+    _sg_vk_timeline_init(&_sg.vk.timeline, "graphics timeline semaphore");
+    _sg_vk_async_compute_init(desc);
     _sg_vk_create_frame_command_pool_and_buffers();
+    #if defined(SOKOL_LOADER_THREADS) && defined(_SG_VK_PTHREADS)
+    pthread_mutex_init(&_sg.vk.queue_mutex, 0);
+    #elif defined(SOKOL_LOADER_THREADS) && defined(_SG_VK_WIN32_THREADS)
+    InitializeSRWLock(&_sg.vk.queue_mutex);
+    #endif
     _sg_vk_staging_copy_init();
     _sg_vk_staging_stream_init();
     _sg_vk_uniform_init();
     _sg_vk_bind_init();
-    _sg_vk_create_delete_queues();
+    _sg_vk_bindless_init(desc);
+    _sg_vk_create_delete_queue();
+    if (desc->parallel_shader_compile) {
+        _sg_vk_compiler_init();
+    }
+    return true;
 }
 
 _SOKOL_PRIVATE void _sg_vk_discard_backend(void) {
     SOKOL_ASSERT(_sg.vk.valid);
     SOKOL_ASSERT(_sg.vk.dev);
+    _sg_vk_compiler_discard();
     vkDeviceWaitIdle(_sg.vk.dev);
-    _sg_vk_destroy_delete_queues();
+    _sg_vk_destroy_delete_queue();
+    _sg_vk_bindless_discard();
     _sg_vk_bind_discard();
     _sg_vk_uniform_discard();
     _sg_vk_staging_stream_discard();
     _sg_vk_staging_copy_discard();
+    #if defined(SOKOL_LOADER_THREADS) && defined(_SG_VK_PTHREADS)
+    pthread_mutex_destroy(&_sg.vk.queue_mutex);
+    #endif
     _sg_vk_destroy_frame_command_pool();
-    _sg_vk_destroy_fences();
+    _sg_vk_async_compute_discard();
+    _sg_vk_timeline_discard(&_sg.vk.timeline);
     _sg_track_discard(&_sg.vk.track.images);
     _sg_track_discard(&_sg.vk.track.buffers);
     _sg.vk.valid = false;
@@ -20899,7 +28362,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_buffer(_sg_buffer_t* buf, const s
     create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     create_info.size = (VkDeviceSize)buf->cmn.size;
     create_info.usage = _sg_vk_buffer_usage(&buf->cmn.usage);
-    create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    _sg_vk_init_buffer_sharing_mode(&create_info);
     res = vkCreateBuffer(_sg.vk.dev, &create_info, 0, &buf->vk.buf);
     if (res != VK_SUCCESS) {
         _SG_ERROR(VULKAN_CREATE_BUFFER_FAILED);
@@ -20917,7 +28380,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_buffer(_sg_buffer_t* buf, const s
         _SG_ERROR(VULKAN_BIND_BUFFER_MEMORY_FAILED);
         return SG_RESOURCESTATE_FAILED;
     }
-    if (buf->cmn.usage.storage_buffer) {
+    if (buf->cmn.usage.storage_buffer || buf->cmn.usage.uniform_buffer) {
         _SG_STRUCT(VkBufferDeviceAddressInfo, addr_info);
         addr_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
         addr_info.buffer = buf->vk.buf;
@@ -20925,7 +28388,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_buffer(_sg_buffer_t* buf, const s
         SOKOL_ASSERT(buf->vk.dev_addr);
     }
     if (buf->cmn.usage.immutable && desc->data.ptr) {
-        _sg_vk_staging_copy_buffer_data(buf, &desc->data, 0, false);
+        _sg_vk_staging_copy_buffer_data(buf, &desc->data, 0);
     }
     return SG_RESOURCESTATE_VALID;
 }
@@ -20968,7 +28431,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_image(_sg_image_t* img, const sg_
     create_info.samples = (VkSampleCountFlagBits)desc->sample_count;
     create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
     create_info.usage = _sg_vk_image_usage(&img->cmn.usage);
-    create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    _sg_vk_init_image_sharing_mode(&create_info);
     create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
     res = vkCreateImage(_sg.vk.dev, &create_info, 0, &img->vk.img);
     if (res != VK_SUCCESS) {
@@ -20988,7 +28451,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_image(_sg_image_t* img, const sg_
         return SG_RESOURCESTATE_FAILED;
     }
     if (img->cmn.usage.immutable && desc->data.mip_levels[0].ptr) {
-        _sg_vk_staging_copy_image_data(img, &desc->data, false);
+        _sg_vk_staging_copy_image_data(img, &desc->data);
     }
     return SG_RESOURCESTATE_VALID;
 }
@@ -21053,11 +28516,19 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_sampler(_sg_sampler_t* smp, const
     get_info.data.pSampler = &smp->vk.smp;
     _sg.vk.ext.get_descriptor(_sg.vk.dev, &get_info, smp->vk.descriptor_size, &smp->vk.descriptor_data);
 
+    // add to the bindless descriptor heap
+    if (_sg.vk.bindless.valid) {
+        smp->vk.bindless_index = _sg_vk_bindless_add(&_sg.vk.bindless.smp_indices, 2, smp->vk.descriptor_data, smp->vk.descriptor_size);
+    }
     return SG_RESOURCESTATE_VALID;
 }
 
 _SOKOL_PRIVATE void _sg_vk_discard_sampler(_sg_sampler_t* smp) {
     SOKOL_ASSERT(smp);
+    if (smp->vk.bindless_index != 0) {
+        _sg_vk_delete_queue_add(_sg_vk_bindless_sampler_index_destructor, (void*)(uintptr_t)smp->vk.bindless_index);
+        smp->vk.bindless_index = 0;
+    }
     if (smp->vk.smp) {
         _sg_vk_delete_queue_add(_sg_vk_sampler_destructor, (void*)smp->vk.smp);
         smp->vk.smp = 0;
@@ -21100,7 +28571,7 @@ _SOKOL_PRIVATE bool _sg_vk_ensure_spirv_bindslot_ranges(const sg_shader_desc* de
     SOKOL_ASSERT(desc);
     for (size_t i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
         const sg_shader_uniform_block* ub = &desc->uniform_blocks[i];
-        if (ub->stage != SG_SHADERSTAGE_NONE) {
+        if ((ub->stage != SG_SHADERSTAGE_NONE) && !ub->spirv_push_constant) {
             if (ub->spirv_set0_binding_n >= _SG_VK_MAX_UB_DESCRIPTORSET_SLOTS) {
                 _SG_ERROR(VULKAN_UNIFORMBLOCK_SPIRV_SET0_BINDING_OUT_OF_RANGE);
                 return false;
@@ -21183,6 +28654,12 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_shader(_sg_shader_t* shd, const s
         if (shd->cmn.uniform_blocks[i].stage == SG_SHADERSTAGE_NONE) {
             continue;
         }
+        if (desc->uniform_blocks[i].spirv_push_constant) {
+            // push-constant blocks don't have a descriptor
+            shd->vk.ub_push_constant[i] = true;
+            shd->vk.push_constant_stages = _sg_vk_shader_stage(shd->cmn.uniform_blocks[i].stage);
+            continue;
+        }
         shd->vk.ub_set0_bnd_n[i] = desc->uniform_blocks[i].spirv_set0_binding_n;
         VkDescriptorSetLayoutBinding* dsl_entry = &dsl_entries[dsl_index];
         dsl_entry->binding = shd->vk.ub_set0_bnd_n[i];
@@ -21208,7 +28685,7 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_shader(_sg_shader_t* shd, const s
         return SG_RESOURCESTATE_FAILED;
     }
     for (size_t i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
-        if (shd->cmn.uniform_blocks[i].stage == SG_SHADERSTAGE_NONE) {
+        if ((shd->cmn.uniform_blocks[i].stage == SG_SHADERSTAGE_NONE) || shd->vk.ub_push_constant[i]) {
             continue;
         }
         const uint8_t vk_bnd = shd->vk.ub_set0_bnd_n[i];
@@ -21287,14 +28764,36 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_shader(_sg_shader_t* shd, const s
         shd->vk.smp_dset_offsets[i] = (uint16_t)dset_offset;
     }
 
-    VkDescriptorSetLayout set_layouts[_SG_VK_NUM_DESCRIPTORSETS] = {
+    // NOTE: the bindless heap layout is owned by the backend, not the shader
+    VkDescriptorSetLayout set_layouts[_SG_VK_NUM_DESCRIPTORSETS + 1] = {
         shd->vk.ub_dsl,
         shd->vk.view_smp_dsl,
+        0,
     };
+    uint32_t num_set_layouts = _SG_VK_NUM_DESCRIPTORSETS;
+    if (desc->spirv_bindless) {
+        SOKOL_ASSERT(_sg.vk.bindless.valid && _sg.vk.bindless.dsl);
+        shd->vk.bindless = true;
+        set_layouts[_SG_VK_BINDLESS_DESCRIPTORSET_INDEX] = _sg.vk.bindless.dsl;
+        num_set_layouts += 1;
+    }
+    _SG_STRUCT(VkPushConstantRange, push_constant_range);
     _SG_STRUCT(VkPipelineLayoutCreateInfo, pl_create_info);
     pl_create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pl_create_info.setLayoutCount = _SG_VK_NUM_DESCRIPTORSETS;
+    pl_create_info.setLayoutCount = num_set_layouts;
     pl_create_info.pSetLayouts = set_layouts;
+    if (shd->vk.push_constant_stages != 0) {
+        // at most one push-constant block per shader, always at offset 0
+        for (size_t i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+            if (shd->vk.ub_push_constant[i]) {
+                push_constant_range.stageFlags = shd->vk.push_constant_stages;
+                push_constant_range.offset = 0;
+                push_constant_range.size = shd->cmn.uniform_blocks[i].size;
+            }
+        }
+        pl_create_info.pushConstantRangeCount = 1;
+        pl_create_info.pPushConstantRanges = &push_constant_range;
+    }
     res = vkCreatePipelineLayout(_sg.vk.dev, &pl_create_info, 0, &shd->vk.pip_layout);
     if (res != VK_SUCCESS) {
         _SG_ERROR(VULKAN_CREATE_PIPELINE_LAYOUT_FAILED);
@@ -21306,6 +28805,8 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_shader(_sg_shader_t* shd, const s
 _SOKOL_PRIVATE void _sg_vk_discard_shader(_sg_shader_t* shd) {
     SOKOL_ASSERT(shd);
     SOKOL_ASSERT(_sg.vk.dev);
+    // the compiler thread may still be using the shader modules and pipeline layout
+    _sg_vk_compiler_wait_idle();
     _sg_vk_discard_shader_func(&shd->vk.vertex_func);
     _sg_vk_discard_shader_func(&shd->vk.fragment_func);
     _sg_vk_discard_shader_func(&shd->vk.compute_func);
@@ -21323,7 +28824,8 @@ _SOKOL_PRIVATE void _sg_vk_discard_shader(_sg_shader_t* shd) {
     }
 }
 
-_SOKOL_PRIVATE sg_resource_state _sg_vk_create_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
+// NOTE: this is called on the compiler thread when compiling in the background
+_SOKOL_PRIVATE sg_resource_state _sg_vk_compile_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(pip && desc);
     SOKOL_ASSERT(_sg.vk.dev);
     VkResult res;
@@ -21522,8 +29024,35 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_pipeline(_sg_pipeline_t* pip, con
     return SG_RESOURCESTATE_VALID;
 }
 
+_SOKOL_PRIVATE sg_resource_state _sg_vk_create_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
+    SOKOL_ASSERT(pip && desc);
+    if (_sg_compile_async()) {
+        _sg_vk_compiler_enqueue(pip, desc);
+        return SG_RESOURCESTATE_ALLOC;
+    }
+    return _sg_vk_compile_pipeline(pip, desc);
+}
+
+_SOKOL_PRIVATE sg_resource_state _sg_vk_poll_pipeline(_sg_pipeline_t* pip) {
+    SOKOL_ASSERT(pip && pip->vk.job);
+    _sg_vk_compile_job_t* job = pip->vk.job;
+    _sg_vk_compiler_lock();
+    const bool done = job->state == _SG_VK_COMPILEJOB_DONE;
+    _sg_vk_compiler_unlock();
+    if (!done) {
+        return SG_RESOURCESTATE_ALLOC;
+    }
+    const sg_resource_state result = job->result;
+    _sg_free(job);
+    pip->vk.job = 0;
+    return result;
+}
+
 _SOKOL_PRIVATE void _sg_vk_discard_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip);
+    if (pip->vk.job) {
+        _sg_vk_compiler_cancel(pip);
+    }
     if (pip->vk.pip) {
         _sg_vk_delete_queue_add(_sg_vk_pipeline_destructor, (void*)pip->vk.pip);
         pip->vk.pip = 0;
@@ -21553,6 +29082,9 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_view(_sg_view_t* view, const sg_v
         get_info.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         get_info.data.pStorageBuffer = &addr_info;
         _sg.vk.ext.get_descriptor(_sg.vk.dev, &get_info, view->vk.descriptor_size, &view->vk.descriptor_data);
+        if (_sg.vk.bindless.valid) {
+            view->vk.bindless_index = _sg_vk_bindless_add(&_sg.vk.bindless.view_indices, 1, view->vk.descriptor_data, view->vk.descriptor_size);
+        }
     } else {
         // create image view object
         const _sg_image_t* img = _sg_image_ref_ptr(&view->cmn.img.ref);
@@ -21610,6 +29142,11 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_view(_sg_view_t* view, const sg_v
                 return SG_RESOURCESTATE_FAILED;
             }
             _sg.vk.ext.get_descriptor(_sg.vk.dev, &get_info, view->vk.descriptor_size, &view->vk.descriptor_data);
+            // NOTE: storage images are not added to the bindless heap (they are
+            // only in GENERAL layout inside compute passes)
+            if (_sg.vk.bindless.valid && (view->cmn.type == SG_VIEWTYPE_TEXTURE)) {
+                view->vk.bindless_index = _sg_vk_bindless_add(&_sg.vk.bindless.view_indices, 0, view->vk.descriptor_data, view->vk.descriptor_size);
+            }
         }
     }
     return SG_RESOURCESTATE_VALID;
@@ -21617,12 +29154,56 @@ _SOKOL_PRIVATE sg_resource_state _sg_vk_create_view(_sg_view_t* view, const sg_v
 
 _SOKOL_PRIVATE void _sg_vk_discard_view(_sg_view_t* view) {
     SOKOL_ASSERT(view);
+    if (view->vk.bindless_index != 0) {
+        _sg_vk_delete_queue_add(_sg_vk_bindless_view_index_destructor, (void*)(uintptr_t)view->vk.bindless_index);
+        view->vk.bindless_index = 0;
+    }
     if (view->vk.img_view) {
         _sg_vk_delete_queue_add(_sg_vk_image_view_destructor, (void*)view->vk.img_view);
         view->vk.img_view = 0;
     }
 }
 
+// the counters of SG_COUNTERTYPE_PIPELINE_STATISTICS queries
+#define _SG_VK_PIPELINE_STATISTICS_FLAGS (\
+    VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |\
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |\
+    VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |\
+    VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT |\
+    VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT)
+
+_SOKOL_PRIVATE sg_resource_state _sg_vk_create_counter(_sg_counter_t* ctr, const sg_counter_desc* desc) {
+    SOKOL_ASSERT(ctr && desc);
+    SOKOL_ASSERT(_sg.vk.dev);
+    SOKOL_ASSERT(0 == ctr->vk.pool);
+    _SG_STRUCT(VkQueryPoolCreateInfo, create_info);
+    create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+        create_info.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        create_info.pipelineStatistics = _SG_VK_PIPELINE_STATISTICS_FLAGS;
+    } else {
+        create_info.queryType = VK_QUERY_TYPE_OCCLUSION;
+    }
+    create_info.queryCount = SG_NUM_INFLIGHT_FRAMES;
+    VkResult res = vkCreateQueryPool(_sg.vk.dev, &create_info, 0, &ctr->vk.pool);
+    if (res != VK_SUCCESS) {
+        _SG_ERROR(VULKAN_CREATE_QUERY_POOL_FAILED);
+        return SG_RESOURCESTATE_FAILED;
+    }
+    SOKOL_ASSERT(ctr->vk.pool);
+    _sg_vk_set_object_label(VK_OBJECT_TYPE_QUERY_POOL, (uint64_t)ctr->vk.pool, desc->label);
+    vkResetQueryPool(_sg.vk.dev, ctr->vk.pool, 0, SG_NUM_INFLIGHT_FRAMES);
+    return SG_RESOURCESTATE_VALID;
+}
+
+_SOKOL_PRIVATE void _sg_vk_discard_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr);
+    if (ctr->vk.pool) {
+        _sg_vk_delete_queue_add(_sg_vk_query_pool_destructor, (void*)ctr->vk.pool);
+        ctr->vk.pool = 0;
+    }
+}
+
 _SOKOL_PRIVATE void _sg_vk_apply_viewport(int x, int y, int w, int h, bool origin_top_left) {
     SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
     _SG_STRUCT(VkViewport, vp);
@@ -21751,6 +29332,10 @@ _SOKOL_PRIVATE void _sg_vk_begin_render_pass(VkCommandBuffer cmd_buf, const sg_p
                 vk_resolve_view = resolve_view->vk.img_view;
             }
             _sg_vk_init_color_attachment_info(&color_att_infos[i], &action->colors[i], vk_color_view, vk_resolve_view);
+            const _sg_image_t* color_image = _sg_image_ref_ptr(&color_view->cmn.img.ref);
+            if (color_image->cmn.usage.transient_attachment) {
+                color_att_infos[i].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            }
         }
         if (atts->num_color_views > 0) {
             render_info.colorAttachmentCount = (uint32_t)atts->num_color_views;
@@ -21762,9 +29347,15 @@ _SOKOL_PRIVATE void _sg_vk_begin_render_pass(VkCommandBuffer cmd_buf, const sg_p
             const bool has_stencil = _sg_is_depth_stencil_format(ds_image->cmn.pixel_format);
             VkImageView vk_ds_view = ds_view->vk.img_view;
             _sg_vk_init_depth_attachment_info(&depth_att_info, &action->depth, vk_ds_view);
+            if (ds_image->cmn.usage.transient_attachment) {
+                depth_att_info.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            }
             render_info.pDepthAttachment = &depth_att_info;
             if (has_stencil) {
                 _sg_vk_init_stencil_attachment_info(&stencil_att_info, &action->stencil, vk_ds_view);
+                if (ds_image->cmn.usage.transient_attachment) {
+                    stencil_att_info.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+                }
                 render_info.pStencilAttachment = &stencil_att_info;
             }
         }
@@ -21788,6 +29379,18 @@ _SOKOL_PRIVATE void _sg_vk_begin_pass(const sg_pass* pass, const _sg_attachments
     SOKOL_ASSERT(pass && atts);
     _sg_vk_acquire_frame_command_buffers();
     SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    if (_sg.vk.compute.valid) {
+        if (_sg.cur_pass.is_compute && pass->async_compute) {
+            _sg_vk_async_compute_begin_pass();
+        } else {
+            _sg_vk_maybe_split_frame_command_buffer();
+            if (!_sg.cur_pass.is_compute && atts->empty && !_sg.vk.frame.swapchain_segment_valid) {
+                _sg.vk.frame.swapchain_segment_valid = true;
+                _sg.vk.frame.swapchain_segment = _sg.vk.frame.num_segments - 1;
+            }
+            _sg_vk_async_compute_track_attachments(atts);
+        }
+    }
     _sg_vk_barrier_on_begin_pass(_sg.vk.frame.cmd_buf, pass, atts, _sg.cur_pass.is_compute);
     if (_sg.cur_pass.is_compute) {
         _sg_vk_begin_compute_pass(_sg.vk.frame.cmd_buf, pass);
@@ -21803,6 +29406,9 @@ _SOKOL_PRIVATE void _sg_vk_end_pass(const _sg_attachments_ptrs_t* atts) {
         vkCmdEndRendering(_sg.vk.frame.cmd_buf);
     }
     _sg_vk_barrier_on_end_pass(_sg.vk.frame.cmd_buf, atts, _sg.cur_pass.is_compute);
+    if (_sg.vk.compute.recording) {
+        _sg_vk_async_compute_end_pass();
+    }
     _sg_clear(&_sg.vk.swapchain, sizeof(_sg.vk.swapchain));
 }
 
@@ -21811,6 +29417,7 @@ _SOKOL_PRIVATE void _sg_vk_commit(void) {
     if (_sg.vk.frame.cmd_buf) {
         _sg_vk_submit_frame_command_buffers();
     }
+    _sg_vk_staging_copy_update_stats();
     _sg.vk.present_complete_sem = 0;
     _sg.vk.render_finished_sem = 0;
 }
@@ -21820,10 +29427,19 @@ _SOKOL_PRIVATE void _sg_vk_apply_pipeline(_sg_pipeline_t* pip) {
     SOKOL_ASSERT(pip->vk.pip);
     SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
     _sg.vk.uniforms.dirty = false;
+    // the uniform descriptor cache layout depends on the shader, forget the bound ranges
+    for (size_t i = 0; i < SG_MAX_UNIFORMBLOCK_BINDSLOTS; i++) {
+        _sg.vk.uniforms.addr_info[i].address = 0;
+        _sg.vk.uniforms.addr_info[i].range = 0;
+    }
     VkPipelineBindPoint bindpoint = pip->cmn.is_compute
         ? VK_PIPELINE_BIND_POINT_COMPUTE
         : VK_PIPELINE_BIND_POINT_GRAPHICS;
     vkCmdBindPipeline(_sg.vk.frame.cmd_buf, bindpoint, pip->vk.pip);
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    if (shd->vk.bindless) {
+        _sg_vk_bindless_bind_heap(_sg.vk.frame.cmd_buf, shd, bindpoint);
+    }
 }
 
 _SOKOL_PRIVATE bool _sg_vk_apply_bindings(_sg_bindings_ptrs_t* bnd) {
@@ -21834,6 +29450,7 @@ _SOKOL_PRIVATE bool _sg_vk_apply_bindings(_sg_bindings_ptrs_t* bnd) {
 
     // track or insert pipeline barriers
     _sg_vk_barrier_on_apply_bindings(cmd_buf, bnd, _sg.cur_pass.is_compute);
+    _sg_vk_async_compute_track_bindings(bnd);
 
     if (!_sg.cur_pass.is_compute) {
         // bind vertex buffers
@@ -21862,6 +29479,24 @@ _SOKOL_PRIVATE bool _sg_vk_apply_bindings(_sg_bindings_ptrs_t* bnd) {
     return _sg_vk_bind_view_smp_descriptor_set(cmd_buf, bnd, pip_bind_point);
 }
 
+// point the uniform block descriptor of a ub_slot at a range in a buffer
+_SOKOL_PRIVATE void _sg_vk_update_uniform_descriptor(const _sg_shader_t* shd, int ub_slot, VkDeviceAddress addr, size_t size) {
+    _sg.vk.uniforms.addr_info[ub_slot].range = size;
+    _sg.vk.uniforms.addr_info[ub_slot].address = addr;
+
+    // copy uniform buffer descriptor data into intermediate sysmem buffer
+    // NOTE: letting vkGetDescriptorEXT write directly into the descriptor
+    // buffer has catastrophic performance on some Vulkan drivers, notably
+    // Intel's Windows driver
+    const size_t dsize = _sg.vk.descriptor_buffer_props.uniformBufferDescriptorSize;
+    SOKOL_ASSERT((shd->vk.ub_dset_offsets[ub_slot] + dsize) <= _sg.vk.uniforms.dset_cache_size);
+    uint8_t* dst_ptr = _sg.vk.uniforms.dset_cache + shd->vk.ub_dset_offsets[ub_slot];
+    _sg.vk.ext.get_descriptor(_sg.vk.dev, &_sg.vk.uniforms.get_info[ub_slot], dsize, dst_ptr);
+
+    // set uniforms dirty, applying the descriptor buffer offset is happens in draw/dispatch
+    _sg.vk.uniforms.dirty = true;
+}
+
 _SOKOL_PRIVATE void _sg_vk_apply_uniforms(int ub_slot, const sg_range* data) {
     SOKOL_ASSERT(_sg.vk.uniforms.dbuf.cur_dev_addr);
     SOKOL_ASSERT(data && data->ptr && (data->size > 0));
@@ -21870,6 +29505,16 @@ _SOKOL_PRIVATE void _sg_vk_apply_uniforms(int ub_slot, const sg_range* data) {
     const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
     SOKOL_ASSERT(data->size == shd->cmn.uniform_blocks[ub_slot].size);
 
+    // push-constant blocks skip the uniform buffer and descriptor update
+    if (shd->vk.ub_push_constant[ub_slot]) {
+        SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+        SOKOL_ASSERT(shd->vk.pip_layout && (shd->vk.push_constant_stages != 0));
+        vkCmdPushConstants(_sg.vk.frame.cmd_buf, shd->vk.pip_layout, shd->vk.push_constant_stages, 0, (uint32_t)data->size, data->ptr);
+        _sg_stats_inc(vk.num_cmd_push_constants);
+        _sg_stats_add(vk.size_push_constants, (uint32_t)data->size);
+        return;
+    }
+
     // copy data into uniform buffer and keep track of uniform bind infos
     const VkDeviceSize ubuf_offset = _sg_vk_uniform_copy(data);
     if (_sg.vk.uniforms.dbuf.overflown) {
@@ -21877,20 +29522,44 @@ _SOKOL_PRIVATE void _sg_vk_apply_uniforms(int ub_slot, const sg_range* data) {
         _sg.next_draw_valid = false;
         return;
     }
-    _sg.vk.uniforms.addr_info[ub_slot].range = data->size;
-    _sg.vk.uniforms.addr_info[ub_slot].address = _sg.vk.uniforms.dbuf.cur_dev_addr + ubuf_offset;
+    _sg_vk_update_uniform_descriptor(shd, ub_slot, _sg.vk.uniforms.dbuf.cur_dev_addr + ubuf_offset, data->size);
+}
 
-    // copy uniform buffer descriptor data into intermediate sysmem buffer
-    // NOTE: letting vkGetDescriptorEXT write directly into the descriptor
-    // buffer has catastrophic performance on some Vulkan drivers, notably
-    // Intel's Windows driver
-    const size_t dsize = _sg.vk.descriptor_buffer_props.uniformBufferDescriptorSize;
-    SOKOL_ASSERT((shd->vk.ub_dset_offsets[ub_slot] + dsize) <= _sg.vk.uniforms.dset_cache_size);
-    uint8_t* dst_ptr = _sg.vk.uniforms.dset_cache + shd->vk.ub_dset_offsets[ub_slot];
-    _sg.vk.ext.get_descriptor(_sg.vk.dev, &_sg.vk.uniforms.get_info[ub_slot], dsize, dst_ptr);
+_SOKOL_PRIVATE void _sg_vk_apply_uniform_buffer(int ub_slot, _sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    SOKOL_ASSERT(buf && buf->vk.dev_addr && (offset >= 0));
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(&_sg.cur_pip);
+    const _sg_shader_t* shd = _sg_shader_ref_ptr(&pip->cmn.shader);
+    SOKOL_ASSERT(!shd->vk.ub_push_constant[ub_slot]);
 
-    // set uniforms dirty, applying the descriptor buffer offset is happens in draw/dispatch
-    _sg.vk.uniforms.dirty = true;
+    // no transitions allowed in render passes, buffers written by a compute
+    // pass have been transitioned into uniform-buffer access at the end of that pass,
+    // a buffer which has never been written has nothing to synchronize with
+    if (_sg.cur_pass.is_compute) {
+        _sg_vk_buffer_barrier(_sg.vk.frame.cmd_buf, buf, _SG_VK_ACCESS_UNIFORMBUFFER);
+        _sg_track_add(&_sg.vk.track.buffers, buf->slot.id);
+    } else if ((buf->vk.cur_access != _SG_VK_ACCESS_NONE) && (0 == (buf->vk.cur_access & _SG_VK_ACCESS_UNIFORMBUFFER))) {
+        _SG_ERROR(VULKAN_UNIFORM_BUFFER_ACCESS);
+        _sg.next_draw_valid = false;
+        return;
+    }
+    if (_sg.vk.compute.valid) {
+        _sg_vk_async_compute_track(&buf->vk.async_compute_value);
+    }
+
+    // no data copy, only the uniform buffer descriptor is pointed at the buffer range,
+    // and if the same range is already bound, the descriptor doesn't change at all
+    //
+    // NOTE: descriptor set layouts for VK_EXT_descriptor_buffer cannot contain
+    // dynamic uniform buffer descriptors, so there are no dynamic offsets,
+    // a changed offset always means a new descriptor
+    const size_t size = (size_t)shd->cmn.uniform_blocks[ub_slot].size;
+    const VkDeviceAddress addr = buf->vk.dev_addr + (VkDeviceSize)offset;
+    if ((_sg.vk.uniforms.addr_info[ub_slot].address == addr) && (_sg.vk.uniforms.addr_info[ub_slot].range == size)) {
+        return;
+    }
+    _sg_vk_update_uniform_descriptor(shd, ub_slot, addr, size);
 }
 
 _SOKOL_PRIVATE void _sg_vk_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance) {
@@ -21917,6 +29586,42 @@ _SOKOL_PRIVATE void _sg_vk_draw(int base_element, int num_elements, int num_inst
     }
 }
 
+_SOKOL_PRIVATE void _sg_vk_draw_batch(const sg_draw_args* args, int count) {
+    SOKOL_ASSERT(args && (count > 0));
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    VkCommandBuffer cmd_buf = _sg.vk.frame.cmd_buf;
+    if (_sg.vk.uniforms.dirty) {
+        if (!_sg_vk_bind_uniform_descriptor_set(cmd_buf)) {
+            return;
+        }
+    }
+    // NOTE: the uniform descriptor set only needs to be bound once for the whole batch
+    if (_sg.use_indexed_draw) {
+        for (int i = 0; i < count; i++) {
+            const sg_draw_args* a = &args[i];
+            if ((a->num_elements > 0) && (a->num_instances > 0)) {
+                vkCmdDrawIndexed(cmd_buf,
+                    (uint32_t)a->num_elements,
+                    (uint32_t)a->num_instances,
+                    (uint32_t)a->base_element,
+                    a->base_vertex,
+                    (uint32_t)a->base_instance);
+            }
+        }
+    } else {
+        for (int i = 0; i < count; i++) {
+            const sg_draw_args* a = &args[i];
+            if ((a->num_elements > 0) && (a->num_instances > 0)) {
+                vkCmdDraw(cmd_buf,
+                    (uint32_t)a->num_elements,
+                    (uint32_t)a->num_instances,
+                    (uint32_t)a->base_element,
+                    (uint32_t)a->base_instance);
+            }
+        }
+    }
+}
+
 _SOKOL_PRIVATE void _sg_vk_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
     VkCommandBuffer cmd_buf = _sg.vk.frame.cmd_buf;
@@ -21928,13 +29633,105 @@ _SOKOL_PRIVATE void _sg_vk_dispatch(int num_groups_x, int num_groups_y, int num_
     vkCmdDispatch(cmd_buf, (uint32_t)num_groups_x, (uint32_t)num_groups_y, (uint32_t)num_groups_z);
 }
 
+_SOKOL_PRIVATE void _sg_vk_dispatch_indirect(_sg_buffer_t* buf, int offset) {
+    SOKOL_ASSERT(buf && buf->vk.buf);
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    VkCommandBuffer cmd_buf = _sg.vk.frame.cmd_buf;
+    if (_sg.vk.uniforms.dirty) {
+        if (!_sg_vk_bind_uniform_descriptor_set(cmd_buf)) {
+            return;
+        }
+    }
+    _sg_vk_barrier_on_dispatch_indirect(cmd_buf, buf);
+    if (_sg.vk.compute.valid) {
+        _sg_vk_async_compute_track(&buf->vk.async_compute_value);
+    }
+    vkCmdDispatchIndirect(cmd_buf, buf->vk.buf, (VkDeviceSize)offset);
+}
+
+// read back the query slots from oldest to newest once the graphics timeline
+// has passed the frame they were recorded in, this never stalls
+_SOKOL_PRIVATE void _sg_vk_counter_result(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr && ctr->vk.pool);
+    SOKOL_ASSERT(_sg.vk.dev);
+    for (int i = 0; i < SG_NUM_INFLIGHT_FRAMES; i++) {
+        const int slot = (ctr->vk.cur_slot + i) % SG_NUM_INFLIGHT_FRAMES;
+        if (!ctr->vk.pending[slot]) {
+            continue;
+        }
+        if (!_sg_vk_frame_completed(ctr->vk.frame_index[slot])) {
+            // not submitted yet or still in flight
+            break;
+        }
+        // the results are followed by the availability value, pipeline statistics are
+        // written in the order of the VkQueryPipelineStatisticFlagBits bits:
+        // vertex shader invocations, clipping invocations, clipping primitives,
+        // fragment shader invocations, compute shader invocations
+        const int num_values = (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) ? 5 : 1;
+        uint64_t data[6] = { 0, 0, 0, 0, 0, 0 };
+        VkResult res = vkGetQueryPoolResults(_sg.vk.dev,
+            ctr->vk.pool,
+            (uint32_t)slot,
+            1,
+            sizeof(data),
+            data,
+            sizeof(data),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (((res != VK_SUCCESS) && (res != VK_NOT_READY)) || (0 == data[num_values])) {
+            break;
+        }
+        ctr->vk.pending[slot] = false;
+        ctr->cmn.result.available = true;
+        ctr->cmn.result.frame_index = ctr->vk.frame_index[slot];
+        if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+            sg_pipeline_stats* ps = &ctr->cmn.result.pipeline_stats;
+            ps->vertex_invocations = data[0];
+            ps->clipping_input_primitives = data[1];
+            ps->clipping_output_primitives = data[2];
+            ps->fragment_invocations = data[3];
+            ps->compute_invocations = data[4];
+        } else {
+            ctr->cmn.result.samples_passed = data[0];
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_vk_begin_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr && ctr->vk.pool);
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    // a query is used at most once per frame, so the previous recording into
+    // this slot is SG_NUM_INFLIGHT_FRAMES old and has finished on the GPU
+    _sg_vk_counter_result(ctr);
+    if (_sg.vk.compute.recording) {
+        // not supported on the async compute queue, skipped in _sg_vk_end_counter() too
+        return;
+    }
+    const int slot = ctr->vk.cur_slot;
+    ctr->vk.pending[slot] = false;
+    vkResetQueryPool(_sg.vk.dev, ctr->vk.pool, (uint32_t)slot, 1);
+    vkCmdBeginQuery(_sg.vk.frame.cmd_buf, ctr->vk.pool, (uint32_t)slot, 0);
+}
+
+_SOKOL_PRIVATE void _sg_vk_end_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr && ctr->vk.pool);
+    SOKOL_ASSERT(_sg.vk.frame.cmd_buf);
+    if (_sg.vk.compute.recording) {
+        return;
+    }
+    const int slot = ctr->vk.cur_slot;
+    vkCmdEndQuery(_sg.vk.frame.cmd_buf, ctr->vk.pool, (uint32_t)slot);
+    ctr->vk.pending[slot] = true;
+    ctr->vk.frame_index[slot] = _sg.frame_index;
+    ctr->vk.cur_slot = (slot + 1) % SG_NUM_INFLIGHT_FRAMES;
+}
+
 _SOKOL_PRIVATE void _sg_vk_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     SOKOL_ASSERT(buf && data && data->ptr && (data->size > 0));
     if (buf->cmn.usage.stream_update) {
         _sg_vk_acquire_frame_command_buffers();
         _sg_vk_staging_stream_buffer_data(buf, data, 0);
     } else {
-        _sg_vk_staging_copy_buffer_data(buf, data, 0, true);
+        _sg_vk_staging_copy_buffer_data(buf, data, 0);
     }
 }
 
@@ -21945,7 +29742,7 @@ _SOKOL_PRIVATE void _sg_vk_append_buffer(_sg_buffer_t* buf, const sg_range* data
         _sg_vk_acquire_frame_command_buffers();
         _sg_vk_staging_stream_buffer_data(buf, data, (size_t)buf->cmn.append_pos);
     } else {
-        _sg_vk_staging_copy_buffer_data(buf, data, (size_t)buf->cmn.append_pos, true);
+        _sg_vk_staging_copy_buffer_data(buf, data, (size_t)buf->cmn.append_pos);
     }
 }
 
@@ -21955,7 +29752,7 @@ _SOKOL_PRIVATE void _sg_vk_update_image(_sg_image_t* img, const sg_image_data* d
         _sg_vk_acquire_frame_command_buffers();
         _sg_vk_staging_stream_image_data(img, data);
     } else {
-        _sg_vk_staging_copy_image_data(img, data, true);
+        _sg_vk_staging_copy_image_data(img, data);
     }
 }
 
@@ -21968,7 +29765,8 @@ _SOKOL_PRIVATE void _sg_vk_update_image(_sg_image_t* img, const sg_image_data* d
 //  ██████  ███████ ██   ████ ███████ ██   ██ ██  ██████     ██████  ██   ██  ██████ ██   ██ ███████ ██   ████ ██████
 //
 // >>generic backend
-static inline void _sg_setup_backend(const sg_desc* desc) {
+// returns false if the backend can't be used with the provided environment
+static inline bool _sg_setup_backend(const sg_desc* desc) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_setup_backend(desc);
     #elif defined(SOKOL_METAL)
@@ -21978,12 +29776,17 @@ static inline void _sg_setup_backend(const sg_desc* desc) {
     #elif defined(SOKOL_WGPU)
     _sg_wgpu_setup_backend(desc);
     #elif defined(SOKOL_VULKAN)
-    _sg_vk_setup_backend(desc);
+    return _sg_vk_setup_backend(desc);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_setup_backend(desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_setup_backend(desc);
     #else
     #error("INVALID BACKEND");
     #endif
+    #if !defined(SOKOL_VULKAN)
+    return true;
+    #endif
 }
 
 static inline void _sg_discard_backend(void) {
@@ -21997,6 +29800,8 @@ static inline void _sg_discard_backend(void) {
     _sg_wgpu_discard_backend();
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_backend();
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_backend();
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_backend();
     #else
@@ -22015,6 +29820,8 @@ static inline void _sg_reset_state_cache(void) {
     _sg_wgpu_reset_state_cache();
     #elif defined(SOKOL_VULKAN)
     _sg_vk_reset_state_cache();
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_reset_state_cache();
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_reset_state_cache();
     #else
@@ -22033,6 +29840,8 @@ static inline sg_resource_state _sg_create_buffer(_sg_buffer_t* buf, const sg_bu
     return _sg_wgpu_create_buffer(buf, desc);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_create_buffer(buf, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_buffer(buf, desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_create_buffer(buf, desc);
     #else
@@ -22051,6 +29860,8 @@ static inline void _sg_discard_buffer(_sg_buffer_t* buf) {
     _sg_wgpu_discard_buffer(buf);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_buffer(buf);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_buffer(buf);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_buffer(buf);
     #else
@@ -22069,6 +29880,8 @@ static inline sg_resource_state _sg_create_image(_sg_image_t* img, const sg_imag
     return _sg_wgpu_create_image(img, desc);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_create_image(img, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_image(img, desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_create_image(img, desc);
     #else
@@ -22087,6 +29900,8 @@ static inline void _sg_discard_image(_sg_image_t* img) {
     _sg_wgpu_discard_image(img);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_image(img);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_image(img);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_image(img);
     #else
@@ -22105,6 +29920,8 @@ static inline sg_resource_state _sg_create_sampler(_sg_sampler_t* smp, const sg_
     return _sg_wgpu_create_sampler(smp, desc);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_create_sampler(smp, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_sampler(smp, desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_create_sampler(smp, desc);
     #else
@@ -22123,6 +29940,8 @@ static inline void _sg_discard_sampler(_sg_sampler_t* smp) {
     _sg_wgpu_discard_sampler(smp);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_sampler(smp);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_sampler(smp);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_sampler(smp);
     #else
@@ -22141,6 +29960,8 @@ static inline sg_resource_state _sg_create_shader(_sg_shader_t* shd, const sg_sh
     return _sg_wgpu_create_shader(shd, desc);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_create_shader(shd, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_shader(shd, desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_create_shader(shd, desc);
     #else
@@ -22159,6 +29980,8 @@ static inline void _sg_discard_shader(_sg_shader_t* shd) {
     _sg_wgpu_discard_shader(shd);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_shader(shd);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_shader(shd);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_shader(shd);
     #else
@@ -22177,6 +30000,8 @@ static inline sg_resource_state _sg_create_pipeline(_sg_pipeline_t* pip, const s
     return _sg_wgpu_create_pipeline(pip, desc);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_create_pipeline(pip, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_pipeline(pip, desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_create_pipeline(pip, desc);
     #else
@@ -22195,6 +30020,8 @@ static inline void _sg_discard_pipeline(_sg_pipeline_t* pip) {
     _sg_wgpu_discard_pipeline(pip);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_pipeline(pip);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_pipeline(pip);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_pipeline(pip);
     #else
@@ -22202,6 +30029,36 @@ static inline void _sg_discard_pipeline(_sg_pipeline_t* pip) {
     #endif
 }
 
+// check if a shader which compiles in the background has finished, returns ALLOC while still compiling
+static inline sg_resource_state _sg_poll_shader(_sg_shader_t* shd) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_poll_shader(shd);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_poll_shader(shd);
+    #else
+    // shaders are never compiled in the background on other backends
+    _SOKOL_UNUSED(shd);
+    SOKOL_UNREACHABLE;
+    return SG_RESOURCESTATE_FAILED;
+    #endif
+}
+
+// check if a pipeline which compiles in the background has finished, returns ALLOC while still compiling
+static inline sg_resource_state _sg_poll_pipeline(_sg_pipeline_t* pip) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_poll_pipeline(pip);
+    #elif defined(SOKOL_VULKAN)
+    return _sg_vk_poll_pipeline(pip);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_poll_pipeline(pip);
+    #else
+    // pipelines are never compiled in the background on other backends
+    _SOKOL_UNUSED(pip);
+    SOKOL_UNREACHABLE;
+    return SG_RESOURCESTATE_FAILED;
+    #endif
+}
+
 static inline sg_resource_state _sg_create_view(_sg_view_t* view, const sg_view_desc* desc) {
     #if defined(_SOKOL_ANY_GL)
     return _sg_gl_create_view(view, desc);
@@ -22213,6 +30070,8 @@ static inline sg_resource_state _sg_create_view(_sg_view_t* view, const sg_view_
     return _sg_wgpu_create_view(view, desc);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_create_view(view, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_view(view, desc);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_create_view(view, desc);
     #else
@@ -22231,6 +30090,8 @@ static inline void _sg_discard_view(_sg_view_t* view) {
     _sg_wgpu_discard_view(view);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_discard_view(view);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_view(view);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_discard_view(view);
     #else
@@ -22238,6 +30099,38 @@ static inline void _sg_discard_view(_sg_view_t* view) {
     #endif
 }
 
+static inline sg_resource_state _sg_create_counter(_sg_counter_t* ctr, const sg_counter_desc* desc) {
+    #if defined(_SOKOL_ANY_GL)
+    return _sg_gl_create_counter(ctr, desc);
+    #elif defined(SOKOL_VULKAN)
+    return _sg_vk_create_counter(ctr, desc);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_create_counter(ctr, desc);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    return _sg_dummy_create_counter(ctr, desc);
+    #else
+    // not supported, rejected by validation (sg_features.occlusion_counter)
+    _SOKOL_UNUSED(ctr);
+    _SOKOL_UNUSED(desc);
+    return SG_RESOURCESTATE_FAILED;
+    #endif
+}
+
+static inline void _sg_discard_counter(_sg_counter_t* ctr) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_discard_counter(ctr);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_discard_counter(ctr);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_discard_counter(ctr);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_discard_counter(ctr);
+    #else
+    // nothing to discard, query creation always fails (sg_features.occlusion_counter)
+    _SOKOL_UNUSED(ctr);
+    #endif
+}
+
 static inline void _sg_begin_pass(const sg_pass* pass, const _sg_attachments_ptrs_t* atts) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_begin_pass(pass, atts);
@@ -22249,6 +30142,8 @@ static inline void _sg_begin_pass(const sg_pass* pass, const _sg_attachments_ptr
     _sg_wgpu_begin_pass(pass, atts);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_begin_pass(pass, atts);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_begin_pass(pass, atts);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_begin_pass(pass, atts);
     #else
@@ -22267,6 +30162,8 @@ static inline void _sg_end_pass(const _sg_attachments_ptrs_t* atts) {
     _sg_wgpu_end_pass(atts);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_end_pass(atts);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_end_pass(atts);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_end_pass(atts);
     #else
@@ -22285,6 +30182,8 @@ static inline void _sg_apply_viewport(int x, int y, int w, int h, bool origin_to
     _sg_wgpu_apply_viewport(x, y, w, h, origin_top_left);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_apply_viewport(x, y, w, h, origin_top_left);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_apply_viewport(x, y, w, h, origin_top_left);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_apply_viewport(x, y, w, h, origin_top_left);
     #else
@@ -22303,6 +30202,8 @@ static inline void _sg_apply_scissor_rect(int x, int y, int w, int h, bool origi
     _sg_wgpu_apply_scissor_rect(x, y, w, h, origin_top_left);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_apply_scissor_rect(x, y, w, h, origin_top_left);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_apply_scissor_rect(x, y, w, h, origin_top_left);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_apply_scissor_rect(x, y, w, h, origin_top_left);
     #else
@@ -22321,6 +30222,8 @@ static inline void _sg_apply_pipeline(_sg_pipeline_t* pip) {
     _sg_wgpu_apply_pipeline(pip);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_apply_pipeline(pip);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_apply_pipeline(pip);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_apply_pipeline(pip);
     #else
@@ -22339,6 +30242,8 @@ static inline bool _sg_apply_bindings(_sg_bindings_ptrs_t* bnd) {
     return _sg_wgpu_apply_bindings(bnd);
     #elif defined(SOKOL_VULKAN)
     return _sg_vk_apply_bindings(bnd);
+    #elif defined(SOKOL_SOFTWARE)
+    return _sg_sw_apply_bindings(bnd);
     #elif defined(SOKOL_DUMMY_BACKEND)
     return _sg_dummy_apply_bindings(bnd);
     #else
@@ -22357,6 +30262,8 @@ static inline void _sg_apply_uniforms(int ub_slot, const sg_range* data) {
     _sg_wgpu_apply_uniforms(ub_slot, data);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_apply_uniforms(ub_slot, data);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_apply_uniforms(ub_slot, data);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_apply_uniforms(ub_slot, data);
     #else
@@ -22364,6 +30271,25 @@ static inline void _sg_apply_uniforms(int ub_slot, const sg_range* data) {
     #endif
 }
 
+static inline void _sg_apply_uniform_buffer(int ub_slot, _sg_buffer_t* buf, int offset) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_apply_uniform_buffer(ub_slot, buf, offset);
+    #elif defined(SOKOL_METAL)
+    _sg_mtl_apply_uniform_buffer(ub_slot, buf, offset);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_apply_uniform_buffer(ub_slot, buf, offset);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_apply_uniform_buffer(ub_slot, buf, offset);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_apply_uniform_buffer(ub_slot, buf, offset);
+    #else
+    // not supported, rejected by validation (sg_features.uniform_buffer_bindings)
+    _SOKOL_UNUSED(ub_slot);
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+    #endif
+}
+
 static inline void _sg_draw(int base_element, int num_elements, int num_instances, int base_vertex, int base_index) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_draw(base_element, num_elements, num_instances, base_vertex, base_index);
@@ -22375,6 +30301,8 @@ static inline void _sg_draw(int base_element, int num_elements, int num_instance
     _sg_wgpu_draw(base_element, num_elements, num_instances, base_vertex, base_index);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_draw(base_element, num_elements, num_instances, base_vertex, base_index);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_draw(base_element, num_elements, num_instances, base_vertex, base_index);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_draw(base_element, num_elements, num_instances, base_vertex, base_index);
     #else
@@ -22382,6 +30310,21 @@ static inline void _sg_draw(int base_element, int num_elements, int num_instance
     #endif
 }
 
+static inline void _sg_draw_batch(const sg_draw_args* args, int count) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_draw_batch(args, count);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_draw_batch(args, count);
+    #else
+    for (int i = 0; i < count; i++) {
+        const sg_draw_args* a = &args[i];
+        if ((a->num_elements > 0) && (a->num_instances > 0)) {
+            _sg_draw(a->base_element, a->num_elements, a->num_instances, a->base_vertex, a->base_instance);
+        }
+    }
+    #endif
+}
+
 static inline void _sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_dispatch(num_groups_x, num_groups_y, num_groups_z);
@@ -22393,6 +30336,8 @@ static inline void _sg_dispatch(int num_groups_x, int num_groups_y, int num_grou
     _sg_wgpu_dispatch(num_groups_x, num_groups_y, num_groups_z);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_dispatch(num_groups_x, num_groups_y, num_groups_z);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_dispatch(num_groups_x, num_groups_y, num_groups_z);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_dispatch(num_groups_x, num_groups_y, num_groups_z);
     #else
@@ -22400,6 +30345,67 @@ static inline void _sg_dispatch(int num_groups_x, int num_groups_y, int num_grou
     #endif
 }
 
+static inline void _sg_dispatch_indirect(_sg_buffer_t* buf, int offset) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_dispatch_indirect(buf, offset);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_dispatch_indirect(buf, offset);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_dispatch_indirect(buf, offset);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_dispatch_indirect(buf, offset);
+    #else
+    // not supported, rejected by validation (sg_features.dispatch_indirect)
+    _SOKOL_UNUSED(buf);
+    _SOKOL_UNUSED(offset);
+    #endif
+}
+
+static inline void _sg_begin_counter(_sg_counter_t* ctr) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_begin_counter(ctr);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_begin_counter(ctr);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_begin_counter(ctr);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_begin_counter(ctr);
+    #else
+    // not supported, rejected by validation (sg_features.occlusion_counter)
+    _SOKOL_UNUSED(ctr);
+    #endif
+}
+
+static inline void _sg_end_counter(_sg_counter_t* ctr) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_end_counter(ctr);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_end_counter(ctr);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_end_counter(ctr);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_end_counter(ctr);
+    #else
+    // not supported, rejected by validation (sg_features.occlusion_counter)
+    _SOKOL_UNUSED(ctr);
+    #endif
+}
+
+static inline void _sg_counter_result(_sg_counter_t* ctr) {
+    #if defined(_SOKOL_ANY_GL)
+    _sg_gl_counter_result(ctr);
+    #elif defined(SOKOL_VULKAN)
+    _sg_vk_counter_result(ctr);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_counter_result(ctr);
+    #elif defined(SOKOL_DUMMY_BACKEND)
+    _sg_dummy_counter_result(ctr);
+    #else
+    // not supported, rejected by validation (sg_features.occlusion_counter)
+    _SOKOL_UNUSED(ctr);
+    #endif
+}
+
 static inline void _sg_commit(void) {
     #if defined(_SOKOL_ANY_GL)
     _sg_gl_commit();
@@ -22411,6 +30417,8 @@ static inline void _sg_commit(void) {
     _sg_wgpu_commit();
     #elif defined(SOKOL_VULKAN)
     _sg_vk_commit();
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_commit();
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_commit();
     #else
@@ -22429,6 +30437,8 @@ static inline void _sg_update_buffer(_sg_buffer_t* buf, const sg_range* data) {
     _sg_wgpu_update_buffer(buf, data);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_update_buffer(buf, data);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_update_buffer(buf, data);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_update_buffer(buf, data);
     #else
@@ -22447,6 +30457,8 @@ static inline void _sg_append_buffer(_sg_buffer_t* buf, const sg_range* data, bo
     _sg_wgpu_append_buffer(buf, data, new_frame);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_append_buffer(buf, data, new_frame);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_append_buffer(buf, data, new_frame);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_append_buffer(buf, data, new_frame);
     #else
@@ -22465,6 +30477,8 @@ static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data)
     _sg_wgpu_update_image(img, data);
     #elif defined(SOKOL_VULKAN)
     _sg_vk_update_image(img, data);
+    #elif defined(SOKOL_SOFTWARE)
+    _sg_sw_update_image(img, data);
     #elif defined(SOKOL_DUMMY_BACKEND)
     _sg_dummy_update_image(img, data);
     #else
@@ -22472,18 +30486,194 @@ static inline void _sg_update_image(_sg_image_t* img, const sg_image_data* data)
     #endif
 }
 
-static inline void _sg_push_debug_group(const char* name) {
-    #if defined(SOKOL_METAL)
-    _sg_mtl_push_debug_group(name);
-    #else
-    _SOKOL_UNUSED(name);
+static inline void _sg_push_debug_group(const char* name) {
+    #if defined(SOKOL_METAL)
+    _sg_mtl_push_debug_group(name);
+    #else
+    _SOKOL_UNUSED(name);
+    #endif
+}
+
+static inline void _sg_pop_debug_group(void) {
+    #if defined(SOKOL_METAL)
+    _sg_mtl_pop_debug_group();
+    #endif
+}
+
+// ██       ██████   █████  ██████  ███████ ██████      ████████ ██   ██ ██████  ███████  █████  ██████  ███████
+// ██      ██    ██ ██   ██ ██   ██ ██      ██   ██        ██    ██   ██ ██   ██ ██      ██   ██ ██   ██ ██
+// ██      ██    ██ ███████ ██   ██ █████   ██████         ██    ███████ ██████  █████   ███████ ██   ██ ███████
+// ██      ██    ██ ██   ██ ██   ██ ██      ██   ██        ██    ██   ██ ██   ██ ██      ██   ██ ██   ██      ██
+// ███████  ██████  ██   ██ ██████  ███████ ██   ██        ██    ██   ██ ██   ██ ███████ ██   ██ ██████  ███████
+//
+// >>loader threads
+#if defined(SOKOL_LOADER_THREADS)
+_SOKOL_PRIVATE void _sg_loader_setup(void) {
+    _sg.loader.render_thread = (const void*)&_sg_thread_marker;
+    _sg.loader.max_pending = _sg.pools.buffer_pool.size + _sg.pools.image_pool.size +
+        _sg.pools.sampler_pool.size + _sg.pools.shader_pool.size +
+        _sg.pools.pipeline_pool.size + _sg.pools.view_pool.size;
+    _sg.loader.pending = (_sg_pending_resource_t*)_sg_malloc_clear(sizeof(_sg_pending_resource_t) * (size_t)_sg.loader.max_pending);
+}
+
+#if defined(SOKOL_MULTI_CONTEXT)
+// the render thread of the default context is the thread which called sg_setup(),
+// for other contexts it's the first thread which makes the context current
+_SOKOL_PRIVATE void _sg_loader_claim_render_thread(void) {
+    const void* marker = (const void*)&_sg_thread_marker;
+    #if defined(_MSC_VER) && !defined(__clang__)
+        _InterlockedCompareExchangePointer((void* volatile*)&_sg.loader.render_thread, (void*)marker, 0);
+    #else
+        const void* expected = 0;
+        __atomic_compare_exchange_n(&_sg.loader.render_thread, &expected, marker, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    #endif
+}
+#endif
+
+_SOKOL_PRIVATE void _sg_loader_discard(void) {
+    SOKOL_ASSERT(0 == _sg.loader.num_pending);
+    _sg_free(_sg.loader.pending);
+    _sg.loader.pending = 0;
+    _sg.loader.num_pending = 0;
+}
+
+// publish resources which have been initialized on loader threads, called on the render thread in sg_commit()
+_SOKOL_PRIVATE void _sg_loader_publish(void) {
+    _sg_spinlock_lock(&_sg.loader.lock);
+    for (int i = 0; i < _sg.loader.num_pending; i++) {
+        _sg_pending_resource_t* item = &_sg.loader.pending[i];
+        #if defined(_SOKOL_ANY_GL)
+        if (item->gl_sync) {
+            // GPU-side wait until the loader thread's GL commands have completed
+            glWaitSync(item->gl_sync, 0, GL_TIMEOUT_IGNORED);
+            glDeleteSync(item->gl_sync);
+        }
+        #endif
+        // skip resources which have been destroyed in the meantime
+        _sg_slot_t* slot = item->slot;
+        if ((slot->id == item->id) && (slot->state == SG_RESOURCESTATE_ALLOC)) {
+            slot->state = slot->pending_state;
+            slot->pending_state = SG_RESOURCESTATE_INITIAL;
+        }
+    }
+    _sg.loader.num_pending = 0;
+    _sg_spinlock_unlock(&_sg.loader.lock);
+}
+#endif
+
+// ███████ ██   ██  █████  ██████  ███████ ██████       ██████  ██████  ███    ███ ██████  ██ ██      ███████
+// ██      ██   ██ ██   ██ ██   ██ ██      ██   ██     ██      ██    ██ ████  ████ ██   ██ ██ ██      ██
+// ███████ ███████ ███████ ██   ██ █████   ██████      ██      ██    ██ ██ ████ ██ ██████  ██ ██      █████
+//      ██ ██   ██ ██   ██ ██   ██ ██      ██   ██     ██      ██    ██ ██  ██  ██ ██      ██ ██      ██
+// ███████ ██   ██ ██   ██ ██████  ███████ ██   ██      ██████  ██████  ██      ██ ██      ██ ███████ ███████
+//
+// >>shader compile
+_SOKOL_PRIVATE void _sg_setup_compile_queue(const sg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    if (desc->parallel_shader_compile) {
+        _sg.compile.max_pending = _sg.pools.shader_pool.size + _sg.pools.pipeline_pool.size;
+        _sg.compile.pending = (_sg_compile_item_t*)_sg_malloc_clear(sizeof(_sg_compile_item_t) * (size_t)_sg.compile.max_pending);
+    }
+}
+
+_SOKOL_PRIVATE void _sg_discard_compile_queue(void) {
+    if (_sg.compile.pending) {
+        _sg_free(_sg.compile.pending);
+        _sg.compile.pending = 0;
+    }
+    _sg.compile.num_pending = 0;
+    _sg.compile.max_pending = 0;
+}
+
+// called when the backend returned ALLOC from resource creation
+_SOKOL_PRIVATE void _sg_compile_add(_sg_slot_t* slot, bool is_pipeline) {
+    SOKOL_ASSERT(slot && (slot->state == SG_RESOURCESTATE_ALLOC) && !slot->compiling);
+    SOKOL_ASSERT(_sg.compile.num_pending < _sg.compile.max_pending);
+    slot->compiling = true;
+    _sg_compile_item_t* item = &_sg.compile.pending[_sg.compile.num_pending++];
+    item->id = slot->id;
+    item->is_pipeline = is_pipeline;
+}
+
+// called when a resource which is still compiling is destroyed
+_SOKOL_PRIVATE void _sg_compile_remove(_sg_slot_t* slot) {
+    SOKOL_ASSERT(slot && slot->compiling);
+    for (int i = 0; i < _sg.compile.num_pending; i++) {
+        if (_sg.compile.pending[i].id == slot->id) {
+            _sg.compile.num_pending -= 1;
+            for (int ii = i; ii < _sg.compile.num_pending; ii++) {
+                _sg.compile.pending[ii] = _sg.compile.pending[ii + 1];
+            }
+            break;
+        }
+    }
+    slot->compiling = false;
+}
+
+// check for finished background compilations, called in sg_commit(), items are
+// polled in creation order so that a shader finishes before its pipelines
+_SOKOL_PRIVATE void _sg_compile_poll(void) {
+    int num_remaining = 0;
+    for (int i = 0; i < _sg.compile.num_pending; i++) {
+        const _sg_compile_item_t item = _sg.compile.pending[i];
+        _sg_slot_t* slot = 0;
+        sg_resource_state state = SG_RESOURCESTATE_ALLOC;
+        if (item.is_pipeline) {
+            _sg_pipeline_t* pip = _sg_lookup_pipeline(item.id);
+            SOKOL_ASSERT(pip);
+            slot = &pip->slot;
+            state = _sg_poll_pipeline(pip);
+        } else {
+            _sg_shader_t* shd = _sg_lookup_shader(item.id);
+            SOKOL_ASSERT(shd);
+            slot = &shd->slot;
+            state = _sg_poll_shader(shd);
+        }
+        SOKOL_ASSERT(slot->compiling && (slot->state == SG_RESOURCESTATE_ALLOC));
+        if (state == SG_RESOURCESTATE_ALLOC) {
+            _sg.compile.pending[num_remaining++] = item;
+        } else {
+            SOKOL_ASSERT((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED));
+            slot->compiling = false;
+            slot->state = state;
+        }
+    }
+    _sg.compile.num_pending = num_remaining;
+}
+
+// returns false on loader threads if the backend doesn't support resource creation on loader threads
+_SOKOL_PRIVATE bool _sg_check_init_thread(void) {
+    #if defined(SOKOL_LOADER_THREADS) && (defined(SOKOL_METAL) || defined(SOKOL_WGPU))
+    if (_sg_on_loader_thread()) {
+        _SG_ERROR(LOADER_THREADS_NOT_SUPPORTED);
+        return false;
+    }
     #endif
+    return true;
 }
 
-static inline void _sg_pop_debug_group(void) {
-    #if defined(SOKOL_METAL)
-    _sg_mtl_pop_debug_group();
+// on loader threads the resource stays in ALLOC state until it is published in sg_commit()
+_SOKOL_PRIVATE void _sg_init_done(_sg_slot_t* slot, sg_resource_state state) {
+    SOKOL_ASSERT(slot);
+    SOKOL_ASSERT((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED));
+    #if defined(SOKOL_LOADER_THREADS)
+    if (_sg_on_loader_thread()) {
+        slot->pending_state = state;
+        _SG_STRUCT(_sg_pending_resource_t, item);
+        item.slot = slot;
+        item.id = slot->id;
+        #if defined(_SOKOL_ANY_GL)
+        item.gl_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+        #endif
+        _sg_spinlock_lock(&_sg.loader.lock);
+        SOKOL_ASSERT(_sg.loader.num_pending < _sg.loader.max_pending);
+        _sg.loader.pending[_sg.loader.num_pending++] = item;
+        _sg_spinlock_unlock(&_sg.loader.lock);
+        return;
+    }
     #endif
+    slot->state = state;
 }
 
 // ██    ██  █████  ██      ██ ██████   █████  ████████ ██  ██████  ███    ██
@@ -22495,11 +30685,11 @@ static inline void _sg_pop_debug_group(void) {
 // >>validation
 #if defined(SOKOL_DEBUG)
 _SOKOL_PRIVATE void _sg_validate_begin(void) {
-    _sg.validate_error = SG_LOGITEM_OK;
+    _SG_VALIDATE_ERROR = SG_LOGITEM_OK;
 }
 
 _SOKOL_PRIVATE bool _sg_validate_end(void) {
-    if (_sg.validate_error != SG_LOGITEM_OK) {
+    if (_SG_VALIDATE_ERROR != SG_LOGITEM_OK) {
         #if !defined(SOKOL_VALIDATE_NON_FATAL)
             _SG_PANIC(VALIDATION_FAILED);
             return false;
@@ -22552,6 +30742,9 @@ _SOKOL_PRIVATE bool _sg_validate_buffer_desc(const sg_buffer_desc* desc) {
             _SG_VALIDATE(_sg.features.compute, VALIDATE_BUFFERDESC_STORAGEBUFFER_SUPPORTED);
             _SG_VALIDATE(_sg_multiple_u64(desc->size, 4), VALIDATE_BUFFERDESC_STORAGEBUFFER_SIZE_MULTIPLE_4);
         }
+        if (desc->usage.uniform_buffer) {
+            _SG_VALIDATE(_sg.features.uniform_buffer_bindings, VALIDATE_BUFFERDESC_UNIFORMBUFFER_SUPPORTED);
+        }
         return _sg_validate_end();
     #endif
 }
@@ -22594,6 +30787,11 @@ _SOKOL_PRIVATE bool _sg_validate_image_desc(const sg_image_desc* desc) {
         _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_IMAGEDESC_CANARY);
         _SG_VALIDATE(_sg_one(usg->immutable, usg->dynamic_update, usg->stream_update), VALIDATE_IMAGEDESC_IMMUTABLE_DYNAMIC_STREAM);
         _SG_VALIDATE(!(usg->color_attachment && usg->depth_stencil_attachment), VALIDATE_IMAGEDESC_ATTACHMENT_COLOR_DEPTH_STENCIL);
+        if (usg->transient_attachment) {
+            _SG_VALIDATE(usg->color_attachment || usg->depth_stencil_attachment, VALIDATE_IMAGEDESC_TRANSIENT_EXPECT_ATTACHMENT);
+            _SG_VALIDATE(!usg->resolve_attachment, VALIDATE_IMAGEDESC_TRANSIENT_RESOLVEATTACHMENT);
+            _SG_VALIDATE(!usg->storage_image, VALIDATE_IMAGEDESC_TRANSIENT_STORAGEIMAGE);
+        }
         switch (desc->type) {
             case SG_IMAGETYPE_2D:
                 _SG_VALIDATE(desc->num_slices == 1, VALIDATE_IMAGEDESC_IMAGETYPE_2D_NUMSLICES);
@@ -22776,7 +30974,7 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
             return true;
         }
         SOKOL_ASSERT(desc);
-        bool is_compute_shader = (desc->compute_func.source != 0) || (desc->compute_func.bytecode.ptr != 0);
+        bool is_compute_shader = (desc->compute_func.source != 0) || (desc->compute_func.bytecode.ptr != 0) || (desc->software.compute_func != 0);
         _sg_validate_begin();
         _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_SHADERDESC_CANARY);
         _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_SHADERDESC_CANARY);
@@ -22796,12 +30994,17 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
                 _SG_VALIDATE((0 != desc->vertex_func.source)|| (0 != desc->vertex_func.bytecode.ptr), VALIDATE_SHADERDESC_VERTEX_SOURCE_OR_BYTECODE);
                 _SG_VALIDATE((0 != desc->fragment_func.source) || (0 != desc->fragment_func.bytecode.ptr), VALIDATE_SHADERDESC_FRAGMENT_SOURCE_OR_BYTECODE);
             }
+        #elif defined(SOKOL_SOFTWARE)
+            // Software backend, shader functions are optional (a pipeline without
+            // vertex function doesn't render anything), but the varyings must fit
+            _SG_VALIDATE((desc->software.num_varyings >= 0) && (desc->software.num_varyings <= SG_SW_MAX_VARYINGS), VALIDATE_SHADERDESC_SOFTWARE_NUM_VARYINGS);
         #else
             // Dummy Backend, don't require source or bytecode
         #endif
         if (is_compute_shader) {
             _SG_VALIDATE((0 == desc->vertex_func.source) && (0 == desc->vertex_func.bytecode.ptr), VALIDATE_SHADERDESC_INVALID_SHADER_COMBO);
             _SG_VALIDATE((0 == desc->fragment_func.source) && (0 == desc->fragment_func.bytecode.ptr), VALIDATE_SHADERDESC_INVALID_SHADER_COMBO);
+            _SG_VALIDATE((0 == desc->software.vertex_func) && (0 == desc->software.fragment_func), VALIDATE_SHADERDESC_INVALID_SHADER_COMBO);
         } else {
             _SG_VALIDATE((0 == desc->compute_func.source) && (0 == desc->compute_func.bytecode.ptr), VALIDATE_SHADERDESC_INVALID_SHADER_COMBO);
         }
@@ -22814,6 +31017,9 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
             _SG_VALIDATE(((x * y * z) & 31) == 0, VALIDATE_SHADERDESC_METAL_THREADS_PER_THREADGROUP_MULTIPLE_32);
         }
         #endif
+        if (desc->spirv_bindless) {
+            _SG_VALIDATE(_sg.features.bindless, VALIDATE_SHADERDESC_BINDLESS_NOT_SUPPORTED);
+        }
         for (size_t i = 0; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
             if (desc->attrs[i].glsl_name) {
                 _SG_VALIDATE(strlen(desc->attrs[i].glsl_name) < _SG_STRING_SIZE, VALIDATE_SHADERDESC_ATTR_STRING_TOO_LONG);
@@ -22852,12 +31058,18 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
         _sg_u128_t spirv_set0_bits = _sg_u128();
         _sg_u128_t spirv_set1_bits = _sg_u128();
         #endif
+        int num_push_constant_blocks = 0;
         for (size_t ub_idx = 0; ub_idx < SG_MAX_UNIFORMBLOCK_BINDSLOTS; ub_idx++) {
             const sg_shader_uniform_block* ub_desc = &desc->uniform_blocks[ub_idx];
             if (ub_desc->stage == SG_SHADERSTAGE_NONE) {
                 continue;
             }
             _SG_VALIDATE(ub_desc->size > 0, VALIDATE_SHADERDESC_UNIFORMBLOCK_SIZE_IS_ZERO);
+            if (ub_desc->spirv_push_constant) {
+                num_push_constant_blocks++;
+                _SG_VALIDATE(num_push_constant_blocks == 1, VALIDATE_SHADERDESC_UNIFORMBLOCK_PUSH_CONSTANT_UNIQUE);
+                _SG_VALIDATE((ub_desc->size <= _SG_MAX_PUSH_CONSTANT_SIZE) && ((ub_desc->size & 3) == 0), VALIDATE_SHADERDESC_UNIFORMBLOCK_PUSH_CONSTANT_SIZE);
+            }
             #if defined(SOKOL_METAL)
             _SG_VALIDATE(_sg_validate_slot_bits(msl_buf_bits, ub_desc->stage, ub_desc->msl_buffer_n), VALIDATE_SHADERDESC_UNIFORMBLOCK_METAL_BUFFER_SLOT_COLLISION);
             msl_buf_bits = _sg_validate_set_slot_bit(msl_buf_bits, ub_desc->stage, ub_desc->msl_buffer_n);
@@ -22868,10 +31080,18 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
             _SG_VALIDATE(_sg_validate_slot_bits(wgsl_group0_bits, SG_SHADERSTAGE_NONE, ub_desc->wgsl_group0_binding_n), VALIDATE_SHADERDESC_UNIFORMBLOCK_WGSL_GROUP0_BINDING_COLLISION);
             wgsl_group0_bits = _sg_validate_set_slot_bit(wgsl_group0_bits, SG_SHADERSTAGE_NONE, ub_desc->wgsl_group0_binding_n);
             #elif defined(SOKOL_VULKAN)
-            _SG_VALIDATE(_sg_validate_slot_bits(spirv_set0_bits, SG_SHADERSTAGE_NONE, ub_desc->spirv_set0_binding_n), VALIDATE_SHADERDESC_UNIFORMBLOCK_SPIRV_SET0_BINDING_COLLISION);
-            spirv_set0_bits = _sg_validate_set_slot_bit(spirv_set0_bits, SG_SHADERSTAGE_NONE, ub_desc->spirv_set0_binding_n);
+            if (!ub_desc->spirv_push_constant) {
+                _SG_VALIDATE(_sg_validate_slot_bits(spirv_set0_bits, SG_SHADERSTAGE_NONE, ub_desc->spirv_set0_binding_n), VALIDATE_SHADERDESC_UNIFORMBLOCK_SPIRV_SET0_BINDING_COLLISION);
+                spirv_set0_bits = _sg_validate_set_slot_bit(spirv_set0_bits, SG_SHADERSTAGE_NONE, ub_desc->spirv_set0_binding_n);
+            }
             #endif
             #if defined(_SOKOL_ANY_GL)
+            if (ub_desc->glsl_block_name) {
+                // a real GLSL uniform block, bound with sg_apply_uniform_buffer()
+                _SG_VALIDATE(ub_desc->glsl_uniforms[0].type == SG_UNIFORMTYPE_INVALID, VALIDATE_SHADERDESC_UNIFORMBLOCK_GLSL_BLOCK_MEMBERS);
+                _SG_VALIDATE(ub_desc->layout == SG_UNIFORMLAYOUT_STD140, VALIDATE_SHADERDESC_UNIFORMBLOCK_GLSL_BLOCK_STD140);
+                continue;
+            }
             bool uniforms_continuous = true;
             uint32_t uniform_offset = 0;
             int num_uniforms = 0;
@@ -22923,7 +31143,7 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
                 #elif defined(SOKOL_VULKAN)
                 _SG_VALIDATE(_sg_validate_slot_bits(spirv_set1_bits, SG_SHADERSTAGE_NONE, tex_desc->spirv_set1_binding_n), VALIDATE_SHADERDESC_VIEW_TEXTURE_SPIRV_SET1_BINDING_COLLISION);
                 spirv_set1_bits = _sg_validate_set_slot_bit(spirv_set1_bits, SG_SHADERSTAGE_NONE, tex_desc->spirv_set1_binding_n);
-                #elif defined(SOKOL_DUMMY_BACKEND) || defined(_SOKOL_ANY_GL)
+                #elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE) || defined(_SOKOL_ANY_GL)
                 _SOKOL_UNUSED(tex_desc);
                 #endif
             } else if (view_desc->storage_buffer.stage != SG_SHADERSTAGE_NONE) {
@@ -22948,7 +31168,7 @@ _SOKOL_PRIVATE bool _sg_validate_shader_desc(const sg_shader_desc* desc) {
                 #elif defined(SOKOL_VULKAN)
                 _SG_VALIDATE(_sg_validate_slot_bits(spirv_set1_bits, SG_SHADERSTAGE_NONE, sbuf_desc->spirv_set1_binding_n), VALIDATE_SHADERDESC_VIEW_STORAGEBUFFER_SPIRV_SET1_BINDING_COLLISION);
                 spirv_set1_bits = _sg_validate_set_slot_bit(spirv_set1_bits, SG_SHADERSTAGE_NONE, sbuf_desc->spirv_set1_binding_n);
-                #elif defined(SOKOL_DUMMY_BACKEND)
+                #elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE)
                 _SOKOL_UNUSED(sbuf_desc);
                 #endif
             } else if (view_desc->storage_image.stage != SG_SHADERSTAGE_NONE) {
@@ -23053,7 +31273,7 @@ _SOKOL_PRIVATE bool _sg_validate_pipeline_desc(const sg_pipeline_desc* desc) {
         const _sg_shader_t* shd = _sg_lookup_shader(desc->shader.id);
         _SG_VALIDATE(0 != shd, VALIDATE_PIPELINEDESC_SHADER);
         if (shd) {
-            _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_PIPELINEDESC_SHADER);
+            _SG_VALIDATE((_sg_slot_init_state(&shd->slot) == SG_RESOURCESTATE_VALID) || shd->slot.compiling, VALIDATE_PIPELINEDESC_SHADER);
             if (desc->compute) {
                 _SG_VALIDATE(shd->cmn.is_compute, VALIDATE_PIPELINEDESC_COMPUTE_SHADER_EXPECTED);
             } else {
@@ -23183,24 +31403,24 @@ _SOKOL_PRIVATE bool _sg_validate_view_desc(const sg_view_desc* desc) {
             buf = _sg_lookup_buffer(buf_desc->buffer.id);
             _SG_VALIDATE(buf, VALIDATE_VIEWDESC_RESOURCE_ALIVE);
             if (buf) {
-                _SG_VALIDATE(buf->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_VIEWDESC_RESOURCE_FAILED);
-                res_valid = buf->slot.state == SG_RESOURCESTATE_VALID;
+                _SG_VALIDATE(_sg_slot_init_state(&buf->slot) == SG_RESOURCESTATE_VALID, VALIDATE_VIEWDESC_RESOURCE_FAILED);
+                res_valid = _sg_slot_init_state(&buf->slot) == SG_RESOURCESTATE_VALID;
             }
         } else if (img_desc) {
             SOKOL_ASSERT((tex_desc == 0) && (buf_desc == 0));
             img = _sg_lookup_image(img_desc->image.id);
             _SG_VALIDATE(img, VALIDATE_VIEWDESC_RESOURCE_ALIVE);
             if (img) {
-                _SG_VALIDATE(img->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_VIEWDESC_RESOURCE_FAILED);
-                res_valid = img->slot.state == SG_RESOURCESTATE_VALID;
+                _SG_VALIDATE(_sg_slot_init_state(&img->slot) == SG_RESOURCESTATE_VALID, VALIDATE_VIEWDESC_RESOURCE_FAILED);
+                res_valid = _sg_slot_init_state(&img->slot) == SG_RESOURCESTATE_VALID;
             }
         } else {
             SOKOL_ASSERT(tex_desc && (img_desc == 0) && (buf_desc == 0));
             img = _sg_lookup_image(tex_desc->image.id);
             _SG_VALIDATE(img, VALIDATE_VIEWDESC_RESOURCE_ALIVE);
             if (img) {
-                _SG_VALIDATE(img->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_VIEWDESC_RESOURCE_FAILED);
-                res_valid = img->slot.state == SG_RESOURCESTATE_VALID;
+                _SG_VALIDATE(_sg_slot_init_state(&img->slot) == SG_RESOURCESTATE_VALID, VALIDATE_VIEWDESC_RESOURCE_FAILED);
+                res_valid = _sg_slot_init_state(&img->slot) == SG_RESOURCESTATE_VALID;
             }
         }
         if (res_valid) {
@@ -23216,6 +31436,8 @@ _SOKOL_PRIVATE bool _sg_validate_view_desc(const sg_view_desc* desc) {
                     _SG_VALIDATE(_sg_is_valid_storage_image_format(img->cmn.pixel_format), VALIDATE_VIEWDESC_STORAGEIMAGE_PIXELFORMAT);
                     break;
                 case SG_VIEWTYPE_TEXTURE:
+                    SOKOL_ASSERT(img);
+                    _SG_VALIDATE(!img->cmn.usage.transient_attachment, VALIDATE_VIEWDESC_TEXTURE_TRANSIENT);
                     if (!_sg.features.msaa_texture_bindings) {
                         _SG_VALIDATE(img->cmn.sample_count == 1, VALIDATE_VIEWDESC_TEXTURE_EXPECT_NO_MSAA);
                     }
@@ -23276,6 +31498,27 @@ _SOKOL_PRIVATE bool _sg_validate_view_desc(const sg_view_desc* desc) {
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_counter_desc(const sg_counter_desc* desc) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(desc);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT(desc);
+        _sg_validate_begin();
+        _SG_VALIDATE(desc->_start_canary == 0, VALIDATE_COUNTERDESC_CANARY);
+        _SG_VALIDATE(desc->_end_canary == 0, VALIDATE_COUNTERDESC_CANARY);
+        if (desc->type == SG_COUNTERTYPE_OCCLUSION) {
+            _SG_VALIDATE(_sg.features.occlusion_counter, VALIDATE_COUNTERDESC_OCCLUSION_NOT_SUPPORTED);
+        } else if (desc->type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+            _SG_VALIDATE(_sg.features.pipeline_statistics_counter, VALIDATE_COUNTERDESC_PIPELINE_STATISTICS_NOT_SUPPORTED);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_begin_pass(const sg_pass* pass) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(pass);
@@ -23291,6 +31534,7 @@ _SOKOL_PRIVATE bool _sg_validate_begin_pass(const sg_pass* pass) {
         _sg_validate_begin();
         _SG_VALIDATE(pass->_start_canary == 0, VALIDATE_BEGINPASS_CANARY);
         _SG_VALIDATE(pass->_end_canary == 0, VALIDATE_BEGINPASS_CANARY);
+        _SG_VALIDATE(is_compute_pass || !pass->async_compute, VALIDATE_BEGINPASS_ASYNC_COMPUTE_EXPECT_COMPUTE);
         if (is_compute_pass) {
             _SG_VALIDATE(_sg_attachments_empty(&pass->attachments), VALIDATE_BEGINPASS_COMPUTEPASS_EXPECT_NO_ATTACHMENTS);
         } else if (is_invalid_swapchain_pass) {
@@ -23856,8 +32100,62 @@ _SOKOL_PRIVATE bool _sg_validate_apply_uniforms(int ub_slot, const sg_range* dat
                 _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AU_PIPELINE_SHADER_VALID);
                 _SG_VALIDATE(shd->cmn.uniform_blocks[ub_slot].stage != SG_SHADERSTAGE_NONE, VALIDATE_AU_NO_UNIFORMBLOCK_AT_SLOT);
                 _SG_VALIDATE(data->size == shd->cmn.uniform_blocks[ub_slot].size, VALIDATE_AU_SIZE);
+                #if defined(_SOKOL_ANY_GL)
+                _SG_VALIDATE(!shd->gl.uniform_blocks[ub_slot].glsl_block, VALIDATE_AU_GLSL_BLOCK);
+                #endif
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_apply_uniform_buffer(int ub_slot, const _sg_buffer_t* buf, int offset) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(ub_slot);
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(offset);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.features.uniform_buffer_bindings, VALIDATE_AUB_NOT_SUPPORTED);
+        _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_AUB_PASS_EXPECTED);
+        const _sg_pipeline_ref_t* pip_ref = &_sg.cur_pip;
+        const bool pip_null = _sg_pipeline_ref_null(pip_ref);
+        const bool pip_alive = _sg_pipeline_ref_alive(pip_ref);
+        _SG_VALIDATE(!pip_null, VALIDATE_AUB_NO_PIPELINE);
+        _SG_VALIDATE(pip_alive, VALIDATE_AUB_PIPELINE_ALIVE);
+        int ub_size = 0;
+        if (pip_alive) {
+            const _sg_pipeline_t* pip = _sg_pipeline_ref_ptr(pip_ref);
+            _SG_VALIDATE(pip->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AUB_PIPELINE_VALID);
+            const _sg_shader_ref_t* shd_ref = &pip->cmn.shader;
+            const bool shd_alive = _sg_shader_ref_alive(shd_ref);
+            _SG_VALIDATE(shd_alive, VALIDATE_AUB_PIPELINE_SHADER_ALIVE);
+            if (shd_alive) {
+                const _sg_shader_t* shd = _sg_shader_ref_ptr(shd_ref);
+                _SG_VALIDATE(shd->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AUB_PIPELINE_SHADER_VALID);
+                _SG_VALIDATE(shd->cmn.uniform_blocks[ub_slot].stage != SG_SHADERSTAGE_NONE, VALIDATE_AUB_NO_UNIFORMBLOCK_AT_SLOT);
+                #if defined(SOKOL_VULKAN)
+                _SG_VALIDATE(!shd->vk.ub_push_constant[ub_slot], VALIDATE_AUB_PUSH_CONSTANT);
+                #elif defined(_SOKOL_ANY_GL)
+                _SG_VALIDATE(shd->gl.uniform_blocks[ub_slot].glsl_block, VALIDATE_AUB_GLSL_BLOCK_NAME);
+                #endif
+                ub_size = (int)shd->cmn.uniform_blocks[ub_slot].size;
             }
         }
+        _SG_VALIDATE(buf != 0, VALIDATE_AUB_BUFFER_EXISTS);
+        if (buf) {
+            _SG_VALIDATE(buf->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_AUB_BUFFER_VALID);
+            _SG_VALIDATE(buf->cmn.usage.uniform_buffer, VALIDATE_AUB_EXPECT_UNIFORMBUFFER);
+            const int align = _sg.limits.uniform_buffer_offset_alignment;
+            _SG_VALIDATE((offset >= 0) && ((align <= 0) || ((offset % align) == 0)), VALIDATE_AUB_OFFSET_ALIGNMENT);
+            // NOTE: written so that it can't overflow for any offset
+            _SG_VALIDATE((offset >= 0) && (ub_size <= buf->cmn.size) && (offset <= (buf->cmn.size - ub_size)), VALIDATE_AUB_BUFFER_SIZE);
+        }
         return _sg_validate_end();
     #endif
 }
@@ -23919,6 +32217,45 @@ _SOKOL_PRIVATE bool _sg_validate_draw_ex(int base_element, int num_elements, int
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_draw_batch(const sg_draw_args* args, int count) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(args);
+        _SOKOL_UNUSED(count);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.cur_pass.in_pass && !_sg.cur_pass.is_compute, VALIDATE_DRAW_BATCH_RENDERPASS_EXPECTED);
+        _SG_VALIDATE(count >= 0, VALIDATE_DRAW_BATCH_COUNT_GE_ZERO);
+        _SG_VALIDATE(_sg.required_bindings_and_uniforms == _sg.applied_bindings_and_uniforms, VALIDATE_DRAW_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING);
+        // only check the per-draw arguments, the render state is the same for all draws
+        for (int i = 0; i < count; i++) {
+            const sg_draw_args* a = &args[i];
+            // NOTE: base_vertex is allowed to be < 0
+            _SG_VALIDATE(a->base_element >= 0, VALIDATE_DRAW_BATCH_BASEELEMENT_GE_ZERO);
+            _SG_VALIDATE(a->num_elements >= 0, VALIDATE_DRAW_BATCH_NUMELEMENTS_GE_ZERO);
+            _SG_VALIDATE(a->num_instances >= 0, VALIDATE_DRAW_BATCH_NUMINSTANCES_GE_ZERO);
+            _SG_VALIDATE(a->base_instance >= 0, VALIDATE_DRAW_BATCH_BASEINSTANCE_GE_ZERO);
+            if (a->base_vertex != 0) {
+                _SG_VALIDATE(_sg.features.draw_base_vertex, VALIDATE_DRAW_BATCH_BASEVERTEX_NOT_SUPPORTED);
+                _SG_VALIDATE(_sg.use_indexed_draw, VALIDATE_DRAW_BATCH_BASEVERTEX_VS_INDEXED);
+            }
+            if (a->base_instance > 0) {
+                _SG_VALIDATE(_sg.features.draw_base_instance, VALIDATE_DRAW_BATCH_BASEINSTANCE_NOT_SUPPORTED);
+                const bool use_instanced_draw = (a->num_instances > 1) || _sg.use_instanced_draw;
+                _SG_VALIDATE(use_instanced_draw, VALIDATE_DRAW_BATCH_BASEINSTANCE_VS_INSTANCED);
+            }
+            // don't flood the log with the same error for each draw
+            if (_SG_VALIDATE_ERROR != SG_LOGITEM_OK) {
+                break;
+            }
+        }
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(num_groups_x);
@@ -23939,6 +32276,70 @@ _SOKOL_PRIVATE bool _sg_validate_dispatch(int num_groups_x, int num_groups_y, in
     #endif
 }
 
+_SOKOL_PRIVATE bool _sg_validate_dispatch_indirect(const _sg_buffer_t* buf, int offset) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(buf);
+        _SOKOL_UNUSED(offset);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(_sg.features.dispatch_indirect, VALIDATE_DISPATCH_INDIRECT_NOT_SUPPORTED);
+        _SG_VALIDATE(_sg.cur_pass.in_pass && _sg.cur_pass.is_compute, VALIDATE_DISPATCH_INDIRECT_COMPUTEPASS_EXPECTED);
+        _SG_VALIDATE(buf != 0, VALIDATE_DISPATCH_INDIRECT_BUFFER_EXISTS);
+        if (buf) {
+            _SG_VALIDATE(buf->cmn.usage.storage_buffer, VALIDATE_DISPATCH_INDIRECT_EXPECT_STORAGEBUFFER);
+            _SG_VALIDATE((offset >= 0) && ((offset & 3) == 0), VALIDATE_DISPATCH_INDIRECT_OFFSET_ALIGNMENT);
+            _SG_VALIDATE((offset >= 0) && (offset <= (buf->cmn.size - 3 * (int)sizeof(uint32_t))), VALIDATE_DISPATCH_INDIRECT_BUFFER_SIZE);
+        }
+        _SG_VALIDATE(_sg.required_bindings_and_uniforms == _sg.applied_bindings_and_uniforms, VALIDATE_DISPATCH_INDIRECT_REQUIRED_BINDINGS_OR_UNIFORMS_MISSING);
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_begin_counter(const _sg_counter_t* ctr) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(ctr);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(ctr != 0, VALIDATE_BEGINCOUNTER_EXISTS);
+        if (ctr) {
+            _SG_VALIDATE(ctr->slot.state == SG_RESOURCESTATE_VALID, VALIDATE_BEGINCOUNTER_VALID);
+            _SG_VALIDATE(!ctr->cmn.recorded || (ctr->cmn.begin_frame_index != _sg.frame_index), VALIDATE_BEGINCOUNTER_ONCE_PER_FRAME);
+            if (ctr->cmn.type == SG_COUNTERTYPE_OCCLUSION) {
+                _SG_VALIDATE(_sg.cur_pass.in_pass && !_sg.cur_pass.is_compute, VALIDATE_BEGINCOUNTER_RENDERPASS_EXPECTED);
+            } else {
+                _SG_VALIDATE(_sg.cur_pass.in_pass, VALIDATE_BEGINCOUNTER_PASS_EXPECTED);
+            }
+            _SG_VALIDATE(_sg.cur_pass.counter_ids[ctr->cmn.type] == SG_INVALID_ID, VALIDATE_BEGINCOUNTER_ALREADY_ACTIVE);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
+_SOKOL_PRIVATE bool _sg_validate_end_counter(const _sg_counter_t* ctr) {
+    #if !defined(SOKOL_DEBUG)
+        _SOKOL_UNUSED(ctr);
+        return true;
+    #else
+        if (_sg.desc.disable_validation) {
+            return true;
+        }
+        _sg_validate_begin();
+        _SG_VALIDATE(ctr != 0, VALIDATE_ENDCOUNTER_EXISTS);
+        if (ctr) {
+            _SG_VALIDATE(_sg.cur_pass.counter_ids[ctr->cmn.type] == ctr->slot.id, VALIDATE_ENDCOUNTER_NOT_ACTIVE);
+        }
+        return _sg_validate_end();
+    #endif
+}
+
 _SOKOL_PRIVATE bool _sg_validate_update_buffer(const _sg_buffer_t* buf, const sg_range* data) {
     #if !defined(SOKOL_DEBUG)
         _SOKOL_UNUSED(buf);
@@ -24134,7 +32535,7 @@ _SOKOL_PRIVATE bool _sg_validate_pass_attachment_limits(const sg_pass* pass) {
 // >>resources
 _SOKOL_PRIVATE sg_buffer_usage _sg_buffer_usage_defaults(const sg_buffer_usage* usg) {
     sg_buffer_usage def = *usg;
-    if (!(def.vertex_buffer || def.index_buffer || def.storage_buffer)) {
+    if (!(def.vertex_buffer || def.index_buffer || def.storage_buffer || def.uniform_buffer)) {
         def.vertex_buffer = true;
     }
     if (!(def.immutable || def.stream_update || def.dynamic_update)) {
@@ -24349,6 +32750,12 @@ _SOKOL_PRIVATE sg_view_desc _sg_view_desc_defaults(const sg_view_desc* desc) {
     return def;
 }
 
+_SOKOL_PRIVATE sg_counter_desc _sg_counter_desc_defaults(const sg_counter_desc* desc) {
+    sg_counter_desc def = *desc;
+    def.type = _sg_def(def.type, SG_COUNTERTYPE_OCCLUSION);
+    return def;
+}
+
 _SOKOL_PRIVATE sg_buffer _sg_alloc_buffer(void) {
     sg_buffer res;
     int slot_index = _sg_pool_alloc_index(&_sg.pools.buffer_pool);
@@ -24427,6 +32834,19 @@ _SOKOL_PRIVATE sg_view _sg_alloc_view(void) {
     return res;
 }
 
+_SOKOL_PRIVATE sg_counter _sg_alloc_counter(void) {
+    sg_counter res;
+    int slot_index = _sg_pool_alloc_index(&_sg.pools.counter_pool);
+    if (_SG_INVALID_SLOT_INDEX != slot_index) {
+        res.id = _sg_slot_alloc(&_sg.pools.counter_pool, &_sg.pools.counters[slot_index].slot, slot_index);
+        _sg_resource_stats_inc(counters.allocated);
+    } else {
+        res.id = SG_INVALID_ID;
+        _SG_ERROR(COUNTER_POOL_EXHAUSTED);
+    }
+    return res;
+}
+
 _SOKOL_PRIVATE void _sg_dealloc_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC) && (buf->slot.id != SG_INVALID_ID));
     _sg_pool_free_index(&_sg.pools.buffer_pool, _sg_slot_index(buf->slot.id));
@@ -24469,84 +32889,94 @@ _SOKOL_PRIVATE void _sg_dealloc_view(_sg_view_t* view) {
     _sg_resource_stats_inc(views.deallocated);
 }
 
+_SOKOL_PRIVATE void _sg_dealloc_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr && (ctr->slot.state == SG_RESOURCESTATE_ALLOC) && (ctr->slot.id != SG_INVALID_ID));
+    _sg_pool_free_index(&_sg.pools.counter_pool, _sg_slot_index(ctr->slot.id));
+    _sg_slot_reset(&ctr->slot);
+    _sg_resource_stats_inc(counters.deallocated);
+}
+
 _SOKOL_PRIVATE void _sg_init_buffer(_sg_buffer_t* buf, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
-    if (_sg_validate_buffer_desc(desc)) {
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (_sg_check_init_thread() && _sg_validate_buffer_desc(desc)) {
         _sg_buffer_common_init(&buf->cmn, desc);
-        buf->slot.state = _sg_create_buffer(buf, desc);
-    } else {
-        buf->slot.state = SG_RESOURCESTATE_FAILED;
+        state = _sg_create_buffer(buf, desc);
     }
-    SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID)||(buf->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_init_done(&buf->slot, state);
     _sg_resource_stats_inc(buffers.inited);
 }
 
 _SOKOL_PRIVATE void _sg_init_image(_sg_image_t* img, const sg_image_desc* desc) {
     SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
-    if (_sg_validate_image_desc(desc)) {
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (_sg_check_init_thread() && _sg_validate_image_desc(desc)) {
         _sg_image_common_init(&img->cmn, desc);
-        img->slot.state = _sg_create_image(img, desc);
-    } else {
-        img->slot.state = SG_RESOURCESTATE_FAILED;
+        state = _sg_create_image(img, desc);
     }
-    SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID)||(img->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_init_done(&img->slot, state);
     _sg_resource_stats_inc(images.inited);
 }
 
 _SOKOL_PRIVATE void _sg_init_sampler(_sg_sampler_t* smp, const sg_sampler_desc* desc) {
     SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
-    if (_sg_validate_sampler_desc(desc)) {
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (_sg_check_init_thread() && _sg_validate_sampler_desc(desc)) {
         _sg_sampler_common_init(&smp->cmn, desc);
-        smp->slot.state = _sg_create_sampler(smp, desc);
-    } else {
-        smp->slot.state = SG_RESOURCESTATE_FAILED;
+        state = _sg_create_sampler(smp, desc);
     }
-    SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID)||(smp->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_init_done(&smp->slot, state);
     _sg_resource_stats_inc(samplers.inited);
 }
 
 _SOKOL_PRIVATE void _sg_init_shader(_sg_shader_t* shd, const sg_shader_desc* desc) {
     SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
-    if (!_sg_validate_shader_desc(desc)) {
-        shd->slot.state = SG_RESOURCESTATE_FAILED;
+    if (!_sg_check_init_thread() || !_sg_validate_shader_desc(desc)) {
+        _sg_init_done(&shd->slot, SG_RESOURCESTATE_FAILED);
         return;
     }
     if (!_sg_validate_shader_binding_limits(desc)) {
-        shd->slot.state = SG_RESOURCESTATE_FAILED;
+        _sg_init_done(&shd->slot, SG_RESOURCESTATE_FAILED);
         return;
     }
     _sg_shader_common_init(&shd->cmn, desc);
-    shd->slot.state = _sg_create_shader(shd, desc);
-    SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID)||(shd->slot.state == SG_RESOURCESTATE_FAILED));
+    const sg_resource_state state = _sg_create_shader(shd, desc);
+    if (state == SG_RESOURCESTATE_ALLOC) {
+        _sg_compile_add(&shd->slot, false);
+    } else {
+        _sg_init_done(&shd->slot, state);
+    }
     _sg_resource_stats_inc(shaders.inited);
 }
 
 _SOKOL_PRIVATE void _sg_init_pipeline(_sg_pipeline_t* pip, const sg_pipeline_desc* desc) {
     SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
     SOKOL_ASSERT(desc);
-    if (_sg_validate_pipeline_desc(desc)) {
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (_sg_check_init_thread() && _sg_validate_pipeline_desc(desc)) {
         _sg_shader_t* shd = _sg_lookup_shader(desc->shader.id);
-        if (shd && (shd->slot.state == SG_RESOURCESTATE_VALID)) {
+        if (shd && ((_sg_slot_init_state(&shd->slot) == SG_RESOURCESTATE_VALID) || (shd->slot.compiling && _sg_compile_async()))) {
             _sg_pipeline_common_init(&pip->cmn, desc, shd);
-            pip->slot.state = _sg_create_pipeline(pip, desc);
-        } else {
-            pip->slot.state = SG_RESOURCESTATE_FAILED;
+            state = _sg_create_pipeline(pip, desc);
         }
+    }
+    if (state == SG_RESOURCESTATE_ALLOC) {
+        _sg_compile_add(&pip->slot, true);
     } else {
-        pip->slot.state = SG_RESOURCESTATE_FAILED;
+        _sg_init_done(&pip->slot, state);
     }
-    SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID)||(pip->slot.state == SG_RESOURCESTATE_FAILED));
     _sg_resource_stats_inc(pipelines.inited);
 }
 
 _SOKOL_PRIVATE void _sg_init_view(_sg_view_t* view, const sg_view_desc* desc) {
     SOKOL_ASSERT(view && view->slot.state == SG_RESOURCESTATE_ALLOC);
     SOKOL_ASSERT(desc);
-    if (_sg_validate_view_desc(desc)) {
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (_sg_check_init_thread() && _sg_validate_view_desc(desc)) {
         uint32_t buf_id = desc->storage_buffer.buffer.id;
         uint32_t img_id = desc->texture.image.id;
         img_id = img_id ? img_id : desc->storage_image.image.id;
@@ -24558,24 +32988,32 @@ _SOKOL_PRIVATE void _sg_init_view(_sg_view_t* view, const sg_view_desc* desc) {
         sg_resource_state res_state = SG_RESOURCESTATE_INVALID;
         if (buf) {
             SOKOL_ASSERT(!img);
-            res_state = buf->slot.state;
+            res_state = _sg_slot_init_state(&buf->slot);
         } else if (img) {
             SOKOL_ASSERT(!buf);
-            res_state = img->slot.state;
+            res_state = _sg_slot_init_state(&img->slot);
         }
         if (res_state == SG_RESOURCESTATE_VALID) {
             _sg_view_common_init(&view->cmn, desc, buf, img);
-            view->slot.state = _sg_create_view(view, desc);
-        } else {
-            view->slot.state = SG_RESOURCESTATE_FAILED;
+            state = _sg_create_view(view, desc);
         }
-    } else {
-       view->slot.state = SG_RESOURCESTATE_FAILED;
     }
-    SOKOL_ASSERT((view->slot.state == SG_RESOURCESTATE_VALID) || (view->slot.state == SG_RESOURCESTATE_FAILED));
+    _sg_init_done(&view->slot, state);
     _sg_resource_stats_inc(views.inited);
 }
 
+_SOKOL_PRIVATE void _sg_init_counter(_sg_counter_t* ctr, const sg_counter_desc* desc) {
+    SOKOL_ASSERT(ctr && (ctr->slot.state == SG_RESOURCESTATE_ALLOC));
+    SOKOL_ASSERT(desc);
+    sg_resource_state state = SG_RESOURCESTATE_FAILED;
+    if (_sg_check_init_thread() && _sg_validate_counter_desc(desc)) {
+        _sg_counter_common_init(&ctr->cmn, desc);
+        state = _sg_create_counter(ctr, desc);
+    }
+    _sg_init_done(&ctr->slot, state);
+    _sg_resource_stats_inc(counters.inited);
+}
+
 _SOKOL_PRIVATE void _sg_uninit_buffer(_sg_buffer_t* buf) {
     SOKOL_ASSERT(buf && ((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED)));
     _sg_discard_buffer(buf);
@@ -24598,14 +33036,20 @@ _SOKOL_PRIVATE void _sg_uninit_sampler(_sg_sampler_t* smp) {
 }
 
 _SOKOL_PRIVATE void _sg_uninit_shader(_sg_shader_t* shd) {
-    SOKOL_ASSERT(shd && ((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)));
+    SOKOL_ASSERT(shd && (shd->slot.compiling || (shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)));
+    if (shd->slot.compiling) {
+        _sg_compile_remove(&shd->slot);
+    }
     _sg_discard_shader(shd);
     _sg_reset_shader_to_alloc_state(shd);
     _sg_resource_stats_inc(shaders.uninited);
 }
 
 _SOKOL_PRIVATE void _sg_uninit_pipeline(_sg_pipeline_t* pip) {
-    SOKOL_ASSERT(pip && ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)));
+    SOKOL_ASSERT(pip && (pip->slot.compiling || (pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)));
+    if (pip->slot.compiling) {
+        _sg_compile_remove(&pip->slot);
+    }
     _sg_discard_pipeline(pip);
     _sg_reset_pipeline_to_alloc_state(pip);
     _sg_resource_stats_inc(pipelines.uninited);
@@ -24618,6 +33062,18 @@ _SOKOL_PRIVATE void _sg_uninit_view(_sg_view_t* view) {
     _sg_resource_stats_inc(views.uninited);
 }
 
+_SOKOL_PRIVATE void _sg_uninit_counter(_sg_counter_t* ctr) {
+    SOKOL_ASSERT(ctr && ((ctr->slot.state == SG_RESOURCESTATE_VALID) || (ctr->slot.state == SG_RESOURCESTATE_FAILED)));
+    // a counter that's uninitialized while active must be closed first
+    if ((ctr->slot.state == SG_RESOURCESTATE_VALID) && (_sg.cur_pass.counter_ids[ctr->cmn.type] == ctr->slot.id)) {
+        _sg_end_counter(ctr);
+        _sg.cur_pass.counter_ids[ctr->cmn.type] = SG_INVALID_ID;
+    }
+    _sg_discard_counter(ctr);
+    _sg_reset_counter_to_alloc_state(ctr);
+    _sg_resource_stats_inc(counters.uninited);
+}
+
 _SOKOL_PRIVATE void _sg_setup_commit_listeners(const sg_desc* desc) {
     SOKOL_ASSERT(desc->max_commit_listeners > 0);
     SOKOL_ASSERT(0 == _sg.commit_listeners.items);
@@ -24715,9 +33171,11 @@ _SOKOL_PRIVATE sg_desc _sg_desc_defaults(const sg_desc* desc) {
     res.shader_pool_size = _sg_def(res.shader_pool_size, _SG_DEFAULT_SHADER_POOL_SIZE);
     res.pipeline_pool_size = _sg_def(res.pipeline_pool_size, _SG_DEFAULT_PIPELINE_POOL_SIZE);
     res.view_pool_size = _sg_def(res.view_pool_size, _SG_DEFAULT_VIEW_POOL_SIZE);
+    res.counter_pool_size = _sg_def(res.counter_pool_size, _SG_DEFAULT_COUNTER_POOL_SIZE);
     res.uniform_buffer_size = _sg_def(res.uniform_buffer_size, _SG_DEFAULT_UB_SIZE);
     res.max_commit_listeners = _sg_def(res.max_commit_listeners, _SG_DEFAULT_MAX_COMMIT_LISTENERS);
     res.wgpu.bindgroups_cache_size = _sg_def(res.wgpu.bindgroups_cache_size, _SG_DEFAULT_WGPU_BINDGROUP_CACHE_SIZE);
+    res.gl.vao_cache_size = _sg_def(res.gl.vao_cache_size, _SG_DEFAULT_GL_VAO_CACHE_SIZE);
     res.vulkan.copy_staging_buffer_size = _sg_def(res.vulkan.copy_staging_buffer_size, _SG_DEFAULT_VK_COPY_STAGING_SIZE);
     res.vulkan.stream_staging_buffer_size = _sg_def(res.vulkan.stream_staging_buffer_size, _SG_DEFAULT_VK_STREAM_STAGING_SIZE);
     res.vulkan.descriptor_buffer_size = _sg_def(res.vulkan.descriptor_buffer_size, _SG_DEFAULT_VK_DESCRIPTOR_BUFFER_SIZE);
@@ -24766,13 +33224,13 @@ _SOKOL_PRIVATE void _sg_discard_all_resources(void) {
     }
     for (int i = 1; i < _sg.pools.shader_pool.size; i++) {
         sg_resource_state state = _sg.pools.shaders[i].slot.state;
-        if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
+        if (_sg.pools.shaders[i].slot.compiling || (state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
             _sg_discard_shader(&_sg.pools.shaders[i]);
         }
     }
     for (int i = 1; i < _sg.pools.pipeline_pool.size; i++) {
         sg_resource_state state = _sg.pools.pipelines[i].slot.state;
-        if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
+        if (_sg.pools.pipelines[i].slot.compiling || (state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
             _sg_discard_pipeline(&_sg.pools.pipelines[i]);
         }
     }
@@ -24782,53 +33240,255 @@ _SOKOL_PRIVATE void _sg_discard_all_resources(void) {
             _sg_discard_view(&_sg.pools.views[i]);
         }
     }
+    for (int i = 1; i < _sg.pools.counter_pool.size; i++) {
+        sg_resource_state state = _sg.pools.counters[i].slot.state;
+        if ((state == SG_RESOURCESTATE_VALID) || (state == SG_RESOURCESTATE_FAILED)) {
+            _sg_discard_counter(&_sg.pools.counters[i]);
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _sg_override_portable_limits(void) {
+    if (_sg.desc.enforce_portable_limits) {
+        _sg.limits.max_color_attachments = SG_MAX_PORTABLE_COLOR_ATTACHMENTS;
+        _sg.limits.max_texture_bindings_per_stage = SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE;
+        if (_sg.features.compute) {
+            _sg.limits.max_storage_buffer_bindings_per_stage = SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE;
+            _sg.limits.max_storage_image_bindings_per_stage = SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE;
+        }
+    }
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+// discard everything created in sg_setup() before the backend
+_SOKOL_PRIVATE void _sg_discard_frontend(void) {
+    _sg_discard_commit_listeners();
+    _sg_discard_stats_history();
+    _sg_discard_compile_queue();
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_loader_discard();
+    #endif
+    _sg_discard_pools(&_sg.pools);
+    _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
+}
+
+SOKOL_API_IMPL void sg_setup(const sg_desc* desc) {
+    SOKOL_ASSERT(!_sg.valid);
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->_start_canary == 0) && (desc->_end_canary == 0));
+    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
+    _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
+    _sg.desc = _sg_desc_defaults(desc);
+    _sg_setup_pools(&_sg.pools, &_sg.desc);
+    _sg_setup_commit_listeners(&_sg.desc);
+    _sg_setup_stats_history(&_sg.desc);
+    _sg_setup_compile_queue(&_sg.desc);
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_loader_setup();
+    #endif
+    _sg.frame_index = 1;
+    _sg.stats_enabled = true;
+    #if defined(_SG_TIME_TIMESPEC_GET) || defined(_SG_TIME_CLOCK)
+    _SG_WARN(TIME_NOT_MONOTONIC);
+    #endif
+    if (!_sg_setup_backend(&_sg.desc)) {
+        // the reason has been logged by the backend, sg_isvalid() returns false
+        _sg_discard_frontend();
+        return;
+    }
+    _sg_override_portable_limits();
+    _sg.valid = true;
+}
+
+SOKOL_API_IMPL void sg_shutdown(void) {
+    SOKOL_ASSERT(_sg.valid);
+    #if defined(SOKOL_LOADER_THREADS)
+    // publish pending resources so that they are discarded below
+    _sg_loader_publish();
+    #endif
+    _sg_discard_all_resources();
+    _sg_discard_backend();
+    _sg_discard_frontend();
+}
+
+SOKOL_API_IMPL bool sg_isvalid(void) {
+    return _sg.valid;
+}
+
+#if defined(SOKOL_MULTI_CONTEXT)
+_SOKOL_PRIVATE bool _sg_context_claim_slot(_sg_context_slot_t* slot, _sg_state_t* state) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        return 0 == _InterlockedCompareExchangePointer((void* volatile*)&slot->state, state, 0);
+    #else
+        _sg_state_t* expected = 0;
+        return __atomic_compare_exchange_n(&slot->state, &expected, state, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    #endif
+}
+
+_SOKOL_PRIVATE void _sg_context_release_slot(_sg_context_slot_t* slot) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        _InterlockedExchangePointer((void* volatile*)&slot->state, 0);
+    #else
+        __atomic_store_n(&slot->state, (_sg_state_t*)0, __ATOMIC_RELEASE);
+    #endif
+}
+
+// other threads may claim or release slots at any time
+_SOKOL_PRIVATE _sg_state_t* _sg_context_slot_state(_sg_context_slot_t* slot) {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        return (_sg_state_t*) _InterlockedCompareExchangePointer((void* volatile*)&slot->state, 0, 0);
+    #else
+        return __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+    #endif
+}
+
+// returns null for invalid or outdated context ids
+_SOKOL_PRIVATE _sg_context_slot_t* _sg_lookup_context(uint32_t ctx_id) {
+    const int slot_index = (int)(ctx_id & _SG_SLOT_MASK);
+    if ((ctx_id == SG_INVALID_ID) || (slot_index >= SG_MAX_CONTEXTS)) {
+        return 0;
+    }
+    _sg_context_slot_t* slot = &_sg_contexts[slot_index];
+    if ((slot->id != ctx_id) || (0 == _sg_context_slot_state(slot))) {
+        return 0;
+    }
+    return slot;
+}
+#endif
+
+SOKOL_API_IMPL sg_context sg_make_context(const sg_desc* desc) {
+    SOKOL_ASSERT(desc);
+    _SG_STRUCT(sg_context, res);
+    #if defined(SOKOL_MULTI_CONTEXT)
+        _sg_state_t* state;
+        if (desc->allocator.alloc_fn) {
+            state = (_sg_state_t*) desc->allocator.alloc_fn(sizeof(_sg_state_t), desc->allocator.user_data);
+        } else {
+            state = (_sg_state_t*) malloc(sizeof(_sg_state_t));
+        }
+        if (0 == state) {
+            _SG_PANIC(MALLOC_FAILED);
+            return res;
+        }
+        _sg_clear(state, sizeof(_sg_state_t));
+        // slot 0 is reserved for the default context
+        for (int slot_index = 1; slot_index < SG_MAX_CONTEXTS; slot_index++) {
+            _sg_context_slot_t* slot = &_sg_contexts[slot_index];
+            if (_sg_context_claim_slot(slot, state)) {
+                // bump the generation counter so that old handles for this slot become invalid
+                uint32_t gen = (slot->id >> _SG_SLOT_SHIFT) + 1;
+                if (gen > _SG_SLOT_MASK) {
+                    gen = 1;
+                }
+                slot->id = (gen << _SG_SLOT_SHIFT) | (uint32_t)slot_index;
+                res.id = slot->id;
+                break;
+            }
+        }
+        if (res.id == SG_INVALID_ID) {
+            _SG_ERROR(CONTEXT_POOL_EXHAUSTED);
+            if (desc->allocator.free_fn) {
+                desc->allocator.free_fn(state, desc->allocator.user_data);
+            } else {
+                free(state);
+            }
+            return res;
+        }
+        _sg_state_t* prev_state = _sg_cur_state;
+        _sg_cur_state = state;
+        sg_setup(desc);
+        if (!_sg.valid) {
+            // sg_setup() has already logged the reason and cleared the state
+            _sg_cur_state = prev_state;
+            _sg_context_release_slot(&_sg_contexts[res.id & _SG_SLOT_MASK]);
+            if (desc->allocator.free_fn) {
+                desc->allocator.free_fn(state, desc->allocator.user_data);
+            } else {
+                free(state);
+            }
+            res.id = SG_INVALID_ID;
+            return res;
+        }
+        #if defined(SOKOL_LOADER_THREADS)
+        // the render thread is claimed by the first sg_set_context() call
+        _sg.loader.render_thread = 0;
+        #endif
+        _sg_cur_state = prev_state;
+    #else
+        _SOKOL_UNUSED(desc);
+        _SG_WARN(MULTI_CONTEXT_NOT_ENABLED);
+    #endif
+    return res;
 }
 
-_SOKOL_PRIVATE void _sg_override_portable_limits(void) {
-    if (_sg.desc.enforce_portable_limits) {
-        _sg.limits.max_color_attachments = SG_MAX_PORTABLE_COLOR_ATTACHMENTS;
-        _sg.limits.max_texture_bindings_per_stage = SG_MAX_PORTABLE_TEXTURE_BINDINGS_PER_STAGE;
-        if (_sg.features.compute) {
-            _sg.limits.max_storage_buffer_bindings_per_stage = SG_MAX_PORTABLE_STORAGEBUFFER_BINDINGS_PER_STAGE;
-            _sg.limits.max_storage_image_bindings_per_stage = SG_MAX_PORTABLE_STORAGEIMAGE_BINDINGS_PER_STAGE;
+SOKOL_API_IMPL void sg_destroy_context(sg_context ctx) {
+    #if defined(SOKOL_MULTI_CONTEXT)
+        SOKOL_ASSERT(ctx.id != _SG_DEFAULT_CONTEXT_ID);
+        _sg_context_slot_t* slot = _sg_lookup_context(ctx.id);
+        if ((0 == slot) || (ctx.id == _SG_DEFAULT_CONTEXT_ID)) {
+            return;
         }
-    }
+        _sg_state_t* state = _sg_context_slot_state(slot);
+        _sg_state_t* prev_state = (_sg_cur_state == state) ? &_sg_default_state : _sg_cur_state;
+        _sg_cur_state = state;
+        // NOTE: sg_shutdown() clears the state, including the allocator
+        const sg_allocator allocator = _sg.desc.allocator;
+        if (_sg.valid) {
+            sg_shutdown();
+        }
+        _sg_cur_state = prev_state;
+        _sg_context_release_slot(slot);
+        if (allocator.free_fn) {
+            allocator.free_fn(state, allocator.user_data);
+        } else {
+            free(state);
+        }
+    #else
+        _SOKOL_UNUSED(ctx);
+    #endif
 }
 
-// ██████  ██    ██ ██████  ██      ██  ██████
-// ██   ██ ██    ██ ██   ██ ██      ██ ██
-// ██████  ██    ██ ██████  ██      ██ ██
-// ██      ██    ██ ██   ██ ██      ██ ██
-// ██       ██████  ██████  ███████ ██  ██████
-//
-// >>public
-SOKOL_API_IMPL void sg_setup(const sg_desc* desc) {
-    SOKOL_ASSERT(!_sg.valid);
-    SOKOL_ASSERT(desc);
-    SOKOL_ASSERT((desc->_start_canary == 0) && (desc->_end_canary == 0));
-    SOKOL_ASSERT((desc->allocator.alloc_fn && desc->allocator.free_fn) || (!desc->allocator.alloc_fn && !desc->allocator.free_fn));
-    _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
-    _sg.desc = _sg_desc_defaults(desc);
-    _sg_setup_pools(&_sg.pools, &_sg.desc);
-    _sg_setup_commit_listeners(&_sg.desc);
-    _sg.frame_index = 1;
-    _sg.stats_enabled = true;
-    _sg_setup_backend(&_sg.desc);
-    _sg_override_portable_limits();
-    _sg.valid = true;
+SOKOL_API_IMPL void sg_set_context(sg_context ctx) {
+    #if defined(SOKOL_MULTI_CONTEXT)
+        _sg_context_slot_t* slot = _sg_lookup_context(ctx.id);
+        SOKOL_ASSERT(slot);
+        if (slot) {
+            _sg_cur_state = _sg_context_slot_state(slot);
+            #if defined(SOKOL_LOADER_THREADS)
+            _sg_loader_claim_render_thread();
+            #endif
+        }
+    #else
+        SOKOL_ASSERT(ctx.id == _SG_DEFAULT_CONTEXT_ID);
+        _SOKOL_UNUSED(ctx);
+    #endif
 }
 
-SOKOL_API_IMPL void sg_shutdown(void) {
-    SOKOL_ASSERT(_sg.valid);
-    _sg_discard_all_resources();
-    _sg_discard_backend();
-    _sg_discard_commit_listeners();
-    _sg_discard_pools(&_sg.pools);
-    _SG_CLEAR_ARC_STRUCT(_sg_state_t, _sg);
+SOKOL_API_IMPL sg_context sg_get_context(void) {
+    _SG_STRUCT(sg_context, res);
+    #if defined(SOKOL_MULTI_CONTEXT)
+        for (int i = 0; i < SG_MAX_CONTEXTS; i++) {
+            if (_sg_context_slot_state(&_sg_contexts[i]) == _sg_cur_state) {
+                res.id = _sg_contexts[i].id;
+                break;
+            }
+        }
+    #else
+        res.id = _SG_DEFAULT_CONTEXT_ID;
+    #endif
+    return res;
 }
 
-SOKOL_API_IMPL bool sg_isvalid(void) {
-    return _sg.valid;
+SOKOL_API_IMPL sg_context sg_default_context(void) {
+    _SG_STRUCT(sg_context, res);
+    res.id = _SG_DEFAULT_CONTEXT_ID;
+    return res;
 }
 
 SOKOL_API_IMPL sg_desc sg_query_desc(void) {
@@ -24896,9 +33556,15 @@ SOKOL_API_IMPL sg_stats sg_query_stats(void) {
     _sg_update_alive_free_resource_stats(&_sg.stats.total.samplers, &_sg.pools.sampler_pool);
     _sg_update_alive_free_resource_stats(&_sg.stats.total.shaders, &_sg.pools.shader_pool);
     _sg_update_alive_free_resource_stats(&_sg.stats.total.pipelines, &_sg.pools.pipeline_pool);
+    _sg_update_alive_free_resource_stats(&_sg.stats.total.counters, &_sg.pools.counter_pool);
     return _sg.stats;
 }
 
+SOKOL_API_IMPL sg_stats_history sg_query_stats_history(void) {
+    SOKOL_ASSERT(_sg.valid);
+    return _sg_query_stats_history();
+}
+
 SOKOL_API_IMPL sg_trace_hooks sg_install_trace_hooks(const sg_trace_hooks* trace_hooks) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(trace_hooks);
@@ -24955,6 +33621,13 @@ SOKOL_API_IMPL sg_view sg_alloc_view(void) {
     return res;
 }
 
+SOKOL_API_IMPL sg_counter sg_alloc_counter(void) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_counter res = _sg_alloc_counter();
+    _SG_TRACE_ARGS(alloc_counter, res);
+    return res;
+}
+
 SOKOL_API_IMPL void sg_dealloc_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
@@ -24998,7 +33671,7 @@ SOKOL_API_IMPL void sg_dealloc_shader(sg_shader shd_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
     if (shd) {
-        if (shd->slot.state == SG_RESOURCESTATE_ALLOC) {
+        if ((shd->slot.state == SG_RESOURCESTATE_ALLOC) && !shd->slot.compiling) {
             _sg_dealloc_shader(shd);
         } else {
             _SG_ERROR(DEALLOC_SHADER_INVALID_STATE);
@@ -25011,7 +33684,7 @@ SOKOL_API_IMPL void sg_dealloc_pipeline(sg_pipeline pip_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
-        if (pip->slot.state == SG_RESOURCESTATE_ALLOC) {
+        if ((pip->slot.state == SG_RESOURCESTATE_ALLOC) && !pip->slot.compiling) {
             _sg_dealloc_pipeline(pip);
         } else {
             _SG_ERROR(DEALLOC_PIPELINE_INVALID_STATE);
@@ -25033,6 +33706,19 @@ SOKOL_API_IMPL void sg_dealloc_view(sg_view view_id) {
     _SG_TRACE_ARGS(dealloc_view, view_id);
 }
 
+SOKOL_API_IMPL void sg_dealloc_counter(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        if (ctr->slot.state == SG_RESOURCESTATE_ALLOC) {
+            _sg_dealloc_counter(ctr);
+        } else {
+            _SG_ERROR(DEALLOC_COUNTER_INVALID_STATE);
+        }
+    }
+    _SG_TRACE_ARGS(dealloc_counter, ctr_id);
+}
+
 SOKOL_API_IMPL void sg_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     sg_buffer_desc desc_def = _sg_buffer_desc_defaults(desc);
@@ -25040,7 +33726,7 @@ SOKOL_API_IMPL void sg_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc)
     if (buf) {
         if (buf->slot.state == SG_RESOURCESTATE_ALLOC) {
             _sg_init_buffer(buf, &desc_def);
-            SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED));
+            SOKOL_ASSERT(_sg_slot_inited(&buf->slot));
         } else {
             _SG_ERROR(INIT_BUFFER_INVALID_STATE);
         }
@@ -25055,7 +33741,7 @@ SOKOL_API_IMPL void sg_init_image(sg_image img_id, const sg_image_desc* desc) {
     if (img) {
         if (img->slot.state == SG_RESOURCESTATE_ALLOC) {
             _sg_init_image(img, &desc_def);
-            SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED));
+            SOKOL_ASSERT(_sg_slot_inited(&img->slot));
         } else {
             _SG_ERROR(INIT_IMAGE_INVALID_STATE);
         }
@@ -25070,7 +33756,7 @@ SOKOL_API_IMPL void sg_init_sampler(sg_sampler smp_id, const sg_sampler_desc* de
     if (smp) {
         if (smp->slot.state == SG_RESOURCESTATE_ALLOC) {
             _sg_init_sampler(smp, &desc_def);
-            SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED));
+            SOKOL_ASSERT(_sg_slot_inited(&smp->slot));
         } else {
             _SG_ERROR(INIT_SAMPLER_INVALID_STATE);
         }
@@ -25083,9 +33769,9 @@ SOKOL_API_IMPL void sg_init_shader(sg_shader shd_id, const sg_shader_desc* desc)
     sg_shader_desc desc_def = _sg_shader_desc_defaults(desc);
     _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
     if (shd) {
-        if (shd->slot.state == SG_RESOURCESTATE_ALLOC) {
+        if ((shd->slot.state == SG_RESOURCESTATE_ALLOC) && !shd->slot.compiling) {
             _sg_init_shader(shd, &desc_def);
-            SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED));
+            SOKOL_ASSERT(_sg_slot_inited(&shd->slot));
         } else {
             _SG_ERROR(INIT_SHADER_INVALID_STATE);
         }
@@ -25098,9 +33784,9 @@ SOKOL_API_IMPL void sg_init_pipeline(sg_pipeline pip_id, const sg_pipeline_desc*
     sg_pipeline_desc desc_def = _sg_pipeline_desc_defaults(desc);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
-        if (pip->slot.state == SG_RESOURCESTATE_ALLOC) {
+        if ((pip->slot.state == SG_RESOURCESTATE_ALLOC) && !pip->slot.compiling) {
             _sg_init_pipeline(pip, &desc_def);
-            SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+            SOKOL_ASSERT(_sg_slot_inited(&pip->slot));
         } else {
             _SG_ERROR(INIT_PIPELINE_INVALID_STATE);
         }
@@ -25125,6 +33811,21 @@ SOKOL_API_IMPL void sg_init_view(sg_view view_id, const sg_view_desc* desc) {
     _SG_TRACE_ARGS(init_view, view_id, &desc_def);
 }
 
+SOKOL_API_IMPL void sg_init_counter(sg_counter ctr_id, const sg_counter_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_counter_desc desc_def = _sg_counter_desc_defaults(desc);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        if (ctr->slot.state == SG_RESOURCESTATE_ALLOC) {
+            _sg_init_counter(ctr, &desc_def);
+            SOKOL_ASSERT(_sg_slot_inited(&ctr->slot));
+        } else {
+            _SG_ERROR(INIT_COUNTER_INVALID_STATE);
+        }
+    }
+    _SG_TRACE_ARGS(init_counter, ctr_id, &desc_def);
+}
+
 SOKOL_API_IMPL void sg_uninit_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
@@ -25171,7 +33872,7 @@ SOKOL_API_IMPL void sg_uninit_shader(sg_shader shd_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
     if (shd) {
-        if ((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)) {
+        if (shd->slot.compiling || (shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_shader(shd);
             SOKOL_ASSERT(shd->slot.state == SG_RESOURCESTATE_ALLOC);
         } else if (shd->slot.state != SG_RESOURCESTATE_ALLOC) {
@@ -25185,7 +33886,7 @@ SOKOL_API_IMPL void sg_uninit_pipeline(sg_pipeline pip_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
-        if ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
+        if (pip->slot.compiling || (pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_pipeline(pip);
             SOKOL_ASSERT(pip->slot.state == SG_RESOURCESTATE_ALLOC);
         } else if (pip->slot.state != SG_RESOURCESTATE_ALLOC) {
@@ -25209,6 +33910,20 @@ SOKOL_API_IMPL void sg_uninit_view(sg_view view_id) {
     _SG_TRACE_ARGS(uninit_view, view_id);
 }
 
+SOKOL_API_IMPL void sg_uninit_counter(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        if ((ctr->slot.state == SG_RESOURCESTATE_VALID) || (ctr->slot.state == SG_RESOURCESTATE_FAILED)) {
+            _sg_uninit_counter(ctr);
+            SOKOL_ASSERT(ctr->slot.state == SG_RESOURCESTATE_ALLOC);
+        } else if (ctr->slot.state != SG_RESOURCESTATE_ALLOC) {
+            _SG_ERROR(UNINIT_COUNTER_INVALID_STATE);
+        }
+    }
+    _SG_TRACE_ARGS(uninit_counter, ctr_id);
+}
+
 SOKOL_API_IMPL void sg_fail_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
@@ -25287,6 +34002,19 @@ SOKOL_API_IMPL void sg_fail_view(sg_view view_id) {
     _SG_TRACE_ARGS(fail_view, view_id);
 }
 
+SOKOL_API_IMPL void sg_fail_counter(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        if (ctr->slot.state == SG_RESOURCESTATE_ALLOC) {
+            ctr->slot.state = SG_RESOURCESTATE_FAILED;
+        } else {
+            _SG_ERROR(FAIL_COUNTER_INVALID_STATE);
+        }
+    }
+    _SG_TRACE_ARGS(fail_counter, ctr_id);
+}
+
 SOKOL_API_IMPL sg_resource_state sg_query_buffer_state(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
@@ -25329,6 +34057,13 @@ SOKOL_API_IMPL sg_resource_state sg_query_view_state(sg_view view_id) {
     return res;
 }
 
+SOKOL_API_IMPL sg_resource_state sg_query_counter_state(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    sg_resource_state res = ctr ? ctr->slot.state : SG_RESOURCESTATE_INVALID;
+    return res;
+}
+
 SOKOL_API_IMPL sg_buffer sg_make_buffer(const sg_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(desc);
@@ -25338,7 +34073,7 @@ SOKOL_API_IMPL sg_buffer sg_make_buffer(const sg_buffer_desc* desc) {
         _sg_buffer_t* buf = _sg_buffer_at(buf_id.id);
         SOKOL_ASSERT(buf && (buf->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_buffer(buf, &desc_def);
-        SOKOL_ASSERT((buf->slot.state == SG_RESOURCESTATE_VALID) || (buf->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT(_sg_slot_inited(&buf->slot));
     }
     _SG_TRACE_ARGS(make_buffer, &desc_def, buf_id);
     return buf_id;
@@ -25353,7 +34088,7 @@ SOKOL_API_IMPL sg_image sg_make_image(const sg_image_desc* desc) {
         _sg_image_t* img = _sg_image_at(img_id.id);
         SOKOL_ASSERT(img && (img->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_image(img, &desc_def);
-        SOKOL_ASSERT((img->slot.state == SG_RESOURCESTATE_VALID) || (img->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT(_sg_slot_inited(&img->slot));
     }
     _SG_TRACE_ARGS(make_image, &desc_def, img_id);
     return img_id;
@@ -25368,7 +34103,7 @@ SOKOL_API_IMPL sg_sampler sg_make_sampler(const sg_sampler_desc* desc) {
         _sg_sampler_t* smp = _sg_sampler_at(smp_id.id);
         SOKOL_ASSERT(smp && (smp->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_sampler(smp, &desc_def);
-        SOKOL_ASSERT((smp->slot.state == SG_RESOURCESTATE_VALID) || (smp->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT(_sg_slot_inited(&smp->slot));
     }
     _SG_TRACE_ARGS(make_sampler, &desc_def, smp_id);
     return smp_id;
@@ -25383,7 +34118,7 @@ SOKOL_API_IMPL sg_shader sg_make_shader(const sg_shader_desc* desc) {
         _sg_shader_t* shd = _sg_shader_at(shd_id.id);
         SOKOL_ASSERT(shd && (shd->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_shader(shd, &desc_def);
-        SOKOL_ASSERT((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT(_sg_slot_inited(&shd->slot));
     }
     _SG_TRACE_ARGS(make_shader, &desc_def, shd_id);
     return shd_id;
@@ -25398,7 +34133,7 @@ SOKOL_API_IMPL sg_pipeline sg_make_pipeline(const sg_pipeline_desc* desc) {
         _sg_pipeline_t* pip = _sg_pipeline_at(pip_id.id);
         SOKOL_ASSERT(pip && (pip->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_pipeline(pip, &desc_def);
-        SOKOL_ASSERT((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT(_sg_slot_inited(&pip->slot));
     }
     _SG_TRACE_ARGS(make_pipeline, &desc_def, pip_id);
     return pip_id;
@@ -25413,12 +34148,27 @@ SOKOL_API_IMPL sg_view sg_make_view(const sg_view_desc* desc) {
         _sg_view_t* view = _sg_view_at(view_id.id);
         SOKOL_ASSERT(view && (view->slot.state == SG_RESOURCESTATE_ALLOC));
         _sg_init_view(view, &desc_def);
-        SOKOL_ASSERT((view->slot.state == SG_RESOURCESTATE_VALID) || (view->slot.state == SG_RESOURCESTATE_FAILED));
+        SOKOL_ASSERT(_sg_slot_inited(&view->slot));
     }
     _SG_TRACE_ARGS(make_view, &desc_def, view_id);
     return view_id;
 }
 
+SOKOL_API_IMPL sg_counter sg_make_counter(const sg_counter_desc* desc) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(desc);
+    sg_counter_desc desc_def = _sg_counter_desc_defaults(desc);
+    sg_counter ctr_id = _sg_alloc_counter();
+    if (ctr_id.id != SG_INVALID_ID) {
+        _sg_counter_t* ctr = _sg_counter_at(ctr_id.id);
+        SOKOL_ASSERT(ctr && (ctr->slot.state == SG_RESOURCESTATE_ALLOC));
+        _sg_init_counter(ctr, &desc_def);
+        SOKOL_ASSERT(_sg_slot_inited(&ctr->slot));
+    }
+    _SG_TRACE_ARGS(make_counter, &desc_def, ctr_id);
+    return ctr_id;
+}
+
 SOKOL_API_IMPL void sg_destroy_buffer(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _SG_TRACE_ARGS(destroy_buffer, buf_id);
@@ -25472,7 +34222,7 @@ SOKOL_API_IMPL void sg_destroy_shader(sg_shader shd_id) {
     _SG_TRACE_ARGS(destroy_shader, shd_id);
     _sg_shader_t* shd = _sg_lookup_shader(shd_id.id);
     if (shd) {
-        if ((shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)) {
+        if (shd->slot.compiling || (shd->slot.state == SG_RESOURCESTATE_VALID) || (shd->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_shader(shd);
             SOKOL_ASSERT(shd->slot.state == SG_RESOURCESTATE_ALLOC);
         }
@@ -25488,7 +34238,7 @@ SOKOL_API_IMPL void sg_destroy_pipeline(sg_pipeline pip_id) {
     _SG_TRACE_ARGS(destroy_pipeline, pip_id);
     _sg_pipeline_t* pip = _sg_lookup_pipeline(pip_id.id);
     if (pip) {
-        if ((pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
+        if (pip->slot.compiling || (pip->slot.state == SG_RESOURCESTATE_VALID) || (pip->slot.state == SG_RESOURCESTATE_FAILED)) {
             _sg_uninit_pipeline(pip);
             SOKOL_ASSERT(pip->slot.state == SG_RESOURCESTATE_ALLOC);
         }
@@ -25515,6 +34265,22 @@ SOKOL_API_IMPL void sg_destroy_view(sg_view view_id) {
     }
 }
 
+SOKOL_API_IMPL void sg_destroy_counter(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_TRACE_ARGS(destroy_counter, ctr_id);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        if ((ctr->slot.state == SG_RESOURCESTATE_VALID) || (ctr->slot.state == SG_RESOURCESTATE_FAILED)) {
+            _sg_uninit_counter(ctr);
+            SOKOL_ASSERT(ctr->slot.state == SG_RESOURCESTATE_ALLOC);
+        }
+        if (ctr->slot.state == SG_RESOURCESTATE_ALLOC) {
+            _sg_dealloc_counter(ctr);
+            SOKOL_ASSERT(ctr->slot.state == SG_RESOURCESTATE_INITIAL);
+        }
+    }
+}
+
 SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(!_sg.cur_pass.valid);
@@ -25523,6 +34289,7 @@ SOKOL_API_IMPL void sg_begin_pass(const sg_pass* pass) {
     SOKOL_ASSERT(pass);
     SOKOL_ASSERT((pass->_start_canary == 0) && (pass->_end_canary == 0));
     _sg.cur_pass.in_pass = true;
+    _sg_begin_pass_stats(pass);
     const sg_pass pass_def = _sg_pass_defaults(pass);
     _SG_TRACE_ARGS(begin_pass, &pass_def);
     if (!_sg_validate_pass_attachment_limits(&pass_def)) {
@@ -25604,6 +34371,14 @@ SOKOL_API_IMPL void sg_apply_pipeline(sg_pipeline pip_id) {
     if (!_sg.cur_pass.valid) {
         return;
     }
+    // a pipeline which is still compiling silently skips everything until the next sg_apply_pipeline()
+    const _sg_pipeline_t* compiling_pip = _sg_lookup_pipeline(pip_id.id);
+    _sg.cur_pip_compiling = compiling_pip && compiling_pip->slot.compiling;
+    if (_sg.cur_pip_compiling) {
+        _sg.cur_pip = _sg_pipeline_ref(0);
+        _sg.next_draw_valid = false;
+        return;
+    }
     if (!_sg_validate_apply_pipeline(pip_id)) {
         _sg.next_draw_valid = false;
         return;
@@ -25632,7 +34407,7 @@ SOKOL_API_IMPL void sg_apply_bindings(const sg_bindings* bindings) {
     SOKOL_ASSERT(bindings);
     _sg_stats_inc(num_apply_bindings);
     _SG_TRACE_ARGS(apply_bindings, bindings);
-    if (!_sg.cur_pass.valid) {
+    if (!_sg.cur_pass.valid || _sg.cur_pip_compiling) {
         return;
     }
     _sg.applied_bindings_and_uniforms |= (1 << SG_MAX_UNIFORMBLOCK_BINDSLOTS);
@@ -25702,7 +34477,7 @@ SOKOL_API_IMPL void sg_apply_uniforms(int ub_slot, const sg_range* data) {
     _sg_stats_inc(num_apply_uniforms);
     _sg_stats_add(size_apply_uniforms, (uint32_t)data->size);
     _SG_TRACE_ARGS(apply_uniforms, ub_slot, data);
-    if (!_sg.cur_pass.valid) {
+    if (!_sg.cur_pass.valid || _sg.cur_pip_compiling) {
         return;
     }
     _sg.applied_bindings_and_uniforms |= 1 << ub_slot;
@@ -25716,11 +34491,38 @@ SOKOL_API_IMPL void sg_apply_uniforms(int ub_slot, const sg_range* data) {
     _sg_apply_uniforms(ub_slot, data);
 }
 
+SOKOL_API_IMPL void sg_apply_uniform_buffer(int ub_slot, sg_buffer buf_id, int offset) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT((ub_slot >= 0) && (ub_slot < SG_MAX_UNIFORMBLOCK_BINDSLOTS));
+    _sg_stats_inc(num_apply_uniform_buffer);
+    _SG_TRACE_ARGS(apply_uniform_buffer, ub_slot, buf_id, offset);
+    if (!_sg.cur_pass.valid || _sg.cur_pip_compiling) {
+        return;
+    }
+    _sg.applied_bindings_and_uniforms |= 1 << ub_slot;
+    _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+    if (!_sg_validate_apply_uniform_buffer(ub_slot, buf, offset)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        return;
+    }
+    if ((0 == buf) || (buf->slot.state != SG_RESOURCESTATE_VALID)) {
+        _sg.next_draw_valid = false;
+        return;
+    }
+    _sg_apply_uniform_buffer(ub_slot, buf, offset);
+}
+
 _SOKOL_PRIVATE bool _sg_check_skip_draw(int num_elements, int num_instances) {
     if (!_sg.cur_pass.valid) {
         return true;
     }
     if (!_sg.next_draw_valid) {
+        if (_sg.cur_pip_compiling) {
+            _sg_stats_inc(num_skipped_draws);
+        }
         return true;
     }
     // skip no-op draws
@@ -25760,6 +34562,35 @@ SOKOL_API_IMPL void sg_draw_ex(int base_element, int num_elements, int num_insta
     _sg_draw(base_element, num_elements, num_instances, base_vertex, base_instance);
 }
 
+SOKOL_API_IMPL void sg_draw_batch(const sg_draw_args* args, int count) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(args || (count == 0));
+    _sg_stats_inc(num_draw_batch);
+    if (count > 0) {
+        _sg_stats_add(num_draw_batch_items, (uint32_t)count);
+    }
+    _SG_TRACE_ARGS(draw_batch, args, count);
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        if (_sg.cur_pip_compiling && (count > 0)) {
+            _sg_stats_add(num_skipped_draws, (uint32_t)count);
+        }
+        return;
+    }
+    #if defined(SOKOL_DEBUG)
+    if (!_sg_validate_draw_batch(args, count)) {
+        return;
+    }
+    #endif
+    // skip empty batches
+    if (count <= 0) {
+        return;
+    }
+    _sg_draw_batch(args, count);
+}
+
 SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_groups_z) {
     SOKOL_ASSERT(_sg.valid);
     _sg_stats_inc(num_dispatch);
@@ -25768,6 +34599,9 @@ SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_grou
         return;
     }
     if (!_sg.next_draw_valid) {
+        if (_sg.cur_pip_compiling) {
+            _sg_stats_inc(num_skipped_draws);
+        }
         return;
     }
     // skip no-op dispatches
@@ -25782,18 +34616,106 @@ SOKOL_API_IMPL void sg_dispatch(int num_groups_x, int num_groups_y, int num_grou
     _sg_dispatch(num_groups_x, num_groups_y, num_groups_z);
 }
 
+SOKOL_API_IMPL void sg_dispatch_indirect(sg_buffer buf_id, int offset) {
+    SOKOL_ASSERT(_sg.valid);
+    _sg_stats_inc(num_dispatch_indirect);
+    _SG_TRACE_ARGS(dispatch_indirect, buf_id, offset);
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    if (!_sg.next_draw_valid) {
+        if (_sg.cur_pip_compiling) {
+            _sg_stats_inc(num_skipped_draws);
+        }
+        return;
+    }
+    _sg_buffer_t* buf = _sg_lookup_buffer(buf_id.id);
+    #if defined(SOKOL_DEBUG)
+    if (!_sg_validate_dispatch_indirect(buf, offset)) {
+        return;
+    }
+    #endif
+    if ((0 == buf) || (buf->slot.state != SG_RESOURCESTATE_VALID)) {
+        return;
+    }
+    _sg_dispatch_indirect(buf, offset);
+}
+
+SOKOL_API_IMPL void sg_begin_counter(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_TRACE_ARGS(begin_counter, ctr_id);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    #if defined(SOKOL_DEBUG)
+    if (!_sg_validate_begin_counter(ctr)) {
+        return;
+    }
+    #endif
+    if (!_sg.cur_pass.valid) {
+        return;
+    }
+    if ((0 == ctr) || (ctr->slot.state != SG_RESOURCESTATE_VALID)) {
+        return;
+    }
+    if ((ctr->cmn.type == SG_COUNTERTYPE_OCCLUSION) && _sg.cur_pass.is_compute) {
+        return;
+    }
+    if ((_sg.cur_pass.counter_ids[ctr->cmn.type] != SG_INVALID_ID) || (ctr->cmn.recorded && (ctr->cmn.begin_frame_index == _sg.frame_index))) {
+        return;
+    }
+    _sg_begin_counter(ctr);
+    _sg.cur_pass.counter_ids[ctr->cmn.type] = ctr->slot.id;
+    ctr->cmn.recorded = true;
+    ctr->cmn.begin_frame_index = _sg.frame_index;
+}
+
+SOKOL_API_IMPL void sg_end_counter(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_TRACE_ARGS(end_counter, ctr_id);
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    #if defined(SOKOL_DEBUG)
+    if (!_sg_validate_end_counter(ctr)) {
+        return;
+    }
+    #endif
+    if ((0 == ctr) || (ctr->slot.state != SG_RESOURCESTATE_VALID) || (_sg.cur_pass.counter_ids[ctr->cmn.type] != ctr->slot.id)) {
+        return;
+    }
+    _sg_end_counter(ctr);
+    _sg.cur_pass.counter_ids[ctr->cmn.type] = SG_INVALID_ID;
+    if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+        _sg_counter_result(ctr);
+        _sg_pass_stats_pipeline_stats(ctr);
+    }
+}
+
 SOKOL_API_IMPL void sg_end_pass(void) {
     SOKOL_ASSERT(_sg.valid);
     SOKOL_ASSERT(_sg.cur_pass.in_pass);
     _sg_stats_inc(num_passes);
     _SG_TRACE_NOARGS(end_pass);
+    for (int i = 0; i < _SG_COUNTERTYPE_NUM; i++) {
+        if (_sg.cur_pass.counter_ids[i] != SG_INVALID_ID) {
+            _sg_counter_t* ctr = _sg_lookup_counter(_sg.cur_pass.counter_ids[i]);
+            if (ctr) {
+                _SG_WARN(END_PASS_COUNTER_STILL_ACTIVE);
+                _sg_end_counter(ctr);
+                if (ctr->cmn.type == SG_COUNTERTYPE_PIPELINE_STATISTICS) {
+                    _sg_counter_result(ctr);
+                    _sg_pass_stats_pipeline_stats(ctr);
+                }
+            }
+            _sg.cur_pass.counter_ids[i] = SG_INVALID_ID;
+        }
+    }
     // NOTE: don't exit early if !_sg.cur_pass.valid
     if (!_sg.cur_pass.swapchain.invalid) {
         const _sg_attachments_ptrs_t atts_ptrs = _sg_attachments_ptrs(&_sg.cur_pass.atts);
         _sg_end_pass(&atts_ptrs);
     }
     _sg.cur_pip = _sg_pipeline_ref(0);
+    _sg.cur_pip_compiling = false;
     _sg_clear(&_sg.cur_pass, sizeof(_sg.cur_pass));
+    _sg_end_pass_stats();
 }
 
 SOKOL_API_IMPL void sg_commit(void) {
@@ -25801,6 +34723,10 @@ SOKOL_API_IMPL void sg_commit(void) {
     SOKOL_ASSERT(!_sg.cur_pass.valid);
     SOKOL_ASSERT(!_sg.cur_pass.in_pass);
     _sg_commit();
+    #if defined(SOKOL_LOADER_THREADS)
+    _sg_loader_publish();
+    #endif
+    _sg_compile_poll();
     _sg_update_stats();
     _sg_notify_commit_listeners();
     _SG_TRACE_NOARGS(commit);
@@ -26045,6 +34971,18 @@ SOKOL_API_IMPL sg_view_info sg_query_view_info(sg_view view_id) {
     return info;
 }
 
+SOKOL_API_IMPL sg_counter_info sg_query_counter_info(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_STRUCT(sg_counter_info, info);
+    const _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        info.slot.state = ctr->slot.state;
+        info.slot.res_id = ctr->slot.id;
+        info.slot.uninit_count = ctr->slot.uninit_count;
+    }
+    return info;
+}
+
 SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_desc(sg_buffer buf_id) {
     SOKOL_ASSERT(_sg.valid);
     _SG_STRUCT(sg_buffer_desc, desc);
@@ -26197,6 +35135,46 @@ SOKOL_API_IMPL sg_buffer sg_query_view_buffer(sg_view view_id) {
     return buf;
 }
 
+SOKOL_API_IMPL int sg_query_view_bindless_index(sg_view view_id) {
+    SOKOL_ASSERT(_sg.valid);
+    int index = 0;
+    #if defined(SOKOL_VULKAN)
+    const _sg_view_t* view = _sg_lookup_view(view_id.id);
+    if (view) {
+        index = view->vk.bindless_index;
+    }
+    #else
+    _SOKOL_UNUSED(view_id);
+    #endif
+    return index;
+}
+
+SOKOL_API_IMPL int sg_query_sampler_bindless_index(sg_sampler smp_id) {
+    SOKOL_ASSERT(_sg.valid);
+    int index = 0;
+    #if defined(SOKOL_VULKAN)
+    const _sg_sampler_t* smp = _sg_lookup_sampler(smp_id.id);
+    if (smp) {
+        index = smp->vk.bindless_index;
+    }
+    #else
+    _SOKOL_UNUSED(smp_id);
+    #endif
+    return index;
+}
+
+SOKOL_API_IMPL sg_counter_value sg_query_counter_value(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    sg_counter_value res;
+    _sg_clear(&res, sizeof(res));
+    _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr && (ctr->slot.state == SG_RESOURCESTATE_VALID)) {
+        _sg_counter_result(ctr);
+        res = ctr->cmn.result;
+    }
+    return res;
+}
+
 SOKOL_API_IMPL sg_sampler_desc sg_query_sampler_desc(sg_sampler smp_id) {
     SOKOL_ASSERT(_sg.valid);
     _SG_STRUCT(sg_sampler_desc, desc);
@@ -26334,6 +35312,16 @@ SOKOL_API_IMPL sg_view_desc sg_query_view_desc(sg_view view_id) {
     return desc;
 }
 
+SOKOL_API_IMPL sg_counter_desc sg_query_counter_desc(sg_counter ctr_id) {
+    SOKOL_ASSERT(_sg.valid);
+    _SG_STRUCT(sg_counter_desc, desc);
+    const _sg_counter_t* ctr = _sg_lookup_counter(ctr_id.id);
+    if (ctr) {
+        desc.type = ctr->cmn.type;
+    }
+    return desc;
+}
+
 SOKOL_API_IMPL sg_buffer_desc sg_query_buffer_defaults(const sg_buffer_desc* desc) {
     SOKOL_ASSERT(_sg.valid && desc);
     return _sg_buffer_desc_defaults(desc);
@@ -26364,6 +35352,11 @@ SOKOL_API_IMPL sg_view_desc sg_query_view_defaults(const sg_view_desc* desc) {
     return _sg_view_desc_defaults(desc);
 }
 
+SOKOL_API_IMPL sg_counter_desc sg_query_counter_defaults(const sg_counter_desc* desc) {
+    SOKOL_ASSERT(_sg.valid && desc);
+    return _sg_counter_desc_defaults(desc);
+}
+
 SOKOL_API_IMPL const void* sg_d3d11_device(void) {
     #if defined(SOKOL_D3D11)
         return (const void*) _sg.d3d11.dev;
@@ -26832,6 +35825,91 @@ SOKOL_API_IMPL sg_gl_view_info sg_gl_query_view_info(sg_view view_id) {
     return res;
 }
 
+SOKOL_API_IMPL void sg_sw_sample(const sg_sw_shader_context* ctx, int view_slot, int sampler_slot, const float uvw[3], float lod, float out_rgba[4]) {
+    SOKOL_ASSERT(ctx && uvw && out_rgba);
+    SOKOL_ASSERT((view_slot >= 0) && (view_slot < SG_MAX_VIEW_BINDSLOTS));
+    SOKOL_ASSERT((sampler_slot >= 0) && (sampler_slot < SG_MAX_SAMPLER_BINDSLOTS));
+    #if defined(SOKOL_SOFTWARE)
+        _sg_sw_sample(ctx, view_slot, sampler_slot, uvw, lod, out_rgba);
+    #else
+        _SOKOL_UNUSED(ctx);
+        _SOKOL_UNUSED(view_slot);
+        _SOKOL_UNUSED(sampler_slot);
+        _SOKOL_UNUSED(uvw);
+        _SOKOL_UNUSED(lod);
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = out_rgba[3] = 0.0f;
+    #endif
+}
+
+SOKOL_API_IMPL float sg_sw_sample_compare(const sg_sw_shader_context* ctx, int view_slot, int sampler_slot, const float uvw[3], float lod, float ref) {
+    SOKOL_ASSERT(ctx && uvw);
+    SOKOL_ASSERT((view_slot >= 0) && (view_slot < SG_MAX_VIEW_BINDSLOTS));
+    SOKOL_ASSERT((sampler_slot >= 0) && (sampler_slot < SG_MAX_SAMPLER_BINDSLOTS));
+    #if defined(SOKOL_SOFTWARE)
+        return _sg_sw_sample_compare(ctx, view_slot, sampler_slot, uvw, lod, ref);
+    #else
+        _SOKOL_UNUSED(ctx);
+        _SOKOL_UNUSED(view_slot);
+        _SOKOL_UNUSED(sampler_slot);
+        _SOKOL_UNUSED(uvw);
+        _SOKOL_UNUSED(lod);
+        _SOKOL_UNUSED(ref);
+        return 0.0f;
+    #endif
+}
+
+SOKOL_API_IMPL void sg_sw_image_load(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z, float out_rgba[4]) {
+    SOKOL_ASSERT(ctx && out_rgba);
+    SOKOL_ASSERT((view_slot >= 0) && (view_slot < SG_MAX_VIEW_BINDSLOTS));
+    #if defined(SOKOL_SOFTWARE)
+        _sg_sw_image_load(ctx, view_slot, x, y, z, out_rgba);
+    #else
+        _SOKOL_UNUSED(ctx);
+        _SOKOL_UNUSED(view_slot);
+        _SOKOL_UNUSED(x);
+        _SOKOL_UNUSED(y);
+        _SOKOL_UNUSED(z);
+        out_rgba[0] = out_rgba[1] = out_rgba[2] = out_rgba[3] = 0.0f;
+    #endif
+}
+
+SOKOL_API_IMPL void sg_sw_image_store(const sg_sw_shader_context* ctx, int view_slot, int x, int y, int z, const float rgba[4]) {
+    SOKOL_ASSERT(ctx && rgba);
+    SOKOL_ASSERT((view_slot >= 0) && (view_slot < SG_MAX_VIEW_BINDSLOTS));
+    #if defined(SOKOL_SOFTWARE)
+        _sg_sw_image_store(ctx, view_slot, x, y, z, rgba);
+    #else
+        _SOKOL_UNUSED(ctx);
+        _SOKOL_UNUSED(view_slot);
+        _SOKOL_UNUSED(x);
+        _SOKOL_UNUSED(y);
+        _SOKOL_UNUSED(z);
+        _SOKOL_UNUSED(rgba);
+    #endif
+}
+
+SOKOL_API_IMPL bool sg_sw_read_image(sg_image img_id, int mip_level, int slice, const sg_range* data) {
+    SOKOL_ASSERT(_sg.valid);
+    SOKOL_ASSERT(data && data->ptr);
+    #if defined(SOKOL_SOFTWARE)
+        _sg_image_t* img = _sg_lookup_image(img_id.id);
+        if ((0 == img) || (img->slot.state != SG_RESOURCESTATE_VALID)
+            || (mip_level < 0) || (mip_level >= img->cmn.num_mipmaps)
+            || (slice < 0) || (slice >= _sg_sw_mip_slices(img, mip_level)))
+        {
+            _SG_ERROR(SOFTWARE_READ_IMAGE_INVALID);
+            return false;
+        }
+        return _sg_sw_read_image(img, mip_level, slice, data);
+    #else
+        _SOKOL_UNUSED(img_id);
+        _SOKOL_UNUSED(mip_level);
+        _SOKOL_UNUSED(slice);
+        _SOKOL_UNUSED(data);
+        return false;
+    #endif
+}
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
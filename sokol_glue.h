@@ -172,6 +172,12 @@ SOKOL_API_IMPL sg_environment sglue_environment(void) {
     res.vulkan.device = env.vulkan.device;
     res.vulkan.queue = env.vulkan.queue;
     res.vulkan.queue_family_index = env.vulkan.queue_family_index;
+    res.vulkan.compute_queue = env.vulkan.compute_queue;
+    res.vulkan.compute_queue_family_index = env.vulkan.compute_queue_family_index;
+    res.vulkan.timeline_semaphore = env.vulkan.timeline_semaphore;
+    res.vulkan.host_query_reset = env.vulkan.host_query_reset;
+    res.vulkan.pipeline_statistics_query = env.vulkan.pipeline_statistics_query;
+    res.vulkan.descriptor_indexing = env.vulkan.descriptor_indexing;
     return res;
 }
 
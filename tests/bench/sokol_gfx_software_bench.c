@@ -0,0 +1,297 @@
+//------------------------------------------------------------------------------
+//  sokol_gfx_software_bench.c
+//
+//  Throughput benchmark for the sokol-gfx software backend (SOKOL_SOFTWARE).
+//
+//  Renders a number of frames into a 1920x1080 offscreen render target for
+//  a few workloads which stress different parts of the rasterizer:
+//
+//  - small_tris:   many small depth-tested triangles (vertex processing and setup)
+//  - overdraw:     blended fullscreen triangles (fill rate and blending)
+//  - textured:     fullscreen triangles sampling a texture (fragment shading)
+//
+//  Usage: sokol-gfx-software-bench [num_threads] [num_frames]
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#define SOKOL_SOFTWARE
+#include "sokol_gfx.h"
+#include "sokol_log.h"
+#include "sokol_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define WIDTH (1920)
+#define HEIGHT (1080)
+#define GRID_X (256)
+#define GRID_Y (144)
+#define NUM_GRID_TRIS (GRID_X * GRID_Y * 2)
+#define NUM_OVERDRAW_LAYERS (8)
+
+typedef struct {
+    float x, y, z;
+    float r, g, b, a;
+} vertex_t;
+
+static struct {
+    sg_image color_img;
+    sg_image depth_img;
+    sg_view color_att;
+    sg_view depth_att;
+    sg_buffer grid_vbuf;
+    sg_buffer grid_ibuf;
+    sg_buffer fs_vbuf;
+    sg_view tex_view;
+    sg_sampler smp;
+    sg_pipeline color_pip;
+    sg_pipeline blend_pip;
+    sg_pipeline tex_pip;
+} state;
+
+static void vs_color(const sg_sw_shader_context* ctx, sg_sw_vertex* vtx) {
+    (void)ctx;
+    vtx->pos[0] = vtx->attrs[0][0];
+    vtx->pos[1] = vtx->attrs[0][1];
+    vtx->pos[2] = vtx->attrs[0][2];
+    vtx->pos[3] = 1.0f;
+    for (int i = 0; i < 4; i++) {
+        vtx->varyings[i] = vtx->attrs[1][i];
+    }
+}
+
+static bool fs_color(const sg_sw_shader_context* ctx, sg_sw_fragment* frag) {
+    (void)ctx;
+    for (int i = 0; i < 4; i++) {
+        frag->colors[0][i] = frag->varyings[i];
+    }
+    return true;
+}
+
+static void vs_tex(const sg_sw_shader_context* ctx, sg_sw_vertex* vtx) {
+    (void)ctx;
+    vtx->pos[0] = vtx->attrs[0][0];
+    vtx->pos[1] = vtx->attrs[0][1];
+    vtx->pos[2] = vtx->attrs[0][2];
+    vtx->pos[3] = 1.0f;
+    vtx->varyings[0] = (vtx->attrs[0][0] * 0.5f + 0.5f) * 8.0f;
+    vtx->varyings[1] = (0.5f - vtx->attrs[0][1] * 0.5f) * 8.0f;
+}
+
+static bool fs_tex(const sg_sw_shader_context* ctx, sg_sw_fragment* frag) {
+    const float uvw[3] = { frag->varyings[0], frag->varyings[1], 0.0f };
+    sg_sw_sample(ctx, 0, 0, uvw, 0.0f, frag->colors[0]);
+    return true;
+}
+
+static void init(void) {
+    state.color_img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = WIDTH,
+        .height = HEIGHT,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    state.depth_img = sg_make_image(&(sg_image_desc){
+        .usage.depth_stencil_attachment = true,
+        .width = WIDTH,
+        .height = HEIGHT,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+    });
+    state.color_att = sg_make_view(&(sg_view_desc){ .color_attachment.image = state.color_img });
+    state.depth_att = sg_make_view(&(sg_view_desc){ .depth_stencil_attachment.image = state.depth_img });
+
+    // a grid of small triangles covering the whole render target
+    const size_t num_grid_verts = (GRID_X + 1) * (GRID_Y + 1);
+    vertex_t* verts = (vertex_t*) calloc(num_grid_verts, sizeof(vertex_t));
+    uint32_t* indices = (uint32_t*) calloc(NUM_GRID_TRIS * 3, sizeof(uint32_t));
+    for (int y = 0; y <= GRID_Y; y++) {
+        for (int x = 0; x <= GRID_X; x++) {
+            vertex_t* v = &verts[y * (GRID_X + 1) + x];
+            v->x = ((float)x / GRID_X) * 2.0f - 1.0f;
+            v->y = ((float)y / GRID_Y) * 2.0f - 1.0f;
+            v->z = 0.5f;
+            v->r = (float)x / GRID_X;
+            v->g = (float)y / GRID_Y;
+            v->b = 0.5f;
+            v->a = 1.0f;
+        }
+    }
+    uint32_t* idx = indices;
+    for (uint32_t y = 0; y < GRID_Y; y++) {
+        for (uint32_t x = 0; x < GRID_X; x++) {
+            const uint32_t i0 = y * (GRID_X + 1) + x;
+            const uint32_t i1 = i0 + 1;
+            const uint32_t i2 = i0 + (GRID_X + 1);
+            const uint32_t i3 = i2 + 1;
+            *idx++ = i0; *idx++ = i1; *idx++ = i2;
+            *idx++ = i2; *idx++ = i1; *idx++ = i3;
+        }
+    }
+    state.grid_vbuf = sg_make_buffer(&(sg_buffer_desc){
+        .data = { .ptr = verts, .size = num_grid_verts * sizeof(vertex_t) },
+    });
+    state.grid_ibuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.index_buffer = true,
+        .data = { .ptr = indices, .size = NUM_GRID_TRIS * 3 * sizeof(uint32_t) },
+    });
+    free(verts);
+    free(indices);
+
+    // a fullscreen triangle per overdraw layer
+    vertex_t fs_verts[NUM_OVERDRAW_LAYERS * 3];
+    for (int i = 0; i < NUM_OVERDRAW_LAYERS; i++) {
+        const float z = 0.1f + 0.1f * (float)i;
+        fs_verts[i*3 + 0] = (vertex_t){ -1.0f, -1.0f, z, 1.0f, 0.5f, 0.25f, 0.25f };
+        fs_verts[i*3 + 1] = (vertex_t){ -1.0f, +3.0f, z, 1.0f, 0.5f, 0.25f, 0.25f };
+        fs_verts[i*3 + 2] = (vertex_t){ +3.0f, -1.0f, z, 1.0f, 0.5f, 0.25f, 0.25f };
+    }
+    state.fs_vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(fs_verts) });
+
+    // a checkerboard texture
+    uint32_t pixels[64 * 64];
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 64; x++) {
+            pixels[y * 64 + x] = (((x ^ y) & 8) != 0) ? 0xFFFFFFFF : 0xFF202020;
+        }
+    }
+    state.tex_view = sg_make_view(&(sg_view_desc){
+        .texture.image = sg_make_image(&(sg_image_desc){
+            .width = 64,
+            .height = 64,
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+            .data.mip_levels[0] = SG_RANGE(pixels),
+        }),
+    });
+    state.smp = sg_make_sampler(&(sg_sampler_desc){
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+        .wrap_u = SG_WRAP_REPEAT,
+        .wrap_v = SG_WRAP_REPEAT,
+    });
+
+    sg_shader color_shd = sg_make_shader(&(sg_shader_desc){
+        .software = { .vertex_func = vs_color, .fragment_func = fs_color, .num_varyings = 4 },
+    });
+    sg_shader tex_shd = sg_make_shader(&(sg_shader_desc){
+        .software = { .vertex_func = vs_tex, .fragment_func = fs_tex, .num_varyings = 2 },
+        .views[0].texture = { .stage = SG_SHADERSTAGE_FRAGMENT },
+        .samplers[0] = { .stage = SG_SHADERSTAGE_FRAGMENT },
+        .texture_sampler_pairs[0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 0, .sampler_slot = 0 },
+    });
+    const sg_vertex_layout_state layout = {
+        .attrs = {
+            [0].format = SG_VERTEXFORMAT_FLOAT3,
+            [1].format = SG_VERTEXFORMAT_FLOAT4,
+        },
+    };
+    const sg_depth_state depth = {
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+        .compare = SG_COMPAREFUNC_LESS_EQUAL,
+        .write_enabled = true,
+    };
+    state.color_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = color_shd,
+        .layout = layout,
+        .index_type = SG_INDEXTYPE_UINT32,
+        .depth = depth,
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    state.blend_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = color_shd,
+        .layout = layout,
+        .depth = { .pixel_format = SG_PIXELFORMAT_DEPTH, .compare = SG_COMPAREFUNC_ALWAYS },
+        .colors[0] = {
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            },
+        },
+    });
+    state.tex_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = tex_shd,
+        .layout = layout,
+        .depth = depth,
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+}
+
+static void begin_pass(void) {
+    sg_begin_pass(&(sg_pass){
+        .action = {
+            .colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+            .depth = { .load_action = SG_LOADACTION_CLEAR, .clear_value = 1.0f },
+        },
+        .attachments = { .colors[0] = state.color_att, .depth_stencil = state.depth_att },
+    });
+}
+
+static void frame_small_tris(void) {
+    begin_pass();
+    sg_apply_pipeline(state.color_pip);
+    sg_apply_bindings(&(sg_bindings){
+        .vertex_buffers[0] = state.grid_vbuf,
+        .index_buffer = state.grid_ibuf,
+    });
+    sg_draw(0, NUM_GRID_TRIS * 3, 1);
+    sg_end_pass();
+    sg_commit();
+}
+
+static void frame_overdraw(void) {
+    begin_pass();
+    sg_apply_pipeline(state.blend_pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = state.fs_vbuf });
+    sg_draw(0, NUM_OVERDRAW_LAYERS * 3, 1);
+    sg_end_pass();
+    sg_commit();
+}
+
+static void frame_textured(void) {
+    begin_pass();
+    sg_apply_pipeline(state.tex_pip);
+    sg_apply_bindings(&(sg_bindings){
+        .vertex_buffers[0] = state.fs_vbuf,
+        .views[0] = state.tex_view,
+        .samplers[0] = state.smp,
+    });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+}
+
+static void run(const char* name, void (*frame_func)(void), int num_frames) {
+    // warm up
+    frame_func();
+    uint64_t num_prims = 0;
+    uint64_t num_frags = 0;
+    const uint64_t start = stm_now();
+    for (int i = 0; i < num_frames; i++) {
+        frame_func();
+        const sg_frame_stats_sw sw = sg_query_stats().prev_frame.sw;
+        num_prims += sw.num_primitives;
+        num_frags += sw.num_fragments;
+    }
+    const double secs = stm_sec(stm_since(start));
+    printf("%-12s %8.3f ms/frame %10.2f Mprims/s %10.2f Mfrags/s\n",
+        name,
+        (secs * 1000.0) / num_frames,
+        ((double)num_prims / secs) / 1000000.0,
+        ((double)num_frags / secs) / 1000000.0);
+}
+
+int main(int argc, char* argv[]) {
+    const int num_threads = (argc > 1) ? atoi(argv[1]) : 0;
+    const int num_frames = (argc > 2) ? atoi(argv[2]) : 100;
+    stm_setup();
+    sg_setup(&(sg_desc){
+        .software.num_threads = num_threads,
+        .logger.func = slog_func,
+    });
+    init();
+    printf("%dx%d, %d frames, %s threads\n", WIDTH, HEIGHT, num_frames, (num_threads > 0) ? argv[1] : "default");
+    run("small_tris", frame_small_tris, num_frames);
+    run("overdraw", frame_overdraw, num_frames);
+    run("textured", frame_textured, num_frames);
+    sg_shutdown();
+    return 0;
+}
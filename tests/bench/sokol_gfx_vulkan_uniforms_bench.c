@@ -0,0 +1,323 @@
+//------------------------------------------------------------------------------
+//  sokol_gfx_vulkan_uniforms_bench.c
+//
+//  Uniform update benchmark for the sokol-gfx Vulkan backend (SOKOL_VULKAN).
+//
+//  Creates a headless Vulkan device (e.g. lavapipe via VK_ICD_FILENAMES)
+//  and records many degenerate draws into a 256x256 offscreen render target, with
+//  one sg_apply_uniforms() call per draw. Two variants of the same vertex
+//  shader are compared:
+//
+//  - uniform_buffer:   the uniform block lives in set=0 (descriptor buffer
+//                      offset update per sg_apply_uniforms())
+//  - push_constant:    the uniform block is declared with
+//                      .spirv_push_constant = true (vkCmdPushConstants())
+//
+//  The shaders are tiny hand-assembled SPIR-V blobs equivalent to:
+//
+//      layout(push_constant) uniform vs_params { vec4 pos; };    // or:
+//      layout(set=0, binding=0) uniform vs_params { vec4 pos; };
+//      void main() { gl_Position = pos; }
+//
+//      layout(location=0) out vec4 frag_color;
+//      void main() { frag_color = vec4(1.0); }
+//
+//  Usage: sokol-gfx-vulkan-uniforms-bench [draws_per_frame] [num_frames]
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#define SOKOL_VULKAN
+#include "sokol_gfx.h"
+#include "sokol_log.h"
+#include "sokol_time.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define WIDTH (256)
+#define HEIGHT (256)
+
+static const uint32_t vs_push_constant_spirv[92] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000011, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000000,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00040047, 0x00000002,
+    0x0000000b, 0x00000000, 0x00030047, 0x00000008, 0x00000002, 0x00050048,
+    0x00000008, 0x00000000, 0x00000023, 0x00000000, 0x00020013, 0x00000003,
+    0x00030021, 0x00000004, 0x00000003, 0x00030016, 0x00000005, 0x00000020,
+    0x00040017, 0x00000006, 0x00000005, 0x00000004, 0x00040020, 0x00000007,
+    0x00000003, 0x00000006, 0x0004003b, 0x00000007, 0x00000002, 0x00000003,
+    0x0003001e, 0x00000008, 0x00000006, 0x00040020, 0x00000009, 0x00000009,
+    0x00000008, 0x0004003b, 0x00000009, 0x0000000a, 0x00000009, 0x00040015,
+    0x0000000b, 0x00000020, 0x00000001, 0x0004002b, 0x0000000b, 0x0000000c,
+    0x00000000, 0x00040020, 0x0000000d, 0x00000009, 0x00000006, 0x00050036,
+    0x00000003, 0x00000001, 0x00000000, 0x00000004, 0x000200f8, 0x0000000e,
+    0x00050041, 0x0000000d, 0x0000000f, 0x0000000a, 0x0000000c, 0x0004003d,
+    0x00000006, 0x00000010, 0x0000000f, 0x0003003e, 0x00000002, 0x00000010,
+    0x000100fd, 0x00010038,
+};
+
+static const uint32_t vs_uniform_buffer_spirv[100] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000011, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000000,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00040047, 0x00000002,
+    0x0000000b, 0x00000000, 0x00030047, 0x00000008, 0x00000002, 0x00050048,
+    0x00000008, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x0000000a,
+    0x00000022, 0x00000000, 0x00040047, 0x0000000a, 0x00000021, 0x00000000,
+    0x00020013, 0x00000003, 0x00030021, 0x00000004, 0x00000003, 0x00030016,
+    0x00000005, 0x00000020, 0x00040017, 0x00000006, 0x00000005, 0x00000004,
+    0x00040020, 0x00000007, 0x00000003, 0x00000006, 0x0004003b, 0x00000007,
+    0x00000002, 0x00000003, 0x0003001e, 0x00000008, 0x00000006, 0x00040020,
+    0x00000009, 0x00000002, 0x00000008, 0x0004003b, 0x00000009, 0x0000000a,
+    0x00000002, 0x00040015, 0x0000000b, 0x00000020, 0x00000001, 0x0004002b,
+    0x0000000b, 0x0000000c, 0x00000000, 0x00040020, 0x0000000d, 0x00000002,
+    0x00000006, 0x00050036, 0x00000003, 0x00000001, 0x00000000, 0x00000004,
+    0x000200f8, 0x0000000e, 0x00050041, 0x0000000d, 0x0000000f, 0x0000000a,
+    0x0000000c, 0x0004003d, 0x00000006, 0x00000010, 0x0000000f, 0x0003003e,
+    0x00000002, 0x00000010, 0x000100fd, 0x00010038,
+};
+
+static const uint32_t fs_spirv[66] = {
+    0x07230203, 0x00010000, 0x00000000, 0x0000000b, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000004,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00030010, 0x00000001,
+    0x00000007, 0x00040047, 0x00000002, 0x0000001e, 0x00000000, 0x00020013,
+    0x00000003, 0x00030021, 0x00000004, 0x00000003, 0x00030016, 0x00000005,
+    0x00000020, 0x00040017, 0x00000006, 0x00000005, 0x00000004, 0x00040020,
+    0x00000007, 0x00000003, 0x00000006, 0x0004003b, 0x00000007, 0x00000002,
+    0x00000003, 0x0004002b, 0x00000005, 0x00000008, 0x3f800000, 0x0007002c,
+    0x00000006, 0x00000009, 0x00000008, 0x00000008, 0x00000008, 0x00000008,
+    0x00050036, 0x00000003, 0x00000001, 0x00000000, 0x00000004, 0x000200f8,
+    0x0000000a, 0x0003003e, 0x00000002, 0x00000009, 0x000100fd, 0x00010038,
+};
+
+static struct {
+    VkInstance instance;
+    VkPhysicalDevice phys_dev;
+    VkDevice device;
+    VkQueue queue;
+    uint32_t queue_family_index;
+    sg_view color_att;
+    sg_pipeline ub_pip;
+    sg_pipeline pc_pip;
+} state;
+
+static void fatal(const char* msg) {
+    fprintf(stderr, "%s\n", msg);
+    exit(10);
+}
+
+static void create_device(void) {
+    VkApplicationInfo app_info = {
+        .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+        .pApplicationName = "sokol-gfx-vulkan-uniforms-bench",
+        .apiVersion = VK_API_VERSION_1_3,
+    };
+    VkInstanceCreateInfo inst_create_info = {
+        .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+        .pApplicationInfo = &app_info,
+    };
+    if (vkCreateInstance(&inst_create_info, 0, &state.instance) != VK_SUCCESS) {
+        fatal("vkCreateInstance() failed");
+    }
+
+    // just pick the first physical device with a graphics+compute+transfer queue
+    uint32_t num_phys_devs = 0;
+    vkEnumeratePhysicalDevices(state.instance, &num_phys_devs, 0);
+    if (num_phys_devs == 0) {
+        fatal("no Vulkan physical devices found");
+    }
+    VkPhysicalDevice* phys_devs = (VkPhysicalDevice*) calloc(num_phys_devs, sizeof(VkPhysicalDevice));
+    vkEnumeratePhysicalDevices(state.instance, &num_phys_devs, phys_devs);
+    const VkQueueFlags queue_flags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    bool found = false;
+    for (uint32_t i = 0; (i < num_phys_devs) && !found; i++) {
+        uint32_t num_qf = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(phys_devs[i], &num_qf, 0);
+        VkQueueFamilyProperties* qf_props = (VkQueueFamilyProperties*) calloc(num_qf, sizeof(VkQueueFamilyProperties));
+        vkGetPhysicalDeviceQueueFamilyProperties(phys_devs[i], &num_qf, qf_props);
+        for (uint32_t qfi = 0; qfi < num_qf; qfi++) {
+            if ((qf_props[qfi].queueFlags & queue_flags) == queue_flags) {
+                state.phys_dev = phys_devs[i];
+                state.queue_family_index = qfi;
+                found = true;
+                break;
+            }
+        }
+        free(qf_props);
+    }
+    free(phys_devs);
+    if (!found) {
+        fatal("no suitable Vulkan physical device found");
+    }
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(state.phys_dev, &props);
+    printf("device: %s\n", props.deviceName);
+
+    // same requirements as sokol_app.h, minus the swapchain extension
+    const float queue_priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_create_info = {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+        .queueFamilyIndex = state.queue_family_index,
+        .queueCount = 1,
+        .pQueuePriorities = &queue_priority,
+    };
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptor_buffer_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+        .descriptorBuffer = VK_TRUE,
+    };
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT xds_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT,
+        .pNext = &descriptor_buffer_features,
+        .extendedDynamicState = VK_TRUE,
+    };
+    VkPhysicalDeviceVulkan12Features vk12_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+        .pNext = &xds_features,
+        .bufferDeviceAddress = VK_TRUE,
+        .timelineSemaphore = VK_TRUE,
+    };
+    VkPhysicalDeviceVulkan13Features vk13_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
+        .pNext = &vk12_features,
+        .dynamicRendering = VK_TRUE,
+        .synchronization2 = VK_TRUE,
+    };
+    VkPhysicalDeviceFeatures2 features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &vk13_features,
+        .features = {
+            .samplerAnisotropy = VK_TRUE,
+            .dualSrcBlend = VK_TRUE,
+        },
+    };
+    const char* ext_names[] = { VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME };
+    VkDeviceCreateInfo dev_create_info = {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .pNext = &features,
+        .queueCreateInfoCount = 1,
+        .pQueueCreateInfos = &queue_create_info,
+        .enabledExtensionCount = 1,
+        .ppEnabledExtensionNames = ext_names,
+    };
+    if (vkCreateDevice(state.phys_dev, &dev_create_info, 0, &state.device) != VK_SUCCESS) {
+        fatal("vkCreateDevice() failed");
+    }
+    vkGetDeviceQueue(state.device, state.queue_family_index, 0, &state.queue);
+}
+
+static void destroy_device(void) {
+    vkDestroyDevice(state.device, 0);
+    vkDestroyInstance(state.instance, 0);
+}
+
+static sg_pipeline make_pipeline(const uint32_t* vs_spirv, size_t vs_size, bool push_constant) {
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.bytecode = { .ptr = vs_spirv, .size = vs_size },
+        .fragment_func.bytecode = SG_RANGE(fs_spirv),
+        .uniform_blocks[0] = {
+            .stage = SG_SHADERSTAGE_VERTEX,
+            .size = 16,
+            .spirv_set0_binding_n = 0,
+            .spirv_push_constant = push_constant,
+        },
+    });
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+}
+
+static void init(void) {
+    state.color_att = sg_make_view(&(sg_view_desc){
+        .color_attachment.image = sg_make_image(&(sg_image_desc){
+            .usage.color_attachment = true,
+            .width = WIDTH,
+            .height = HEIGHT,
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+            .sample_count = 1,
+        }),
+    });
+    state.ub_pip = make_pipeline(vs_uniform_buffer_spirv, sizeof(vs_uniform_buffer_spirv), false);
+    state.pc_pip = make_pipeline(vs_push_constant_spirv, sizeof(vs_push_constant_spirv), true);
+}
+
+static void frame(sg_pipeline pip, int draws_per_frame) {
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = state.color_att,
+    });
+    sg_apply_pipeline(pip);
+    for (int i = 0; i < draws_per_frame; i++) {
+        const float pos[4] = {
+            ((float)(i % WIDTH) / WIDTH) * 2.0f - 1.0f,
+            ((float)((i / WIDTH) % HEIGHT) / HEIGHT) * 2.0f - 1.0f,
+            0.5f,
+            1.0f,
+        };
+        sg_apply_uniforms(0, &SG_RANGE(pos));
+        // a degenerate triangle, this only measures the uniform update overhead
+        sg_draw(0, 3, 1);
+    }
+    sg_end_pass();
+    sg_commit();
+}
+
+static void run(const char* name, sg_pipeline pip, int draws_per_frame, int num_frames) {
+    // warm up
+    frame(pip, draws_per_frame);
+    uint64_t num_push_constants = 0;
+    uint64_t num_descriptor_offsets = 0;
+    const uint64_t start = stm_now();
+    for (int i = 0; i < num_frames; i++) {
+        frame(pip, draws_per_frame);
+        const sg_frame_stats_vk vk = sg_query_stats().prev_frame.vk;
+        num_push_constants += vk.num_cmd_push_constants;
+        num_descriptor_offsets += vk.num_cmd_set_descriptor_buffer_offsets;
+    }
+    // include the GPU work in the measurement
+    vkDeviceWaitIdle(state.device);
+    const double secs = stm_sec(stm_since(start));
+    printf("%-16s %8.3f ms/frame %8.1f ns/draw %10.1f push_constants/frame %10.1f descriptor_offsets/frame\n",
+        name,
+        (secs * 1000.0) / num_frames,
+        (secs * 1000000000.0) / ((double)num_frames * draws_per_frame),
+        (double)num_push_constants / num_frames,
+        (double)num_descriptor_offsets / num_frames);
+}
+
+int main(int argc, char* argv[]) {
+    const int draws_per_frame = (argc > 1) ? atoi(argv[1]) : 10000;
+    const int num_frames = (argc > 2) ? atoi(argv[2]) : 100;
+    stm_setup();
+    create_device();
+    sg_setup(&(sg_desc){
+        .environment = {
+            .defaults = {
+                .color_format = SG_PIXELFORMAT_RGBA8,
+                .depth_format = SG_PIXELFORMAT_NONE,
+                .sample_count = 1,
+            },
+            .vulkan = {
+                .instance = state.instance,
+                .physical_device = state.phys_dev,
+                .device = state.device,
+                .queue = state.queue,
+                .queue_family_index = state.queue_family_index,
+                .timeline_semaphore = true,
+            },
+        },
+        .logger.func = slog_func,
+    });
+    if (!sg_isvalid()) {
+        fatal("sg_setup() failed");
+    }
+    init();
+    if ((sg_query_pipeline_state(state.ub_pip) != SG_RESOURCESTATE_VALID) || (sg_query_pipeline_state(state.pc_pip) != SG_RESOURCESTATE_VALID)) {
+        fatal("failed to create pipelines");
+    }
+    printf("%dx%d, %d draws/frame, %d frames\n", WIDTH, HEIGHT, draws_per_frame, num_frames);
+    run("uniform_buffer", state.ub_pip, draws_per_frame, num_frames);
+    run("push_constant", state.pc_pip, draws_per_frame, num_frames);
+    sg_shutdown();
+    destroy_device();
+    return 0;
+}
@@ -11,6 +11,7 @@
 #include "sokol_color.h"
 #include "sokol_debugtext.h"
 #include "sokol_gl.h"
+#include "sokol_gfx_trace.h"
 #include "sokol_letterbox.h"
 #include "sokol_memtrack.h"
 #include "sokol_shape.h"
@@ -71,6 +72,7 @@ void use_all(void) {
     sg_color c = sg_make_color_4b(255, 0, 0, 255); (void)c;
     sdtx_setup(&(sdtx_desc_t){0});
     sgl_setup(&(sgl_desc_t){0});
+    sgtrace_setup(&(sgtrace_desc_t){0});
     const slbx_viewport vp = slbx_letterbox(256, 256, &(slbx_letterbox_desc){0}); (void)vp;
     void* p = smemtrack_alloc(8, 0); (void)p;
     sshape_plane_sizes(10, SSHAPE_MAX_VERTEX_SIZE);
@@ -0,0 +1,13 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_egl.h"
+
+void use_egl_impl(void) {
+    segl_setup(&(segl_desc){
+        .width = 256,
+        .height = 256,
+    });
+    const sg_environment env = segl_environment();
+    (void)env;
+    segl_shutdown();
+}
@@ -0,0 +1,13 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_egl.h"
+
+void use_egl_impl(void) {
+    segl_desc desc = {};
+    desc.width = 256;
+    desc.height = 256;
+    segl_setup(desc);
+    const sg_environment env = segl_environment();
+    (void)env;
+    segl_shutdown();
+}
@@ -0,0 +1,9 @@
+#include "sokol_gfx.h"
+#include "sokol_time.h"
+#define SOKOL_IMPL
+#include "sokol_gfx_trace.h"
+
+void use_gfx_trace_impl(void) {
+    sgtrace_setup(&(sgtrace_desc_t){0});
+    sgtrace_shutdown();
+}
@@ -0,0 +1,9 @@
+#include "sokol_gfx.h"
+#include "sokol_time.h"
+#define SOKOL_IMPL
+#include "sokol_gfx_trace.h"
+
+void use_gfx_trace_impl() {
+    sgtrace_setup({ });
+    sgtrace_shutdown();
+}
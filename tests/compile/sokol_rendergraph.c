@@ -0,0 +1,8 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_rendergraph.h"
+
+void use_rendergraph_impl(void) {
+    srg_setup(&(srg_desc_t){0});
+    srg_shutdown();
+}
@@ -0,0 +1,8 @@
+#include "sokol_gfx.h"
+#define SOKOL_IMPL
+#include "sokol_rendergraph.h"
+
+void use_rendergraph_impl() {
+    srg_setup({ });
+    srg_shutdown();
+}
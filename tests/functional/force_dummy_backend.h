@@ -1,3 +1,5 @@
+// the software backend is kept since it runs without a GPU
+#if !defined(SOKOL_SOFTWARE)
 #if defined(SOKOL_GLES3)
 #undef SOKOL_GLES3
 #endif
@@ -19,3 +21,4 @@
 #ifndef SOKOL_DUMMY_BACKEND
 #define SOKOL_DUMMY_BACKEND
 #endif
+#endif
@@ -0,0 +1,988 @@
+//------------------------------------------------------------------------------
+//  sokol-gfx-gl-test.c
+//  Headless GL tests via sokol_egl.h, these run on the actual GL backend
+//  (for instance Mesa's llvmpipe driver) and read the rendered pixels back.
+//  If no EGL display can be created, the tests are skipped.
+//------------------------------------------------------------------------------
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_log.h"
+#include "sokol_egl.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+#if defined(SOKOL_GLCORE)
+#define GLSL_HEADER "#version 410\n"
+#else
+#define GLSL_HEADER "#version 300 es\nprecision mediump float;\n"
+#endif
+
+static bool setup_with_desc(int width, int height, sg_desc desc) {
+    segl_setup(&(segl_desc){ .width = width, .height = height, .logger.func = slog_func });
+    if (!segl_isvalid()) {
+        printf("no EGL display available, skipping test\n");
+        segl_shutdown();
+        return false;
+    }
+    desc.environment = segl_environment();
+    desc.logger.func = slog_func;
+    sg_setup(&desc);
+    return sg_isvalid();
+}
+
+static bool setup(int width, int height) {
+    return setup_with_desc(width, height, (sg_desc){0});
+}
+
+static void shutdown(void) {
+    sg_shutdown();
+    segl_shutdown();
+}
+
+static bool pixel_equal(const uint8_t* px, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return (px[0] == r) && (px[1] == g) && (px[2] == b) && (px[3] == a);
+}
+
+// a fullscreen triangle with a constant fragment color
+static sg_pipeline make_color_pipeline(const char* fs_color) {
+    char fs_src[256];
+    snprintf(fs_src, sizeof(fs_src), GLSL_HEADER "out vec4 frag_color;\nvoid main() { frag_color = %s; }\n", fs_color);
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.source = GLSL_HEADER "layout(location=0) in vec2 pos;\nvoid main() { gl_Position = vec4(pos, 0.5, 1.0); }\n",
+        .fragment_func.source = fs_src,
+    });
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+    });
+}
+
+static sg_buffer make_triangle_buffer(void) {
+    const float verts[] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+    return sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(verts) });
+}
+
+UTEST(sokol_gfx_gl, smoke_clear) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    T(sg_query_backend() == SG_BACKEND_GLCORE || sg_query_backend() == SG_BACKEND_GLES3);
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 1.0f, 1.0f } },
+        .swapchain = segl_swapchain(),
+    });
+    sg_end_pass();
+    sg_commit();
+    uint8_t px[4 * 4 * 4];
+    T(segl_read_pixels(SG_RANGE(px)));
+    T(pixel_equal(&px[0], 255, 0, 255, 255));
+    T(pixel_equal(&px[sizeof(px) - 4], 255, 0, 255, 255));
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, smoke_draw) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbuf = make_triangle_buffer();
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    T(sg_query_buffer_state(vbuf) == SG_RESOURCESTATE_VALID);
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+        .swapchain = segl_swapchain(),
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    uint8_t px[4 * 4 * 4];
+    T(segl_read_pixels(SG_RANGE(px)));
+    T(pixel_equal(&px[0], 0, 255, 0, 255));
+    T(pixel_equal(&px[sizeof(px) - 4], 0, 255, 0, 255));
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, smoke_resize) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    segl_resize(8, 2);
+    T(segl_width() == 8);
+    T(segl_height() == 2);
+    sg_swapchain swapchain = segl_swapchain();
+    T(swapchain.width == 8);
+    T(swapchain.height == 2);
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 1.0f, 1.0f } },
+        .swapchain = swapchain,
+    });
+    sg_end_pass();
+    sg_commit();
+    uint8_t px[8 * 2 * 4];
+    T(segl_read_pixels(SG_RANGE(px)));
+    T(pixel_equal(&px[0], 0, 0, 255, 255));
+    T(pixel_equal(&px[sizeof(px) - 4], 0, 0, 255, 255));
+    shutdown();
+}
+
+// a fullscreen triangle which samples a texture
+static sg_pipeline make_texture_pipeline(void) {
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.source = GLSL_HEADER "layout(location=0) in vec2 pos;\nvoid main() { gl_Position = vec4(pos, 0.5, 1.0); }\n",
+        .fragment_func.source = GLSL_HEADER "uniform sampler2D tex;\nout vec4 frag_color;\nvoid main() { frag_color = texelFetch(tex, ivec2(0, 0), 0); }\n",
+        .views[0].texture = { .stage = SG_SHADERSTAGE_FRAGMENT, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+        .samplers[0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .sampler_type = SG_SAMPLERTYPE_FILTERING },
+        .texture_sampler_pairs[0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 0, .sampler_slot = 0, .glsl_name = "tex" },
+    });
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+    });
+}
+
+UTEST(sokol_gfx_gl, stream_update_image) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    sg_enable_stats();
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.stream_update = true,
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    sg_view view = sg_make_view(&(sg_view_desc){ .texture.image = img });
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_pipeline pip = make_texture_pipeline();
+    sg_buffer vbuf = make_triangle_buffer();
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    const _sg_image_t* img_ptr = _sg_lookup_image(img.id);
+    T(img_ptr);
+    const bool has_pbo = 0 != img_ptr->gl.pbo[0];
+    T(has_pbo == _sg.gl.persistent_stream_buffers);
+    // different content in each frame so that every texture slot and pixel unpack buffer is used
+    const uint32_t colors[] = { 0xFF0000FF, 0xFF00FF00, 0xFFFF0000, 0xFFFFFFFF };
+    for (int frame = 0; frame < 4; frame++) {
+        uint32_t pixels[4 * 4];
+        for (int i = 0; i < 16; i++) {
+            pixels[i] = colors[frame];
+        }
+        sg_update_image(img, &(sg_image_data){ .mip_levels[0] = SG_RANGE(pixels) });
+        T(sg_query_stats().cur_frame.gl.num_pbo_uploads == (has_pbo ? 1 : 0));
+        sg_begin_pass(&(sg_pass){ .swapchain = segl_swapchain() });
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .views[0] = view, .samplers[0] = smp });
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+        sg_commit();
+        uint8_t px[4 * 4 * 4];
+        T(segl_read_pixels(SG_RANGE(px)));
+        uint32_t px0;
+        memcpy(&px0, px, sizeof(px0));
+        T(px0 == colors[frame]);
+    }
+    shutdown();
+}
+
+// draw a fullscreen triangle in its own pass and return the frame stats before sg_commit()
+static sg_frame_stats draw_frame(sg_pipeline pip, sg_buffer vbuf, int vb_offset) {
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+        .swapchain = segl_swapchain(),
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .vertex_buffer_offsets[0] = vb_offset });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    const sg_frame_stats stats = sg_query_stats().cur_frame;
+    sg_commit();
+    return stats;
+}
+
+static bool first_pixel_equal(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    uint8_t px[4 * 4 * 4];
+    return segl_read_pixels(SG_RANGE(px)) && pixel_equal(&px[0], r, g, b, a);
+}
+
+UTEST(sokol_gfx_gl, vao_cache_hit_miss) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    sg_enable_stats();
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    // two copies of the fullscreen triangle, selected via the vertex buffer offset
+    const float verts[] = {
+        -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f,
+        -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(verts) });
+    sg_frame_stats stats = draw_frame(pip, vbuf, 0);
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(stats.gl.num_vao_cache_hits == 0);
+    T(first_pixel_equal(0, 255, 0, 255));
+    stats = draw_frame(pip, vbuf, 0);
+    T(stats.gl.num_vao_cache_misses == 0);
+    T(stats.gl.num_vao_cache_hits == 1);
+    T(first_pixel_equal(0, 255, 0, 255));
+    // a different vertex buffer offset is a different cache key
+    stats = draw_frame(pip, vbuf, 6 * sizeof(float));
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(stats.gl.num_vao_cache_hits == 0);
+    T(first_pixel_equal(0, 255, 0, 255));
+    stats = draw_frame(pip, vbuf, 6 * sizeof(float));
+    T(stats.gl.num_vao_cache_hits == 1);
+    T(stats.gl.num_vao_cache_evictions == 0);
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_invalidate_buffer) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    sg_enable_stats();
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbuf0 = make_triangle_buffer();
+    sg_frame_stats stats = draw_frame(pip, vbuf0, 0);
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(first_pixel_equal(0, 255, 0, 255));
+    sg_destroy_buffer(vbuf0);
+    T(sg_query_stats().cur_frame.gl.num_vao_cache_invalidates == 1);
+    // the new buffer may get the same GL buffer name, the VAO of the destroyed
+    // buffer must not be reused since it still references the old buffer object
+    const float degenerate_verts[6] = { 0 };
+    sg_buffer vbuf1 = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(degenerate_verts) });
+    stats = draw_frame(pip, vbuf1, 0);
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(stats.gl.num_vao_cache_hits == 0);
+    T(first_pixel_equal(255, 0, 0, 255));
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_invalidate_pipeline) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    sg_enable_stats();
+    sg_buffer vbuf = make_triangle_buffer();
+    sg_pipeline pip0 = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_frame_stats stats = draw_frame(pip0, vbuf, 0);
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(first_pixel_equal(0, 255, 0, 255));
+    sg_destroy_pipeline(pip0);
+    T(sg_query_stats().cur_frame.gl.num_vao_cache_invalidates == 1);
+    T(_sg.gl.vao_cache.cur_item == -1);
+    sg_pipeline pip1 = make_color_pipeline("vec4(0.0, 0.0, 1.0, 1.0)");
+    stats = draw_frame(pip1, vbuf, 0);
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(stats.gl.num_vao_cache_hits == 0);
+    T(first_pixel_equal(0, 0, 255, 255));
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_eviction) {
+    if (!setup_with_desc(4, 4, (sg_desc){ .gl.vao_cache_size = 2 })) {
+        return;
+    }
+    sg_enable_stats();
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbufs[3];
+    for (int i = 0; i < 3; i++) {
+        vbufs[i] = make_triangle_buffer();
+    }
+    T(draw_frame(pip, vbufs[0], 0).gl.num_vao_cache_evictions == 0);
+    T(draw_frame(pip, vbufs[1], 0).gl.num_vao_cache_evictions == 0);
+    // touch vbufs[0], so that vbufs[1] is the least recently used item
+    T(draw_frame(pip, vbufs[0], 0).gl.num_vao_cache_hits == 1);
+    sg_frame_stats stats = draw_frame(pip, vbufs[2], 0);
+    T(stats.gl.num_vao_cache_misses == 1);
+    T(stats.gl.num_vao_cache_evictions == 1);
+    T(first_pixel_equal(0, 255, 0, 255));
+    T(draw_frame(pip, vbufs[0], 0).gl.num_vao_cache_hits == 1);
+    T(draw_frame(pip, vbufs[1], 0).gl.num_vao_cache_misses == 1);
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, vao_cache_disabled) {
+    if (!setup_with_desc(4, 4, (sg_desc){ .gl.disable_vao_cache = true })) {
+        return;
+    }
+    sg_enable_stats();
+    T(_sg.gl.vao_cache.items == 0);
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbuf = make_triangle_buffer();
+    for (int i = 0; i < 2; i++) {
+        sg_frame_stats stats = draw_frame(pip, vbuf, 0);
+        T(stats.gl.num_vao_cache_hits == 0);
+        T(stats.gl.num_vao_cache_misses == 0);
+        T(first_pixel_equal(0, 255, 0, 255));
+    }
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, persistent_stream_buffer) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    if (!_sg.gl.persistent_stream_buffers) {
+        printf("persistently mapped buffers not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .usage.stream_update = true, .size = 6 * sizeof(float) });
+    const _sg_buffer_t* buf = _sg_lookup_buffer(vbuf.id);
+    T(buf && buf->gl.persistent);
+    for (int slot = 0; slot < SG_NUM_INFLIGHT_FRAMES; slot++) {
+        T(buf->gl.mapped[slot] != 0);
+        T(buf->gl.write_frame[slot] == 0);
+    }
+    T(_sg.gl.fences.num_buffers == 1);
+    // alternate between a fullscreen and a degenerate triangle, each frame writes
+    // into the mapped slot which the GPU used two frames ago
+    const float fullscreen_verts[6] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+    const float degenerate_verts[6] = { 0 };
+    for (int frame = 0; frame < 8; frame++) {
+        const bool fullscreen = 0 == (frame & 1);
+        if (fullscreen) {
+            sg_update_buffer(vbuf, &SG_RANGE(fullscreen_verts));
+        } else {
+            sg_update_buffer(vbuf, &SG_RANGE(degenerate_verts));
+        }
+        T(buf->gl.write_frame[buf->cmn.active_slot] == (_sg.frame_index + 1));
+        draw_frame(pip, vbuf, 0);
+        T(first_pixel_equal(fullscreen ? 0 : 255, fullscreen ? 255 : 0, 0, 255));
+    }
+    sg_destroy_buffer(vbuf);
+    T(_sg.gl.fences.num_buffers == 0);
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, frame_fences) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    if (!_sg.gl.persistent_stream_buffers) {
+        printf("persistently mapped buffers not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    sg_enable_stats();
+    const _sg_gl_frame_fences_t* fences = &_sg.gl.fences;
+    // no fences are inserted while no persistently mapped buffers exist
+    sg_commit();
+    for (int i = 0; i < _SG_GL_NUM_FRAME_FENCES; i++) {
+        T(fences->syncs[i] == 0);
+    }
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    const float verts[6] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .usage.stream_update = true, .size = sizeof(verts) });
+    for (int frame = 0; frame < 8; frame++) {
+        const uint32_t frame_index = _sg.frame_index;
+        sg_update_buffer(vbuf, &SG_RANGE(verts));
+        if (frame >= SG_NUM_INFLIGHT_FRAMES) {
+            // the mapped slot was last written SG_NUM_INFLIGHT_FRAMES frames ago,
+            // that frame (and all older frames) must be complete now
+            T(fences->num_completed_frames == (frame_index - SG_NUM_INFLIGHT_FRAMES + 1));
+            T(fences->syncs[(frame_index - SG_NUM_INFLIGHT_FRAMES) % _SG_GL_NUM_FRAME_FENCES] == 0);
+        }
+        draw_frame(pip, vbuf, 0);
+        // sg_commit() has inserted a fence for this frame
+        const int fence_index = (int)(frame_index % _SG_GL_NUM_FRAME_FENCES);
+        T(fences->syncs[fence_index] != 0);
+        T(fences->frame_index[fence_index] == frame_index);
+    }
+    sg_destroy_buffer(vbuf);
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, disable_persistent_stream_buffers) {
+    if (!setup_with_desc(4, 4, (sg_desc){ .gl.disable_persistent_stream_buffers = true })) {
+        return;
+    }
+    T(!_sg.gl.persistent_stream_buffers);
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    const float verts[6] = { -1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .usage.stream_update = true, .size = sizeof(verts) });
+    const _sg_buffer_t* buf = _sg_lookup_buffer(vbuf.id);
+    T(buf && !buf->gl.persistent);
+    T(buf->gl.mapped[0] == 0);
+    T(_sg.gl.fences.num_buffers == 0);
+    for (int frame = 0; frame < 4; frame++) {
+        sg_update_buffer(vbuf, &SG_RANGE(verts));
+        draw_frame(pip, vbuf, 0);
+        T(first_pixel_equal(0, 255, 0, 255));
+    }
+    for (int i = 0; i < _SG_GL_NUM_FRAME_FENCES; i++) {
+        T(_sg.gl.fences.syncs[i] == 0);
+    }
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, counter_ring_keeps_unread_results) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    if (!sg_query_features().occlusion_counter) {
+        printf("occlusion counters not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbuf = make_triangle_buffer();
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_OCCLUSION });
+    const _sg_counter_t* c = _sg_lookup_counter(ctr.id);
+    const uint32_t first_frame_index = _sg.frame_index;
+    // record more frames than query slots without ever reading the result
+    for (int frame = 0; frame <= _SG_GL_NUM_QUERY_SLOTS; frame++) {
+        sg_begin_pass(&(sg_pass){ .swapchain = segl_swapchain() });
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+        sg_begin_counter(ctr);
+        sg_draw(0, 3, 1);
+        sg_end_counter(ctr);
+        sg_end_pass();
+        sg_commit();
+    }
+    // reusing the oldest slot has read its result instead of dropping it
+    T(c->cmn.result.available);
+    T(c->cmn.result.frame_index == first_frame_index);
+    T(c->cmn.result.samples_passed > 0);
+    const sg_counter_value val = sg_query_counter_value(ctr);
+    T(val.available);
+    T(val.frame_index >= first_frame_index);
+    T(val.samples_passed > 0);
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, transient_attachments) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    if (!_sg.gl.invalidate_framebuffer) {
+        printf("glInvalidateFramebuffer() not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    // MSAA color and depth-stencil are transient and invalidated at the end of the pass,
+    // the resolve image keeps the result
+    sg_image msaa_img = sg_make_image(&(sg_image_desc){
+        .usage = { .color_attachment = true, .transient_attachment = true },
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .sample_count = 4,
+    });
+    sg_image depth_img = sg_make_image(&(sg_image_desc){
+        .usage = { .depth_stencil_attachment = true, .transient_attachment = true },
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .sample_count = 4,
+    });
+    sg_image resolve_img = sg_make_image(&(sg_image_desc){
+        .usage.resolve_attachment = true,
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    T(sg_query_image_state(msaa_img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(depth_img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(resolve_img) == SG_RESOURCESTATE_VALID);
+    sg_view color_att = sg_make_view(&(sg_view_desc){ .color_attachment.image = msaa_img });
+    sg_view depth_att = sg_make_view(&(sg_view_desc){ .depth_stencil_attachment.image = depth_img });
+    sg_view resolve_att = sg_make_view(&(sg_view_desc){ .resolve_attachment.image = resolve_img });
+    sg_view resolve_tex = sg_make_view(&(sg_view_desc){ .texture.image = resolve_img });
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.source = GLSL_HEADER "layout(location=0) in vec2 pos;\nvoid main() { gl_Position = vec4(pos, 0.5, 1.0); }\n",
+        .fragment_func.source = GLSL_HEADER "out vec4 frag_color;\nvoid main() { frag_color = vec4(0.0, 1.0, 0.0, 1.0); }\n",
+    });
+    sg_pipeline offscreen_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+            .compare = SG_COMPAREFUNC_LESS_EQUAL,
+            .write_enabled = true,
+        },
+        .sample_count = 4,
+    });
+    T(sg_query_pipeline_state(offscreen_pip) == SG_RESOURCESTATE_VALID);
+    sg_pipeline display_pip = make_texture_pipeline();
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_buffer vbuf = make_triangle_buffer();
+    for (int frame = 0; frame < 2; frame++) {
+        sg_begin_pass(&(sg_pass){
+            .action = {
+                .colors[0] = { .load_action = SG_LOADACTION_CLEAR, .store_action = SG_STOREACTION_DONTCARE, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+                .depth = { .load_action = SG_LOADACTION_CLEAR, .store_action = SG_STOREACTION_DONTCARE, .clear_value = 1.0f },
+            },
+            .attachments = { .colors[0] = color_att, .resolves[0] = resolve_att, .depth_stencil = depth_att },
+        });
+        sg_apply_pipeline(offscreen_pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+        // the framebuffer invalidation after the MSAA resolve must not raise a GL error
+        T(glGetError() == GL_NO_ERROR);
+        sg_begin_pass(&(sg_pass){ .swapchain = segl_swapchain() });
+        sg_apply_pipeline(display_pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf, .views[0] = resolve_tex, .samplers[0] = smp });
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+        sg_commit();
+        T(first_pixel_equal(0, 255, 0, 255));
+    }
+    shutdown();
+}
+
+// a 1x1 RGBA8 texture view with a single red value
+static sg_view make_red_texture_view(uint8_t r) {
+    const uint32_t pixel = r;
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .width = 1,
+        .height = 1,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .data.mip_levels[0] = SG_RANGE(pixel),
+    });
+    return sg_make_view(&(sg_view_desc){ .texture.image = img });
+}
+
+// a readonly storage buffer view with a single uint value
+static sg_view make_uint_storage_buffer_view(uint32_t val) {
+    const uint32_t data[4] = { val, 0, 0, 0 };
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){ .usage.storage_buffer = true, .data = SG_RANGE(data) });
+    return sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = buf });
+}
+
+UTEST(sokol_gfx_gl, multi_bind) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    if (!_sg.gl.multi_bind || !sg_query_features().compute) {
+        printf("GL multi-bind or storage buffers not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    sg_enable_stats();
+    // each texture slot writes one color channel, the storage buffers add to red and green
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.source =
+            "#version 430\n"
+            "layout(location=0) in vec2 pos;\n"
+            "void main() { gl_Position = vec4(pos, 0.5, 1.0); }\n",
+        .fragment_func.source =
+            "#version 430\n"
+            "uniform sampler2D tex0;\n"
+            "uniform sampler2D tex1;\n"
+            "uniform sampler2D tex2;\n"
+            "layout(std430, binding=0) readonly buffer sb0 { uint v0; };\n"
+            "layout(std430, binding=1) readonly buffer sb1 { uint v1; };\n"
+            "out vec4 frag_color;\n"
+            "void main() {\n"
+            "  vec2 uv = vec2(0.5, 0.5);\n"
+            "  frag_color = vec4(texture(tex0, uv).r + float(v0) / 255.0, texture(tex1, uv).r + float(v1) / 255.0, texture(tex2, uv).r, 1.0);\n"
+            "}\n",
+        .views = {
+            [0].texture = { .stage = SG_SHADERSTAGE_FRAGMENT, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+            [1].texture = { .stage = SG_SHADERSTAGE_FRAGMENT, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+            [2].texture = { .stage = SG_SHADERSTAGE_FRAGMENT, .image_type = SG_IMAGETYPE_2D, .sample_type = SG_IMAGESAMPLETYPE_FLOAT },
+            [3].storage_buffer = { .stage = SG_SHADERSTAGE_FRAGMENT, .readonly = true, .glsl_binding_n = 0 },
+            [4].storage_buffer = { .stage = SG_SHADERSTAGE_FRAGMENT, .readonly = true, .glsl_binding_n = 1 },
+        },
+        .samplers = {
+            [0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .sampler_type = SG_SAMPLERTYPE_FILTERING },
+            [1] = { .stage = SG_SHADERSTAGE_FRAGMENT, .sampler_type = SG_SAMPLERTYPE_FILTERING },
+        },
+        .texture_sampler_pairs = {
+            [0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 0, .sampler_slot = 0, .glsl_name = "tex0" },
+            [1] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 1, .sampler_slot = 1, .glsl_name = "tex1" },
+            [2] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 2, .sampler_slot = 0, .glsl_name = "tex2" },
+        },
+    });
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    const sg_view tex[3] = { make_red_texture_view(0x40), make_red_texture_view(0x20), make_red_texture_view(0x10) };
+    const sg_view sbuf[2] = { make_uint_storage_buffer_view(0x01), make_uint_storage_buffer_view(0x02) };
+    const sg_sampler smp[2] = {
+        sg_make_sampler(&(sg_sampler_desc){ .min_filter = SG_FILTER_NEAREST, .mag_filter = SG_FILTER_NEAREST }),
+        sg_make_sampler(&(sg_sampler_desc){ .min_filter = SG_FILTER_LINEAR, .mag_filter = SG_FILTER_LINEAR }),
+    };
+    sg_buffer vbuf = make_triangle_buffer();
+    // resource creation binds textures through the state cache, start with fresh frame stats
+    sg_commit();
+    // the second frame swaps textures 0 and 2 and the storage buffers
+    const uint8_t expected[2][3] = { { 0x41, 0x22, 0x10 }, { 0x12, 0x21, 0x40 } };
+    for (int frame = 0; frame < 2; frame++) {
+        const int t0 = (frame == 0) ? 0 : 2;
+        const int t2 = (frame == 0) ? 2 : 0;
+        const int s0 = (frame == 0) ? 0 : 1;
+        sg_begin_pass(&(sg_pass){ .swapchain = segl_swapchain() });
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&(sg_bindings){
+            .vertex_buffers[0] = vbuf,
+            .views = { tex[t0], tex[1], tex[t2], sbuf[s0], sbuf[1 - s0] },
+            .samplers = { smp[0], smp[1] },
+        });
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+        // all texture, sampler and storage buffer slots are updated with one call each
+        const sg_frame_stats_gl gl_stats = sg_query_stats().cur_frame.gl;
+        T(gl_stats.num_bind_textures == 1);
+        T(gl_stats.num_bind_samplers == 1);
+        T(gl_stats.num_bind_buffers_range == 1);
+        T(gl_stats.num_bind_texture == 0);
+        sg_commit();
+        T(first_pixel_equal(expected[frame][0], expected[frame][1], expected[frame][2], 255));
+    }
+    shutdown();
+}
+
+#define MULTI_DRAW_WIDTH (16)
+#define MULTI_DRAW_HEIGHT (8)
+#define MULTI_DRAW_NUM_QUADS (MULTI_DRAW_WIDTH * MULTI_DRAW_HEIGHT)
+
+// write the 4 corners of a quad covering one pixel, pixel rows are counted from the top
+static void write_pixel_quad(float* dst, int quad_index) {
+    const float sx = 2.0f / MULTI_DRAW_WIDTH;
+    const float sy = 2.0f / MULTI_DRAW_HEIGHT;
+    const float x0 = -1.0f + (float)(quad_index % MULTI_DRAW_WIDTH) * sx;
+    const float y0 = 1.0f - (float)(quad_index / MULTI_DRAW_WIDTH) * sy;
+    const float corners[8] = { x0, y0, x0 + sx, y0, x0 + sx, y0 - sy, x0, y0 - sy };
+    memcpy(dst, corners, sizeof(corners));
+}
+
+// a vertex buffer with two triangles (6 vertices) for each pixel quad
+static sg_buffer make_pixel_quads_buffer(void) {
+    static float tri_verts[MULTI_DRAW_NUM_QUADS * 6 * 2];
+    for (int i = 0; i < MULTI_DRAW_NUM_QUADS; i++) {
+        float c[8];
+        write_pixel_quad(c, i);
+        const int order[6] = { 0, 1, 2, 0, 2, 3 };
+        for (int v = 0; v < 6; v++) {
+            tri_verts[(i * 6 + v) * 2 + 0] = c[order[v] * 2 + 0];
+            tri_verts[(i * 6 + v) * 2 + 1] = c[order[v] * 2 + 1];
+        }
+    }
+    return sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(tri_verts) });
+}
+
+// check that every pixel was drawn, except the pixel of the skipped quad
+static bool multi_draw_pixels_ok(int skipped_quad) {
+    uint8_t px[MULTI_DRAW_NUM_QUADS * 4];
+    if (!segl_read_pixels(SG_RANGE(px))) {
+        return false;
+    }
+    for (int i = 0; i < MULTI_DRAW_NUM_QUADS; i++) {
+        const bool ok = (i == skipped_quad) ? pixel_equal(&px[i * 4], 255, 0, 0, 255) : pixel_equal(&px[i * 4], 0, 255, 0, 255);
+        if (!ok) {
+            printf("pixel %d has unexpected color\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+UTEST(sokol_gfx_gl, draw_batch) {
+    if (!setup(MULTI_DRAW_WIDTH, MULTI_DRAW_HEIGHT)) {
+        return;
+    }
+    sg_enable_stats();
+    // one draw per pixel, more draws than fit into one glMultiDraw*() call, one
+    // empty draw which must not render anything, and one instanced draw which
+    // interrupts the glMultiDraw*() run
+    const int skipped_quad = 5;
+    const int instanced_quad = 70;
+    sg_draw_args args[MULTI_DRAW_NUM_QUADS];
+    for (int i = 0; i < MULTI_DRAW_NUM_QUADS; i++) {
+        args[i] = (sg_draw_args){ .base_element = i * 6, .num_elements = 6, .num_instances = 1 };
+    }
+    args[skipped_quad].num_elements = 0;
+    args[instanced_quad].num_instances = 2;
+
+    // non-indexed: two triangles per quad
+    sg_buffer tri_vbuf = make_pixel_quads_buffer();
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+        .swapchain = segl_swapchain(),
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = tri_vbuf });
+    sg_draw_batch(args, MULTI_DRAW_NUM_QUADS);
+    sg_end_pass();
+    sg_frame_stats stats = sg_query_stats().cur_frame;
+    T(stats.num_draw_batch_items == MULTI_DRAW_NUM_QUADS);
+    #if defined(_SOKOL_GL_HAS_MULTIDRAW)
+    // quads 0..69 minus the empty one (64 + 5), the instanced quad 70, then quads 71..127
+    T(stats.gl.num_multi_draw == 3);
+    #endif
+    sg_commit();
+    T(multi_draw_pixels_ok(skipped_quad));
+
+    // indexed: a shared 6-index quad, each draw selects its quad via base_vertex
+    if (sg_query_features().draw_base_vertex) {
+        static float quad_verts[MULTI_DRAW_NUM_QUADS * 4 * 2];
+        for (int i = 0; i < MULTI_DRAW_NUM_QUADS; i++) {
+            write_pixel_quad(&quad_verts[i * 8], i);
+        }
+        const uint16_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+        sg_buffer quad_vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(quad_verts) });
+        sg_buffer ibuf = sg_make_buffer(&(sg_buffer_desc){ .usage.index_buffer = true, .data = SG_RANGE(indices) });
+        sg_pipeline idx_pip = sg_make_pipeline(&(sg_pipeline_desc){
+            .shader = sg_query_pipeline_desc(pip).shader,
+            .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+            .index_type = SG_INDEXTYPE_UINT16,
+        });
+        for (int i = 0; i < MULTI_DRAW_NUM_QUADS; i++) {
+            args[i].base_element = 0;
+            args[i].base_vertex = i * 4;
+        }
+        sg_begin_pass(&(sg_pass){
+            .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+            .swapchain = segl_swapchain(),
+        });
+        sg_apply_pipeline(idx_pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = quad_vbuf, .index_buffer = ibuf });
+        sg_draw_batch(args, MULTI_DRAW_NUM_QUADS);
+        sg_end_pass();
+        stats = sg_query_stats().cur_frame;
+        T(stats.num_draw_batch_items == MULTI_DRAW_NUM_QUADS);
+        #if defined(_SOKOL_GL_HAS_MULTIDRAW)
+        T(stats.gl.num_multi_draw == 3);
+        #endif
+        sg_commit();
+        T(multi_draw_pixels_ok(skipped_quad));
+    }
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, parallel_shader_compile) {
+    if (!setup_with_desc(4, 4, (sg_desc){ .parallel_shader_compile = true })) {
+        return;
+    }
+    if (!sg_query_features().parallel_shader_compile) {
+        printf("GL_KHR_parallel_shader_compile not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    sg_enable_stats();
+    sg_pipeline pip = make_color_pipeline("vec4(0.0, 1.0, 0.0, 1.0)");
+    sg_buffer vbuf = make_triangle_buffer();
+    // a shader with a compile error must end up in the failed state, and so must its pipeline
+    sg_shader bad_shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.source = GLSL_HEADER "layout(location=0) in vec2 pos;\nvoid main() { gl_Position = vec4(pos, 0.5, 1.0); }\n",
+        .fragment_func.source = GLSL_HEADER "out vec4 frag_color;\nvoid main() { frag_color = undefined_var; }\n",
+    });
+    sg_pipeline bad_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = bad_shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+    });
+    // a shader which is destroyed while compiling
+    sg_pipeline destroyed_pip = make_color_pipeline("vec4(0.0, 0.0, 1.0, 1.0)");
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_shader_state(bad_shd) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_pipeline_state(destroyed_pip) == SG_RESOURCESTATE_ALLOC);
+    sg_destroy_shader(sg_query_pipeline_desc(destroyed_pip).shader);
+    sg_destroy_pipeline(destroyed_pip);
+    // draws with the compiling pipeline are skipped until sg_commit() has seen the result
+    int num_frames = 0;
+    uint32_t num_skipped_draws = 0;
+    while ((sg_query_pipeline_state(pip) == SG_RESOURCESTATE_ALLOC) && (num_frames < 10000)) {
+        sg_begin_pass(&(sg_pass){
+            .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+            .swapchain = segl_swapchain(),
+        });
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+        sg_draw(0, 3, 1);
+        sg_end_pass();
+        num_skipped_draws += sg_query_stats().cur_frame.num_skipped_draws;
+        sg_commit();
+        T(first_pixel_equal(255, 0, 0, 255));
+        num_frames++;
+    }
+    T(num_frames >= 1);
+    T(num_skipped_draws == (uint32_t)num_frames);
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    T(draw_frame(pip, vbuf, 0).num_skipped_draws == 0);
+    T(first_pixel_equal(0, 255, 0, 255));
+    for (int i = 0; (i < 10000) && (sg_query_pipeline_state(bad_pip) == SG_RESOURCESTATE_ALLOC); i++) {
+        sg_commit();
+    }
+    T(sg_query_shader_state(bad_shd) == SG_RESOURCESTATE_FAILED);
+    T(sg_query_pipeline_state(bad_pip) == SG_RESOURCESTATE_FAILED);
+    shutdown();
+}
+
+// read back the content of a buffer directly via GL
+static void read_gl_buffer(sg_buffer buf, void* dst, int size) {
+    const _sg_buffer_t* b = _sg_lookup_buffer(buf.id);
+    glBindBuffer(GL_COPY_READ_BUFFER, b->gl.buf[b->cmn.active_slot]);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    const void* ptr = glMapBufferRange(GL_COPY_READ_BUFFER, 0, size, GL_MAP_READ_BIT);
+    memcpy(dst, ptr, (size_t)size);
+    glUnmapBuffer(GL_COPY_READ_BUFFER);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+}
+
+UTEST(sokol_gfx_gl, dispatch_indirect_args_from_compute) {
+    if (!setup(4, 4)) {
+        return;
+    }
+    if (!sg_query_features().dispatch_indirect || (sg_query_backend() != SG_BACKEND_GLCORE)) {
+        printf("GL dispatch indirect not supported, skipping test\n");
+        shutdown();
+        return;
+    }
+    // the first dispatch writes the workgroup counts and resets the counter,
+    // the second dispatch uses those counts and counts its workgroups
+    const uint32_t zeroes[4] = { 0 };
+    sg_buffer args_buf = sg_make_buffer(&(sg_buffer_desc){ .usage.storage_buffer = true, .data = SG_RANGE(zeroes) });
+    sg_buffer count_buf = sg_make_buffer(&(sg_buffer_desc){ .usage.storage_buffer = true, .data = SG_RANGE(zeroes) });
+    sg_view args_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = args_buf });
+    sg_view count_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = count_buf });
+    sg_pipeline write_args_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .compute_func.source =
+                "#version 430\n"
+                "layout(local_size_x=1) in;\n"
+                "uniform ivec4 num_groups;\n"
+                "layout(std430, binding=0) buffer args_sb { uint args[4]; };\n"
+                "layout(std430, binding=1) buffer count_sb { uint count; };\n"
+                "void main() {\n"
+                "  args[0] = uint(num_groups.x); args[1] = uint(num_groups.y); args[2] = uint(num_groups.z);\n"
+                "  count = 0u;\n"
+                "}\n",
+            .uniform_blocks[0] = {
+                .stage = SG_SHADERSTAGE_COMPUTE,
+                .size = 16,
+                .glsl_uniforms[0] = { .type = SG_UNIFORMTYPE_INT4, .glsl_name = "num_groups" },
+            },
+            .views = {
+                [0].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE, .glsl_binding_n = 0 },
+                [1].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE, .glsl_binding_n = 1 },
+            },
+        }),
+    });
+    sg_pipeline count_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .compute_func.source =
+                "#version 430\n"
+                "layout(local_size_x=1) in;\n"
+                "layout(std430, binding=1) buffer count_sb { uint count; };\n"
+                "void main() { atomicAdd(count, 1u); }\n",
+            .views[1].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE, .glsl_binding_n = 1 },
+        }),
+    });
+    T(sg_query_pipeline_state(write_args_pip) == SG_RESOURCESTATE_VALID);
+    T(sg_query_pipeline_state(count_pip) == SG_RESOURCESTATE_VALID);
+    const int num_groups[2][4] = { { 3, 2, 1, 0 }, { 5, 1, 2, 0 } };
+    for (int frame = 0; frame < 2; frame++) {
+        sg_begin_pass(&(sg_pass){ .compute = true });
+        sg_apply_pipeline(write_args_pip);
+        sg_apply_bindings(&(sg_bindings){ .views = { args_view, count_view } });
+        sg_apply_uniforms(0, &SG_RANGE(num_groups[frame]));
+        sg_dispatch(1, 1, 1);
+        sg_apply_pipeline(count_pip);
+        sg_apply_bindings(&(sg_bindings){ .views[1] = count_view });
+        // the args buffer was written by a compute shader, this needs a GL_COMMAND_BARRIER_BIT
+        T(_sg_lookup_buffer(args_buf.id)->gl.gpu_dirty_flags & _SG_GL_GPUDIRTY_INDIRECT);
+        sg_dispatch_indirect(args_buf, 0);
+        T(0 == (_sg_lookup_buffer(args_buf.id)->gl.gpu_dirty_flags & _SG_GL_GPUDIRTY_INDIRECT));
+        sg_end_pass();
+        sg_commit();
+        uint32_t count = 0;
+        read_gl_buffer(count_buf, &count, sizeof(count));
+        T(count == (uint32_t)(num_groups[frame][0] * num_groups[frame][1] * num_groups[frame][2]));
+    }
+    shutdown();
+}
+
+UTEST(sokol_gfx_gl, uniform_buffer_offsets) {
+    if (!setup(MULTI_DRAW_WIDTH, MULTI_DRAW_HEIGHT)) {
+        return;
+    }
+    T(sg_query_features().uniform_buffer_bindings);
+    sg_enable_stats();
+    // a vertex stage block with a pixel offset and a fragment stage block with a
+    // color, both live in the same buffer at different aligned offsets
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .vertex_func.source = GLSL_HEADER
+            "layout(std140) uniform vs_params { vec4 offset; };\n"
+            "layout(location=0) in vec2 pos;\n"
+            "void main() { gl_Position = vec4(pos + offset.xy, 0.5, 1.0); }\n",
+        .fragment_func.source = GLSL_HEADER
+            "layout(std140) uniform fs_params { vec4 color; };\n"
+            "out vec4 frag_color;\n"
+            "void main() { frag_color = color; }\n",
+        .uniform_blocks = {
+            [0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .size = 16, .layout = SG_UNIFORMLAYOUT_STD140, .glsl_block_name = "fs_params" },
+            [1] = { .stage = SG_SHADERSTAGE_VERTEX, .size = 16, .layout = SG_UNIFORMLAYOUT_STD140, .glsl_block_name = "vs_params" },
+        },
+    });
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    enum { NUM_DRAWS = 4 };
+    const int align = sg_query_limits().uniform_buffer_offset_alignment;
+    T(align >= 16);
+    const size_t stride = (size_t)align / sizeof(float);
+    static float ub_data[2 * NUM_DRAWS * 256];
+    T((size_t)(2 * NUM_DRAWS * align) <= sizeof(ub_data));
+    // draw i: vs_params at offset (2*i)*align moves quad 0 to pixel i+1, fs_params at (2*i+1)*align
+    const uint8_t colors[NUM_DRAWS][3] = { { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 }, { 255, 255, 0 } };
+    for (int i = 0; i < NUM_DRAWS; i++) {
+        float* vs = &ub_data[(size_t)(2 * i) * stride];
+        float* fs = &ub_data[(size_t)(2 * i + 1) * stride];
+        vs[0] = (float)(i + 1) * 2.0f / MULTI_DRAW_WIDTH;
+        fs[0] = colors[i][0] / 255.0f;
+        fs[1] = colors[i][1] / 255.0f;
+        fs[2] = colors[i][2] / 255.0f;
+        fs[3] = 1.0f;
+    }
+    sg_buffer ubuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.uniform_buffer = true,
+        .data = { .ptr = ub_data, .size = (size_t)(2 * NUM_DRAWS * align) },
+    });
+    T(sg_query_buffer_state(ubuf) == SG_RESOURCESTATE_VALID);
+    sg_buffer vbuf = make_pixel_quads_buffer();
+    sg_commit();
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+        .swapchain = segl_swapchain(),
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    for (int i = 0; i < NUM_DRAWS; i++) {
+        sg_apply_uniform_buffer(1, ubuf, 2 * i * align);
+        sg_apply_uniform_buffer(0, ubuf, (2 * i + 1) * align);
+        sg_draw(0, 6, 1);
+    }
+    // re-applying the current ranges doesn't call glBindBufferRange() again
+    const uint32_t num_bind_buffer = sg_query_stats().cur_frame.gl.num_bind_buffer;
+    sg_apply_uniform_buffer(1, ubuf, 2 * (NUM_DRAWS - 1) * align);
+    sg_apply_uniform_buffer(0, ubuf, (2 * NUM_DRAWS - 1) * align);
+    sg_draw(0, 6, 1);
+    T(sg_query_stats().cur_frame.gl.num_bind_buffer == num_bind_buffer);
+    sg_end_pass();
+    sg_commit();
+    uint8_t px[MULTI_DRAW_NUM_QUADS * 4];
+    T(segl_read_pixels(SG_RANGE(px)));
+    T(pixel_equal(&px[0], 0, 0, 0, 255));
+    for (int i = 0; i < NUM_DRAWS; i++) {
+        T(pixel_equal(&px[(i + 1) * 4], colors[i][0], colors[i][1], colors[i][2], 255));
+    }
+    T(pixel_equal(&px[(NUM_DRAWS + 1) * 4], 0, 0, 0, 255));
+    shutdown();
+}
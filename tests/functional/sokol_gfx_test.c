@@ -3,11 +3,18 @@
 //  NOTE: this is not only testing the public API behaviour, but also
 //  accesses private functions and data. It may make sense to split
 //  these into two separate tests.
+//
+//  This file is compiled twice: as part of sokol-test with the default
+//  configuration, and as sokol-gfx-mt-test with SOKOL_MULTI_CONTEXT,
+//  SOKOL_LOADER_THREADS and SOKOL_TRACE_HOOKS defined on the command line.
 //------------------------------------------------------------------------------
 #include "force_dummy_backend.h"
 #define SOKOL_IMPL
 #include "sokol_gfx.h"
 #include "utest.h"
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
 
 #define T(b) EXPECT_TRUE(b)
 
@@ -105,7 +112,11 @@ UTEST(sokol_gfx, query_desc) {
 
 UTEST(sokol_gfx, query_backend) {
     setup(&(sg_desc){0});
+    #if defined(SOKOL_SOFTWARE)
+    T(sg_query_backend() == SG_BACKEND_SOFTWARE);
+    #else
     T(sg_query_backend() == SG_BACKEND_DUMMY);
+    #endif
     sg_shutdown();
 }
 
@@ -1410,6 +1421,316 @@ UTEST(sokol_gfx, query_buffer_will_overflow) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, query_stats_history) {
+    setup(&(sg_desc){ .stats_history_size = 4 });
+    T(sg_query_stats_history().num_frames == 0);
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .size = 64,
+        .usage.stream_update = true,
+    });
+    static const uint8_t data[4] = {0};
+    // record 5 frames with 1..5 appends, only the last 4 frames are kept
+    for (int frame = 1; frame <= 5; frame++) {
+        for (int i = 0; i < frame; i++) {
+            sg_append_buffer(buf, &SG_RANGE(data));
+        }
+        sg_commit();
+    }
+    const sg_stats_history hist = sg_query_stats_history();
+    T(hist.num_frames == 4);
+    T(hist.min.num_append_buffer == 2);
+    T(hist.max.num_append_buffer == 5);
+    T(hist.avg.num_append_buffer == 4);
+    T(hist.p50.num_append_buffer == 3);
+    T(hist.p95.num_append_buffer == 5);
+    T(hist.p99.num_append_buffer == 5);
+    T(hist.min.size_append_buffer == 8);
+    T(hist.max.size_append_buffer == 20);
+    // frame_index is not a counter and is excluded from the history
+    T(hist.min.frame_index == 0);
+    T(hist.max.frame_index == 0);
+    T(hist.p99.frame_index == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, query_stats_history_disabled) {
+    setup(&(sg_desc){0});
+    sg_commit();
+    sg_commit();
+    T(sg_query_stats_history().num_frames == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, query_pass_stats) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = 64,
+        .height = 64,
+    });
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att, .label = "first" });
+    sg_apply_viewport(0, 0, 64, 64, true);
+    sg_end_pass();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att, .label = "a pass label longer than SG_PASS_STATS_LABEL_SIZE" });
+    sg_apply_viewport(0, 0, 32, 32, true);
+    sg_apply_scissor_rect(0, 0, 16, 16, true);
+    sg_apply_scissor_rect(0, 0, 8, 8, true);
+    sg_end_pass();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att });
+    sg_end_pass();
+    T(sg_query_stats().cur_frame_passes.num_passes == 3);
+    sg_commit();
+    const sg_stats stats = sg_query_stats();
+    T(stats.cur_frame_passes.num_passes == 0);
+    const sg_frame_pass_stats* passes = &stats.prev_frame_passes;
+    T(passes->num_passes == 3);
+    T(0 == strcmp(passes->passes[0].label, "first"));
+    T(passes->passes[0].pass_index == 0);
+    T(passes->passes[0].num_apply_viewport == 1);
+    T(passes->passes[0].num_apply_scissor_rect == 0);
+    T(strlen(passes->passes[1].label) == (SG_PASS_STATS_LABEL_SIZE - 1));
+    T(passes->passes[1].pass_index == 1);
+    T(passes->passes[1].num_apply_viewport == 1);
+    T(passes->passes[1].num_apply_scissor_rect == 2);
+    T(passes->passes[2].label[0] == 0);
+    T(passes->passes[2].pass_index == 2);
+    T(passes->passes[2].num_apply_viewport == 0);
+    sg_shutdown();
+}
+
+#if defined(SOKOL_MULTI_CONTEXT)
+UTEST(sokol_gfx, multiple_contexts) {
+    setup(&(sg_desc){0});
+    const sg_context def_ctx = sg_default_context();
+    T(def_ctx.id != SG_INVALID_ID);
+    T(sg_get_context().id == def_ctx.id);
+    sg_buffer def_buf = create_buffer();
+    sg_context ctx = sg_make_context(&(sg_desc){ .buffer_pool_size = 4, .logger.func = test_logger });
+    T(ctx.id != SG_INVALID_ID);
+    T(ctx.id != def_ctx.id);
+    // creating a context doesn't change the current context
+    T(sg_get_context().id == def_ctx.id);
+    sg_set_context(ctx);
+    T(sg_get_context().id == ctx.id);
+    T(sg_isvalid());
+    T(_sg.pools.buffer_pool.size == 5);
+    // resources in different contexts are independent
+    T(sg_query_buffer_state(def_buf) == SG_RESOURCESTATE_INVALID);
+    sg_buffer buf = create_buffer();
+    T(sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID);
+    sg_commit();
+    sg_commit();
+    T(_sg.frame_index == 3);
+    sg_set_context(def_ctx);
+    T(sg_query_buffer_state(def_buf) == SG_RESOURCESTATE_VALID);
+    T(_sg.frame_index == 1);
+    // destroying a context makes its handle invalid
+    sg_destroy_context(ctx);
+    T(sg_get_context().id == def_ctx.id);
+    T(sg_isvalid());
+    sg_context ctx2 = sg_make_context(&(sg_desc){0});
+    T(ctx2.id != SG_INVALID_ID);
+    T(ctx2.id != ctx.id);
+    // destroying the current context switches back to the default context
+    sg_set_context(ctx2);
+    sg_destroy_context(ctx2);
+    T(sg_get_context().id == def_ctx.id);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, multiple_contexts_exhausted) {
+    setup(&(sg_desc){0});
+    sg_context ctxs[SG_MAX_CONTEXTS];
+    for (int i = 1; i < SG_MAX_CONTEXTS; i++) {
+        ctxs[i] = sg_make_context(&(sg_desc){0});
+        T(ctxs[i].id != SG_INVALID_ID);
+    }
+    sg_context ctx = sg_make_context(&(sg_desc){0});
+    T(ctx.id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_CONTEXT_POOL_EXHAUSTED);
+    for (int i = 1; i < SG_MAX_CONTEXTS; i++) {
+        sg_destroy_context(ctxs[i]);
+    }
+    sg_shutdown();
+}
+#endif
+
+#if defined(SOKOL_LOADER_THREADS) && !defined(_WIN32)
+static struct {
+    sg_buffer buf;
+    sg_image img;
+    sg_view tex_view;
+    sg_view bad_view;
+    sg_shader shd;
+    sg_pipeline pip;
+    sg_sampler smp;
+} loader;
+
+static void* loader_thread_func(void* arg) {
+    (void)arg;
+    loader.buf = create_buffer();
+    loader.img = sg_make_image(&(sg_image_desc){ .width = 16, .height = 16, .pixel_format = SG_PIXELFORMAT_RGBA8, .usage.stream_update = true });
+    // resources initialized on the same loader thread may reference each other before publication
+    loader.tex_view = sg_make_view(&(sg_view_desc){ .texture.image = loader.img });
+    loader.bad_view = sg_make_view(&(sg_view_desc){ .texture.image = sg_alloc_image() });
+    loader.shd = sg_make_shader(&(sg_shader_desc){0});
+    loader.pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = loader.shd,
+    });
+    loader.smp = sg_alloc_sampler();
+    sg_init_sampler(loader.smp, &(sg_sampler_desc){0});
+    return 0;
+}
+
+UTEST(sokol_gfx, loader_thread_make_resources) {
+    setup(&(sg_desc){0});
+    const uint32_t buffers_inited = sg_query_stats().total.buffers.inited;
+    pthread_t thread;
+    T(0 == pthread_create(&thread, 0, loader_thread_func, 0));
+    T(0 == pthread_join(thread, 0));
+    // resources are not visible to the render thread until the next sg_commit()
+    T(sg_query_buffer_state(loader.buf) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_image_state(loader.img) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_view_state(loader.tex_view) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_view_state(loader.bad_view) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_shader_state(loader.shd) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_pipeline_state(loader.pip) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_sampler_state(loader.smp) == SG_RESOURCESTATE_ALLOC);
+    // loader threads don't record stats
+    T(sg_query_stats().total.buffers.inited == buffers_inited);
+    sg_commit();
+    T(sg_query_buffer_state(loader.buf) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(loader.img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_view_state(loader.tex_view) == SG_RESOURCESTATE_VALID);
+    T(sg_query_view_state(loader.bad_view) == SG_RESOURCESTATE_FAILED);
+    T(sg_query_shader_state(loader.shd) == SG_RESOURCESTATE_VALID);
+    T(sg_query_pipeline_state(loader.pip) == SG_RESOURCESTATE_VALID);
+    T(sg_query_sampler_state(loader.smp) == SG_RESOURCESTATE_VALID);
+    // published resources behave like any other resource
+    sg_destroy_view(loader.tex_view);
+    sg_destroy_image(loader.img);
+    T(sg_query_image_state(loader.img) == SG_RESOURCESTATE_INVALID);
+    sg_shutdown();
+}
+
+static struct {
+    sg_context ctx;
+    sg_buffer render_buf;
+    sg_buffer loader_buf;
+    sg_resource_state render_buf_state;
+    sg_resource_state loader_buf_state_before_commit;
+    sg_resource_state loader_buf_state_after_commit;
+    uint32_t buffers_inited;
+} ctx_thread;
+
+static void* context_loader_thread_func(void* arg) {
+    (void)arg;
+    // the context already has a render thread, so this is a loader thread
+    sg_set_context(ctx_thread.ctx);
+    ctx_thread.loader_buf = create_buffer();
+    return 0;
+}
+
+static void* context_render_thread_func(void* arg) {
+    (void)arg;
+    // the first thread which makes the context current becomes its render thread
+    sg_set_context(ctx_thread.ctx);
+    ctx_thread.render_buf = create_buffer();
+    ctx_thread.render_buf_state = sg_query_buffer_state(ctx_thread.render_buf);
+    ctx_thread.buffers_inited = sg_query_stats().total.buffers.inited;
+    pthread_t thread;
+    if (0 == pthread_create(&thread, 0, context_loader_thread_func, 0)) {
+        pthread_join(thread, 0);
+    }
+    ctx_thread.loader_buf_state_before_commit = sg_query_buffer_state(ctx_thread.loader_buf);
+    sg_commit();
+    ctx_thread.loader_buf_state_after_commit = sg_query_buffer_state(ctx_thread.loader_buf);
+    sg_destroy_context(ctx_thread.ctx);
+    return 0;
+}
+
+UTEST(sokol_gfx, loader_thread_context_render_thread) {
+    setup(&(sg_desc){0});
+    memset(&ctx_thread, 0, sizeof(ctx_thread));
+    // the context is created on this thread, but rendered on another thread
+    ctx_thread.ctx = sg_make_context(&(sg_desc){0});
+    T(ctx_thread.ctx.id != SG_INVALID_ID);
+    pthread_t thread;
+    T(0 == pthread_create(&thread, 0, context_render_thread_func, 0));
+    T(0 == pthread_join(thread, 0));
+    T(ctx_thread.render_buf_state == SG_RESOURCESTATE_VALID);
+    T(ctx_thread.buffers_inited == 1);
+    T(ctx_thread.loader_buf_state_before_commit == SG_RESOURCESTATE_ALLOC);
+    T(ctx_thread.loader_buf_state_after_commit == SG_RESOURCESTATE_VALID);
+    T(sg_get_context().id == sg_default_context().id);
+    sg_shutdown();
+}
+#endif
+
+#if defined(SOKOL_MULTI_CONTEXT) && !defined(_WIN32)
+#define CONCURRENT_NUM_FRAMES (256)
+typedef struct {
+    sg_context ctx;
+    int pool_size;
+    bool ok;
+} concurrent_context_t;
+static int concurrent_start;
+
+static void* concurrent_context_thread_func(void* arg) {
+    concurrent_context_t* cc = (concurrent_context_t*)arg;
+    // start both threads at the same time to maximize the overlap
+    while (0 == __atomic_load_n(&concurrent_start, __ATOMIC_ACQUIRE)) { }
+    sg_set_context(cc->ctx);
+    bool ok = (sg_get_context().id == cc->ctx.id);
+    ok &= (_sg.pools.buffer_pool.size == cc->pool_size + 1);
+    for (int frame = 0; frame < CONCURRENT_NUM_FRAMES; frame++) {
+        sg_buffer buf = create_buffer();
+        sg_image img = create_image();
+        ok &= (sg_query_buffer_state(buf) == SG_RESOURCESTATE_VALID);
+        ok &= (sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+        ok &= (sg_query_stats().total.buffers.alive == 1);
+        sg_destroy_image(img);
+        sg_destroy_buffer(buf);
+        sg_commit();
+    }
+    ok &= (_sg.frame_index == CONCURRENT_NUM_FRAMES + 1);
+    sg_destroy_context(cc->ctx);
+    ok &= (sg_get_context().id == sg_default_context().id);
+    cc->ok = ok;
+    return 0;
+}
+
+UTEST(sokol_gfx, multiple_contexts_on_multiple_threads) {
+    setup(&(sg_desc){0});
+    sg_buffer def_buf = create_buffer();
+    concurrent_context_t cc[2] = {
+        { .pool_size = 4 },
+        { .pool_size = 8 },
+    };
+    for (int i = 0; i < 2; i++) {
+        cc[i].ctx = sg_make_context(&(sg_desc){ .buffer_pool_size = cc[i].pool_size });
+        T(cc[i].ctx.id != SG_INVALID_ID);
+    }
+    __atomic_store_n(&concurrent_start, 0, __ATOMIC_RELEASE);
+    pthread_t threads[2];
+    for (int i = 0; i < 2; i++) {
+        T(0 == pthread_create(&threads[i], 0, concurrent_context_thread_func, &cc[i]));
+    }
+    __atomic_store_n(&concurrent_start, 1, __ATOMIC_RELEASE);
+    for (int i = 0; i < 2; i++) {
+        T(0 == pthread_join(threads[i], 0));
+        T(cc[i].ok);
+    }
+    // the default context on this thread hasn't been touched
+    T(sg_get_context().id == sg_default_context().id);
+    T(sg_query_buffer_state(def_buf) == SG_RESOURCESTATE_VALID);
+    T(_sg.frame_index == 1);
+    sg_shutdown();
+}
+#endif
+
 static struct {
     uintptr_t userdata;
     int num_called;
@@ -1947,6 +2268,8 @@ UTEST(sokol_gfx, make_buffer_usage_stream_expect_no_data) {
     sg_shutdown();
 }
 
+// the software backend supports storage buffers
+#if !defined(SOKOL_SOFTWARE)
 UTEST(sokol_gfx, make_buffer_storagebuffer_not_supported_and_size) {
     setup(&(sg_desc){0});
     const uint8_t data[10] = {0};
@@ -1960,6 +2283,7 @@ UTEST(sokol_gfx, make_buffer_storagebuffer_not_supported_and_size) {
     T(log_items[2] == SG_LOGITEM_VALIDATION_FAILED);
     sg_shutdown();
 }
+#endif
 
 UTEST(sokol_gfx, make_image_validate_start_canary) {
     setup(&(sg_desc){0});
@@ -2085,6 +2409,56 @@ UTEST(sokol_gfx, make_image_validate_rt_immutable) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, make_image_validate_transient_no_attachment) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage = {
+            .transient_attachment = true,
+            .dynamic_update = true,
+        },
+        .width = 8,
+        .height = 8,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_TRANSIENT_EXPECT_ATTACHMENT);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, make_image_validate_transient_storage_image) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage = {
+            .color_attachment = true,
+            .storage_image = true,
+            .transient_attachment = true,
+        },
+        .width = 8,
+        .height = 8,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_TRANSIENT_STORAGEIMAGE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, make_image_validate_transient_resolve_attachment) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage = {
+            .resolve_attachment = true,
+            .transient_attachment = true,
+        },
+        .width = 8,
+        .height = 8,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_IMAGEDESC_TRANSIENT_EXPECT_ATTACHMENT);
+    T(log_items[1] == SG_LOGITEM_VALIDATE_IMAGEDESC_TRANSIENT_RESOLVEATTACHMENT);
+    T(log_items[2] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
 UTEST(sokol_gfx, make_image_validate_dynamic_no_data) {
     setup(&(sg_desc){0});
     uint32_t pixels[8][8] = {0};
@@ -2382,6 +2756,31 @@ UTEST(sokol_gfx, make_view_validate_image_no_usage) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, make_view_validate_texture_transient) {
+    setup(&(sg_desc){0});
+    const sg_image img = sg_make_image(&(sg_image_desc){
+        .usage = {
+            .depth_stencil_attachment = true,
+            .transient_attachment = true,
+        },
+        .width = 8,
+        .height = 8,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+    });
+    T(sg_query_image_state(img) == SG_RESOURCESTATE_VALID);
+    const sg_view ds_view = sg_make_view(&(sg_view_desc){
+        .depth_stencil_attachment.image = img,
+    });
+    T(sg_query_view_state(ds_view) == SG_RESOURCESTATE_VALID);
+    const sg_view tex_view = sg_make_view(&(sg_view_desc){
+        .texture.image = img,
+    });
+    T(sg_query_view_state(tex_view) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_VIEWDESC_TEXTURE_TRANSIENT);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
 UTEST(sokol_gfx, make_view_validate_color_inv_pixelformat) {
     setup(&(sg_desc){0});
     const sg_image_desc img_desc = {
@@ -2567,6 +2966,56 @@ UTEST(sokol_gfx, max_texture_bindings_per_stage_cs) {
     sg_shutdown();
 }
 
+UTEST(sokol_gfx, push_constant_uniform_block) {
+    setup(&(sg_desc){0});
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .uniform_blocks = {
+            [0] = { .stage = SG_SHADERSTAGE_VERTEX, .size = 128, .spirv_push_constant = true },
+            [1] = { .stage = SG_SHADERSTAGE_FRAGMENT, .size = 16 },
+        },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, push_constant_uniform_block_unique) {
+    setup(&(sg_desc){0});
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .uniform_blocks = {
+            [0] = { .stage = SG_SHADERSTAGE_VERTEX, .size = 64, .spirv_push_constant = true },
+            [1] = { .stage = SG_SHADERSTAGE_FRAGMENT, .size = 16, .spirv_push_constant = true },
+        },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_UNIFORMBLOCK_PUSH_CONSTANT_UNIQUE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, push_constant_uniform_block_size) {
+    setup(&(sg_desc){0});
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_VERTEX, .size = 144, .spirv_push_constant = true },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_UNIFORMBLOCK_PUSH_CONSTANT_SIZE);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, bindless_not_supported) {
+    setup(&(sg_desc){ .vulkan.bindless = true });
+    T(!sg_query_features().bindless);
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){0});
+    T(sg_query_sampler_state(smp) == SG_RESOURCESTATE_VALID);
+    T(sg_query_sampler_bindless_index(smp) == 0);
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){ .spirv_bindless = true });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_FAILED);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_SHADERDESC_BINDLESS_NOT_SUPPORTED);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    sg_shutdown();
+}
+
 UTEST(sokol_gfx, max_storagebuffer_bindings_per_stage_vs) {
     setup(&(sg_desc){0});
     sg_shader_desc desc = {0};
@@ -2733,3 +3182,1234 @@ UTEST(sokol_gfx, max_pass_attachments) {
     sg_commit();
     sg_shutdown();
 }
+
+UTEST(sokol_gfx, begin_pass_validate_async_compute_expect_compute) {
+    setup(&(sg_desc){0});
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = 64,
+        .height = 64,
+    });
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    sg_begin_pass(&(sg_pass){ .async_compute = true, .attachments.colors[0] = att });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINPASS_ASYNC_COMPUTE_EXPECT_COMPUTE);
+    sg_end_pass();
+    sg_commit();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, async_compute_pass_without_support) {
+    setup(&(sg_desc){0});
+    T(!sg_query_features().async_compute);
+    sg_begin_pass(&(sg_pass){ .compute = true, .async_compute = true });
+    T(num_log_called == 0);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame_passes.num_passes == 1);
+    sg_shutdown();
+}
+
+#if !defined(SOKOL_SOFTWARE)
+UTEST(sokol_gfx, dispatch_indirect_validate_not_supported) {
+    setup(&(sg_desc){0});
+    T(!sg_query_features().dispatch_indirect);
+    sg_buffer buf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .size = 16,
+    });
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){ .compute_func.source = "cs" }),
+    });
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_dispatch_indirect(buf, 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DISPATCH_INDIRECT_NOT_SUPPORTED);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.num_dispatch_indirect == 1);
+    sg_shutdown();
+}
+#endif
+
+UTEST(sokol_gfx, apply_uniform_buffer_validate) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().uniform_buffer_bindings);
+    const int align = sg_query_limits().uniform_buffer_offset_alignment;
+    T(align > 4);
+    sg_buffer ubuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage = { .uniform_buffer = true, .stream_update = true },
+        .size = (size_t)(2 * align),
+    });
+    T(sg_query_buffer_state(ubuf) == SG_RESOURCESTATE_VALID);
+    T(!sg_query_buffer_usage(ubuf).vertex_buffer);
+    sg_buffer vbuf = create_buffer();
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_VERTEX, .size = 16 },
+        }),
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_apply_pipeline(pip);
+    sg_apply_uniform_buffer(0, ubuf, align);
+    T(num_log_called == 0);
+    sg_apply_uniform_buffer(0, ubuf, 4);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_AUB_OFFSET_ALIGNMENT);
+    sg_apply_uniform_buffer(0, ubuf, 2 * align);
+    T(log_items[2] == SG_LOGITEM_VALIDATE_AUB_BUFFER_SIZE);
+    sg_apply_uniform_buffer(0, vbuf, 0);
+    T(log_items[4] == SG_LOGITEM_VALIDATE_AUB_EXPECT_UNIFORMBUFFER);
+    sg_apply_uniform_buffer(1, ubuf, 0);
+    T(log_items[6] == SG_LOGITEM_VALIDATE_AUB_NO_UNIFORMBLOCK_AT_SLOT);
+    // offset + size must not overflow
+    sg_apply_uniform_buffer(0, ubuf, (INT_MAX / align) * align);
+    T(log_items[8] == SG_LOGITEM_VALIDATE_AUB_BUFFER_SIZE);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.num_apply_uniform_buffer == 6);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, draw_batch_stats) {
+    setup(&(sg_desc){0});
+    const sg_draw_args args[3] = {
+        { .num_elements = 3, .num_instances = 1 },
+        { .base_element = 3, .num_elements = 3, .num_instances = 1 },
+        { .base_element = 6, .num_elements = 6, .num_instances = 2 },
+    };
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_draw_batch(args, 3);
+    sg_draw_batch(0, 0);
+    sg_end_pass();
+    sg_commit();
+    const sg_stats stats = sg_query_stats();
+    T(stats.prev_frame.num_draw_batch == 2);
+    T(stats.prev_frame.num_draw_batch_items == 3);
+    T(stats.prev_frame.num_draw == 0);
+    T(stats.prev_frame_passes.num_passes == 1);
+    T(stats.prev_frame_passes.passes[0].num_draw_batch_items == 3);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, make_destroy_counters) {
+    setup(&(sg_desc){ .counter_pool_size = 2 });
+    T(sg_query_features().occlusion_counter);
+    sg_counter ctr0 = sg_make_counter(&(sg_counter_desc){ .label = "ctr0" });
+    sg_counter ctr1 = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_OCCLUSION });
+    T(sg_query_counter_state(ctr0) == SG_RESOURCESTATE_VALID);
+    T(sg_query_counter_state(ctr1) == SG_RESOURCESTATE_VALID);
+    T(!sg_query_counter_value(ctr0).available);
+    // the pool is exhausted
+    T(sg_make_counter(&(sg_counter_desc){0}).id == SG_INVALID_ID);
+    T(log_items[0] == SG_LOGITEM_COUNTER_POOL_EXHAUSTED);
+    sg_destroy_counter(ctr0);
+    sg_destroy_counter(ctr1);
+    T(sg_query_counter_state(ctr0) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_counter_state(ctr1) == SG_RESOURCESTATE_INVALID);
+    T(!sg_query_counter_value(ctr0).available);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, alloc_fail_destroy_counters) {
+    setup(&(sg_desc){ .counter_pool_size = 3 });
+    sg_counter ctrs[3] = { {0} };
+    for (int i = 0; i < 3; i++) {
+        ctrs[i] = sg_alloc_counter();
+        T(ctrs[i].id != SG_INVALID_ID);
+        T((2-i) == _sg.pools.counter_pool.queue_top);
+        T(sg_query_counter_state(ctrs[i]) == SG_RESOURCESTATE_ALLOC);
+    }
+    // the next alloc will fail because the pool is exhausted
+    sg_counter ctr3 = sg_alloc_counter();
+    T(ctr3.id == SG_INVALID_ID);
+    T(sg_query_counter_state(ctr3) == SG_RESOURCESTATE_INVALID);
+    for (int i = 0; i < 3; i++) {
+        sg_fail_counter(ctrs[i]);
+        T(sg_query_counter_state(ctrs[i]) == SG_RESOURCESTATE_FAILED);
+    }
+    for (int i = 0; i < 3; i++) {
+        sg_destroy_counter(ctrs[i]);
+        T(sg_query_counter_state(ctrs[i]) == SG_RESOURCESTATE_INVALID);
+        T((i+1) == _sg.pools.counter_pool.queue_top);
+    }
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, counter_resource_states) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_alloc_counter();
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_ALLOC);
+    sg_init_counter(ctr, &(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_VALID);
+    sg_uninit_counter(ctr);
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_ALLOC);
+    sg_dealloc_counter(ctr);
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_INVALID);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, counter_uninit_count) {
+    setup(&(sg_desc){0});
+    const sg_counter_desc desc = {0};
+    sg_counter ctr = sg_make_counter(&desc);
+    T(sg_query_counter_info(ctr).slot.uninit_count == 0);
+    sg_uninit_counter(ctr);
+    T(sg_query_counter_info(ctr).slot.uninit_count == 1);
+    sg_init_counter(ctr, &desc);
+    T(sg_query_counter_info(ctr).slot.uninit_count == 1);
+    sg_uninit_counter(ctr);
+    T(sg_query_counter_info(ctr).slot.uninit_count == 2);
+    sg_dealloc_counter(ctr);
+    T(sg_query_counter_info(ctr).slot.uninit_count == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, counter_invalid_state) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){0});
+    sg_dealloc_counter(ctr);
+    T(log_items[0] == SG_LOGITEM_DEALLOC_COUNTER_INVALID_STATE);
+    sg_init_counter(ctr, &(sg_counter_desc){0});
+    T(log_items[1] == SG_LOGITEM_INIT_COUNTER_INVALID_STATE);
+    sg_fail_counter(ctr);
+    T(log_items[2] == SG_LOGITEM_FAIL_COUNTER_INVALID_STATE);
+    T(num_log_called == 3);
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_VALID);
+    sg_destroy_counter(ctr);
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_INVALID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, alloc_destroy_counter_is_ok) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_alloc_counter();
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_ALLOC);
+    sg_destroy_counter(ctr);
+    T(num_log_called == 0);
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_INVALID);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, uninit_active_counter) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){0});
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_begin_counter(ctr);
+    // uninit implicitly ends the active counter
+    sg_uninit_counter(ctr);
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_ALLOC);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    sg_dealloc_counter(ctr);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, query_counter_info_desc_defaults) {
+    setup(&(sg_desc){0});
+    const sg_counter_desc def = sg_query_counter_defaults(&(sg_counter_desc){0});
+    T(def.type == SG_COUNTERTYPE_OCCLUSION);
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    const sg_counter_info info = sg_query_counter_info(ctr);
+    T(info.slot.state == SG_RESOURCESTATE_VALID);
+    T(info.slot.res_id == ctr.id);
+    T(sg_query_counter_desc(ctr).type == SG_COUNTERTYPE_PIPELINE_STATISTICS);
+    sg_destroy_counter(ctr);
+    T(sg_query_counter_desc(ctr).type == _SG_COUNTERTYPE_DEFAULT);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, counter_resource_stats) {
+    setup(&(sg_desc){ .counter_pool_size = 4 });
+    sg_counter ctr0 = sg_make_counter(&(sg_counter_desc){0});
+    sg_counter ctr1 = sg_alloc_counter();
+    sg_destroy_counter(ctr0);
+    const sg_frame_stats frame = sg_query_stats().cur_frame;
+    T(frame.counters.allocated == 2);
+    T(frame.counters.inited == 1);
+    T(frame.counters.uninited == 1);
+    T(frame.counters.deallocated == 1);
+    sg_commit();
+    const sg_stats stats = sg_query_stats();
+    T(stats.prev_frame.counters.allocated == 2);
+    T(stats.total.counters.alive == 1);
+    T(stats.total.counters.free == 3);
+    T(stats.total.counters.allocated == 2);
+    T(stats.total.counters.deallocated == 1);
+    T(stats.total.counters.inited == 1);
+    T(stats.total.counters.uninited == 1);
+    sg_destroy_counter(ctr1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, counter_value_available_after_commit) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){0});
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_begin_counter(ctr);
+    sg_end_counter(ctr);
+    sg_end_pass();
+    T(!sg_query_counter_value(ctr).available);
+    const uint32_t frame_index = _sg.frame_index;
+    sg_commit();
+    const sg_counter_value val = sg_query_counter_value(ctr);
+    T(val.available);
+    T(val.frame_index == frame_index);
+    T(num_log_called == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, begin_counter_validate) {
+    setup(&(sg_desc){0});
+    sg_counter ctr0 = sg_make_counter(&(sg_counter_desc){0});
+    sg_counter ctr1 = sg_make_counter(&(sg_counter_desc){0});
+    // outside a render pass
+    sg_begin_counter(ctr0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINCOUNTER_RENDERPASS_EXPECTED);
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_counter(ctr0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINCOUNTER_RENDERPASS_EXPECTED);
+    sg_end_pass();
+    reset_log_items();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_begin_counter(ctr0);
+    T(num_log_called == 0);
+    sg_begin_counter(ctr1);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINCOUNTER_ALREADY_ACTIVE);
+    reset_log_items();
+    sg_end_counter(ctr1);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_ENDCOUNTER_NOT_ACTIVE);
+    reset_log_items();
+    sg_end_counter(ctr0);
+    sg_begin_counter(ctr0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINCOUNTER_ONCE_PER_FRAME);
+    reset_log_items();
+    sg_begin_counter((sg_counter){ 0xFFFF0001 });
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINCOUNTER_EXISTS);
+    sg_end_pass();
+    sg_commit();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, end_pass_with_active_counter) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){0});
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_begin_counter(ctr);
+    sg_end_pass();
+    T(log_items[0] == SG_LOGITEM_END_PASS_COUNTER_STILL_ACTIVE);
+    reset_log_items();
+    // the next pass can start a new counter
+    sg_counter ctr1 = sg_make_counter(&(sg_counter_desc){0});
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_begin_counter(ctr1);
+    sg_destroy_counter(ctr1);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    T(sg_query_counter_value(ctr).available);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, pipeline_statistics_counter) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().pipeline_statistics_counter);
+    sg_counter occlusion_ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_OCCLUSION });
+    sg_counter stats_ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    sg_counter compute_stats_ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    T(sg_query_counter_state(stats_ctr) == SG_RESOURCESTATE_VALID);
+    // one counter per type can be active at the same time
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_begin_counter(stats_ctr);
+    sg_begin_counter(occlusion_ctr);
+    sg_end_counter(occlusion_ctr);
+    sg_begin_counter(compute_stats_ctr);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_BEGINCOUNTER_ALREADY_ACTIVE);
+    reset_log_items();
+    sg_end_counter(stats_ctr);
+    sg_end_pass();
+    // pipeline statistics counters also work in compute passes
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_begin_counter(compute_stats_ctr);
+    sg_end_counter(compute_stats_ctr);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    T(sg_query_counter_value(stats_ctr).available);
+    T(sg_query_counter_value(compute_stats_ctr).available);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, pipeline_statistics_counter_pass_stats) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    const uint32_t first_frame_index = _sg.frame_index;
+    for (uint32_t frame = 0; frame < 2; frame++) {
+        sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view(), .label = "main" });
+        sg_begin_counter(ctr);
+        sg_end_counter(ctr);
+        sg_end_pass();
+        sg_commit();
+    }
+    // the result of the first frame shows up in the pass stats of the second frame
+    T(sg_query_stats().prev_frame_passes.num_passes == 1);
+    T(0 == strcmp(sg_query_stats().prev_frame_passes.passes[0].label, "main"));
+    T(sg_query_stats().prev_frame_passes.passes[0].pipeline_stats_frame_index == first_frame_index);
+    T(sg_query_counter_value(ctr).available);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, pipeline_statistics_counter_pass_stats_other_pass) {
+    setup(&(sg_desc){0});
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    const char* labels[3] = { "shadow", "main", "main" };
+    const uint32_t first_frame_index = _sg.frame_index;
+    for (uint32_t frame = 0; frame < 3; frame++) {
+        sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view(), .label = labels[frame] });
+        sg_begin_counter(ctr);
+        sg_end_counter(ctr);
+        sg_end_pass();
+        if (frame == 1) {
+            // the available result was recorded in the 'shadow' pass, and isn't attached to 'main'
+            T(sg_query_counter_value(ctr).available);
+            T(sg_query_stats().cur_frame_passes.passes[0].pipeline_stats_frame_index == 0);
+        }
+        sg_commit();
+    }
+    // in the third frame the result of the second frame's 'main' pass is attached
+    T(sg_query_stats().prev_frame_passes.passes[0].pipeline_stats_frame_index == (first_frame_index + 1));
+    sg_shutdown();
+}
+
+#if defined(SOKOL_DUMMY_BACKEND)
+// the dummy backend simulates background shader compilation, finishing in the next sg_commit()
+UTEST(sokol_gfx, parallel_shader_compile) {
+    setup(&(sg_desc){ .parallel_shader_compile = true });
+    T(sg_query_features().parallel_shader_compile);
+    sg_shader shd = create_shader();
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_ALLOC);
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = shd,
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_ALLOC);
+    const sg_draw_args args[2] = {
+        { .num_elements = 3, .num_instances = 1 },
+        { .num_elements = 3, .num_instances = 1 },
+    };
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = create_buffer() });
+    sg_draw(0, 3, 1);
+    sg_draw_batch(args, 2);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    T(sg_query_stats().prev_frame.num_skipped_draws == 3);
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = create_view() });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = create_buffer() });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.num_skipped_draws == 0);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, parallel_shader_compile_destroy_pending) {
+    setup(&(sg_desc){ .parallel_shader_compile = true });
+    sg_shader shd = create_shader();
+    sg_pipeline pip0 = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = shd,
+    });
+    sg_pipeline pip1 = sg_make_pipeline(&(sg_pipeline_desc){
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3,
+        .shader = shd,
+    });
+    sg_destroy_pipeline(pip0);
+    T(sg_query_pipeline_state(pip0) == SG_RESOURCESTATE_INVALID);
+    // a pipeline fails when its shader is destroyed while compiling
+    sg_destroy_shader(shd);
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_INVALID);
+    T(sg_query_pipeline_state(pip1) == SG_RESOURCESTATE_ALLOC);
+    sg_commit();
+    T(sg_query_pipeline_state(pip1) == SG_RESOURCESTATE_FAILED);
+    // shutdown with pending resources
+    create_pipeline();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, parallel_shader_compile_uninit_pending) {
+    setup(&(sg_desc){ .parallel_shader_compile = true });
+    sg_shader shd = sg_alloc_shader();
+    sg_init_shader(shd, &(sg_shader_desc){0});
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_ALLOC);
+    // a shader which is still compiling can't be initialized or deallocated
+    sg_init_shader(shd, &(sg_shader_desc){0});
+    T(log_items[0] == SG_LOGITEM_INIT_SHADER_INVALID_STATE);
+    sg_dealloc_shader(shd);
+    T(log_items[1] == SG_LOGITEM_DEALLOC_SHADER_INVALID_STATE);
+    sg_uninit_shader(shd);
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_ALLOC);
+    sg_commit();
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_ALLOC);
+    sg_init_shader(shd, &(sg_shader_desc){0});
+    sg_commit();
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    sg_shutdown();
+}
+#endif
+
+#if defined(SOKOL_SOFTWARE)
+// software backend rendering tests, these check actual pixel results
+
+typedef struct {
+    float pos[2];
+    float color[4];
+} sw_vertex_t;
+
+static void sw_vs(const sg_sw_shader_context* ctx, sg_sw_vertex* vtx) {
+    (void)ctx;
+    vtx->pos[0] = vtx->attrs[0][0];
+    vtx->pos[1] = vtx->attrs[0][1];
+    vtx->pos[2] = vtx->attrs[0][2];
+    vtx->pos[3] = 1.0f;
+    for (int i = 0; i < 4; i++) {
+        vtx->varyings[i] = vtx->attrs[1][i];
+    }
+}
+
+static bool sw_fs(const sg_sw_shader_context* ctx, sg_sw_fragment* frag) {
+    (void)ctx;
+    for (int i = 0; i < 4; i++) {
+        frag->colors[0][i] = frag->varyings[i];
+    }
+    return true;
+}
+
+static void sw_tex_vs(const sg_sw_shader_context* ctx, sg_sw_vertex* vtx) {
+    (void)ctx;
+    vtx->pos[0] = vtx->attrs[0][0];
+    vtx->pos[1] = vtx->attrs[0][1];
+    vtx->pos[2] = 0.5f;
+    vtx->pos[3] = 1.0f;
+    vtx->varyings[0] = vtx->attrs[0][0] * 0.5f + 0.5f;
+    vtx->varyings[1] = 0.5f - vtx->attrs[0][1] * 0.5f;
+}
+
+static bool sw_tex_fs(const sg_sw_shader_context* ctx, sg_sw_fragment* frag) {
+    const float uvw[3] = { frag->varyings[0], frag->varyings[1], 0.0f };
+    sg_sw_sample(ctx, 0, 0, uvw, 0.0f, frag->colors[0]);
+    return true;
+}
+
+static void sw_cs(const sg_sw_shader_context* ctx, const sg_sw_workgroup* wg) {
+    uint32_t* data = (uint32_t*) ctx->storage_buffers[0];
+    const uint32_t* params = (const uint32_t*) ctx->uniforms[0];
+    for (int i = 0; i < 16; i++) {
+        const int idx = wg->id[0] * 16 + i;
+        data[idx] = (uint32_t)idx * params[0];
+    }
+}
+
+static sg_shader sw_create_shader(void) {
+    return sg_make_shader(&(sg_shader_desc){
+        .software = {
+            .vertex_func = sw_vs,
+            .fragment_func = sw_fs,
+            .num_varyings = 4,
+        },
+    });
+}
+
+static sg_pipeline sw_create_pipeline(sg_shader shd, const sg_pipeline_desc* extra) {
+    sg_pipeline_desc desc = *extra;
+    desc.shader = shd;
+    desc.layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT3;
+    desc.layout.attrs[1].format = SG_VERTEXFORMAT_FLOAT4;
+    return sg_make_pipeline(&desc);
+}
+
+static sg_image sw_create_target(int width, int height) {
+    return sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+}
+
+static uint32_t sw_rgba8(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return (uint32_t)r | ((uint32_t)g << 8) | ((uint32_t)b << 16) | ((uint32_t)a << 24);
+}
+
+UTEST(sokol_gfx, sw_clear_and_read_image) {
+    setup(&(sg_desc){0});
+    sg_image img = sw_create_target(100, 70);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.5f, 1.0f } },
+        .attachments.colors[0] = att,
+    });
+    sg_end_pass();
+    sg_commit();
+    static uint32_t pixels[100 * 70];
+    T(sg_sw_read_image(img, 0, 0, &SG_RANGE(pixels)));
+    const uint32_t expected = sw_rgba8(255, 0, 128, 255);
+    bool all_match = true;
+    for (int i = 0; i < 100 * 70; i++) {
+        all_match &= (pixels[i] == expected);
+    }
+    T(all_match);
+    // destination buffer too small
+    uint32_t small[16];
+    T(!sg_sw_read_image(img, 0, 0, &SG_RANGE(small)));
+    T(log_items[0] == SG_LOGITEM_SOFTWARE_READ_IMAGE_BUFFER_TOO_SMALL);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_draw_triangle) {
+    setup(&(sg_desc){0});
+    sg_image img = sw_create_target(64, 64);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    // a triangle covering the left half of the render target
+    const float vertices[] = {
+        +0.0f, -1.0f, 0.5f,  0.0f, 1.0f, 0.0f, 1.0f,
+        +0.0f, +3.0f, 0.5f,  0.0f, 1.0f, 0.0f, 1.0f,
+        -2.0f, -1.0f, 0.5f,  0.0f, 1.0f, 0.0f, 1.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = att,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    static uint32_t pixels[64 * 64];
+    T(sg_sw_read_image(img, 0, 0, &SG_RANGE(pixels)));
+    const uint32_t green = sw_rgba8(0, 255, 0, 255);
+    const uint32_t black = sw_rgba8(0, 0, 0, 255);
+    bool all_match = true;
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 64; x++) {
+            all_match &= pixels[y * 64 + x] == ((x < 32) ? green : black);
+        }
+    }
+    T(all_match);
+    sg_shutdown();
+}
+
+#if defined(SOKOL_MULTI_CONTEXT)
+UTEST(sokol_gfx, sw_multiple_contexts) {
+    setup(&(sg_desc){0});
+    // rasterizer worker threads must operate on the context which created them
+    sg_context ctx = sg_make_context(&(sg_desc){ .software.num_threads = 4, .logger.func = test_logger });
+    T(ctx.id != SG_INVALID_ID);
+    sg_set_context(ctx);
+    sg_image img = sw_create_target(64, 64);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    const float vertices[] = {
+        -1.0f, -1.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +3.0f, -1.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+        -1.0f, +3.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = att,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    static uint32_t pixels[64 * 64];
+    T(sg_sw_read_image(img, 0, 0, &SG_RANGE(pixels)));
+    const uint32_t red = sw_rgba8(255, 0, 0, 255);
+    bool all_match = true;
+    for (int i = 0; i < 64 * 64; i++) {
+        all_match &= (pixels[i] == red);
+    }
+    T(all_match);
+    sg_set_context(sg_default_context());
+    sg_destroy_context(ctx);
+    T(sg_isvalid());
+    sg_shutdown();
+}
+#endif
+
+UTEST(sokol_gfx, sw_draw_batch) {
+    setup(&(sg_desc){0});
+    sg_image img = sw_create_target(64, 64);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    // a green triangle covering the left half and a red triangle covering the right half
+    const float vertices[] = {
+        +0.0f, -1.0f, 0.5f,  0.0f, 1.0f, 0.0f, 1.0f,
+        +0.0f, +3.0f, 0.5f,  0.0f, 1.0f, 0.0f, 1.0f,
+        -2.0f, -1.0f, 0.5f,  0.0f, 1.0f, 0.0f, 1.0f,
+        +0.0f, -1.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +2.0f, -1.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +0.0f, +3.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    const sg_draw_args args[3] = {
+        { .base_element = 0, .num_elements = 3, .num_instances = 1 },
+        { .base_element = 0, .num_elements = 0, .num_instances = 1 },
+        { .base_element = 3, .num_elements = 3, .num_instances = 1 },
+    };
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = att,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw_batch(args, 3);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    static uint32_t pixels[64 * 64];
+    T(sg_sw_read_image(img, 0, 0, &SG_RANGE(pixels)));
+    const uint32_t green = sw_rgba8(0, 255, 0, 255);
+    const uint32_t red = sw_rgba8(255, 0, 0, 255);
+    bool all_match = true;
+    for (int y = 0; y < 64; y++) {
+        for (int x = 0; x < 64; x++) {
+            all_match &= pixels[y * 64 + x] == ((x < 32) ? green : red);
+        }
+    }
+    T(all_match);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_draw_batch_validate) {
+    setup(&(sg_desc){0});
+    sg_image img = sw_create_target(16, 16);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    const float vertices[3 * 7] = {0};
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    const sg_draw_args args[3] = {
+        { .num_elements = 3, .num_instances = 1 },
+        { .num_elements = -3, .num_instances = 1 },
+        { .num_elements = -3, .num_instances = 1 },
+    };
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw_batch(args, 3);
+    // only the first failing draw is reported
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DRAW_BATCH_NUMELEMENTS_GE_ZERO);
+    T(log_items[1] == SG_LOGITEM_VALIDATION_FAILED);
+    T(num_log_called == 2);
+    sg_end_pass();
+    sg_commit();
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_depth_test) {
+    setup(&(sg_desc){0});
+    sg_image color_img = sw_create_target(32, 32);
+    sg_image depth_img = sg_make_image(&(sg_image_desc){
+        .usage.depth_stencil_attachment = true,
+        .width = 32,
+        .height = 32,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+    });
+    sg_view color_att = sg_make_view(&(sg_view_desc){ .color_attachment.image = color_img });
+    sg_view depth_att = sg_make_view(&(sg_view_desc){ .depth_stencil_attachment.image = depth_img });
+    // two fullscreen triangles, the first (red) is closer than the second (blue)
+    const float vertices[] = {
+        -1.0f, -1.0f, 0.25f,  1.0f, 0.0f, 0.0f, 1.0f,
+        -1.0f, +3.0f, 0.25f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +3.0f, -1.0f, 0.25f,  1.0f, 0.0f, 0.0f, 1.0f,
+        -1.0f, -1.0f, 0.75f,  0.0f, 0.0f, 1.0f, 1.0f,
+        -1.0f, +3.0f, 0.75f,  0.0f, 0.0f, 1.0f, 1.0f,
+        +3.0f, -1.0f, 0.75f,  0.0f, 0.0f, 1.0f, 1.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .cull_mode = SG_CULLMODE_NONE,
+    });
+    sg_begin_pass(&(sg_pass){
+        .action = {
+            .colors[0] = { .load_action = SG_LOADACTION_CLEAR },
+            .depth = { .load_action = SG_LOADACTION_CLEAR, .clear_value = 1.0f },
+        },
+        .attachments = { .colors[0] = color_att, .depth_stencil = depth_att },
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 6, 1);
+    sg_end_pass();
+    sg_commit();
+    static uint32_t pixels[32 * 32];
+    T(sg_sw_read_image(color_img, 0, 0, &SG_RANGE(pixels)));
+    T(pixels[0] == sw_rgba8(255, 0, 0, 255));
+    T(pixels[16 * 32 + 16] == sw_rgba8(255, 0, 0, 255));
+    T(pixels[32 * 32 - 1] == sw_rgba8(255, 0, 0, 255));
+    static float depth[32 * 32];
+    T(sg_sw_read_image(depth_img, 0, 0, &SG_RANGE(depth)));
+    T(depth[16 * 32 + 16] == 0.25f);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_occlusion_counter) {
+    setup(&(sg_desc){0});
+    sg_image color_img = sw_create_target(32, 32);
+    sg_image depth_img = sg_make_image(&(sg_image_desc){
+        .usage.depth_stencil_attachment = true,
+        .width = 32,
+        .height = 32,
+        .pixel_format = SG_PIXELFORMAT_DEPTH,
+    });
+    sg_view color_att = sg_make_view(&(sg_view_desc){ .color_attachment.image = color_img });
+    sg_view depth_att = sg_make_view(&(sg_view_desc){ .depth_stencil_attachment.image = depth_img });
+    // a fullscreen occluder, followed by a fully hidden triangle covering the left half
+    const float vertices[] = {
+        -1.0f, -1.0f, 0.25f,  1.0f, 0.0f, 0.0f, 1.0f,
+        -1.0f, +3.0f, 0.25f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +3.0f, -1.0f, 0.25f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +0.0f, -1.0f, 0.75f,  0.0f, 0.0f, 1.0f, 1.0f,
+        +0.0f, +3.0f, 0.75f,  0.0f, 0.0f, 1.0f, 1.0f,
+        -2.0f, -1.0f, 0.75f,  0.0f, 0.0f, 1.0f, 1.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth = {
+            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .compare = SG_COMPAREFUNC_LESS,
+            .write_enabled = true,
+        },
+        .cull_mode = SG_CULLMODE_NONE,
+    });
+    sg_counter visible_ctr = sg_make_counter(&(sg_counter_desc){0});
+    sg_counter hidden_ctr = sg_make_counter(&(sg_counter_desc){0});
+    sg_begin_pass(&(sg_pass){
+        .action = {
+            .colors[0] = { .load_action = SG_LOADACTION_CLEAR },
+            .depth = { .load_action = SG_LOADACTION_CLEAR, .clear_value = 1.0f },
+        },
+        .attachments = { .colors[0] = color_att, .depth_stencil = depth_att },
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_begin_counter(visible_ctr);
+    sg_draw(0, 3, 1);
+    sg_end_counter(visible_ctr);
+    sg_begin_counter(hidden_ctr);
+    sg_draw(3, 3, 1);
+    sg_end_counter(hidden_ctr);
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    const sg_counter_value visible = sg_query_counter_value(visible_ctr);
+    const sg_counter_value hidden = sg_query_counter_value(hidden_ctr);
+    T(visible.available && (visible.samples_passed == 32 * 32));
+    T(hidden.available && (hidden.samples_passed == 0));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_pipeline_statistics_counter) {
+    setup(&(sg_desc){0});
+    sg_image img = sw_create_target(32, 32);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    // a fullscreen triangle which needs to be clipped
+    const float vertices[] = {
+        -1.0f, -1.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+        -1.0f, +3.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+        +3.0f, -1.0f, 0.5f,  1.0f, 0.0f, 0.0f, 1.0f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        .cull_mode = SG_CULLMODE_NONE,
+    });
+    sg_pipeline compute_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .software.compute_func = sw_cs,
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_COMPUTE, .size = 16 },
+            .views[0].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE },
+        }),
+    });
+    static uint32_t data[64];
+    sg_view sbuf_view = sg_make_view(&(sg_view_desc){
+        .storage_buffer.buffer = sg_make_buffer(&(sg_buffer_desc){
+            .usage.storage_buffer = true,
+            .data = SG_RANGE(data),
+        }),
+    });
+    sg_counter render_ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    sg_counter compute_ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_PIPELINE_STATISTICS });
+    for (int frame = 0; frame < 2; frame++) {
+        sg_begin_pass(&(sg_pass){
+            .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR },
+            .attachments.colors[0] = att,
+            .label = "render",
+        });
+        sg_begin_counter(render_ctr);
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+        sg_draw(0, 3, 1);
+        sg_end_counter(render_ctr);
+        sg_end_pass();
+        const uint32_t params[4] = { 1, 0, 0, 0 };
+        sg_begin_pass(&(sg_pass){ .compute = true, .label = "compute" });
+        sg_begin_counter(compute_ctr);
+        sg_apply_pipeline(compute_pip);
+        sg_apply_bindings(&(sg_bindings){ .views[0] = sbuf_view });
+        sg_apply_uniforms(0, &SG_RANGE(params));
+        sg_dispatch(4, 1, 1);
+        sg_end_counter(compute_ctr);
+        sg_end_pass();
+        sg_commit();
+    }
+    T(num_log_called == 0);
+    const sg_pipeline_stats render_stats = sg_query_counter_value(render_ctr).pipeline_stats;
+    T(render_stats.vertex_invocations == 3);
+    T(render_stats.fragment_invocations == 32 * 32);
+    T(render_stats.compute_invocations == 0);
+    T(render_stats.clipping_input_primitives == 1);
+    T(render_stats.clipping_output_primitives >= 1);
+    const sg_pipeline_stats compute_stats = sg_query_counter_value(compute_ctr).pipeline_stats;
+    T(compute_stats.compute_invocations == 4);
+    T(compute_stats.vertex_invocations == 0);
+    T(compute_stats.fragment_invocations == 0);
+    // the per-pass stats contain the first frame's results
+    const sg_stats stats = sg_query_stats();
+    T(stats.prev_frame_passes.num_passes == 2);
+    T(stats.prev_frame_passes.passes[0].pipeline_stats.fragment_invocations == 32 * 32);
+    T(stats.prev_frame_passes.passes[1].pipeline_stats.compute_invocations == 4);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_alpha_blending) {
+    setup(&(sg_desc){0});
+    sg_image img = sw_create_target(16, 16);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    const float vertices[] = {
+        -1.0f, -1.0f, 0.5f,  1.0f, 1.0f, 1.0f, 0.5f,
+        -1.0f, +3.0f, 0.5f,  1.0f, 1.0f, 1.0f, 0.5f,
+        +3.0f, -1.0f, 0.5f,  1.0f, 1.0f, 1.0f, 0.5f,
+    };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sw_create_pipeline(sw_create_shader(), &(sg_pipeline_desc){
+        .colors[0] = {
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+            .blend = {
+                .enabled = true,
+                .src_factor_rgb = SG_BLENDFACTOR_SRC_ALPHA,
+                .dst_factor_rgb = SG_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                .src_factor_alpha = SG_BLENDFACTOR_ONE,
+                .dst_factor_alpha = SG_BLENDFACTOR_ZERO,
+            },
+        },
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        .cull_mode = SG_CULLMODE_NONE,
+    });
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 1.0f, 1.0f } },
+        .attachments.colors[0] = att,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    static uint32_t pixels[16 * 16];
+    T(sg_sw_read_image(img, 0, 0, &SG_RANGE(pixels)));
+    T(pixels[8 * 16 + 8] == sw_rgba8(128, 128, 255, 128));
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_render_to_texture_and_sample) {
+    setup(&(sg_desc){0});
+    // first pass: clear an 8x8 offscreen image to yellow
+    sg_image tex_img = sw_create_target(8, 8);
+    sg_view tex_att = sg_make_view(&(sg_view_desc){ .color_attachment.image = tex_img });
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 1.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = tex_att,
+    });
+    sg_end_pass();
+    // second pass: render a fullscreen triangle sampling the offscreen image
+    sg_image img = sw_create_target(32, 32);
+    sg_view att = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    sg_view tex_view = sg_make_view(&(sg_view_desc){ .texture.image = tex_img });
+    sg_sampler smp = sg_make_sampler(&(sg_sampler_desc){
+        .min_filter = SG_FILTER_LINEAR,
+        .mag_filter = SG_FILTER_LINEAR,
+    });
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .software = {
+            .vertex_func = sw_tex_vs,
+            .fragment_func = sw_tex_fs,
+            .num_varyings = 2,
+        },
+        .views[0].texture = { .stage = SG_SHADERSTAGE_FRAGMENT },
+        .samplers[0] = { .stage = SG_SHADERSTAGE_FRAGMENT },
+        .texture_sampler_pairs[0] = { .stage = SG_SHADERSTAGE_FRAGMENT, .view_slot = 0, .sampler_slot = 0 },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    const float vertices[] = { -1.0f, -1.0f, -1.0f, +3.0f, +3.0f, -1.0f };
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = shd,
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT2,
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+    });
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR },
+        .attachments.colors[0] = att,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){
+        .vertex_buffers[0] = vbuf,
+        .views[0] = tex_view,
+        .samplers[0] = smp,
+    });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    static uint32_t pixels[32 * 32];
+    T(sg_sw_read_image(img, 0, 0, &SG_RANGE(pixels)));
+    const uint32_t yellow = sw_rgba8(255, 255, 0, 255);
+    T(pixels[0] == yellow);
+    T(pixels[15 * 32 + 17] == yellow);
+    T(pixels[32 * 32 - 1] == yellow);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_compute_storage_buffer) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().compute);
+    static uint32_t init_data[64];
+    sg_buffer sbuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .data = SG_RANGE(init_data),
+    });
+    sg_view sbuf_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = sbuf });
+    sg_shader shd = sg_make_shader(&(sg_shader_desc){
+        .software.compute_func = sw_cs,
+        .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_COMPUTE, .size = 16 },
+        .views[0].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE },
+    });
+    T(sg_query_shader_state(shd) == SG_RESOURCESTATE_VALID);
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){ .compute = true, .shader = shd });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    const uint32_t params[4] = { 3, 0, 0, 0 };
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .views[0] = sbuf_view });
+    sg_apply_uniforms(0, &SG_RANGE(params));
+    sg_dispatch(4, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.sw.num_workgroups == 4);
+    const uint32_t* data = (const uint32_t*) _sg_lookup_buffer(sbuf.id)->sw.data;
+    bool all_match = true;
+    for (uint32_t i = 0; i < 64; i++) {
+        all_match &= (data[i] == i * 3);
+    }
+    T(all_match);
+    sg_shutdown();
+}
+
+// writes the workgroup counts for an indirect dispatch
+static void sw_cs_args(const sg_sw_shader_context* ctx, const sg_sw_workgroup* wg) {
+    (void)wg;
+    uint32_t* args = (uint32_t*) ctx->storage_buffers[0];
+    const uint32_t* params = (const uint32_t*) ctx->uniforms[0];
+    args[4] = params[0];
+    args[5] = 1;
+    args[6] = 1;
+}
+
+UTEST(sokol_gfx, sw_dispatch_indirect) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().dispatch_indirect);
+    static uint32_t init_data[64];
+    sg_buffer args_buf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .size = 8 * sizeof(uint32_t),
+    });
+    sg_view args_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = args_buf });
+    sg_buffer sbuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .data = SG_RANGE(init_data),
+    });
+    sg_view sbuf_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = sbuf });
+    sg_pipeline args_pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .software.compute_func = sw_cs_args,
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_COMPUTE, .size = 16 },
+            .views[0].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE },
+        }),
+    });
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .software.compute_func = sw_cs,
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_COMPUTE, .size = 16 },
+            .views[0].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE },
+        }),
+    });
+    T(sg_query_pipeline_state(args_pip) == SG_RESOURCESTATE_VALID);
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    // first pass computes the number of workgroups for the second pass
+    const uint32_t num_groups[4] = { 3, 0, 0, 0 };
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(args_pip);
+    sg_apply_bindings(&(sg_bindings){ .views[0] = args_view });
+    sg_apply_uniforms(0, &SG_RANGE(num_groups));
+    sg_dispatch(1, 1, 1);
+    sg_end_pass();
+    const uint32_t params[4] = { 2, 0, 0, 0 };
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .views[0] = sbuf_view });
+    sg_apply_uniforms(0, &SG_RANGE(params));
+    sg_dispatch_indirect(args_buf, (int)(4 * sizeof(uint32_t)));
+    sg_end_pass();
+    sg_commit();
+    T(num_log_called == 0);
+    T(sg_query_stats().prev_frame.num_dispatch_indirect == 1);
+    T(sg_query_stats().prev_frame.sw.num_workgroups == 4);
+    const uint32_t* data = (const uint32_t*) _sg_lookup_buffer(sbuf.id)->sw.data;
+    bool all_match = true;
+    for (uint32_t i = 0; i < 64; i++) {
+        all_match &= (data[i] == ((i < 48) ? (i * 2) : 0));
+    }
+    T(all_match);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_apply_uniform_buffer) {
+    setup(&(sg_desc){0});
+    T(sg_query_features().uniform_buffer_bindings);
+    T(sg_query_limits().uniform_buffer_offset_alignment == 16);
+    static uint32_t init_data[64];
+    sg_buffer sbuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .data = SG_RANGE(init_data),
+    });
+    sg_view sbuf_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = sbuf });
+    const uint32_t blocks[2][4] = { { 3, 0, 0, 0 }, { 5, 0, 0, 0 } };
+    sg_buffer ubuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.uniform_buffer = true,
+        .data = SG_RANGE(blocks),
+    });
+    T(sg_query_buffer_state(ubuf) == SG_RESOURCESTATE_VALID);
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){
+            .software.compute_func = sw_cs,
+            .uniform_blocks[0] = { .stage = SG_SHADERSTAGE_COMPUTE, .size = 16 },
+            .views[0].storage_buffer = { .stage = SG_SHADERSTAGE_COMPUTE },
+        }),
+    });
+    const uint32_t* data = (const uint32_t*) _sg_lookup_buffer(sbuf.id)->sw.data;
+    // uniform block is read from the buffer at offset 16
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .views[0] = sbuf_view });
+    sg_apply_uniform_buffer(0, ubuf, 16);
+    sg_dispatch(4, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    bool all_match = true;
+    for (uint32_t i = 0; i < 64; i++) {
+        all_match &= (data[i] == i * 5);
+    }
+    T(all_match);
+    // a following sg_apply_uniforms() replaces the buffer binding
+    const uint32_t params[4] = { 7, 0, 0, 0 };
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .views[0] = sbuf_view });
+    sg_apply_uniform_buffer(0, ubuf, 0);
+    sg_apply_uniforms(0, &SG_RANGE(params));
+    sg_dispatch(4, 1, 1);
+    sg_end_pass();
+    sg_commit();
+    all_match = true;
+    for (uint32_t i = 0; i < 64; i++) {
+        all_match &= (data[i] == i * 7);
+    }
+    T(all_match);
+    T(num_log_called == 0);
+    T(sg_query_stats().prev_frame.num_apply_uniform_buffer == 1);
+    sg_shutdown();
+}
+
+UTEST(sokol_gfx, sw_dispatch_indirect_validate_buffer) {
+    setup(&(sg_desc){0});
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage = { .vertex_buffer = true, .stream_update = true },
+        .size = 16,
+    });
+    sg_buffer sbuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.storage_buffer = true,
+        .size = 16,
+    });
+    sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+        .compute = true,
+        .shader = sg_make_shader(&(sg_shader_desc){ .software.compute_func = sw_cs }),
+    });
+    sg_begin_pass(&(sg_pass){ .compute = true });
+    sg_apply_pipeline(pip);
+    sg_dispatch_indirect(vbuf, 0);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DISPATCH_INDIRECT_EXPECT_STORAGEBUFFER);
+    reset_log_items();
+    sg_dispatch_indirect(sbuf, 2);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DISPATCH_INDIRECT_OFFSET_ALIGNMENT);
+    reset_log_items();
+    sg_dispatch_indirect(sbuf, 8);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DISPATCH_INDIRECT_BUFFER_SIZE);
+    reset_log_items();
+    // an offset close to INT_MAX must not wrap around in the size check
+    sg_dispatch_indirect(sbuf, 0x7FFFFFFC);
+    T(log_items[0] == SG_LOGITEM_VALIDATE_DISPATCH_INDIRECT_BUFFER_SIZE);
+    sg_end_pass();
+    sg_commit();
+    T(sg_query_stats().prev_frame.sw.num_workgroups == 0);
+    sg_shutdown();
+}
+#endif
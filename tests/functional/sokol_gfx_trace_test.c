@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//  sokol_gfx_trace_test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_TIME_IMPL
+#include "sokol_time.h"
+#define SOKOL_GFX_TRACE_IMPL
+#include "sokol_gfx_trace.h"
+#include "utest.h"
+#include <string.h>
+
+#define T(b) EXPECT_TRUE(b)
+
+static void init(int max_events) {
+    stm_setup();
+    sg_setup(&(sg_desc){0});
+    sgtrace_setup(&(sgtrace_desc_t){ .max_events = max_events });
+}
+
+static void shutdown(void) {
+    sgtrace_shutdown();
+    sg_shutdown();
+}
+
+static sg_view make_attachment(void) {
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = 16,
+        .height = 16,
+    });
+    return sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+}
+
+static int count(const char* str, const char* substr) {
+    int num = 0;
+    for (const char* p = strstr(str, substr); p; p = strstr(p + 1, substr)) {
+        num++;
+    }
+    return num;
+}
+
+UTEST(sokol_gfx_trace, no_capture) {
+    init(0);
+    T(!sgtrace_is_capturing());
+    sg_make_buffer(&(sg_buffer_desc){ .size = 16, .usage.stream_update = true });
+    sg_commit();
+    T(sgtrace_num_events() == 0);
+    shutdown();
+}
+
+UTEST(sokol_gfx_trace, record_events) {
+    init(0);
+    sgtrace_start_capture();
+    T(sgtrace_is_capturing());
+    sg_view att = make_attachment();
+    sg_push_debug_group("outer");
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att, .label = "my \"pass\"" });
+    sg_push_debug_group("inner");
+    sg_pop_debug_group();
+    sg_end_pass();
+    sg_pop_debug_group();
+    sg_commit();
+    sgtrace_stop_capture();
+    T(!sgtrace_is_capturing());
+    sg_commit();
+    // make_image, make_view, 2x push, begin_pass, 2x pop, end_pass, commit
+    T(sgtrace_num_events() == 9);
+    T(sgtrace_num_dropped_events() == 0);
+
+    const size_t size = sgtrace_write_json(0, 0);
+    T(size > 0);
+    static char buf[4096];
+    T(size <= sizeof(buf));
+    T(sgtrace_write_json(buf, sizeof(buf)) == size);
+    T(strlen(buf) == (size - 1));
+    T(strstr(buf, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == buf);
+    T(count(buf, "\"ph\":\"B\"") == 3);
+    T(count(buf, "\"ph\":\"E\"") == 3);
+    T(count(buf, "\"ph\":\"i\"") == 3);
+    T(count(buf, "\"s\":\"g\"") == 1);
+    T(strstr(buf, "\"name\":\"my \\\"pass\\\"\"") != 0);
+    T(strstr(buf, "\"name\":\"outer\"") != 0);
+    T(strstr(buf, "\"name\":\"inner\"") != 0);
+    T(strstr(buf, "\"name\":\"make_image\"") != 0);
+    T(strstr(buf, "\"name\":\"make_view\"") != 0);
+
+    // a too small buffer is truncated but zero-terminated
+    char small[16];
+    T(sgtrace_write_json(small, sizeof(small)) == size);
+    T(strlen(small) == (sizeof(small) - 1));
+
+    // restarting the capture discards the recorded events
+    sgtrace_start_capture();
+    T(sgtrace_num_events() == 0);
+    shutdown();
+}
+
+UTEST(sokol_gfx_trace, dropped_events) {
+    init(4);
+    sgtrace_start_capture();
+    for (int i = 0; i < 6; i++) {
+        sg_make_buffer(&(sg_buffer_desc){ .size = 16, .usage.stream_update = true, .label = "buf" });
+    }
+    T(sgtrace_num_events() == 4);
+    T(sgtrace_num_dropped_events() == 2);
+    static char buf[2048];
+    sgtrace_write_json(buf, sizeof(buf));
+    T(count(buf, "\"label\":\"buf\"") == 4);
+    shutdown();
+}
+
+UTEST(sokol_gfx_trace, unbalanced_slices) {
+    init(0);
+    sg_view att = make_attachment();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att });
+    // capture starts in the middle of a pass and ends in the middle of another
+    sgtrace_start_capture();
+    sg_end_pass();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att });
+    sgtrace_stop_capture();
+    sg_end_pass();
+    static char buf[2048];
+    sgtrace_write_json(buf, sizeof(buf));
+    T(count(buf, "\"ph\":\"B\"") == 1);
+    T(count(buf, "\"ph\":\"E\"") == 1);
+    T(strstr(buf, "\"name\":\"render pass\"") != 0);
+    shutdown();
+}
+
+static struct {
+    int num_make_buffer;
+    int num_apply_viewport;
+    int num_draw;
+    int num_commit;
+    void* user_data;
+} prev_hooks_called;
+
+static void prev_make_buffer(const sg_buffer_desc* desc, sg_buffer result, void* user_data) {
+    (void)desc; (void)result;
+    prev_hooks_called.num_make_buffer++;
+    prev_hooks_called.user_data = user_data;
+}
+
+static void prev_apply_viewport(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    (void)x; (void)y; (void)width; (void)height; (void)origin_top_left;
+    prev_hooks_called.num_apply_viewport++;
+    prev_hooks_called.user_data = user_data;
+}
+
+static void prev_draw(int base_element, int num_elements, int num_instances, void* user_data) {
+    (void)base_element; (void)num_elements; (void)num_instances;
+    prev_hooks_called.num_draw++;
+    prev_hooks_called.user_data = user_data;
+}
+
+static void prev_commit(void* user_data) {
+    prev_hooks_called.num_commit++;
+    prev_hooks_called.user_data = user_data;
+}
+
+UTEST(sokol_gfx_trace, forward_previous_hooks) {
+    memset(&prev_hooks_called, 0, sizeof(prev_hooks_called));
+    stm_setup();
+    sg_setup(&(sg_desc){0});
+    static int my_user_data;
+    sg_install_trace_hooks(&(sg_trace_hooks){
+        .user_data = &my_user_data,
+        .make_buffer = prev_make_buffer,
+        .apply_viewport = prev_apply_viewport,
+        .draw = prev_draw,
+        .commit = prev_commit,
+    });
+    sgtrace_setup(&(sgtrace_desc_t){0});
+    sgtrace_start_capture();
+    sg_make_buffer(&(sg_buffer_desc){ .size = 16, .usage.stream_update = true });
+    sg_view att = make_attachment();
+    sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att });
+    // hooks which sokol_gfx_trace.h doesn't record must still reach the previous hooks
+    sg_apply_viewport(0, 0, 16, 16, true);
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    T(prev_hooks_called.num_make_buffer == 1);
+    T(prev_hooks_called.num_apply_viewport == 1);
+    T(prev_hooks_called.num_draw == 1);
+    T(prev_hooks_called.num_commit == 1);
+    T(prev_hooks_called.user_data == &my_user_data);
+    T(sgtrace_num_events() > 0);
+    // after shutdown the previous hooks are called directly
+    sgtrace_shutdown();
+    sg_commit();
+    T(prev_hooks_called.num_commit == 2);
+    sg_shutdown();
+}
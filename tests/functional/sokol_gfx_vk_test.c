@@ -0,0 +1,1205 @@
+//------------------------------------------------------------------------------
+//  sokol-gfx-vk-test.c
+//  Headless Vulkan tests, these run on the actual Vulkan backend (for instance
+//  Mesa's lavapipe driver) without a window or swapchain. If the Khronos
+//  validation layer is installed it is enabled, and every test fails on
+//  validation errors. If no suitable Vulkan device exists, the tests are skipped,
+//  unless SOKOL_VK_TEST_REQUIRE_VALIDATION=1 is set (as in CI), then a missing
+//  device or validation layer fails the required_environment test.
+//  Also compiled as sokol-vk-mt-test with SOKOL_MULTI_CONTEXT defined.
+//------------------------------------------------------------------------------
+#include <vulkan/vulkan.h>
+
+// sokol-gfx doesn't need VK_IMAGE_USAGE_TRANSFER_SRC_BIT, but the tests
+// read rendered pixels back with vkCmdCopyImageToBuffer()
+static int num_transient_images_created;
+static VkResult test_vkCreateImage(VkDevice device, const VkImageCreateInfo* info, const VkAllocationCallbacks* alloc, VkImage* img) {
+    VkImageCreateInfo patched_info = *info;
+    if (patched_info.usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) {
+        num_transient_images_created++;
+    } else {
+        patched_info.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    }
+    return vkCreateImage(device, &patched_info, alloc, img);
+}
+#define vkCreateImage test_vkCreateImage
+
+#define SOKOL_IMPL
+#include "sokol_gfx.h"
+#include "sokol_log.h"
+#include "utest.h"
+#include <stdlib.h> // getenv
+
+#define T(b) EXPECT_TRUE(b)
+
+// hand-assembled SPIR-V blobs equivalent to:
+//
+//      layout(location=0) in vec4 pos;
+//      void main() { gl_Position = pos; }
+//
+//      layout(location=0) out vec4 frag_color;
+//      void main() { frag_color = vec4(0.0, 1.0, 0.0, 1.0); }
+//
+//      layout(push_constant) uniform fs_params { vec4 color; };
+//      layout(location=0) out vec4 frag_color;
+//      void main() { frag_color = color; }
+//
+//      ...and the same with a uniform buffer instead of push constants:
+//
+//      layout(set=0, binding=0) uniform fs_params { vec4 color; };
+//
+static const uint32_t vs_spirv[69] = {
+    0x07230203, 0x00010000, 0x00000000, 0x0000000c, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0007000f, 0x00000000,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00000003, 0x00040047,
+    0x00000002, 0x0000001e, 0x00000000, 0x00040047, 0x00000003, 0x0000000b,
+    0x00000000, 0x00020013, 0x00000004, 0x00030021, 0x00000005, 0x00000004,
+    0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006,
+    0x00000004, 0x00040020, 0x00000008, 0x00000001, 0x00000007, 0x0004003b,
+    0x00000008, 0x00000002, 0x00000001, 0x00040020, 0x00000009, 0x00000003,
+    0x00000007, 0x0004003b, 0x00000009, 0x00000003, 0x00000003, 0x00050036,
+    0x00000004, 0x00000001, 0x00000000, 0x00000005, 0x000200f8, 0x0000000a,
+    0x0004003d, 0x00000007, 0x0000000b, 0x00000002, 0x0003003e, 0x00000003,
+    0x0000000b, 0x000100fd, 0x00010038,
+};
+
+static const uint32_t fs_green_spirv[70] = {
+    0x07230203, 0x00010000, 0x00000000, 0x0000000c, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000004,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00030010, 0x00000001,
+    0x00000007, 0x00040047, 0x00000002, 0x0000001e, 0x00000000, 0x00020013,
+    0x00000003, 0x00030021, 0x00000004, 0x00000003, 0x00030016, 0x00000005,
+    0x00000020, 0x00040017, 0x00000006, 0x00000005, 0x00000004, 0x00040020,
+    0x00000007, 0x00000003, 0x00000006, 0x0004003b, 0x00000007, 0x00000002,
+    0x00000003, 0x0004002b, 0x00000005, 0x00000008, 0x00000000, 0x0004002b,
+    0x00000005, 0x00000009, 0x3f800000, 0x0007002c, 0x00000006, 0x0000000a,
+    0x00000008, 0x00000009, 0x00000008, 0x00000009, 0x00050036, 0x00000003,
+    0x00000001, 0x00000000, 0x00000004, 0x000200f8, 0x0000000b, 0x0003003e,
+    0x00000002, 0x0000000a, 0x000100fd, 0x00010038,
+};
+
+static const uint32_t fs_push_constant_spirv[95] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000011, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000004,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00030010, 0x00000001,
+    0x00000007, 0x00040047, 0x00000002, 0x0000001e, 0x00000000, 0x00030047,
+    0x00000003, 0x00000002, 0x00050048, 0x00000003, 0x00000000, 0x00000023,
+    0x00000000, 0x00020013, 0x00000004, 0x00030021, 0x00000005, 0x00000004,
+    0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006,
+    0x00000004, 0x00040020, 0x00000008, 0x00000003, 0x00000007, 0x0004003b,
+    0x00000008, 0x00000002, 0x00000003, 0x0003001e, 0x00000003, 0x00000007,
+    0x00040020, 0x00000009, 0x00000009, 0x00000003, 0x0004003b, 0x00000009,
+    0x0000000a, 0x00000009, 0x00040015, 0x0000000b, 0x00000020, 0x00000001,
+    0x0004002b, 0x0000000b, 0x0000000c, 0x00000000, 0x00040020, 0x0000000d,
+    0x00000009, 0x00000007, 0x00050036, 0x00000004, 0x00000001, 0x00000000,
+    0x00000005, 0x000200f8, 0x0000000e, 0x00050041, 0x0000000d, 0x0000000f,
+    0x0000000a, 0x0000000c, 0x0004003d, 0x00000007, 0x00000010, 0x0000000f,
+    0x0003003e, 0x00000002, 0x00000010, 0x000100fd, 0x00010038,
+};
+
+static const uint32_t fs_uniform_buffer_spirv[103] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000011, 0x00000000, 0x00020011,
+    0x00000001, 0x0003000e, 0x00000000, 0x00000001, 0x0006000f, 0x00000004,
+    0x00000001, 0x6e69616d, 0x00000000, 0x00000002, 0x00030010, 0x00000001,
+    0x00000007, 0x00040047, 0x00000002, 0x0000001e, 0x00000000, 0x00030047,
+    0x00000003, 0x00000002, 0x00050048, 0x00000003, 0x00000000, 0x00000023,
+    0x00000000, 0x00040047, 0x00000004, 0x00000022, 0x00000000, 0x00040047,
+    0x00000004, 0x00000021, 0x00000000, 0x00020013, 0x00000005, 0x00030021,
+    0x00000006, 0x00000005, 0x00030016, 0x00000007, 0x00000020, 0x00040017,
+    0x00000008, 0x00000007, 0x00000004, 0x00040020, 0x00000009, 0x00000003,
+    0x00000008, 0x0004003b, 0x00000009, 0x00000002, 0x00000003, 0x0003001e,
+    0x00000003, 0x00000008, 0x00040020, 0x0000000a, 0x00000002, 0x00000003,
+    0x0004003b, 0x0000000a, 0x00000004, 0x00000002, 0x00040015, 0x0000000b,
+    0x00000020, 0x00000001, 0x0004002b, 0x0000000b, 0x0000000c, 0x00000000,
+    0x00040020, 0x0000000d, 0x00000002, 0x00000008, 0x00050036, 0x00000005,
+    0x00000001, 0x00000000, 0x00000006, 0x000200f8, 0x0000000e, 0x00050041,
+    0x0000000d, 0x0000000f, 0x00000004, 0x0000000c, 0x0004003d, 0x00000008,
+    0x00000010, 0x0000000f, 0x0003003e, 0x00000002, 0x00000010, 0x000100fd,
+    0x00010038,
+};
+
+static struct {
+    VkInstance instance;
+    VkDebugUtilsMessengerEXT messenger;
+    PFN_vkDestroyDebugUtilsMessengerEXT destroy_messenger;
+    VkPhysicalDevice physical_device;
+    VkDevice device;
+    VkQueue queue;
+    uint32_t queue_family_index;
+    VkQueue compute_queue;
+    uint32_t compute_queue_family_index;
+    bool host_query_reset;
+    bool pipeline_statistics_query;
+    bool descriptor_indexing;
+    bool validation;
+    int num_validation_errors;
+} vk;
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL validation_callback(
+    VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+    VkDebugUtilsMessageTypeFlagsEXT types,
+    const VkDebugUtilsMessengerCallbackDataEXT* data,
+    void* user_data)
+{
+    (void)types; (void)user_data;
+    if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
+        printf("vulkan validation error: %s\n", data->pMessage);
+        vk.num_validation_errors++;
+    }
+    return VK_FALSE;
+}
+
+static bool has_instance_layer(const char* name) {
+    VkLayerProperties props[64];
+    uint32_t count = 64;
+    vkEnumerateInstanceLayerProperties(&count, props);
+    for (uint32_t i = 0; i < count; i++) {
+        if (0 == strcmp(props[i].layerName, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool has_instance_extension(const char* name) {
+    VkExtensionProperties props[64];
+    uint32_t count = 64;
+    vkEnumerateInstanceExtensionProperties(0, &count, props);
+    for (uint32_t i = 0; i < count; i++) {
+        if (0 == strcmp(props[i].extensionName, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool has_device_extension(VkPhysicalDevice pdev, const char* name) {
+    VkExtensionProperties props[512];
+    uint32_t count = 512;
+    vkEnumerateDeviceExtensionProperties(pdev, 0, &count, props);
+    for (uint32_t i = 0; i < count; i++) {
+        if (0 == strcmp(props[i].extensionName, name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool create_instance(void) {
+    const VkApplicationInfo app_info = {
+        .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+        .pApplicationName = "sokol-gfx-vk-test",
+        .apiVersion = VK_API_VERSION_1_3,
+    };
+    const char* layer_names[1];
+    uint32_t layer_count = 0;
+    if (has_instance_layer("VK_LAYER_KHRONOS_validation")) {
+        layer_names[layer_count++] = "VK_LAYER_KHRONOS_validation";
+        vk.validation = true;
+    } else {
+        printf("VK_LAYER_KHRONOS_validation not found, running without validation\n");
+    }
+    const char* ext_names[1];
+    uint32_t ext_count = 0;
+    const bool debug_utils = has_instance_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    if (debug_utils) {
+        ext_names[ext_count++] = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
+    }
+    const VkInstanceCreateInfo create_info = {
+        .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+        .pApplicationInfo = &app_info,
+        .enabledLayerCount = layer_count,
+        .ppEnabledLayerNames = layer_names,
+        .enabledExtensionCount = ext_count,
+        .ppEnabledExtensionNames = ext_names,
+    };
+    if (VK_SUCCESS != vkCreateInstance(&create_info, 0, &vk.instance)) {
+        return false;
+    }
+    if (debug_utils) {
+        PFN_vkCreateDebugUtilsMessengerEXT create_messenger = (PFN_vkCreateDebugUtilsMessengerEXT)vkGetInstanceProcAddr(vk.instance, "vkCreateDebugUtilsMessengerEXT");
+        vk.destroy_messenger = (PFN_vkDestroyDebugUtilsMessengerEXT)vkGetInstanceProcAddr(vk.instance, "vkDestroyDebugUtilsMessengerEXT");
+        const VkDebugUtilsMessengerCreateInfoEXT messenger_info = {
+            .sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+            .messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
+            .messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT,
+            .pfnUserCallback = validation_callback,
+        };
+        if (create_messenger && vk.destroy_messenger) {
+            create_messenger(vk.instance, &messenger_info, 0, &vk.messenger);
+        }
+    }
+    return true;
+}
+
+// same device requirements as sokol_app.h, minus the swapchain
+static bool pick_physical_device(void) {
+    VkPhysicalDevice pdevs[8];
+    uint32_t pdev_count = 8;
+    vkEnumeratePhysicalDevices(vk.instance, &pdev_count, pdevs);
+    for (uint32_t pdev_idx = 0; pdev_idx < pdev_count; pdev_idx++) {
+        const VkPhysicalDevice pdev = pdevs[pdev_idx];
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(pdev, &props);
+        if (props.apiVersion < VK_API_VERSION_1_3) {
+            continue;
+        }
+        if (!has_device_extension(pdev, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME)) {
+            continue;
+        }
+        VkPhysicalDeviceVulkan12Features vk12_features = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES };
+        VkPhysicalDeviceFeatures2 features = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2, .pNext = &vk12_features };
+        vkGetPhysicalDeviceFeatures2(pdev, &features);
+        if (!vk12_features.timelineSemaphore || !vk12_features.bufferDeviceAddress) {
+            continue;
+        }
+        VkQueueFamilyProperties qf_props[16];
+        uint32_t qf_count = 16;
+        vkGetPhysicalDeviceQueueFamilyProperties(pdev, &qf_count, qf_props);
+        const VkQueueFlags required_flags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+        bool has_queue = false;
+        bool has_compute_queue = false;
+        for (uint32_t i = 0; i < qf_count; i++) {
+            const VkQueueFlags flags = qf_props[i].queueFlags;
+            if (!has_queue && ((flags & required_flags) == required_flags)) {
+                vk.queue_family_index = i;
+                has_queue = true;
+            } else if (!has_compute_queue && (flags & VK_QUEUE_COMPUTE_BIT) && (0 == (flags & VK_QUEUE_GRAPHICS_BIT))) {
+                vk.compute_queue_family_index = i;
+                has_compute_queue = true;
+            }
+        }
+        if (!has_queue) {
+            continue;
+        }
+        vk.physical_device = pdev;
+        vk.compute_queue_family_index = has_compute_queue ? vk.compute_queue_family_index : vk.queue_family_index;
+        vk.host_query_reset = vk12_features.hostQueryReset;
+        vk.pipeline_statistics_query = features.features.pipelineStatisticsQuery;
+        vk.descriptor_indexing = vk12_features.descriptorBindingPartiallyBound && vk12_features.runtimeDescriptorArray;
+        printf("vulkan device: %s\n", props.deviceName);
+        return true;
+    }
+    return false;
+}
+
+static bool create_device(void) {
+    const float queue_priority = 0.0f;
+    VkDeviceQueueCreateInfo queue_infos[2] = {
+        {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            .queueFamilyIndex = vk.queue_family_index,
+            .queueCount = 1,
+            .pQueuePriorities = &queue_priority,
+        },
+        {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            .queueFamilyIndex = vk.compute_queue_family_index,
+            .queueCount = 1,
+            .pQueuePriorities = &queue_priority,
+        },
+    };
+    const bool has_compute_queue = vk.compute_queue_family_index != vk.queue_family_index;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptor_buffer_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+        .descriptorBuffer = VK_TRUE,
+    };
+    VkPhysicalDeviceVulkan12Features vk12_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES,
+        .pNext = &descriptor_buffer_features,
+        .bufferDeviceAddress = VK_TRUE,
+        .timelineSemaphore = VK_TRUE,
+        .hostQueryReset = vk.host_query_reset,
+        .descriptorBindingPartiallyBound = vk.descriptor_indexing,
+        .runtimeDescriptorArray = vk.descriptor_indexing,
+    };
+    VkPhysicalDeviceVulkan13Features vk13_features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES,
+        .pNext = &vk12_features,
+        .dynamicRendering = VK_TRUE,
+        .synchronization2 = VK_TRUE,
+    };
+    VkPhysicalDeviceFeatures2 features = {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &vk13_features,
+        .features.pipelineStatisticsQuery = vk.pipeline_statistics_query,
+    };
+    const char* ext_names[] = { VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME };
+    const VkDeviceCreateInfo create_info = {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .pNext = &features,
+        .queueCreateInfoCount = has_compute_queue ? 2 : 1,
+        .pQueueCreateInfos = queue_infos,
+        .enabledExtensionCount = 1,
+        .ppEnabledExtensionNames = ext_names,
+    };
+    if (VK_SUCCESS != vkCreateDevice(vk.physical_device, &create_info, 0, &vk.device)) {
+        return false;
+    }
+    vkGetDeviceQueue(vk.device, vk.queue_family_index, 0, &vk.queue);
+    if (has_compute_queue) {
+        vkGetDeviceQueue(vk.device, vk.compute_queue_family_index, 0, &vk.compute_queue);
+    }
+    return true;
+}
+
+static void destroy_vulkan(void) {
+    if (vk.device) {
+        vkDestroyDevice(vk.device, 0);
+    }
+    if (vk.messenger) {
+        vk.destroy_messenger(vk.instance, vk.messenger, 0);
+    }
+    if (vk.instance) {
+        vkDestroyInstance(vk.instance, 0);
+    }
+    memset(&vk, 0, sizeof(vk));
+}
+
+static sg_environment vulkan_environment(void) {
+    return (sg_environment){
+        .defaults = {
+            .color_format = SG_PIXELFORMAT_RGBA8,
+            .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+            .sample_count = 1,
+        },
+        .vulkan = {
+            .instance = vk.instance,
+            .physical_device = vk.physical_device,
+            .device = vk.device,
+            .queue = vk.queue,
+            .queue_family_index = vk.queue_family_index,
+            .compute_queue = vk.compute_queue,
+            .compute_queue_family_index = vk.compute_queue_family_index,
+            .timeline_semaphore = true,
+            .host_query_reset = vk.host_query_reset,
+            .pipeline_statistics_query = vk.pipeline_statistics_query,
+            .descriptor_indexing = vk.descriptor_indexing,
+        },
+    };
+}
+
+static bool setup_with_desc(sg_desc desc) {
+    memset(&vk, 0, sizeof(vk));
+    if (!create_instance() || !pick_physical_device() || !create_device()) {
+        printf("no suitable Vulkan device available, skipping test\n");
+        destroy_vulkan();
+        return false;
+    }
+    desc.environment = vulkan_environment();
+    if (0 == desc.logger.func) {
+        desc.logger.func = slog_func;
+    }
+    sg_setup(&desc);
+    if (!sg_isvalid()) {
+        destroy_vulkan();
+        return false;
+    }
+    return true;
+}
+
+static bool setup(void) {
+    return setup_with_desc((sg_desc){0});
+}
+
+static int shutdown(void) {
+    sg_shutdown();
+    vkDeviceWaitIdle(vk.device);
+    const int num_validation_errors = vk.num_validation_errors;
+    destroy_vulkan();
+    return num_validation_errors;
+}
+
+static sg_view make_color_attachment(void) {
+    return sg_make_view(&(sg_view_desc){
+        .color_attachment.image = sg_make_image(&(sg_image_desc){
+            .usage.color_attachment = true,
+            .width = 4,
+            .height = 4,
+            .pixel_format = SG_PIXELFORMAT_RGBA8,
+        }),
+    });
+}
+
+static void clear_pass(sg_view att_view) {
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 1.0f, 1.0f } },
+        .attachments.colors[0] = att_view,
+    });
+    sg_end_pass();
+}
+
+// a triangle covering the whole render target
+static sg_buffer make_fullscreen_triangle(void) {
+    const float vertices[] = {
+        -1.0f, -1.0f, 0.5f, 1.0f,
+         3.0f, -1.0f, 0.5f, 1.0f,
+        -1.0f,  3.0f, 0.5f, 1.0f,
+    };
+    return sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+}
+
+// the vertex shader is always vs_spirv, the shader desc provides the fragment shader
+static sg_pipeline make_pipeline(sg_shader_desc shd_desc) {
+    shd_desc.vertex_func.bytecode = SG_RANGE(vs_spirv);
+    shd_desc.attrs[0].base_type = SG_SHADERATTRBASETYPE_FLOAT;
+    return sg_make_pipeline(&(sg_pipeline_desc){
+        .shader = sg_make_shader(&shd_desc),
+        .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT4,
+        .depth.pixel_format = SG_PIXELFORMAT_NONE,
+        .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+}
+
+static sg_frame_stats draw_frame(sg_view att_view, sg_pipeline pip, sg_buffer vbuf) {
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = att_view,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    const sg_frame_stats stats = sg_query_stats().cur_frame;
+    sg_commit();
+    return stats;
+}
+
+static uint32_t find_memory_type(uint32_t type_bits, VkMemoryPropertyFlags props) {
+    VkPhysicalDeviceMemoryProperties mem_props;
+    vkGetPhysicalDeviceMemoryProperties(vk.physical_device, &mem_props);
+    for (uint32_t i = 0; i < mem_props.memoryTypeCount; i++) {
+        if ((type_bits & (1u << i)) && ((mem_props.memoryTypes[i].propertyFlags & props) == props)) {
+            return i;
+        }
+    }
+    return UINT32_MAX;
+}
+
+// copy the first mip level of an RGBA8 image into dst with raw Vulkan calls,
+// the image must have been rendered to, and its layout is restored afterwards
+static bool read_image_pixels(sg_image img_id, uint8_t* dst, size_t dst_size) {
+    _sg_image_t* img = _sg_lookup_image(img_id.id);
+    if (!img || (img->cmn.pixel_format != SG_PIXELFORMAT_RGBA8) || (img->vk.cur_access == _SG_VK_ACCESS_NONE)) {
+        return false;
+    }
+    const uint32_t width = (uint32_t)img->cmn.width;
+    const uint32_t height = (uint32_t)img->cmn.height;
+    const VkDeviceSize size = width * height * 4;
+    if (dst_size < size) {
+        return false;
+    }
+    vkDeviceWaitIdle(vk.device);
+    const VkBufferCreateInfo buf_info = {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .size = size,
+        .usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+    };
+    VkBuffer buf = 0;
+    vkCreateBuffer(vk.device, &buf_info, 0, &buf);
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements(vk.device, buf, &mem_reqs);
+    const VkMemoryAllocateInfo alloc_info = {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize = mem_reqs.size,
+        .memoryTypeIndex = find_memory_type(mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+    };
+    VkDeviceMemory mem = 0;
+    vkAllocateMemory(vk.device, &alloc_info, 0, &mem);
+    vkBindBufferMemory(vk.device, buf, mem, 0);
+    const VkCommandPoolCreateInfo pool_info = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .queueFamilyIndex = vk.queue_family_index,
+    };
+    VkCommandPool cmd_pool = 0;
+    vkCreateCommandPool(vk.device, &pool_info, 0, &cmd_pool);
+    const VkCommandBufferAllocateInfo cmdbuf_alloc_info = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = cmd_pool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1,
+    };
+    VkCommandBuffer cmd_buf = 0;
+    vkAllocateCommandBuffers(vk.device, &cmdbuf_alloc_info, &cmd_buf);
+    const VkCommandBufferBeginInfo begin_info = {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+    };
+    vkBeginCommandBuffer(cmd_buf, &begin_info);
+    const VkImageLayout layout = _sg_vk_image_layout(img->vk.cur_access);
+    VkImageMemoryBarrier2 barrier = {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+        .srcStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+        .srcAccessMask = VK_ACCESS_2_MEMORY_WRITE_BIT,
+        .dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+        .dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT,
+        .oldLayout = layout,
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = img->vk.img,
+        .subresourceRange = {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .levelCount = VK_REMAINING_MIP_LEVELS,
+            .layerCount = VK_REMAINING_ARRAY_LAYERS,
+        },
+    };
+    const VkDependencyInfo dep_info = {
+        .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+        .imageMemoryBarrierCount = 1,
+        .pImageMemoryBarriers = &barrier,
+    };
+    vkCmdPipelineBarrier2(cmd_buf, &dep_info);
+    const VkBufferImageCopy region = {
+        .imageSubresource = {
+            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+            .layerCount = 1,
+        },
+        .imageExtent = { width, height, 1 },
+    };
+    vkCmdCopyImageToBuffer(cmd_buf, img->vk.img, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buf, 1, &region);
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barrier.newLayout = layout;
+    vkCmdPipelineBarrier2(cmd_buf, &dep_info);
+    vkEndCommandBuffer(cmd_buf);
+    const VkSubmitInfo submit_info = {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &cmd_buf,
+    };
+    const bool ok = (VK_SUCCESS == vkQueueSubmit(vk.queue, 1, &submit_info, VK_NULL_HANDLE)) && (VK_SUCCESS == vkQueueWaitIdle(vk.queue));
+    void* ptr = 0;
+    if (ok && (VK_SUCCESS == vkMapMemory(vk.device, mem, 0, size, 0, &ptr))) {
+        memcpy(dst, ptr, (size_t)size);
+        vkUnmapMemory(vk.device, mem);
+    }
+    vkDestroyCommandPool(vk.device, cmd_pool, 0);
+    vkDestroyBuffer(vk.device, buf, 0);
+    vkFreeMemory(vk.device, mem, 0);
+    return ok && (0 != ptr);
+}
+
+static bool pixel_equal(const uint8_t* px, uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return (px[0] == r) && (px[1] == g) && (px[2] == b) && (px[3] == a);
+}
+
+UTEST(sokol_gfx_vk, required_environment) {
+    const char* require = getenv("SOKOL_VK_TEST_REQUIRE_VALIDATION");
+    if (!require || (0 != strcmp(require, "1"))) {
+        return;
+    }
+    // all other tests silently skip without a device, so make sure this run means something
+    memset(&vk, 0, sizeof(vk));
+    const bool has_device = create_instance() && pick_physical_device() && create_device();
+    T(has_device);
+    T(vk.validation);
+    T(vk.messenger != 0);
+    destroy_vulkan();
+}
+
+UTEST(sokol_gfx_vk, smoke_offscreen_clear) {
+    if (!setup()) {
+        return;
+    }
+    T(sg_query_backend() == SG_BACKEND_VULKAN);
+    sg_view att_view = make_color_attachment();
+    T(sg_query_view_state(att_view) == SG_RESOURCESTATE_VALID);
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        clear_pass(att_view);
+        sg_commit();
+    }
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, timeline_frame_values) {
+    if (!setup()) {
+        return;
+    }
+    sg_view att_view = make_color_attachment();
+    const uint32_t first_frame_index = _sg.frame_index;
+    uint64_t prev_value = 0;
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        clear_pass(att_view);
+        sg_commit();
+        // each frame signals a strictly increasing timeline value
+        const uint64_t value = _sg.vk.frame.slot[_sg.vk.frame_slot].timeline_value;
+        T(value > prev_value);
+        prev_value = value;
+    }
+    vkDeviceWaitIdle(vk.device);
+    T(_sg_vk_timeline_completed_value(&_sg.vk.timeline) >= prev_value);
+    T(_sg_vk_frame_completed(first_frame_index));
+    T(_sg_vk_frame_completed(_sg.frame_index - 1));
+    // the current frame hasn't been submitted yet
+    T(!_sg_vk_frame_completed(_sg.frame_index));
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, timeline_delete_queue) {
+    if (!setup()) {
+        return;
+    }
+    sg_enable_stats();
+    uint32_t num_added = 0;
+    uint32_t num_collected = 0;
+    // resources destroyed right after use are retired once the GPU is done with them
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        sg_view att_view = make_color_attachment();
+        clear_pass(att_view);
+        sg_destroy_image(sg_query_view_image(att_view));
+        sg_destroy_view(att_view);
+        sg_commit();
+        num_added += sg_query_stats().prev_frame.vk.num_delete_queue_added;
+        num_collected += sg_query_stats().prev_frame.vk.num_delete_queue_collected;
+    }
+    T(num_added > 0);
+    T(num_collected > 0);
+    T(num_collected <= num_added);
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, async_compute_passes) {
+    if (!setup()) {
+        return;
+    }
+    // without a dedicated compute queue family, async compute passes fall back to the graphics queue
+    T(sg_query_features().async_compute == (vk.compute_queue != 0));
+    sg_view att_view = make_color_attachment();
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        sg_begin_pass(&(sg_pass){ .compute = true, .async_compute = true });
+        sg_end_pass();
+        clear_pass(att_view);
+        sg_begin_pass(&(sg_pass){ .compute = true });
+        sg_end_pass();
+        sg_commit();
+    }
+    T(0 == shutdown());
+}
+
+static int num_heap_exhausted_warnings;
+static void bindless_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    if (log_item_id == SG_LOGITEM_VULKAN_BINDLESS_HEAP_EXHAUSTED) {
+        num_heap_exhausted_warnings++;
+    }
+    slog_func(tag, log_level, log_item_id, message_or_null, line_nr, filename_or_null, user_data);
+}
+
+// destroy and re-create a texture view until the heap is exhausted, returns the
+// number of views which got a heap index, each index must only be seen once
+static int churn_bindless_views(sg_image img, bool* seen, int max_index) {
+    int num_indices = 0;
+    while (true) {
+        sg_view view = sg_make_view(&(sg_view_desc){ .texture.image = img });
+        const int index = sg_query_view_bindless_index(view);
+        sg_destroy_view(view);
+        if (index == 0) {
+            return num_indices;
+        }
+        if ((index > max_index) || seen[index]) {
+            return -1;
+        }
+        seen[index] = true;
+        num_indices++;
+    }
+}
+
+UTEST(sokol_gfx_vk, bindless_heap_indices) {
+    // the heap has room for twice the pool sizes: 8 views and 4 samplers
+    if (!setup_with_desc((sg_desc){
+        .vulkan.bindless = true,
+        .view_pool_size = 4,
+        .sampler_pool_size = 2,
+        .logger.func = bindless_logger,
+    })) {
+        return;
+    }
+    if (!sg_query_features().bindless) {
+        printf("bindless heap not supported, skipping test\n");
+        T(0 == shutdown());
+        return;
+    }
+    num_heap_exhausted_warnings = 0;
+    sg_image img = sg_make_image(&(sg_image_desc){ .width = 4, .height = 4, .pixel_format = SG_PIXELFORMAT_RGBA8, .usage.stream_update = true });
+    const float sbuf_data[4] = { 0.0f };
+    sg_buffer sbuf = sg_make_buffer(&(sg_buffer_desc){ .usage.storage_buffer = true, .data = SG_RANGE(sbuf_data) });
+    sg_view att_view = make_color_attachment();
+    // texture and storage buffer views share the view index range, attachments aren't in the heap
+    sg_view tex_view = sg_make_view(&(sg_view_desc){ .texture.image = img });
+    sg_view sbuf_view = sg_make_view(&(sg_view_desc){ .storage_buffer.buffer = sbuf });
+    const int tex_index = sg_query_view_bindless_index(tex_view);
+    const int sbuf_index = sg_query_view_bindless_index(sbuf_view);
+    T((tex_index > 0) && (tex_index <= 8));
+    T((sbuf_index > 0) && (sbuf_index <= 8));
+    T(tex_index != sbuf_index);
+    T(sg_query_view_bindless_index(att_view) == 0);
+    sg_sampler smp0 = sg_make_sampler(&(sg_sampler_desc){0});
+    sg_sampler smp1 = sg_make_sampler(&(sg_sampler_desc){0});
+    const int smp_index0 = sg_query_sampler_bindless_index(smp0);
+    const int smp_index1 = sg_query_sampler_bindless_index(smp1);
+    T((smp_index0 > 0) && (smp_index0 <= 4));
+    T((smp_index1 > 0) && (smp_index1 <= 4));
+    T(smp_index0 != smp_index1);
+
+    // indices of destroyed views aren't reused within the frame, so the
+    // remaining 6 indices are used up and the 7th view gets none
+    bool seen[9] = { false };
+    seen[tex_index] = true;
+    seen[sbuf_index] = true;
+    T(churn_bindless_views(img, seen, 8) == 6);
+    T(num_heap_exhausted_warnings == 1);
+
+    // once the GPU is done with those frames, all 6 indices can be allocated again
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        clear_pass(att_view);
+        sg_commit();
+    }
+    memset(seen, 0, sizeof(seen));
+    seen[tex_index] = true;
+    seen[sbuf_index] = true;
+    T(churn_bindless_views(img, seen, 8) == 6);
+    T(num_heap_exhausted_warnings == 2);
+    // live objects keep their index
+    T(sg_query_view_bindless_index(tex_view) == tex_index);
+    T(sg_query_view_bindless_index(sbuf_view) == sbuf_index);
+    T(sg_query_sampler_bindless_index(smp0) == smp_index0);
+    T(sg_query_sampler_bindless_index(smp1) == smp_index1);
+    sg_destroy_view(tex_view);
+    T(sg_query_view_bindless_index(tex_view) == 0);
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        clear_pass(att_view);
+        sg_commit();
+    }
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, bindless_needs_descriptor_indexing) {
+    memset(&vk, 0, sizeof(vk));
+    if (!create_instance() || !pick_physical_device() || !create_device()) {
+        printf("no suitable Vulkan device available, skipping test\n");
+        destroy_vulkan();
+        return;
+    }
+    // the device features are only supported, not signalled as enabled
+    sg_environment env = vulkan_environment();
+    env.vulkan.descriptor_indexing = false;
+    sg_setup(&(sg_desc){ .vulkan.bindless = true, .environment = env, .logger.func = slog_func });
+    T(!sg_query_features().bindless);
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, setup_fails_without_timeline_semaphore) {
+    memset(&vk, 0, sizeof(vk));
+    if (!create_instance() || !pick_physical_device() || !create_device()) {
+        printf("no suitable Vulkan device available, skipping test\n");
+        destroy_vulkan();
+        return;
+    }
+    sg_environment env = vulkan_environment();
+    env.vulkan.timeline_semaphore = false;
+    sg_setup(&(sg_desc){ .environment = env, .logger.func = slog_func });
+    T(!sg_isvalid());
+    // a failed setup leaves nothing behind, a second setup must work
+    env.vulkan.timeline_semaphore = true;
+    sg_setup(&(sg_desc){ .environment = env, .logger.func = slog_func });
+    T(sg_isvalid());
+    T(0 == shutdown());
+}
+
+#if defined(SOKOL_MULTI_CONTEXT)
+UTEST(sokol_gfx_vk, make_context_fails_without_timeline_semaphore) {
+    if (!setup()) {
+        return;
+    }
+    sg_environment env = vulkan_environment();
+    env.vulkan.timeline_semaphore = false;
+    sg_context ctx = sg_make_context(&(sg_desc){ .environment = env, .logger.func = slog_func });
+    T(ctx.id == SG_INVALID_ID);
+    // the default context is unaffected
+    T(sg_get_context().id == sg_default_context().id);
+    T(sg_isvalid());
+    // the context slot has been released, so all slots can still be used
+    env.vulkan.timeline_semaphore = true;
+    sg_context ctxs[SG_MAX_CONTEXTS];
+    for (int i = 1; i < SG_MAX_CONTEXTS; i++) {
+        ctxs[i] = sg_make_context(&(sg_desc){ .environment = env, .logger.func = slog_func });
+        T(ctxs[i].id != SG_INVALID_ID);
+    }
+    for (int i = 1; i < SG_MAX_CONTEXTS; i++) {
+        sg_destroy_context(ctxs[i]);
+    }
+    T(0 == shutdown());
+}
+#endif
+
+UTEST(sokol_gfx_vk, occlusion_counter) {
+    if (!setup()) {
+        return;
+    }
+    if (!sg_query_features().occlusion_counter) {
+        printf("occlusion counters not supported, skipping test\n");
+        T(0 == shutdown());
+        return;
+    }
+    sg_view att_view = make_color_attachment();
+    sg_counter ctr = sg_make_counter(&(sg_counter_desc){ .type = SG_COUNTERTYPE_OCCLUSION });
+    T(sg_query_counter_state(ctr) == SG_RESOURCESTATE_VALID);
+    const uint32_t first_frame_index = _sg.frame_index;
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        sg_begin_pass(&(sg_pass){ .attachments.colors[0] = att_view });
+        sg_begin_counter(ctr);
+        sg_end_counter(ctr);
+        sg_end_pass();
+        sg_commit();
+    }
+    vkDeviceWaitIdle(vk.device);
+    const sg_counter_value val = sg_query_counter_value(ctr);
+    T(val.available);
+    T(val.frame_index >= first_frame_index);
+    T(val.frame_index < _sg.frame_index);
+    T(val.samples_passed == 0);
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, transient_attachments) {
+    if (!setup()) {
+        return;
+    }
+    num_transient_images_created = 0;
+    // MSAA color and depth-stencil are transient, only the resolve image keeps the result
+    sg_image msaa_img = sg_make_image(&(sg_image_desc){
+        .usage = { .color_attachment = true, .transient_attachment = true },
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .sample_count = 4,
+    });
+    sg_image depth_img = sg_make_image(&(sg_image_desc){
+        .usage = { .depth_stencil_attachment = true, .transient_attachment = true },
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL,
+        .sample_count = 4,
+    });
+    sg_image resolve_img = sg_make_image(&(sg_image_desc){
+        .usage.resolve_attachment = true,
+        .width = 4,
+        .height = 4,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    T(sg_query_image_state(msaa_img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(depth_img) == SG_RESOURCESTATE_VALID);
+    T(sg_query_image_state(resolve_img) == SG_RESOURCESTATE_VALID);
+    T(num_transient_images_created == 2);
+    sg_view color_att = sg_make_view(&(sg_view_desc){ .color_attachment.image = msaa_img });
+    sg_view depth_att = sg_make_view(&(sg_view_desc){ .depth_stencil_attachment.image = depth_img });
+    sg_view resolve_att = sg_make_view(&(sg_view_desc){ .resolve_attachment.image = resolve_img });
+    const sg_color clear_colors[3] = {
+        { 1.0f, 0.0f, 0.0f, 1.0f },
+        { 0.0f, 1.0f, 0.0f, 1.0f },
+        { 0.0f, 0.0f, 1.0f, 1.0f },
+    };
+    for (int frame = 0; frame < 3; frame++) {
+        sg_begin_pass(&(sg_pass){
+            .action = {
+                .colors[0] = { .load_action = SG_LOADACTION_CLEAR, .store_action = SG_STOREACTION_DONTCARE, .clear_value = clear_colors[frame] },
+                .depth = { .load_action = SG_LOADACTION_CLEAR, .store_action = SG_STOREACTION_DONTCARE },
+                .stencil = { .load_action = SG_LOADACTION_CLEAR, .store_action = SG_STOREACTION_DONTCARE },
+            },
+            .attachments = {
+                .colors[0] = color_att,
+                .resolves[0] = resolve_att,
+                .depth_stencil = depth_att,
+            },
+        });
+        sg_end_pass();
+        sg_commit();
+        // each frame's clear color must arrive in the resolve image
+        uint8_t pixels[4 * 4 * 4];
+        T(read_image_pixels(resolve_img, pixels, sizeof(pixels)));
+        const uint8_t r = (uint8_t)(clear_colors[frame].r * 255.0f);
+        const uint8_t g = (uint8_t)(clear_colors[frame].g * 255.0f);
+        const uint8_t b = (uint8_t)(clear_colors[frame].b * 255.0f);
+        T(pixel_equal(&pixels[0], r, g, b, 255));
+        T(pixel_equal(&pixels[sizeof(pixels) - 4], r, g, b, 255));
+    }
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, parallel_shader_compile) {
+    if (!setup_with_desc((sg_desc){ .parallel_shader_compile = true })) {
+        return;
+    }
+    if (!sg_query_features().parallel_shader_compile) {
+        printf("pipeline compiler thread not available, skipping test\n");
+        T(0 == shutdown());
+        return;
+    }
+    sg_enable_stats();
+    sg_view att_view = make_color_attachment();
+    sg_buffer vbuf = make_fullscreen_triangle();
+    sg_pipeline pip = make_pipeline((sg_shader_desc){ .fragment_func.bytecode = SG_RANGE(fs_green_spirv) });
+    // a batch of pipelines on one shader, half of them are destroyed while queued or compiling
+    sg_pipeline batch[16];
+    for (int i = 0; i < 16; i++) {
+        batch[i] = sg_make_pipeline(&(sg_pipeline_desc){
+            .shader = sg_query_pipeline_desc(pip).shader,
+            .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT4,
+            .depth.pixel_format = SG_PIXELFORMAT_NONE,
+            .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+            .primitive_type = (i & 1) ? SG_PRIMITIVETYPE_TRIANGLE_STRIP : SG_PRIMITIVETYPE_TRIANGLES,
+        });
+    }
+    // a shader destroyed while its pipeline is compiling waits for the pipeline
+    sg_pipeline destroyed_pip = make_pipeline((sg_shader_desc){ .fragment_func.bytecode = SG_RANGE(fs_green_spirv) });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_ALLOC);
+    T(sg_query_pipeline_state(destroyed_pip) == SG_RESOURCESTATE_ALLOC);
+    sg_destroy_shader(sg_query_pipeline_desc(destroyed_pip).shader);
+    sg_destroy_pipeline(destroyed_pip);
+    for (int i = 0; i < 16; i += 2) {
+        sg_destroy_pipeline(batch[i]);
+    }
+    // draws with the compiling pipeline are skipped until sg_commit() has seen the result
+    int num_frames = 0;
+    uint32_t num_skipped_draws = 0;
+    while ((sg_query_pipeline_state(pip) == SG_RESOURCESTATE_ALLOC) && (num_frames < 10000)) {
+        num_skipped_draws += draw_frame(att_view, pip, vbuf).num_skipped_draws;
+        num_frames++;
+    }
+    T(num_frames >= 1);
+    T(num_skipped_draws == (uint32_t)num_frames);
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    T(draw_frame(att_view, pip, vbuf).num_skipped_draws == 0);
+    uint8_t pixels[4 * 4 * 4];
+    T(read_image_pixels(sg_query_view_image(att_view), pixels, sizeof(pixels)));
+    T(pixel_equal(&pixels[0], 0, 255, 0, 255));
+    T(pixel_equal(&pixels[sizeof(pixels) - 4], 0, 255, 0, 255));
+    for (int i = 0; (i < 10000) && (sg_query_pipeline_state(batch[15]) == SG_RESOURCESTATE_ALLOC); i++) {
+        sg_commit();
+    }
+    for (int i = 1; i < 16; i += 2) {
+        T(sg_query_pipeline_state(batch[i]) == SG_RESOURCESTATE_VALID);
+    }
+    // shutdown with pipelines still in the compile queue
+    for (int i = 0; i < 16; i++) {
+        sg_make_pipeline(&(sg_pipeline_desc){
+            .shader = sg_query_pipeline_desc(pip).shader,
+            .layout.attrs[0].format = SG_VERTEXFORMAT_FLOAT4,
+            .depth.pixel_format = SG_PIXELFORMAT_NONE,
+            .colors[0].pixel_format = SG_PIXELFORMAT_RGBA8,
+        });
+    }
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, push_constant_uniforms) {
+    if (!setup()) {
+        return;
+    }
+    sg_enable_stats();
+    sg_view att_view = make_color_attachment();
+    sg_buffer vbuf = make_fullscreen_triangle();
+    sg_pipeline pip = make_pipeline((sg_shader_desc){
+        .fragment_func.bytecode = SG_RANGE(fs_push_constant_spirv),
+        .uniform_blocks[0] = {
+            .stage = SG_SHADERSTAGE_FRAGMENT,
+            .size = 16,
+            .spirv_push_constant = true,
+        },
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    const float colors[3][4] = {
+        { 0.0f, 1.0f, 0.0f, 1.0f },
+        { 0.0f, 0.0f, 1.0f, 1.0f },
+        { 1.0f, 1.0f, 1.0f, 1.0f },
+    };
+    for (int frame = 0; frame < 3; frame++) {
+        sg_begin_pass(&(sg_pass){
+            .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+            .attachments.colors[0] = att_view,
+        });
+        sg_apply_pipeline(pip);
+        sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+        // only the last color survives, each apply is one vkCmdPushConstants()
+        for (int i = 0; i <= frame; i++) {
+            sg_apply_uniforms(0, &SG_RANGE(colors[i]));
+            sg_draw(0, 3, 1);
+        }
+        sg_end_pass();
+        const sg_frame_stats stats = sg_query_stats().cur_frame;
+        sg_commit();
+        T(stats.vk.num_cmd_push_constants == (uint32_t)(frame + 1));
+        uint8_t pixels[4 * 4 * 4];
+        T(read_image_pixels(sg_query_view_image(att_view), pixels, sizeof(pixels)));
+        const uint8_t r = (uint8_t)(colors[frame][0] * 255.0f);
+        const uint8_t g = (uint8_t)(colors[frame][1] * 255.0f);
+        const uint8_t b = (uint8_t)(colors[frame][2] * 255.0f);
+        T(pixel_equal(&pixels[0], r, g, b, 255));
+        T(pixel_equal(&pixels[sizeof(pixels) - 4], r, g, b, 255));
+    }
+    T(0 == shutdown());
+}
+
+static void fill_pattern(uint8_t* pixels, int width, int height, int frame) {
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t* px = &pixels[(y * width + x) * 4];
+            px[0] = (uint8_t)(x * 8);
+            px[1] = (uint8_t)(y * 8);
+            px[2] = (uint8_t)(frame * 50);
+            px[3] = 255;
+        }
+    }
+}
+
+UTEST(sokol_gfx_vk, staging_copy_ring) {
+    // 4 segments of 1 KB, a 32x32 RGBA8 image upload spans all of them
+    if (!setup_with_desc((sg_desc){ .vulkan.copy_staging_buffer_size = 4 * 1024 })) {
+        return;
+    }
+    sg_enable_stats();
+    T(_sg.vk.stage.copy.segment_size == 1024);
+    sg_view att_view = make_color_attachment();
+    sg_pipeline pip = make_pipeline((sg_shader_desc){ .fragment_func.bytecode = SG_RANGE(fs_green_spirv) });
+    // a vertex buffer bigger than a segment, with the fullscreen triangle in the last chunk
+    float vertices[96][4] = {{0}};
+    const float triangle[3][4] = {
+        { -1.0f, -1.0f, 0.5f, 1.0f },
+        {  3.0f, -1.0f, 0.5f, 1.0f },
+        { -1.0f,  3.0f, 0.5f, 1.0f },
+    };
+    memcpy(&vertices[93], triangle, sizeof(triangle));
+    T(sizeof(vertices) > 1024);
+    sg_buffer vbuf = sg_make_buffer(&(sg_buffer_desc){ .data = SG_RANGE(vertices) });
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 1.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = att_view,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    sg_draw(93, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    uint8_t att_pixels[4 * 4 * 4];
+    T(read_image_pixels(sg_query_view_image(att_view), att_pixels, sizeof(att_pixels)));
+    T(pixel_equal(&att_pixels[0], 0, 255, 0, 255));
+    T(pixel_equal(&att_pixels[sizeof(att_pixels) - 4], 0, 255, 0, 255));
+
+    // several multi-segment uploads per frame wrap around the ring
+    static uint8_t pixels[32 * 32 * 4];
+    static uint8_t readback[32 * 32 * 4];
+    sg_image dyn_img = sg_make_image(&(sg_image_desc){
+        .usage.dynamic_update = true,
+        .width = 32,
+        .height = 32,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+    });
+    uint32_t num_submits = 0;
+    for (int frame = 0; frame < 3 * SG_NUM_INFLIGHT_FRAMES; frame++) {
+        fill_pattern(pixels, 32, 32, frame);
+        sg_image imgs[3];
+        for (int i = 0; i < 3; i++) {
+            imgs[i] = sg_make_image(&(sg_image_desc){
+                .width = 32,
+                .height = 32,
+                .pixel_format = SG_PIXELFORMAT_RGBA8,
+                .data.mip_levels[0] = SG_RANGE(pixels),
+            });
+            T(sg_query_image_state(imgs[i]) == SG_RESOURCESTATE_VALID);
+        }
+        sg_update_image(dyn_img, &(sg_image_data){ .mip_levels[0] = SG_RANGE(pixels) });
+        clear_pass(att_view);
+        num_submits += sg_query_stats().cur_frame.vk.num_staging_copy_submits;
+        sg_commit();
+        for (int i = 0; i < 3; i++) {
+            T(read_image_pixels(imgs[i], readback, sizeof(readback)));
+            T(0 == memcmp(pixels, readback, sizeof(pixels)));
+            sg_destroy_image(imgs[i]);
+        }
+        T(read_image_pixels(dyn_img, readback, sizeof(readback)));
+        T(0 == memcmp(pixels, readback, sizeof(pixels)));
+    }
+    // 16 chunks per frame, the last one is submitted in sg_commit()
+    T(num_submits >= (uint32_t)(15 * 3 * SG_NUM_INFLIGHT_FRAMES));
+    T(0 == shutdown());
+}
+
+UTEST(sokol_gfx_vk, uniform_buffer_offsets) {
+    if (!setup()) {
+        return;
+    }
+    T(sg_query_features().uniform_buffer_bindings);
+    sg_enable_stats();
+    sg_view att_view = make_color_attachment();
+    sg_buffer vbuf = make_fullscreen_triangle();
+    sg_pipeline pip = make_pipeline((sg_shader_desc){
+        .fragment_func.bytecode = SG_RANGE(fs_uniform_buffer_spirv),
+        .uniform_blocks[0] = {
+            .stage = SG_SHADERSTAGE_FRAGMENT,
+            .size = 16,
+            .spirv_set0_binding_n = 0,
+        },
+    });
+    T(sg_query_pipeline_state(pip) == SG_RESOURCESTATE_VALID);
+    // one color per aligned offset in the same buffer
+    enum { NUM_DRAWS = 4 };
+    const int align = sg_query_limits().uniform_buffer_offset_alignment;
+    T((align >= 16) && (align <= 256));
+    const size_t stride = (size_t)align / sizeof(float);
+    static float ub_data[NUM_DRAWS * 64];
+    const uint8_t colors[NUM_DRAWS][3] = { { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 }, { 255, 255, 0 } };
+    for (int i = 0; i < NUM_DRAWS; i++) {
+        float* c = &ub_data[(size_t)i * stride];
+        c[0] = colors[i][0] / 255.0f;
+        c[1] = colors[i][1] / 255.0f;
+        c[2] = colors[i][2] / 255.0f;
+        c[3] = 1.0f;
+    }
+    sg_buffer ubuf = sg_make_buffer(&(sg_buffer_desc){
+        .usage.uniform_buffer = true,
+        .data = { .ptr = ub_data, .size = (size_t)(NUM_DRAWS * align) },
+    });
+    T(sg_query_buffer_state(ubuf) == SG_RESOURCESTATE_VALID);
+    sg_begin_pass(&(sg_pass){
+        .action.colors[0] = { .load_action = SG_LOADACTION_CLEAR, .clear_value = { 0.0f, 0.0f, 0.0f, 1.0f } },
+        .attachments.colors[0] = att_view,
+    });
+    sg_apply_pipeline(pip);
+    sg_apply_bindings(&(sg_bindings){ .vertex_buffers[0] = vbuf });
+    // draw i fills pixel (i, 0) with the color at offset i * align
+    for (int i = 0; i < NUM_DRAWS; i++) {
+        sg_apply_viewport(i, 0, 1, 1, true);
+        sg_apply_uniform_buffer(0, ubuf, i * align);
+        sg_draw(0, 3, 1);
+    }
+    // re-applying the current range doesn't write a new descriptor
+    const uint32_t num_offsets = sg_query_stats().cur_frame.vk.num_cmd_set_descriptor_buffer_offsets;
+    sg_apply_viewport(0, 1, 1, 1, true);
+    sg_apply_uniform_buffer(0, ubuf, (NUM_DRAWS - 1) * align);
+    sg_draw(0, 3, 1);
+    T(sg_query_stats().cur_frame.vk.num_cmd_set_descriptor_buffer_offsets == num_offsets);
+    // sg_apply_uniforms() and sg_apply_uniform_buffer() can be mixed
+    const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    sg_apply_viewport(1, 1, 1, 1, true);
+    sg_apply_uniforms(0, &SG_RANGE(white));
+    sg_draw(0, 3, 1);
+    sg_apply_viewport(2, 1, 1, 1, true);
+    sg_apply_uniform_buffer(0, ubuf, 0);
+    sg_draw(0, 3, 1);
+    sg_end_pass();
+    sg_commit();
+    uint8_t px[4 * 4 * 4];
+    T(read_image_pixels(sg_query_view_image(att_view), px, sizeof(px)));
+    for (int i = 0; i < NUM_DRAWS; i++) {
+        T(pixel_equal(&px[i * 4], colors[i][0], colors[i][1], colors[i][2], 255));
+    }
+    T(pixel_equal(&px[(4 + 0) * 4], 255, 255, 0, 255));
+    T(pixel_equal(&px[(4 + 1) * 4], 255, 255, 255, 255));
+    T(pixel_equal(&px[(4 + 2) * 4], 255, 0, 0, 255));
+    T(pixel_equal(&px[(4 + 3) * 4], 0, 0, 0, 255));
+    T(0 == shutdown());
+}
@@ -0,0 +1,345 @@
+//------------------------------------------------------------------------------
+//  sokol_rendergraph_test.c
+//------------------------------------------------------------------------------
+#include "sokol_gfx.h"
+#define SOKOL_RENDERGRAPH_IMPL
+#include "sokol_rendergraph.h"
+#include "utest.h"
+
+#define T(b) EXPECT_TRUE(b)
+
+static srg_log_item_t last_log_item;
+static int num_log_called;
+
+static void test_logger(const char* tag, uint32_t log_level, uint32_t log_item_id, const char* message_or_null, uint32_t line_nr, const char* filename_or_null, void* user_data) {
+    (void)tag; (void)log_level; (void)message_or_null; (void)line_nr; (void)filename_or_null; (void)user_data;
+    last_log_item = (srg_log_item_t)log_item_id;
+    num_log_called++;
+}
+
+static void init(int max_pool_images) {
+    last_log_item = SRG_LOGITEM_OK;
+    num_log_called = 0;
+    sg_setup(&(sg_desc){0});
+    srg_setup(&(srg_desc_t){
+        .max_pool_images = max_pool_images,
+        .max_unused_frames = 2,
+        .logger.func = test_logger,
+    });
+}
+
+static void shutdown(void) {
+    srg_shutdown();
+    sg_shutdown();
+}
+
+static srg_resource make_image(void) {
+    return srg_create_image(&(srg_image_desc_t){ .width = 64, .height = 32, .pixel_format = SG_PIXELFORMAT_RGBA8, .sample_count = 1 });
+}
+
+static srg_resource import_output(sg_view* out_att_view) {
+    sg_image img = sg_make_image(&(sg_image_desc){
+        .usage.color_attachment = true,
+        .width = 64,
+        .height = 32,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .sample_count = 1,
+    });
+    *out_att_view = sg_make_view(&(sg_view_desc){ .color_attachment.image = img });
+    return srg_import_image(&(srg_import_desc_t){ .attachment = *out_att_view });
+}
+
+static int exec_order[16];
+static int num_exec;
+
+static void record_exec(void* user_data) {
+    exec_order[num_exec++] = (int)(intptr_t)user_data;
+}
+
+UTEST(sokol_rendergraph, cull_unused_passes) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource a = make_image();
+    srg_resource b = make_image();
+    srg_resource out = import_output(&out_view);
+    srg_pass pa = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a });
+    srg_pass pb = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b });
+    srg_pass pout = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = a });
+    srg_pass pswap = srg_add_pass(&(srg_pass_desc_t){ .reads[0] = b });
+    (void)pswap;
+    T(srg_compile());
+    T(!srg_query_pass_info(pa).culled);
+    T(!srg_query_pass_info(pb).culled);
+    T(!srg_query_pass_info(pout).culled);
+    srg_stats_t stats = srg_query_stats();
+    T(stats.num_passes == 4);
+    T(stats.num_culled_passes == 0);
+
+    // same graph without the swapchain pass, now 'b' is unused
+    srg_begin();
+    a = make_image();
+    b = make_image();
+    out = srg_import_image(&(srg_import_desc_t){ .attachment = out_view });
+    pa = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a });
+    pb = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b });
+    pout = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = a });
+    T(srg_compile());
+    T(!srg_query_pass_info(pa).culled);
+    T(srg_query_pass_info(pb).culled);
+    T(srg_query_pass_info(pb).order == -1);
+    T(!srg_query_pass_info(pout).culled);
+    T(srg_query_resource_info(b).culled);
+    T(srg_query_resource_info(b).pool_index == -1);
+    stats = srg_query_stats();
+    T(stats.num_culled_passes == 1);
+    T(stats.num_culled_resources == 1);
+    T(stats.num_pool_images == 1);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, never_cull) {
+    init(0);
+    srg_begin();
+    srg_resource a = make_image();
+    srg_pass pa = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a, .never_cull = true });
+    T(srg_compile());
+    T(!srg_query_pass_info(pa).culled);
+    T(!srg_query_resource_info(a).culled);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, order_and_execute) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource a = make_image();
+    srg_resource b = make_image();
+    // declared in reverse order
+    srg_pass p2 = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = b, .execute = record_exec, .user_data = (void*)2 });
+    srg_pass p1 = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b, .reads[0] = a, .execute = record_exec, .user_data = (void*)1 });
+    srg_pass p0 = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a, .execute = record_exec, .user_data = (void*)0 });
+    T(srg_compile());
+    T(srg_query_pass_info(p0).order == 0);
+    T(srg_query_pass_info(p1).order == 1);
+    T(srg_query_pass_info(p2).order == 2);
+    num_exec = 0;
+    srg_execute();
+    T(num_exec == 3);
+    T(exec_order[0] == 0);
+    T(exec_order[1] == 1);
+    T(exec_order[2] == 2);
+    T(sg_query_stats().cur_frame.num_passes == 3);
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, multiple_writers) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource a = make_image();
+    // the reader is declared first, it must run after both writers of 'a',
+    // and the writers of 'a' must run in declaration order
+    srg_pass p2 = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = a, .execute = record_exec, .user_data = (void*)2 });
+    srg_pass p0 = srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a, .execute = record_exec, .user_data = (void*)0 });
+    srg_pass p1 = srg_add_pass(&(srg_pass_desc_t){
+        .colors[0] = a,
+        .action.colors[0].load_action = SG_LOADACTION_LOAD,
+        .execute = record_exec,
+        .user_data = (void*)1,
+    });
+    T(srg_compile());
+    T(srg_query_pass_info(p0).order == 0);
+    T(srg_query_pass_info(p1).order == 1);
+    T(srg_query_pass_info(p2).order == 2);
+    num_exec = 0;
+    srg_execute();
+    T(num_exec == 3);
+    T((exec_order[0] == 0) && (exec_order[1] == 1) && (exec_order[2] == 2));
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, resolve_usage) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource msaa = srg_create_image(&(srg_image_desc_t){ .width = 64, .height = 32, .pixel_format = SG_PIXELFORMAT_RGBA8, .sample_count = 4 });
+    srg_resource resolved = make_image();
+    srg_resource plain = make_image();
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = msaa, .resolves[0] = resolved });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = plain, .reads[0] = resolved });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = plain });
+    T(srg_compile());
+    // only images which are actually resolved into get the resolve-attachment usage
+    T(sg_query_image_usage(srg_image(resolved)).resolve_attachment);
+    T(!sg_query_image_usage(srg_image(plain)).resolve_attachment);
+    T(!sg_query_image_usage(srg_image(msaa)).resolve_attachment);
+    T(srg_query_resource_info(resolved).pool_index != srg_query_resource_info(plain).pool_index);
+    srg_execute();
+    T(num_log_called == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, aliasing) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource a = make_image();
+    srg_resource b = make_image();
+    srg_resource c = make_image();
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b, .reads[0] = a });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = c, .reads[0] = b });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = c });
+    T(srg_compile());
+    const srg_resource_info_t ia = srg_query_resource_info(a);
+    const srg_resource_info_t ib = srg_query_resource_info(b);
+    const srg_resource_info_t ic = srg_query_resource_info(c);
+    T((ia.first_pass == 0) && (ia.last_pass == 1));
+    T((ib.first_pass == 1) && (ib.last_pass == 2));
+    T((ic.first_pass == 2) && (ic.last_pass == 3));
+    T(ia.pool_index == ic.pool_index);
+    T(ia.pool_index != ib.pool_index);
+    T(ia.image.id == ic.image.id);
+    T(srg_image(a).id == srg_image(c).id);
+    T(srg_texture_view(a).id == srg_texture_view(c).id);
+    T(srg_texture_view(a).id != SG_INVALID_ID);
+    T(srg_query_resource_info(out).imported);
+    T(srg_query_resource_info(out).pool_index == -1);
+    const size_t image_size = (size_t)sg_query_surface_pitch(SG_PIXELFORMAT_RGBA8, 64, 32, 1);
+    const srg_stats_t stats = srg_query_stats();
+    T(stats.num_pool_images == 2);
+    T(stats.naive_bytes == 3 * image_size);
+    T(stats.aliased_bytes == 2 * image_size);
+    T(stats.saved_bytes == image_size);
+    srg_execute();
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, no_aliasing_of_incompatible_images) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource a = make_image();
+    srg_resource b = make_image();
+    srg_resource c = srg_create_image(&(srg_image_desc_t){ .width = 32, .height = 32, .pixel_format = SG_PIXELFORMAT_RGBA8, .sample_count = 1 });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b, .reads[0] = a });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = c, .reads[0] = b });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = c });
+    T(srg_compile());
+    T(srg_query_resource_info(a).pool_index != srg_query_resource_info(c).pool_index);
+    T(srg_query_stats().num_pool_images == 3);
+    T(srg_query_stats().saved_bytes == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, transient_depth_buffer) {
+    init(0);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource color = make_image();
+    srg_resource depth = srg_create_image(&(srg_image_desc_t){ .width = 64, .height = 32, .pixel_format = SG_PIXELFORMAT_DEPTH, .sample_count = 1 });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = color, .depth_stencil = depth });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = color });
+    T(srg_compile());
+    const srg_resource_info_t info = srg_query_resource_info(depth);
+    T(info.transient);
+    T(sg_query_image_usage(info.image).transient_attachment);
+    T(sg_query_image_usage(info.image).depth_stencil_attachment);
+    T(srg_texture_view(depth).id == SG_INVALID_ID);
+    T(!srg_query_resource_info(color).transient);
+    srg_execute();
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, pool_reuse_and_eviction) {
+    init(0);
+    sg_view out_view = { SG_INVALID_ID };
+    sg_image first_image = { SG_INVALID_ID };
+    for (int frame = 0; frame < 3; frame++) {
+        srg_begin();
+        srg_resource out;
+        if (frame == 0) {
+            out = import_output(&out_view);
+        } else {
+            out = srg_import_image(&(srg_import_desc_t){ .attachment = out_view });
+        }
+        srg_resource a = make_image();
+        srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a });
+        srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = a });
+        T(srg_compile());
+        if (frame == 0) {
+            first_image = srg_image(a);
+        } else {
+            T(srg_image(a).id == first_image.id);
+        }
+        T(srg_query_stats().num_pool_images_alive == 1);
+    }
+    // the pooled image is destroyed once it hasn't been used for more than 2 frames
+    for (int frame = 0; frame < 3; frame++) {
+        srg_begin();
+        T(srg_compile());
+    }
+    T(srg_query_stats().num_pool_images_alive == 0);
+    T(sg_query_image_state(first_image) == SG_RESOURCESTATE_INVALID);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, dependency_cycle) {
+    init(0);
+    srg_begin();
+    srg_resource a = make_image();
+    srg_resource b = make_image();
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a, .reads[0] = b, .never_cull = true });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b, .reads[0] = a, .never_cull = true });
+    T(!srg_compile());
+    T(last_log_item == SRG_LOGITEM_DEPENDENCY_CYCLE);
+    srg_execute();
+    T(sg_query_stats().cur_frame.num_passes == 0);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, feedback_loop) {
+    init(0);
+    srg_begin();
+    srg_resource a = make_image();
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a, .reads[0] = a, .never_cull = true });
+    T(!srg_compile());
+    T(last_log_item == SRG_LOGITEM_FEEDBACK_LOOP);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, outdated_handle) {
+    init(0);
+    srg_begin();
+    srg_resource a = make_image();
+    srg_begin();
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a, .never_cull = true });
+    T(!srg_compile());
+    T(last_log_item == SRG_LOGITEM_INVALID_RESOURCE);
+    shutdown();
+}
+
+UTEST(sokol_rendergraph, pool_exhausted) {
+    init(1);
+    srg_begin();
+    sg_view out_view;
+    srg_resource out = import_output(&out_view);
+    srg_resource a = make_image();
+    srg_resource b = make_image();
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = a });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = b, .reads[0] = a });
+    srg_add_pass(&(srg_pass_desc_t){ .colors[0] = out, .reads[0] = b });
+    T(!srg_compile());
+    T(last_log_item == SRG_LOGITEM_IMAGE_POOL_EXHAUSTED);
+    shutdown();
+}
@@ -44,7 +44,9 @@ analyze() {
 
 runtest() {
     cfg=$1
+    exe=${2:-sokol-test}
+    shift $(( $# < 2 ? $# : 2 ))
     cd build/$cfg
-    ./sokol-test
-    cd ../../..
+    ./$exe "$@"
+    cd ../..
 }
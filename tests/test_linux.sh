@@ -9,4 +9,13 @@ build linux_gles3_debug linux_gles3_debug
 build linux_gles3_release linux_gles3_release
 build linux_gl_egl_debug linux_gl_egl_debug
 build linux_gl_egl_release linux_gl_egl_release
+build linux_software_debug linux_software_debug
+build linux_software_release linux_software_release
 runtest linux_gl_debug
+runtest linux_gl_debug sokol-gfx-mt-test
+runtest linux_gl_debug sokol-gl-test
+SOKOL_VK_TEST_REQUIRE_VALIDATION=1 runtest linux_vulkan_debug sokol-vk-test
+SOKOL_VK_TEST_REQUIRE_VALIDATION=1 runtest linux_vulkan_debug sokol-vk-mt-test
+runtest linux_vulkan_release sokol-gfx-vulkan-uniforms-bench 1000 10
+runtest linux_software_debug
+runtest linux_software_debug sokol-gfx-mt-test
@@ -9,3 +9,4 @@ build macos_arc_gl_release macos_arc_gl_release
 build macos_arc_metal_debug macos_arc_metal_debug
 build macos_arc_metal_release macos_arc_metal_release
 runtest macos_gl_debug
+runtest macos_gl_debug sokol-gfx-mt-test
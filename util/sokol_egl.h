@@ -0,0 +1,813 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_EGL_IMPL)
+#define SOKOL_EGL_IMPL
+#endif
+#ifndef SOKOL_EGL_INCLUDED
+/*
+    sokol_egl.h -- headless EGL context and offscreen swapchain for sokol_gfx.h
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_EGL_IMPL
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    The following defines are used by the implementation to select the
+    GL flavour (these are the same defines as used by sokol_gfx.h and
+    sokol_app.h):
+
+    SOKOL_GLCORE
+    SOKOL_GLES3
+
+    Optionally provide the following defines with your own implementations:
+
+    SOKOL_ASSERT(c)     - your own assert macro (default: assert(c))
+    SOKOL_EGL_API_DECL  - public function declaration prefix (default: extern)
+    SOKOL_API_DECL      - same as SOKOL_EGL_API_DECL
+    SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_egl.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_EGL_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    Include the following headers before including sokol_egl.h:
+
+        sokol_gfx.h
+
+    Link with the following libraries:
+
+        - on Linux with SOKOL_GLCORE: EGL and OpenGL (or GL)
+        - on Linux with SOKOL_GLES3: EGL and GLESv2
+
+    WHAT
+    ====
+    sokol_egl.h creates a GL context without a window system (no X11 or
+    Wayland connection required), and provides the sg_environment and
+    sg_swapchain structs to run sokol_gfx.h on top of that context. This is
+    useful for batch rendering, thumbnail generation, benchmarks and tests
+    running on CI machines or GPU-less render nodes (for instance with the
+    Mesa llvmpipe driver).
+
+    Since there is no window, the 'swapchain' is a GL framebuffer object with
+    an RGBA8 color renderbuffer and an optional depth-stencil renderbuffer.
+    Rendered pixels can be read back with segl_read_pixels().
+
+    The EGLDisplay is obtained in the following order (unless a specific
+    platform is requested in segl_desc.platform):
+
+        1. EGL_MESA_platform_surfaceless: a display which doesn't need any
+           window system or device node, this is what Mesa's llvmpipe
+           software rasterizer supports
+        2. EGL_EXT_platform_device: the first device enumerated via
+           EGL_EXT_device_enumeration (usually the GPU driver on
+           headless NVIDIA or Mesa render nodes)
+        3. eglGetDisplay(EGL_DEFAULT_DISPLAY)
+
+    If the display supports EGL_KHR_surfaceless_context, the context is made
+    current without a surface, otherwise a 1x1 pbuffer surface is created.
+
+    HOW
+    ===
+    First call segl_setup(), this creates the EGL display, context and the
+    offscreen framebuffer and makes the context current on the calling thread:
+
+        segl_setup(&(segl_desc){
+            .width = 1024,
+            .height = 768,
+            .logger.func = slog_func,
+        });
+        if (!segl_isvalid()) {
+            // EGL setup has failed, check the log output
+        }
+
+    Next setup sokol_gfx.h with the environment provided by sokol_egl.h:
+
+        sg_setup(&(sg_desc){
+            .environment = segl_environment(),
+            .logger.func = slog_func,
+        });
+
+    ...then use segl_swapchain() for 'swapchain render passes' like you'd use
+    sglue_swapchain() with sokol_app.h:
+
+        sg_begin_pass(&(sg_pass){ .swapchain = segl_swapchain(), ... });
+        ...
+        sg_end_pass();
+        sg_commit();
+
+    To read the rendered image back into memory (outside a sokol_gfx.h pass),
+    provide a buffer of at least width * height * 4 bytes:
+
+        static uint32_t pixels[768][1024];
+        segl_read_pixels(SG_RANGE(pixels));
+
+    The pixels are RGBA8 with the top-left pixel first (e.g. GL's
+    bottom-to-top row order has already been flipped). If the swapchain is
+    multisampled, the framebuffer is resolved first.
+
+    To change the size of the offscreen framebuffer:
+
+        segl_resize(new_width, new_height);
+
+    Finally shutdown sokol_gfx.h first, then sokol_egl.h:
+
+        sg_shutdown();
+        segl_shutdown();
+
+    You can also request a specific EGL platform instead of the
+    automatic selection:
+
+        segl_setup(&(segl_desc){
+            .platform = SEGL_PLATFORM_DEVICE,
+            ...
+        });
+
+    ...and query the platform that was actually used with:
+
+        segl_platform platform = segl_query_platform();
+
+    The EGLDisplay and EGLContext objects can be obtained with:
+
+        const void* segl_egl_display(void);
+        const void* segl_egl_context(void);
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_EGL_INCLUDED (1)
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_egl.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_EGL_API_DECL)
+#define SOKOL_EGL_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_EGL_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_EGL_IMPL)
+#define SOKOL_EGL_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_EGL_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_EGL_API_DECL extern
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+    segl_platform
+
+    The EGL platform used to obtain the EGLDisplay. The default is to
+    try SEGL_PLATFORM_SURFACELESS, SEGL_PLATFORM_DEVICE and
+    SEGL_PLATFORM_DEFAULT_DISPLAY in that order.
+*/
+typedef enum segl_platform {
+    _SEGL_PLATFORM_DEFAULT = 0,
+    SEGL_PLATFORM_SURFACELESS,      // EGL_MESA_platform_surfaceless
+    SEGL_PLATFORM_DEVICE,           // EGL_EXT_platform_device (first enumerated device)
+    SEGL_PLATFORM_DEFAULT_DISPLAY,  // eglGetDisplay(EGL_DEFAULT_DISPLAY)
+    _SEGL_PLATFORM_FORCE_U32 = 0x7FFFFFFF
+} segl_platform;
+
+/*
+    segl_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'segl_log_item' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SEGL_LOG_ITEMS \
+    _SEGL_LOGITEM_XMACRO(OK, "Ok") \
+    _SEGL_LOGITEM_XMACRO(PLATFORM_SURFACELESS_NOT_SUPPORTED, "EGL_MESA_platform_surfaceless not supported") \
+    _SEGL_LOGITEM_XMACRO(PLATFORM_DEVICE_NOT_SUPPORTED, "EGL_EXT_platform_device or EGL_EXT_device_enumeration not supported, or no EGL devices found") \
+    _SEGL_LOGITEM_XMACRO(GET_DISPLAY_FAILED, "failed to obtain an EGLDisplay") \
+    _SEGL_LOGITEM_XMACRO(INITIALIZE_FAILED, "eglInitialize() failed") \
+    _SEGL_LOGITEM_XMACRO(BIND_API_FAILED, "eglBindAPI() failed") \
+    _SEGL_LOGITEM_XMACRO(NO_CONFIGS, "eglChooseConfig() returned no configs") \
+    _SEGL_LOGITEM_XMACRO(CREATE_CONTEXT_FAILED, "eglCreateContext() failed") \
+    _SEGL_LOGITEM_XMACRO(CREATE_PBUFFER_SURFACE_FAILED, "eglCreatePbufferSurface() failed") \
+    _SEGL_LOGITEM_XMACRO(MAKE_CURRENT_FAILED, "eglMakeCurrent() failed") \
+    _SEGL_LOGITEM_XMACRO(FRAMEBUFFER_INCOMPLETE, "offscreen framebuffer is incomplete") \
+    _SEGL_LOGITEM_XMACRO(INVALID_DEPTH_FORMAT, "segl_desc.depth_format must be SG_PIXELFORMAT_DEPTH_STENCIL, SG_PIXELFORMAT_DEPTH or SG_PIXELFORMAT_NONE") \
+    _SEGL_LOGITEM_XMACRO(READ_PIXELS_BUFFER_TOO_SMALL, "segl_read_pixels: buffer too small (must be at least width * height * 4 bytes)") \
+
+#define _SEGL_LOGITEM_XMACRO(item,msg) SEGL_LOGITEM_##item,
+typedef enum segl_log_item_t {
+    _SEGL_LOG_ITEMS
+} segl_log_item_t;
+#undef _SEGL_LOGITEM_XMACRO
+
+/*
+    segl_logger
+
+    Used in segl_desc to provide a custom logging and error reporting
+    callback to sokol_egl.h.
+*/
+typedef struct segl_logger {
+    void (*func)(
+        const char* tag,                // always "segl"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SEGL_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_egl.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} segl_logger;
+
+/*
+    Initialization parameters passed into segl_setup(). You should at least
+    provide a logging function, otherwise you won't see any error logging.
+*/
+typedef struct segl_desc {
+    int width;                      // width of the offscreen framebuffer, default: 640
+    int height;                     // height of the offscreen framebuffer, default: 480
+    int sample_count;               // MSAA sample count of the offscreen framebuffer, default: 1
+    sg_pixel_format depth_format;   // SG_PIXELFORMAT_DEPTH_STENCIL (default), SG_PIXELFORMAT_DEPTH or SG_PIXELFORMAT_NONE
+    segl_platform platform;         // default: try surfaceless, device and default display in that order
+    int gl_major_version;           // default: 4 (GLCORE) or 3 (GLES3)
+    int gl_minor_version;           // default: 3 (GLCORE) or 1 (GLES3)
+    segl_logger logger;
+} segl_desc;
+
+// setup EGL display, context and offscreen framebuffer, and make the context current
+SOKOL_EGL_API_DECL void segl_setup(const segl_desc* desc);
+// destroy the offscreen framebuffer, context and display
+SOKOL_EGL_API_DECL void segl_shutdown(void);
+// return true if segl_setup() was successful
+SOKOL_EGL_API_DECL bool segl_isvalid(void);
+// get an sg_environment struct for sg_setup()
+SOKOL_EGL_API_DECL sg_environment segl_environment(void);
+// get an sg_swapchain struct for sg_begin_pass()
+SOKOL_EGL_API_DECL sg_swapchain segl_swapchain(void);
+// change the size of the offscreen framebuffer (must be called outside a sokol_gfx.h pass)
+SOKOL_EGL_API_DECL void segl_resize(int width, int height);
+// read back the offscreen framebuffer as RGBA8 pixels, top row first (must be called outside a sokol_gfx.h pass)
+SOKOL_EGL_API_DECL bool segl_read_pixels(sg_range dst);
+// get the current width of the offscreen framebuffer
+SOKOL_EGL_API_DECL int segl_width(void);
+// get the current height of the offscreen framebuffer
+SOKOL_EGL_API_DECL int segl_height(void);
+// get the EGL platform that was used to obtain the EGLDisplay
+SOKOL_EGL_API_DECL segl_platform segl_query_platform(void);
+// get the EGLDisplay object
+SOKOL_EGL_API_DECL const void* segl_egl_display(void);
+// get the EGLContext object
+SOKOL_EGL_API_DECL const void* segl_egl_context(void);
+
+#ifdef __cplusplus
+} // extern "C"
+inline void segl_setup(const segl_desc& desc) { return segl_setup(&desc); }
+#endif
+#endif // SOKOL_EGL_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_EGL_IMPL
+#define SOKOL_EGL_IMPL_INCLUDED (1)
+
+#if !(defined(SOKOL_GLCORE) || defined(SOKOL_GLES3))
+#error "sokol_egl.h: please define SOKOL_GLCORE or SOKOL_GLES3 for the implementation"
+#endif
+
+#include <stdlib.h> // abort
+#include <string.h> // memset, strstr
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#if defined(SOKOL_GLCORE)
+    #ifndef GL_GLEXT_PROTOTYPES
+    #define GL_GLEXT_PROTOTYPES
+    #endif
+    #include <GL/gl.h>
+#else
+    #include <GLES3/gl3.h>
+#endif
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+
+#ifndef _SOKOL_PRIVATE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define _SOKOL_PRIVATE __attribute__((unused)) static
+    #else
+        #define _SOKOL_PRIVATE static
+    #endif
+#endif
+
+// EGL extension constants which may be missing in older headers
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+#ifndef EGL_PLATFORM_DEVICE_EXT
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#endif
+#ifndef EGL_OPENGL_ES3_BIT
+#define EGL_OPENGL_ES3_BIT 0x00000040
+#endif
+#ifndef EGL_CONTEXT_MAJOR_VERSION
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#endif
+#ifndef EGL_CONTEXT_MINOR_VERSION
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#endif
+#ifndef EGL_CONTEXT_OPENGL_PROFILE_MASK
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#endif
+#ifndef EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x00000001
+#endif
+#ifndef GL_DEPTH_COMPONENT32F
+#define GL_DEPTH_COMPONENT32F 0x8CAC
+#endif
+#ifndef GL_DEPTH24_STENCIL8
+#define GL_DEPTH24_STENCIL8 0x88F0
+#endif
+#ifndef GL_DEPTH_STENCIL_ATTACHMENT
+#define GL_DEPTH_STENCIL_ATTACHMENT 0x821A
+#endif
+
+// extension function pointer types (EGLDeviceEXT is passed as void*)
+typedef EGLDisplay (*_segl_get_platform_display_t)(EGLenum platform, void* native_display, const EGLint* attrib_list);
+typedef EGLBoolean (*_segl_query_devices_t)(EGLint max_devices, void** devices, EGLint* num_devices);
+
+typedef struct {
+    bool valid;
+    segl_desc desc;
+    segl_platform platform;
+    EGLDisplay display;
+    EGLContext context;
+    EGLSurface surface;     // only if EGL_KHR_surfaceless_context isn't supported
+    int width;
+    int height;
+    GLuint fb;              // the 'swapchain' framebuffer
+    GLuint color_rb;
+    GLuint depth_rb;
+    GLuint resolve_fb;      // only with MSAA, used by segl_read_pixels()
+    GLuint resolve_rb;
+} _segl_state_t;
+static _segl_state_t _segl;
+
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SEGL_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _segl_log_messages[] = {
+    _SEGL_LOG_ITEMS
+};
+#undef _SEGL_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SEGL_PANIC(code) _segl_log(SEGL_LOGITEM_ ##code, 0, __LINE__)
+#define _SEGL_ERROR(code) _segl_log(SEGL_LOGITEM_ ##code, 1, __LINE__)
+#define _SEGL_WARN(code) _segl_log(SEGL_LOGITEM_ ##code, 2, __LINE__)
+#define _SEGL_INFO(code) _segl_log(SEGL_LOGITEM_ ##code, 3, __LINE__)
+
+static void _segl_log(segl_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_segl.desc.logger.func) {
+        const char* filename = 0;
+        const char* msg = 0;
+        #if defined(SOKOL_DEBUG)
+            filename = __FILE__;
+            msg = _segl_log_messages[log_item];
+        #endif
+        _segl.desc.logger.func("segl", log_level, (uint32_t)log_item, msg, line_nr, filename, _segl.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// >>misc
+_SOKOL_PRIVATE int _segl_def(int val, int def) {
+    return (val == 0) ? def : val;
+}
+
+_SOKOL_PRIVATE segl_desc _segl_desc_defaults(const segl_desc* desc) {
+    segl_desc res = *desc;
+    res.width = _segl_def(res.width, 640);
+    res.height = _segl_def(res.height, 480);
+    res.sample_count = _segl_def(res.sample_count, 1);
+    if (res.depth_format == _SG_PIXELFORMAT_DEFAULT) {
+        res.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+    }
+    if (0 == res.gl_major_version) {
+        #if defined(SOKOL_GLCORE)
+            res.gl_major_version = 4;
+            res.gl_minor_version = 3;
+        #else
+            res.gl_major_version = 3;
+            res.gl_minor_version = 1;
+        #endif
+    }
+    return res;
+}
+
+_SOKOL_PRIVATE bool _segl_has_extension(const char* extensions, const char* name) {
+    // NOTE: extension names may be prefixes of other extension names
+    if (0 == extensions) {
+        return false;
+    }
+    const size_t len = strlen(name);
+    const char* ptr = extensions;
+    while ((ptr = strstr(ptr, name)) != 0) {
+        const bool at_start = (ptr == extensions) || (ptr[-1] == ' ');
+        const bool at_end = (ptr[len] == ' ') || (ptr[len] == 0);
+        if (at_start && at_end) {
+            return true;
+        }
+        ptr += len;
+    }
+    return false;
+}
+
+// >>display
+_SOKOL_PRIVATE EGLDisplay _segl_get_display(segl_platform platform) {
+    const char* client_exts = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    _segl_get_platform_display_t get_platform_display = 0;
+    if (_segl_has_extension(client_exts, "EGL_EXT_platform_base")) {
+        get_platform_display = (_segl_get_platform_display_t) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    }
+    switch (platform) {
+        case SEGL_PLATFORM_SURFACELESS:
+            if (get_platform_display && _segl_has_extension(client_exts, "EGL_MESA_platform_surfaceless")) {
+                return get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, (void*)EGL_DEFAULT_DISPLAY, 0);
+            }
+            _SEGL_WARN(PLATFORM_SURFACELESS_NOT_SUPPORTED);
+            return EGL_NO_DISPLAY;
+        case SEGL_PLATFORM_DEVICE:
+            if (get_platform_display &&
+                _segl_has_extension(client_exts, "EGL_EXT_platform_device") &&
+                _segl_has_extension(client_exts, "EGL_EXT_device_enumeration"))
+            {
+                _segl_query_devices_t query_devices = (_segl_query_devices_t) eglGetProcAddress("eglQueryDevicesEXT");
+                void* device = 0;
+                EGLint num_devices = 0;
+                if (query_devices && query_devices(1, &device, &num_devices) && (num_devices > 0)) {
+                    return get_platform_display(EGL_PLATFORM_DEVICE_EXT, device, 0);
+                }
+            }
+            _SEGL_WARN(PLATFORM_DEVICE_NOT_SUPPORTED);
+            return EGL_NO_DISPLAY;
+        case SEGL_PLATFORM_DEFAULT_DISPLAY:
+            return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        default:
+            return EGL_NO_DISPLAY;
+    }
+}
+
+// obtain and initialize the EGLDisplay, either for the requested platform, or the first working one
+_SOKOL_PRIVATE bool _segl_init_display(void) {
+    segl_platform first = SEGL_PLATFORM_SURFACELESS;
+    segl_platform last = SEGL_PLATFORM_DEFAULT_DISPLAY;
+    if (_segl.desc.platform != _SEGL_PLATFORM_DEFAULT) {
+        first = last = _segl.desc.platform;
+    }
+    for (int p = (int)first; p <= (int)last; p++) {
+        EGLDisplay display = _segl_get_display((segl_platform)p);
+        if (display == EGL_NO_DISPLAY) {
+            continue;
+        }
+        EGLint major = 0, minor = 0;
+        if (!eglInitialize(display, &major, &minor)) {
+            _SEGL_WARN(INITIALIZE_FAILED);
+            continue;
+        }
+        _segl.display = display;
+        _segl.platform = (segl_platform)p;
+        return true;
+    }
+    _SEGL_ERROR(GET_DISPLAY_FAILED);
+    return false;
+}
+
+// >>context
+_SOKOL_PRIVATE bool _segl_init_context(void) {
+    SOKOL_ASSERT(_segl.display != EGL_NO_DISPLAY);
+    #if defined(SOKOL_GLCORE)
+        const EGLenum api = EGL_OPENGL_API;
+        const EGLint renderable_type = EGL_OPENGL_BIT;
+    #else
+        const EGLenum api = EGL_OPENGL_ES_API;
+        const EGLint renderable_type = EGL_OPENGL_ES3_BIT;
+    #endif
+    if (!eglBindAPI(api)) {
+        _SEGL_ERROR(BIND_API_FAILED);
+        return false;
+    }
+    const char* display_exts = eglQueryString(_segl.display, EGL_EXTENSIONS);
+    const bool surfaceless_context = _segl_has_extension(display_exts, "EGL_KHR_surfaceless_context");
+
+    // NOTE: the config only describes the context, all rendering goes into the
+    // offscreen framebuffer, so no color, depth or MSAA requirements are needed
+    const EGLint config_attrs[] = {
+        EGL_SURFACE_TYPE, surfaceless_context ? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, renderable_type,
+        EGL_NONE,
+    };
+    EGLConfig config = 0;
+    EGLint num_configs = 0;
+    if (!eglChooseConfig(_segl.display, config_attrs, &config, 1, &num_configs) || (num_configs == 0)) {
+        _SEGL_ERROR(NO_CONFIGS);
+        return false;
+    }
+
+    const EGLint ctx_attrs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, _segl.desc.gl_major_version,
+        EGL_CONTEXT_MINOR_VERSION, _segl.desc.gl_minor_version,
+        #if defined(SOKOL_GLCORE)
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        #endif
+        EGL_NONE,
+    };
+    _segl.context = eglCreateContext(_segl.display, config, EGL_NO_CONTEXT, ctx_attrs);
+    if (_segl.context == EGL_NO_CONTEXT) {
+        _SEGL_ERROR(CREATE_CONTEXT_FAILED);
+        return false;
+    }
+    if (!surfaceless_context) {
+        const EGLint pbuffer_attrs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        _segl.surface = eglCreatePbufferSurface(_segl.display, config, pbuffer_attrs);
+        if (_segl.surface == EGL_NO_SURFACE) {
+            _SEGL_ERROR(CREATE_PBUFFER_SURFACE_FAILED);
+            return false;
+        }
+    }
+    if (!eglMakeCurrent(_segl.display, _segl.surface, _segl.surface, _segl.context)) {
+        _SEGL_ERROR(MAKE_CURRENT_FAILED);
+        return false;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void _segl_discard_context(void) {
+    if (_segl.display != EGL_NO_DISPLAY) {
+        eglMakeCurrent(_segl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (_segl.surface != EGL_NO_SURFACE) {
+            eglDestroySurface(_segl.display, _segl.surface);
+            _segl.surface = EGL_NO_SURFACE;
+        }
+        if (_segl.context != EGL_NO_CONTEXT) {
+            eglDestroyContext(_segl.display, _segl.context);
+            _segl.context = EGL_NO_CONTEXT;
+        }
+        eglTerminate(_segl.display);
+        _segl.display = EGL_NO_DISPLAY;
+    }
+}
+
+// >>framebuffer
+_SOKOL_PRIVATE void _segl_renderbuffer_storage(GLenum internal_format, int sample_count, int width, int height) {
+    if (sample_count > 1) {
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, sample_count, internal_format, width, height);
+    } else {
+        glRenderbufferStorage(GL_RENDERBUFFER, internal_format, width, height);
+    }
+}
+
+_SOKOL_PRIVATE bool _segl_create_framebuffer(int width, int height) {
+    SOKOL_ASSERT((0 == _segl.fb) && (width > 0) && (height > 0));
+    _segl.width = width;
+    _segl.height = height;
+    const int sample_count = _segl.desc.sample_count;
+    const sg_pixel_format depth_format = _segl.desc.depth_format;
+
+    glGenFramebuffers(1, &_segl.fb);
+    glBindFramebuffer(GL_FRAMEBUFFER, _segl.fb);
+    glGenRenderbuffers(1, &_segl.color_rb);
+    glBindRenderbuffer(GL_RENDERBUFFER, _segl.color_rb);
+    _segl_renderbuffer_storage(GL_RGBA8, sample_count, width, height);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _segl.color_rb);
+    if (depth_format != SG_PIXELFORMAT_NONE) {
+        const bool stencil = depth_format == SG_PIXELFORMAT_DEPTH_STENCIL;
+        glGenRenderbuffers(1, &_segl.depth_rb);
+        glBindRenderbuffer(GL_RENDERBUFFER, _segl.depth_rb);
+        _segl_renderbuffer_storage(stencil ? GL_DEPTH24_STENCIL8 : GL_DEPTH_COMPONENT32F, sample_count, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, stencil ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _segl.depth_rb);
+    }
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    // with MSAA, segl_read_pixels() needs a resolve framebuffer
+    if (complete && (sample_count > 1)) {
+        glGenFramebuffers(1, &_segl.resolve_fb);
+        glBindFramebuffer(GL_FRAMEBUFFER, _segl.resolve_fb);
+        glGenRenderbuffers(1, &_segl.resolve_rb);
+        glBindRenderbuffer(GL_RENDERBUFFER, _segl.resolve_rb);
+        _segl_renderbuffer_storage(GL_RGBA8, 1, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _segl.resolve_rb);
+        complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    }
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        _SEGL_ERROR(FRAMEBUFFER_INCOMPLETE);
+        return false;
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void _segl_discard_framebuffer(void) {
+    if (_segl.resolve_fb) {
+        glDeleteFramebuffers(1, &_segl.resolve_fb);
+        _segl.resolve_fb = 0;
+    }
+    if (_segl.resolve_rb) {
+        glDeleteRenderbuffers(1, &_segl.resolve_rb);
+        _segl.resolve_rb = 0;
+    }
+    if (_segl.fb) {
+        glDeleteFramebuffers(1, &_segl.fb);
+        _segl.fb = 0;
+    }
+    if (_segl.color_rb) {
+        glDeleteRenderbuffers(1, &_segl.color_rb);
+        _segl.color_rb = 0;
+    }
+    if (_segl.depth_rb) {
+        glDeleteRenderbuffers(1, &_segl.depth_rb);
+        _segl.depth_rb = 0;
+    }
+}
+
+// flip rows in place, GL returns the bottom row first
+_SOKOL_PRIVATE void _segl_flip_rows(uint8_t* pixels, int width, int height) {
+    const size_t pitch = (size_t)width * 4;
+    uint8_t tmp[256];
+    for (int y = 0; y < (height / 2); y++) {
+        uint8_t* top = pixels + (size_t)y * pitch;
+        uint8_t* bottom = pixels + (size_t)(height - 1 - y) * pitch;
+        for (size_t offset = 0; offset < pitch; offset += sizeof(tmp)) {
+            const size_t num_bytes = ((pitch - offset) < sizeof(tmp)) ? (pitch - offset) : sizeof(tmp);
+            memcpy(tmp, top + offset, num_bytes);
+            memcpy(top + offset, bottom + offset, num_bytes);
+            memcpy(bottom + offset, tmp, num_bytes);
+        }
+    }
+}
+
+// >>public
+SOKOL_API_IMPL void segl_setup(const segl_desc* desc) {
+    SOKOL_ASSERT(desc);
+    memset(&_segl, 0, sizeof(_segl));
+    _segl.display = EGL_NO_DISPLAY;
+    _segl.context = EGL_NO_CONTEXT;
+    _segl.surface = EGL_NO_SURFACE;
+    _segl.desc = _segl_desc_defaults(desc);
+    const sg_pixel_format depth_format = _segl.desc.depth_format;
+    if ((depth_format != SG_PIXELFORMAT_DEPTH_STENCIL) && (depth_format != SG_PIXELFORMAT_DEPTH) && (depth_format != SG_PIXELFORMAT_NONE)) {
+        _SEGL_ERROR(INVALID_DEPTH_FORMAT);
+        return;
+    }
+    if (!_segl_init_display() || !_segl_init_context() || !_segl_create_framebuffer(_segl.desc.width, _segl.desc.height)) {
+        _segl_discard_framebuffer();
+        _segl_discard_context();
+        return;
+    }
+    _segl.valid = true;
+}
+
+SOKOL_API_IMPL void segl_shutdown(void) {
+    if (_segl.context != EGL_NO_CONTEXT) {
+        _segl_discard_framebuffer();
+    }
+    _segl_discard_context();
+    _segl.valid = false;
+}
+
+SOKOL_API_IMPL bool segl_isvalid(void) {
+    return _segl.valid;
+}
+
+SOKOL_API_IMPL sg_environment segl_environment(void) {
+    sg_environment res;
+    memset(&res, 0, sizeof(res));
+    res.defaults.color_format = SG_PIXELFORMAT_RGBA8;
+    res.defaults.depth_format = _segl.desc.depth_format;
+    res.defaults.sample_count = _segl.desc.sample_count;
+    return res;
+}
+
+SOKOL_API_IMPL sg_swapchain segl_swapchain(void) {
+    sg_swapchain res;
+    memset(&res, 0, sizeof(res));
+    res.invalid = !_segl.valid;
+    if (res.invalid) {
+        return res;
+    }
+    res.width = _segl.width;
+    res.height = _segl.height;
+    res.sample_count = _segl.desc.sample_count;
+    res.color_format = SG_PIXELFORMAT_RGBA8;
+    res.depth_format = _segl.desc.depth_format;
+    res.gl.framebuffer = _segl.fb;
+    return res;
+}
+
+SOKOL_API_IMPL void segl_resize(int width, int height) {
+    SOKOL_ASSERT((width > 0) && (height > 0));
+    if (!_segl.valid || ((width == _segl.width) && (height == _segl.height))) {
+        return;
+    }
+    _segl_discard_framebuffer();
+    _segl.valid = _segl_create_framebuffer(width, height);
+}
+
+SOKOL_API_IMPL bool segl_read_pixels(sg_range dst) {
+    SOKOL_ASSERT(dst.ptr);
+    if (!_segl.valid) {
+        return false;
+    }
+    if (dst.size < ((size_t)_segl.width * (size_t)_segl.height * 4)) {
+        _SEGL_ERROR(READ_PIXELS_BUFFER_TOO_SMALL);
+        return false;
+    }
+    GLuint read_fb = _segl.fb;
+    if (_segl.resolve_fb) {
+        // NOTE: the MSAA resolve blit is clipped by the scissor test, but the
+        // scissor state belongs to sokol_gfx.h's state cache, so restore it afterwards
+        const GLboolean scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+        if (scissor_test) {
+            glDisable(GL_SCISSOR_TEST);
+        }
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, _segl.fb);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _segl.resolve_fb);
+        glBlitFramebuffer(0, 0, _segl.width, _segl.height, 0, 0, _segl.width, _segl.height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        if (scissor_test) {
+            glEnable(GL_SCISSOR_TEST);
+        }
+        read_fb = _segl.resolve_fb;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, read_fb);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, _segl.width, _segl.height, GL_RGBA, GL_UNSIGNED_BYTE, (void*)dst.ptr);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    _segl_flip_rows((uint8_t*)dst.ptr, _segl.width, _segl.height);
+    return true;
+}
+
+SOKOL_API_IMPL int segl_width(void) {
+    return _segl.width;
+}
+
+SOKOL_API_IMPL int segl_height(void) {
+    return _segl.height;
+}
+
+SOKOL_API_IMPL segl_platform segl_query_platform(void) {
+    return _segl.platform;
+}
+
+SOKOL_API_IMPL const void* segl_egl_display(void) {
+    return (const void*) _segl.display;
+}
+
+SOKOL_API_IMPL const void* segl_egl_context(void) {
+    return (const void*) _segl.context;
+}
+
+#endif // SOKOL_EGL_IMPL
@@ -1704,11 +1704,11 @@ static const uint8_t _sfons_shd_fs_bytecode_spirv_vk[888] = {
     0x20,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,0x21,0x00,0x00,0x00,
     0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
 };
-#elif defined(SOKOL_DUMMY_BACKEND)
+#elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE)
 static const char* _sfons_shd_vs_source_dummy = "";
 static const char* _sfons_shd_fs_source_dummy = "";
 #else
-#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN, SOKOL_SOFTWARE or SOKOL_DUMMY_BACKEND!"
 #endif
 //<#shdgen
 
@@ -1888,11 +1888,11 @@ static const uint8_t _sfb_rgba8_fs_bytecode_spirv_vk[680] = {
     0x17,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,0x18,0x00,0x00,0x00,
     0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
 };
-#elif defined(SOKOL_DUMMY_BACKEND)
+#elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE)
 static const char* _sfb_rgba8_vs_source_dummy = "";
 static const char* _sfb_rgba8_fs_source_dummy = "";
 #else
-#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN, SOKOL_SOFTWARE or SOKOL_DUMMY_BACKEND!"
 #endif
 #if defined(SOKOL_GLCORE)
 static const uint8_t _sfb_palette8_vs_source_glsl410[407] = {
@@ -3269,11 +3269,11 @@ static const uint8_t _sfb_palette8_fs_bytecode_spirv_vk[1060] = {
     0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,
     0x38,0x00,0x01,0x00,
 };
-#elif defined(SOKOL_DUMMY_BACKEND)
+#elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE)
 static const char* _sfb_palette8_vs_source_dummy = "";
 static const char* _sfb_palette8_fs_source_dummy = "";
 #else
-#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN, SOKOL_SOFTWARE or SOKOL_DUMMY_BACKEND!"
 #endif
 #if defined(SOKOL_GLCORE)
 static const uint8_t _sfb_render_vs_source_glsl410[463] = {
@@ -4621,11 +4621,11 @@ static const uint8_t _sfb_render_fs_bytecode_spirv_vk[828] = {
     0x1e,0x00,0x00,0x00,0x1b,0x00,0x00,0x00,0x3e,0x00,0x03,0x00,0x09,0x00,0x00,0x00,
     0x1f,0x00,0x00,0x00,0xfd,0x00,0x01,0x00,0x38,0x00,0x01,0x00,
 };
-#elif defined(SOKOL_DUMMY_BACKEND)
+#elif defined(SOKOL_DUMMY_BACKEND) || defined(SOKOL_SOFTWARE)
 static const char* _sfb_render_vs_source_dummy = "";
 static const char* _sfb_render_fs_source_dummy = "";
 #else
-#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN or SOKOL_DUMMY_BACKEND!"
+#error "Please define one of SOKOL_GLCORE, SOKOL_GLES3, SOKOL_D3D11, SOKOL_METAL, SOKOL_WGPU, SOKOL_VULKAN, SOKOL_SOFTWARE or SOKOL_DUMMY_BACKEND!"
 #endif
 //<#shdgen
 
@@ -123,6 +123,7 @@
         void sgimgui_draw_shader_window_content(void);
         void sgimgui_draw_pipeline_window_content(void);
         void sgimgui_draw_view_window_content(void);
+        void sgimgui_draw_counter_window_content(void);
         void sgimgui_draw_capture_window_content(void);
         void sgimgui_draw_capabilities_window_content(void);
         void sgimgui_draw_frame_stats_window_content(void);
@@ -135,6 +136,7 @@
         void sgimgui_draw_shader_window(const char* title);
         void sgimgui_draw_pipeline_window(const char* title);
         void sgimgui_draw_view_window(const char* title);
+        void sgimgui_draw_counter_window(const char* title);
         void sgimgui_draw_capture_window(const char* title);
         void sgimgui_draw_capabilities_window(const char* title);
         void sgimgui_draw_frame_stats_window(const char* title);
@@ -147,6 +149,7 @@
         void sgimgui_draw_shader_menu_item(const char* label);
         void sgimgui_draw_pipeline_menu_item(const char* label);
         void sgimgui_draw_view_menu_item(const char* label);
+        void sgimgui_draw_counter_menu_item(const char* label);
         void sgimgui_draw_capture_menu_item(const char* label);
         void sgimgui_draw_capabilities_menu_item(const char* label);
         void sgimgui_draw_frame_stats_menu_item(const char* label);
@@ -236,6 +239,7 @@ SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_sampler_window_content(void);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_shader_window_content(void);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_pipeline_window_content(void);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_view_window_content(void);
+SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_counter_window_content(void);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_capture_window_content(void);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_capabilities_window_content(void);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_frame_stats_window_content(void);
@@ -246,6 +250,7 @@ SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_sampler_window(const char* title);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_shader_window(const char* title);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_pipeline_window(const char* title);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_view_window(const char* title);
+SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_counter_window(const char* title);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_capture_window(const char* title);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_capabilities_window(const char* title);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_frame_stats_window(const char* title);
@@ -256,6 +261,7 @@ SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_sampler_menu_item(const char* label);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_shader_menu_item(const char* label);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_pipeline_menu_item(const char* label);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_view_menu_item(const char* label);
+SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_counter_menu_item(const char* label);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_capture_menu_item(const char* label);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_capabilities_menu_item(const char* label);
 SOKOL_GFX_IMGUI_API_DECL void sgimgui_draw_frame_stats_menu_item(const char* label);
@@ -347,6 +353,7 @@ typedef struct {
     _sgimgui_str_t fs_d3d11_target;
     _sgimgui_str_t glsl_texture_sampler_name[SG_MAX_TEXTURE_SAMPLER_PAIRS];
     _sgimgui_str_t glsl_uniform_name[SG_MAX_UNIFORMBLOCK_BINDSLOTS][SG_MAX_UNIFORMBLOCK_MEMBERS];
+    _sgimgui_str_t glsl_block_name[SG_MAX_UNIFORMBLOCK_BINDSLOTS];
     _sgimgui_str_t attr_glsl_name[SG_MAX_VERTEX_ATTRIBUTES];
     _sgimgui_str_t attr_hlsl_sem_name[SG_MAX_VERTEX_ATTRIBUTES];
     sg_shader_desc desc;
@@ -365,6 +372,12 @@ typedef struct {
     sg_view_desc desc;
 } _sgimgui_view_t;
 
+typedef struct {
+    sg_counter res_id;
+    _sgimgui_str_t label;
+    sg_counter_desc desc;
+} _sgimgui_counter_t;
+
 typedef struct {
     bool open;
     sg_buffer sel_buf;
@@ -407,6 +420,13 @@ typedef struct {
     _sgimgui_view_t* slots;
 } _sgimgui_view_window_t;
 
+typedef struct {
+    bool open;
+    sg_counter sel_ctr;
+    int num_slots;
+    _sgimgui_counter_t* slots;
+} _sgimgui_counter_window_t;
+
 typedef enum {
     _SGIMGUI_CMD_INVALID,
     _SGIMGUI_CMD_RESET_STATE_CACHE,
@@ -416,12 +436,14 @@ typedef enum {
     _SGIMGUI_CMD_MAKE_SHADER,
     _SGIMGUI_CMD_MAKE_PIPELINE,
     _SGIMGUI_CMD_MAKE_VIEW,
+    _SGIMGUI_CMD_MAKE_COUNTER,
     _SGIMGUI_CMD_DESTROY_BUFFER,
     _SGIMGUI_CMD_DESTROY_IMAGE,
     _SGIMGUI_CMD_DESTROY_SAMPLER,
     _SGIMGUI_CMD_DESTROY_SHADER,
     _SGIMGUI_CMD_DESTROY_PIPELINE,
     _SGIMGUI_CMD_DESTROY_VIEW,
+    _SGIMGUI_CMD_DESTROY_COUNTER,
     _SGIMGUI_CMD_UPDATE_BUFFER,
     _SGIMGUI_CMD_UPDATE_IMAGE,
     _SGIMGUI_CMD_APPEND_BUFFER,
@@ -431,9 +453,14 @@ typedef enum {
     _SGIMGUI_CMD_APPLY_PIPELINE,
     _SGIMGUI_CMD_APPLY_BINDINGS,
     _SGIMGUI_CMD_APPLY_UNIFORMS,
+    _SGIMGUI_CMD_APPLY_UNIFORM_BUFFER,
     _SGIMGUI_CMD_DRAW,
     _SGIMGUI_CMD_DRAW_EX,
+    _SGIMGUI_CMD_DRAW_BATCH,
     _SGIMGUI_CMD_DISPATCH,
+    _SGIMGUI_CMD_DISPATCH_INDIRECT,
+    _SGIMGUI_CMD_BEGIN_COUNTER,
+    _SGIMGUI_CMD_END_COUNTER,
     _SGIMGUI_CMD_END_PASS,
     _SGIMGUI_CMD_COMMIT,
     _SGIMGUI_CMD_ALLOC_BUFFER,
@@ -442,30 +469,35 @@ typedef enum {
     _SGIMGUI_CMD_ALLOC_SHADER,
     _SGIMGUI_CMD_ALLOC_PIPELINE,
     _SGIMGUI_CMD_ALLOC_VIEW,
+    _SGIMGUI_CMD_ALLOC_COUNTER,
     _SGIMGUI_CMD_DEALLOC_BUFFER,
     _SGIMGUI_CMD_DEALLOC_IMAGE,
     _SGIMGUI_CMD_DEALLOC_SAMPLER,
     _SGIMGUI_CMD_DEALLOC_SHADER,
     _SGIMGUI_CMD_DEALLOC_PIPELINE,
     _SGIMGUI_CMD_DEALLOC_VIEW,
+    _SGIMGUI_CMD_DEALLOC_COUNTER,
     _SGIMGUI_CMD_INIT_BUFFER,
     _SGIMGUI_CMD_INIT_IMAGE,
     _SGIMGUI_CMD_INIT_SAMPLER,
     _SGIMGUI_CMD_INIT_SHADER,
     _SGIMGUI_CMD_INIT_PIPELINE,
     _SGIMGUI_CMD_INIT_VIEW,
+    _SGIMGUI_CMD_INIT_COUNTER,
     _SGIMGUI_CMD_UNINIT_BUFFER,
     _SGIMGUI_CMD_UNINIT_IMAGE,
     _SGIMGUI_CMD_UNINIT_SAMPLER,
     _SGIMGUI_CMD_UNINIT_SHADER,
     _SGIMGUI_CMD_UNINIT_PIPELINE,
     _SGIMGUI_CMD_UNINIT_VIEW,
+    _SGIMGUI_CMD_UNINIT_COUNTER,
     _SGIMGUI_CMD_FAIL_BUFFER,
     _SGIMGUI_CMD_FAIL_IMAGE,
     _SGIMGUI_CMD_FAIL_SAMPLER,
     _SGIMGUI_CMD_FAIL_SHADER,
     _SGIMGUI_CMD_FAIL_PIPELINE,
     _SGIMGUI_CMD_FAIL_VIEW,
+    _SGIMGUI_CMD_FAIL_COUNTER,
     _SGIMGUI_CMD_PUSH_DEBUG_GROUP,
     _SGIMGUI_CMD_POP_DEBUG_GROUP,
 } _sgimgui_cmd_t;
@@ -494,6 +526,10 @@ typedef struct {
     sg_view result;
 } _sgimgui_args_make_view_t;
 
+typedef struct {
+    sg_counter result;
+} _sgimgui_args_make_counter_t;
+
 typedef struct {
     sg_buffer buffer;
 } _sgimgui_args_destroy_buffer_t;
@@ -518,6 +554,10 @@ typedef struct {
     sg_view view;
 } _sgimgui_args_destroy_view_t;
 
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_destroy_counter_t;
+
 typedef struct {
     sg_buffer buffer;
     size_t data_size;
@@ -562,6 +602,12 @@ typedef struct {
     size_t ubuf_pos;        /* start of copied data in capture buffer */
 } _sgimgui_args_apply_uniforms_t;
 
+typedef struct {
+    int ub_slot;
+    sg_buffer buffer;
+    int offset;
+} _sgimgui_args_apply_uniform_buffer_t;
+
 typedef struct {
     int base_element;
     int num_elements;
@@ -576,12 +622,29 @@ typedef struct {
     int base_instance;
 } _sgimgui_args_draw_ex_t;
 
+typedef struct {
+    int count;
+} _sgimgui_args_draw_batch_t;
+
 typedef struct {
     int num_groups_x;
     int num_groups_y;
     int num_groups_z;
 } _sgimgui_args_dispatch_t;
 
+typedef struct {
+    sg_buffer buffer;
+    int offset;
+} _sgimgui_args_dispatch_indirect_t;
+
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_begin_counter_t;
+
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_end_counter_t;
+
 typedef struct {
     sg_buffer result;
 } _sgimgui_args_alloc_buffer_t;
@@ -606,6 +669,10 @@ typedef struct {
     sg_view result;
 } _sgimgui_args_alloc_view_t;
 
+typedef struct {
+    sg_counter result;
+} _sgimgui_args_alloc_counter_t;
+
 typedef struct {
     sg_buffer buffer;
 } _sgimgui_args_dealloc_buffer_t;
@@ -630,6 +697,10 @@ typedef struct {
     sg_view view;
 } _sgimgui_args_dealloc_view_t;
 
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_dealloc_counter_t;
+
 typedef struct {
     sg_buffer buffer;
 } _sgimgui_args_init_buffer_t;
@@ -654,6 +725,10 @@ typedef struct {
     sg_view view;
 } _sgimgui_args_init_view_t;
 
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_init_counter_t;
+
 typedef struct {
     sg_buffer buffer;
 } _sgimgui_args_uninit_buffer_t;
@@ -678,6 +753,10 @@ typedef struct {
     sg_view view;
 } _sgimgui_args_uninit_view_t;
 
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_uninit_counter_t;
+
 typedef struct {
     sg_buffer buffer;
 } _sgimgui_args_fail_buffer_t;
@@ -702,6 +781,10 @@ typedef struct {
     sg_view view;
 } _sgimgui_args_fail_view_t;
 
+typedef struct {
+    sg_counter counter;
+} _sgimgui_args_fail_counter_t;
+
 typedef struct {
     _sgimgui_str_t name;
 } _sgimgui_args_push_debug_group_t;
@@ -713,12 +796,14 @@ typedef union {
     _sgimgui_args_make_shader_t make_shader;
     _sgimgui_args_make_pipeline_t make_pipeline;
     _sgimgui_args_make_view_t make_view;
+    _sgimgui_args_make_counter_t make_counter;
     _sgimgui_args_destroy_buffer_t destroy_buffer;
     _sgimgui_args_destroy_image_t destroy_image;
     _sgimgui_args_destroy_sampler_t destroy_sampler;
     _sgimgui_args_destroy_shader_t destroy_shader;
     _sgimgui_args_destroy_pipeline_t destroy_pipeline;
     _sgimgui_args_destroy_view_t destroy_view;
+    _sgimgui_args_destroy_counter_t destroy_counter;
     _sgimgui_args_update_buffer_t update_buffer;
     _sgimgui_args_update_image_t update_image;
     _sgimgui_args_append_buffer_t append_buffer;
@@ -728,39 +813,49 @@ typedef union {
     _sgimgui_args_apply_pipeline_t apply_pipeline;
     _sgimgui_args_apply_bindings_t apply_bindings;
     _sgimgui_args_apply_uniforms_t apply_uniforms;
+    _sgimgui_args_apply_uniform_buffer_t apply_uniform_buffer;
     _sgimgui_args_draw_t draw;
     _sgimgui_args_draw_ex_t draw_ex;
+    _sgimgui_args_draw_batch_t draw_batch;
     _sgimgui_args_dispatch_t dispatch;
+    _sgimgui_args_dispatch_indirect_t dispatch_indirect;
+    _sgimgui_args_begin_counter_t begin_counter;
+    _sgimgui_args_end_counter_t end_counter;
     _sgimgui_args_alloc_buffer_t alloc_buffer;
     _sgimgui_args_alloc_image_t alloc_image;
     _sgimgui_args_alloc_sampler_t alloc_sampler;
     _sgimgui_args_alloc_shader_t alloc_shader;
     _sgimgui_args_alloc_pipeline_t alloc_pipeline;
     _sgimgui_args_alloc_view_t alloc_view;
+    _sgimgui_args_alloc_counter_t alloc_counter;
     _sgimgui_args_dealloc_buffer_t dealloc_buffer;
     _sgimgui_args_dealloc_image_t dealloc_image;
     _sgimgui_args_dealloc_sampler_t dealloc_sampler;
     _sgimgui_args_dealloc_shader_t dealloc_shader;
     _sgimgui_args_dealloc_pipeline_t dealloc_pipeline;
     _sgimgui_args_dealloc_view_t dealloc_view;
+    _sgimgui_args_dealloc_counter_t dealloc_counter;
     _sgimgui_args_init_buffer_t init_buffer;
     _sgimgui_args_init_image_t init_image;
     _sgimgui_args_init_sampler_t init_sampler;
     _sgimgui_args_init_shader_t init_shader;
     _sgimgui_args_init_pipeline_t init_pipeline;
     _sgimgui_args_init_view_t init_view;
+    _sgimgui_args_init_counter_t init_counter;
     _sgimgui_args_uninit_buffer_t uninit_buffer;
     _sgimgui_args_uninit_image_t uninit_image;
     _sgimgui_args_uninit_sampler_t uninit_sampler;
     _sgimgui_args_uninit_shader_t uninit_shader;
     _sgimgui_args_uninit_pipeline_t uninit_pipeline;
     _sgimgui_args_uninit_view_t uninit_view;
+    _sgimgui_args_uninit_counter_t uninit_counter;
     _sgimgui_args_fail_buffer_t fail_buffer;
     _sgimgui_args_fail_image_t fail_image;
     _sgimgui_args_fail_sampler_t fail_sampler;
     _sgimgui_args_fail_shader_t fail_shader;
     _sgimgui_args_fail_pipeline_t fail_pipeline;
     _sgimgui_args_fail_view_t fail_view;
+    _sgimgui_args_fail_counter_t fail_counter;
     _sgimgui_args_push_debug_group_t push_debug_group;
 } _sgimgui_args_t;
 
@@ -797,7 +892,7 @@ typedef struct {
     bool disable_sokol_imgui_stats;
     bool in_sokol_imgui;
     sg_stats stats;
-    // FIXME: add a ringbuffer for a stats history here
+    sg_stats_history history;   // only valid if sg_desc.stats_history_size > 0
 } _sgimgui_frame_stats_window_t;
 
 typedef struct {
@@ -809,6 +904,7 @@ typedef struct {
     _sgimgui_shader_window_t shader_window;
     _sgimgui_pipeline_window_t pipeline_window;
     _sgimgui_view_window_t view_window;
+    _sgimgui_counter_window_t counter_window;
     _sgimgui_capture_window_t capture_window;
     _sgimgui_caps_window_t caps_window;
     _sgimgui_frame_stats_window_t frame_stats_window;
@@ -1216,6 +1312,7 @@ _SOKOL_PRIVATE const char* _sgimgui_backend_string(sg_backend b) {
         case SG_BACKEND_WGPU:               return "WGPU";
         case SG_BACKEND_VULKAN:             return "VULKAN";
         case SG_BACKEND_DUMMY:              return "DUMMY";
+        case SG_BACKEND_SOFTWARE:           return "SOFTWARE";
         default: return "???";
     }
 }
@@ -1558,6 +1655,14 @@ _SOKOL_PRIVATE const char* _sgimgui_shaderattrbasetype_string(sg_shader_attr_bas
     }
 }
 
+_SOKOL_PRIVATE const char* _sgimgui_countertype_string(sg_counter_type t) {
+    switch (t) {
+        case SG_COUNTERTYPE_OCCLUSION:              return "OCCLUSION";
+        case SG_COUNTERTYPE_PIPELINE_STATISTICS:    return "PIPELINE_STATISTICS";
+        default:                                    return "???";
+    }
+}
+
 _SOKOL_PRIVATE const char* _sgimgui_bool_string(bool b) {
     return b ? "true" : "false";
 }
@@ -1632,6 +1737,15 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_view_id_string(_sgimgui_t* ctx, sg_view v
     }
 }
 
+_SOKOL_PRIVATE _sgimgui_str_t _sgimgui_counter_id_string(_sgimgui_t* ctx, sg_counter ctr_id) {
+    if (ctr_id.id != SG_INVALID_ID) {
+        const _sgimgui_counter_t* ctr_ui = &ctx->counter_window.slots[_sgimgui_slot_index(ctr_id.id)];
+        return _sgimgui_res_id_string(ctr_id.id, ctr_ui->label.buf);
+    } else {
+        return _sgimgui_make_str("<invalid>");
+    }
+}
+
 /*--- RESOURCE HELPERS -------------------------------------------------------*/
 _SOKOL_PRIVATE void _sgimgui_buffer_created(_sgimgui_t* ctx, sg_buffer res_id, int slot_index, const sg_buffer_desc* desc) {
     SOKOL_ASSERT((slot_index > 0) && (slot_index < ctx->buffer_window.num_slots));
@@ -1706,6 +1820,10 @@ _SOKOL_PRIVATE void _sgimgui_shader_created(_sgimgui_t* ctx, sg_shader res_id, i
                 su->glsl_name = shd->glsl_uniform_name[i][j].buf;
             }
         }
+        if (shd->desc.uniform_blocks[i].glsl_block_name) {
+            shd->glsl_block_name[i] = _sgimgui_make_str(shd->desc.uniform_blocks[i].glsl_block_name);
+            shd->desc.uniform_blocks[i].glsl_block_name = shd->glsl_block_name[i].buf;
+        }
     }
     for (int i = 0; i < SG_MAX_TEXTURE_SAMPLER_PAIRS; i++) {
         if (shd->desc.texture_sampler_pairs[i].glsl_name) {
@@ -1790,6 +1908,20 @@ _SOKOL_PRIVATE void _sgimgui_view_destroyed(_sgimgui_t* ctx, int slot_index) {
     view->res_id.id = SG_INVALID_ID;
 }
 
+_SOKOL_PRIVATE void _sgimgui_counter_created(_sgimgui_t* ctx, sg_counter res_id, int slot_index, const sg_counter_desc* desc) {
+    SOKOL_ASSERT((slot_index > 0) && (slot_index < ctx->counter_window.num_slots));
+    _sgimgui_counter_t* ctr = &ctx->counter_window.slots[slot_index];
+    ctr->res_id = res_id;
+    ctr->label = _sgimgui_make_str(desc->label);
+    ctr->desc = *desc;
+}
+
+_SOKOL_PRIVATE void _sgimgui_counter_destroyed(_sgimgui_t* ctx, int slot_index) {
+    SOKOL_ASSERT((slot_index > 0) && (slot_index < ctx->counter_window.num_slots));
+    _sgimgui_counter_t* ctr = &ctx->counter_window.slots[slot_index];
+    ctr->res_id.id = SG_INVALID_ID;
+}
+
 /*--- COMMAND CAPTURING ------------------------------------------------------*/
 _SOKOL_PRIVATE void _sgimgui_capture_init(_sgimgui_t* ctx) {
     const size_t ubuf_initial_size = 256 * 1024;
@@ -1916,6 +2048,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_MAKE_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.make_counter.result);
+                _sgimgui_snprintf(&str, "%d: sg_make_counter(desc=..) => %s", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_DESTROY_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.destroy_buffer.buffer);
@@ -1958,6 +2097,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_DESTROY_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.destroy_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_destroy_counter(ctr=%s)", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_UPDATE_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.update_buffer.buffer);
@@ -2028,6 +2174,17 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
                 item->args.apply_uniforms.data_size);
             break;
 
+        case _SGIMGUI_CMD_APPLY_UNIFORM_BUFFER:
+            {
+                _sgimgui_str_t buf_id = _sgimgui_buffer_id_string(ctx, item->args.apply_uniform_buffer.buffer);
+                _sgimgui_snprintf(&str, "%d: sg_apply_uniform_buffer(ub_slot=%d, buf=%s, offset=%d)",
+                    index,
+                    item->args.apply_uniform_buffer.ub_slot,
+                    buf_id.buf,
+                    item->args.apply_uniform_buffer.offset);
+            }
+            break;
+
         case _SGIMGUI_CMD_DRAW:
             _sgimgui_snprintf(&str, "%d: sg_draw(base_element=%d, num_elements=%d, num_instances=%d)",
                 index,
@@ -2046,6 +2203,12 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
                 item->args.draw_ex.base_instance);
             break;
 
+        case _SGIMGUI_CMD_DRAW_BATCH:
+            _sgimgui_snprintf(&str, "%d: sg_draw_batch(count=%d)",
+                index,
+                item->args.draw_batch.count);
+            break;
+
         case _SGIMGUI_CMD_DISPATCH:
             _sgimgui_snprintf(&str, "%d: sg_dispatch(num_groups_x=%d, num_groups_y=%d, num_groups_z=%d)",
                 index,
@@ -2054,6 +2217,30 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
                 item->args.dispatch.num_groups_z);
             break;
 
+        case _SGIMGUI_CMD_DISPATCH_INDIRECT:
+            {
+                _sgimgui_str_t buf_id = _sgimgui_buffer_id_string(ctx, item->args.dispatch_indirect.buffer);
+                _sgimgui_snprintf(&str, "%d: sg_dispatch_indirect(buf=%s, offset=%d)",
+                    index,
+                    buf_id.buf,
+                    item->args.dispatch_indirect.offset);
+            }
+            break;
+
+        case _SGIMGUI_CMD_BEGIN_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.begin_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_begin_counter(ctr=%s)", index, res_id.buf);
+            }
+            break;
+
+        case _SGIMGUI_CMD_END_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.end_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_end_counter(ctr=%s)", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_END_PASS:
             _sgimgui_snprintf(&str, "%d: sg_end_pass()", index);
             break;
@@ -2104,6 +2291,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_ALLOC_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.alloc_counter.result);
+                _sgimgui_snprintf(&str, "%d: sg_alloc_counter() => %s", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_DEALLOC_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.dealloc_buffer.buffer);
@@ -2146,6 +2340,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_DEALLOC_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.dealloc_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_dealloc_counter(ctr=%s)", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_INIT_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.init_buffer.buffer);
@@ -2188,6 +2389,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_INIT_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.init_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_init_counter(ctr=%s, desc=..)", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_UNINIT_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.uninit_buffer.buffer);
@@ -2230,6 +2438,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_UNINIT_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.uninit_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_uninit_counter(ctr=%s)", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_FAIL_BUFFER:
             {
                 _sgimgui_str_t res_id = _sgimgui_buffer_id_string(ctx, item->args.fail_buffer.buffer);
@@ -2272,6 +2487,13 @@ _SOKOL_PRIVATE _sgimgui_str_t _sgimgui_capture_item_string(_sgimgui_t* ctx, int
             }
             break;
 
+        case _SGIMGUI_CMD_FAIL_COUNTER:
+            {
+                _sgimgui_str_t res_id = _sgimgui_counter_id_string(ctx, item->args.fail_counter.counter);
+                _sgimgui_snprintf(&str, "%d: sg_fail_counter(ctr=%s)", index, res_id.buf);
+            }
+            break;
+
         case _SGIMGUI_CMD_PUSH_DEBUG_GROUP:
             _sgimgui_snprintf(&str, "%d: sg_push_debug_group(name=%s)", index,
                 item->args.push_debug_group.name.buf);
@@ -2404,6 +2626,23 @@ _SOKOL_PRIVATE void _sgimgui_make_view(const sg_view_desc* desc, sg_view view_id
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_make_counter(const sg_counter_desc* desc, sg_counter ctr_id, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_MAKE_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.make_counter.result = ctr_id;
+    }
+    if (ctx->hooks.make_counter) {
+        ctx->hooks.make_counter(desc, ctr_id, ctx->hooks.user_data);
+    }
+    if (ctr_id.id != SG_INVALID_ID) {
+        _sgimgui_counter_created(ctx, ctr_id, _sgimgui_slot_index(ctr_id.id), desc);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_destroy_buffer(sg_buffer buf, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2506,6 +2745,23 @@ _SOKOL_PRIVATE void _sgimgui_destroy_view(sg_view view, void* user_data) {
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_destroy_counter(sg_counter ctr, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_DESTROY_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.destroy_counter.counter = ctr;
+    }
+    if (ctx->hooks.destroy_counter) {
+        ctx->hooks.destroy_counter(ctr, ctx->hooks.user_data);
+    }
+    if (ctr.id != SG_INVALID_ID) {
+        _sgimgui_counter_destroyed(ctx, _sgimgui_slot_index(ctr.id));
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_update_buffer(sg_buffer buf, const sg_range* data, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2651,6 +2907,22 @@ _SOKOL_PRIVATE void _sgimgui_apply_uniforms(int ub_slot, const sg_range* data, v
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_apply_uniform_buffer(int ub_slot, sg_buffer buf, int offset, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_APPLY_UNIFORM_BUFFER;
+        item->color = _SGIMGUI_COLOR_APPLY;
+        item->args.apply_uniform_buffer.ub_slot = ub_slot;
+        item->args.apply_uniform_buffer.buffer = buf;
+        item->args.apply_uniform_buffer.offset = offset;
+    }
+    if (ctx->hooks.apply_uniform_buffer) {
+        ctx->hooks.apply_uniform_buffer(ub_slot, buf, offset, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_draw(int base_element, int num_elements, int num_instances, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2685,6 +2957,20 @@ _SOKOL_PRIVATE void _sgimgui_draw_ex(int base_element, int num_elements, int num
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_draw_batch(const sg_draw_args* args, int count, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*)user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_DRAW_BATCH;
+        item->color = _SGIMGUI_COLOR_DRAW;
+        item->args.draw_batch.count = count;
+    }
+    if (ctx->hooks.draw_batch) {
+        ctx->hooks.draw_batch(args, count, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_dispatch(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2701,6 +2987,49 @@ _SOKOL_PRIVATE void _sgimgui_dispatch(int num_groups_x, int num_groups_y, int nu
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_dispatch_indirect(sg_buffer buf, int offset, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_DISPATCH_INDIRECT;
+        item->color = _SGIMGUI_COLOR_DRAW;
+        item->args.dispatch_indirect.buffer = buf;
+        item->args.dispatch_indirect.offset = offset;
+    }
+    if (ctx->hooks.dispatch_indirect) {
+        ctx->hooks.dispatch_indirect(buf, offset, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgimgui_begin_counter(sg_counter ctr, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_BEGIN_COUNTER;
+        item->color = _SGIMGUI_COLOR_PASS;
+        item->args.begin_counter.counter = ctr;
+    }
+    if (ctx->hooks.begin_counter) {
+        ctx->hooks.begin_counter(ctr, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgimgui_end_counter(sg_counter ctr, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_END_COUNTER;
+        item->color = _SGIMGUI_COLOR_PASS;
+        item->args.end_counter.counter = ctr;
+    }
+    if (ctx->hooks.end_counter) {
+        ctx->hooks.end_counter(ctr, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_end_pass(void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2813,6 +3142,20 @@ _SOKOL_PRIVATE void _sgimgui_alloc_view(sg_view result, void* user_data) {
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_alloc_counter(sg_counter result, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_ALLOC_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.alloc_counter.result = result;
+    }
+    if (ctx->hooks.alloc_counter) {
+        ctx->hooks.alloc_counter(result, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_dealloc_buffer(sg_buffer buf_id, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2897,6 +3240,20 @@ _SOKOL_PRIVATE void _sgimgui_dealloc_view(sg_view view_id, void* user_data) {
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_dealloc_counter(sg_counter ctr_id, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_DEALLOC_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.dealloc_counter.counter = ctr_id;
+    }
+    if (ctx->hooks.dealloc_counter) {
+        ctx->hooks.dealloc_counter(ctr_id, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -2999,6 +3356,23 @@ _SOKOL_PRIVATE void _sgimgui_init_view(sg_view view_id, const sg_view_desc* desc
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_init_counter(sg_counter ctr_id, const sg_counter_desc* desc, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_INIT_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.init_counter.counter = ctr_id;
+    }
+    if (ctx->hooks.init_counter) {
+        ctx->hooks.init_counter(ctr_id, desc, ctx->hooks.user_data);
+    }
+    if (ctr_id.id != SG_INVALID_ID) {
+        _sgimgui_counter_created(ctx, ctr_id, _sgimgui_slot_index(ctr_id.id), desc);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_uninit_buffer(sg_buffer buf, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -3101,6 +3475,23 @@ _SOKOL_PRIVATE void _sgimgui_uninit_view(sg_view view, void* user_data) {
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_uninit_counter(sg_counter ctr, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_UNINIT_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.uninit_counter.counter = ctr;
+    }
+    if (ctx->hooks.uninit_counter) {
+        ctx->hooks.uninit_counter(ctr, ctx->hooks.user_data);
+    }
+    if (ctr.id != SG_INVALID_ID) {
+        _sgimgui_counter_destroyed(ctx, _sgimgui_slot_index(ctr.id));
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_fail_buffer(sg_buffer buf_id, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -3185,6 +3576,20 @@ _SOKOL_PRIVATE void _sgimgui_fail_view(sg_view view_id, void* user_data) {
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_fail_counter(sg_counter ctr_id, void* user_data) {
+    _sgimgui_t* ctx = (_sgimgui_t*) user_data;
+    SOKOL_ASSERT(ctx);
+    _sgimgui_capture_item_t* item = _sgimgui_capture_next_write_item(ctx);
+    if (item) {
+        item->cmd = _SGIMGUI_CMD_FAIL_COUNTER;
+        item->color = _SGIMGUI_COLOR_RSRC;
+        item->args.fail_counter.counter = ctr_id;
+    }
+    if (ctx->hooks.fail_counter) {
+        ctx->hooks.fail_counter(ctr_id, ctx->hooks.user_data);
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_push_debug_group(const char* name, void* user_data) {
     _sgimgui_t* ctx = (_sgimgui_t*) user_data;
     SOKOL_ASSERT(ctx);
@@ -3467,6 +3872,21 @@ _SOKOL_PRIVATE void _sgimgui_draw_view_list(_sgimgui_t* ctx) {
     _sgimgui_igendchild();
 }
 
+_SOKOL_PRIVATE void _sgimgui_draw_counter_list(_sgimgui_t* ctx) {
+    _sgimgui_igbeginchild("counter_list", IMVEC2(_SGIMGUI_LIST_WIDTH,0), true, 0);
+    for (int i = 0; i < ctx->counter_window.num_slots; i++) {
+        sg_counter ctr = ctx->counter_window.slots[i].res_id;
+        sg_resource_state state = sg_query_counter_state(ctr);
+        if ((state != SG_RESOURCESTATE_INVALID) && (state != SG_RESOURCESTATE_INITIAL)) {
+            bool selected = ctx->counter_window.sel_ctr.id == ctr.id;
+            if (_sgimgui_draw_resid_list_item(ctr.id, ctx->counter_window.slots[i].label.buf, selected)) {
+                ctx->counter_window.sel_ctr.id = ctr.id;
+            }
+        }
+    }
+    _sgimgui_igendchild();
+}
+
 _SOKOL_PRIVATE void _sgimgui_draw_capture_list(_sgimgui_t* ctx) {
     _sgimgui_igbeginchild("capture_list", IMVEC2(_SGIMGUI_LIST_WIDTH,0), true, 0);
     const int num_items = _sgimgui_capture_num_read_items(ctx);
@@ -3518,6 +3938,7 @@ _SOKOL_PRIVATE void _sgimgui_draw_buffer_panel(_sgimgui_t* ctx, sg_buffer buf) {
             _sgimgui_igtext("  vertex_buffer: %s", _sgimgui_bool_string(buf_ui->desc.usage.vertex_buffer));
             _sgimgui_igtext("  index_buffer: %s", _sgimgui_bool_string(buf_ui->desc.usage.index_buffer));
             _sgimgui_igtext("  storage_buffer: %s", _sgimgui_bool_string(buf_ui->desc.usage.storage_buffer));
+            _sgimgui_igtext("  uniform_buffer: %s", _sgimgui_bool_string(buf_ui->desc.usage.uniform_buffer));
             _sgimgui_igtext("  immutable: %s", _sgimgui_bool_string(buf_ui->desc.usage.immutable));
             _sgimgui_igtext("  dynamic_update: %s", _sgimgui_bool_string(buf_ui->desc.usage.dynamic_update));
             _sgimgui_igtext("  stream_update: %s", _sgimgui_bool_string(buf_ui->desc.usage.stream_update));
@@ -3705,6 +4126,8 @@ _SOKOL_PRIVATE void _sgimgui_draw_shader_panel(_sgimgui_t* ctx, sg_shader shd) {
                         _sgimgui_igtext("  msl_buffer_n: %d", ub->msl_buffer_n);
                         _sgimgui_igtext("  wgsl_group0_binding_n: %d", ub->wgsl_group0_binding_n);
                         _sgimgui_igtext("  spirv_set0_binding_n: %d", ub->spirv_set0_binding_n);
+                        _sgimgui_igtext("  spirv_push_constant: %s", _sgimgui_bool_string(ub->spirv_push_constant));
+                        _sgimgui_igtext("  glsl_block_name: %s", ub->glsl_block_name ? ub->glsl_block_name : "---");
                         _sgimgui_igtext("  glsl_uniforms:");
                         for (int j = 0; j < SG_MAX_UNIFORMBLOCK_MEMBERS; j++) {
                             const sg_glsl_shader_uniform* u = &ub->glsl_uniforms[j];
@@ -4019,6 +4442,41 @@ _SOKOL_PRIVATE void _sgimgui_draw_view_panel(_sgimgui_t* ctx, sg_view view) {
     }
 }
 
+_SOKOL_PRIVATE void _sgimgui_draw_counter_panel(_sgimgui_t* ctx, sg_counter ctr) {
+    if (ctr.id != SG_INVALID_ID) {
+        _sgimgui_igbeginchild("counter", IMVEC2(0,0), false, 0);
+        sg_counter_info info = sg_query_counter_info(ctr);
+        if (info.slot.state == SG_RESOURCESTATE_VALID) {
+            const _sgimgui_counter_t* ctr_ui = &ctx->counter_window.slots[_sgimgui_slot_index(ctr.id)];
+            _sgimgui_igtext("Label: %s", ctr_ui->label.buf[0] ? ctr_ui->label.buf : "---");
+            _sgimgui_draw_resource_slot(&info.slot);
+            _sgimgui_igseparator();
+            const sg_counter_desc desc = sg_query_counter_desc(ctr);
+            _sgimgui_igtext("Type: %s", _sgimgui_countertype_string(desc.type));
+            _sgimgui_igseparator();
+            const sg_counter_value val = sg_query_counter_value(ctr);
+            if (val.available) {
+                _sgimgui_igtext("Frame Index: %d", val.frame_index);
+                if (desc.type == SG_COUNTERTYPE_OCCLUSION) {
+                    _sgimgui_igtext("Samples Passed: %llu", (unsigned long long)val.samples_passed);
+                } else {
+                    const sg_pipeline_stats* ps = &val.pipeline_stats;
+                    _sgimgui_igtext("Vertex Invocations: %llu", (unsigned long long)ps->vertex_invocations);
+                    _sgimgui_igtext("Fragment Invocations: %llu", (unsigned long long)ps->fragment_invocations);
+                    _sgimgui_igtext("Compute Invocations: %llu", (unsigned long long)ps->compute_invocations);
+                    _sgimgui_igtext("Clipping Input Primitives: %llu", (unsigned long long)ps->clipping_input_primitives);
+                    _sgimgui_igtext("Clipping Output Primitives: %llu", (unsigned long long)ps->clipping_output_primitives);
+                }
+            } else {
+                _sgimgui_igtext("No result available.");
+            }
+        } else {
+            _sgimgui_igtext("Counter 0x%08X not valid.", ctr.id);
+        }
+        _sgimgui_igendchild();
+    }
+}
+
 _SOKOL_PRIVATE void _sgimgui_draw_bindings_panel(_sgimgui_t* ctx, const sg_bindings* bnd) {
     _sgimgui_igpushid("bnd_vbufs");
     for (int i = 0; i < SG_MAX_VERTEXBUFFER_BINDSLOTS; i++) {
@@ -4362,6 +4820,9 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
         case _SGIMGUI_CMD_MAKE_VIEW:
             _sgimgui_draw_view_panel(ctx, item->args.make_view.result);
             break;
+        case _SGIMGUI_CMD_MAKE_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.make_counter.result);
+            break;
         case _SGIMGUI_CMD_DESTROY_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.destroy_buffer.buffer);
             break;
@@ -4380,6 +4841,9 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
         case _SGIMGUI_CMD_DESTROY_VIEW:
             _sgimgui_draw_view_panel(ctx, item->args.destroy_view.view);
             break;
+        case _SGIMGUI_CMD_DESTROY_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.destroy_counter.counter);
+            break;
         case _SGIMGUI_CMD_UPDATE_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.update_buffer.buffer);
             break;
@@ -4406,10 +4870,23 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
             break;
         case _SGIMGUI_CMD_DRAW:
         case _SGIMGUI_CMD_DRAW_EX:
+        case _SGIMGUI_CMD_DRAW_BATCH:
         case _SGIMGUI_CMD_DISPATCH:
         case _SGIMGUI_CMD_END_PASS:
         case _SGIMGUI_CMD_COMMIT:
             break;
+        case _SGIMGUI_CMD_DISPATCH_INDIRECT:
+            _sgimgui_draw_buffer_panel(ctx, item->args.dispatch_indirect.buffer);
+            break;
+        case _SGIMGUI_CMD_BEGIN_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.begin_counter.counter);
+            break;
+        case _SGIMGUI_CMD_END_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.end_counter.counter);
+            break;
+        case _SGIMGUI_CMD_APPLY_UNIFORM_BUFFER:
+            _sgimgui_draw_buffer_panel(ctx, item->args.apply_uniform_buffer.buffer);
+            break;
         case _SGIMGUI_CMD_ALLOC_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.alloc_buffer.result);
             break;
@@ -4428,6 +4905,9 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
         case _SGIMGUI_CMD_ALLOC_VIEW:
             _sgimgui_draw_view_panel(ctx, item->args.alloc_view.result);
             break;
+        case _SGIMGUI_CMD_ALLOC_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.alloc_counter.result);
+            break;
         case _SGIMGUI_CMD_INIT_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.init_buffer.buffer);
             break;
@@ -4446,6 +4926,9 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
         case _SGIMGUI_CMD_INIT_VIEW:
             _sgimgui_draw_view_panel(ctx, item->args.init_view.view);
             break;
+        case _SGIMGUI_CMD_INIT_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.init_counter.counter);
+            break;
         case _SGIMGUI_CMD_FAIL_BUFFER:
             _sgimgui_draw_buffer_panel(ctx, item->args.fail_buffer.buffer);
             break;
@@ -4464,6 +4947,9 @@ _SOKOL_PRIVATE void _sgimgui_draw_capture_panel(_sgimgui_t* ctx) {
         case _SGIMGUI_CMD_FAIL_VIEW:
             _sgimgui_draw_view_panel(ctx, item->args.fail_view.view);
             break;
+        case _SGIMGUI_CMD_FAIL_COUNTER:
+            _sgimgui_draw_counter_panel(ctx, item->args.fail_counter.counter);
+            break;
         default:
             break;
     }
@@ -4487,6 +4973,13 @@ _SOKOL_PRIVATE void _sgimgui_draw_caps_panel(void) {
     _sgimgui_igtext("    dual_source_blending: %s", _sgimgui_bool_string(f.dual_source_blending));
     _sgimgui_igtext("    vertexformat_int10_n2: %s", _sgimgui_bool_string(f.vertexformat_int10_n2));
     _sgimgui_igtext("    gl_texture_views: %s", _sgimgui_bool_string(f.gl_texture_views));
+    _sgimgui_igtext("    gl_multi_bind: %s", _sgimgui_bool_string(f.gl_multi_bind));
+    _sgimgui_igtext("    async_compute: %s", _sgimgui_bool_string(f.async_compute));
+    _sgimgui_igtext("    dispatch_indirect: %s", _sgimgui_bool_string(f.dispatch_indirect));
+    _sgimgui_igtext("    bindless: %s", _sgimgui_bool_string(f.bindless));
+    _sgimgui_igtext("    occlusion_counter: %s", _sgimgui_bool_string(f.occlusion_counter));
+    _sgimgui_igtext("    pipeline_statistics_counter: %s", _sgimgui_bool_string(f.pipeline_statistics_counter));
+    _sgimgui_igtext("    uniform_buffer_bindings: %s", _sgimgui_bool_string(f.uniform_buffer_bindings));
     sg_limits l = sg_query_limits();
     _sgimgui_igtext("\nLimits:\n");
     _sgimgui_igtext("    max_image_size_2d: %d", l.max_image_size_2d);
@@ -4499,6 +4992,7 @@ _SOKOL_PRIVATE void _sgimgui_draw_caps_panel(void) {
     _sgimgui_igtext("    max_texture_bindings_per_stage: %d", l.max_texture_bindings_per_stage);
     _sgimgui_igtext("    max_storage_buffer_bindings_per_stage: %d", l.max_storage_buffer_bindings_per_stage);
     _sgimgui_igtext("    max_storage_image_bindings_per_stage: %d", l.max_storage_image_bindings_per_stage);
+    _sgimgui_igtext("    uniform_buffer_offset_alignment: %d", l.uniform_buffer_offset_alignment);
     _sgimgui_igtext("    gl_max_vertex_uniform_components: %d", l.gl_max_vertex_uniform_components);
     _sgimgui_igtext("    gl_max_combined_texture_image_units: %d", l.gl_max_combined_texture_image_units);
     _sgimgui_igtext("    d3d11_max_unordered_access_views: %d", l.d3d11_max_unordered_access_views);
@@ -4533,40 +5027,134 @@ _SOKOL_PRIVATE void _sgimgui_draw_caps_panel(void) {
     }
 }
 
-_SOKOL_PRIVATE void _sgimgui_frame_add_stats_row(const char* key, uint32_t value) {
+_SOKOL_PRIVATE uint32_t _sgimgui_stats_value(const void* base, size_t offset) {
+    return *(const uint32_t*)((const uint8_t*)base + offset);
+}
+
+// offset is the byte offset of a counter in sg_stats, counters in the prev_frame
+// struct also display the min/avg/percentile/max values from the stats history
+_SOKOL_PRIVATE void _sgimgui_frame_add_stats_row(const _sgimgui_frame_stats_window_t* win, const char* key, size_t offset) {
     _sgimgui_igtablenextrow();
     _sgimgui_igtablesetcolumnindex(0);
     _sgimgui_igtext("%s", key);
     _sgimgui_igtablesetcolumnindex(1);
-    _sgimgui_igtext("%d", value);
+    _sgimgui_igtext("%u", _sgimgui_stats_value(&win->stats, offset));
+    // frame_index is an identifier, not a counter, and has no history values
+    const size_t prev_frame_offset = offsetof(sg_stats, prev_frame);
+    const size_t frame_index_offset = offsetof(sg_stats, prev_frame.frame_index);
+    if ((win->history.num_frames > 0) && (offset != frame_index_offset) && (offset >= prev_frame_offset) && (offset < (prev_frame_offset + sizeof(sg_frame_stats)))) {
+        const size_t hist_offset = offset - prev_frame_offset;
+        const sg_frame_stats* hist_items[6] = {
+            &win->history.min, &win->history.avg, &win->history.p50,
+            &win->history.p95, &win->history.p99, &win->history.max,
+        };
+        for (int i = 0; i < 6; i++) {
+            _sgimgui_igtablesetcolumnindex(2 + i);
+            _sgimgui_igtext("%u", _sgimgui_stats_value(hist_items[i], hist_offset));
+        }
+    }
 }
 
-#define _sgimgui_frame_stats(key) _sgimgui_frame_add_stats_row(#key, stats->key)
+#define _sgimgui_frame_stats(key) _sgimgui_frame_add_stats_row(&ctx->frame_stats_window, #key, offsetof(sg_stats, key))
+
+_SOKOL_PRIVATE void _sgimgui_draw_pass_stats(const sg_frame_pass_stats* pass_stats) {
+    const ImGuiTableFlags flags =
+        ImGuiTableFlags_Resizable |
+        ImGuiTableFlags_SizingFixedFit |
+        ImGuiTableFlags_Borders;
+    if (_sgimgui_igbegintable("#pass_stats_table", 12, flags)) {
+        _sgimgui_igtablesetupcolumn("index", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("label", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("time us", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("pipelines", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("bindings", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("uniforms", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("uniform bytes", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("draws", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("dispatches", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("vs invocations", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("fs invocations", ImGuiTableColumnFlags_None);
+        _sgimgui_igtablesetupcolumn("cs invocations", ImGuiTableColumnFlags_None);
+        _sgimgui_igtableheadersrow();
+        for (int i = 0; i < pass_stats->num_passes; i++) {
+            const sg_pass_stats* ps = &pass_stats->passes[i];
+            _sgimgui_igtablenextrow();
+            _sgimgui_igtablesetcolumnindex(0);
+            _sgimgui_igtext("%u", ps->pass_index);
+            _sgimgui_igtablesetcolumnindex(1);
+            _sgimgui_igtext("%s", ps->label[0] ? ps->label : "-");
+            _sgimgui_igtablesetcolumnindex(2);
+            _sgimgui_igtext("%u", ps->cpu_time_us);
+            _sgimgui_igtablesetcolumnindex(3);
+            _sgimgui_igtext("%u", ps->num_apply_pipeline);
+            _sgimgui_igtablesetcolumnindex(4);
+            _sgimgui_igtext("%u", ps->num_apply_bindings);
+            _sgimgui_igtablesetcolumnindex(5);
+            _sgimgui_igtext("%u", ps->num_apply_uniforms);
+            _sgimgui_igtablesetcolumnindex(6);
+            _sgimgui_igtext("%u", ps->size_apply_uniforms);
+            _sgimgui_igtablesetcolumnindex(7);
+            _sgimgui_igtext("%u", ps->num_draw + ps->num_draw_ex + ps->num_draw_batch_items);
+            _sgimgui_igtablesetcolumnindex(8);
+            _sgimgui_igtext("%u", ps->num_dispatch + ps->num_dispatch_indirect);
+            _sgimgui_igtablesetcolumnindex(9);
+            _sgimgui_igtext("%llu", (unsigned long long)ps->pipeline_stats.vertex_invocations);
+            _sgimgui_igtablesetcolumnindex(10);
+            _sgimgui_igtext("%llu", (unsigned long long)ps->pipeline_stats.fragment_invocations);
+            _sgimgui_igtablesetcolumnindex(11);
+            _sgimgui_igtext("%llu", (unsigned long long)ps->pipeline_stats.compute_invocations);
+        }
+        _sgimgui_igendtable();
+    }
+}
 
 _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(_sgimgui_t* ctx) {
-    _SOKOL_UNUSED(ctx);
     _sgimgui_igcheckbox("Ignore sokol_imgui.h", &ctx->frame_stats_window.disable_sokol_imgui_stats);
-    const sg_stats* stats = &ctx->frame_stats_window.stats;
     const ImGuiTableFlags flags =
         ImGuiTableFlags_Resizable |
         ImGuiTableFlags_ScrollY |
         ImGuiTableFlags_SizingFixedFit |
         ImGuiTableFlags_Borders;
-    if (_sgimgui_igbegintable("#frame_stats_table", 2, flags)) {
+    const bool has_history = ctx->frame_stats_window.history.num_frames > 0;
+    if (has_history) {
+        _sgimgui_igtext("History: %d frames", ctx->frame_stats_window.history.num_frames);
+    }
+    const sg_frame_pass_stats* pass_stats = &ctx->frame_stats_window.stats.prev_frame_passes;
+    if (pass_stats->num_passes > 0) {
+        if (_sgimgui_igtreenode("Passes")) {
+            _sgimgui_draw_pass_stats(pass_stats);
+            _sgimgui_igtreepop();
+        }
+    }
+    if (_sgimgui_igbegintable("#frame_stats_table", has_history ? 8 : 2, flags)) {
         _sgimgui_igtablesetupscrollfreeze(0, 1);
         _sgimgui_igtablesetupcolumn("key", ImGuiTableColumnFlags_None);
         _sgimgui_igtablesetupcolumn("value", ImGuiTableColumnFlags_None);
+        if (has_history) {
+            _sgimgui_igtablesetupcolumn("min", ImGuiTableColumnFlags_None);
+            _sgimgui_igtablesetupcolumn("avg", ImGuiTableColumnFlags_None);
+            _sgimgui_igtablesetupcolumn("p50", ImGuiTableColumnFlags_None);
+            _sgimgui_igtablesetupcolumn("p95", ImGuiTableColumnFlags_None);
+            _sgimgui_igtablesetupcolumn("p99", ImGuiTableColumnFlags_None);
+            _sgimgui_igtablesetupcolumn("max", ImGuiTableColumnFlags_None);
+        }
         _sgimgui_igtableheadersrow();
         _sgimgui_frame_stats(prev_frame.frame_index);
+        _sgimgui_frame_stats(prev_frame.frame_time_us);
         _sgimgui_frame_stats(prev_frame.num_passes);
         _sgimgui_frame_stats(prev_frame.num_apply_viewport);
         _sgimgui_frame_stats(prev_frame.num_apply_scissor_rect);
         _sgimgui_frame_stats(prev_frame.num_apply_pipeline);
         _sgimgui_frame_stats(prev_frame.num_apply_bindings);
         _sgimgui_frame_stats(prev_frame.num_apply_uniforms);
+        _sgimgui_frame_stats(prev_frame.num_apply_uniform_buffer);
         _sgimgui_frame_stats(prev_frame.num_draw);
         _sgimgui_frame_stats(prev_frame.num_draw_ex);
+        _sgimgui_frame_stats(prev_frame.num_draw_batch);
+        _sgimgui_frame_stats(prev_frame.num_draw_batch_items);
         _sgimgui_frame_stats(prev_frame.num_dispatch);
+        _sgimgui_frame_stats(prev_frame.num_dispatch_indirect);
+        _sgimgui_frame_stats(prev_frame.num_skipped_draws);
         _sgimgui_frame_stats(prev_frame.num_update_buffer);
         _sgimgui_frame_stats(prev_frame.num_append_buffer);
         _sgimgui_frame_stats(prev_frame.num_update_image);
@@ -4594,6 +5182,10 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(_sgimgui_t* ctx) {
         _sgimgui_frame_stats(prev_frame.pipelines.deallocated);
         _sgimgui_frame_stats(prev_frame.pipelines.inited);
         _sgimgui_frame_stats(prev_frame.pipelines.uninited);
+        _sgimgui_frame_stats(prev_frame.counters.allocated);
+        _sgimgui_frame_stats(prev_frame.counters.deallocated);
+        _sgimgui_frame_stats(prev_frame.counters.inited);
+        _sgimgui_frame_stats(prev_frame.counters.uninited);
         switch (sg_query_backend()) {
             case SG_BACKEND_GLCORE:
             case SG_BACKEND_GLES3:
@@ -4610,6 +5202,19 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(_sgimgui_t* ctx) {
                 _sgimgui_frame_stats(prev_frame.gl.num_disable_vertex_attrib_array);
                 _sgimgui_frame_stats(prev_frame.gl.num_uniform);
                 _sgimgui_frame_stats(prev_frame.gl.num_memory_barriers);
+                _sgimgui_frame_stats(prev_frame.gl.num_bind_vertex_array);
+                _sgimgui_frame_stats(prev_frame.gl.num_vao_cache_hits);
+                _sgimgui_frame_stats(prev_frame.gl.num_vao_cache_misses);
+                _sgimgui_frame_stats(prev_frame.gl.num_vao_cache_evictions);
+                _sgimgui_frame_stats(prev_frame.gl.num_vao_cache_invalidates);
+                _sgimgui_frame_stats(prev_frame.gl.num_bind_textures);
+                _sgimgui_frame_stats(prev_frame.gl.num_bind_samplers);
+                _sgimgui_frame_stats(prev_frame.gl.num_bind_buffers_range);
+                _sgimgui_frame_stats(prev_frame.gl.num_fence_waits);
+                _sgimgui_frame_stats(prev_frame.gl.fence_wait_time_us);
+                _sgimgui_frame_stats(prev_frame.gl.num_multi_draw);
+                _sgimgui_frame_stats(prev_frame.gl.num_pbo_uploads);
+                _sgimgui_frame_stats(prev_frame.gl.upload_time_us);
                 break;
             case SG_BACKEND_WGPU:
                 _sgimgui_frame_stats(prev_frame.wgpu.uniforms.num_set_bindgroup);
@@ -4710,6 +5315,16 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(_sgimgui_t* ctx) {
                 _sgimgui_frame_stats(prev_frame.vk.num_cmd_copy_buffer_to_image);
                 _sgimgui_frame_stats(prev_frame.vk.num_cmd_set_descriptor_buffer_offsets);
                 _sgimgui_frame_stats(prev_frame.vk.size_descriptor_buffer_writes);
+                _sgimgui_frame_stats(prev_frame.vk.num_cmd_push_constants);
+                _sgimgui_frame_stats(prev_frame.vk.size_push_constants);
+                _sgimgui_frame_stats(prev_frame.vk.num_staging_copy_submits);
+                _sgimgui_frame_stats(prev_frame.vk.num_staging_copy_waits);
+                _sgimgui_frame_stats(prev_frame.vk.size_staging_copy);
+                _sgimgui_frame_stats(prev_frame.vk.staging_copy_time_us);
+                _sgimgui_frame_stats(prev_frame.vk.staging_copy_mbytes_per_sec);
+                _sgimgui_frame_stats(prev_frame.vk.num_async_compute_passes);
+                _sgimgui_frame_stats(prev_frame.vk.num_cmd_buffer_segments);
+                _sgimgui_frame_stats(prev_frame.vk.num_async_compute_waits);
                 break;
             default: break;
         }
@@ -4743,6 +5358,12 @@ _SOKOL_PRIVATE void _sgimgui_draw_frame_stats_panel(_sgimgui_t* ctx) {
         _sgimgui_frame_stats(total.pipelines.deallocated);
         _sgimgui_frame_stats(total.pipelines.inited);
         _sgimgui_frame_stats(total.pipelines.uninited);
+        _sgimgui_frame_stats(total.counters.alive);
+        _sgimgui_frame_stats(total.counters.free);
+        _sgimgui_frame_stats(total.counters.allocated);
+        _sgimgui_frame_stats(total.counters.deallocated);
+        _sgimgui_frame_stats(total.counters.inited);
+        _sgimgui_frame_stats(total.counters.uninited);
         _sgimgui_igendtable();
     }
 }
@@ -4775,12 +5396,14 @@ SOKOL_API_IMPL void sgimgui_setup(const sgimgui_desc_t* desc) {
     hooks.make_shader = _sgimgui_make_shader;
     hooks.make_pipeline = _sgimgui_make_pipeline;
     hooks.make_view = _sgimgui_make_view;
+    hooks.make_counter = _sgimgui_make_counter;
     hooks.destroy_buffer = _sgimgui_destroy_buffer;
     hooks.destroy_image = _sgimgui_destroy_image;
     hooks.destroy_sampler = _sgimgui_destroy_sampler;
     hooks.destroy_shader = _sgimgui_destroy_shader;
     hooks.destroy_pipeline = _sgimgui_destroy_pipeline;
     hooks.destroy_view = _sgimgui_destroy_view;
+    hooks.destroy_counter = _sgimgui_destroy_counter;
     hooks.update_buffer = _sgimgui_update_buffer;
     hooks.update_image = _sgimgui_update_image;
     hooks.append_buffer = _sgimgui_append_buffer;
@@ -4790,9 +5413,14 @@ SOKOL_API_IMPL void sgimgui_setup(const sgimgui_desc_t* desc) {
     hooks.apply_pipeline = _sgimgui_apply_pipeline;
     hooks.apply_bindings = _sgimgui_apply_bindings;
     hooks.apply_uniforms = _sgimgui_apply_uniforms;
+    hooks.apply_uniform_buffer = _sgimgui_apply_uniform_buffer;
     hooks.draw = _sgimgui_draw;
     hooks.draw_ex = _sgimgui_draw_ex;
+    hooks.draw_batch = _sgimgui_draw_batch;
     hooks.dispatch = _sgimgui_dispatch;
+    hooks.dispatch_indirect = _sgimgui_dispatch_indirect;
+    hooks.begin_counter = _sgimgui_begin_counter;
+    hooks.end_counter = _sgimgui_end_counter;
     hooks.end_pass = _sgimgui_end_pass;
     hooks.commit = _sgimgui_commit;
     hooks.alloc_buffer = _sgimgui_alloc_buffer;
@@ -4801,30 +5429,35 @@ SOKOL_API_IMPL void sgimgui_setup(const sgimgui_desc_t* desc) {
     hooks.alloc_shader = _sgimgui_alloc_shader;
     hooks.alloc_pipeline = _sgimgui_alloc_pipeline;
     hooks.alloc_view = _sgimgui_alloc_view;
+    hooks.alloc_counter = _sgimgui_alloc_counter;
     hooks.dealloc_buffer = _sgimgui_dealloc_buffer;
     hooks.dealloc_image = _sgimgui_dealloc_image;
     hooks.dealloc_sampler = _sgimgui_dealloc_sampler;
     hooks.dealloc_shader = _sgimgui_dealloc_shader;
     hooks.dealloc_pipeline = _sgimgui_dealloc_pipeline;
     hooks.dealloc_view = _sgimgui_dealloc_view;
+    hooks.dealloc_counter = _sgimgui_dealloc_counter;
     hooks.init_buffer = _sgimgui_init_buffer;
     hooks.init_image = _sgimgui_init_image;
     hooks.init_sampler = _sgimgui_init_sampler;
     hooks.init_shader = _sgimgui_init_shader;
     hooks.init_pipeline = _sgimgui_init_pipeline;
     hooks.init_view = _sgimgui_init_view;
+    hooks.init_counter = _sgimgui_init_counter;
     hooks.uninit_buffer = _sgimgui_uninit_buffer;
     hooks.uninit_image = _sgimgui_uninit_image;
     hooks.uninit_sampler = _sgimgui_uninit_sampler;
     hooks.uninit_shader = _sgimgui_uninit_shader;
     hooks.uninit_pipeline = _sgimgui_uninit_pipeline;
     hooks.uninit_view = _sgimgui_uninit_view;
+    hooks.uninit_counter = _sgimgui_uninit_counter;
     hooks.fail_buffer = _sgimgui_fail_buffer;
     hooks.fail_image = _sgimgui_fail_image;
     hooks.fail_sampler = _sgimgui_fail_sampler;
     hooks.fail_shader = _sgimgui_fail_shader;
     hooks.fail_pipeline = _sgimgui_fail_pipeline;
     hooks.fail_view = _sgimgui_fail_view;
+    hooks.fail_counter = _sgimgui_fail_counter;
     hooks.push_debug_group = _sgimgui_push_debug_group;
     hooks.pop_debug_group = _sgimgui_pop_debug_group;
     _sgimgui.hooks = sg_install_trace_hooks(&hooks);
@@ -4837,6 +5470,7 @@ SOKOL_API_IMPL void sgimgui_setup(const sgimgui_desc_t* desc) {
     _sgimgui.shader_window.num_slots = sgdesc.shader_pool_size;
     _sgimgui.pipeline_window.num_slots = sgdesc.pipeline_pool_size;
     _sgimgui.view_window.num_slots = sgdesc.view_pool_size;
+    _sgimgui.counter_window.num_slots = sgdesc.counter_pool_size;
 
     const size_t buffer_pool_size = (size_t)_sgimgui.buffer_window.num_slots * sizeof(_sgimgui_buffer_t);
     _sgimgui.buffer_window.slots = (_sgimgui_buffer_t*) _sgimgui_malloc_clear(&_sgimgui.desc.allocator, buffer_pool_size);
@@ -4855,6 +5489,9 @@ SOKOL_API_IMPL void sgimgui_setup(const sgimgui_desc_t* desc) {
 
     const size_t view_pool_size = (size_t)_sgimgui.view_window.num_slots * sizeof(_sgimgui_view_t);
     _sgimgui.view_window.slots = (_sgimgui_view_t*) _sgimgui_malloc_clear(&_sgimgui.desc.allocator, view_pool_size);
+
+    const size_t counter_pool_size = (size_t)_sgimgui.counter_window.num_slots * sizeof(_sgimgui_counter_t);
+    _sgimgui.counter_window.slots = (_sgimgui_counter_t*) _sgimgui_malloc_clear(&_sgimgui.desc.allocator, counter_pool_size);
 }
 
 SOKOL_API_IMPL void sgimgui_shutdown(void) {
@@ -4917,6 +5554,15 @@ SOKOL_API_IMPL void sgimgui_shutdown(void) {
         _sgimgui_free(&_sgimgui.desc.allocator, (void*)_sgimgui.view_window.slots);
         _sgimgui.view_window.slots = 0;
     }
+    if (_sgimgui.counter_window.slots) {
+        for (int i = 0; i < _sgimgui.counter_window.num_slots; i++) {
+            if (_sgimgui.counter_window.slots[i].res_id.id != SG_INVALID_ID) {
+                _sgimgui_counter_destroyed(&_sgimgui, i);
+            }
+        }
+        _sgimgui_free(&_sgimgui.desc.allocator, (void*)_sgimgui.counter_window.slots);
+        _sgimgui.counter_window.slots = 0;
+    }
 }
 
 SOKOL_API_IMPL void sgimgui_draw(void) {
@@ -4926,6 +5572,7 @@ SOKOL_API_IMPL void sgimgui_draw(void) {
     sgimgui_draw_shader_window("[sg] Shaders");
     sgimgui_draw_pipeline_window("[sg] Pipelines");
     sgimgui_draw_view_window("[sg] Views");
+    sgimgui_draw_counter_window("[sg] Counters");
     sgimgui_draw_capture_window("[sg] Frame Capture");
     sgimgui_draw_capabilities_window("[sg] Capabilities");
     sgimgui_draw_frame_stats_window("[sg] Frame Stats");
@@ -4943,6 +5590,7 @@ SOKOL_API_IMPL void sgimgui_draw_menu(const char* title) {
         sgimgui_draw_sampler_menu_item("Samplers");
         sgimgui_draw_shader_menu_item("Shaders");
         sgimgui_draw_pipeline_menu_item("Pipelines");
+        sgimgui_draw_counter_menu_item("Counters");
         sgimgui_draw_capture_menu_item("Calls");
         _sgimgui_igendmenu();
     }
@@ -4984,6 +5632,12 @@ SOKOL_API_IMPL void sgimgui_draw_view_menu_item(const char* label) {
     _sgimgui_igmenuitemboolptr(label, 0, &_sgimgui.view_window.open, true);
 }
 
+SOKOL_API_IMPL void sgimgui_draw_counter_menu_item(const char* label) {
+    SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
+    SOKOL_ASSERT(label);
+    _sgimgui_igmenuitemboolptr(label, 0, &_sgimgui.counter_window.open, true);
+}
+
 SOKOL_API_IMPL void sgimgui_draw_capture_menu_item(const char* label) {
     SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
     SOKOL_ASSERT(label);
@@ -5080,6 +5734,19 @@ SOKOL_API_IMPL void sgimgui_draw_view_window(const char* title) {
     _sgimgui_igend();
 }
 
+SOKOL_API_IMPL void sgimgui_draw_counter_window(const char* title) {
+    SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
+    SOKOL_ASSERT(title);
+    if (!_sgimgui.counter_window.open) {
+        return;
+    }
+    _sgimgui_igsetnextwindowsize(IMVEC2(440, 400), ImGuiCond_Once);
+    if (_sgimgui_igbegin(title, &_sgimgui.counter_window.open, 0)) {
+        sgimgui_draw_counter_window_content();
+    }
+    _sgimgui_igend();
+}
+
 SOKOL_API_IMPL void sgimgui_draw_capture_window(const char* title) {
     SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
     SOKOL_ASSERT(title);
@@ -5161,6 +5828,13 @@ SOKOL_API_IMPL void sgimgui_draw_view_window_content(void) {
     _sgimgui_draw_view_panel(&_sgimgui, _sgimgui.view_window.sel_view);
 }
 
+SOKOL_API_IMPL void sgimgui_draw_counter_window_content(void) {
+    SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
+    _sgimgui_draw_counter_list(&_sgimgui);
+    _sgimgui_igsameline();
+    _sgimgui_draw_counter_panel(&_sgimgui, _sgimgui.counter_window.sel_ctr);
+}
+
 SOKOL_API_IMPL void sgimgui_draw_capture_window_content(void) {
     SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
     _sgimgui_draw_capture_list(&_sgimgui);
@@ -5176,6 +5850,7 @@ SOKOL_API_IMPL void sgimgui_draw_capabilities_window_content(void) {
 SOKOL_API_IMPL void sgimgui_draw_frame_stats_window_content(void) {
     SOKOL_ASSERT(_sgimgui.init_tag == 0xABCDABCD);
     _sgimgui.frame_stats_window.stats = sg_query_stats();
+    _sgimgui.frame_stats_window.history = sg_query_stats_history();
     _sgimgui_draw_frame_stats_panel(&_sgimgui);
 }
 
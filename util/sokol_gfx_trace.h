@@ -0,0 +1,1093 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_GFX_TRACE_IMPL)
+#define SOKOL_GFX_TRACE_IMPL
+#endif
+#ifndef SOKOL_GFX_TRACE_INCLUDED
+/*
+    sokol_gfx_trace.h -- record sokol_gfx.h calls into a Chrome trace / Perfetto capture
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_GFX_TRACE_IMPL
+
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Include the following file(s) before including sokol_gfx_trace.h:
+
+        sokol_gfx.h
+
+    Additionally, include the following header before including the
+    implementation:
+
+        sokol_time.h
+
+    The sokol_gfx.h implementation must be compiled with debug trace hooks
+    enabled by defining:
+
+        SOKOL_TRACE_HOOKS
+
+    ...before including the sokol_gfx.h implementation.
+
+    Before including the sokol_gfx_trace.h implementation, optionally
+    override the following macros:
+
+        SOKOL_ASSERT(c)     -- your own assert macro, default: assert(c)
+        SOKOL_GFX_TRACE_API_DECL - public function declaration prefix (default: extern)
+        SOKOL_API_DECL      - same as SOKOL_GFX_TRACE_API_DECL
+        SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_gfx_trace.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_GFX_TRACE_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    OVERVIEW
+    ========
+    sokol_gfx_trace.h installs sokol-gfx trace hooks which record a timestamp
+    (via stm_now()) for interesting sokol-gfx calls into a preallocated event
+    buffer, and writes the recorded events as Chrome trace JSON on demand.
+    The JSON output can be loaded into https://ui.perfetto.dev or chrome://tracing.
+
+    The following sokol-gfx calls are recorded:
+
+        - sg_begin_pass() / sg_end_pass() as slices, named after sg_pass.label
+        - sg_push_debug_group() / sg_pop_debug_group() as (nested) slices
+        - sg_make_*() and sg_destroy_*() as instant events with the resource id
+          and label as arguments
+        - sg_commit() as global instant event to mark frame boundaries
+
+    Recording an event only involves a handful of stores into the event buffer
+    and a single atomic store to publish the event, no locks are taken and no
+    memory is allocated. When the event buffer is full, new events are
+    dropped (and counted) until the next capture is started.
+
+    All trace hooks which were installed before sgtrace_setup() (for instance
+    by sokol_gfx_imgui.h) keep working, sokol_gfx_trace.h installs a callback
+    for every hook and forwards each call to the previously installed hooks.
+
+    STEP BY STEP
+    ============
+    --- call sgtrace_setup() after sg_setup() and stm_setup():
+
+            sgtrace_setup(&(sgtrace_desc_t){
+                .max_events = ...,  // default: 65536
+            });
+
+    --- start and stop a capture (from the thread which calls sokol-gfx functions,
+        usually outside of a frame):
+
+            sgtrace_start_capture();
+            ...
+            sgtrace_stop_capture();
+
+        Starting a capture discards all previously recorded events.
+
+    --- write the recorded events as Chrome trace JSON into a memory buffer,
+        the function returns the required buffer size (including the zero
+        terminator), so you can call it once with a null pointer to query the
+        required size:
+
+            const size_t size = sgtrace_write_json(0, 0);
+            char* buf = malloc(size);
+            sgtrace_write_json(buf, size);
+
+        sgtrace_write_json() may also be called from another thread while
+        a capture is in progress, it will only see the events which have been
+        published up to that point.
+
+    --- query the number of recorded and dropped events:
+
+            int num_recorded = sgtrace_num_events();
+            int num_dropped = sgtrace_num_dropped_events();
+
+    --- finally call sgtrace_shutdown() before sg_shutdown(), this restores
+        the previously installed trace hooks:
+
+            sgtrace_shutdown();
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_GFX_TRACE_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_gfx_trace.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_GFX_TRACE_API_DECL)
+#define SOKOL_GFX_TRACE_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_GFX_TRACE_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_GFX_TRACE_IMPL)
+#define SOKOL_GFX_TRACE_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_GFX_TRACE_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_GFX_TRACE_API_DECL extern
+#endif
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+    sgtrace_allocator_t
+
+    Used in sgtrace_desc_t to provide custom memory-alloc and -free functions
+    to sokol_gfx_trace.h. If memory management should be overridden, both the
+    alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct sgtrace_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} sgtrace_allocator_t;
+
+/*
+    sgtrace_desc_t
+
+    Initialization options for sgtrace_setup().
+*/
+typedef struct sgtrace_desc_t {
+    int max_events;                 // size of the event buffer (default: 65536)
+    sgtrace_allocator_t allocator;  // optional memory allocation overrides (default: malloc/free)
+} sgtrace_desc_t;
+
+SOKOL_GFX_TRACE_API_DECL void sgtrace_setup(const sgtrace_desc_t* desc);
+SOKOL_GFX_TRACE_API_DECL void sgtrace_shutdown(void);
+SOKOL_GFX_TRACE_API_DECL void sgtrace_start_capture(void);
+SOKOL_GFX_TRACE_API_DECL void sgtrace_stop_capture(void);
+SOKOL_GFX_TRACE_API_DECL bool sgtrace_is_capturing(void);
+SOKOL_GFX_TRACE_API_DECL int sgtrace_num_events(void);
+SOKOL_GFX_TRACE_API_DECL int sgtrace_num_dropped_events(void);
+SOKOL_GFX_TRACE_API_DECL size_t sgtrace_write_json(char* buf, size_t buf_size);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+#endif // SOKOL_GFX_TRACE_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_GFX_TRACE_IMPL
+#define SOKOL_GFX_TRACE_IMPL_INCLUDED (1)
+
+#if !defined(SOKOL_TIME_INCLUDED)
+#error "Please include sokol_time.h before the sokol_gfx_trace.h implementation"
+#endif
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset
+#include <stdio.h>  // snprintf
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_PRIVATE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define _SOKOL_PRIVATE __attribute__((unused)) static
+    #else
+        #define _SOKOL_PRIVATE static
+    #endif
+#endif
+
+// the event counter is the only state shared between the recording and the writing thread
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define _sgtrace_atomic_load(ptr) ((uint32_t)_InterlockedOr((volatile long*)(ptr), 0))
+    #define _sgtrace_atomic_store(ptr, val) _InterlockedExchange((volatile long*)(ptr), (long)(val))
+#else
+    #define _sgtrace_atomic_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define _sgtrace_atomic_store(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#endif
+
+#define _sgtrace_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SGTRACE_DEFAULT_MAX_EVENTS (64 * 1024)
+#define _SGTRACE_LABEL_SIZE (32)
+
+typedef enum {
+    _SGTRACE_EVENTTYPE_BEGIN,   // begin of a slice (pass or debug group)
+    _SGTRACE_EVENTTYPE_END,     // end of a slice
+    _SGTRACE_EVENTTYPE_INSTANT, // resource creation and destruction
+    _SGTRACE_EVENTTYPE_FRAME,   // sg_commit()
+} _sgtrace_event_type_t;
+
+typedef struct {
+    uint64_t time;              // stm_now() timestamp
+    _sgtrace_event_type_t type;
+    uint32_t res_id;
+    const char* name;           // static string, used if label is empty
+    const char* cat;            // static string
+    char label[_SGTRACE_LABEL_SIZE];
+} _sgtrace_event_t;
+
+typedef struct {
+    uint32_t init_tag;
+    sgtrace_desc_t desc;
+    sg_trace_hooks hooks;
+    bool capturing;
+    uint32_t num_events;        // number of published events, accessed via atomic ops
+    uint32_t num_dropped_events;
+    uint32_t max_events;
+    _sgtrace_event_t* events;
+} _sgtrace_t;
+static _sgtrace_t _sgtrace;
+
+// JSON writer state, counts the required size even when buf is too small
+typedef struct {
+    char* buf;
+    size_t size;
+    size_t pos;
+} _sgtrace_writer_t;
+
+_SOKOL_PRIVATE void _sgtrace_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+_SOKOL_PRIVATE void* _sgtrace_malloc(const sgtrace_allocator_t* allocator, size_t size) {
+    SOKOL_ASSERT(allocator && (size > 0));
+    void* ptr;
+    if (allocator->alloc_fn) {
+        ptr = allocator->alloc_fn(size, allocator->user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    SOKOL_ASSERT(ptr);
+    return ptr;
+}
+
+_SOKOL_PRIVATE void _sgtrace_free(const sgtrace_allocator_t* allocator, void* ptr) {
+    SOKOL_ASSERT(allocator);
+    if (allocator->free_fn) {
+        allocator->free_fn(ptr, allocator->user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+/*--- event recording --------------------------------------------------------*/
+_SOKOL_PRIVATE void _sgtrace_record(_sgtrace_event_type_t type, const char* cat, const char* name, const char* label, uint32_t res_id) {
+    if (!_sgtrace.capturing) {
+        return;
+    }
+    // only the recording thread writes num_events, so a plain read is fine here
+    const uint32_t index = _sgtrace.num_events;
+    if (index >= _sgtrace.max_events) {
+        _sgtrace.num_dropped_events++;
+        return;
+    }
+    _sgtrace_event_t* ev = &_sgtrace.events[index];
+    ev->time = stm_now();
+    ev->type = type;
+    ev->res_id = res_id;
+    ev->name = name;
+    ev->cat = cat;
+    int i = 0;
+    if (label) {
+        for (; (i < (_SGTRACE_LABEL_SIZE - 1)) && label[i]; i++) {
+            ev->label[i] = label[i];
+        }
+    }
+    ev->label[i] = 0;
+    // publish the event to sgtrace_write_json()
+    _sgtrace_atomic_store(&_sgtrace.num_events, index + 1);
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_buffer(const sg_buffer_desc* desc, sg_buffer result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_buffer", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_buffer) {
+        ctx->hooks.make_buffer(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_image(const sg_image_desc* desc, sg_image result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_image", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_image) {
+        ctx->hooks.make_image(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_sampler(const sg_sampler_desc* desc, sg_sampler result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_sampler", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_sampler) {
+        ctx->hooks.make_sampler(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_shader(const sg_shader_desc* desc, sg_shader result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_shader", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_shader) {
+        ctx->hooks.make_shader(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_pipeline(const sg_pipeline_desc* desc, sg_pipeline result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_pipeline", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_pipeline) {
+        ctx->hooks.make_pipeline(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_view(const sg_view_desc* desc, sg_view result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_view", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_view) {
+        ctx->hooks.make_view(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_buffer(sg_buffer buf, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_buffer", 0, buf.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_buffer) {
+        ctx->hooks.destroy_buffer(buf, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_image(sg_image img, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_image", 0, img.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_image) {
+        ctx->hooks.destroy_image(img, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_sampler(sg_sampler smp, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_sampler", 0, smp.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_sampler) {
+        ctx->hooks.destroy_sampler(smp, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_shader(sg_shader shd, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_shader", 0, shd.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_shader) {
+        ctx->hooks.destroy_shader(shd, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_pipeline(sg_pipeline pip, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_pipeline", 0, pip.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_pipeline) {
+        ctx->hooks.destroy_pipeline(pip, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_view(sg_view view, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_view", 0, view.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_view) {
+        ctx->hooks.destroy_view(view, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_begin_pass(const sg_pass* pass, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_BEGIN, "pass", pass->compute ? "compute pass" : "render pass", pass->label, 0);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.begin_pass) {
+        ctx->hooks.begin_pass(pass, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_end_pass(void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_END, "pass", 0, 0, 0);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.end_pass) {
+        ctx->hooks.end_pass(ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_commit(void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_FRAME, "frame", "commit", 0, 0);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.commit) {
+        ctx->hooks.commit(ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_push_debug_group(const char* name, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_BEGIN, "debug_group", "debug group", name, 0);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.push_debug_group) {
+        ctx->hooks.push_debug_group(name, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_pop_debug_group(void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_END, "debug_group", 0, 0, 0);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.pop_debug_group) {
+        ctx->hooks.pop_debug_group(ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_make_counter(const sg_counter_desc* desc, sg_counter result, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "make_counter", desc->label, result.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.make_counter) {
+        ctx->hooks.make_counter(desc, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_destroy_counter(sg_counter ctr, void* user_data) {
+    _sgtrace_record(_SGTRACE_EVENTTYPE_INSTANT, "resource", "destroy_counter", 0, ctr.id);
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.destroy_counter) {
+        ctx->hooks.destroy_counter(ctr, ctx->hooks.user_data);
+    }
+}
+
+/*--- forwarded hooks --------------------------------------------------------*/
+_SOKOL_PRIVATE void _sgtrace_reset_state_cache(void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.reset_state_cache) {
+        ctx->hooks.reset_state_cache(ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_update_buffer(sg_buffer buf, const sg_range* data, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.update_buffer) {
+        ctx->hooks.update_buffer(buf, data, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_update_image(sg_image img, const sg_image_data* data, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.update_image) {
+        ctx->hooks.update_image(img, data, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_append_buffer(sg_buffer buf, const sg_range* data, int result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.append_buffer) {
+        ctx->hooks.append_buffer(buf, data, result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_apply_viewport(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.apply_viewport) {
+        ctx->hooks.apply_viewport(x, y, width, height, origin_top_left, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_apply_scissor_rect(int x, int y, int width, int height, bool origin_top_left, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.apply_scissor_rect) {
+        ctx->hooks.apply_scissor_rect(x, y, width, height, origin_top_left, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_apply_pipeline(sg_pipeline pip, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.apply_pipeline) {
+        ctx->hooks.apply_pipeline(pip, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_apply_bindings(const sg_bindings* bindings, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.apply_bindings) {
+        ctx->hooks.apply_bindings(bindings, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_apply_uniforms(int ub_index, const sg_range* data, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.apply_uniforms) {
+        ctx->hooks.apply_uniforms(ub_index, data, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_apply_uniform_buffer(int ub_index, sg_buffer buf, int offset, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.apply_uniform_buffer) {
+        ctx->hooks.apply_uniform_buffer(ub_index, buf, offset, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_draw(int base_element, int num_elements, int num_instances, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.draw) {
+        ctx->hooks.draw(base_element, num_elements, num_instances, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_draw_ex(int base_element, int num_elements, int num_instances, int base_vertex, int base_instance, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.draw_ex) {
+        ctx->hooks.draw_ex(base_element, num_elements, num_instances, base_vertex, base_instance, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_draw_batch(const sg_draw_args* args, int count, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.draw_batch) {
+        ctx->hooks.draw_batch(args, count, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dispatch(int num_groups_x, int num_groups_y, int num_groups_z, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dispatch) {
+        ctx->hooks.dispatch(num_groups_x, num_groups_y, num_groups_z, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dispatch_indirect(sg_buffer buf, int offset, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dispatch_indirect) {
+        ctx->hooks.dispatch_indirect(buf, offset, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_buffer(sg_buffer result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_buffer) {
+        ctx->hooks.alloc_buffer(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_image(sg_image result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_image) {
+        ctx->hooks.alloc_image(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_sampler(sg_sampler result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_sampler) {
+        ctx->hooks.alloc_sampler(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_shader(sg_shader result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_shader) {
+        ctx->hooks.alloc_shader(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_pipeline(sg_pipeline result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_pipeline) {
+        ctx->hooks.alloc_pipeline(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_view(sg_view result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_view) {
+        ctx->hooks.alloc_view(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_buffer(sg_buffer buf_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_buffer) {
+        ctx->hooks.dealloc_buffer(buf_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_image(sg_image img_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_image) {
+        ctx->hooks.dealloc_image(img_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_sampler(sg_sampler smp_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_sampler) {
+        ctx->hooks.dealloc_sampler(smp_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_shader(sg_shader shd_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_shader) {
+        ctx->hooks.dealloc_shader(shd_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_pipeline(sg_pipeline pip_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_pipeline) {
+        ctx->hooks.dealloc_pipeline(pip_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_view(sg_view view_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_view) {
+        ctx->hooks.dealloc_view(view_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_buffer(sg_buffer buf_id, const sg_buffer_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_buffer) {
+        ctx->hooks.init_buffer(buf_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_image(sg_image img_id, const sg_image_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_image) {
+        ctx->hooks.init_image(img_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_sampler(sg_sampler smp_id, const sg_sampler_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_sampler) {
+        ctx->hooks.init_sampler(smp_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_shader(sg_shader shd_id, const sg_shader_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_shader) {
+        ctx->hooks.init_shader(shd_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_pipeline(sg_pipeline pip_id, const sg_pipeline_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_pipeline) {
+        ctx->hooks.init_pipeline(pip_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_view(sg_view view_id, const sg_view_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_view) {
+        ctx->hooks.init_view(view_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_buffer(sg_buffer buf_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_buffer) {
+        ctx->hooks.uninit_buffer(buf_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_image(sg_image img_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_image) {
+        ctx->hooks.uninit_image(img_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_sampler(sg_sampler smp_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_sampler) {
+        ctx->hooks.uninit_sampler(smp_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_shader(sg_shader shd_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_shader) {
+        ctx->hooks.uninit_shader(shd_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_pipeline(sg_pipeline pip_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_pipeline) {
+        ctx->hooks.uninit_pipeline(pip_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_view(sg_view view_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_view) {
+        ctx->hooks.uninit_view(view_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_buffer(sg_buffer buf_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_buffer) {
+        ctx->hooks.fail_buffer(buf_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_image(sg_image img_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_image) {
+        ctx->hooks.fail_image(img_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_sampler(sg_sampler smp_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_sampler) {
+        ctx->hooks.fail_sampler(smp_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_shader(sg_shader shd_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_shader) {
+        ctx->hooks.fail_shader(shd_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_pipeline(sg_pipeline pip_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_pipeline) {
+        ctx->hooks.fail_pipeline(pip_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_view(sg_view view_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_view) {
+        ctx->hooks.fail_view(view_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_begin_counter(sg_counter ctr, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.begin_counter) {
+        ctx->hooks.begin_counter(ctr, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_end_counter(sg_counter ctr, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.end_counter) {
+        ctx->hooks.end_counter(ctr, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_alloc_counter(sg_counter result, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.alloc_counter) {
+        ctx->hooks.alloc_counter(result, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_dealloc_counter(sg_counter ctr_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.dealloc_counter) {
+        ctx->hooks.dealloc_counter(ctr_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_init_counter(sg_counter ctr_id, const sg_counter_desc* desc, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.init_counter) {
+        ctx->hooks.init_counter(ctr_id, desc, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_uninit_counter(sg_counter ctr_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.uninit_counter) {
+        ctx->hooks.uninit_counter(ctr_id, ctx->hooks.user_data);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_fail_counter(sg_counter ctr_id, void* user_data) {
+    _sgtrace_t* ctx = (_sgtrace_t*) user_data;
+    if (ctx->hooks.fail_counter) {
+        ctx->hooks.fail_counter(ctr_id, ctx->hooks.user_data);
+    }
+}
+
+/*--- JSON writer ------------------------------------------------------------*/
+_SOKOL_PRIVATE void _sgtrace_putc(_sgtrace_writer_t* w, char c) {
+    if ((w->pos + 1) < w->size) {
+        w->buf[w->pos] = c;
+    }
+    w->pos++;
+}
+
+_SOKOL_PRIVATE void _sgtrace_puts(_sgtrace_writer_t* w, const char* str) {
+    while (*str) {
+        _sgtrace_putc(w, *str++);
+    }
+}
+
+_SOKOL_PRIVATE void _sgtrace_put_escaped(_sgtrace_writer_t* w, const char* str) {
+    _sgtrace_putc(w, '"');
+    for (; *str; str++) {
+        const char c = *str;
+        if ((c == '"') || (c == '\\')) {
+            _sgtrace_putc(w, '\\');
+            _sgtrace_putc(w, c);
+        } else if ((unsigned char)c < 0x20) {
+            char tmp[8];
+            snprintf(tmp, sizeof(tmp), "\\u%04x", (unsigned int)(unsigned char)c);
+            _sgtrace_puts(w, tmp);
+        } else {
+            _sgtrace_putc(w, c);
+        }
+    }
+    _sgtrace_putc(w, '"');
+}
+
+_SOKOL_PRIVATE void _sgtrace_put_event(_sgtrace_writer_t* w, const char* ph, const char* cat, const char* name, uint64_t time) {
+    char tmp[64];
+    _sgtrace_puts(w, ",\n{\"ph\":\"");
+    _sgtrace_puts(w, ph);
+    _sgtrace_puts(w, "\",\"cat\":\"");
+    _sgtrace_puts(w, cat);
+    _sgtrace_puts(w, "\",\"name\":");
+    _sgtrace_put_escaped(w, name);
+    snprintf(tmp, sizeof(tmp), ",\"ts\":%.3f,\"pid\":0,\"tid\":0", stm_us(time));
+    _sgtrace_puts(w, tmp);
+}
+
+/*--- public API functions ---------------------------------------------------*/
+SOKOL_API_IMPL void sgtrace_setup(const sgtrace_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT(desc->max_events >= 0);
+    _sgtrace_clear(&_sgtrace, sizeof(_sgtrace));
+    _sgtrace.init_tag = 0xABCDABCD;
+    _sgtrace.desc = *desc;
+    _sgtrace.desc.max_events = _sgtrace_def(desc->max_events, _SGTRACE_DEFAULT_MAX_EVENTS);
+    _sgtrace.max_events = (uint32_t)_sgtrace.desc.max_events;
+    const size_t events_size = (size_t)_sgtrace.max_events * sizeof(_sgtrace_event_t);
+    _sgtrace.events = (_sgtrace_event_t*) _sgtrace_malloc(&_sgtrace.desc.allocator, events_size);
+
+    // hook into sokol_gfx functions
+    sg_trace_hooks hooks;
+    _sgtrace_clear(&hooks, sizeof(hooks));
+    hooks.user_data = (void*)&_sgtrace;
+    hooks.reset_state_cache = _sgtrace_reset_state_cache;
+    hooks.make_buffer = _sgtrace_make_buffer;
+    hooks.make_image = _sgtrace_make_image;
+    hooks.make_sampler = _sgtrace_make_sampler;
+    hooks.make_shader = _sgtrace_make_shader;
+    hooks.make_pipeline = _sgtrace_make_pipeline;
+    hooks.make_view = _sgtrace_make_view;
+    hooks.destroy_buffer = _sgtrace_destroy_buffer;
+    hooks.destroy_image = _sgtrace_destroy_image;
+    hooks.destroy_sampler = _sgtrace_destroy_sampler;
+    hooks.destroy_shader = _sgtrace_destroy_shader;
+    hooks.destroy_pipeline = _sgtrace_destroy_pipeline;
+    hooks.destroy_view = _sgtrace_destroy_view;
+    hooks.update_buffer = _sgtrace_update_buffer;
+    hooks.update_image = _sgtrace_update_image;
+    hooks.append_buffer = _sgtrace_append_buffer;
+    hooks.begin_pass = _sgtrace_begin_pass;
+    hooks.apply_viewport = _sgtrace_apply_viewport;
+    hooks.apply_scissor_rect = _sgtrace_apply_scissor_rect;
+    hooks.apply_pipeline = _sgtrace_apply_pipeline;
+    hooks.apply_bindings = _sgtrace_apply_bindings;
+    hooks.apply_uniforms = _sgtrace_apply_uniforms;
+    hooks.apply_uniform_buffer = _sgtrace_apply_uniform_buffer;
+    hooks.draw = _sgtrace_draw;
+    hooks.draw_ex = _sgtrace_draw_ex;
+    hooks.draw_batch = _sgtrace_draw_batch;
+    hooks.dispatch = _sgtrace_dispatch;
+    hooks.dispatch_indirect = _sgtrace_dispatch_indirect;
+    hooks.end_pass = _sgtrace_end_pass;
+    hooks.commit = _sgtrace_commit;
+    hooks.alloc_buffer = _sgtrace_alloc_buffer;
+    hooks.alloc_image = _sgtrace_alloc_image;
+    hooks.alloc_sampler = _sgtrace_alloc_sampler;
+    hooks.alloc_shader = _sgtrace_alloc_shader;
+    hooks.alloc_pipeline = _sgtrace_alloc_pipeline;
+    hooks.alloc_view = _sgtrace_alloc_view;
+    hooks.dealloc_buffer = _sgtrace_dealloc_buffer;
+    hooks.dealloc_image = _sgtrace_dealloc_image;
+    hooks.dealloc_sampler = _sgtrace_dealloc_sampler;
+    hooks.dealloc_shader = _sgtrace_dealloc_shader;
+    hooks.dealloc_pipeline = _sgtrace_dealloc_pipeline;
+    hooks.dealloc_view = _sgtrace_dealloc_view;
+    hooks.init_buffer = _sgtrace_init_buffer;
+    hooks.init_image = _sgtrace_init_image;
+    hooks.init_sampler = _sgtrace_init_sampler;
+    hooks.init_shader = _sgtrace_init_shader;
+    hooks.init_pipeline = _sgtrace_init_pipeline;
+    hooks.init_view = _sgtrace_init_view;
+    hooks.uninit_buffer = _sgtrace_uninit_buffer;
+    hooks.uninit_image = _sgtrace_uninit_image;
+    hooks.uninit_sampler = _sgtrace_uninit_sampler;
+    hooks.uninit_shader = _sgtrace_uninit_shader;
+    hooks.uninit_pipeline = _sgtrace_uninit_pipeline;
+    hooks.uninit_view = _sgtrace_uninit_view;
+    hooks.fail_buffer = _sgtrace_fail_buffer;
+    hooks.fail_image = _sgtrace_fail_image;
+    hooks.fail_sampler = _sgtrace_fail_sampler;
+    hooks.fail_shader = _sgtrace_fail_shader;
+    hooks.fail_pipeline = _sgtrace_fail_pipeline;
+    hooks.fail_view = _sgtrace_fail_view;
+    hooks.push_debug_group = _sgtrace_push_debug_group;
+    hooks.pop_debug_group = _sgtrace_pop_debug_group;
+    hooks.make_counter = _sgtrace_make_counter;
+    hooks.destroy_counter = _sgtrace_destroy_counter;
+    hooks.begin_counter = _sgtrace_begin_counter;
+    hooks.end_counter = _sgtrace_end_counter;
+    hooks.alloc_counter = _sgtrace_alloc_counter;
+    hooks.dealloc_counter = _sgtrace_dealloc_counter;
+    hooks.init_counter = _sgtrace_init_counter;
+    hooks.uninit_counter = _sgtrace_uninit_counter;
+    hooks.fail_counter = _sgtrace_fail_counter;
+    _sgtrace.hooks = sg_install_trace_hooks(&hooks);
+}
+
+SOKOL_API_IMPL void sgtrace_shutdown(void) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    // restore original trace hooks
+    sg_install_trace_hooks(&_sgtrace.hooks);
+    _sgtrace.init_tag = 0;
+    _sgtrace.capturing = false;
+    if (_sgtrace.events) {
+        _sgtrace_free(&_sgtrace.desc.allocator, (void*)_sgtrace.events);
+        _sgtrace.events = 0;
+    }
+}
+
+SOKOL_API_IMPL void sgtrace_start_capture(void) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    _sgtrace_atomic_store(&_sgtrace.num_events, 0);
+    _sgtrace.num_dropped_events = 0;
+    _sgtrace.capturing = true;
+}
+
+SOKOL_API_IMPL void sgtrace_stop_capture(void) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    _sgtrace.capturing = false;
+}
+
+SOKOL_API_IMPL bool sgtrace_is_capturing(void) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    return _sgtrace.capturing;
+}
+
+SOKOL_API_IMPL int sgtrace_num_events(void) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    return (int)_sgtrace_atomic_load(&_sgtrace.num_events);
+}
+
+SOKOL_API_IMPL int sgtrace_num_dropped_events(void) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    return (int)_sgtrace.num_dropped_events;
+}
+
+SOKOL_API_IMPL size_t sgtrace_write_json(char* buf, size_t buf_size) {
+    SOKOL_ASSERT(_sgtrace.init_tag == 0xABCDABCD);
+    SOKOL_ASSERT(buf || (buf_size == 0));
+    _sgtrace_writer_t w;
+    _sgtrace_clear(&w, sizeof(w));
+    w.buf = buf;
+    w.size = buf_size;
+    _sgtrace_puts(&w, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    _sgtrace_puts(&w, "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"sokol_gfx\"}}");
+    const uint32_t num_events = _sgtrace_atomic_load(&_sgtrace.num_events);
+    // keep track of open slices to drop unmatched end events and close unmatched begin events
+    const char* open_cats[64];
+    int depth = 0;
+    uint64_t last_time = 0;
+    for (uint32_t i = 0; i < num_events; i++) {
+        const _sgtrace_event_t* ev = &_sgtrace.events[i];
+        const char* name = ev->label[0] ? ev->label : ev->name;
+        last_time = ev->time;
+        switch (ev->type) {
+            case _SGTRACE_EVENTTYPE_BEGIN:
+                if (depth < 64) {
+                    open_cats[depth] = ev->cat;
+                }
+                depth++;
+                _sgtrace_put_event(&w, "B", ev->cat, name, ev->time);
+                _sgtrace_putc(&w, '}');
+                break;
+            case _SGTRACE_EVENTTYPE_END:
+                if (depth > 0) {
+                    depth--;
+                    _sgtrace_put_event(&w, "E", ev->cat, "", ev->time);
+                    _sgtrace_putc(&w, '}');
+                }
+                break;
+            case _SGTRACE_EVENTTYPE_INSTANT:
+                {
+                    char tmp[32];
+                    _sgtrace_put_event(&w, "i", ev->cat, ev->name, ev->time);
+                    snprintf(tmp, sizeof(tmp), ",\"s\":\"t\",\"args\":{\"id\":%u", ev->res_id);
+                    _sgtrace_puts(&w, tmp);
+                    if (ev->label[0]) {
+                        _sgtrace_puts(&w, ",\"label\":");
+                        _sgtrace_put_escaped(&w, ev->label);
+                    }
+                    _sgtrace_puts(&w, "}}");
+                }
+                break;
+            case _SGTRACE_EVENTTYPE_FRAME:
+                _sgtrace_put_event(&w, "i", ev->cat, ev->name, ev->time);
+                _sgtrace_puts(&w, ",\"s\":\"g\"}");
+                break;
+        }
+    }
+    while (depth > 0) {
+        depth--;
+        _sgtrace_put_event(&w, "E", (depth < 64) ? open_cats[depth] : "pass", "", last_time);
+        _sgtrace_putc(&w, '}');
+    }
+    _sgtrace_puts(&w, "\n]}\n");
+    // zero-terminate, even if the output has been truncated
+    if (w.size > 0) {
+        w.buf[(w.pos < w.size) ? w.pos : (w.size - 1)] = 0;
+    }
+    return w.pos + 1;
+}
+
+#endif // SOKOL_GFX_TRACE_IMPL
@@ -0,0 +1,1361 @@
+#if defined(SOKOL_IMPL) && !defined(SOKOL_RENDERGRAPH_IMPL)
+#define SOKOL_RENDERGRAPH_IMPL
+#endif
+#ifndef SOKOL_RENDERGRAPH_INCLUDED
+/*
+    sokol_rendergraph.h -- a frame render graph with transient attachment aliasing for sokol_gfx.h
+
+    Project URL: https://github.com/floooh/sokol
+
+    Do this:
+        #define SOKOL_IMPL or
+        #define SOKOL_RENDERGRAPH_IMPL
+
+    before you include this file in *one* C or C++ file to create the
+    implementation.
+
+    Include the following file(s) before including sokol_rendergraph.h:
+
+        sokol_gfx.h
+
+    Before including the sokol_rendergraph.h implementation, optionally
+    override the following macros:
+
+        SOKOL_ASSERT(c)     -- your own assert macro, default: assert(c)
+        SOKOL_RENDERGRAPH_API_DECL - public function declaration prefix (default: extern)
+        SOKOL_API_DECL      - same as SOKOL_RENDERGRAPH_API_DECL
+        SOKOL_API_IMPL      - public function implementation prefix (default: -)
+
+    If sokol_rendergraph.h is compiled as a DLL, define the following before
+    including the declaration or implementation:
+
+    SOKOL_DLL
+
+    On Windows, SOKOL_DLL will define SOKOL_RENDERGRAPH_API_DECL as __declspec(dllexport)
+    or __declspec(dllimport) as needed.
+
+    OVERVIEW
+    ========
+    sokol_rendergraph.h takes care of the offscreen render targets which only
+    live for a part of the frame. Instead of creating and managing an sg_image
+    and matching sg_view objects for each render target up front, each frame
+    declares its render passes together with the images each pass renders
+    into and the images each pass samples as textures. From this description
+    the render graph:
+
+        - culls passes which don't contribute to the frame output
+        - orders the remaining passes so that each image is rendered
+          before it is sampled
+        - computes the lifetime of each image (from the first to the last
+          pass which uses the image)
+        - assigns images with compatible attributes and non-overlapping
+          lifetimes to the same physical sg_image from a pool which is
+          kept alive across frames
+        - marks images which are only used as attachments in a single pass
+          and are not loaded via SG_LOADACTION_LOAD with
+          sg_image_usage.transient_attachment
+        - calls sg_begin_pass() / sg_end_pass() in the computed order and
+          invokes a user callback inside each pass to record the draw calls
+        - reports how much memory the aliasing saved compared to creating
+          a separate image for each render target
+
+    Render graph images are 2D images with a single mip level. Only
+    render passes are supported, compute passes and storage images must
+    be recorded outside the render graph.
+
+    STEP BY STEP
+    ============
+    --- call srg_setup() after sg_setup():
+
+            srg_setup(&(srg_desc_t){
+                .max_passes = ...,          // default: 64
+                .max_resources = ...,       // default: 128
+                .max_pool_images = ...,     // default: 64
+                .max_unused_frames = ...,   // default: 60
+                .logger.func = slog_func,
+            });
+
+        The .max_pool_images item defines the maximum number of physical
+        images in the pool, pooled images which were not used for more than
+        .max_unused_frames frames are destroyed.
+
+    --- at the start of each frame, call srg_begin() to start declaring
+        a new render graph:
+
+            srg_begin();
+
+    --- declare the render graph images which only live for the duration of
+        the frame:
+
+            srg_resource gbuf_color = srg_create_image(&(srg_image_desc_t){
+                .width = width,
+                .height = height,
+                .pixel_format = SG_PIXELFORMAT_RGBA16F,
+                .label = "gbuf-color",
+            });
+
+        If not provided, the pixel format and sample count default to
+        sg_desc.environment.defaults.color_format and .sample_count. Use a
+        depth or depth-stencil pixel format for depth-stencil attachments.
+
+    --- alternatively, import external attachment- and texture-views, e.g. for
+        images which must survive the frame, like the history buffer for
+        temporal anti-aliasing:
+
+            srg_resource history = srg_import_image(&(srg_import_desc_t){
+                .attachment = history_att_view,
+                .texture = history_tex_view,
+            });
+
+        Imported images are never aliased, and a pass which renders into an
+        imported image is never culled.
+
+    --- declare the passes of the frame, each pass describes the images it
+        renders into, the images it samples as textures, the sg_pass_action
+        and a callback which records the draw calls of the pass:
+
+            srg_add_pass(&(srg_pass_desc_t){
+                .colors[0] = lighting,
+                .depth_stencil = depth,
+                .reads = { gbuf_color, gbuf_normal },
+                .action = { ... },
+                .execute = draw_lighting,
+                .user_data = state,
+                .label = "lighting",
+            });
+
+        A pass without any attachments is a swapchain pass and renders into
+        the sg_swapchain provided in srg_pass_desc_t.swapchain, swapchain passes
+        are never culled, and neither are passes with srg_pass_desc_t.never_cull
+        set to true.
+
+        Passes don't need to be declared in execution order. All passes which
+        render into an image are executed before any pass which samples the image,
+        and passes which render into the same image are executed in declaration
+        order. A pass cannot sample an image it renders into.
+
+    --- call srg_compile() to cull, order and alias, and srg_execute() to
+        perform the sg_begin_pass() / sg_end_pass() calls:
+
+            if (srg_compile()) {
+                srg_execute();
+            }
+            sg_commit();
+
+        srg_execute() calls srg_compile() if this hasn't happened yet. New pool
+        images are created in srg_compile().
+
+    --- inside the pass callbacks, get the texture view of a render graph image
+        via:
+
+            sg_view srg_texture_view(srg_resource res);
+
+        ...and the image object via:
+
+            sg_image srg_image(srg_resource res);
+
+        Both functions can be called after srg_compile() until the next srg_begin(),
+        note that an aliased image shares the sg_image and sg_view objects with
+        other images of the same frame. Multisampled and transient images have
+        no texture view, use a resolve attachment to sample the content of
+        an MSAA image.
+
+    --- query information about the compiled render graph:
+
+            srg_pass_info_t srg_query_pass_info(srg_pass pass);
+            srg_resource_info_t srg_query_resource_info(srg_resource res);
+            srg_stats_t srg_query_stats(void);
+
+        srg_stats_t.naive_bytes is the size of all render graph images which
+        survived culling if each of them would get its own sg_image, and
+        srg_stats_t.aliased_bytes is the size of the pooled images actually
+        used in the frame.
+
+    --- finally call srg_shutdown() before sg_shutdown(), this destroys all
+        pooled images and views:
+
+            srg_shutdown();
+
+    ERROR REPORTING AND LOGGING
+    ===========================
+    To get any logging information at all you need to provide a logging callback in the setup call,
+    the easiest way is to use sokol_log.h:
+
+        #include "sokol_log.h"
+
+        srg_setup(&(srg_desc_t){
+            // ...
+            .logger.func = slog_func
+        });
+
+    If srg_compile() fails (for instance because of a dependency cycle, or because
+    the image pool is exhausted), an error is logged, srg_compile() returns false
+    and srg_execute() will do nothing until the next srg_begin().
+
+    LICENSE
+    =======
+    zlib/libpng license
+
+    Copyright (c) 2026 Andre Weissflog
+
+    This software is provided 'as-is', without any express or implied warranty.
+    In no event will the authors be held liable for any damages arising from the
+    use of this software.
+
+    Permission is granted to anyone to use this software for any purpose,
+    including commercial applications, and to alter it and redistribute it
+    freely, subject to the following restrictions:
+
+        1. The origin of this software must not be misrepresented; you must not
+        claim that you wrote the original software. If you use this software in a
+        product, an acknowledgment in the product documentation would be
+        appreciated but is not required.
+
+        2. Altered source versions must be plainly marked as such, and must not
+        be misrepresented as being the original software.
+
+        3. This notice may not be removed or altered from any source
+        distribution.
+*/
+#define SOKOL_RENDERGRAPH_INCLUDED (1)
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h> // size_t
+
+#if !defined(SOKOL_GFX_INCLUDED)
+#error "Please include sokol_gfx.h before sokol_rendergraph.h"
+#endif
+
+#if defined(SOKOL_API_DECL) && !defined(SOKOL_RENDERGRAPH_API_DECL)
+#define SOKOL_RENDERGRAPH_API_DECL SOKOL_API_DECL
+#endif
+#ifndef SOKOL_RENDERGRAPH_API_DECL
+#if defined(_WIN32) && defined(SOKOL_DLL) && defined(SOKOL_RENDERGRAPH_IMPL)
+#define SOKOL_RENDERGRAPH_API_DECL __declspec(dllexport)
+#elif defined(_WIN32) && defined(SOKOL_DLL)
+#define SOKOL_RENDERGRAPH_API_DECL __declspec(dllimport)
+#else
+#define SOKOL_RENDERGRAPH_API_DECL extern
+#endif
+#endif
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+enum {
+    SRG_MAX_PASS_READS = 16,
+};
+
+/*
+    srg_log_item_t
+
+    Log items are defined via X-Macros, and expanded to an
+    enum 'srg_log_item_t' - and in debug mode only - corresponding strings.
+
+    Used as parameter in the logging callback.
+*/
+#define _SRG_LOG_ITEMS \
+    _SRG_LOGITEM_XMACRO(OK, "Ok") \
+    _SRG_LOGITEM_XMACRO(MALLOC_FAILED, "memory allocation failed") \
+    _SRG_LOGITEM_XMACRO(TOO_MANY_PASSES, "too many passes in render graph (use srg_desc_t.max_passes to adjust)") \
+    _SRG_LOGITEM_XMACRO(TOO_MANY_RESOURCES, "too many resources in render graph (use srg_desc_t.max_resources to adjust)") \
+    _SRG_LOGITEM_XMACRO(IMAGE_POOL_EXHAUSTED, "render graph image pool exhausted (use srg_desc_t.max_pool_images to adjust)") \
+    _SRG_LOGITEM_XMACRO(INVALID_RESOURCE, "srg_pass_desc_t: invalid or outdated resource handle") \
+    _SRG_LOGITEM_XMACRO(FEEDBACK_LOOP, "srg_pass_desc_t: a pass cannot sample an image it renders into") \
+    _SRG_LOGITEM_XMACRO(RESOURCE_NOT_WRITTEN, "render graph image is sampled but never rendered into") \
+    _SRG_LOGITEM_XMACRO(DEPENDENCY_CYCLE, "render graph contains a dependency cycle") \
+    _SRG_LOGITEM_XMACRO(MAKE_IMAGE_FAILED, "sg_make_image() failed for render graph image") \
+    _SRG_LOGITEM_XMACRO(MAKE_VIEW_FAILED, "sg_make_view() failed for render graph image") \
+
+#define _SRG_LOGITEM_XMACRO(item,msg) SRG_LOGITEM_##item,
+typedef enum srg_log_item_t {
+    _SRG_LOG_ITEMS
+} srg_log_item_t;
+#undef _SRG_LOGITEM_XMACRO
+
+/*
+    srg_logger_t
+
+    Used in srg_desc_t to provide a custom logging and error reporting
+    callback to sokol-rendergraph.
+*/
+typedef struct srg_logger_t {
+    void (*func)(
+        const char* tag,                // always "srg"
+        uint32_t log_level,             // 0=panic, 1=error, 2=warning, 3=info
+        uint32_t log_item_id,           // SRG_LOGITEM_*
+        const char* message_or_null,    // a message string, may be nullptr in release mode
+        uint32_t line_nr,               // line number in sokol_rendergraph.h
+        const char* filename_or_null,   // source filename, may be nullptr in release mode
+        void* user_data);
+    void* user_data;
+} srg_logger_t;
+
+/*
+    srg_allocator_t
+
+    Used in srg_desc_t to provide custom memory-alloc and -free functions
+    to sokol_rendergraph.h. If memory management should be overridden, both the
+    alloc and free function must be provided (e.g. it's not valid to
+    override one function but not the other).
+*/
+typedef struct srg_allocator_t {
+    void* (*alloc_fn)(size_t size, void* user_data);
+    void (*free_fn)(void* ptr, void* user_data);
+    void* user_data;
+} srg_allocator_t;
+
+/* a render graph image handle, only valid until the next srg_begin() */
+typedef struct srg_resource { uint32_t id; } srg_resource;
+
+/* a render graph pass handle, only valid until the next srg_begin() */
+typedef struct srg_pass { uint32_t id; } srg_pass;
+
+/*
+    srg_desc_t
+
+    Initialization options for srg_setup().
+*/
+typedef struct srg_desc_t {
+    int max_passes;             // max number of passes per frame (default: 64)
+    int max_resources;          // max number of images per frame (default: 128)
+    int max_pool_images;        // max number of pooled physical images (default: 64)
+    int max_unused_frames;      // pooled images unused for this many frames are destroyed (default: 60)
+    srg_allocator_t allocator;  // optional memory allocation overrides (default: malloc/free)
+    srg_logger_t logger;        // optional log function override
+} srg_desc_t;
+
+/*
+    srg_image_desc_t
+
+    Describes a render graph image in srg_create_image().
+*/
+typedef struct srg_image_desc_t {
+    int width;
+    int height;
+    sg_pixel_format pixel_format;   // default: sg_desc.environment.defaults.color_format
+    int sample_count;               // default: sg_desc.environment.defaults.sample_count
+    const char* label;
+} srg_image_desc_t;
+
+/*
+    srg_import_desc_t
+
+    Describes an external image in srg_import_image(), the attachment view
+    must be a color- or depth-stencil-attachment view.
+*/
+typedef struct srg_import_desc_t {
+    sg_view attachment;     // color- or depth-stencil-attachment view
+    sg_view resolve;        // optional resolve-attachment view
+    sg_view texture;        // optional texture view
+    const char* label;
+} srg_import_desc_t;
+
+/*
+    srg_pass_desc_t
+
+    Describes a render pass in srg_add_pass().
+*/
+typedef struct srg_pass_desc_t {
+    srg_resource colors[SG_MAX_COLOR_ATTACHMENTS];
+    srg_resource resolves[SG_MAX_COLOR_ATTACHMENTS];
+    srg_resource depth_stencil;
+    srg_resource reads[SRG_MAX_PASS_READS];     // images sampled as textures in the pass
+    sg_pass_action action;
+    sg_swapchain swapchain;                     // used if the pass has no attachments
+    bool never_cull;
+    void (*execute)(void* user_data);           // called between sg_begin_pass() and sg_end_pass()
+    void* user_data;
+    const char* label;
+} srg_pass_desc_t;
+
+/*
+    srg_pass_info_t
+
+    Returned by srg_query_pass_info() after srg_compile().
+*/
+typedef struct srg_pass_info_t {
+    bool culled;
+    int order;              // execution order of the pass, -1 if culled
+} srg_pass_info_t;
+
+/*
+    srg_resource_info_t
+
+    Returned by srg_query_resource_info() after srg_compile(), first_pass
+    and last_pass are execution order indices.
+*/
+typedef struct srg_resource_info_t {
+    bool culled;
+    bool imported;
+    bool transient;         // image created with sg_image_usage.transient_attachment
+    int first_pass;         // -1 if culled
+    int last_pass;          // -1 if culled
+    int pool_index;         // index of the pooled physical image, -1 if culled or imported
+    sg_image image;         // invalid for imported images
+} srg_resource_info_t;
+
+/*
+    srg_stats_t
+
+    Returned by srg_query_stats() after srg_compile().
+*/
+typedef struct srg_stats_t {
+    int num_passes;             // number of declared passes
+    int num_culled_passes;
+    int num_resources;          // number of declared and imported images
+    int num_culled_resources;
+    int num_pool_images;        // number of pooled images used in the frame
+    int num_pool_images_alive;  // number of pooled images which currently exist
+    size_t naive_bytes;         // size of all non-culled render graph images without aliasing
+    size_t aliased_bytes;       // size of the pooled images used in the frame
+    size_t saved_bytes;         // naive_bytes - aliased_bytes
+} srg_stats_t;
+
+SOKOL_RENDERGRAPH_API_DECL void srg_setup(const srg_desc_t* desc);
+SOKOL_RENDERGRAPH_API_DECL void srg_shutdown(void);
+SOKOL_RENDERGRAPH_API_DECL void srg_begin(void);
+SOKOL_RENDERGRAPH_API_DECL srg_resource srg_create_image(const srg_image_desc_t* desc);
+SOKOL_RENDERGRAPH_API_DECL srg_resource srg_import_image(const srg_import_desc_t* desc);
+SOKOL_RENDERGRAPH_API_DECL srg_pass srg_add_pass(const srg_pass_desc_t* desc);
+SOKOL_RENDERGRAPH_API_DECL bool srg_compile(void);
+SOKOL_RENDERGRAPH_API_DECL void srg_execute(void);
+SOKOL_RENDERGRAPH_API_DECL sg_image srg_image(srg_resource res);
+SOKOL_RENDERGRAPH_API_DECL sg_view srg_texture_view(srg_resource res);
+SOKOL_RENDERGRAPH_API_DECL srg_pass_info_t srg_query_pass_info(srg_pass pass);
+SOKOL_RENDERGRAPH_API_DECL srg_resource_info_t srg_query_resource_info(srg_resource res);
+SOKOL_RENDERGRAPH_API_DECL srg_stats_t srg_query_stats(void);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+#endif // SOKOL_RENDERGRAPH_INCLUDED
+
+/*=== IMPLEMENTATION =========================================================*/
+#ifdef SOKOL_RENDERGRAPH_IMPL
+#define SOKOL_RENDERGRAPH_IMPL_INCLUDED (1)
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset
+
+#ifndef SOKOL_API_IMPL
+    #define SOKOL_API_IMPL
+#endif
+#ifndef SOKOL_DEBUG
+    #ifndef NDEBUG
+        #define SOKOL_DEBUG
+    #endif
+#endif
+#ifndef SOKOL_ASSERT
+    #include <assert.h>
+    #define SOKOL_ASSERT(c) assert(c)
+#endif
+#ifndef _SOKOL_PRIVATE
+    #if defined(__GNUC__) || defined(__clang__)
+        #define _SOKOL_PRIVATE __attribute__((unused)) static
+    #else
+        #define _SOKOL_PRIVATE static
+    #endif
+#endif
+
+#define _srg_def(val, def) (((val) == 0) ? (def) : (val))
+#define _SRG_INIT_COOKIE (0xABCDABCD)
+#define _SRG_DEFAULT_MAX_PASSES (64)
+#define _SRG_DEFAULT_MAX_RESOURCES (128)
+#define _SRG_DEFAULT_MAX_POOL_IMAGES (64)
+#define _SRG_DEFAULT_MAX_UNUSED_FRAMES (60)
+// handles are (frame << _SRG_FRAME_SHIFT) | (index + 1), so stale handles from a previous frame are detected
+#define _SRG_FRAME_SHIFT (16)
+#define _SRG_INDEX_MASK ((1 << _SRG_FRAME_SHIFT) - 1)
+// attachment slots of a pass: colors, resolves, depth-stencil
+#define _SRG_NUM_ATTACHMENT_SLOTS (2 * SG_MAX_COLOR_ATTACHMENTS + 1)
+// each attachment slot and read slot adds at most one incoming dependency edge to a pass
+#define _SRG_MAX_PASS_DEPS (_SRG_NUM_ATTACHMENT_SLOTS + SRG_MAX_PASS_READS)
+
+// how a render graph image is used as pass attachment
+typedef enum {
+    _SRG_ATTACHMENT_NONE,
+    _SRG_ATTACHMENT_COLOR,
+    _SRG_ATTACHMENT_RESOLVE,
+    _SRG_ATTACHMENT_DEPTH_STENCIL,
+} _srg_attachment_type_t;
+
+// attributes which must match for two render graph images to share a pooled image
+typedef struct {
+    int width;
+    int height;
+    sg_pixel_format pixel_format;
+    int sample_count;
+    bool transient;
+    bool resolve;           // used as resolve attachment
+} _srg_image_key_t;
+
+typedef struct {
+    _srg_image_key_t key;
+    sg_image img;
+    sg_view att_view;       // color- or depth-stencil-attachment view
+    sg_view resolve_view;   // only for images used as resolve attachment
+    sg_view tex_view;       // only for non-MSAA, non-transient images
+    size_t num_bytes;
+    uint32_t last_used_frame;
+    int busy_until;         // last execution order index in the current frame, -1 if free
+} _srg_pool_image_t;
+
+typedef struct {
+    srg_image_desc_t desc;
+    bool imported;
+    srg_import_desc_t import;
+    bool alive;
+    bool read;              // sampled by at least one alive pass
+    bool written;           // rendered into by at least one declared pass
+    int num_uses;           // number of alive passes which use the image
+    bool load;              // content is loaded by at least one pass
+    bool resolve;           // used as resolve attachment by at least one alive pass
+    int first_pass;
+    int last_pass;
+    int pool_index;
+} _srg_resource_t;
+
+// a scheduling dependency: pass 'to' must be executed after pass 'from'
+typedef struct {
+    int from;
+    int to;
+} _srg_edge_t;
+
+typedef struct {
+    srg_pass_desc_t desc;
+    bool alive;
+    bool scheduled;
+    int order;
+} _srg_pass_t;
+
+typedef struct {
+    uint32_t init_tag;
+    srg_desc_t desc;
+    uint32_t frame;
+    bool compiled;
+    bool valid;
+    int num_passes;
+    int num_resources;
+    int num_scheduled;
+    _srg_pass_t* passes;
+    _srg_resource_t* resources;
+    int* schedule;          // pass indices in execution order
+    int num_edges;
+    _srg_edge_t* edges;     // pass dependencies, rebuilt in srg_compile()
+    int* last_writer;       // per resource, used while building the dependency edges
+    int* succ_start;        // per pass start index into succ, max_passes + 1 items
+    int* succ;              // successor pass indices grouped by pass
+    int* in_degree;         // per pass number of unscheduled predecessors
+    _srg_pool_image_t* pool;
+    srg_stats_t stats;
+} _srg_t;
+static _srg_t _srg;
+
+// ██       ██████   ██████   ██████  ██ ███    ██  ██████
+// ██      ██    ██ ██       ██       ██ ████   ██ ██
+// ██      ██    ██ ██   ███ ██   ███ ██ ██ ██  ██ ██   ███
+// ██      ██    ██ ██    ██ ██    ██ ██ ██  ██ ██ ██    ██
+// ███████  ██████   ██████   ██████  ██ ██   ████  ██████
+//
+// >>logging
+#if defined(SOKOL_DEBUG)
+#define _SRG_LOGITEM_XMACRO(item,msg) #item ": " msg,
+static const char* _srg_log_messages[] = {
+    _SRG_LOG_ITEMS
+};
+#undef _SRG_LOGITEM_XMACRO
+#endif // SOKOL_DEBUG
+
+#define _SRG_PANIC(code) _srg_log(SRG_LOGITEM_ ##code, 0, __LINE__)
+#define _SRG_ERROR(code) _srg_log(SRG_LOGITEM_ ##code, 1, __LINE__)
+#define _SRG_WARN(code) _srg_log(SRG_LOGITEM_ ##code, 2, __LINE__)
+#define _SRG_INFO(code) _srg_log(SRG_LOGITEM_ ##code, 3, __LINE__)
+
+static void _srg_log(srg_log_item_t log_item, uint32_t log_level, uint32_t line_nr) {
+    if (_srg.desc.logger.func) {
+        #if defined(SOKOL_DEBUG)
+            const char* filename = __FILE__;
+            const char* message = _srg_log_messages[log_item];
+        #else
+            const char* filename = 0;
+            const char* message = 0;
+        #endif
+        _srg.desc.logger.func("srg", log_level, (uint32_t)log_item, message, line_nr, filename, _srg.desc.logger.user_data);
+    } else {
+        // for log level PANIC it would be 'undefined behaviour' to continue
+        if (log_level == 0) {
+            abort();
+        }
+    }
+}
+
+// ███    ███ ███████ ███    ███  ██████  ██████  ██    ██
+// ████  ████ ██      ████  ████ ██    ██ ██   ██  ██  ██
+// ██ ████ ██ █████   ██ ████ ██ ██    ██ ██████    ████
+// ██  ██  ██ ██      ██  ██  ██ ██    ██ ██   ██    ██
+// ██      ██ ███████ ██      ██  ██████  ██   ██    ██
+//
+// >>memory
+_SOKOL_PRIVATE void _srg_clear(void* ptr, size_t size) {
+    SOKOL_ASSERT(ptr && (size > 0));
+    memset(ptr, 0, size);
+}
+
+_SOKOL_PRIVATE void* _srg_malloc(size_t size) {
+    SOKOL_ASSERT(size > 0);
+    void* ptr;
+    if (_srg.desc.allocator.alloc_fn) {
+        ptr = _srg.desc.allocator.alloc_fn(size, _srg.desc.allocator.user_data);
+    } else {
+        ptr = malloc(size);
+    }
+    if (0 == ptr) {
+        _SRG_PANIC(MALLOC_FAILED);
+    }
+    return ptr;
+}
+
+_SOKOL_PRIVATE void* _srg_malloc_clear(size_t size) {
+    void* ptr = _srg_malloc(size);
+    _srg_clear(ptr, size);
+    return ptr;
+}
+
+_SOKOL_PRIVATE void _srg_free(void* ptr) {
+    if (_srg.desc.allocator.free_fn) {
+        _srg.desc.allocator.free_fn(ptr, _srg.desc.allocator.user_data);
+    } else {
+        free(ptr);
+    }
+}
+
+// ██   ██  █████  ███    ██ ██████  ██      ███████ ███████
+// ██   ██ ██   ██ ████   ██ ██   ██ ██      ██      ██
+// ███████ ███████ ██ ██  ██ ██   ██ ██      █████   ███████
+// ██   ██ ██   ██ ██  ██ ██ ██   ██ ██      ██           ██
+// ██   ██ ██   ██ ██   ████ ██████  ███████ ███████ ███████
+//
+// >>handles
+_SOKOL_PRIVATE uint32_t _srg_make_id(int index) {
+    return ((_srg.frame & 0xFFFF) << _SRG_FRAME_SHIFT) | (uint32_t)(index + 1);
+}
+
+// returns -1 for invalid or outdated ids
+_SOKOL_PRIVATE int _srg_id_index(uint32_t id, int num) {
+    if ((id >> _SRG_FRAME_SHIFT) != (_srg.frame & 0xFFFF)) {
+        return -1;
+    }
+    const int index = (int)(id & _SRG_INDEX_MASK) - 1;
+    if ((index < 0) || (index >= num)) {
+        return -1;
+    }
+    return index;
+}
+
+_SOKOL_PRIVATE _srg_resource_t* _srg_lookup_resource(srg_resource res) {
+    const int index = _srg_id_index(res.id, _srg.num_resources);
+    return (index >= 0) ? &_srg.resources[index] : 0;
+}
+
+// returns the resource index of a pass attachment slot, or -1 if the slot is empty
+_SOKOL_PRIVATE int _srg_attachment_index(const srg_pass_desc_t* desc, _srg_attachment_type_t type, int slot) {
+    srg_resource res;
+    switch (type) {
+        case _SRG_ATTACHMENT_COLOR: res = desc->colors[slot]; break;
+        case _SRG_ATTACHMENT_RESOLVE: res = desc->resolves[slot]; break;
+        default: res = desc->depth_stencil; break;
+    }
+    if (res.id == 0) {
+        return -1;
+    }
+    return _srg_id_index(res.id, _srg.num_resources);
+}
+
+// returns the resource index of an attachment slot (0.._SRG_NUM_ATTACHMENT_SLOTS-1), or -1 if the slot is empty
+_SOKOL_PRIVATE int _srg_attachment_slot_index(const srg_pass_desc_t* desc, int slot) {
+    if (slot < SG_MAX_COLOR_ATTACHMENTS) {
+        return _srg_attachment_index(desc, _SRG_ATTACHMENT_COLOR, slot);
+    } else if (slot < (2 * SG_MAX_COLOR_ATTACHMENTS)) {
+        return _srg_attachment_index(desc, _SRG_ATTACHMENT_RESOLVE, slot - SG_MAX_COLOR_ATTACHMENTS);
+    } else {
+        return _srg_attachment_index(desc, _SRG_ATTACHMENT_DEPTH_STENCIL, 0);
+    }
+}
+
+_SOKOL_PRIVATE bool _srg_pass_writes(const _srg_pass_t* pass, int res_index) {
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if ((_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_COLOR, i) == res_index) ||
+            (_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_RESOLVE, i) == res_index))
+        {
+            return true;
+        }
+    }
+    return _srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_DEPTH_STENCIL, 0) == res_index;
+}
+
+_SOKOL_PRIVATE bool _srg_pass_reads(const _srg_pass_t* pass, int res_index) {
+    for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+        const srg_resource res = pass->desc.reads[i];
+        if ((res.id != 0) && (_srg_id_index(res.id, _srg.num_resources) == res_index)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+_SOKOL_PRIVATE bool _srg_pass_has_attachments(const _srg_pass_t* pass) {
+    for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        if ((pass->desc.colors[i].id != 0) || (pass->desc.resolves[i].id != 0)) {
+            return true;
+        }
+    }
+    return pass->desc.depth_stencil.id != 0;
+}
+
+// ██████   ██████   ██████  ██
+// ██   ██ ██    ██ ██    ██ ██
+// ██████  ██    ██ ██    ██ ██
+// ██      ██    ██ ██    ██ ██
+// ██       ██████   ██████  ███████
+//
+// >>pool
+_SOKOL_PRIVATE bool _srg_key_equal(const _srg_image_key_t* k0, const _srg_image_key_t* k1) {
+    return (k0->width == k1->width)
+        && (k0->height == k1->height)
+        && (k0->pixel_format == k1->pixel_format)
+        && (k0->sample_count == k1->sample_count)
+        && (k0->transient == k1->transient)
+        && (k0->resolve == k1->resolve);
+}
+
+_SOKOL_PRIVATE void _srg_destroy_pool_image(_srg_pool_image_t* pi) {
+    sg_destroy_view(pi->tex_view);
+    sg_destroy_view(pi->resolve_view);
+    sg_destroy_view(pi->att_view);
+    sg_destroy_image(pi->img);
+    _srg_clear(pi, sizeof(_srg_pool_image_t));
+}
+
+_SOKOL_PRIVATE bool _srg_init_pool_image(_srg_pool_image_t* pi, const _srg_image_key_t* key, const char* label) {
+    SOKOL_ASSERT(pi->img.id == SG_INVALID_ID);
+    const bool is_depth = sg_query_pixelformat(key->pixel_format).depth;
+    sg_image_desc img_desc;
+    _srg_clear(&img_desc, sizeof(img_desc));
+    img_desc.usage.color_attachment = !is_depth;
+    img_desc.usage.resolve_attachment = key->resolve;
+    img_desc.usage.depth_stencil_attachment = is_depth;
+    img_desc.usage.transient_attachment = key->transient;
+    img_desc.width = key->width;
+    img_desc.height = key->height;
+    img_desc.pixel_format = key->pixel_format;
+    img_desc.sample_count = key->sample_count;
+    img_desc.label = label;
+    pi->img = sg_make_image(&img_desc);
+    if (sg_query_image_state(pi->img) != SG_RESOURCESTATE_VALID) {
+        _SRG_ERROR(MAKE_IMAGE_FAILED);
+        _srg_destroy_pool_image(pi);
+        return false;
+    }
+    sg_view_desc view_desc;
+    _srg_clear(&view_desc, sizeof(view_desc));
+    if (is_depth) {
+        view_desc.depth_stencil_attachment.image = pi->img;
+    } else {
+        view_desc.color_attachment.image = pi->img;
+    }
+    view_desc.label = label;
+    pi->att_view = sg_make_view(&view_desc);
+    bool ok = sg_query_view_state(pi->att_view) == SG_RESOURCESTATE_VALID;
+    if (ok && img_desc.usage.resolve_attachment) {
+        _srg_clear(&view_desc, sizeof(view_desc));
+        view_desc.resolve_attachment.image = pi->img;
+        view_desc.label = label;
+        pi->resolve_view = sg_make_view(&view_desc);
+        ok = sg_query_view_state(pi->resolve_view) == SG_RESOURCESTATE_VALID;
+    }
+    if (ok && !key->transient && (key->sample_count == 1)) {
+        _srg_clear(&view_desc, sizeof(view_desc));
+        view_desc.texture.image = pi->img;
+        view_desc.label = label;
+        pi->tex_view = sg_make_view(&view_desc);
+        ok = sg_query_view_state(pi->tex_view) == SG_RESOURCESTATE_VALID;
+    }
+    if (!ok) {
+        _SRG_ERROR(MAKE_VIEW_FAILED);
+        _srg_destroy_pool_image(pi);
+        return false;
+    }
+    pi->key = *key;
+    pi->num_bytes = (size_t)sg_query_surface_pitch(key->pixel_format, key->width, key->height, 1) * (size_t)key->sample_count;
+    return true;
+}
+
+// find a free pooled image with matching attributes, or create a new one, returns -1 on failure
+_SOKOL_PRIVATE int _srg_alloc_pool_image(const _srg_image_key_t* key, int first_pass, const char* label) {
+    int free_index = -1;
+    for (int i = 0; i < _srg.desc.max_pool_images; i++) {
+        _srg_pool_image_t* pi = &_srg.pool[i];
+        if (pi->img.id == SG_INVALID_ID) {
+            if (free_index == -1) {
+                free_index = i;
+            }
+        } else if ((pi->busy_until < first_pass) && _srg_key_equal(&pi->key, key)) {
+            return i;
+        }
+    }
+    if (free_index == -1) {
+        _SRG_ERROR(IMAGE_POOL_EXHAUSTED);
+        return -1;
+    }
+    if (!_srg_init_pool_image(&_srg.pool[free_index], key, label)) {
+        return -1;
+    }
+    _srg.pool[free_index].busy_until = -1;
+    return free_index;
+}
+
+// destroy pooled images which haven't been used for a while
+_SOKOL_PRIVATE void _srg_evict_pool_images(void) {
+    for (int i = 0; i < _srg.desc.max_pool_images; i++) {
+        _srg_pool_image_t* pi = &_srg.pool[i];
+        if ((pi->img.id != SG_INVALID_ID) && ((_srg.frame - pi->last_used_frame) > (uint32_t)_srg.desc.max_unused_frames)) {
+            _srg_destroy_pool_image(pi);
+        }
+    }
+}
+
+//  ██████  ██████  ███    ███ ██████  ██ ██      ███████
+// ██      ██    ██ ████  ████ ██   ██ ██ ██      ██
+// ██      ██    ██ ██ ████ ██ ██████  ██ ██      █████
+// ██      ██    ██ ██  ██  ██ ██      ██ ██      ██
+//  ██████  ██████  ██      ██ ██      ██ ███████ ███████
+//
+// >>compile
+_SOKOL_PRIVATE bool _srg_validate_passes(void) {
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        const _srg_pass_t* pass = &_srg.passes[pi];
+        for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+            if (((pass->desc.colors[i].id != 0) && (_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_COLOR, i) < 0)) ||
+                ((pass->desc.resolves[i].id != 0) && (_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_RESOLVE, i) < 0)))
+            {
+                _SRG_ERROR(INVALID_RESOURCE);
+                return false;
+            }
+        }
+        if ((pass->desc.depth_stencil.id != 0) && (_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_DEPTH_STENCIL, 0) < 0)) {
+            _SRG_ERROR(INVALID_RESOURCE);
+            return false;
+        }
+        for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+            const srg_resource res = pass->desc.reads[i];
+            if (res.id == 0) {
+                continue;
+            }
+            const int res_index = _srg_id_index(res.id, _srg.num_resources);
+            if (res_index < 0) {
+                _SRG_ERROR(INVALID_RESOURCE);
+                return false;
+            }
+            if (_srg_pass_writes(pass, res_index)) {
+                _SRG_ERROR(FEEDBACK_LOOP);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// passes which render into the swapchain or into imported images are the roots,
+// all passes which render into an image used by an alive pass are kept alive
+_SOKOL_PRIVATE void _srg_cull(void) {
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        _srg_pass_t* pass = &_srg.passes[pi];
+        pass->alive = pass->desc.never_cull || !_srg_pass_has_attachments(pass);
+        for (int ri = 0; !pass->alive && (ri < _srg.num_resources); ri++) {
+            pass->alive = _srg.resources[ri].imported && _srg_pass_writes(pass, ri);
+        }
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int ri = 0; ri < _srg.num_resources; ri++) {
+            _srg_resource_t* res = &_srg.resources[ri];
+            if (res->alive) {
+                continue;
+            }
+            for (int pi = 0; pi < _srg.num_passes; pi++) {
+                const _srg_pass_t* pass = &_srg.passes[pi];
+                if (pass->alive && (_srg_pass_reads(pass, ri) || _srg_pass_writes(pass, ri))) {
+                    res->alive = true;
+                    break;
+                }
+            }
+            if (res->alive) {
+                for (int pi = 0; pi < _srg.num_passes; pi++) {
+                    _srg_pass_t* pass = &_srg.passes[pi];
+                    if (!pass->alive && _srg_pass_writes(pass, ri)) {
+                        pass->alive = true;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+_SOKOL_PRIVATE void _srg_add_edge(int from, int to) {
+    if ((from >= 0) && (from != to)) {
+        SOKOL_ASSERT(_srg.num_edges < (_srg.desc.max_passes * _SRG_MAX_PASS_DEPS));
+        _srg.edges[_srg.num_edges].from = from;
+        _srg.edges[_srg.num_edges].to = to;
+        _srg.num_edges++;
+    }
+}
+
+// the alive passes which render into a resource are chained in declaration order,
+// and a pass which reads the resource depends on its last writer, which implies
+// that readers run after all writers without an edge per writer/reader pair
+_SOKOL_PRIVATE void _srg_build_edges(void) {
+    _srg.num_edges = 0;
+    for (int ri = 0; ri < _srg.num_resources; ri++) {
+        _srg.last_writer[ri] = -1;
+    }
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        if (!_srg.passes[pi].alive) {
+            continue;
+        }
+        for (int slot = 0; slot < _SRG_NUM_ATTACHMENT_SLOTS; slot++) {
+            const int ri = _srg_attachment_slot_index(&_srg.passes[pi].desc, slot);
+            if (ri >= 0) {
+                _srg_add_edge(_srg.last_writer[ri], pi);
+                _srg.last_writer[ri] = pi;
+            }
+        }
+    }
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        if (!_srg.passes[pi].alive) {
+            continue;
+        }
+        for (int i = 0; i < SRG_MAX_PASS_READS; i++) {
+            const srg_resource res = _srg.passes[pi].desc.reads[i];
+            if (res.id != 0) {
+                _srg_add_edge(_srg.last_writer[_srg_id_index(res.id, _srg.num_resources)], pi);
+            }
+        }
+    }
+}
+
+// Kahn's algorithm over the alive passes, prefers declaration order among ready passes
+_SOKOL_PRIVATE bool _srg_schedule(void) {
+    _srg_build_edges();
+    // group the edges by source pass: count, prefix sum, then fill each range backwards
+    for (int pi = 0; pi <= _srg.num_passes; pi++) {
+        _srg.succ_start[pi] = 0;
+    }
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        _srg.in_degree[pi] = 0;
+    }
+    for (int ei = 0; ei < _srg.num_edges; ei++) {
+        _srg.succ_start[_srg.edges[ei].from]++;
+        _srg.in_degree[_srg.edges[ei].to]++;
+    }
+    for (int pi = 1; pi <= _srg.num_passes; pi++) {
+        _srg.succ_start[pi] += _srg.succ_start[pi - 1];
+    }
+    for (int ei = 0; ei < _srg.num_edges; ei++) {
+        _srg.succ[--_srg.succ_start[_srg.edges[ei].from]] = _srg.edges[ei].to;
+    }
+    int num_alive = 0;
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        if (_srg.passes[pi].alive) {
+            num_alive++;
+        }
+    }
+    while (_srg.num_scheduled < num_alive) {
+        int ready = -1;
+        for (int pi = 0; pi < _srg.num_passes; pi++) {
+            const _srg_pass_t* pass = &_srg.passes[pi];
+            if (pass->alive && !pass->scheduled && (_srg.in_degree[pi] == 0)) {
+                ready = pi;
+                break;
+            }
+        }
+        if (ready == -1) {
+            _SRG_ERROR(DEPENDENCY_CYCLE);
+            return false;
+        }
+        _srg.passes[ready].scheduled = true;
+        _srg.passes[ready].order = _srg.num_scheduled;
+        _srg.schedule[_srg.num_scheduled++] = ready;
+        for (int si = _srg.succ_start[ready]; si < _srg.succ_start[ready + 1]; si++) {
+            _srg.in_degree[_srg.succ[si]]--;
+        }
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void _srg_compute_lifetimes(void) {
+    for (int ri = 0; ri < _srg.num_resources; ri++) {
+        _srg_resource_t* res = &_srg.resources[ri];
+        if (!res->alive) {
+            continue;
+        }
+        for (int order = 0; order < _srg.num_scheduled; order++) {
+            const _srg_pass_t* pass = &_srg.passes[_srg.schedule[order]];
+            const bool reads = _srg_pass_reads(pass, ri);
+            if (!reads && !_srg_pass_writes(pass, ri)) {
+                continue;
+            }
+            if (res->first_pass == -1) {
+                res->first_pass = order;
+            }
+            res->last_pass = order;
+            res->num_uses++;
+            res->read |= reads;
+            for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+                if (_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_RESOLVE, i) == ri) {
+                    res->resolve = true;
+                }
+                if ((_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_COLOR, i) == ri) &&
+                    (pass->desc.action.colors[i].load_action == SG_LOADACTION_LOAD))
+                {
+                    res->load = true;
+                }
+            }
+            if ((_srg_attachment_index(&pass->desc, _SRG_ATTACHMENT_DEPTH_STENCIL, 0) == ri) &&
+                ((pass->desc.action.depth.load_action == SG_LOADACTION_LOAD) ||
+                 (pass->desc.action.stencil.load_action == SG_LOADACTION_LOAD)))
+            {
+                res->load = true;
+            }
+        }
+        if (res->read && !res->written && !res->imported) {
+            _SRG_WARN(RESOURCE_NOT_WRITTEN);
+        }
+    }
+}
+
+// greedy aliasing: assign the images in order of their first use to the first free
+// compatible pooled image, an image becomes free again after its last use
+_SOKOL_PRIVATE bool _srg_alias(void) {
+    for (int i = 0; i < _srg.desc.max_pool_images; i++) {
+        _srg.pool[i].busy_until = -1;
+    }
+    for (int order = 0; order < _srg.num_scheduled; order++) {
+        for (int ri = 0; ri < _srg.num_resources; ri++) {
+            _srg_resource_t* res = &_srg.resources[ri];
+            if (!res->alive || res->imported || (res->first_pass != order)) {
+                continue;
+            }
+            _srg_image_key_t key;
+            _srg_clear(&key, sizeof(key));
+            key.width = res->desc.width;
+            key.height = res->desc.height;
+            key.pixel_format = res->desc.pixel_format;
+            key.sample_count = res->desc.sample_count;
+            // resolve targets hold the pass result and are never transient
+            key.transient = (res->num_uses == 1) && !res->read && !res->load && !res->resolve;
+            key.resolve = res->resolve;
+            res->pool_index = _srg_alloc_pool_image(&key, order, res->desc.label);
+            if (res->pool_index < 0) {
+                return false;
+            }
+            _srg_pool_image_t* pi = &_srg.pool[res->pool_index];
+            if (pi->busy_until == -1) {
+                _srg.stats.num_pool_images++;
+                _srg.stats.aliased_bytes += pi->num_bytes;
+            }
+            pi->busy_until = res->last_pass;
+            pi->last_used_frame = _srg.frame;
+            _srg.stats.naive_bytes += pi->num_bytes;
+        }
+    }
+    return true;
+}
+
+_SOKOL_PRIVATE void _srg_update_stats(void) {
+    _srg.stats.num_passes = _srg.num_passes;
+    _srg.stats.num_resources = _srg.num_resources;
+    for (int pi = 0; pi < _srg.num_passes; pi++) {
+        if (!_srg.passes[pi].alive) {
+            _srg.stats.num_culled_passes++;
+        }
+    }
+    for (int ri = 0; ri < _srg.num_resources; ri++) {
+        if (!_srg.resources[ri].alive) {
+            _srg.stats.num_culled_resources++;
+        }
+    }
+    for (int i = 0; i < _srg.desc.max_pool_images; i++) {
+        if (_srg.pool[i].img.id != SG_INVALID_ID) {
+            _srg.stats.num_pool_images_alive++;
+        }
+    }
+    _srg.stats.saved_bytes = _srg.stats.naive_bytes - _srg.stats.aliased_bytes;
+}
+
+// ███████ ██   ██ ███████  ██████ ██    ██ ████████ ███████
+// ██       ██ ██  ██      ██      ██    ██    ██    ██
+// █████     ███   █████   ██      ██    ██    ██    █████
+// ██       ██ ██  ██      ██      ██    ██    ██    ██
+// ███████ ██   ██ ███████  ██████  ██████     ██    ███████
+//
+// >>execute
+_SOKOL_PRIVATE sg_view _srg_attachment_view(const _srg_pass_t* pass, _srg_attachment_type_t type, int slot) {
+    sg_view view = { SG_INVALID_ID };
+    const int ri = _srg_attachment_index(&pass->desc, type, slot);
+    if (ri < 0) {
+        return view;
+    }
+    const _srg_resource_t* res = &_srg.resources[ri];
+    if (res->imported) {
+        view = (type == _SRG_ATTACHMENT_RESOLVE) ? res->import.resolve : res->import.attachment;
+    } else {
+        SOKOL_ASSERT(res->pool_index >= 0);
+        const _srg_pool_image_t* pi = &_srg.pool[res->pool_index];
+        view = (type == _SRG_ATTACHMENT_RESOLVE) ? pi->resolve_view : pi->att_view;
+    }
+    return view;
+}
+
+_SOKOL_PRIVATE void _srg_execute_pass(const _srg_pass_t* pass) {
+    sg_pass sgpass;
+    _srg_clear(&sgpass, sizeof(sgpass));
+    sgpass.action = pass->desc.action;
+    sgpass.label = pass->desc.label;
+    if (_srg_pass_has_attachments(pass)) {
+        for (int i = 0; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+            sgpass.attachments.colors[i] = _srg_attachment_view(pass, _SRG_ATTACHMENT_COLOR, i);
+            sgpass.attachments.resolves[i] = _srg_attachment_view(pass, _SRG_ATTACHMENT_RESOLVE, i);
+        }
+        sgpass.attachments.depth_stencil = _srg_attachment_view(pass, _SRG_ATTACHMENT_DEPTH_STENCIL, 0);
+    } else {
+        sgpass.swapchain = pass->desc.swapchain;
+    }
+    sg_begin_pass(&sgpass);
+    if (pass->desc.execute) {
+        pass->desc.execute(pass->desc.user_data);
+    }
+    sg_end_pass();
+}
+
+// ██████  ██    ██ ██████  ██      ██  ██████
+// ██   ██ ██    ██ ██   ██ ██      ██ ██
+// ██████  ██    ██ ██████  ██      ██ ██
+// ██      ██    ██ ██   ██ ██      ██ ██
+// ██       ██████  ██████  ███████ ██  ██████
+//
+// >>public
+SOKOL_API_IMPL void srg_setup(const srg_desc_t* desc) {
+    SOKOL_ASSERT(desc);
+    SOKOL_ASSERT((desc->max_passes >= 0) && (desc->max_resources >= 0) && (desc->max_pool_images >= 0));
+    SOKOL_ASSERT((desc->max_passes < _SRG_INDEX_MASK) && (desc->max_resources < _SRG_INDEX_MASK));
+    _srg_clear(&_srg, sizeof(_srg));
+    _srg.init_tag = _SRG_INIT_COOKIE;
+    _srg.desc = *desc;
+    _srg.desc.max_passes = _srg_def(desc->max_passes, _SRG_DEFAULT_MAX_PASSES);
+    _srg.desc.max_resources = _srg_def(desc->max_resources, _SRG_DEFAULT_MAX_RESOURCES);
+    _srg.desc.max_pool_images = _srg_def(desc->max_pool_images, _SRG_DEFAULT_MAX_POOL_IMAGES);
+    _srg.desc.max_unused_frames = _srg_def(desc->max_unused_frames, _SRG_DEFAULT_MAX_UNUSED_FRAMES);
+    _srg.passes = (_srg_pass_t*) _srg_malloc_clear((size_t)_srg.desc.max_passes * sizeof(_srg_pass_t));
+    _srg.resources = (_srg_resource_t*) _srg_malloc_clear((size_t)_srg.desc.max_resources * sizeof(_srg_resource_t));
+    _srg.schedule = (int*) _srg_malloc_clear((size_t)_srg.desc.max_passes * sizeof(int));
+    _srg.edges = (_srg_edge_t*) _srg_malloc_clear((size_t)(_srg.desc.max_passes * _SRG_MAX_PASS_DEPS) * sizeof(_srg_edge_t));
+    _srg.last_writer = (int*) _srg_malloc_clear((size_t)_srg.desc.max_resources * sizeof(int));
+    _srg.succ_start = (int*) _srg_malloc_clear((size_t)(_srg.desc.max_passes + 1) * sizeof(int));
+    _srg.succ = (int*) _srg_malloc_clear((size_t)(_srg.desc.max_passes * _SRG_MAX_PASS_DEPS) * sizeof(int));
+    _srg.in_degree = (int*) _srg_malloc_clear((size_t)_srg.desc.max_passes * sizeof(int));
+    _srg.pool = (_srg_pool_image_t*) _srg_malloc_clear((size_t)_srg.desc.max_pool_images * sizeof(_srg_pool_image_t));
+}
+
+SOKOL_API_IMPL void srg_shutdown(void) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    for (int i = 0; i < _srg.desc.max_pool_images; i++) {
+        if (_srg.pool[i].img.id != SG_INVALID_ID) {
+            _srg_destroy_pool_image(&_srg.pool[i]);
+        }
+    }
+    _srg_free(_srg.pool);
+    _srg_free(_srg.in_degree);
+    _srg_free(_srg.succ);
+    _srg_free(_srg.succ_start);
+    _srg_free(_srg.last_writer);
+    _srg_free(_srg.edges);
+    _srg_free(_srg.schedule);
+    _srg_free(_srg.resources);
+    _srg_free(_srg.passes);
+    _srg.init_tag = 0;
+}
+
+SOKOL_API_IMPL void srg_begin(void) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    _srg.frame++;
+    _srg.compiled = false;
+    _srg.valid = false;
+    _srg.num_passes = 0;
+    _srg.num_resources = 0;
+    _srg.num_scheduled = 0;
+    _srg_clear(&_srg.stats, sizeof(_srg.stats));
+    _srg_evict_pool_images();
+}
+
+SOKOL_API_IMPL srg_resource srg_create_image(const srg_image_desc_t* desc) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    SOKOL_ASSERT(!_srg.compiled);
+    SOKOL_ASSERT(desc && (desc->width > 0) && (desc->height > 0));
+    srg_resource res = { SG_INVALID_ID };
+    if (_srg.num_resources >= _srg.desc.max_resources) {
+        _SRG_ERROR(TOO_MANY_RESOURCES);
+        return res;
+    }
+    const sg_desc gfx_desc = sg_query_desc();
+    _srg_resource_t* r = &_srg.resources[_srg.num_resources];
+    _srg_clear(r, sizeof(_srg_resource_t));
+    r->desc = *desc;
+    r->desc.pixel_format = _srg_def(desc->pixel_format, gfx_desc.environment.defaults.color_format);
+    r->desc.sample_count = _srg_def(desc->sample_count, gfx_desc.environment.defaults.sample_count);
+    r->first_pass = -1;
+    r->last_pass = -1;
+    r->pool_index = -1;
+    res.id = _srg_make_id(_srg.num_resources++);
+    return res;
+}
+
+SOKOL_API_IMPL srg_resource srg_import_image(const srg_import_desc_t* desc) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    SOKOL_ASSERT(!_srg.compiled);
+    SOKOL_ASSERT(desc);
+    srg_resource res = { SG_INVALID_ID };
+    if (_srg.num_resources >= _srg.desc.max_resources) {
+        _SRG_ERROR(TOO_MANY_RESOURCES);
+        return res;
+    }
+    _srg_resource_t* r = &_srg.resources[_srg.num_resources];
+    _srg_clear(r, sizeof(_srg_resource_t));
+    r->imported = true;
+    r->import = *desc;
+    r->desc.label = desc->label;
+    r->first_pass = -1;
+    r->last_pass = -1;
+    r->pool_index = -1;
+    res.id = _srg_make_id(_srg.num_resources++);
+    return res;
+}
+
+SOKOL_API_IMPL srg_pass srg_add_pass(const srg_pass_desc_t* desc) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    SOKOL_ASSERT(!_srg.compiled);
+    SOKOL_ASSERT(desc);
+    srg_pass pass = { SG_INVALID_ID };
+    if (_srg.num_passes >= _srg.desc.max_passes) {
+        _SRG_ERROR(TOO_MANY_PASSES);
+        return pass;
+    }
+    _srg_pass_t* p = &_srg.passes[_srg.num_passes];
+    _srg_clear(p, sizeof(_srg_pass_t));
+    p->desc = *desc;
+    p->order = -1;
+    for (int ri = 0; ri < _srg.num_resources; ri++) {
+        if (_srg_pass_writes(p, ri)) {
+            _srg.resources[ri].written = true;
+        }
+    }
+    pass.id = _srg_make_id(_srg.num_passes++);
+    return pass;
+}
+
+SOKOL_API_IMPL bool srg_compile(void) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    if (_srg.compiled) {
+        return _srg.valid;
+    }
+    _srg.compiled = true;
+    _srg.valid = _srg_validate_passes();
+    if (_srg.valid) {
+        _srg_cull();
+        _srg.valid = _srg_schedule();
+    }
+    if (_srg.valid) {
+        _srg_compute_lifetimes();
+        _srg.valid = _srg_alias();
+    }
+    _srg_update_stats();
+    return _srg.valid;
+}
+
+SOKOL_API_IMPL void srg_execute(void) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    if (!srg_compile()) {
+        return;
+    }
+    for (int order = 0; order < _srg.num_scheduled; order++) {
+        _srg_execute_pass(&_srg.passes[_srg.schedule[order]]);
+    }
+}
+
+SOKOL_API_IMPL sg_image srg_image(srg_resource res) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    sg_image img = { SG_INVALID_ID };
+    const _srg_resource_t* r = _srg_lookup_resource(res);
+    if (r && _srg.valid && (r->pool_index >= 0)) {
+        img = _srg.pool[r->pool_index].img;
+    }
+    return img;
+}
+
+SOKOL_API_IMPL sg_view srg_texture_view(srg_resource res) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    sg_view view = { SG_INVALID_ID };
+    const _srg_resource_t* r = _srg_lookup_resource(res);
+    if (r && r->imported) {
+        view = r->import.texture;
+    } else if (r && _srg.valid && (r->pool_index >= 0)) {
+        view = _srg.pool[r->pool_index].tex_view;
+    }
+    return view;
+}
+
+SOKOL_API_IMPL srg_pass_info_t srg_query_pass_info(srg_pass pass) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    srg_pass_info_t info;
+    _srg_clear(&info, sizeof(info));
+    info.order = -1;
+    const int index = _srg_id_index(pass.id, _srg.num_passes);
+    if ((index >= 0) && _srg.compiled) {
+        const _srg_pass_t* p = &_srg.passes[index];
+        info.culled = !p->alive;
+        info.order = p->order;
+    }
+    return info;
+}
+
+SOKOL_API_IMPL srg_resource_info_t srg_query_resource_info(srg_resource res) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    srg_resource_info_t info;
+    _srg_clear(&info, sizeof(info));
+    info.first_pass = -1;
+    info.last_pass = -1;
+    info.pool_index = -1;
+    const _srg_resource_t* r = _srg_lookup_resource(res);
+    if (r && _srg.compiled) {
+        info.culled = !r->alive;
+        info.imported = r->imported;
+        info.first_pass = r->first_pass;
+        info.last_pass = r->last_pass;
+        info.pool_index = r->pool_index;
+        if (r->pool_index >= 0) {
+            info.transient = _srg.pool[r->pool_index].key.transient;
+            info.image = _srg.pool[r->pool_index].img;
+        }
+    }
+    return info;
+}
+
+SOKOL_API_IMPL srg_stats_t srg_query_stats(void) {
+    SOKOL_ASSERT(_srg.init_tag == _SRG_INIT_COOKIE);
+    return _srg.stats;
+}
+
+#endif // SOKOL_RENDERGRAPH_IMPL